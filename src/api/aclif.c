@@ -183,6 +183,7 @@ static int aclif_parse_request(int fd, struct api_session_data *sd)
 		aclif->terminate_connection(fd);
 		return 0;
 	}
+	const int request_id = sd->id;
 	if (!sd->handler->func(fd, sd)) {
 		aclif->reportError(fd, sd);
 		aclif->terminate_connection(fd);
@@ -192,7 +193,13 @@ static int aclif_parse_request(int fd, struct api_session_data *sd)
 		aclif->terminate_connection(fd);
 		return 0;
 	}
+	if (sd->id != request_id) {
+		// response already sent and session prepared for next request
+		return 0;
+	}
 	sd->flag.handled = 1;
+	// these handlers send no response, the client only sees the end of the request
+	// when the connection is closed, even if it asked for keep-alive.
 	if ((sd->handler->flags & REQ_AUTO_CLOSE) != 0)
 		aclif->terminate_connection(fd);
 	return 0;
@@ -203,6 +210,85 @@ static void aclif_terminate_connection(int fd)
 	sockt->close(fd);
 }
 
+/**
+ * Checks if connection will be kept open after response for current request.
+ * @param fd connection
+ * @return true if connection will be reused
+ */
+static bool aclif_is_keep_alive(int fd)
+{
+	if (!sockt->session_is_active(fd))
+		return false;
+	const struct api_session_data *sd = sockt->session[fd]->session_data;
+	if (sd == NULL || sd->flag.keep_alive == 0)
+		return false;
+	if (aclif->keep_alive_max_requests > 0 && sd->requests_count + 1 >= aclif->keep_alive_max_requests)
+		return false;
+	return true;
+}
+
+/**
+ * Must be called after response for current request was sent.
+ * Closes connection or prepares it for next (possible pipelined) request.
+ * @param fd connection
+ */
+static void aclif_finish_request(int fd)
+{
+	if (!aclif->is_keep_alive(fd)) {
+		aclif->terminate_connection(fd);
+		return;
+	}
+	struct api_session_data *sd = sockt->session[fd]->session_data;
+	sd->requests_count++;
+	aclif->reset_session(fd, sd);
+}
+
+/**
+ * Clears request related data from session.
+ * Allocated parse buffers and databases are kept for next request.
+ * Data already received for next pipelined request is kept too.
+ * @param fd connection
+ * @param sd session
+ */
+static void aclif_reset_session(int fd, struct api_session_data *sd)
+{
+	nullpo_retv(sd);
+
+	aFree(sd->url);
+	sd->url = NULL;
+	aFree(sd->temp_header);
+	sd->temp_header = NULL;
+	db_clear(sd->headers_db);
+	sd->post_headers_db->clear(sd->post_headers_db, aclif->post_headers_destroy_sub);
+	aFree(sd->multi_parser);
+	sd->multi_parser = NULL;
+	aFree(sd->temp_mime_header);
+	sd->temp_mime_header = NULL;
+	fifo_chunk_buf_clear(sd->data);
+	aFree(sd->custom);
+	sd->custom = NULL;
+	if (sd->json != NULL) {
+		jsonwriter->delete_(sd->json);
+		sd->json = NULL;
+	}
+
+	sd->body_size = 0;
+	sd->request_size = 0;
+	sd->headers_count = 0;
+	sd->post_headers_count = 0;
+	sd->has_errors = false;
+	sd->mime_flag = MIME_FLAG_NONE;
+	sd->handler = NULL;
+	sd->world_name = NULL;
+	sd->account_id = 0;
+	sd->char_id = 0;
+	memset(&sd->flag, 0, sizeof(sd->flag));
+	memset(sd->valid_post_headers, 0, sizeof(sd->valid_post_headers));
+	// late replies from inter servers for previous request will be ignored
+	sd->id = aclif->id_counter++;
+	httpparser->init_parser(fd, sd);
+}
+
 static int aclif_connected(int fd)
 {
 	ShowInfo("connected: %d\n", fd);
@@ -397,8 +483,11 @@ static void aclif_set_body(int fd, const char *body, size_t size)
 	struct api_session_data *sd = sockt->session[fd]->session_data;
 	nullpo_retv(sd);
 
-	aFree(sd->body);
-	sd->body = aMalloc(size + 1);
+	if (sd->body_alloc_size < size + 1) {
+		aFree(sd->body);
+		sd->body = aMalloc(size + 1);
+		sd->body_alloc_size = size + 1;
+	}
 	memcpy(sd->body, body, size);
 	sd->body[size] = 0;
 	sd->body_size = size;
@@ -1190,6 +1279,8 @@ void aclif_defaults(void)
 
 	aclif->remove_disconnected_delay = 5000;
 	aclif->id_counter = 0;
+	aclif->keep_alive = true;
+	aclif->keep_alive_max_requests = MAX_KEEP_ALIVE_REQUESTS;
 
 	for (int i = 0; i < HTTP_MAX_PROTOCOL; i ++) {
 		aclif->handlers_db[i] = NULL;
@@ -1207,6 +1298,9 @@ void aclif_defaults(void)
 	aclif->parse = aclif_parse;
 	aclif->parse_request = aclif_parse_request;
 	aclif->terminate_connection = aclif_terminate_connection;
+	aclif->finish_request = aclif_finish_request;
+	aclif->is_keep_alive = aclif_is_keep_alive;
+	aclif->reset_session = aclif_reset_session;
 	aclif->connected = aclif_connected;
 	aclif->socket_secure_check = aclif_socket_secure_check;
 	aclif->session_delete = aclif_session_delete;
@@ -71,6 +71,10 @@
 #define MAX_TEMP_HEADER_SIZE 5000
 #endif
 
+#ifndef MAX_KEEP_ALIVE_REQUESTS
+#define MAX_KEEP_ALIVE_REQUESTS 100
+#endif
+
 #ifndef HTTP_MAX_PROTOCOL
 #define HTTP_MAX_PROTOCOL (HTTP_SOURCE + 1)
 #endif
@@ -140,6 +144,8 @@ struct aclif_interface {
 	int api_fd;
 	int remove_disconnected_delay;
 	int id_counter;
+	bool keep_alive;              ///< allow persistent connections
+	int keep_alive_max_requests;  ///< max requests per connection (0 - unlimited)
 
 	struct DBMap *handlers_db[HTTP_MAX_PROTOCOL];
 	struct DBMap *online_db;
@@ -156,6 +162,9 @@ struct aclif_interface {
 	int (*parse) (int fd);
 	int (*parse_request) (int fd, struct api_session_data *sd);
 	void (*terminate_connection) (int fd);
+	void (*finish_request) (int fd);
+	bool (*is_keep_alive) (int fd);
+	void (*reset_session) (int fd, struct api_session_data *sd);
 	int (*connected) (int fd);
 	bool (*socket_secure_check) (int fd);
 	int (*session_delete) (int fd);
@@ -367,6 +367,12 @@ static void aloginif_parse_from_char(int fd, Handler_func func)
 {
 	RFIFO_API_PROXY_PACKET(p);
 	const int user_fd = p->client_fd;
+	if (user_fd == -1) {
+		// server notification, not bound to any client
+		if (func != NULL)
+			func(-1, NULL, RFIFOP(fd, WFIFO_APICHAR_SIZE), p->packet_len - WFIFO_APICHAR_SIZE);
+		return;
+	}
 	if (!sockt->session_is_active(user_fd))
 		return;
 	struct api_session_data *sd = sockt->session[user_fd]->session_data;
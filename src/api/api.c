@@ -358,6 +358,16 @@ static bool api_config_read(const char *filename, bool imported)
 
 	libconfig->setting_lookup_int(setting, "remove_disconnected_delay", &aclif->remove_disconnected_delay);
 	libconfig->setting_lookup_int(setting, "ip_connections_limit", &api->ip_connections_limit);
+	libconfig->setting_lookup_bool_real(setting, "keep_alive", &aclif->keep_alive);
+	libconfig->setting_lookup_int(setting, "keep_alive_max_requests", &aclif->keep_alive_max_requests);
+
+	struct config_setting_t *cache_setting = libconfig->setting_get_member(setting, "emblem_cache");
+	if (cache_setting != NULL) {
+		int max_size = 0;
+		libconfig->setting_lookup_int(cache_setting, "max_entries", &handlers->emblem_cache->max_entries);
+		if (libconfig->setting_lookup_int(cache_setting, "max_size", &max_size) == CONFIG_TRUE)
+			handlers->emblem_cache->max_size = (size_t)max(max_size, 0);
+	}
 
 	if (!api_config_read_console(filename, &config, imported))
 		retval = false;
@@ -64,6 +64,7 @@ struct api_session_data {
 		uint32 multi_part_begin : 1;     // multi part parsing started
 		uint32 multi_part_complete : 1;  // multi part parsing complete
 		uint32 handled : 1;              // http request already handled
+		uint32 keep_alive : 1;           // connection can be reused for next request
 	} flag;
 	char *url;
 	struct HttpHandler *handler;
@@ -78,6 +79,8 @@ struct api_session_data {
 	char *body;
 	const char *world_name;
 	size_t body_size;
+	size_t body_alloc_size;
+	int requests_count;  // requests finished on this connection
 	struct fifo_chunk_buf data;
 	JsonW *json;
 	void *custom;
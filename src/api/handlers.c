@@ -77,6 +77,7 @@
 
 static struct handlers_interface handlers_s;
 struct handlers_interface *handlers;
+static struct emblem_cache emblem_cache_s;
 
 //#define DEBUG_LOG
 //#define REQUEST_LOG
@@ -107,7 +108,7 @@ HTTP_DATA(userconfig_load)
 		}
 
 		httpsender->send_json_text(fd, "{\"Type\":4}", HTTP_STATUS_OK);
-		aclif->terminate_connection(fd);
+		aclif->finish_request(fd);
 		return;
 	}
 
@@ -122,7 +123,7 @@ HTTP_DATA(userconfig_load)
 	jsonwriter->delete_(json);
 	sd->json = NULL;
 
-	aclif->terminate_connection(fd);
+	aclif->finish_request(fd);
 }
 
 HTTP_DATA(userconfig_load_emotes)
@@ -290,7 +291,7 @@ HTTP_DATA(charconfig_load)
 	// send hardcoded settings
 	httpsender->send_plain(fd, "{\"Type\":1,\"data\":{\"HomunSkillInfo\":null,\"UseSkillInfo\":null}}");
 
-	aclif->terminate_connection(fd);
+	aclif->finish_request(fd);
 }
 
 HTTP_URL(charconfig_load)
@@ -314,12 +315,14 @@ HTTP_DATA(emblem_upload)
 
 	GET_HTTP_DATA(p, emblem_upload);
 
-	if (p->result == 1)
+	if (p->result == 1) {
+		const int guild_id = RET_INT_HEADER(GUILD_ID, 0);
+		handlers->emblem_cache_invalidate(guild_id);
 		httpsender->send_json_text(fd, "{\"Type\":1}", HTTP_STATUS_OK);
-	else // Not sure if intentional, but kRO sends status 500
+	} else // Not sure if intentional, but kRO sends status 500
 		httpsender->send_json_text(fd, "{\"Type\":4}", HTTP_STATUS_INTERNAL_SERVER_ERROR);
 
-	aclif->terminate_connection(fd);
+	aclif->finish_request(fd);
 }
 
 HTTP_URL(emblem_upload)
@@ -395,8 +398,14 @@ HTTP_DATA(emblem_download)
 	}
 
 	RFIFO_CHUNKED_COMPLETE(p) {
-		httpsender->send_binary(fd, sd->data.data, sd->data.data_size);
-		aclif->terminate_connection(fd);
+		const int guild_id = RET_INT_HEADER(GUILD_ID, 0);
+		const int version = RET_INT_HEADER(VERSION, 0);
+		char etag[32];
+
+		handlers->emblem_cache_store(guild_id, version, sd->data.data, sd->data.data_size);
+		handlers->emblem_etag(guild_id, version, etag, sizeof(etag));
+		httpsender->send_binary_etag(fd, sd->data.data, sd->data.data_size, etag);
+		aclif->finish_request(fd);
 	}
 }
 
@@ -408,16 +417,54 @@ HTTP_URL(emblem_download)
 #ifdef REQUEST_LOG
 	aclif->show_request(fd, sd, false);
 #endif
+	const int guild_id = RET_INT_HEADER(GUILD_ID, 0);
+	const int version = RET_INT_HEADER(VERSION, 0);
+
+	handlers->emblem_cache->stats.requests++;
+
+	const struct emblem_cache_entry *entry = handlers->emblem_cache_get(guild_id, version);
+	if (entry != NULL) {
+		char etag[32];
+		handlers->emblem_etag(guild_id, version, etag, sizeof(etag));
+
+		const char *if_none_match = (const char *)strdb_get(sd->headers_db, "If-None-Match");
+		if (if_none_match != NULL && strcmp(if_none_match, etag) == 0) {
+			handlers->emblem_cache->stats.not_modified++;
+			httpsender->send_not_modified(fd, etag);
+		} else {
+			httpsender->send_binary_etag(fd, entry->data, entry->data_size, etag);
+		}
+		aclif->finish_request(fd);
+		return true;
+	}
+
 	CREATE_HTTP_DATA(data, emblem_download);
 
-	data.guild_id = RET_INT_HEADER(GUILD_ID, 0);
-	data.version = RET_INT_HEADER(VERSION, 0);
+	data.guild_id = guild_id;
+	data.version = version;
 
 	SEND_CHAR_ASYNC_DATA(emblem_download, &data);
 
 	return true;
 }
 
+/**
+ * Notification from char-server that a guild emblem was changed.
+ * Not bound to any client session, so fd is -1 and sd is NULL.
+ * Not declared with HTTP_DATA, which marks sd as nonnull.
+ */
+static void handlers_emblem_changed(int fd, struct api_session_data *sd, const void *data, size_t data_size)
+{
+	nullpo_retv(data);
+	Assert_retv(data_size >= sizeof(struct PACKET_API_REPLY_emblem_changed));
+
+	const struct PACKET_API_REPLY_emblem_changed *p = data;
+#ifdef DEBUG_LOG
+	ShowInfo("emblem_changed: guild %d, version %d\n", p->guild_id, p->version);
+#endif
+	handlers->emblem_cache_invalidate(p->guild_id);
+}
+
 HTTP_DATA(party_list)
 {
 	GET_HTTP_DATA(p, party_list);
@@ -452,7 +499,7 @@ HTTP_DATA(party_list)
 
 	httpsender->send_json(fd, json);
 	jsonwriter->delete_(json);
-	aclif->terminate_connection(fd);
+	aclif->finish_request(fd);
 }
 
 HTTP_URL(party_list)
@@ -498,7 +545,7 @@ HTTP_DATA(party_get)
 
 	httpsender->send_json(fd, json);
 	jsonwriter->delete_(json);
-	aclif->terminate_connection(fd);
+	aclif->finish_request(fd);
 }
 
 HTTP_URL(party_get)
@@ -528,7 +575,7 @@ HTTP_DATA(party_add)
 
 	httpsender->send_json(fd, json);
 	jsonwriter->delete_(json);
-	aclif->terminate_connection(fd);
+	aclif->finish_request(fd);
 }
 
 HTTP_URL(party_add)
@@ -575,7 +622,7 @@ HTTP_DATA(party_del)
 
 	httpsender->send_json(fd, json);
 	jsonwriter->delete_(json);
-	aclif->terminate_connection(fd);
+	aclif->finish_request(fd);
 }
 
 HTTP_URL(party_del)
@@ -606,7 +653,7 @@ HTTP_DATA(party_info)
 
 	httpsender->send_json(fd, json);
 	jsonwriter->delete_(json);
-	aclif->terminate_connection(fd);
+	aclif->finish_request(fd);
 }
 
 HTTP_URL(party_info)
@@ -638,18 +685,206 @@ HTTP_URL(test_url)
 
 	httpsender->send_html(fd, buf);
 
-	aclif->terminate_connection(fd);
+	aclif->finish_request(fd);
 
 	return true;
 }
 
+/**
+ * Builds the ETag sent along with an emblem.
+ * @param guild_id guild id
+ * @param version emblem version as requested by client
+ * @param buf output buffer
+ * @param buf_size size of buf
+ */
+static void handlers_emblem_etag(int guild_id, int version, char *buf, size_t buf_size)
+{
+	nullpo_retv(buf);
+	snprintf(buf, buf_size, "\"%d-%d\"", guild_id, version);
+}
+
+/**
+ * Unlinks an entry from emblem cache and frees it.
+ * @param entry cache entry
+ */
+static void handlers_emblem_cache_remove(struct emblem_cache_entry *entry)
+{
+	struct emblem_cache *cache = handlers->emblem_cache;
+
+	nullpo_retv(entry);
+
+	if (entry->prev != NULL)
+		entry->prev->next = entry->next;
+	else
+		cache->head = entry->next;
+	if (entry->next != NULL)
+		entry->next->prev = entry->prev;
+	else
+		cache->tail = entry->prev;
+
+	idb_remove(cache->db, entry->guild_id);
+	cache->count--;
+	cache->size -= entry->data_size;
+	aFree(entry->data);
+	aFree(entry);
+}
+
+/**
+ * Moves an entry to head of lru list.
+ * @param entry cache entry
+ */
+static void handlers_emblem_cache_touch(struct emblem_cache_entry *entry)
+{
+	struct emblem_cache *cache = handlers->emblem_cache;
+
+	nullpo_retv(entry);
+
+	if (cache->head == entry)
+		return;
+
+	// unlink
+	if (entry->prev != NULL)
+		entry->prev->next = entry->next;
+	if (entry->next != NULL)
+		entry->next->prev = entry->prev;
+	else if (cache->tail == entry)
+		cache->tail = entry->prev;
+
+	// push front
+	entry->prev = NULL;
+	entry->next = cache->head;
+	if (cache->head != NULL)
+		cache->head->prev = entry;
+	cache->head = entry;
+	if (cache->tail == NULL)
+		cache->tail = entry;
+}
+
+/**
+ * Looks up an emblem in cache.
+ * Only exact guild id and version match is a hit.
+ * @param guild_id guild id
+ * @param version emblem version
+ * @return cache entry or NULL
+ */
+static struct emblem_cache_entry *handlers_emblem_cache_get(int guild_id, int version)
+{
+	struct emblem_cache *cache = handlers->emblem_cache;
+	struct emblem_cache_entry *entry = NULL;
+
+	if (cache->db != NULL)
+		entry = (struct emblem_cache_entry *)idb_get(cache->db, guild_id);
+	if (entry == NULL || entry->version != version) {
+		cache->stats.misses++;
+		return NULL;
+	}
+
+	cache->stats.hits++;
+	handlers_emblem_cache_touch(entry);
+	return entry;
+}
+
+/**
+ * Stores emblem received from char-server in cache,
+ * replacing any other version of same guild emblem.
+ * Least recently used entries are evicted if cache limits reached.
+ * @param guild_id guild id
+ * @param version emblem version
+ * @param data emblem data
+ * @param data_size emblem data size
+ */
+static void handlers_emblem_cache_store(int guild_id, int version, const char *data, size_t data_size)
+{
+	struct emblem_cache *cache = handlers->emblem_cache;
+
+	nullpo_retv(data);
+
+	if (cache->db == NULL || cache->max_entries <= 0 || data_size == 0 || data_size > cache->max_size)
+		return;
+
+	struct emblem_cache_entry *entry = (struct emblem_cache_entry *)idb_get(cache->db, guild_id);
+	if (entry != NULL)
+		handlers->emblem_cache_remove(entry);
+
+	while (cache->tail != NULL && (cache->count >= cache->max_entries || cache->size + data_size > cache->max_size)) {
+		handlers->emblem_cache_remove(cache->tail);
+		cache->stats.evictions++;
+	}
+
+	CREATE(entry, struct emblem_cache_entry, 1);
+	entry->guild_id = guild_id;
+	entry->version = version;
+	entry->data_size = data_size;
+	entry->data = aMalloc(data_size);
+	memcpy(entry->data, data, data_size);
+	idb_put(cache->db, guild_id, entry);
+	cache->count++;
+	cache->size += data_size;
+	cache->stats.stores++;
+	handlers_emblem_cache_touch(entry);
+}
+
+/**
+ * Removes all cached versions of guild emblem.
+ * @param guild_id guild id
+ */
+static void handlers_emblem_cache_invalidate(int guild_id)
+{
+	struct emblem_cache *cache = handlers->emblem_cache;
+
+	if (cache->db == NULL)
+		return;
+
+	struct emblem_cache_entry *entry = (struct emblem_cache_entry *)idb_get(cache->db, guild_id);
+	if (entry == NULL)
+		return;
+	handlers->emblem_cache_remove(entry);
+	cache->stats.invalidations++;
+}
+
+/**
+ * Removes all entries from emblem cache.
+ */
+static void handlers_emblem_cache_clear(void)
+{
+	struct emblem_cache *cache = handlers->emblem_cache;
+
+	while (cache->head != NULL)
+		handlers->emblem_cache_remove(cache->head);
+}
+
+/**
+ * Shows emblem cache counters.
+ */
+static void handlers_emblem_cache_report(void)
+{
+	const struct emblem_cache *cache = handlers->emblem_cache;
+
+	ShowInfo("Emblem cache: %d entries (%"PRIuS" bytes), %"PRIu64" requests, %"PRIu64" hits, %"PRIu64" not modified, %"PRIu64" misses, %"PRIu64" stores, %"PRIu64" evictions, %"PRIu64" invalidations.\n",
+		cache->count, cache->size, cache->stats.requests, cache->stats.hits, cache->stats.not_modified,
+		cache->stats.misses, cache->stats.stores, cache->stats.evictions, cache->stats.invalidations);
+}
+
 static int do_init_handlers(bool minimal)
 {
+	if (minimal)
+		return 0;
+
+	handlers->emblem_cache->db = idb_alloc(DB_OPT_BASE);
 	return 0;
 }
 
 static void do_final_handlers(void)
 {
+	struct emblem_cache *cache = handlers->emblem_cache;
+
+	if (cache->db == NULL)
+		return;
+
+	handlers->emblem_cache_report();
+	handlers->emblem_cache_clear();
+	db_destroy(cache->db);
+	cache->db = NULL;
 }
 
 void handlers_defaults(void)
@@ -660,6 +895,17 @@ void handlers_defaults(void)
 	handlers->sendHotkeyV2Tab = handlers_sendHotkeyV2Tab;
 	handlers->hotkeyTabIdToName = handlers_hotkeyTabIdToName;
 
+	handlers->emblem_cache = &emblem_cache_s;
+	handlers->emblem_cache->max_entries = EMBLEM_CACHE_MAX_ENTRIES;
+	handlers->emblem_cache->max_size = EMBLEM_CACHE_MAX_SIZE;
+	handlers->emblem_cache_get = handlers_emblem_cache_get;
+	handlers->emblem_cache_store = handlers_emblem_cache_store;
+	handlers->emblem_cache_invalidate = handlers_emblem_cache_invalidate;
+	handlers->emblem_cache_remove = handlers_emblem_cache_remove;
+	handlers->emblem_cache_clear = handlers_emblem_cache_clear;
+	handlers->emblem_cache_report = handlers_emblem_cache_report;
+	handlers->emblem_etag = handlers_emblem_etag;
+
 #define handler(method, url, func, flags) handlers->parse_ ## func = handlers_parse_ ## func
 #define handler2(method, url, func, flags) handlers->parse_ ## func = handlers_parse_ ## func; \
 	handlers->func = handlers_ ## func
@@ -31,6 +31,49 @@
 
 struct userconfig_userhotkeys_v2;
 
+#ifndef EMBLEM_CACHE_MAX_ENTRIES
+#define EMBLEM_CACHE_MAX_ENTRIES 512
+#endif
+
+#ifndef EMBLEM_CACHE_MAX_SIZE
+#define EMBLEM_CACHE_MAX_SIZE (8 * 1024 * 1024)
+#endif
+
+/**
+ * Cached guild emblem, as last received from the char server.
+ * Entries are linked in least recently used order.
+ **/
+struct emblem_cache_entry {
+	int guild_id;
+	int version;
+	char *data;
+	size_t data_size;
+	struct emblem_cache_entry *prev; ///< more recently used entry
+	struct emblem_cache_entry *next; ///< less recently used entry
+};
+
+/**
+ * LRU cache of guild emblems used by /emblem/download.
+ **/
+struct emblem_cache {
+	struct DBMap *db;                 ///< guild_id -> struct emblem_cache_entry*
+	struct emblem_cache_entry *head;  ///< most recently used entry
+	struct emblem_cache_entry *tail;  ///< least recently used entry
+	int count;
+	size_t size;                      ///< sum of all cached emblem sizes
+	int max_entries;                  ///< 0 disables the cache
+	size_t max_size;
+	struct {
+		uint64 requests;
+		uint64 hits;
+		uint64 not_modified;
+		uint64 misses;
+		uint64 stores;
+		uint64 evictions;
+		uint64 invalidations;
+	} stats;
+};
+
 /**
  * handlers.c Interface
  **/
@@ -40,6 +83,15 @@ struct handlers_interface {
 	void (*sendHotkeyV2Tab) (JsonP *json, struct userconfig_userhotkeys_v2 *hotkeys);
 	const char *(*hotkeyTabIdToName) (int tab_id);
 
+	struct emblem_cache *emblem_cache;
+	struct emblem_cache_entry *(*emblem_cache_get) (int guild_id, int version);
+	void (*emblem_cache_store) (int guild_id, int version, const char *data, size_t data_size);
+	void (*emblem_cache_invalidate) (int guild_id);
+	void (*emblem_cache_remove) (struct emblem_cache_entry *entry);
+	void (*emblem_cache_clear) (void);
+	void (*emblem_cache_report) (void);
+	void (*emblem_etag) (int guild_id, int version, char *buf, size_t buf_size);
+
 #define handler(method, url, func, flags) bool (*parse_ ## func) (int fd, struct api_session_data *sd)
 #define handler2(method, url, func, flags) bool (*parse_ ## func) (int fd, struct api_session_data *sd); \
 	void (*func) (int fd, struct api_session_data *sd, const void *data, size_t data_size)
@@ -31,6 +31,7 @@ typedef enum llhttp_method http_method;
 typedef llhttp_t HTTP_PARSER;
 #define http_method_str llhttp_method_name
 #define http_errno_name llhttp_errno_name
+#define http_should_keep_alive llhttp_should_keep_alive
 #define http_parser_settings llhttp_settings_s
 
 // Copiede from http_parser, as llhttp doesn´t have it
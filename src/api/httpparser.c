@@ -88,6 +88,7 @@ static int handler_on_headers_complete(HTTP_PARSER *parser)
 		return 0;
 
 	sd->flag.headers_complete = 1;
+	sd->flag.keep_alive = (aclif->keep_alive && http_should_keep_alive(parser)) ? 1 : 0;
 	aclif->check_headers(fd, sd);
 
 #ifdef DEBUG_LOG
@@ -118,7 +119,13 @@ static int handler_on_message_complete(HTTP_PARSER *parser)
 #ifdef DEBUG_LOG
 	ShowInfo("***MESSAGE COMPLETE***\n");
 #endif
+	// stop parsing here, rest of data belongs to next pipelined request
+#ifdef USE_HTTP_PARSER
+	http_parser_pause(parser, 1);
 	return 0;
+#else  // USE_HTTP_PARSER
+	return HPE_PAUSED;
+#endif  // USE_HTTP_PARSER
 }
 
 static int handler_on_chunk_header(HTTP_PARSER *parser)
@@ -359,27 +366,60 @@ static http_method httpparser_get_method(struct api_session_data *sd)
 	return sd->parser.method;
 }
 
-static bool httpparser_parse_real(int fd, struct api_session_data *sd, const char *data, size_t data_size)
+/**
+ * Runs http parser over given data.
+ * Parser stops after end of request, so parsed_size can be less than data_size.
+ * @param fd connection
+ * @param sd session
+ * @param data data to parse
+ * @param data_size size of data
+ * @param parsed_size number of bytes consumed by parser
+ * @return false on parse error
+ */
+static bool httpparser_parse_real(int fd, struct api_session_data *sd, const char *data, size_t data_size, size_t *parsed_size)
 {
 	nullpo_ret(sd);
+	nullpo_ret(parsed_size);
+	*parsed_size = 0;
 	if (data_size == 0)
 		return true;
 
 #ifdef USE_HTTP_PARSER
-	size_t parsed_size = http_parser_execute(&sd->parser, httpparser->settings, data, data_size);
-	if (data_size == parsed_size) {
-		sd->request_size += parsed_size;
-		return true;
-	}
+	const size_t parsed = http_parser_execute(&sd->parser, httpparser->settings, data, data_size);
+	if (data_size != parsed && HTTP_PARSER_ERRNO(&sd->parser) != HPE_PAUSED)
+		return false;
 #else  // USE_HTTP_PARSER
+	size_t parsed = data_size;
 	enum llhttp_errno err = llhttp_execute(&sd->parser, data, data_size);
-	if (err == HPE_OK) {
-		sd->request_size += data_size;
-		return true;
-	}
+	if (err == HPE_PAUSED)
+		parsed = llhttp_get_error_pos(&sd->parser) - data;
+	else if (err != HPE_OK)
+		return false;
 #endif  // USE_HTTP_PARSER
 
-	return false;
+	sd->request_size += parsed;
+	*parsed_size = parsed;
+	return true;
+}
+
+/**
+ * Parses data cached in request_temp and removes parsed part from it.
+ * @param fd connection
+ * @param sd session
+ * @param size size of data from start of request_temp to parse
+ * @return false on parse error
+ */
+static bool httpparser_parse_temp_request(int fd, struct api_session_data *sd, size_t size)
+{
+	nullpo_ret(sd);
+	Assert_ret(size <= sd->request_temp_size);
+
+	size_t parsed_size = 0;
+	if (!httpparser->parse_real(fd, sd, sd->request_temp, size, &parsed_size))
+		return false;
+	sd->request_temp_size -= parsed_size;
+	memmove(sd->request_temp, sd->request_temp + parsed_size, sd->request_temp_size);
+	return true;
 }
 
 static void httpparser_add_to_temp_request(int fd, struct api_session_data *sd, const char *data, size_t data_size)
@@ -422,38 +462,49 @@ static bool httpparser_parse(int fd)
 	nullpo_ret(sockt->session[fd]);
 
 	struct api_session_data *sd = sockt->session[fd]->session_data;
-	size_t data_size = RFIFOREST(fd);
-	if (data_size == 0)
-		return true;
-
-	const char *data = RFIFOP(fd, 0);
+	nullpo_ret(sd);
+	const size_t data_size = RFIFOREST(fd);
 
 	if (sd->flag.headers_complete == 0) {
 		// because parser cant handle part of header, need cache incomplete headers
-		httpparser->add_to_temp_request(fd, sd, data, data_size);
-		RFIFOSKIP(fd, data_size);
+		if (data_size != 0) {
+			httpparser->add_to_temp_request(fd, sd, RFIFOP(fd, 0), data_size);
+			RFIFOSKIP(fd, data_size);
+		}
+		if (sd->request_temp_size == 0)
+			return true;
 		if (sd->request_temp_size > MAX_TEMP_HEADER_SIZE) {
 			return false;
 		}
 		int idx = httpparser->search_request_line_end(sd);
-		if (idx >= 0) {
-			// in headers found separator and need parse them
-			Assert_retr(false, sd->request_temp_size >= (size_t)idx + 2); // We know idx is a positive integer so it's safe to cast
-			const bool res = httpparser->parse_real(fd, sd, sd->request_temp, idx + 2);
-			if (!res)
-				return false;
-			sd->request_temp_size -= idx + 2;
-			memmove(sd->request_temp, sd->request_temp + idx + 2, sd->request_temp_size);
+		if (idx < 0)
 			return true;
-		}
+		// in headers found separator and need parse them
+		Assert_retr(false, sd->request_temp_size >= (size_t)idx + 2); // We know idx is a positive integer so it's safe to cast
+		if (!httpparser->parse_temp_request(fd, sd, idx + 2))
+			return false;
+		if (sd->flag.headers_complete == 0 || sd->flag.message_complete == 1)
+			return true;
+	}
 
+	if (sd->flag.message_complete == 1)
 		return true;
-	} else {
-		// parse received non headers data
-		const bool res = httpparser->parse_real(fd, sd, data, data_size);
-		RFIFOSKIP(fd, data_size);
-		return res;
+
+	// body data received together with headers or previous request
+	if (sd->request_temp_size != 0) {
+		if (!httpparser->parse_temp_request(fd, sd, sd->request_temp_size))
+			return false;
+		if (sd->flag.message_complete == 1)
+			return true;
 	}
+
+	// parse received non headers data
+	if (RFIFOREST(fd) == 0)
+		return true;
+	size_t parsed_size = 0;
+	const bool res = httpparser->parse_real(fd, sd, RFIFOP(fd, 0), RFIFOREST(fd), &parsed_size);
+	RFIFOSKIP(fd, parsed_size);
+	return res;
 }
 
 static void httpparser_show_error(int fd, struct api_session_data *sd)
@@ -562,6 +613,7 @@ void httpparser_defaults(void)
 	httpparser->final = do_final_httpparser;
 	httpparser->parse = httpparser_parse;
 	httpparser->parse_real = httpparser_parse_real;
+	httpparser->parse_temp_request = httpparser_parse_temp_request;
 	httpparser->add_to_temp_request = httpparser_add_to_temp_request;
 	httpparser->search_request_line_end = httpparser_search_request_line_end;
 	httpparser->show_error = httpparser_show_error;
@@ -58,7 +58,6 @@
 
 static struct httpsender_interface httpsender_s;
 struct httpsender_interface *httpsender;
-static char tmp_buffer[MAX_RESPONSE_SIZE];
 
 //#define DEBUG_LOG
 
@@ -101,12 +100,106 @@ static void httpsender_send_continue(int fd)
 	ShowInfo("httpsender_send_continue\n");
 #endif  // DEBUG_LOG
 
-	safestrncpy(tmp_buffer, "HTTP/1.1 100 Continue\n\n", sizeof(tmp_buffer));
-	WFIFOHEAD(fd, strlen(tmp_buffer));
-	WFIFOADDSTR(fd, tmp_buffer);
+	const char *const reply = "HTTP/1.1 100 Continue\n\n";
+	WFIFOHEAD(fd, strlen(reply));
+	WFIFOADDSTR(fd, reply);
 	sockt->flush(fd);
 }
 
+/**
+ * Writes response status line and headers directly into fd write buffer.
+ * @param fd connection
+ * @param status response HTTP status
+ * @param content_type body content type or NULL if response has no body
+ * @param extra_headers additional header lines (each ending with new line) or NULL
+ * @param content_length body size
+ * @return true in case of success, false if something goes wrong
+ */
+static bool httpsender_send_headers(int fd, enum http_status status, const char *content_type, const char *extra_headers, size_t content_length)
+{
+	if (!sockt->session_is_active(fd))
+		return false;
+
+	const char *connection = aclif->is_keep_alive(fd) ? "keep-alive" : "close";
+	if (extra_headers == NULL)
+		extra_headers = "";
+
+	WFIFOHEAD(fd, MAX_RESPONSE_HEADER_SIZE);
+	int len;
+	if (content_type != NULL) {
+		len = snprintf(WFIFOP(fd, 0), MAX_RESPONSE_HEADER_SIZE,
+			"HTTP/1.1 %u %s\n"
+			"Server: %s\n"
+			"Connection: %s\n"
+			"Content-Type: %s\n"
+			"%s"
+			"Content-Length: %"PRIuS"\n"
+			"\n",
+			status, httpsender->http_status_name(status),
+			httpsender->server_name, connection, content_type, extra_headers, content_length);
+	} else {
+		len = snprintf(WFIFOP(fd, 0), MAX_RESPONSE_HEADER_SIZE,
+			"HTTP/1.1 %u %s\n"
+			"Server: %s\n"
+			"Connection: %s\n"
+			"%s"
+			"\n",
+			status, httpsender->http_status_name(status),
+			httpsender->server_name, connection, extra_headers);
+	}
+	if (len <= 0 || len >= MAX_RESPONSE_HEADER_SIZE) {
+		ShowError("httpsender_send_headers: response headers too big %d\n", fd);
+		return false;
+	}
+	WFIFOSET(fd, len);
+	return true;
+}
+
+/**
+ * Copies response body from data into fd write buffer.
+ * Body copied once without any intermediate buffer.
+ * Big bodies are split to blocks what socket layer accept.
+ * @param fd connection
+ * @param data body
+ * @param data_len body size
+ * @return true in case of success, false if something goes wrong
+ */
+static bool httpsender_send_body(int fd, const char *data, size_t data_len)
+{
+	nullpo_retr(false, data);
+
+	while (data_len > 0) {
+		const size_t block_len = min(data_len, MAX_RESPONSE_BLOCK_SIZE);
+		WFIFOHEAD(fd, block_len);
+		WFIFOADDBUF(fd, data, block_len);
+		data += block_len;
+		data_len -= block_len;
+	}
+	return true;
+}
+
+/**
+ * Sends full response to fd.
+ * @param fd connection
+ * @param status response HTTP status
+ * @param content_type body content type
+ * @param extra_headers additional header lines (each ending with new line) or NULL
+ * @param data body
+ * @param data_len body size
+ * @return true in case of success, false if something goes wrong
+ */
+static bool httpsender_send_response(int fd, enum http_status status, const char *content_type, const char *extra_headers, const char *data, size_t data_len)
+{
+	nullpo_retr(false, content_type);
+	nullpo_retr(false, data);
+
+	if (!httpsender->send_headers(fd, status, content_type, extra_headers, data_len))
+		return false;
+	httpsender->send_body(fd, data, data_len);
+	sockt->flush(fd);
+	return true;
+}
+
 static bool httpsender_send_html(int fd, const char *data)
 {
 #ifdef DEBUG_LOG
@@ -115,19 +208,7 @@ static bool httpsender_send_html(int fd, const char *data)
 
 	nullpo_retr(false, data);
 
-	const size_t sz = strlen(data);
-	size_t buf_sz = snprintf(tmp_buffer, sizeof(tmp_buffer),
-		"HTTP/1.1 200 OK\n"
-		"Server: %s\n"
-		"Content-Type: text/html\n"
-		"Content-Length: %"PRIuS"\n"
-		"\n"
-		"%s",
-		httpsender->server_name, sz, data);
-	WFIFOHEAD(fd, buf_sz);
-	WFIFOADDSTR(fd, tmp_buffer);
-	sockt->flush(fd);
-	return true;
+	return httpsender->send_response(fd, HTTP_STATUS_OK, "text/html", NULL, data, strlen(data));
 }
 
 static bool httpsender_send_json(int fd, const JsonW *json)
@@ -137,20 +218,10 @@ static bool httpsender_send_json(int fd, const JsonW *json)
 #endif  // DEBUG_LOG
 
 	char *data = jsonwriter->get_string(json);
-	const size_t sz = strlen(data);
-	size_t buf_sz = snprintf(tmp_buffer, sizeof(tmp_buffer),
-		"HTTP/1.1 200 OK\n"
-		"Server: %s\n"
-		"Content-Type: application/json; charset=utf-8\n"
-		"Content-Length: %"PRIuS"\n"
-		"\n"
-		"%s",
-		httpsender->server_name, sz, data);
+	nullpo_retr(false, data);
+	const bool res = httpsender->send_response(fd, HTTP_STATUS_OK, "application/json; charset=utf-8", NULL, data, strlen(data));
 	jsonwriter->free(data);
-	WFIFOHEAD(fd, buf_sz);
-	WFIFOADDSTR(fd, tmp_buffer);
-	sockt->flush(fd);
-	return true;
+	return res;
 }
 
 /**
@@ -172,21 +243,7 @@ static bool httpsender_send_json_text(int fd, const char *json, enum http_status
 
 	nullpo_retr(false, json);
 
-	const size_t sz = strlen(json);
-	size_t buf_sz = snprintf(tmp_buffer, sizeof(tmp_buffer),
-		"HTTP/1.1 %u %s\n"
-		"Server: %s\n"
-		"Content-Type: application/json; charset=utf-8\n"
-		"Content-Length: %"PRIuS"\n"
-		"\n"
-		"%s",
-		status, httpsender->http_status_name(status),
-		httpsender->server_name, sz, json);
-	WFIFOHEAD(fd, buf_sz);
-	WFIFOADDSTR(fd, tmp_buffer);
-	sockt->flush(fd);
-
-	return true;
+	return httpsender->send_response(fd, status, "application/json; charset=utf-8", NULL, json, strlen(json));
 }
 
 static bool httpsender_send_plain(int fd, const char *data)
@@ -197,19 +254,7 @@ static bool httpsender_send_plain(int fd, const char *data)
 
 	nullpo_retr(false, data);
 
-	const size_t sz = strlen(data);
-	size_t buf_sz = snprintf(tmp_buffer, sizeof(tmp_buffer),
-		"HTTP/1.1 200 OK\n"
-		"Server: %s\n"
-		"Content-Type: text/plain; charset=utf-8\n"
-		"Content-Length: %"PRIuS"\n"
-		"\n"
-		"%s",
-		httpsender->server_name, sz, data);
-	WFIFOHEAD(fd, buf_sz);
-	WFIFOADDSTR(fd, tmp_buffer);
-	sockt->flush(fd);
-	return true;
+	return httpsender->send_response(fd, HTTP_STATUS_OK, "text/plain; charset=utf-8", NULL, data, strlen(data));
 }
 
 static bool httpsender_send_binary(int fd, const char *data, const size_t data_len)
@@ -220,18 +265,50 @@ static bool httpsender_send_binary(int fd, const char *data, const size_t data_l
 
 	nullpo_retr(false, data);
 
-	size_t buf_sz = snprintf(tmp_buffer, sizeof(tmp_buffer),
-		"HTTP/1.1 200 OK\n"
-		"Server: %s\n"
-		"Content-Type: octet-stream\n"
-		"Content-Length: %"PRIuS"\n"
-		"\n",
-		httpsender->server_name, data_len);
-	WFIFOHEAD(fd, buf_sz);
-	WFIFOADDSTR(fd, tmp_buffer);
-	sockt->flush(fd);
-	WFIFOHEAD(fd, data_len);
-	WFIFOADDBUF(fd, data, data_len);
+	return httpsender->send_response(fd, HTTP_STATUS_OK, "octet-stream", NULL, data, data_len);
+}
+
+/**
+ * Sends binary content to fd along with ETag header.
+ * @param fd connection
+ * @param data binary data
+ * @param data_len size of data
+ * @param etag entity tag (with quotes)
+ * @return true in case of success, false if something goes wrong
+ */
+static bool httpsender_send_binary_etag(int fd, const char *data, const size_t data_len, const char *etag)
+{
+#ifdef DEBUG_LOG
+	ShowInfo("httpsender_send_binary_etag\n");
+#endif  // DEBUG_LOG
+
+	nullpo_retr(false, data);
+	nullpo_retr(false, etag);
+
+	char header[64];
+	snprintf(header, sizeof(header), "ETag: %s\n", etag);
+	return httpsender->send_response(fd, HTTP_STATUS_OK, "octet-stream", header, data, data_len);
+}
+
+/**
+ * Sends a "304 (Not Modified)" response to fd.
+ * Used when client already has the entity identified by etag.
+ * @param fd connection
+ * @param etag entity tag (with quotes)
+ * @return true in case of success, false if something goes wrong
+ */
+static bool httpsender_send_not_modified(int fd, const char *etag)
+{
+#ifdef DEBUG_LOG
+	ShowInfo("httpsender_send_not_modified\n");
+#endif  // DEBUG_LOG
+
+	nullpo_retr(false, etag);
+
+	char header[64];
+	snprintf(header, sizeof(header), "ETag: %s\n", etag);
+	if (!httpsender->send_headers(fd, HTTP_STATUS_NOT_MODIFIED, NULL, header, 0))
+		return false;
 	sockt->flush(fd);
 	return true;
 }
@@ -240,7 +317,6 @@ void httpsender_defaults(void)
 {
 	httpsender = &httpsender_s;
 
-	httpsender->tmp_buffer = tmp_buffer;
 	httpsender->server_name = "herc.ws/1.0";
 
 	httpsender->init = do_init_httpsender;
@@ -250,9 +326,15 @@ void httpsender_defaults(void)
 
 	httpsender->send_continue = httpsender_send_continue;
 
+	httpsender->send_headers = httpsender_send_headers;
+	httpsender->send_body = httpsender_send_body;
+	httpsender->send_response = httpsender_send_response;
+
 	httpsender->send_plain = httpsender_send_plain;
 	httpsender->send_html = httpsender_send_html;
 	httpsender->send_json = httpsender_send_json;
 	httpsender->send_json_text = httpsender_send_json_text;
 	httpsender->send_binary = httpsender_send_binary;
+	httpsender->send_binary_etag = httpsender_send_binary_etag;
+	httpsender->send_not_modified = httpsender_send_not_modified;
 }
@@ -28,13 +28,14 @@
 
 #include <stdarg.h>
 
-#ifndef MAX_RESPONSE_SIZE
-#define MAX_RESPONSE_SIZE 50000
+#ifndef MAX_RESPONSE_HEADER_SIZE
+#define MAX_RESPONSE_HEADER_SIZE 512
 #endif
 
-#if MAX_RESPONSE_SIZE < 100
-#error MAX_RESPONSE_SIZE must be atleast 100 bytes
-#endif  // MAX_RESPONSE_SIZE < 100
+// max size of one block written to socket buffer, must not exceed socket_max_client_packet
+#ifndef MAX_RESPONSE_BLOCK_SIZE
+#define MAX_RESPONSE_BLOCK_SIZE 0x4000
+#endif
 
 struct api_session_data;
 
@@ -42,7 +43,6 @@ struct api_session_data;
  * httpsender.c Interface
  **/
 struct httpsender_interface {
-	char *tmp_buffer;
 	char *server_name;
 	int (*init) (bool minimal);
 	void (*final) (void);
@@ -51,11 +51,17 @@ struct httpsender_interface {
 
 	void (*send_continue) (int fd);
 
+	bool (*send_headers) (int fd, enum http_status status, const char *content_type, const char *extra_headers, size_t content_length);
+	bool (*send_body) (int fd, const char *data, size_t data_len);
+	bool (*send_response) (int fd, enum http_status status, const char *content_type, const char *extra_headers, const char *data, size_t data_len);
+
 	bool (*send_plain) (int fd, const char *data);
 	bool (*send_html) (int fd, const char *data);
 	bool (*send_json) (int fd, const JsonW *json);
 	bool (*send_json_text) (int fd, const char *json, enum http_status status);
 	bool (*send_binary) (int fd, const char *data, const size_t data_len);
+	bool (*send_binary_etag) (int fd, const char *data, const size_t data_len, const char *etag);
+	bool (*send_not_modified) (int fd, const char *etag);
 };
 
 #ifdef HERCULES_CORE
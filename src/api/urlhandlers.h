@@ -37,3 +37,4 @@ handler2(HTTP_POST, "/party/info", party_info, REQ_API_AUTH | REQ_CHAR_ID | REQ_
 handler(HTTP_GET, "/test/url", test_url, REQ_DEFAULT);
 packet_handler(userconfig_load_emotes);
 packet_handler(userconfig_load_hotkeys);
+packet_handler(emblem_changed);
@@ -169,6 +169,32 @@ static void capiif_send_emblem_upload_result(int fd, int result)
 	WFIFOSET(chr->login_fd, packet->packet_len);
 }
 
+/**
+ * Notifies all api servers about changed guild emblem.
+ * @param guild_id guild id
+ * @param emblem_id new emblem version
+ */
+static void capiif_send_emblem_changed(int guild_id, int emblem_id)
+{
+	const int login_fd = chr->login_fd;
+	if (!sockt->session_is_active(login_fd))
+		return;
+
+	const int len = WFIFO_APICHAR_SIZE + sizeof(struct PACKET_API_REPLY_emblem_changed);
+	WFIFOHEAD(login_fd, len);
+	struct PACKET_API_PROXY *packet = WFIFOP(login_fd, 0);
+	memset(packet, 0, WFIFO_APICHAR_SIZE);
+	packet->packet_id = HEADER_API_PROXY_REPLY;
+	packet->packet_len = len;
+	packet->msg_id = API_MSG_emblem_changed;
+	packet->char_server_id = -1;
+	packet->client_fd = -1;
+	struct PACKET_API_REPLY_emblem_changed *data = WFIFOP(login_fd, WFIFO_APICHAR_SIZE);
+	data->guild_id = guild_id;
+	data->version = emblem_id;
+	WFIFOSET(login_fd, len);
+}
+
 void capiif_parse_emblem_upload_guild_id(int fd)
 {
 	RFIFO_API_PROXY_PACKET_CHUNKED(p);
@@ -364,6 +390,7 @@ void capiif_defaults(void) {
 	capiif->parse_userconfig_save_emotes = capiif_parse_userconfig_save_emotes;
 	capiif->parse_charconfig_load = capiif_parse_charconfig_load;
 	capiif->send_emblem_upload_result = capiif_send_emblem_upload_result;
+	capiif->send_emblem_changed = capiif_send_emblem_changed;
 	capiif->parse_emblem_upload = capiif_parse_emblem_upload;
 	capiif->parse_emblem_upload_guild_id = capiif_parse_emblem_upload_guild_id;
 	capiif->parse_emblem_download = capiif_parse_emblem_download;
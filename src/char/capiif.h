@@ -50,6 +50,7 @@ struct capiif_interface {
 	int (*parse_fromlogin_api_proxy) (int fd);
 	void (*parse_proxy_api_from_map) (int fd);
 	void (*send_emblem_upload_result) (int fd, int result);
+	void (*send_emblem_changed) (int guild_id, int emblem_id);
 };
 
 #ifdef HERCULES_CORE
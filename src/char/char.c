@@ -51,6 +51,7 @@
 #include "common/apipackets.h"
 #include "common/cbasetypes.h"
 #include "common/charloginpackets.h"
+#include "common/charmappackets.h"
 #include "common/mapcharpackets.h"
 #include "common/chunked.h"
 #include "common/conf.h"
@@ -58,6 +59,7 @@
 #include "common/core.h"
 #include "common/db.h"
 #include "common/extraconf.h"
+#include "common/grfio.h"
 #include "common/memmgr.h"
 #include "common/mapindex.h"
 #include "common/mmo.h"
@@ -199,6 +201,7 @@ static struct DBData char_create_online_char_data(union DBKey key, va_list args)
 	character->account_id = key.i;
 	character->char_id = -1;
 	character->mapserver_connection = OCS_NOT_CONNECTED;
+	character->server = -1;
 	character->pincode_enable = -1;
 	character->fd = -1;
 	character->waiting_disconnect = INVALID_TIMER;
@@ -231,13 +234,14 @@ static void char_set_char_charselect(int account_id)
 
 	character = (struct online_char_data*)idb_ensure(chr->online_char_db, account_id, chr->create_online_char_data);
 
-	if (character->mapserver_connection == OCS_NOT_CONNECTED) {
-		if (chr->map_server.users > 0) // Prevent this value from going negative.
-			chr->map_server.users--;
+	if (character->mapserver_connection == OCS_NOT_CONNECTED && character->server != -1) {
+		if (chr->map_server[character->server].users > 0) // Prevent this value from going negative.
+			chr->map_server[character->server].users--;
 	}
 
 	character->char_id = -1;
 	character->mapserver_connection = OCS_NOT_CONNECTED;
+	character->server = -1;
 
 	if(character->pincode_enable == -1)
 		character->pincode_enable = pincode->charselect + pincode->enabled;
@@ -251,7 +255,13 @@ static void char_set_char_charselect(int account_id)
 		chr->set_account_online(account_id, false);
 }
 
-static void char_set_char_online(bool is_initializing, int char_id, int account_id, bool standalone)
+/**
+ * Marks a character as online.
+ *
+ * @param map_id          Map-server the character is on (-1: not known yet).
+ * @param is_initializing Whether the character is just leaving char select.
+ */
+static void char_set_char_online(int map_id, bool is_initializing, int char_id, int account_id, bool standalone)
 {
 	struct online_char_data* character;
 	struct mmo_charstatus *cp;
@@ -264,14 +274,19 @@ static void char_set_char_online(bool is_initializing, int char_id, int account_
 	character = (struct online_char_data*)idb_ensure(chr->online_char_db, account_id, chr->create_online_char_data);
 
 	//Update state data
+	if (character->mapserver_connection == OCS_CONNECTED && character->server != -1) {
+		if (chr->map_server[character->server].users > 0) // Already counted on a map-server
+			chr->map_server[character->server].users--;
+	}
 	character->char_id = char_id;
+	character->server = map_id;
 	if (is_initializing)
 		character->mapserver_connection = OCS_UNKNOWN;
 	else
 		character->mapserver_connection = OCS_CONNECTED;
 
-	if (character->mapserver_connection == OCS_CONNECTED)
-		chr->map_server.users++;
+	if (character->mapserver_connection == OCS_CONNECTED && character->server != -1)
+		chr->map_server[character->server].users++;
 
 	//Get rid of disconnect timer
 	if(character->waiting_disconnect != INVALID_TIMER) {
@@ -318,9 +333,9 @@ static void char_set_char_offline(int char_id, int account_id)
 
 	if ((character = (struct online_char_data*)idb_get(chr->online_char_db, account_id)) != NULL) {
 		//We don't free yet to avoid aCalloc/aFree spamming during char change. [Skotlex]
-		if (character->mapserver_connection == OCS_CONNECTED) {
-			if (chr->map_server.users > 0) // Prevent this value from going negative.
-				chr->map_server.users--;
+		if (character->mapserver_connection == OCS_CONNECTED && character->server != -1) {
+			if (chr->map_server[character->server].users > 0) // Prevent this value from going negative.
+				chr->map_server[character->server].users--;
 		}
 
 		if(character->waiting_disconnect != INVALID_TIMER){
@@ -331,6 +346,7 @@ static void char_set_char_offline(int char_id, int account_id)
 		if (character->char_id == char_id) {
 			character->char_id = -1;
 			character->mapserver_connection = OCS_NOT_CONNECTED;
+			character->server = -1;
 			character->pincode_enable = -1;
 		}
 
@@ -343,14 +359,20 @@ static void char_set_char_offline(int char_id, int account_id)
 }
 
 /**
+ * Sets the characters of a map-server as 'unknown'.
+ *
+ * Arguments: int map_id (-1: all map-servers)
  * @see DBApply
  */
 static int char_db_setoffline(union DBKey key, struct DBData *data, va_list ap)
 {
 	struct online_char_data* character = (struct online_char_data*)DB->data2ptr(data);
+	int server = va_arg(ap, int);
 	nullpo_ret(character);
-	if (character->mapserver_connection == OCS_CONNECTED)
-		character->mapserver_connection = OCS_UNKNOWN; //In some map server that we aren't connected to.
+	if (server == -1 || character->server == server) {
+		if (character->mapserver_connection == OCS_CONNECTED)
+			character->mapserver_connection = OCS_UNKNOWN; //In some map server that we aren't connected to.
+	}
 	return 0;
 }
 
@@ -717,6 +739,8 @@ static int char_mmo_char_tosql(int char_id, struct mmo_charstatus *p)
 	StrBuf->Destroy(&buf);
 	if (chr->show_save_log && save_status[0] != '\0')
 		ShowInfo("Saved char %d - %s:%s.\n", char_id, p->name, save_status);
+	if (save_status[0] != '\0' || errors)
+		chr->char_list_cache_invalidate(p->account_id);
 	if (!errors)
 		memcpy(cp, p, sizeof(struct mmo_charstatus));
 	return 0;
@@ -1066,6 +1090,205 @@ static int char_mmo_gender(const struct char_session_data *sd, const struct mmo_
 #endif
 }
 
+/**
+ * Copies the cached character-select summary of the account into buf.
+ *
+ * @param sd    Session of the account; found_char and unban_time are restored from the cache.
+ * @param buf   Destination buffer (at least MAX_CHARS * MAX_CHAR_BUF bytes).
+ * @param count If not NULL, receives the number of characters.
+ * @return length copied into buf or -1 if the account isn't cached.
+ */
+static int char_list_cache_load(struct char_session_data *sd, uint8 *buf, int *count)
+{
+	struct char_list_cache_entry *entry;
+
+	nullpo_retr(-1, sd);
+	nullpo_retr(-1, buf);
+
+	if (chr->char_list_cache == NULL || chr->char_list_cache_timeout <= 0)
+		return -1;
+	if ((entry = idb_get(chr->char_list_cache, sd->account_id)) == NULL)
+		return -1;
+	if (DIFF_TICK(entry->expire_tick, timer->gettick()) <= 0) {
+		chr->char_list_cache_invalidate(sd->account_id);
+		return -1;
+	}
+
+	memcpy(sd->found_char, entry->found_char, sizeof(sd->found_char));
+	memcpy(sd->unban_time, entry->unban_time, sizeof(sd->unban_time));
+	memset(sd->new_name, 0, sizeof(sd->new_name));
+	if (entry->len > 0)
+		memcpy(buf, entry->buf, entry->len);
+	if (count != NULL)
+		*count = entry->count;
+	return entry->len;
+}
+
+/**
+ * Stores the character-select summary of the account, as just read from the database.
+ */
+static void char_list_cache_store(const struct char_session_data *sd, const uint8 *buf, int len, int count)
+{
+	struct char_list_cache_entry *entry;
+
+	nullpo_retv(sd);
+	nullpo_retv(buf);
+
+	if (chr->char_list_cache == NULL || chr->char_list_cache_timeout <= 0)
+		return;
+
+	if ((entry = idb_get(chr->char_list_cache, sd->account_id)) == NULL) {
+		CREATE(entry, struct char_list_cache_entry, 1);
+		idb_put(chr->char_list_cache, sd->account_id, entry);
+	}
+	if (entry->len != len) {
+		aFree(entry->buf);
+		entry->buf = len > 0 ? aMalloc(len) : NULL;
+	}
+	if (len > 0)
+		memcpy(entry->buf, buf, len);
+	entry->len = len;
+	entry->count = count;
+	memcpy(entry->found_char, sd->found_char, sizeof(entry->found_char));
+	memcpy(entry->unban_time, sd->unban_time, sizeof(entry->unban_time));
+	entry->expire_tick = timer->gettick() + chr->char_list_cache_timeout;
+}
+
+/**
+ * Drops the cached character-select summary of the account.
+ * Must be called whenever a field shown on char select is changed in the database.
+ */
+static void char_list_cache_invalidate(int account_id)
+{
+	struct char_list_cache_entry *entry;
+
+	if (chr->char_list_cache == NULL)
+		return;
+	if ((entry = idb_get(chr->char_list_cache, account_id)) == NULL)
+		return;
+
+	aFree(entry->buf);
+	idb_remove(chr->char_list_cache, account_id);
+}
+
+static int char_list_cache_invalidate_char_sub(union DBKey key, struct DBData *data, va_list ap)
+{
+	const struct char_list_cache_entry *entry = DB->data2ptr(data);
+	int char_id = va_arg(ap, int);
+	int *account_id = va_arg(ap, int *);
+	int i;
+
+	ARR_FIND(0, MAX_CHARS, i, entry->found_char[i] == char_id);
+	if (i < MAX_CHARS)
+		*account_id = key.i;
+	return 0;
+}
+
+/**
+ * Drops the cached character-select summary of the account owning the character.
+ * For callers which don't know the account; changes of this kind are rare, so
+ * the cache is just scanned.
+ */
+static void char_list_cache_invalidate_char(int char_id)
+{
+	const struct mmo_charstatus *cp;
+	int account_id = 0;
+
+	if (chr->char_list_cache == NULL || char_id <= 0)
+		return;
+
+	if ((cp = idb_get(chr->char_db_, char_id)) != NULL)
+		account_id = cp->account_id;
+	else
+		chr->char_list_cache->foreach(chr->char_list_cache, chr->char_list_cache_invalidate_char_sub, char_id, &account_id);
+
+	if (account_id != 0)
+		chr->char_list_cache_invalidate(account_id);
+}
+
+/**
+ * Timer function to remove expired char_list_cache entries and report the load statistics.
+ */
+static int char_list_cache_cleanup(int tid, int64 tick, int id, intptr_t data)
+{
+	if (chr->char_list_cache != NULL) {
+		struct DBIterator *iter = db_iterator(chr->char_list_cache);
+		struct char_list_cache_entry *entry;
+
+		for (entry = dbi_first(iter); dbi_exists(iter); entry = dbi_next(iter)) {
+			if (DIFF_TICK(entry->expire_tick, tick) > 0)
+				continue;
+			aFree(entry->buf);
+			dbi_remove(iter);
+		}
+		dbi_destroy(iter);
+	}
+
+	chr->load_stats_report();
+	return 0;
+}
+
+static int char_list_cache_final_sub(union DBKey key, struct DBData *data, va_list ap)
+{
+	struct char_list_cache_entry *entry = DB->data2ptr(data);
+
+	aFree(entry->buf);
+	entry->buf = NULL;
+	return 0;
+}
+
+/**
+ * Accounts a character which reached the map-server after char select.
+ *
+ * @param node      Auth node created on char select.
+ * @param load_time Time spent loading the full character data (ms), or -1 if it was already loaded.
+ */
+static void char_load_stats_add_login(const struct char_auth_node *node, int64 load_time)
+{
+	struct char_load_stats *stats = &chr->load_stats;
+	int64 tick = timer->gettick();
+
+	nullpo_retv(node);
+
+	if (load_time >= 0) {
+		stats->full_loads++;
+		stats->load_total += load_time;
+		stats->load_max = max(stats->load_max, load_time);
+	}
+
+	if (node->select_tick == 0)
+		return;
+
+	int64 select_time = DIFF_TICK(tick, node->select_tick);
+	stats->logins++;
+	stats->select_total += select_time;
+	stats->select_max = max(stats->select_max, select_time);
+	if (node->connect_tick != 0) {
+		int64 ingame_time = DIFF_TICK(tick, node->connect_tick);
+		stats->ingame_total += ingame_time;
+		stats->ingame_max = max(stats->ingame_max, ingame_time);
+	}
+}
+
+/**
+ * Shows and resets the character load statistics (when chr->show_save_log is enabled).
+ */
+static void char_load_stats_report(void)
+{
+	struct char_load_stats *stats = &chr->load_stats;
+
+	if (chr->show_save_log && (stats->list_requests > 0 || stats->logins > 0 || stats->full_loads > 0)) {
+		ShowInfo("Char list: %u sent, %u from cache. Char load: %u full loads (avg %"PRId64" ms, max %"PRId64" ms).\n",
+			stats->list_requests, stats->list_hits,
+			stats->full_loads, stats->full_loads > 0 ? stats->load_total / stats->full_loads : 0, stats->load_max);
+		if (stats->logins > 0)
+			ShowInfo("Login to ingame: %u chars, char select to map (avg %"PRId64" ms, max %"PRId64" ms), connect to map (avg %"PRId64" ms, max %"PRId64" ms).\n",
+				stats->logins, stats->select_total / stats->logins, stats->select_max,
+				stats->ingame_total / stats->logins, stats->ingame_max);
+	}
+	memset(stats, 0, sizeof(*stats));
+}
+
 //=====================================================================================================
 // Loads the basic character rooster for the given account. Returns total buffer used.
 static int char_mmo_chars_fromsql(struct char_session_data *sd, uint8 *buf, int *count)
@@ -1083,6 +1306,13 @@ static int char_mmo_chars_fromsql(struct char_session_data *sd, uint8 *buf, int
 	nullpo_ret(sd);
 	nullpo_ret(buf);
 
+	chr->load_stats.list_requests++;
+	if ((j = chr->char_list_cache_load(sd, buf, count)) >= 0) {
+		chr->load_stats.list_hits++;
+		return j;
+	}
+	j = 0;
+
 	stmt = SQL->StmtMalloc(inter->sql_handle);
 	if( stmt == NULL ) {
 		SqlStmt_ShowDebug(stmt);
@@ -1173,6 +1403,7 @@ static int char_mmo_chars_fromsql(struct char_session_data *sd, uint8 *buf, int
 	memset(sd->new_name, 0, sizeof(sd->new_name));
 
 	SQL->StmtFree(stmt);
+	chr->char_list_cache_store(sd, buf, j, tmpCount);
 	if (count)
 		*count = tmpCount;
 	return j;
@@ -1503,6 +1734,7 @@ static bool char_char_slotchange(struct char_session_data *sd, int fd, unsigned
 		return false;
 
 	from_id = sd->found_char[from];
+	chr->char_list_cache_invalidate(sd->account_id);
 
 	if( sd->found_char[to] > 0 ) {/* moving char to occupied slot */
 		bool result = false;
@@ -1581,6 +1813,7 @@ static int char_rename_char_sql(struct char_session_data *sd, int char_id)
 		Sql_ShowDebug(inter->sql_handle);
 		return 3;
 	}
+	chr->char_list_cache_invalidate(sd->account_id);
 
 	// Change character's name into guild_db.
 	if( char_dat.guild_id )
@@ -1787,6 +2020,7 @@ static int char_make_new_char_sql(struct char_session_data *sd, const char *name
 #endif
 	//Retrieve the newly auto-generated char id
 	char_id = (int)SQL->LastInsertId(inter->sql_handle);
+	chr->char_list_cache_invalidate(sd->account_id);
 
 	if( !char_id )
 		return -2;
@@ -1882,6 +2116,7 @@ static int char_delete_char_sql(int char_id)
 
 	SQL->EscapeStringLen(inter->sql_handle, esc_name, name, min(len, NAME_LENGTH));
 	SQL->FreeResult(inter->sql_handle);
+	chr->char_list_cache_invalidate(account_id);
 
 	//check for config char del condition [Lupus]
 	// TODO: Move this out to packet processing (0x68/0x1fb).
@@ -2017,11 +2252,14 @@ static int char_delete_char_sql(int char_id)
 //---------------------------------------------------------------------
 static int char_count_users(void)
 {
-	if (chr->map_server.fd > 0) {
-		return chr->map_server.users;
+	int users = 0;
+
+	for (int i = 0; i < MAX_MAP_SERVERS; i++) {
+		if (chr->map_server[i].fd > 0)
+			users += chr->map_server[i].users;
 	}
 
-	return 0;
+	return users;
 }
 
 // Writes char data to the buffer in the format used by the client.
@@ -2204,6 +2442,7 @@ static void char_mmo_char_send_ban_list(int fd, struct char_session_data *sd)
 					WFIFOL(fd, 4 + (24*c)) = 0;
 					/* also update on mysql */
 					sd->unban_time[i] = 0;
+					chr->char_list_cache_invalidate(sd->account_id);
 					if( SQL_ERROR == SQL->Query(inter->sql_handle, "UPDATE `%s` SET `unban_time`='0' WHERE `char_id`='%d' LIMIT 1", char_db, sd->found_char[i]) )
 						Sql_ShowDebug(inter->sql_handle);
 				}
@@ -2618,6 +2857,7 @@ static void char_change_sex_sub(int sex, int acc, int char_id, int class_, int g
 	}
 
 	SQL->StmtFree(stmt);
+	chr->char_list_cache_invalidate(acc);
 
 	/** Update guild member data if a guild ID was passed. **/
 	if (guild_id != 0)
@@ -3142,18 +3382,41 @@ static void char_map_received_ok(int fd)
 	WFIFOSET(fd,3+NAME_LENGTH);
 }
 
+/**
+ * Receives the maps loaded by a map-server.
+ *
+ * The map-server becomes the owner of the maps that no other map-server owns,
+ * the rest stays on standby there until moved with a map move request.
+ */
 static void char_parse_frommap_map_names(int fd)
 {
-	VECTOR_CLEAR(chr->map_server.maps);
-	VECTOR_ENSURE(chr->map_server.maps, (RFIFOW(fd, 2) - 4) / 4, 1);
+	int id = chr->mapserver_id(fd);
+	struct mmo_map_server *server = &chr->map_server[id];
+	int owned = 0;
+
+	VECTOR_CLEAR(server->maps);
+	VECTOR_ENSURE(server->maps, (RFIFOW(fd, 2) - 4) / 4, 1);
 	for (int i = 4; i < RFIFOW(fd,2); i += 4) {
-		VECTOR_PUSH(chr->map_server.maps, RFIFOW(fd, i));
+		uint16 m = RFIFOW(fd, i);
+
+		VECTOR_PUSH(server->maps, m);
+		if (m < MAX_MAPINDEX && chr->search_mapserver(m) == -1)
+			chr->map_owner[m] = id;
+		if (m < MAX_MAPINDEX && chr->map_owner[m] == id)
+			owned++;
 	}
 
-	ShowStatus("Map-Server connected: %d maps, from IP %u.%u.%u.%u port %d.\n",
-			(int)VECTOR_LENGTH(chr->map_server.maps), CONVIP(chr->map_server.ip), chr->map_server.port);
+	ShowStatus("Map-Server #%d connected: %d maps (%d owned), from IP %u.%u.%u.%u port %d.\n",
+			id, (int)VECTOR_LENGTH(server->maps), owned, CONVIP(server->ip), server->port);
 	ShowStatus("Map-server loading complete.\n");
 
+	// tell the new map-server where the other maps are, and everyone which maps it owns
+	// (before the ack, the map-server re-sends its pending map-server changes when it gets it)
+	for (int i = 0; i < MAX_MAP_SERVERS; i++) {
+		if (i != id && chr->map_server[i].fd > 0)
+			chr->send_maps_owned(fd, i);
+	}
+	chr->send_maps_owned(-1, id);
 	// send name for wisp to player
 	chr->map_received_ok(fd);
 	chr->send_fame_list(); //Send fame list.
@@ -3227,23 +3490,28 @@ static void char_parse_frommap_request_scdata(int fd)
 
 static void char_parse_frommap_set_users_count(int fd)
 {
-	if (RFIFOW(fd,2) != chr->map_server.users) {
-		chr->map_server.users = RFIFOW(fd, 2);
-		ShowInfo("User Count: %d\n", chr->map_server.users);
+	struct mmo_map_server *server = &chr->map_server[chr->mapserver_id(fd)];
+
+	if (RFIFOW(fd,2) != server->users) {
+		server->users = RFIFOW(fd, 2);
+		ShowInfo("User Count: %d (map-server #%d)\n", server->users, chr->mapserver_id(fd));
 	}
 	RFIFOSKIP(fd, 4);
 }
 
 static void char_parse_frommap_set_users(int fd)
 {
+	int id = chr->mapserver_id(fd);
+
 	//TODO: When data mismatches memory, update guild/party online/offline states.
-	chr->map_server.users = RFIFOW(fd,4);
-	chr->online_char_db->foreach(chr->online_char_db, chr->db_setoffline); //Set all chars from this server as 'unknown'
-	for (int i = 0; i < chr->map_server.users; i++) {
+	chr->map_server[id].users = RFIFOW(fd,4);
+	chr->online_char_db->foreach(chr->online_char_db, chr->db_setoffline, id); //Set all chars from this server as 'unknown'
+	for (int i = 0; i < chr->map_server[id].users; i++) {
 		int aid = RFIFOL(fd,6+i*8);
 		int cid = RFIFOL(fd,6+i*8+4);
 		struct online_char_data *character = idb_ensure(chr->online_char_db, aid, chr->create_online_char_data);
 		character->mapserver_connection = OCS_CONNECTED;
+		character->server = id;
 		character->char_id = cid;
 	}
 	//If any chars remain in -2, they will be cleaned in the cleanup timer.
@@ -3259,38 +3527,182 @@ static void char_save_character_ack(int fd, int aid, int cid)
 	WFIFOSET(fd,10);
 }
 
-static void char_parse_frommap_save_character(int fd)
+/**
+ * Saves character data received from the map-server.
+ *
+ * @param quitting Whether this is the final save of the character.
+ */
+static void char_save_character(int fd, int aid, int cid, bool quitting, struct mmo_charstatus *cs)
 {
-	int aid = RFIFOL(fd,4), cid = RFIFOL(fd,8), size = RFIFOW(fd,2);
 	struct online_char_data* character;
 
-	if (size - 13 != sizeof(struct mmo_charstatus)) {
-		ShowError("parse_from_map (save-char): Size mismatch! %d != %"PRIuS"\n", size-13, sizeof(struct mmo_charstatus));
-		RFIFOSKIP(fd,size);
-		return;
-	}
+	nullpo_retv(cs);
 	//Check account only if this ain't final save. Final-save goes through because of the char-map reconnect
-	if (RFIFOB(fd,12)
+	if (quitting
 	 || ( (character = (struct online_char_data*)idb_get(chr->online_char_db, aid)) != NULL
 	    && character->char_id == cid)
 	) {
-		struct mmo_charstatus char_dat;
-		memcpy(&char_dat, RFIFOP(fd,13), sizeof(struct mmo_charstatus));
-		chr->mmo_char_tosql(cid, &char_dat);
+		chr->mmo_char_tosql(cid, cs);
 	} else {
 		//This may be valid on char-server reconnection, when re-sending characters that already logged off.
 		ShowError("parse_from_map (save-char): Received data for non-existing/offline character (%d:%d).\n", aid, cid);
-		chr->set_char_online(false, cid, aid, false);
+		chr->set_char_online(chr->mapserver_id(fd), false, cid, aid, false);
 	}
 
-	if (RFIFOB(fd,12)) {
+	if (quitting) {
 		//Flag, set character offline after saving. [Skotlex]
 		chr->set_char_offline(cid, aid);
 		chr->save_character_ack(fd, aid, cid);
 	}
+}
+
+static void char_parse_frommap_save_character(int fd)
+{
+	int aid = RFIFOL(fd,4), cid = RFIFOL(fd,8), size = RFIFOW(fd,2);
+	struct mmo_charstatus char_dat;
+
+	if (size - 13 != sizeof(struct mmo_charstatus)) {
+		ShowError("parse_from_map (save-char): Size mismatch! %d != %"PRIuS"\n", size-13, sizeof(struct mmo_charstatus));
+		RFIFOSKIP(fd,size);
+		return;
+	}
+	memcpy(&char_dat, RFIFOP(fd,13), sizeof(struct mmo_charstatus));
+	chr->save_character(fd, aid, cid, RFIFOB(fd,12) != 0, &char_dat);
 	RFIFOSKIP(fd,size);
 }
 
+/**
+ * Receives a (possibly delta-encoded and compressed) save from the map-server.
+ * Deltas are applied on the last snapshot received for the character; when
+ * that snapshot is missing or outdated the map-server is asked for a full one.
+ */
+static void char_parse_frommap_save_character_delta(int fd)
+{
+	static uint8 zip_buf[sizeof(struct mmo_charstatus)];
+	const struct PACKET_MAPCHAR_SAVE_DELTA *p = RFIFOP(fd, 0);
+	const int size = p->packetLength;
+	const int aid = p->account_id, cid = p->char_id;
+	const bool quitting = p->flag != 0;
+	const uint8 *payload = p->data;
+	int len = size - (int)sizeof(*p);
+	struct char_save_base *base;
+	struct mmo_charstatus char_dat;
+
+	if (len < 0) {
+		ShowError("parse_from_map (save-char): Invalid packet length %d for character %d:%d.\n", size, aid, cid);
+		RFIFOSKIP(fd, size);
+		return;
+	}
+
+	if ((p->encoding & CHRIF_SAVE_ZLIB) != 0) {
+		unsigned long zip_len = sizeof(zip_buf);
+		if (p->raw_len > sizeof(zip_buf) || grfio->decode_zip(zip_buf, &zip_len, p->data, len) != 0 || zip_len != p->raw_len) {
+			ShowError("parse_from_map (save-char): Failed to decompress the data of character %d:%d.\n", aid, cid);
+			chr->save_resync(fd, aid, cid);
+			RFIFOSKIP(fd, size);
+			return;
+		}
+		payload = zip_buf;
+		len = (int)zip_len;
+	}
+
+	base = idb_get(chr->save_bases, cid);
+	if ((p->encoding & CHRIF_SAVE_DELTA) != 0) {
+		if (base == NULL || base->map_id != chr->mapserver_id(fd) || base->seq != p->base_seq) {
+			ShowWarning("parse_from_map (save-char): Delta save of character %d:%d doesn't match the last snapshot (%u != %u).\n",
+				aid, cid, p->base_seq, base != NULL ? base->seq : 0);
+			chr->save_resync(fd, aid, cid);
+			RFIFOSKIP(fd, size);
+			return;
+		}
+		memcpy(&char_dat, &base->status, sizeof(char_dat));
+		if (!chr->save_delta_apply(&char_dat, payload, len)) {
+			ShowError("parse_from_map (save-char): Invalid delta save of character %d:%d.\n", aid, cid);
+			chr->save_resync(fd, aid, cid);
+			RFIFOSKIP(fd, size);
+			return;
+		}
+	} else {
+		if (len != sizeof(char_dat)) {
+			ShowError("parse_from_map (save-char): Size mismatch! %d != %"PRIuS"\n", len, sizeof(char_dat));
+			RFIFOSKIP(fd, size);
+			return;
+		}
+		memcpy(&char_dat, payload, sizeof(char_dat));
+	}
+
+	if (quitting) {
+		idb_remove(chr->save_bases, cid);
+	} else {
+		if (base == NULL) {
+			CREATE(base, struct char_save_base, 1);
+			idb_put(chr->save_bases, cid, base);
+		}
+		base->map_id = chr->mapserver_id(fd);
+		base->seq = p->seq;
+		memcpy(&base->status, &char_dat, sizeof(base->status));
+	}
+
+	RFIFOSKIP(fd, size);
+	chr->save_character(fd, aid, cid, quitting, &char_dat);
+}
+
+/// Applies runs of (W offset, W length, data) on cs.
+static bool char_save_delta_apply(struct mmo_charstatus *cs, const uint8 *data, int len)
+{
+	uint8 *dst = (uint8 *)cs;
+	int pos = 0;
+
+	nullpo_retr(false, cs);
+	nullpo_retr(false, data);
+
+	while (pos < len) {
+		int offset, run;
+
+		if (pos + 4 > len)
+			return false;
+		offset = RBUFW(data, pos);
+		run = RBUFW(data, pos + 2);
+		if (offset + run > (int)sizeof(*cs) || pos + 4 + run > len)
+			return false;
+		memcpy(dst + offset, data + pos + 4, run);
+		pos += 4 + run;
+	}
+	return true;
+}
+
+/// Answers the save encodings supported by the map-server, and forgets the snapshots of the previous connection.
+static void char_parse_frommap_save_mode(int fd)
+{
+	const struct PACKET_MAPCHAR_SAVE_MODE_REQ *p = RFIFOP(fd, 0);
+	struct PACKET_CHARMAP_SAVE_MODE_ACK *ack;
+	uint8 modes = p->modes & (CHRIF_SAVE_DELTA | CHRIF_SAVE_ZLIB);
+
+	RFIFOSKIP(fd, sizeof(*p));
+	chr->save_bases->foreach(chr->save_bases, mapif->save_base_reset_sub, chr->mapserver_id(fd));
+
+	WFIFOHEAD(fd, sizeof(*ack));
+	ack = WFIFOP(fd, 0);
+	ack->packetType = HEADER_CHARMAP_SAVE_MODE_ACK;
+	ack->modes = modes;
+	WFIFOSET(fd, sizeof(*ack));
+}
+
+/// Asks the map-server for a full snapshot of a character.
+static void char_save_resync(int fd, int aid, int cid)
+{
+	struct PACKET_CHARMAP_SAVE_RESYNC *p;
+
+	idb_remove(chr->save_bases, cid);
+
+	WFIFOHEAD(fd, sizeof(*p));
+	p = WFIFOP(fd, 0);
+	p->packetType = HEADER_CHARMAP_SAVE_RESYNC;
+	p->account_id = aid;
+	p->char_id = cid;
+	WFIFOSET(fd, sizeof(*p));
+}
+
 // 0 - not ok
 // 1 - ok
 static void char_select_ack(int fd, int account_id, uint8 flag)
@@ -3414,6 +3826,7 @@ static void char_ban(int account_id, int char_id, time_t *unban_time, short year
 	}
 
 	SQL->StmtFree(stmt);
+	chr->char_list_cache_invalidate(account_id);
 
 	// condition applies; send to all map-servers to disconnect the player
 	if (timestamp > time(NULL)) {
@@ -3431,6 +3844,7 @@ static void char_unban(int char_id, int *result)
 		if (result)
 			*result = 1;
 	}
+	chr->char_list_cache_invalidate_char(char_id);
 }
 
 static void char_ask_name_ack(int fd, int acc, const char *name, int type, int result)
@@ -3682,7 +4096,7 @@ static void char_parse_frommap_set_all_offline(int fd)
 
 static void char_parse_frommap_set_char_online(int fd)
 {
-	chr->set_char_online(false, RFIFOL(fd, 2), RFIFOL(fd, 6), false);
+	chr->set_char_online(chr->mapserver_id(fd), false, RFIFOL(fd, 2), RFIFOL(fd, 6), false);
 	RFIFOSKIP(fd,10);
 }
 
@@ -3785,6 +4199,7 @@ static void char_parse_frommap_auth_request(int fd)
 	struct mmo_charstatus char_dat;
 	struct char_auth_node* node;
 	struct mmo_charstatus* cd;
+	int64 load_time = -1;
 
 	const struct PACKET_MAPCHAR_AUTH_REQ *p = RFIFOP(fd, 0);
 
@@ -3800,7 +4215,19 @@ static void char_parse_frommap_auth_request(int fd)
 	node = (struct char_auth_node*)idb_get(auth_db, account_id);
 	cd = (struct mmo_charstatus*)uidb_get(chr->char_db_,char_id);
 
-	if( cd == NULL ) { //Really shouldn't happen.
+	if (node != NULL && node->char_id == char_id && node->full_load != 0) {
+		// Coming from char select: only the status row was loaded, any other entry
+		// in char_db_ may be stale or partial. Load everything from the database.
+		int64 load_tick = timer->gettick_nocache();
+		if (chr->mmo_char_fromsql(char_id, &char_dat, true))
+			cd = (struct mmo_charstatus*)uidb_get(chr->char_db_,char_id);
+		else
+			cd = NULL; // never authenticate with the status row only
+		load_time = DIFF_TICK(timer->gettick_nocache(), load_tick);
+		if (cd != NULL && node->spawn_point.map != 0)
+			cd->last_point = node->spawn_point; // map chosen on char select, may be a fallback
+		node->full_load = 0;
+	} else if (cd == NULL) { //Really shouldn't happen.
 		chr->mmo_char_fromsql(char_id, &char_dat, true);
 		cd = (struct mmo_charstatus*)uidb_get(chr->char_db_,char_id);
 	}
@@ -3809,7 +4236,7 @@ static void char_parse_frommap_auth_request(int fd)
 		cd->sex = sex;
 
 		chr->map_auth_ok(fd, account_id, NULL, cd);
-		chr->set_char_online(false, char_id, account_id, true);
+		chr->set_char_online(chr->mapserver_id(fd), false, char_id, account_id, true);
 		return;
 	}
 
@@ -3826,9 +4253,10 @@ static void char_parse_frommap_auth_request(int fd)
 			cd->sex = sex;
 
 		chr->map_auth_ok(fd, account_id, node, cd);
+		chr->load_stats_add_login(node, load_time);
 		// only use the auth once and mark user online
 		idb_remove(auth_db, account_id);
-		chr->set_char_online(false, char_id, account_id, (standalone != 0));
+		chr->set_char_online(chr->mapserver_id(fd), false, char_id, account_id, (standalone != 0));
 	}
 	else
 	{// auth failed
@@ -3838,9 +4266,12 @@ static void char_parse_frommap_auth_request(int fd)
 
 static void char_parse_frommap_update_ip(int fd)
 {
-	chr->map_server.ip = ntohl(RFIFOL(fd, 2));
-	ShowInfo("Updated IP address of map-server to %u.%u.%u.%u.\n", CONVIP(chr->map_server.ip));
+	int id = chr->mapserver_id(fd);
+
+	chr->map_server[id].ip = ntohl(RFIFOL(fd, 2));
+	ShowInfo("Updated IP address of map-server #%d to %u.%u.%u.%u.\n", id, CONVIP(chr->map_server[id].ip));
 	RFIFOSKIP(fd,6);
+	chr->send_maps_owned(-1, id); // the other map-servers redirect players to the new address
 }
 
 static void char_parse_frommap_scdata_update(int fd)
@@ -3879,15 +4310,17 @@ static void char_parse_frommap_scdata_delete(int fd)
 
 static int char_parse_frommap(int fd)
 {
-	if (fd != chr->map_server.fd) { // not a map server
+	int id = chr->mapserver_id(fd);
+
+	if (id == -1) { // not a map server
 		ShowDebug("chr->parse_frommap: Disconnecting invalid session #%d (is not a map-server)\n", fd);
 		sockt->close(fd);
 		return 0;
 	}
 	if( sockt->session[fd]->flag.eof ) {
 		sockt->close(fd);
-		chr->map_server.fd = -1;
-		mapif->on_disconnect();
+		chr->map_server[id].fd = -1;
+		mapif->on_disconnect(id);
 		return 0;
 	}
 
@@ -3953,6 +4386,18 @@ static int char_parse_frommap(int fd)
 			}
 			break;
 
+			case HEADER_MAPCHAR_SAVE_DELTA: // Receive delta-encoded character data from map-server for saving
+				if (RFIFOREST(fd) < 4 || RFIFOREST(fd) < RFIFOW(fd,2))
+					return 0;
+				chr->parse_frommap_save_character_delta(fd);
+			break;
+
+			case HEADER_MAPCHAR_SAVE_MODE_REQ: // Character save encodings supported by the map-server
+				if (RFIFOREST(fd) < sizeof(struct PACKET_MAPCHAR_SAVE_MODE_REQ))
+					return 0;
+				chr->parse_frommap_save_mode(fd);
+			break;
+
 			case 0x2b02: // req char selection
 				if( RFIFOREST(fd) < 22 )
 					return 0;
@@ -4057,6 +4502,24 @@ static int char_parse_frommap(int fd)
 			}
 			break;
 
+			case HEADER_MAPCHAR_CHANGE_MAPSERVER_REQ: // character moving to another map-server
+				if (RFIFOREST(fd) < sizeof(struct PACKET_MAPCHAR_CHANGE_MAPSERVER_REQ))
+					return 0;
+				chr->parse_frommap_change_map_server(fd);
+			break;
+
+			case HEADER_MAPCHAR_MAP_MOVE_REQ: // move a map to the map-server
+				if (RFIFOREST(fd) < sizeof(struct PACKET_MAPCHAR_MAP_MOVE_REQ))
+					return 0;
+				chr->parse_frommap_map_move(fd);
+			break;
+
+			case HEADER_MAPCHAR_MAP_STATE: // state of a map moved to another map-server
+				if (RFIFOREST(fd) < 4 || RFIFOREST(fd) < RFIFOW(fd, 2))
+					return 0;
+				chr->parse_frommap_map_state(fd);
+			break;
+
 			case 0x2736: // ip address update
 				if (RFIFOREST(fd) < 6) return 0;
 				chr->parse_frommap_update_ip(fd);
@@ -4107,27 +4570,319 @@ static int char_parse_frommap(int fd)
 
 static void do_init_mapif(void)
 {
-	mapif->server_init();
+	for (int i = 0; i < MAX_MAP_SERVERS; i++)
+		mapif->server_init(i);
 }
 
 static void do_final_mapif(void)
 {
-	mapif->server_destroy();
+	for (int i = 0; i < MAX_MAP_SERVERS; i++)
+		mapif->server_destroy(i);
 }
 
 /**
- * Returns whether the currently connected map server has the given map index.
+ * Returns whether a connected map server owns the given map index.
  */
 static bool char_mapserver_has_map(unsigned short map)
 {
-	if (chr->map_server.fd <= 0)
-		return false;
-	int j;
-	ARR_FIND(0, VECTOR_LENGTH(chr->map_server.maps), j, VECTOR_INDEX(chr->map_server.maps, j) == map);
-	if (j != VECTOR_LENGTH(chr->map_server.maps))
-		return true;
+	return chr->search_mapserver(map) != -1;
+}
 
-	return false;
+/**
+ * Returns the map server connected on a session.
+ *
+ * @return The index of the map server in chr->map_server, or -1 if fd is not a map server.
+ */
+static int char_mapserver_id(int fd)
+{
+	int i;
+
+	if (fd <= 0)
+		return -1;
+	ARR_FIND(0, MAX_MAP_SERVERS, i, chr->map_server[i].fd == fd);
+	if (i == MAX_MAP_SERVERS)
+		return -1;
+	return i;
+}
+
+/**
+ * Returns the connected map server that owns a map.
+ *
+ * @return The index of the map server in chr->map_server, or -1 if no map server owns the map.
+ */
+static int char_search_mapserver(unsigned short map)
+{
+	int id;
+
+	if (map >= MAX_MAPINDEX)
+		return -1;
+	id = chr->map_owner[map];
+	if (id == -1 || chr->map_server[id].fd <= 0)
+		return -1;
+	return id;
+}
+
+/**
+ * Returns the connected map server listening on an address.
+ *
+ * @param ip   IP address, in host byte order.
+ * @param port Port, in host byte order.
+ * @return The index of the map server in chr->map_server, or -1 if not found.
+ */
+static int char_search_mapserver_addr(uint32 ip, uint16 port)
+{
+	int i;
+
+	ARR_FIND(0, MAX_MAP_SERVERS, i, chr->map_server[i].fd > 0 && chr->map_server[i].ip == ip && chr->map_server[i].port == port);
+	if (i == MAX_MAP_SERVERS)
+		return -1;
+	return i;
+}
+
+/**
+ * Tells the owner of a list of maps to map servers.
+ *
+ * @param fd    Map server to send the list to (-1: all of them).
+ * @param id    Owner of the maps (-1: no owner).
+ * @param maps  Map indexes.
+ * @param count Number of maps.
+ */
+static void char_send_map_owner(int fd, int id, const uint16 *maps, int count)
+{
+	struct PACKET_CHARMAP_MAP_OWNERS *p;
+	int len = (int)sizeof(*p) + count * (int)sizeof(p->maps[0]);
+
+	nullpo_retv(maps);
+	Assert_retv(id >= -1 && id < MAX_MAP_SERVERS);
+	Assert_retv(count >= 0 && count <= MAX_MAPINDEX);
+	if (count == 0)
+		return;
+
+	p = aMalloc(len);
+	p->packetType = HEADER_CHARMAP_MAP_OWNERS;
+	p->packetLength = len;
+	p->ip = id != -1 ? chr->map_server[id].ip : 0;
+	p->port = id != -1 ? chr->map_server[id].port : 0;
+	memcpy(p->maps, maps, count * sizeof(p->maps[0]));
+
+	if (fd < 0) {
+		mapif->send((const unsigned char *)p, len);
+	} else {
+		WFIFOHEAD(fd, len);
+		memcpy(WFIFOP(fd, 0), p, len);
+		WFIFOSET(fd, len);
+	}
+	aFree(p);
+}
+
+/// Tells the maps owned by a map server to map servers (fd -1: all of them).
+static void char_send_maps_owned(int fd, int id)
+{
+	uint16 *maps = NULL;
+	int count = 0;
+
+	Assert_retv(id >= 0 && id < MAX_MAP_SERVERS);
+	maps = aCalloc(MAX_MAPINDEX, sizeof(*maps));
+	for (int m = 0; m < MAX_MAPINDEX; m++) {
+		if (chr->map_owner[m] == id)
+			maps[count++] = m;
+	}
+	chr->send_map_owner(fd, id, maps, count);
+	aFree(maps);
+}
+
+/**
+ * Gives the maps owned by a map server to the other map servers that have them
+ * loaded, and tells the result to all the map servers.
+ */
+static void char_map_owner_release(int id)
+{
+	uint16 *released = NULL;
+	bool changed[MAX_MAP_SERVERS] = { false };
+	int count = 0;
+
+	Assert_retv(id >= 0 && id < MAX_MAP_SERVERS);
+	released = aCalloc(MAX_MAPINDEX, sizeof(*released));
+	for (int m = 0; m < MAX_MAPINDEX; m++) {
+		if (chr->map_owner[m] != id)
+			continue;
+		chr->map_owner[m] = -1;
+		for (int i = 0; i < MAX_MAP_SERVERS && chr->map_owner[m] == -1; i++) {
+			struct mmo_map_server *server = &chr->map_server[i];
+			int j;
+
+			if (i == id || server->fd <= 0)
+				continue;
+			ARR_FIND(0, VECTOR_LENGTH(server->maps), j, VECTOR_INDEX(server->maps, j) == m);
+			if (j != VECTOR_LENGTH(server->maps)) {
+				chr->map_owner[m] = i;
+				changed[i] = true;
+			}
+		}
+		if (chr->map_owner[m] == -1)
+			released[count++] = m;
+	}
+
+	for (int i = 0; i < MAX_MAP_SERVERS; i++) {
+		if (changed[i]) {
+			ShowStatus("Maps of map-server #%d taken over by map-server #%d.\n", id, i);
+			chr->send_maps_owned(-1, i);
+		}
+	}
+	chr->send_map_owner(-1, -1, released, count);
+	aFree(released);
+}
+
+static void char_change_map_server_ack(int fd, const struct PACKET_MAPCHAR_CHANGE_MAPSERVER_REQ *p, bool ok)
+{
+	struct PACKET_CHARMAP_CHANGE_MAPSERVER_ACK *ack;
+
+	nullpo_retv(p);
+	WFIFOHEAD(fd, sizeof(*ack));
+	ack = WFIFOP(fd, 0);
+	ack->packetType = HEADER_CHARMAP_CHANGE_MAPSERVER_ACK;
+	ack->account_id = p->account_id;
+	ack->login_id1 = p->login_id1;
+	ack->login_id2 = p->login_id2;
+	ack->char_id = p->char_id;
+	ack->map_index = p->map_index;
+	ack->x = p->x;
+	ack->y = p->y;
+	ack->ip = p->ip;
+	ack->port = p->port;
+	ack->result = ok ? 0 : 1;
+	WFIFOSET(fd, sizeof(*ack));
+}
+
+/**
+ * A character is moving to a map owned by another map server.
+ * Its data was saved right before, it's authenticated on the destination map
+ * server like a character coming from char select.
+ */
+static void char_parse_frommap_change_map_server(int fd)
+{
+	const struct PACKET_MAPCHAR_CHANGE_MAPSERVER_REQ *p = RFIFOP(fd, 0);
+	int id = chr->search_mapserver_addr(p->ip, p->port);
+	struct mmo_charstatus *cd;
+	struct char_auth_node *node;
+
+	if (core->runflag != CHARSERVER_ST_RUNNING || id == -1 || chr->search_mapserver(p->map_index) != id) {
+		ShowWarning("chr->parse_frommap_change_map_server: Map-server %u.%u.%u.%u:%d doesn't own map %d, character %d:%d stays on map-server #%d.\n",
+			CONVIP(p->ip), p->port, p->map_index, p->account_id, p->char_id, chr->mapserver_id(fd));
+		chr->change_map_server_ack(fd, p, false);
+		RFIFOSKIP(fd, sizeof(*p));
+		return;
+	}
+
+	cd = uidb_get(chr->char_db_, p->char_id);
+	if (cd == NULL) {
+		struct mmo_charstatus char_dat;
+		chr->mmo_char_fromsql(p->char_id, &char_dat, true);
+		cd = uidb_get(chr->char_db_, p->char_id);
+	}
+	if (cd != NULL) {
+		cd->last_point.map = p->map_index;
+		cd->last_point.x = p->x;
+		cd->last_point.y = p->y;
+	}
+
+	// create the auth entry used by the destination map-server
+	CREATE(node, struct char_auth_node, 1);
+	node->account_id = p->account_id;
+	node->char_id = p->char_id;
+	node->login_id1 = p->login_id1;
+	node->login_id2 = p->login_id2;
+	node->sex = p->sex;
+	node->expiration_time = 0; // unlimited/unknown time by default (not display in map-server)
+	node->ip = ntohl(p->client_addr);
+	node->group_id = p->group_id;
+	node->changing_mapservers = 1;
+	idb_put(auth_db, p->account_id, node);
+
+	chr->change_map_server_ack(fd, p, true);
+	RFIFOSKIP(fd, sizeof(*p));
+}
+
+static void char_map_move_ack(int fd, int account_id, uint16 map_index, uint8 result)
+{
+	struct PACKET_CHARMAP_MAP_MOVE_ACK *p;
+
+	WFIFOHEAD(fd, sizeof(*p));
+	p = WFIFOP(fd, 0);
+	p->packetType = HEADER_CHARMAP_MAP_MOVE_ACK;
+	p->account_id = account_id;
+	p->map_index = map_index;
+	p->result = result;
+	WFIFOSET(fd, sizeof(*p));
+}
+
+/**
+ * Moves a map to the requesting map server, which must have it loaded.
+ * The previous owner sends the players on the map to the new owner when it
+ * receives the new owner.
+ */
+static void char_parse_frommap_map_move(int fd)
+{
+	const struct PACKET_MAPCHAR_MAP_MOVE_REQ *p = RFIFOP(fd, 0);
+	int id = chr->mapserver_id(fd);
+	int account_id = p->account_id;
+	uint16 m = p->map_index;
+	struct mmo_map_server *server = NULL;
+	enum chrif_map_move_result result = CHRIF_MAP_MOVE_OK;
+	int j = 0;
+
+	RFIFOSKIP(fd, sizeof(*p));
+	Assert_retv(id >= 0 && id < MAX_MAP_SERVERS);
+	server = &chr->map_server[id];
+
+	if (m != 0 && m < MAX_MAPINDEX)
+		ARR_FIND(0, VECTOR_LENGTH(server->maps), j, VECTOR_INDEX(server->maps, j) == m);
+	if (m == 0 || m >= MAX_MAPINDEX) {
+		result = CHRIF_MAP_MOVE_UNKNOWN;
+	} else if (j == VECTOR_LENGTH(server->maps)) {
+		result = CHRIF_MAP_MOVE_NOT_LOADED;
+	} else if (chr->search_mapserver(m) == id) {
+		result = CHRIF_MAP_MOVE_ALREADY;
+	} else {
+		ShowStatus("Map '%s' moved from map-server #%d to map-server #%d.\n", mapindex_id2name(m), chr->search_mapserver(m), id);
+		chr->map_owner[m] = id;
+		chr->send_map_owner(-1, id, &m, 1);
+	}
+	chr->map_move_ack(fd, account_id, m, result);
+}
+
+/**
+ * Relays the state of a map sent by its previous owner to the map server the
+ * map moved to. It's dropped if the map has moved again since.
+ */
+static void char_parse_frommap_map_state(int fd)
+{
+	const struct PACKET_MAPCHAR_MAP_STATE *p = RFIFOP(fd, 0);
+	struct PACKET_CHARMAP_MAP_STATE *out;
+	int len = p->packetLength;
+	int data_len = len - (int)sizeof(*p);
+	int id = chr->search_mapserver_addr(p->ip, p->port);
+	int out_fd;
+
+	if (data_len < 0 || id == -1 || chr->search_mapserver(p->map_index) != id) {
+		ShowWarning("chr->parse_frommap_map_state: Map %d is not owned by map-server %u.%u.%u.%u:%d, state from map-server #%d dropped.\n",
+			p->map_index, CONVIP(p->ip), p->port, chr->mapserver_id(fd));
+		RFIFOSKIP(fd, len);
+		return;
+	}
+
+	out_fd = chr->map_server[id].fd;
+	WFIFOHEAD(out_fd, sizeof(*out) + data_len);
+	out = WFIFOP(out_fd, 0);
+	out->packetType = HEADER_CHARMAP_MAP_STATE;
+	out->packetLength = (uint16)(sizeof(*out) + data_len);
+	out->map_index = p->map_index;
+	out->type = p->type;
+	out->count = p->count;
+	if (data_len > 0)
+		memcpy(out->data, p->data, data_len);
+	WFIFOSET(out_fd, sizeof(*out) + data_len);
+	RFIFOSKIP(fd, len);
 }
 
 // Initialization process (currently only initialization inter_mapif)
@@ -4286,6 +5041,7 @@ static void char_delete2_req(int fd, struct char_session_data *sd)
 		chr->delete2_ack(fd, char_id, 3, 0); // 3: A database error occurred
 		return;
 	}
+	chr->char_list_cache_invalidate(sd->account_id);
 
 	chr->delete2_ack(fd, char_id, 1, delete_date); // 1: success
 }
@@ -4385,6 +5141,7 @@ static void char_delete2_cancel(int fd, struct char_session_data *sd)
 		chr->delete2_cancel_ack(fd, char_id, 2); // 2: A database error occurred
 		return;
 	}
+	chr->char_list_cache_invalidate(sd->account_id);
 
 	chr->delete2_cancel_ack(fd, char_id, 1); // 1: success
 }
@@ -4422,6 +5179,7 @@ static void char_parse_char_connect(int fd, struct char_session_data *sd, uint32
 	sd->login_id2 = login_id2;
 	sd->sex = sex;
 	sd->auth = false; // not authed yet
+	sd->connect_tick = timer->gettick();
 
 	// send back account_id
 	chr->send_account_id(fd, account_id);
@@ -4475,13 +5233,20 @@ static void char_send_map_info(int fd, uint32 subnet_map_ip, struct mmo_charstat
 	const int cmd = 0xac5;
 	const int len = 156;
 #endif
+	const struct mmo_map_server *server;
+	int id;
+
 	nullpo_retv(cd);
+	id = chr->search_mapserver(cd->last_point.map);
+	Assert_retv(id != -1);
+	server = &chr->map_server[id];
+
 	WFIFOHEAD(fd, len);
 	WFIFOW(fd, 0) = cmd;
 	WFIFOL(fd, 2) = cd->char_id;
 	mapindex->getmapname_ext(mapindex_id2name(cd->last_point.map), WFIFOP(fd, 6));
-	WFIFOL(fd, 22) = htonl((subnet_map_ip) ? subnet_map_ip : chr->map_server.ip);
-	WFIFOW(fd, 26) = sockt->ntows(htons(chr->map_server.port)); // [!] LE byte order here [!]
+	WFIFOL(fd, 22) = htonl((subnet_map_ip) ? subnet_map_ip : server->ip);
+	WFIFOW(fd, 26) = sockt->ntows(htons(server->port)); // [!] LE byte order here [!]
 #if PACKETVER >= 20170329
 	if (dnsHost != NULL) {
 		safestrncpy(WFIFOP(fd, 28), dnsHost, 128);
@@ -4539,6 +5304,7 @@ static void char_parse_char_select(int fd, struct char_session_data *sd, uint32
 	struct char_auth_node* node;
 	char* data;
 	int char_id;
+	int map_id;
 	int map_fd;
 	uint32 subnet_map_ip;
 	int slot = RFIFOB(fd,2);
@@ -4558,7 +5324,8 @@ static void char_parse_char_select(int fd, struct char_session_data *sd, uint32
 
 	/* not available, tell it to wait (client wont close; char select will respawn).
 	 * magic response found by Ind thanks to Yommy <3 */
-	if (chr->map_server.fd <= 0 || VECTOR_LENGTH(chr->map_server.maps) == 0) {
+	ARR_FIND(0, MAX_MAP_SERVERS, map_id, chr->map_server[map_id].fd > 0 && VECTOR_LENGTH(chr->map_server[map_id].maps) > 0);
+	if (map_id == MAX_MAP_SERVERS) {
 		chr->send_wait_char_server(fd);
 		return;
 	}
@@ -4584,21 +5351,25 @@ static void char_parse_char_select(int fd, struct char_session_data *sd, uint32
 	}
 
 	/* set char as online prior to loading its data so 3rd party applications will realize the sql data is not reliable */
-	chr->set_char_online(true, char_id, sd->account_id, false);
+	chr->set_char_online(-1, true, char_id, sd->account_id, false);
 	loginif->set_char_online(char_id, sd->account_id);
-	if (!chr->mmo_char_fromsql(char_id, &char_dat, true)) { /* failed? set it back offline */
+	/* Only the status row is needed to pick the map-server, the rest of the data
+	 * is loaded when the map-server requests the authentication (chr->parse_frommap_auth_request). */
+	if (!chr->mmo_char_fromsql(char_id, &char_dat, false)) { /* failed? set it back offline */
 		chr->set_char_offline(char_id, sd->account_id);
 		/* failed to load something. REJECT! */
 		chr->auth_error(fd, 0); // rejected from server
 		return;/* jump off this boat */
 	}
 
-	//Have to switch over to the DB instance otherwise data won't propagate [Kevin]
-	cd = (struct mmo_charstatus *)idb_get(chr->char_db_, char_id);
-	nullpo_retv(cd);
+	cd = &char_dat;
 	if( cd->sex == 99 )
 		cd->sex = sd->sex;
 
+	/* The status row isn't stored in char_db_, a client that never reaches the
+	 * map-server would leave it there. The map-server authentication loads the
+	 * full data and replaces any older entry, see node->full_load. */
+
 	if (chr->enable_logs) {
 		char esc_name[NAME_LENGTH*2+1];
 		// FIXME: Why are we re-escaping the name if it was already escaped in rename/make_new_char? [Panikon]
@@ -4624,7 +5395,8 @@ static void char_parse_char_select(int fd, struct char_session_data *sd, uint32
 	// if map is not found, we check major cities
 	if (!chr->mapserver_has_map(cd->last_point.map) || cd->last_point.map == 0) {
 		//First check that there's actually a map server online.
-		if (chr->map_server.fd < 0 || VECTOR_LENGTH(chr->map_server.maps) == 0) {
+		ARR_FIND(0, MAX_MAP_SERVERS, map_id, chr->map_server[map_id].fd > 0 && VECTOR_LENGTH(chr->map_server[map_id].maps) > 0);
+		if (map_id == MAX_MAP_SERVERS) {
 			ShowInfo("Connection Closed. No map servers available.\n");
 			chr->authfail_fd(fd, 1); // 1 = Server closed
 			return;
@@ -4638,11 +5410,10 @@ static void char_parse_char_select(int fd, struct char_session_data *sd, uint32
 
 	//Send NEW auth packet [Kevin]
 	//FIXME: is this case even possible? [ultramage]
-	if ((map_fd = chr->map_server.fd) < 1 || sockt->session[map_fd] == NULL)
+	map_id = chr->search_mapserver(cd->last_point.map);
+	if (map_id == -1 || (map_fd = chr->map_server[map_id].fd) < 1 || sockt->session[map_fd] == NULL)
 	{
-		ShowError("chr->parse_char: Attempting to write to invalid session %d! Map Server disconnected.\n", map_fd);
-		chr->map_server.fd = -1;
-		memset(&chr->map_server, 0, sizeof(struct mmo_map_server));
+		ShowError("chr->parse_char: No connected map-server owns map '%s'! Map Server disconnected.\n", mapindex_id2name(cd->last_point.map));
 		chr->authfail_fd(fd, 1); // 1 = Server closed
 		return;
 	}
@@ -4661,6 +5432,10 @@ static void char_parse_char_select(int fd, struct char_session_data *sd, uint32
 	node->expiration_time = sd->expiration_time;
 	node->group_id = sd->group_id;
 	node->ip = ipl;
+	node->full_load = 1;
+	node->spawn_point = cd->last_point;
+	node->connect_tick = sd->connect_tick;
+	node->select_tick = timer->gettick();
 	idb_put(auth_db, sd->account_id, node);
 }
 
@@ -4960,11 +5735,16 @@ static void char_login_map_server_ack(int fd, uint8 flag)
 static void char_parse_char_login_map_server(int fd, uint32 ipl)
 {
 	char l_user[24], l_pass[24];
+	uint32 map_ip = ntohl(RFIFOL(fd,54));
+	uint16 map_port = ntohs(RFIFOW(fd,58));
+	int id;
 	safestrncpy(l_user, RFIFOP(fd,2), 24);
 	safestrncpy(l_pass, RFIFOP(fd,26), 24);
 
+	ARR_FIND(0, MAX_MAP_SERVERS, id, chr->map_server[id].fd <= 0);
 	if (core->runflag != CHARSERVER_ST_RUNNING ||
-		chr->map_server.fd > 0 ||
+		id == MAX_MAP_SERVERS || // no free slot
+		chr->search_mapserver_addr(map_ip, map_port) != -1 ||
 		strcmp(l_user, chr->userid) != 0 ||
 		strcmp(l_pass, chr->passwd) != 0 ||
 		!sockt->allowed_ip_check(ipl))
@@ -4974,10 +5754,10 @@ static void char_parse_char_login_map_server(int fd, uint32 ipl)
 	} else {
 		chr->login_map_server_ack(fd, 0); // Success
 
-		chr->map_server.fd = fd;
-		chr->map_server.ip = ntohl(RFIFOL(fd,54));
-		chr->map_server.port = ntohs(RFIFOW(fd,58));
-		chr->map_server.users = 0;
+		chr->map_server[id].fd = fd;
+		chr->map_server[id].ip = map_ip;
+		chr->map_server[id].port = map_port;
+		chr->map_server[id].users = 0;
 		sockt->session[fd]->func_parse = chr->parse_frommap;
 		sockt->session[fd]->flag.server = 1;
 		sockt->session[fd]->flag.validate = 0;
@@ -5750,6 +6530,11 @@ static bool char_config_read_database(const char *filename, const struct config_
 	libconfig->setting_lookup_mutable_string(setting, "db_path", chr->db_path, sizeof(chr->db_path));
 	libconfig->set_db_path(chr->db_path);
 	libconfig->setting_lookup_bool_real(setting, "log_char", &chr->enable_logs);
+	if (libconfig->setting_lookup_int(setting, "char_list_cache_timeout", &chr->char_list_cache_timeout) == CONFIG_TRUE) {
+		if (chr->char_list_cache_timeout < 0)
+			chr->char_list_cache_timeout = 0;
+		chr->char_list_cache_timeout *= 1000;
+	}
 	return true;
 }
 
@@ -6148,6 +6933,9 @@ int do_final(void)
 		Sql_ShowDebug(inter->sql_handle);
 
 	chr->char_db_->destroy(chr->char_db_, NULL);
+	chr->char_list_cache->destroy(chr->char_list_cache, chr->char_list_cache_final_sub);
+	db_destroy(chr->save_bases);
+	chr->load_stats_report();
 	chr->online_char_db->destroy(chr->online_char_db, chr->online_char_destroy_sub);
 	auth_db->destroy(auth_db, NULL);
 
@@ -6161,7 +6949,8 @@ int do_final(void)
 	SQL->Free(inter->sql_handle);
 	mapindex->final();
 
-	VECTOR_CLEAR(chr->map_server.maps);
+	for (int i = 0; i < MAX_MAP_SERVERS; i++)
+		VECTOR_CLEAR(chr->map_server[i].maps);
 
 	VECTOR_CLEAR(start_items);
 
@@ -6197,7 +6986,8 @@ static void do_shutdown(void)
 		core->runflag = CHARSERVER_ST_SHUTDOWN;
 		ShowStatus("Shutting down...\n");
 		// TODO proper shutdown procedure; wait for acks?, kick all characters, ... [FlavoJS]
-		mapif->server_reset();
+		for (int i = 0; i < MAX_MAP_SERVERS; i++)
+			mapif->server_reset(i);
 		loginif->check_shutdown();
 		sockt->flush_fifos();
 		core->runflag = CORE_ST_STOP;
@@ -6278,7 +7068,8 @@ int do_init(int argc, char **argv)
 
 	VECTOR_INIT(start_items);
 
-	VECTOR_INIT(chr->map_server.maps);
+	for (int i = 0; i < MAX_MAP_SERVERS; i++)
+		VECTOR_INIT(chr->map_server[i].maps);
 
 	HPM_char_do_init();
 	cmdline->exec(argc, argv, CMDLINE_OPT_PREINIT);
@@ -6336,6 +7127,8 @@ int do_init(int argc, char **argv)
 
 	auth_db = idb_alloc(DB_OPT_RELEASE_DATA);
 	chr->online_char_db = idb_alloc(DB_OPT_RELEASE_DATA);
+	chr->char_list_cache = idb_alloc(DB_OPT_RELEASE_DATA);
+	chr->save_bases = idb_alloc(DB_OPT_RELEASE_DATA);
 
 	HPM->event(HPET_INIT);
 
@@ -6375,6 +7168,10 @@ int do_init(int argc, char **argv)
 	timer->add_func_list(chr->online_data_cleanup, "chr->online_data_cleanup");
 	timer->add_interval(timer->gettick() + 1000, chr->online_data_cleanup, 0, 0, 600 * 1000);
 
+	// Expire cached character lists and report load statistics
+	timer->add_func_list(chr->char_list_cache_cleanup, "chr->char_list_cache_cleanup");
+	timer->add_interval(timer->gettick() + 60 * 1000, chr->char_list_cache_cleanup, 0, 0, 60 * 1000);
+
 	//Cleaning the tables for NULL entries @ startup [Sirius]
 	//Chardb clean
 	if( SQL_ERROR == SQL->Query(inter->sql_handle, "DELETE FROM `%s` WHERE `account_id` = '0'", char_db) )
@@ -6446,6 +7243,7 @@ void char_defaults(void)
 	chr = &char_s;
 
 	memset(&chr->map_server, 0, sizeof(chr->map_server));
+	memset(&chr->map_owner, -1, sizeof(chr->map_owner));
 	sprintf(chr->db_path, "db");
 	libconfig->set_db_path(chr->db_path);
 
@@ -6453,6 +7251,10 @@ void char_defaults(void)
 	chr->char_fd = -1;
 	chr->online_char_db = NULL;
 	chr->char_db_ = NULL;
+	chr->char_list_cache = NULL;
+	chr->save_bases = NULL;
+	chr->char_list_cache_timeout = DEFAULT_CHAR_LIST_CACHE_TIMEOUT;
+	memset(&chr->load_stats, 0, sizeof(chr->load_stats));
 
 	memset(chr->userid, 0, sizeof(chr->userid));
 	memset(chr->passwd, 0, sizeof(chr->passwd));
@@ -6487,6 +7289,15 @@ void char_defaults(void)
 	chr->mmo_chars_fromsql = char_mmo_chars_fromsql;
 	chr->mmo_char_fromsql = char_mmo_char_fromsql;
 	chr->mmo_char_sql_init = char_mmo_char_sql_init;
+	chr->char_list_cache_load = char_list_cache_load;
+	chr->char_list_cache_store = char_list_cache_store;
+	chr->char_list_cache_invalidate = char_list_cache_invalidate;
+	chr->char_list_cache_invalidate_char_sub = char_list_cache_invalidate_char_sub;
+	chr->char_list_cache_invalidate_char = char_list_cache_invalidate_char;
+	chr->char_list_cache_cleanup = char_list_cache_cleanup;
+	chr->char_list_cache_final_sub = char_list_cache_final_sub;
+	chr->load_stats_add_login = char_load_stats_add_login;
+	chr->load_stats_report = char_load_stats_report;
 	chr->char_slotchange = char_char_slotchange;
 	chr->rename_char_sql = char_rename_char_sql;
 	chr->name_exists = char_name_exists;
@@ -6541,6 +7352,11 @@ void char_defaults(void)
 	chr->parse_frommap_set_users = char_parse_frommap_set_users;
 	chr->save_character_ack = char_save_character_ack;
 	chr->parse_frommap_save_character = char_parse_frommap_save_character;
+	chr->parse_frommap_save_character_delta = char_parse_frommap_save_character_delta;
+	chr->parse_frommap_save_mode = char_parse_frommap_save_mode;
+	chr->save_character = char_save_character;
+	chr->save_delta_apply = char_save_delta_apply;
+	chr->save_resync = char_save_resync;
 	chr->select_ack = char_select_ack;
 	chr->parse_frommap_char_select_req = char_parse_frommap_char_select_req;
 	chr->parse_frommap_remove_friend = char_parse_frommap_remove_friend;
@@ -6570,6 +7386,17 @@ void char_defaults(void)
 	chr->parse_frommap_scdata_delete = char_parse_frommap_scdata_delete;
 	chr->parse_frommap = char_parse_frommap;
 	chr->mapserver_has_map = char_mapserver_has_map;
+	chr->mapserver_id = char_mapserver_id;
+	chr->search_mapserver = char_search_mapserver;
+	chr->search_mapserver_addr = char_search_mapserver_addr;
+	chr->send_map_owner = char_send_map_owner;
+	chr->send_maps_owned = char_send_maps_owned;
+	chr->map_owner_release = char_map_owner_release;
+	chr->change_map_server_ack = char_change_map_server_ack;
+	chr->parse_frommap_change_map_server = char_parse_frommap_change_map_server;
+	chr->map_move_ack = char_map_move_ack;
+	chr->parse_frommap_map_move = char_parse_frommap_map_move;
+	chr->parse_frommap_map_state = char_parse_frommap_map_state;
 	chr->mapif_init = char_mapif_init;
 	chr->lan_subnet_check = char_lan_subnet_check;
 	chr->delete2_ack = char_delete2_ack;
@@ -24,12 +24,14 @@
 #include "common/hercules.h"
 #include "common/core.h" // CORE_ST_LAST
 #include "common/db.h"
+#include "common/mapindex.h" // MAX_MAPINDEX
 #include "common/mmo.h"
 #include "common/chunked/rfifo.h"
 
 /* Forward Declarations */
 struct config_setting_t; // common/conf.h
 struct config_t; // common/conf.h
+struct PACKET_MAPCHAR_CHANGE_MAPSERVER_REQ; // common/mapcharpackets.h
 
 enum E_CHARSERVER_ST {
 	CHARSERVER_ST_RUNNING = CORE_ST_LAST,
@@ -63,6 +65,7 @@ struct char_session_data {
 	uint32 pincode_change;
 	char new_name[NAME_LENGTH];
 	char birthdate[10+1];  // YYYY-MM-DD
+	int64 connect_tick; // tick of the char-server connect request (login-to-ingame metrics)
 };
 
 struct online_char_data {
@@ -71,6 +74,7 @@ struct online_char_data {
 	int fd;
 	int waiting_disconnect;
 	enum online_char_state mapserver_connection;
+	int server; ///< Map-server the character is on (index of chr->map_server, -1: none)
 	int pincode_enable;
 	struct online_char_data2 *data;
 };
@@ -86,9 +90,11 @@ struct mmo_map_server {
 	uint32 ip;
 	uint16 port;
 	int users;
-	VECTOR_DECL(uint16) maps;
+	VECTOR_DECL(uint16) maps; ///< Maps loaded by the map-server
 };
 
+#define MAX_MAP_SERVERS 8 ///< Map-servers that can be connected at the same time
+
 #define DEFAULT_CHAR_AUTOSAVE_INTERVAL (300*1000)
 
 enum inventory_table_type {
@@ -108,17 +114,68 @@ struct char_auth_node {
 	time_t expiration_time; // # of seconds 1/1/1970 (timestamp): Validity limit of the account (0 = unlimited)
 	int group_id;
 	unsigned changing_mapservers : 1;
+	unsigned full_load : 1;   ///< Coming from char select, the full data is loaded from SQL on map-server authentication
+	struct point spawn_point; ///< Spawn point chosen on char select, applied when the full data is loaded (map == 0: none)
+	int64 connect_tick;       ///< Tick of the char-server connect request (0: not coming from char select)
+	int64 select_tick;        ///< Tick of the char select request
+};
+
+#define DEFAULT_CHAR_LIST_CACHE_TIMEOUT (600*1000)
+
+/**
+ * Character-select summary of one account, as sent by chr->mmo_chars_fromsql.
+ * Kept between char-select requests so that a client coming back to (or
+ * re-requesting) its character list doesn't hit the database again.
+ */
+struct char_list_cache_entry {
+	int count;                    ///< Number of characters in buf
+	int len;                      ///< Length of buf
+	uint8 *buf;                   ///< Serialized characters (chr->mmo_char_tobuf output)
+	int found_char[MAX_CHARS];    ///< char_session_data::found_char
+	time_t unban_time[MAX_CHARS]; ///< char_session_data::unban_time
+	int64 expire_tick;
+};
+
+/**
+ * Character load and login-to-ingame latency counters (milliseconds).
+ * Reset every time they are reported.
+ */
+struct char_load_stats {
+	unsigned int list_requests; ///< Character lists sent
+	unsigned int list_hits;     ///< Character lists sent from cache
+	unsigned int logins;        ///< Characters authenticated by the map-server after char select
+	unsigned int full_loads;    ///< Full character loads
+	int64 load_total, load_max;     ///< Full character load time
+	int64 select_total, select_max; ///< Char select -> map-server authentication
+	int64 ingame_total, ingame_max; ///< Char-server connect -> map-server authentication
+};
+
+/// Last snapshot of a character received from the map-server, base of its delta saves.
+struct char_save_base {
+	int map_id; ///< Map-server that sent the snapshot
+	uint32 seq;
+	struct mmo_charstatus status;
 };
 
 /**
  * char interface
  **/
 struct char_interface {
-	struct mmo_map_server map_server;
+	struct mmo_map_server map_server[MAX_MAP_SERVERS];
+	/**
+	 * Map-server owning each map (index of map_server, -1: none).
+	 * A map can be loaded by several map-servers, only its owner hosts
+	 * players, the others keep it on standby.
+	 */
+	int map_owner[MAX_MAPINDEX];
 	int login_fd;
 	int char_fd;
 	struct DBMap *online_char_db; // int account_id -> struct online_char_data*
 	struct DBMap *char_db_;
+	struct DBMap *char_list_cache; // int account_id -> struct char_list_cache_entry*
+	int char_list_cache_timeout; ///< Lifetime of char_list_cache entries, in milliseconds (0: disabled)
+	struct char_load_stats load_stats;
+	struct DBMap *save_bases; // int char_id -> struct char_save_base*
 	char userid[NAME_LENGTH];
 	char passwd[NAME_LENGTH];
 	char server_name[20];
@@ -143,7 +200,7 @@ struct char_interface {
 	void (*set_account_online) (int account_id, bool standalone);
 	void (*set_account_offline) (int account_id);
 	void (*set_char_charselect) (int account_id);
-	void (*set_char_online) (bool is_initializing, int char_id, int account_id, bool standalone);
+	void (*set_char_online) (int map_id, bool is_initializing, int char_id, int account_id, bool standalone);
 	void (*set_char_offline) (int char_id, int account_id);
 	int (*db_setoffline) (union DBKey key, struct DBData *data, va_list ap);
 	int (*db_kickoffline) (union DBKey key, struct DBData *data, va_list ap);
@@ -158,6 +215,15 @@ struct char_interface {
 	int (*mmo_chars_fromsql) (struct char_session_data* sd, uint8* buf, int *count);
 	int (*mmo_char_fromsql) (int char_id, struct mmo_charstatus* p, bool load_everything);
 	int (*mmo_char_sql_init) (void);
+	int (*char_list_cache_load) (struct char_session_data *sd, uint8 *buf, int *count);
+	void (*char_list_cache_store) (const struct char_session_data *sd, const uint8 *buf, int len, int count);
+	void (*char_list_cache_invalidate) (int account_id);
+	int (*char_list_cache_invalidate_char_sub) (union DBKey key, struct DBData *data, va_list ap);
+	void (*char_list_cache_invalidate_char) (int char_id);
+	int (*char_list_cache_cleanup) (int tid, int64 tick, int id, intptr_t data);
+	int (*char_list_cache_final_sub) (union DBKey key, struct DBData *data, va_list ap);
+	void (*load_stats_add_login) (const struct char_auth_node *node, int64 load_time);
+	void (*load_stats_report) (void);
 	bool (*char_slotchange) (struct char_session_data *sd, int fd, unsigned short from, unsigned short to);
 	int (*rename_char_sql) (struct char_session_data *sd, int char_id);
 	bool (*name_exists) (const char *name, const char *esc_name);
@@ -212,6 +278,11 @@ struct char_interface {
 	void (*parse_frommap_set_users) (int fd);
 	void (*save_character_ack) (int fd, int aid, int cid);
 	void (*parse_frommap_save_character) (int fd);
+	void (*parse_frommap_save_character_delta) (int fd);
+	void (*parse_frommap_save_mode) (int fd);
+	void (*save_character) (int fd, int aid, int cid, bool quitting, struct mmo_charstatus *cs);
+	bool (*save_delta_apply) (struct mmo_charstatus *cs, const uint8 *data, int len);
+	void (*save_resync) (int fd, int aid, int cid);
 	void (*select_ack) (int fd, int account_id, uint8 flag);
 	void (*parse_frommap_char_select_req) (int fd);
 	void (*parse_frommap_remove_friend) (int fd);
@@ -241,6 +312,17 @@ struct char_interface {
 	void (*parse_frommap_scdata_delete) (int fd);
 	int (*parse_frommap) (int fd);
 	bool (*mapserver_has_map) (unsigned short map);
+	int (*mapserver_id) (int fd);
+	int (*search_mapserver) (unsigned short map);
+	int (*search_mapserver_addr) (uint32 ip, uint16 port);
+	void (*send_map_owner) (int fd, int id, const uint16 *maps, int count);
+	void (*send_maps_owned) (int fd, int id);
+	void (*map_owner_release) (int id);
+	void (*change_map_server_ack) (int fd, const struct PACKET_MAPCHAR_CHANGE_MAPSERVER_REQ *p, bool ok);
+	void (*parse_frommap_change_map_server) (int fd);
+	void (*map_move_ack) (int fd, int account_id, uint16 map_index, uint8 result);
+	void (*parse_frommap_map_move) (int fd);
+	void (*parse_frommap_map_state) (int fd);
 	int (*mapif_init) (int fd);
 	uint32 (*lan_subnet_check) (uint32 ip);
 	void (*delete2_ack) (int fd, int char_id, uint32 result, time_t delete_date);
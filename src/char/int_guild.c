@@ -23,6 +23,7 @@
 #include "config/core.h" // DBPATH
 #include "int_guild.h"
 
+#include "char/capiif.h"
 #include "char/char.h"
 #include "char/inter.h"
 #include "char/mapif.h"
@@ -1559,6 +1560,7 @@ static bool inter_guild_update_emblem(int len, int guild_id, const char *data)
 	g->emblem_id++;
 	g->save_flag |= GS_EMBLEM; //Change guild
 	mapif->guild_emblem(g);
+	capiif->send_emblem_changed(guild_id, g->emblem_id);
 	return true;
 }
 
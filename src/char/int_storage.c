@@ -518,6 +518,7 @@ static bool inter_storage_retrieve_bound_items(int char_id, int account_id, int
 			StrBuf->Destroy(&buf);
 			return false;
 		}
+		chr->char_list_cache_invalidate_char(char_id); // view ids shown on char select
 #undef CHECK_REMOVE
 	}
 
@@ -43,7 +43,8 @@ static void loginif_reset(void) __attribute__ ((noreturn));
 static void loginif_reset(void)
 {
 	// TODO kick everyone out and reset everything or wait for connect and try to reacquire locks [FlavioJS]
-	mapif->server_reset();
+	for (int i = 0; i < MAX_MAP_SERVERS; i++)
+		mapif->server_reset(i);
 	sockt->flush_fifos();
 	exit(EXIT_FAILURE);
 }
@@ -76,7 +77,9 @@ static void loginif_on_ready(void)
 	chr->send_accounts_tologin(INVALID_TIMER, timer->gettick(), 0, 0);
 
 	// if no map-server already connected, display a message...
-	if (chr->map_server.fd <= 0 || VECTOR_LENGTH(chr->map_server.maps) == 0)
+	int i;
+	ARR_FIND(0, MAX_MAP_SERVERS, i, chr->map_server[i].fd > 0 && VECTOR_LENGTH(chr->map_server[i].maps) > 0);
+	if (i == MAX_MAP_SERVERS)
 		ShowStatus("Awaiting maps from map-server.\n");
 }
 
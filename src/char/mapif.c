@@ -69,36 +69,63 @@ static void mapif_ban(int id, unsigned int flag, int status)
 }
 
 /// Initializes a server structure.
-static void mapif_server_init(void)
+static void mapif_server_init(int id)
 {
-	//memset(&chr->map_server, 0, sizeof(chr->map_server));
-	chr->map_server.fd = -1;
+	Assert_retv(id >= 0 && id < MAX_MAP_SERVERS);
+	chr->map_server[id].fd = -1;
+	chr->map_server[id].ip = 0;
+	chr->map_server[id].port = 0;
+	chr->map_server[id].users = 0;
 }
 
 /// Destroys a server structure.
-static void mapif_server_destroy(void)
+static void mapif_server_destroy(int id)
 {
-	if (chr->map_server.fd == -1) {
-		sockt->close(chr->map_server.fd);
-		chr->map_server.fd = -1;
+	Assert_retv(id >= 0 && id < MAX_MAP_SERVERS);
+	if (chr->map_server[id].fd > 0) {
+		sockt->close(chr->map_server[id].fd);
+		chr->map_server[id].fd = -1;
 	}
 }
 
+/**
+ * Removes the delta save bases received from a map-server.
+ *
+ * Arguments: int map_id
+ * @see DBApply
+ */
+static int mapif_save_base_reset_sub(union DBKey key, struct DBData *data, va_list ap)
+{
+	const struct char_save_base *base = DB->data2ptr(data);
+	int id = va_arg(ap, int);
+
+	nullpo_ret(base);
+	if (base->map_id == id)
+		idb_remove(chr->save_bases, key.i);
+	return 0;
+}
+
 /// Resets all the data related to a server.
-static void mapif_server_reset(void)
+static void mapif_server_reset(int id)
 {
-	if (SQL_ERROR == SQL->Query(inter->sql_handle, "DELETE FROM `%s` WHERE `index`='%d'", ragsrvinfo_db, chr->map_server.fd))
+	Assert_retv(id >= 0 && id < MAX_MAP_SERVERS);
+	if (SQL_ERROR == SQL->Query(inter->sql_handle, "DELETE FROM `%s` WHERE `index`='%d'", ragsrvinfo_db, chr->map_server[id].fd))
 		Sql_ShowDebug(inter->sql_handle);
-	chr->online_char_db->foreach(chr->online_char_db, chr->db_setoffline); //Tag relevant chars as 'in disconnected' server.
-	mapif->server_destroy();
-	mapif->server_init();
+	chr->online_char_db->foreach(chr->online_char_db, chr->db_setoffline, id); //Tag relevant chars as 'in disconnected' server.
+	if (chr->save_bases != NULL)
+		chr->save_bases->foreach(chr->save_bases, mapif->save_base_reset_sub, id);
+	chr->map_owner_release(id);
+	VECTOR_CLEAR(chr->map_server[id].maps);
+	mapif->server_destroy(id);
+	mapif->server_init(id);
 }
 
 /// Called when the connection to a Map Server is disconnected.
-static void mapif_on_disconnect(void)
+static void mapif_on_disconnect(int id)
 {
-	ShowStatus("Map-server has disconnected.\n");
-	mapif->server_reset();
+	Assert_retv(id >= 0 && id < MAX_MAP_SERVERS);
+	ShowStatus("Map-server #%d has disconnected.\n", id);
+	mapif->server_reset(id);
 }
 
 static void mapif_on_parse_accinfo(int account_id, int u_fd, int u_aid, int u_group, int map_fd)
@@ -125,24 +152,29 @@ static void mapif_char_ban(int char_id, time_t timestamp)
 }
 
 /**
- * Sends a packet to the map server
+ * Sends a packet to all the connected map servers
  *
  * @param buf The data to send
  * @param len The data length
  *
  * @return 0 on success, or error code on error
- * @retval -1 if the map server is not connected
+ * @retval -1 if no map server is connected
  */
 static int mapif_send(const unsigned char *buf, unsigned int len)
 {
+	int sent = 0;
+
 	nullpo_ret(buf);
-	int fd = chr->map_server.fd;
-	if (fd < 0)
-		return -1;
-	WFIFOHEAD(fd, len);
-	memcpy(WFIFOP(fd, 0), buf, len);
-	WFIFOSET(fd, len);
-	return 0;
+	for (int i = 0; i < MAX_MAP_SERVERS; i++) {
+		int fd = chr->map_server[i].fd;
+		if (fd <= 0 || sockt->session[fd] == NULL)
+			continue;
+		WFIFOHEAD(fd, len);
+		memcpy(WFIFOP(fd, 0), buf, len);
+		WFIFOSET(fd, len);
+		sent++;
+	}
+	return sent > 0 ? 0 : -1;
 }
 
 static void mapif_send_users_count(int users)
@@ -475,26 +507,42 @@ static int mapif_guild_info(const struct guild *g)
 	return 0;
 }
 
-// Send emblem before guild info
-static int mapif_guild_info_emblem(const struct guild *g)
+/**
+ * Sends a guild's emblem to all the map-servers, in chunks.
+ *
+ * @param header HEADER_CHARMAP_GUILD_EMBLEM or HEADER_CHARMAP_GUILD_INFO_EMBLEM (same layout).
+ * @return 0 if sent to a map-server, -1 if none is connected.
+ */
+static int mapif_guild_emblem_send(int header, const struct guild *g)
 {
 	nullpo_ret(g);
 
-	int fd = chr->map_server.fd;
-	if (fd < 0)
-		return -1;
+	int sent = 0;
+	for (int i = 0; i < MAX_MAP_SERVERS; i++) {
+		int fd = chr->map_server[i].fd;
+		if (fd <= 0 || sockt->session[fd] == NULL)
+			continue;
 
-	WFIFO_CHUNKED_INIT(p, fd, HEADER_CHARMAP_GUILD_INFO_EMBLEM, PACKET_CHARMAP_GUILD_INFO_EMBLEM, g->emblem_data, g->emblem_len) {
-		WFIFO_CHUNKED_BLOCK_START(p);
+		WFIFO_CHUNKED_INIT(p, fd, header, PACKET_CHARMAP_GUILD_EMBLEM, g->emblem_data, g->emblem_len) {
+			WFIFO_CHUNKED_BLOCK_START(p);
+			p->guild_id = g->guild_id;
+			p->emblem_id = g->emblem_id;
+			WFIFO_CHUNKED_BLOCK_END();
+		}
+		WFIFO_CHUNKED_FINAL_START(p);
 		p->guild_id = g->guild_id;
 		p->emblem_id = g->emblem_id;
-		WFIFO_CHUNKED_BLOCK_END();
+		WFIFO_CHUNKED_FINAL_END();
+		sent++;
 	}
-	WFIFO_CHUNKED_FINAL_START(p);
-	p->guild_id = g->guild_id;
-	p->emblem_id = g->emblem_id;
-	WFIFO_CHUNKED_FINAL_END();
-	return 0;
+	return sent > 0 ? 0 : -1;
+}
+
+// Send emblem before guild info
+static int mapif_guild_info_emblem(const struct guild *g)
+{
+	STATIC_ASSERT(sizeof(struct PACKET_CHARMAP_GUILD_INFO_EMBLEM) == sizeof(struct PACKET_CHARMAP_GUILD_EMBLEM), "Guild emblem packets must have the same layout");
+	return mapif->guild_emblem_send(HEADER_CHARMAP_GUILD_INFO_EMBLEM, g);
 }
 
 // Send guild info
@@ -668,23 +716,7 @@ static int mapif_guild_notice(struct guild *g)
 // Send emblem data
 static int mapif_guild_emblem(struct guild *g)
 {
-	nullpo_ret(g);
-
-	int fd = chr->map_server.fd;
-	if (fd < 0)
-		return -1;
-
-	WFIFO_CHUNKED_INIT(p, fd, HEADER_CHARMAP_GUILD_EMBLEM, PACKET_CHARMAP_GUILD_EMBLEM, g->emblem_data, g->emblem_len) {
-		WFIFO_CHUNKED_BLOCK_START(p);
-		p->guild_id = g->guild_id;
-		p->emblem_id = g->emblem_id;
-		WFIFO_CHUNKED_BLOCK_END();
-	}
-	WFIFO_CHUNKED_FINAL_START(p);
-	p->guild_id = g->guild_id;
-	p->emblem_id = g->emblem_id;
-	WFIFO_CHUNKED_FINAL_END();
-	return 0;
+	return mapif->guild_emblem_send(HEADER_CHARMAP_GUILD_EMBLEM, g);
 }
 
 static int mapif_guild_master_changed(struct guild *g, int aid, int cid)
@@ -2390,6 +2422,7 @@ void mapif_defaults(void)
 	mapif->ban = mapif_ban;
 	mapif->server_init = mapif_server_init;
 	mapif->server_destroy = mapif_server_destroy;
+	mapif->save_base_reset_sub = mapif_save_base_reset_sub;
 	mapif->server_reset = mapif_server_reset;
 	mapif->on_disconnect = mapif_on_disconnect;
 	mapif->on_parse_accinfo = mapif_on_parse_accinfo;
@@ -2435,6 +2468,7 @@ void mapif_defaults(void)
 	mapif->guild_position = mapif_guild_position;
 	mapif->guild_notice = mapif_guild_notice;
 	mapif->guild_emblem = mapif_guild_emblem;
+	mapif->guild_emblem_send = mapif_guild_emblem_send;
 	mapif->guild_master_changed = mapif_guild_master_changed;
 	mapif->guild_castle_dataload = mapif_guild_castle_dataload;
 	mapif->parse_CreateGuild = mapif_parse_CreateGuild;
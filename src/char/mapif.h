@@ -21,6 +21,7 @@
 #define CHAR_MAPIF_H
 
 #include "common/hercules.h"
+#include "common/db.h"
 #include "common/mmo.h"
 #include "common/chunked/rfifo.h"
 
@@ -36,10 +37,11 @@ struct mapif_interface {
 	struct fifo_chunk_buf emblem_tmp;
 	void (*final) (void);
 	void (*ban) (int id, unsigned int flag, int status);
-	void (*server_init) (void);
-	void (*server_destroy) (void);
-	void (*server_reset) (void);
-	void (*on_disconnect) (void);
+	void (*server_init) (int id);
+	void (*server_destroy) (int id);
+	int (*save_base_reset_sub) (union DBKey key, struct DBData *data, va_list ap);
+	void (*server_reset) (int id);
+	void (*on_disconnect) (int id);
 	void (*on_parse_accinfo) (int account_id, int u_fd, int u_aid, int u_group, int map_fd);
 	void (*char_ban) (int char_id, time_t timestamp);
 	int (*send) (const unsigned char *buf, unsigned int len);
@@ -83,6 +85,7 @@ struct mapif_interface {
 	int (*guild_position) (struct guild *g, int idx);
 	int (*guild_notice) (struct guild *g);
 	int (*guild_emblem) (struct guild *g);
+	int (*guild_emblem_send) (int header, const struct guild *g);
 	int (*guild_master_changed) (struct guild *g, int aid, int cid);
 	int (*guild_castle_dataload) (int fd, int sz, const int *castle_ids);
 	int (*parse_CreateGuild) (int fd, int account_id, const char *name, const struct guild_member *master);
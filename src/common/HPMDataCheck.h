@@ -102,6 +102,7 @@ HPExport const struct s_HPMDataCheck HPMDataCheck[] = {
 	#ifdef CHAR_CHAR_H
 		{ "char_auth_node", sizeof(struct char_auth_node), SERVER_TYPE_CHAR },
 		{ "char_interface", sizeof(struct char_interface), SERVER_TYPE_CHAR },
+		{ "char_save_base", sizeof(struct char_save_base), SERVER_TYPE_CHAR },
 		{ "char_session_data", sizeof(struct char_session_data), SERVER_TYPE_CHAR },
 		{ "mmo_map_server", sizeof(struct mmo_map_server), SERVER_TYPE_CHAR },
 		{ "online_char_data", sizeof(struct online_char_data), SERVER_TYPE_CHAR },
@@ -262,10 +263,16 @@ HPExport const struct s_HPMDataCheck HPMDataCheck[] = {
 	#endif // COMMON_CHARLOGINPACKETS_H
 	#ifdef COMMON_CHARMAPPACKETS_H
 		{ "PACKET_CHARMAP_AGENCY_JOIN_PARTY", sizeof(struct PACKET_CHARMAP_AGENCY_JOIN_PARTY), SERVER_TYPE_ALL },
+		{ "PACKET_CHARMAP_CHANGE_MAPSERVER_ACK", sizeof(struct PACKET_CHARMAP_CHANGE_MAPSERVER_ACK), SERVER_TYPE_ALL },
 		{ "PACKET_CHARMAP_GUILD_EMBLEM", sizeof(struct PACKET_CHARMAP_GUILD_EMBLEM), SERVER_TYPE_ALL },
 		{ "PACKET_CHARMAP_GUILD_INFO", sizeof(struct PACKET_CHARMAP_GUILD_INFO), SERVER_TYPE_ALL },
 		{ "PACKET_CHARMAP_GUILD_INFO_EMBLEM", sizeof(struct PACKET_CHARMAP_GUILD_INFO_EMBLEM), SERVER_TYPE_ALL },
 		{ "PACKET_CHARMAP_GUILD_INFO_EMPTY", sizeof(struct PACKET_CHARMAP_GUILD_INFO_EMPTY), SERVER_TYPE_ALL },
+		{ "PACKET_CHARMAP_MAP_MOVE_ACK", sizeof(struct PACKET_CHARMAP_MAP_MOVE_ACK), SERVER_TYPE_ALL },
+		{ "PACKET_CHARMAP_MAP_OWNERS", sizeof(struct PACKET_CHARMAP_MAP_OWNERS), SERVER_TYPE_ALL },
+		{ "PACKET_CHARMAP_MAP_STATE", sizeof(struct PACKET_CHARMAP_MAP_STATE), SERVER_TYPE_ALL },
+		{ "PACKET_CHARMAP_SAVE_MODE_ACK", sizeof(struct PACKET_CHARMAP_SAVE_MODE_ACK), SERVER_TYPE_ALL },
+		{ "PACKET_CHARMAP_SAVE_RESYNC", sizeof(struct PACKET_CHARMAP_SAVE_RESYNC), SERVER_TYPE_ALL },
 	#else
 		#define COMMON_CHARMAPPACKETS_H
 	#endif // COMMON_CHARMAPPACKETS_H
@@ -305,6 +312,7 @@ HPExport const struct s_HPMDataCheck HPMDataCheck[] = {
 	#endif // COMMON_DES_H
 	#ifdef COMMON_ERS_H
 		{ "eri", sizeof(struct eri), SERVER_TYPE_ALL },
+		{ "ers_cache_stats", sizeof(struct ers_cache_stats), SERVER_TYPE_ALL },
 	#else
 		#define COMMON_ERS_H
 	#endif // COMMON_ERS_H
@@ -331,7 +339,17 @@ HPExport const struct s_HPMDataCheck HPMDataCheck[] = {
 	#ifdef COMMON_MAPCHARPACKETS_H
 		{ "PACKET_MAPCHAR_AGENCY_JOIN_PARTY_REQ", sizeof(struct PACKET_MAPCHAR_AGENCY_JOIN_PARTY_REQ), SERVER_TYPE_ALL },
 		{ "PACKET_MAPCHAR_AUTH_REQ", sizeof(struct PACKET_MAPCHAR_AUTH_REQ), SERVER_TYPE_ALL },
+		{ "PACKET_MAPCHAR_CHANGE_MAPSERVER_REQ", sizeof(struct PACKET_MAPCHAR_CHANGE_MAPSERVER_REQ), SERVER_TYPE_ALL },
 		{ "PACKET_MAPCHAR_GUILD_EMBLEM", sizeof(struct PACKET_MAPCHAR_GUILD_EMBLEM), SERVER_TYPE_ALL },
+		{ "PACKET_MAPCHAR_MAP_MOVE_REQ", sizeof(struct PACKET_MAPCHAR_MAP_MOVE_REQ), SERVER_TYPE_ALL },
+		{ "PACKET_MAPCHAR_MAP_STATE", sizeof(struct PACKET_MAPCHAR_MAP_STATE), SERVER_TYPE_ALL },
+		{ "PACKET_MAPCHAR_SAVE_DELTA", sizeof(struct PACKET_MAPCHAR_SAVE_DELTA), SERVER_TYPE_ALL },
+		{ "PACKET_MAPCHAR_SAVE_MODE_REQ", sizeof(struct PACKET_MAPCHAR_SAVE_MODE_REQ), SERVER_TYPE_ALL },
+		{ "chrif_map_state_item", sizeof(struct chrif_map_state_item), SERVER_TYPE_ALL },
+		{ "chrif_map_state_mob", sizeof(struct chrif_map_state_mob), SERVER_TYPE_ALL },
+		{ "chrif_map_state_npc", sizeof(struct chrif_map_state_npc), SERVER_TYPE_ALL },
+		{ "chrif_map_state_npc_var", sizeof(struct chrif_map_state_npc_var), SERVER_TYPE_ALL },
+		{ "chrif_map_state_unit", sizeof(struct chrif_map_state_unit), SERVER_TYPE_ALL },
 	#else
 		#define COMMON_MAPCHARPACKETS_H
 	#endif // COMMON_MAPCHARPACKETS_H
@@ -347,6 +365,7 @@ HPExport const struct s_HPMDataCheck HPMDataCheck[] = {
 	#endif // COMMON_MD5CALC_H
 	#ifdef COMMON_MEMMGR_H
 		{ "malloc_interface", sizeof(struct malloc_interface), SERVER_TYPE_ALL },
+		{ "memmgr_site_stats", sizeof(struct memmgr_site_stats), SERVER_TYPE_ALL },
 	#else
 		#define COMMON_MEMMGR_H
 	#endif // COMMON_MEMMGR_H
@@ -419,12 +438,24 @@ HPExport const struct s_HPMDataCheck HPMDataCheck[] = {
 	#else
 		#define COMMON_RANDOM_H
 	#endif // COMMON_RANDOM_H
+	#ifdef COMMON_REPLAY_H
+		{ "replay_header", sizeof(struct replay_header), SERVER_TYPE_ALL },
+		{ "replay_interface", sizeof(struct replay_interface), SERVER_TYPE_ALL },
+		{ "replay_record", sizeof(struct replay_record), SERVER_TYPE_ALL },
+		{ "replay_stats", sizeof(struct replay_stats), SERVER_TYPE_ALL },
+	#else
+		#define COMMON_REPLAY_H
+	#endif // COMMON_REPLAY_H
 	#ifdef COMMON_SHOWMSG_H
 		{ "showmsg_interface", sizeof(struct showmsg_interface), SERVER_TYPE_ALL },
 	#else
 		#define COMMON_SHOWMSG_H
 	#endif // COMMON_SHOWMSG_H
 	#ifdef COMMON_SOCKET_H
+		{ "access_list", sizeof(struct access_list), SERVER_TYPE_ALL },
+		{ "access_trie_node", sizeof(struct access_trie_node), SERVER_TYPE_ALL },
+		{ "connect_history", sizeof(struct connect_history), SERVER_TYPE_ALL },
+		{ "connect_history_table", sizeof(struct connect_history_table), SERVER_TYPE_ALL },
 		{ "hSockOpt", sizeof(struct hSockOpt), SERVER_TYPE_ALL },
 		{ "s_subnet", sizeof(struct s_subnet), SERVER_TYPE_ALL },
 		{ "s_subnet_vector", sizeof(struct s_subnet_vector), SERVER_TYPE_ALL },
@@ -464,6 +495,7 @@ HPExport const struct s_HPMDataCheck HPMDataCheck[] = {
 	#endif // COMMON_THREAD_H
 	#ifdef COMMON_TIMER_H
 		{ "TimerData", sizeof(struct TimerData), SERVER_TYPE_ALL },
+		{ "timer_batch_stats", sizeof(struct timer_batch_stats), SERVER_TYPE_ALL },
 		{ "timer_interface", sizeof(struct timer_interface), SERVER_TYPE_ALL },
 	#else
 		#define COMMON_TIMER_H
@@ -479,11 +511,22 @@ HPExport const struct s_HPMDataCheck HPMDataCheck[] = {
 		{ "AccountDB_SQL", sizeof(struct AccountDB_SQL), SERVER_TYPE_LOGIN },
 		{ "AccountDBIterator", sizeof(struct AccountDBIterator), SERVER_TYPE_LOGIN },
 		{ "AccountDBIterator_SQL", sizeof(struct AccountDBIterator_SQL), SERVER_TYPE_LOGIN },
+		{ "account_cache_entry", sizeof(struct account_cache_entry), SERVER_TYPE_LOGIN },
+		{ "account_flush_stats", sizeof(struct account_flush_stats), SERVER_TYPE_LOGIN },
 		{ "account_interface", sizeof(struct account_interface), SERVER_TYPE_LOGIN },
 		{ "mmo_account", sizeof(struct mmo_account), SERVER_TYPE_LOGIN },
 	#else
 		#define LOGIN_ACCOUNT_H
 	#endif // LOGIN_ACCOUNT_H
+	#ifdef LOGIN_DNSBL_H
+		{ "dnsbl_cache_entry", sizeof(struct dnsbl_cache_entry), SERVER_TYPE_LOGIN },
+		{ "dnsbl_interface", sizeof(struct dnsbl_interface), SERVER_TYPE_LOGIN },
+		{ "dnsbl_query", sizeof(struct dnsbl_query), SERVER_TYPE_LOGIN },
+		{ "dnsbl_request", sizeof(struct dnsbl_request), SERVER_TYPE_LOGIN },
+		{ "dnsbl_stats", sizeof(struct dnsbl_stats), SERVER_TYPE_LOGIN },
+	#else
+		#define LOGIN_DNSBL_H
+	#endif // LOGIN_DNSBL_H
 	#ifdef LOGIN_IPBAN_H
 		{ "ipban_interface", sizeof(struct ipban_interface), SERVER_TYPE_LOGIN },
 		{ "s_ipban_dbs", sizeof(struct s_ipban_dbs), SERVER_TYPE_LOGIN },
@@ -508,7 +551,9 @@ HPExport const struct s_HPMDataCheck HPMDataCheck[] = {
 		#define LOGIN_LCLIF_P_H
 	#endif // LOGIN_LCLIF_P_H
 	#ifdef LOGIN_LOGINLOG_H
+		{ "loginlog_entry", sizeof(struct loginlog_entry), SERVER_TYPE_LOGIN },
 		{ "loginlog_interface", sizeof(struct loginlog_interface), SERVER_TYPE_LOGIN },
+		{ "loginlog_stats", sizeof(struct loginlog_stats), SERVER_TYPE_LOGIN },
 		{ "s_loginlog_dbs", sizeof(struct s_loginlog_dbs), SERVER_TYPE_LOGIN },
 	#else
 		#define LOGIN_LOGINLOG_H
@@ -552,6 +597,9 @@ HPExport const struct s_HPMDataCheck HPMDataCheck[] = {
 		#define LOGIN_PACKETS_CA_STRUCT_H
 	#endif // LOGIN_PACKETS_CA_STRUCT_H
 	#ifdef MAP_ACHIEVEMENT_H
+		{ "achievement_criteria_entry", sizeof(struct achievement_criteria_entry), SERVER_TYPE_MAP },
+		{ "achievement_criteria_index", sizeof(struct achievement_criteria_index), SERVER_TYPE_MAP },
+		{ "achievement_criteria_list", sizeof(struct achievement_criteria_list), SERVER_TYPE_MAP },
 		{ "achievement_data", sizeof(struct achievement_data), SERVER_TYPE_MAP },
 		{ "achievement_interface", sizeof(struct achievement_interface), SERVER_TYPE_MAP },
 		{ "achievement_objective", sizeof(struct achievement_objective), SERVER_TYPE_MAP },
@@ -579,6 +627,8 @@ HPExport const struct s_HPMDataCheck HPMDataCheck[] = {
 	#ifdef MAP_BATTLE_H
 		{ "Battle_Config", sizeof(struct Battle_Config), SERVER_TYPE_MAP },
 		{ "Damage", sizeof(struct Damage), SERVER_TYPE_MAP },
+		{ "battle_cardfix_cache", sizeof(struct battle_cardfix_cache), SERVER_TYPE_MAP },
+		{ "battle_cardfix_entry", sizeof(struct battle_cardfix_entry), SERVER_TYPE_MAP },
 		{ "battle_interface", sizeof(struct battle_interface), SERVER_TYPE_MAP },
 		{ "delay_damage", sizeof(struct delay_damage), SERVER_TYPE_MAP },
 	#else
@@ -608,6 +658,8 @@ HPExport const struct s_HPMDataCheck HPMDataCheck[] = {
 	#ifdef MAP_CHRIF_H
 		{ "auth_node", sizeof(struct auth_node), SERVER_TYPE_MAP },
 		{ "chrif_interface", sizeof(struct chrif_interface), SERVER_TYPE_MAP },
+		{ "chrif_save_base", sizeof(struct chrif_save_base), SERVER_TYPE_MAP },
+		{ "chrif_save_stats", sizeof(struct chrif_save_stats), SERVER_TYPE_MAP },
 	#else
 		#define MAP_CHRIF_H
 	#endif // MAP_CHRIF_H
@@ -768,6 +820,13 @@ HPExport const struct s_HPMDataCheck HPMDataCheck[] = {
 		{ "map_data", sizeof(struct map_data), SERVER_TYPE_MAP },
 		{ "map_drop_list", sizeof(struct map_drop_list), SERVER_TYPE_MAP },
 		{ "map_interface", sizeof(struct map_interface), SERVER_TYPE_MAP },
+		{ "map_server_addr", sizeof(struct map_server_addr), SERVER_TYPE_MAP },
+		{ "map_shared_cache", sizeof(struct map_shared_cache), SERVER_TYPE_MAP },
+		{ "map_shared_cache_entry", sizeof(struct map_shared_cache_entry), SERVER_TYPE_MAP },
+		{ "map_shared_cache_header", sizeof(struct map_shared_cache_header), SERVER_TYPE_MAP },
+		{ "map_state_buffer", sizeof(struct map_state_buffer), SERVER_TYPE_MAP },
+		{ "map_state_unit", sizeof(struct map_state_unit), SERVER_TYPE_MAP },
+		{ "map_stats", sizeof(struct map_stats), SERVER_TYPE_MAP },
 		{ "map_zone_data", sizeof(struct map_zone_data), SERVER_TYPE_MAP },
 		{ "map_zone_disabled_command_entry", sizeof(struct map_zone_disabled_command_entry), SERVER_TYPE_MAP },
 		{ "map_zone_disabled_skill_entry", sizeof(struct map_zone_disabled_skill_entry), SERVER_TYPE_MAP },
@@ -795,6 +854,7 @@ HPExport const struct s_HPMDataCheck HPMDataCheck[] = {
 		{ "mob_drop", sizeof(struct mob_drop), SERVER_TYPE_MAP },
 		{ "mob_group", sizeof(struct mob_group), SERVER_TYPE_MAP },
 		{ "mob_interface", sizeof(struct mob_interface), SERVER_TYPE_MAP },
+		{ "mob_pool", sizeof(struct mob_pool), SERVER_TYPE_MAP },
 		{ "mob_skill", sizeof(struct mob_skill), SERVER_TYPE_MAP },
 		{ "optdrop_group", sizeof(struct optdrop_group), SERVER_TYPE_MAP },
 		{ "optdrop_group_option", sizeof(struct optdrop_group_option), SERVER_TYPE_MAP },
@@ -1109,6 +1169,7 @@ HPExport const struct s_HPMDataCheck HPMDataCheck[] = {
 		{ "class_exp_tables", sizeof(struct class_exp_tables), SERVER_TYPE_MAP },
 		{ "item_cd", sizeof(struct item_cd), SERVER_TYPE_MAP },
 		{ "map_session_data", sizeof(struct map_session_data), SERVER_TYPE_MAP },
+		{ "pc_autosave_stats", sizeof(struct pc_autosave_stats), SERVER_TYPE_MAP },
 		{ "pc_combos", sizeof(struct pc_combos), SERVER_TYPE_MAP },
 		{ "pc_interface", sizeof(struct pc_interface), SERVER_TYPE_MAP },
 		{ "s_add_drop", sizeof(struct s_add_drop), SERVER_TYPE_MAP },
@@ -1139,6 +1200,7 @@ HPExport const struct s_HPMDataCheck HPMDataCheck[] = {
 	#ifdef MAP_QUEST_H
 		{ "quest_db", sizeof(struct quest_db), SERVER_TYPE_MAP },
 		{ "quest_dropitem", sizeof(struct quest_dropitem), SERVER_TYPE_MAP },
+		{ "quest_index_entry", sizeof(struct quest_index_entry), SERVER_TYPE_MAP },
 		{ "quest_interface", sizeof(struct quest_interface), SERVER_TYPE_MAP },
 		{ "quest_objective", sizeof(struct quest_objective), SERVER_TYPE_MAP },
 		{ "questinfo", sizeof(struct questinfo), SERVER_TYPE_MAP },
@@ -1178,11 +1240,13 @@ HPExport const struct s_HPMDataCheck HPMDataCheck[] = {
 		{ "script_label_entry", sizeof(struct script_label_entry), SERVER_TYPE_MAP },
 		{ "script_queue", sizeof(struct script_queue), SERVER_TYPE_MAP },
 		{ "script_queue_iterator", sizeof(struct script_queue_iterator), SERVER_TYPE_MAP },
+		{ "script_reg_slots", sizeof(struct script_reg_slots), SERVER_TYPE_MAP },
 		{ "script_retinfo", sizeof(struct script_retinfo), SERVER_TYPE_MAP },
 		{ "script_stack", sizeof(struct script_stack), SERVER_TYPE_MAP },
 		{ "script_state", sizeof(struct script_state), SERVER_TYPE_MAP },
 		{ "script_string_buf", sizeof(struct script_string_buf), SERVER_TYPE_MAP },
 		{ "script_syntax_data", sizeof(struct script_syntax_data), SERVER_TYPE_MAP },
+		{ "script_var_slots", sizeof(struct script_var_slots), SERVER_TYPE_MAP },
 		{ "str_data_struct", sizeof(struct str_data_struct), SERVER_TYPE_MAP },
 		{ "string_translation", sizeof(struct string_translation), SERVER_TYPE_MAP },
 		{ "string_translation_entry", sizeof(struct string_translation_entry), SERVER_TYPE_MAP },
@@ -1230,8 +1294,11 @@ HPExport const struct s_HPMDataCheck HPMDataCheck[] = {
 		{ "sc_display_entry", sizeof(struct sc_display_entry), SERVER_TYPE_MAP },
 		{ "status_change", sizeof(struct status_change), SERVER_TYPE_MAP },
 		{ "status_change_entry", sizeof(struct status_change_entry), SERVER_TYPE_MAP },
+		{ "status_change_slot", sizeof(struct status_change_slot), SERVER_TYPE_MAP },
+		{ "status_change_tick_stats", sizeof(struct status_change_tick_stats), SERVER_TYPE_MAP },
 		{ "status_data", sizeof(struct status_data), SERVER_TYPE_MAP },
 		{ "status_interface", sizeof(struct status_interface), SERVER_TYPE_MAP },
+		{ "status_regen_table", sizeof(struct status_regen_table), SERVER_TYPE_MAP },
 		{ "weapon_atk", sizeof(struct weapon_atk), SERVER_TYPE_MAP },
 	#else
 		#define MAP_STATUS_H
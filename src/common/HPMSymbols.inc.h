@@ -95,6 +95,9 @@ struct db_interface *DB;
 #ifdef COMMON_DES_H /* des */
 struct des_interface *des;
 #endif // COMMON_DES_H
+#ifdef LOGIN_DNSBL_H /* dnsbl */
+struct dnsbl_interface *dnsbl;
+#endif // LOGIN_DNSBL_H
 #ifdef MAP_DUEL_H /* duel */
 struct duel_interface *duel;
 #endif // MAP_DUEL_H
@@ -308,6 +311,9 @@ struct quest_interface *quest;
 #ifdef MAP_REFINE_H /* refine */
 struct refine_interface *refine;
 #endif // MAP_REFINE_H
+#ifdef COMMON_REPLAY_H /* replay */
+struct replay_interface *replay;
+#endif // COMMON_REPLAY_H
 #ifdef COMMON_RANDOM_H /* rnd */
 struct rnd_interface *rnd;
 #endif // COMMON_RANDOM_H
@@ -464,6 +470,10 @@ HPExport const char *HPM_shared_symbols(int server_type)
 	if ((server_type&(SERVER_TYPE_ALL)) != 0 && !HPM_SYMBOL("des", des))
 		return "des";
 #endif // COMMON_DES_H
+#ifdef LOGIN_DNSBL_H /* dnsbl */
+	if ((server_type&(SERVER_TYPE_LOGIN)) != 0 && !HPM_SYMBOL("dnsbl", dnsbl))
+		return "dnsbl";
+#endif // LOGIN_DNSBL_H
 #ifdef MAP_DUEL_H /* duel */
 	if ((server_type&(SERVER_TYPE_MAP)) != 0 && !HPM_SYMBOL("duel", duel))
 		return "duel";
@@ -748,6 +758,10 @@ HPExport const char *HPM_shared_symbols(int server_type)
 	if ((server_type&(SERVER_TYPE_MAP)) != 0 && !HPM_SYMBOL("refine", refine))
 		return "refine";
 #endif // MAP_REFINE_H
+#ifdef COMMON_REPLAY_H /* replay */
+	if ((server_type&(SERVER_TYPE_ALL)) != 0 && !HPM_SYMBOL("replay", replay))
+		return "replay";
+#endif // COMMON_REPLAY_H
 #ifdef COMMON_RANDOM_H /* rnd */
 	if ((server_type&(SERVER_TYPE_ALL)) != 0 && !HPM_SYMBOL("rnd", rnd))
 		return "rnd";
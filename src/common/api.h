@@ -43,6 +43,7 @@ enum API_MSG {
 	API_MSG_party_add = 17,
 	API_MSG_party_del = 18,
 	API_MSG_party_info = 19,
+	API_MSG_emblem_changed = 20,
 	API_MSG_CUSTOM,
 	API_MSG_MAX = API_MSG_CUSTOM + MAX_CUSTOM_API_MSG
 };
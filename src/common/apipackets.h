@@ -252,6 +252,12 @@ struct PACKET_API_REPLY_emblem_download {
 	char data[];
 } __attribute__((packed));
 
+// char to api notification, not bound to any client (client_fd = -1)
+struct PACKET_API_REPLY_emblem_changed {
+	int guild_id;
+	int version;
+} __attribute__((packed));
+
 struct PACKET_API_REPLY_party_add {
 	int result;
 } __attribute__((packed));
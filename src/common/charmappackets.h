@@ -68,6 +68,62 @@ struct PACKET_CHARMAP_GUILD_INFO_EMBLEM {
 } __attribute__((packed));
 DEFINE_PACKET_ID(CHARMAP_GUILD_INFO_EMBLEM, 0x389c)
 
+struct PACKET_CHARMAP_SAVE_MODE_ACK {
+	int16 packetType;
+	uint8 modes;         ///< enum chrif_save_mode accepted by the char-server
+} __attribute__((packed));
+DEFINE_PACKET_ID(CHARMAP_SAVE_MODE_ACK, 0x2b2a)
+
+struct PACKET_CHARMAP_SAVE_RESYNC {
+	int16 packetType;
+	int account_id;
+	int char_id;
+} __attribute__((packed));
+DEFINE_PACKET_ID(CHARMAP_SAVE_RESYNC, 0x2b2b)
+
+struct PACKET_CHARMAP_MAP_OWNERS {
+	int16 packetType;
+	uint16 packetLength;
+	uint32 ip;           ///< Map-server owning the maps, host byte order (0: none)
+	uint16 port;
+	uint16 maps[];
+} __attribute__((packed));
+DEFINE_PACKET_ID(CHARMAP_MAP_OWNERS, 0x2b04)
+
+struct PACKET_CHARMAP_CHANGE_MAPSERVER_ACK {
+	int16 packetType;
+	int account_id;
+	int login_id1;
+	int login_id2;
+	int char_id;
+	uint16 map_index;
+	int16 x;
+	int16 y;
+	uint32 ip;           ///< Destination map-server, host byte order
+	uint16 port;
+	uint8 result;        ///< 0: ok, 1: the destination refused the character
+} __attribute__((packed));
+DEFINE_PACKET_ID(CHARMAP_CHANGE_MAPSERVER_ACK, 0x2b06)
+
+struct PACKET_CHARMAP_MAP_MOVE_ACK {
+	int16 packetType;
+	int account_id;
+	uint16 map_index;
+	uint8 result;        ///< enum chrif_map_move_result
+} __attribute__((packed));
+DEFINE_PACKET_ID(CHARMAP_MAP_MOVE_ACK, 0x2b2d)
+
+/// Relay of PACKET_MAPCHAR_MAP_STATE to the map-server the map moved to.
+struct PACKET_CHARMAP_MAP_STATE {
+	int16 packetType;
+	uint16 packetLength;
+	uint16 map_index;
+	uint8 type;          ///< enum chrif_map_state_type
+	uint16 count;        ///< Number of records in data
+	uint8 data[];
+} __attribute__((packed));
+DEFINE_PACKET_ID(CHARMAP_MAP_STATE, 0x2b2f)
+
 #if !defined(sun) && (!defined(__NETBSD__) || __NetBSD_Version__ >= 600000000) // NetBSD 5 and Solaris don't like pragma pack but accept the packed attribute
 #pragma pack(pop)
 #endif // not NetBSD < 6 / Solaris
@@ -148,6 +148,15 @@ static CPCMD_C(ers_report, server)
 	ers_report();
 }
 
+/**
+ * Releases the unused memory of the Entry Reusage System
+ **/
+static CPCMD_C(ers_trim, server)
+{
+	size_t released = ers_trim(true);
+	ShowInfo("ers_trim: released %.2f MB\n", (double)released / 1024 / 1024);
+}
+
 /**
  * Displays memory usage
  **/
@@ -158,6 +167,38 @@ static CPCMD_C(mem_report, server)
 #endif
 }
 
+/**
+ * Displays the allocation call sites holding the most memory
+ * Usage: server mem_sites [count]
+ **/
+static CPCMD_C(mem_sites, server)
+{
+#ifdef USE_MEMMGR
+	memmgr_report_sites(line != NULL ? atoi(line) : 20, false);
+#endif
+}
+
+/**
+ * Displays the memory held by the allocation call sites of each source file
+ * Usage: server mem_subsystems [count]
+ **/
+static CPCMD_C(mem_subsystems, server)
+{
+#ifdef USE_MEMMGR
+	memmgr_report_sites(line != NULL ? atoi(line) : 20, true);
+#endif
+}
+
+/**
+ * Returns unused memory to the system
+ **/
+static CPCMD_C(mem_trim, server)
+{
+	size_t usage = iMalloc->usage();
+	size_t released = iMalloc->trim_memory();
+	ShowInfo("mem_trim: released %.2f MB (usage %.2f MB)\n", (double)released / 1024 / 1024, (double)usage / 1024);
+}
+
 /**
  * Displays command list
  **/
@@ -247,7 +288,11 @@ static void console_load_defaults(void)
 		 **/
 		CP_DEF_C(server),
 		CP_DEF_S(ers_report,server),
+		CP_DEF_S(ers_trim,server),
 		CP_DEF_S(mem_report,server),
+		CP_DEF_S(mem_sites,server),
+		CP_DEF_S(mem_subsystems,server),
+		CP_DEF_S(mem_trim,server),
 		CP_DEF_S(malloc_usage,server),
 		CP_DEF_S(exit,server),
 		/**
@@ -39,6 +39,7 @@
 #include "common/nullpo.h"
 #include "common/packets.h"
 #include "common/random.h"
+#include "common/replay.h"
 #include "common/showmsg.h"
 #include "common/socket.h"
 #include "common/sql.h"
@@ -327,6 +328,7 @@ static void core_defaults(void)
 	socket_defaults();
 	packets_defaults();
 	rnd_defaults();
+	replay_defaults();
 	md5_defaults();
 	thread_defaults();
 	base62_defaults();
@@ -408,6 +410,26 @@ static CMDLINEARG(version)
 	return false;
 }
 
+/**
+ * Records the run into a trace (see common/replay.h).
+ */
+static CMDLINEARG(tracerecord)
+{
+	if (!replay->start(REPLAY_MODE_RECORD, params))
+		exit(EXIT_FAILURE);
+	return true;
+}
+
+/**
+ * Replays a recorded trace instead of listening to the network.
+ */
+static CMDLINEARG(tracereplay)
+{
+	if (!replay->start(REPLAY_MODE_REPLAY, params))
+		exit(EXIT_FAILURE);
+	return true;
+}
+
 /**
  * Checks if there is a value available for the current argument
  *
@@ -439,6 +461,9 @@ static bool cmdline_arg_next_value(const char *name, int current_arg, int argc)
  *   CMDLINE_OPT_PREINIT flag set and executes their handlers. Invalid command
  *   line arguments don't cause it to abort. Handler's failure causes the
  *   program to abort.
+ * - CMDLINE_OPT_EARLY: Same as CMDLINE_OPT_PREINIT, for the command line
+ *   arguments with the CMDLINE_OPT_EARLY flag set. Executed by the core
+ *   before the rng, the HPM and the sockets are initialized.
  * - CMDLINE_OPT_NORMAL: Scans the argv for normal command line arguments,
  *   skipping the pre-init ones, and executes their handlers. Invalid command
  *   line arguments or handler's failure cause the program to abort.
@@ -454,7 +479,7 @@ static int cmdline_exec(int argc, char **argv, unsigned int options)
 		struct CmdlineArgData *data = NULL;
 		const char *arg = argv[i];
 		if (arg[0] != '-') { // All arguments must begin with '-'
-			if ((options&(CMDLINE_OPT_SILENT|CMDLINE_OPT_PREINIT)) != 0)
+			if ((options&(CMDLINE_OPT_SILENT|CMDLINE_OPT_PREINIT|CMDLINE_OPT_EARLY)) != 0)
 				continue;
 			ShowError("Invalid option '%s'.\n", argv[i]);
 			exit(EXIT_FAILURE);
@@ -465,7 +490,7 @@ static int cmdline_exec(int argc, char **argv, unsigned int options)
 			ARR_FIND(0, VECTOR_LENGTH(cmdline->args_data), j, strcmpi(VECTOR_INDEX(cmdline->args_data, j).name, arg) == 0);
 		}
 		if (j == VECTOR_LENGTH(cmdline->args_data)) {
-			if (options&(CMDLINE_OPT_SILENT|CMDLINE_OPT_PREINIT))
+			if (options&(CMDLINE_OPT_SILENT|CMDLINE_OPT_PREINIT|CMDLINE_OPT_EARLY))
 				continue;
 			ShowError("Unknown option '%s'.\n", arg);
 			exit(EXIT_FAILURE);
@@ -481,7 +506,8 @@ static int cmdline_exec(int argc, char **argv, unsigned int options)
 				showmsg->silent = 0x7; // silence information and status messages
 				break;
 			}
-		} else if ((data->options&CMDLINE_OPT_PREINIT) == (options&CMDLINE_OPT_PREINIT)) {
+		} else if ((data->options&CMDLINE_OPT_EARLY) == (options&CMDLINE_OPT_EARLY)
+		        && (data->options&CMDLINE_OPT_PREINIT) == (options&CMDLINE_OPT_PREINIT)) {
 			const char *param = NULL;
 			if (data->options&CMDLINE_OPT_PARAM) {
 				param = argv[i]; // Already incremented above
@@ -502,6 +528,8 @@ static void cmdline_init(void)
 	CMDLINEARG_DEF(help, 'h', "Displays this help screen", CMDLINE_OPT_NORMAL);
 	CMDLINEARG_DEF(version, 'v', "Displays the server's version.", CMDLINE_OPT_NORMAL);
 	CMDLINEARG_DEF2(load-plugin, loadplugin, "Loads an additional plugin (can be repeated).", CMDLINE_OPT_PARAM|CMDLINE_OPT_PREINIT);
+	CMDLINEARG_DEF2(trace-record, tracerecord, "Records the incoming packets, timer ticks and rng seed into a trace file.", CMDLINE_OPT_PARAM|CMDLINE_OPT_EARLY);
+	CMDLINEARG_DEF2(trace-replay, tracereplay, "Replays a trace file without network (see common/replay.h).", CMDLINE_OPT_PARAM|CMDLINE_OPT_EARLY);
 	cmdline_args_init_local();
 }
 
@@ -590,8 +618,15 @@ int main(int argc, char **argv)
 
 	timer->init();
 
+	// Traces start before anything reads a tick or a random number,
+	// timer->init only calibrates the clock.
+	cmdline->exec(argc, argv, CMDLINE_OPT_EARLY);
+
+	ers_init();
+
 	/* timer first */
-	rnd->init();
+	if (replay->mode == REPLAY_MODE_OFF) // seeded by the trace
+		rnd->init();
 
 	console->init();
 
@@ -614,6 +649,7 @@ int main(int argc, char **argv)
 	console->final();
 
 	retval = do_final();
+	replay->final();
 	HPM->final();
 	timer->final();
 	packets->final();
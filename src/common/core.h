@@ -52,6 +52,7 @@ enum cmdline_options {
 	CMDLINE_OPT_PARAM          = 0x1, ///< An additional value parameter is expected.
 	CMDLINE_OPT_SILENT         = 0x2, ///< If this command-line argument is passed, the server won't print any messages.
 	CMDLINE_OPT_PREINIT        = 0x4, ///< This command-line argument is executed before initializing the HPM.
+	CMDLINE_OPT_EARLY          = 0x8, ///< This command-line argument is executed by the core, before initializing the rng and the sockets.
 };
 typedef bool (*CmdlineExecFunc)(const char *name, const char *params);
 struct CmdlineArgData {
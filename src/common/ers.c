@@ -43,7 +43,8 @@
  *  <H2>Disadvantages:</H2>                                                   *
  *  - Unused entries are almost inevitable - memory being wasted.            *
  *  - A  manager will only auto-destroy when all of its instances are        *
- *    destroyed so memory will usually only be recovered near the end.       *
+ *    destroyed, before that only the slabs (groups of entries) with no      *
+ *    entry in use can be released (ers_trim, periodically after ers_init).  *
  *  - Always wastes space for entries smaller than a pointer.                *
  *                                                                           *
  *  WARNING: The system is not thread-safe at the moment.                    *
@@ -66,18 +67,53 @@
 #include "common/memmgr.h" // CREATE, RECREATE, aMalloc, aFree
 #include "common/nullpo.h"
 #include "common/showmsg.h" // ShowMessage, ShowError, ShowFatalError, CL_BOLD, CL_NORMAL
+#include "common/timer.h"
 
 #include <stdlib.h>
 #include <string.h>
 
 #ifndef DISABLE_ERS
 
-#define ERS_BLOCK_ENTRIES 2048
+#define ERS_PAGE_SIZE 4096          ///< Slabs are sized in whole pages
+#define ERS_SLAB_SIZE (64 * 1024)   ///< Default size of a slab, in bytes
+#define ERS_SLAB_MIN_ENTRIES 8      ///< Minimum number of entries of a default-sized slab
+#define ERS_ALLOC_OVERHEAD 64       ///< Room left in the pages of a slab for the header of the memory manager
+#define ERS_TRIM_INTERVAL (5 * 60 * 1000) ///< Interval of the release of unused slabs, in ms
+#define ERS_TRIM_KEEP 1             ///< Unused slabs kept by each cache by the periodic release
 
+struct ers_slab;
 
 struct ers_list
 {
-	struct ers_list *Next;
+	union {
+		struct ers_list *Next; ///< Next reusable entry of the slab, while the entry is free
+		struct ers_slab *Slab; ///< Slab of the entry, while the entry is in use
+	};
+};
+
+/**
+ * Memory holding a group of entries of a cache, followed by the entries.
+ *
+ * A slab is in the Full, Partial or Empty list of its cache depending on
+ * how many of its entries are in use, slabs with no entry in use can be
+ * released (ers_trim).
+ */
+struct ers_slab
+{
+	// Linked list (Full, Partial or Empty list of the cache)
+	struct ers_slab *Next, *Prev;
+
+	// Reusable (freed) entries of this slab
+	struct ers_list *ReuseList;
+
+	// Number of entries of this slab
+	unsigned int Entries;
+
+	// Entries in use
+	unsigned int Used;
+
+	// Entries at the end of the slab that were never used
+	unsigned int Fresh;
 };
 
 struct ers_instance_t;
@@ -90,25 +126,36 @@ typedef struct ers_cache
 	// Number of ers_instances referencing this
 	int ReferenceCount;
 
-	// Reuse linked list
-	struct ers_list *ReuseList;
+	// Slabs with all entries in use
+	struct ers_slab *Full;
+
+	// Slabs with entries in use and free entries
+	struct ers_slab *Partial;
 
-	// Memory blocks array
-	unsigned char **Blocks;
+	// Slabs with no entry in use
+	struct ers_slab *Empty;
 
-	// Max number of blocks
-	unsigned int Max;
+	// Slab count, and how many are in the Empty list
+	unsigned int Slabs;
+	unsigned int EmptySlabs;
+
+	// Memory held by the slabs, in bytes
+	size_t SlabBytes;
 
 	// Free objects count
 	unsigned int Free;
 
-	// Used blocks count
-	unsigned int Used;
-
 	// Objects in-use count
 	unsigned int UsedObjs;
 
-	// Default = ERS_BLOCK_ENTRIES, can be adjusted for performance for individual cache sizes.
+	// Highest UsedObjs
+	unsigned int PeakObjs;
+
+	// Slabs released so far
+	unsigned int ReleasedSlabs;
+
+	// Entries per slab (rounded up to fill whole pages), 0 for slabs of ERS_SLAB_SIZE bytes.
+	// Can be adjusted for performance for individual cache sizes.
 	unsigned int ChunkSize;
 
 	// Misc options, some options are shared from the instance
@@ -160,13 +207,10 @@ static ers_cache_t *ers_find_cache(unsigned int size, enum ERSOptions Options)
 	CREATE(cache, ers_cache_t, 1);
 	cache->ObjectSize = size;
 	cache->ReferenceCount = 0;
-	cache->ReuseList = NULL;
-	cache->Blocks = NULL;
+	cache->Full = cache->Partial = cache->Empty = NULL;
 	cache->Free = 0;
-	cache->Used = 0;
 	cache->UsedObjs = 0;
-	cache->Max = 0;
-	cache->ChunkSize = ERS_BLOCK_ENTRIES;
+	cache->ChunkSize = 0;
 	cache->Options = (Options & ERS_CACHE_OPTIONS);
 
 	if (CacheList == NULL)
@@ -184,13 +228,100 @@ static ers_cache_t *ers_find_cache(unsigned int size, enum ERSOptions Options)
 	return cache;
 }
 
-static void ers_free_cache(ers_cache_t *cache, bool remove)
+static void ers_slab_link(struct ers_slab **list, struct ers_slab *slab)
+{
+	slab->Prev = NULL;
+	slab->Next = *list;
+	if (*list != NULL)
+		(*list)->Prev = slab;
+	*list = slab;
+}
+
+static void ers_slab_unlink(struct ers_slab **list, struct ers_slab *slab)
+{
+	if (slab->Prev != NULL)
+		slab->Prev->Next = slab->Next;
+	else
+		*list = slab->Next;
+	if (slab->Next != NULL)
+		slab->Next->Prev = slab->Prev;
+	slab->Next = slab->Prev = NULL;
+}
+
+/**
+ * Allocates a new slab for a cache, sized to fill whole pages.
+ */
+static struct ers_slab *ers_slab_new(ers_cache_t *cache)
+{
+	struct ers_slab *slab;
+	size_t size;
+
+	if (cache->ChunkSize != 0)
+		size = sizeof(struct ers_slab) + (size_t)cache->ChunkSize * cache->ObjectSize;
+	else
+		size = max((size_t)ERS_SLAB_SIZE, sizeof(struct ers_slab) + (size_t)ERS_SLAB_MIN_ENTRIES * cache->ObjectSize);
+	size = (size + ERS_ALLOC_OVERHEAD + ERS_PAGE_SIZE - 1) / ERS_PAGE_SIZE * ERS_PAGE_SIZE - ERS_ALLOC_OVERHEAD;
+
+	slab = aCalloc(1, size); // fresh entries are handed out zeroed
+	slab->Next = slab->Prev = NULL;
+	slab->ReuseList = NULL;
+	slab->Entries = (unsigned int)((size - sizeof(struct ers_slab)) / cache->ObjectSize);
+	slab->Used = 0;
+	slab->Fresh = slab->Entries;
+
+	cache->Slabs++;
+	cache->SlabBytes += size;
+	cache->Free += slab->Entries;
+	return slab;
+}
+
+static size_t ers_slab_size(const ers_cache_t *cache, const struct ers_slab *slab)
 {
-	unsigned int i;
+	return sizeof(struct ers_slab) + (size_t)slab->Entries * cache->ObjectSize;
+}
 
+/**
+ * Releases the slabs of a cache that have no entry in use.
+ *
+ * @param keep Number of unused slabs to keep, for the next allocations
+ * @return the number of bytes released
+ */
+static size_t ers_cache_trim(ers_cache_t *cache, unsigned int keep)
+{
+	size_t released = 0;
+
+	nullpo_ret(cache);
+	while (cache->EmptySlabs > keep) {
+		struct ers_slab *slab = cache->Empty;
+		size_t size = ers_slab_size(cache, slab);
+
+		ers_slab_unlink(&cache->Empty, slab);
+		cache->EmptySlabs--;
+		cache->Slabs--;
+		cache->SlabBytes -= size;
+		cache->Free -= slab->Entries;
+		cache->ReleasedSlabs++;
+		released += size;
+		aFree(slab);
+	}
+	return released;
+}
+
+static void ers_free_slab_list(struct ers_slab *slab)
+{
+	while (slab != NULL) {
+		struct ers_slab *next = slab->Next;
+		aFree(slab);
+		slab = next;
+	}
+}
+
+static void ers_free_cache(ers_cache_t *cache, bool remove)
+{
 	nullpo_retv(cache);
-	for (i = 0; i < cache->Used; i++)
-		aFree(cache->Blocks[i]);
+	ers_free_slab_list(cache->Full);
+	ers_free_slab_list(cache->Partial);
+	ers_free_slab_list(cache->Empty);
 
 	if (cache->Next)
 		cache->Next->Prev = cache->Prev;
@@ -200,55 +331,66 @@ static void ers_free_cache(ers_cache_t *cache, bool remove)
 	else
 		CacheList = cache->Next;
 
-	aFree(cache->Blocks);
-
 	aFree(cache);
 }
 
 static void *ers_obj_alloc_entry(ERS *self)
 {
 	struct ers_instance_t *instance = (struct ers_instance_t *)self;
-	void *ret;
+	ers_cache_t *cache;
+	struct ers_slab *slab;
+	struct ers_list *entry;
 
 	if (instance == NULL) {
 		ShowError("ers_obj_alloc_entry: NULL object, aborting entry freeing.\n");
 		return NULL;
 	}
 
-	if (instance->Cache->ReuseList != NULL) {
-		ret = (void *)((unsigned char *)instance->Cache->ReuseList + sizeof(struct ers_list));
-		instance->Cache->ReuseList = instance->Cache->ReuseList->Next;
-	} else if (instance->Cache->Free > 0) {
-		instance->Cache->Free--;
-		ret = &instance->Cache->Blocks[instance->Cache->Used - 1][instance->Cache->Free * (size_t)instance->Cache->ObjectSize + sizeof(struct ers_list)];
-	} else {
-		if (instance->Cache->Used == instance->Cache->Max) {
-			instance->Cache->Max = (instance->Cache->Max * 4) + 3;
-			RECREATE(instance->Cache->Blocks, unsigned char *, instance->Cache->Max);
+	cache = instance->Cache;
+	if ((slab = cache->Partial) == NULL) {
+		// Reuse an unused slab before allocating a new one
+		if ((slab = cache->Empty) != NULL) {
+			ers_slab_unlink(&cache->Empty, slab);
+			cache->EmptySlabs--;
+		} else {
+			slab = ers_slab_new(cache);
 		}
+		ers_slab_link(&cache->Partial, slab);
+	}
 
-		CREATE(instance->Cache->Blocks[instance->Cache->Used], unsigned char, instance->Cache->ObjectSize * instance->Cache->ChunkSize);
-		instance->Cache->Used++;
+	if (slab->ReuseList != NULL) {
+		entry = slab->ReuseList;
+		slab->ReuseList = entry->Next;
+	} else {
+		entry = (struct ers_list *)((unsigned char *)(slab + 1) + (size_t)(slab->Entries - slab->Fresh) * cache->ObjectSize);
+		slab->Fresh--;
+	}
+	entry->Slab = slab;
 
-		instance->Cache->Free = instance->Cache->ChunkSize -1;
-		ret = &instance->Cache->Blocks[instance->Cache->Used - 1][instance->Cache->Free * (size_t)instance->Cache->ObjectSize + sizeof(struct ers_list)];
+	if (++slab->Used == slab->Entries) {
+		ers_slab_unlink(&cache->Partial, slab);
+		ers_slab_link(&cache->Full, slab);
 	}
 
 	instance->Count++;
-	instance->Cache->UsedObjs++;
+	cache->Free--;
+	if (++cache->UsedObjs > cache->PeakObjs)
+		cache->PeakObjs = cache->UsedObjs;
 
 #ifdef DEBUG
 	if( instance->Count > instance->Peak )
 		instance->Peak = instance->Count;
 #endif
 
-	return ret;
+	return (unsigned char *)entry + sizeof(struct ers_list);
 }
 
 static void ers_obj_free_entry(ERS *self, void *entry)
 {
 	struct ers_instance_t *instance = (struct ers_instance_t *)self;
 	struct ers_list *reuse = (struct ers_list *)((unsigned char *)entry - sizeof(struct ers_list));
+	ers_cache_t *cache;
+	struct ers_slab *slab;
 
 	if (instance == NULL) {
 		ShowError("ers_obj_free_entry: NULL object, aborting entry freeing.\n");
@@ -258,13 +400,33 @@ static void ers_obj_free_entry(ERS *self, void *entry)
 		return;
 	}
 
-	if( instance->Cache->Options & ERS_OPT_CLEAN )
-		memset((unsigned char*)reuse + sizeof(struct ers_list), 0, instance->Cache->ObjectSize - sizeof(struct ers_list));
+	cache = instance->Cache;
+	slab = reuse->Slab;
+#ifdef DEBUG
+	if ((unsigned char *)reuse < (unsigned char *)(slab + 1) || (unsigned char *)reuse >= (unsigned char *)(slab + 1) + (size_t)slab->Entries * cache->ObjectSize) {
+		ShowError("ers_obj_free_entry: entry %p of '%s' is not in use or was not allocated by this manager.\n", entry, instance->Name);
+		return;
+	}
+#endif
+
+	if( cache->Options & ERS_OPT_CLEAN )
+		memset((unsigned char*)reuse + sizeof(struct ers_list), 0, cache->ObjectSize - sizeof(struct ers_list));
+
+	if (slab->Used == slab->Entries) {
+		ers_slab_unlink(&cache->Full, slab);
+		ers_slab_link(&cache->Partial, slab);
+	}
+	reuse->Next = slab->ReuseList;
+	slab->ReuseList = reuse;
+	if (--slab->Used == 0) {
+		ers_slab_unlink(&cache->Partial, slab);
+		ers_slab_link(&cache->Empty, slab);
+		cache->EmptySlabs++;
+	}
 
-	reuse->Next = instance->Cache->ReuseList;
-	instance->Cache->ReuseList = reuse;
 	instance->Count--;
-	instance->Cache->UsedObjs--;
+	cache->Free++;
+	cache->UsedObjs--;
 }
 
 static size_t ers_obj_entry_size(ERS *self)
@@ -361,10 +523,74 @@ ERS *ers_new(uint32 size, const char *name, enum ERSOptions options) // FIXME: c
 	return &instance->VTable;
 }
 
+/**
+ * Fills the statistics of a cache.
+ */
+static void ers_cache_stats_sub(const ers_cache_t *cache, struct ers_cache_stats *stats)
+{
+	const struct ers_slab *slab;
+
+	memset(stats, 0, sizeof(*stats));
+	stats->object_size = cache->ObjectSize;
+	stats->instances = cache->ReferenceCount;
+	stats->slabs = cache->Slabs;
+	stats->empty_slabs = cache->EmptySlabs;
+	for (slab = cache->Full; slab != NULL; slab = slab->Next)
+		stats->full_slabs++;
+	for (slab = cache->Partial; slab != NULL; slab = slab->Next) {
+		stats->partial_slabs++;
+		stats->partial_free += slab->Entries - slab->Used;
+	}
+	stats->used = cache->UsedObjs;
+	stats->peak = cache->PeakObjs;
+	stats->free = cache->Free;
+	stats->bytes = cache->SlabBytes;
+	stats->released_slabs = cache->ReleasedSlabs;
+}
+
+int ers_stats(struct ers_cache_stats *stats, int max)
+{
+	const ers_cache_t *cache;
+	int count = 0;
+
+	nullpo_ret(stats);
+	for (cache = CacheList; cache != NULL && count < max; cache = cache->Next)
+		ers_cache_stats_sub(cache, &stats[count++]);
+	return count;
+}
+
+size_t ers_trim(bool all)
+{
+	ers_cache_t *cache;
+	size_t released = 0;
+
+	for (cache = CacheList; cache != NULL; cache = cache->Next)
+		released += ers_cache_trim(cache, all ? 0 : ERS_TRIM_KEEP);
+	if (released != 0)
+		iMalloc->trim_memory();
+	return released;
+}
+
+/**
+ * Timer to periodically release the unused slabs.
+ */
+static int ers_trim_timer(int tid, int64 tick, int id, intptr_t data)
+{
+	ers_trim(false);
+	return 0;
+}
+
+void ers_init(void)
+{
+	timer->add_func_list(ers_trim_timer, "ers_trim_timer");
+	timer->add_interval(timer->gettick() + ERS_TRIM_INTERVAL, ers_trim_timer, 0, 0, ERS_TRIM_INTERVAL);
+}
+
 void ers_report(void)
 {
 	ers_cache_t *cache;
-	unsigned int cache_c = 0, blocks_u = 0, blocks_a = 0, memory_b = 0, memory_t = 0;
+	unsigned int cache_c = 0, blocks_u = 0, blocks_a = 0, slabs_t = 0, slabs_e = 0;
+	size_t memory_b = 0, memory_t = 0;
 #ifdef DEBUG
 	struct ers_instance_t *instance;
 	unsigned int instance_c = 0, instance_c_d = 0;
@@ -383,24 +609,34 @@ void ers_report(void)
 #endif
 
 	for (cache = CacheList; cache; cache = cache->Next) {
+		struct ers_cache_stats stats;
+		unsigned int capacity;
+
+		ers_cache_stats_sub(cache, &stats);
+		capacity = stats.used + stats.free;
 		cache_c++;
 		ShowMessage(CL_BOLD"[ERS Cache of size '"CL_NORMAL""CL_WHITE"%u"CL_NORMAL""CL_BOLD"' report]\n"CL_NORMAL, cache->ObjectSize);
-		ShowMessage("\tinstances          : %d\n", cache->ReferenceCount);
-		ShowMessage("\tblocks in use      : %u/%u\n", cache->UsedObjs, cache->UsedObjs+cache->Free);
-		ShowMessage("\tblocks unused      : %u\n", cache->Free);
-		ShowMessage("\tmemory in use      : %.2f MB\n", cache->UsedObjs == 0 ? 0. : (double)((cache->UsedObjs * cache->ObjectSize)/1024)/1024);
-		ShowMessage("\tmemory allocated   : %.2f MB\n", (cache->Free+cache->UsedObjs) == 0 ? 0. : (double)(((cache->UsedObjs+cache->Free) * cache->ObjectSize)/1024)/1024);
-		blocks_u += cache->UsedObjs;
-		blocks_a += cache->UsedObjs + cache->Free;
-		memory_b += cache->UsedObjs * cache->ObjectSize;
-		memory_t += (cache->UsedObjs+cache->Free) * cache->ObjectSize;
+		ShowMessage("\tinstances          : %d\n", stats.instances);
+		ShowMessage("\tblocks in use      : %u/%u (peak %u)\n", stats.used, capacity, stats.peak);
+		ShowMessage("\tblocks unused      : %u\n", stats.free);
+		ShowMessage("\tslabs              : %u (%u full, %u partial, %u unused, %u released)\n", stats.slabs, stats.full_slabs, stats.partial_slabs, stats.empty_slabs, stats.released_slabs);
+		ShowMessage("\toccupancy          : %.1f%%\n", capacity == 0 ? 0. : 100. * stats.used / capacity);
+		ShowMessage("\tfragmentation      : %.1f%% (unused blocks in partial slabs)\n", capacity == 0 ? 0. : 100. * stats.partial_free / capacity);
+		ShowMessage("\tmemory in use      : %.2f MB\n", (double)((size_t)stats.used * cache->ObjectSize) / 1024 / 1024);
+		ShowMessage("\tmemory allocated   : %.2f MB\n", (double)stats.bytes / 1024 / 1024);
+		blocks_u += stats.used;
+		blocks_a += capacity;
+		slabs_t += stats.slabs;
+		slabs_e += stats.empty_slabs;
+		memory_b += (size_t)stats.used * cache->ObjectSize;
+		memory_t += stats.bytes;
 	}
 #ifdef DEBUG
 	ShowInfo("ers_report: '"CL_WHITE"%u"CL_NORMAL"' instances in use, '"CL_WHITE"%u"CL_NORMAL"' displayed\n",instance_c,instance_c_d);
 #endif
 	ShowInfo("ers_report: '"CL_WHITE"%u"CL_NORMAL"' caches in use\n",cache_c);
-	ShowInfo("ers_report: '"CL_WHITE"%u"CL_NORMAL"' blocks in use, consuming '"CL_WHITE"%.2f MB"CL_NORMAL"'\n",blocks_u,(double)((memory_b)/1024)/1024);
-	ShowInfo("ers_report: '"CL_WHITE"%u"CL_NORMAL"' blocks total, consuming '"CL_WHITE"%.2f MB"CL_NORMAL"' \n",blocks_a,(double)((memory_t)/1024)/1024);
+	ShowInfo("ers_report: '"CL_WHITE"%u"CL_NORMAL"' blocks in use, consuming '"CL_WHITE"%.2f MB"CL_NORMAL"'\n",blocks_u,(double)memory_b/1024/1024);
+	ShowInfo("ers_report: '"CL_WHITE"%u"CL_NORMAL"' blocks total in '"CL_WHITE"%u"CL_NORMAL"' slabs ('"CL_WHITE"%u"CL_NORMAL"' unused), consuming '"CL_WHITE"%.2f MB"CL_NORMAL"' \n",blocks_a,slabs_t,slabs_e,(double)memory_t/1024/1024);
 }
 
 /**
@@ -67,6 +67,9 @@
  *  ERS                   - Entry manager.                                   *
  *  ers_new               - Allocate an instance of an entry manager.        *
  *  ers_report            - Print a report about the current state.          *
+ *  ers_stats             - Get the statistics of the managers.              *
+ *  ers_trim              - Release the unused memory of the managers.       *
+ *  ers_init              - Start the periodic release of unused memory.     *
  *  ers_final             - Clears the remainder of the managers.           *
 \*****************************************************************************/
 
@@ -100,6 +103,25 @@ enum ERSOptions {
 	ERS_CACHE_OPTIONS   = ERS_OPT_CLEAN|ERS_OPT_FLEX_CHUNK,
 };
 
+/**
+ * Statistics of a cache of entries (shared by the managers of the same entry size and options).
+ * @see ers_stats
+ */
+struct ers_cache_stats {
+	unsigned int object_size;    ///< Size of the entries, including the header
+	int instances;               ///< Managers using the cache
+	unsigned int slabs;          ///< Slabs (groups of entries allocated together)
+	unsigned int full_slabs;     ///< Slabs with all entries in use
+	unsigned int partial_slabs;  ///< Slabs with entries in use and free entries
+	unsigned int empty_slabs;    ///< Slabs with no entry in use (released by ers_trim)
+	unsigned int used;           ///< Entries in use
+	unsigned int peak;           ///< Highest number of entries in use
+	unsigned int free;           ///< Free entries
+	unsigned int partial_free;   ///< Free entries in partial slabs, that can't be released (fragmentation)
+	unsigned int released_slabs; ///< Slabs released so far
+	size_t bytes;                ///< Memory held by the slabs
+};
+
 /**
  * Public interface of the entry manager.
  * @param alloc Allocate an entry from this manager
@@ -156,6 +178,9 @@ typedef struct eri {
 // Disable the public functions
 #	define ers_new(size,name,options) NULL
 #	define ers_report() (void)0
+#	define ers_stats(stats,max) ((void)(stats), (void)(max), 0)
+#	define ers_trim(all) ((void)(all), (size_t)0)
+#	define ers_init() (void)0
 #	define ers_final() (void)0
 #else /* not DISABLE_ERS */
 // These defines should be used to allow the code to keep working whenever
@@ -188,6 +213,26 @@ ERS *ers_new(uint32 size, const char *name, enum ERSOptions options);
  */
 void ers_report(void);
 
+/**
+ * Get the statistics of each cache of entries.
+ * @param stats Where to copy the statistics
+ * @param max Maximum number of caches to copy
+ * @return Number of caches copied
+ */
+int ers_stats(struct ers_cache_stats *stats, int max);
+
+/**
+ * Release the memory of the slabs that have no entry in use.
+ * @param all Whether to release all of them, or to keep one slab per cache for the next allocations
+ * @return Number of bytes released
+ */
+size_t ers_trim(bool all);
+
+/**
+ * Start the periodic release of the unused slabs (needs the timers).
+ */
+void ers_init(void);
+
 /**
  * Clears the remainder of the managers
  **/
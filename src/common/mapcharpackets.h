@@ -23,8 +23,41 @@
 #define COMMON_MAPCHARPACKETS_H
 
 #include "common/hercules.h"
+#include "common/mmo.h" // struct item, NAME_LENGTH, SCRIPT_VARNAME_LENGTH
 #include "common/packetsmacro.h"
 
+/// Character save encodings, negotiated with PACKET_MAPCHAR_SAVE_MODE_REQ.
+enum chrif_save_mode {
+	CHRIF_SAVE_DELTA = 0x1, ///< Only the regions changed since the base snapshot are sent
+	CHRIF_SAVE_ZLIB  = 0x2, ///< The payload is compressed with zlib
+};
+
+/// Result of PACKET_MAPCHAR_MAP_MOVE_REQ.
+enum chrif_map_move_result {
+	CHRIF_MAP_MOVE_OK = 0,
+	CHRIF_MAP_MOVE_UNKNOWN,    ///< Invalid map index
+	CHRIF_MAP_MOVE_NOT_LOADED, ///< The map is not loaded by the requesting map-server
+	CHRIF_MAP_MOVE_ALREADY,    ///< The map is already owned by the requesting map-server
+};
+
+/// Records of PACKET_MAPCHAR_MAP_STATE, relayed as is by the char-server.
+enum chrif_map_state_type {
+	CHRIF_MAP_STATE_BEGIN = 0, ///< No records, the receiver clears the map
+	CHRIF_MAP_STATE_MOB,       ///< struct chrif_map_state_mob
+	CHRIF_MAP_STATE_ITEM,      ///< struct chrif_map_state_item
+	CHRIF_MAP_STATE_NPC,       ///< struct chrif_map_state_npc
+	CHRIF_MAP_STATE_NPC_VAR,   ///< struct chrif_map_state_npc_var, followed by its string value
+	CHRIF_MAP_STATE_UNIT,      ///< struct chrif_map_state_unit
+	CHRIF_MAP_STATE_END,       ///< No records, the whole state was sent
+};
+
+/// Caster of a struct chrif_map_state_unit.
+enum chrif_map_state_caster {
+	CHRIF_MAP_STATE_CASTER_PC = 0, ///< A character, which gets the skill back once on the map
+	CHRIF_MAP_STATE_CASTER_MOB,    ///< A monster of the map
+	CHRIF_MAP_STATE_CASTER_NPC,    ///< An NPC
+};
+
 /* Packets Structs */
 #if !defined(sun) && (!defined(__NETBSD__) || __NetBSD_Version__ >= 600000000) // NetBSD 5 and Solaris don't like pragma pack but accept the packed attribute
 #pragma pack(push, 1)
@@ -58,6 +91,121 @@ struct PACKET_MAPCHAR_GUILD_EMBLEM {
 } __attribute__((packed));
 DEFINE_PACKET_ID(MAPCHAR_GUILD_EMBLEM, 0x303f)
 
+struct PACKET_MAPCHAR_SAVE_DELTA {
+	int16 packetType;
+	uint16 packetLength;
+	int account_id;
+	int char_id;
+	uint8 flag;          ///< 1: the character is quitting
+	uint8 encoding;      ///< enum chrif_save_mode (0: full uncompressed snapshot)
+	uint32 seq;          ///< Sequence number of this snapshot
+	uint32 base_seq;     ///< Snapshot the delta applies to (CHRIF_SAVE_DELTA only)
+	uint16 raw_len;      ///< Payload length before compression
+	uint8 data[];        ///< struct mmo_charstatus, or runs of (W offset, W length, data)
+} __attribute__((packed));
+DEFINE_PACKET_ID(MAPCHAR_SAVE_DELTA, 0x2b28)
+
+struct PACKET_MAPCHAR_SAVE_MODE_REQ {
+	int16 packetType;
+	uint8 modes;         ///< enum chrif_save_mode supported by the map-server
+} __attribute__((packed));
+DEFINE_PACKET_ID(MAPCHAR_SAVE_MODE_REQ, 0x2b29)
+
+struct PACKET_MAPCHAR_CHANGE_MAPSERVER_REQ {
+	int16 packetType;
+	int account_id;
+	int login_id1;
+	int login_id2;
+	int char_id;
+	uint16 map_index;
+	int16 x;
+	int16 y;
+	uint32 ip;           ///< Destination map-server, host byte order
+	uint16 port;
+	uint8 sex;
+	uint32 client_addr;
+	int group_id;
+} __attribute__((packed));
+DEFINE_PACKET_ID(MAPCHAR_CHANGE_MAPSERVER_REQ, 0x2b05)
+
+struct PACKET_MAPCHAR_MAP_MOVE_REQ {
+	int16 packetType;
+	int account_id;      ///< Requesting player, for the answer
+	uint16 map_index;    ///< Map to move to the requesting map-server
+} __attribute__((packed));
+DEFINE_PACKET_ID(MAPCHAR_MAP_MOVE_REQ, 0x2b2c)
+
+struct PACKET_MAPCHAR_MAP_STATE {
+	int16 packetType;
+	uint16 packetLength;
+	uint32 ip;           ///< Map-server the map moved to, host byte order
+	uint16 port;
+	uint16 map_index;
+	uint8 type;          ///< enum chrif_map_state_type
+	uint16 count;        ///< Number of records in data
+	uint8 data[];
+} __attribute__((packed));
+DEFINE_PACKET_ID(MAPCHAR_MAP_STATE, 0x2b2e)
+
+/// A monster of a moved map.
+struct chrif_map_state_mob {
+	int id;              ///< Id on the previous owner, for the casters of ground skills
+	int class_;
+	int16 x, y;
+	uint8 dir;
+	uint8 size, ai;
+	uint32 hp;           ///< 0: dead, waiting for its respawn
+	uint32 respawn;      ///< Time left before its respawn (ms), when dead
+	uint8 spawn;         ///< 1: permanent spawn, identified by the spawn_* fields
+	int spawn_class;
+	int16 spawn_x, spawn_y, spawn_xs, spawn_ys;
+	uint8 guardian;      ///< 1: castle guardian
+	int16 guardian_index; ///< Its index in the castle, -1 for a temporary one
+	char name[NAME_LENGTH];
+	char event[NAME_LENGTH * 2 + 3]; ///< EVENT_NAME_LENGTH
+	char npc[NAME_LENGTH + 1]; ///< Unique name of the NPC that spawned it, empty if none
+} __attribute__((packed));
+
+/// An item on the ground of a moved map.
+struct chrif_map_state_item {
+	struct item item;
+	int16 x, y;
+	uint8 subx, suby;
+	int charid[3];       ///< Characters allowed to pick it up first
+	uint32 charid_time[3]; ///< Time left of their priority (ms)
+	uint32 lifetime;     ///< Time left before it's cleared (ms)
+} __attribute__((packed));
+
+/// An NPC of a moved map.
+struct chrif_map_state_npc {
+	char name[NAME_LENGTH + 1]; ///< Unique name
+	int class_;
+	int16 x, y;
+	uint8 dir;
+	uint32 option;
+	uint8 timer_running; ///< 1: the NPC timer (not attached to a player) runs
+	int timer;           ///< Value of the NPC timer (ms)
+} __attribute__((packed));
+
+/// A '.' variable of an NPC of a moved map.
+struct chrif_map_state_npc_var {
+	char npc[NAME_LENGTH + 1]; ///< Unique name of the NPC
+	char name[SCRIPT_VARNAME_LENGTH + 1];
+	uint32 index;
+	int value;           ///< Value of a number variable
+	uint16 len;          ///< Length of the string value following the record, with its NUL (0 for a number)
+} __attribute__((packed));
+
+/// A ground skill of a moved map.
+struct chrif_map_state_unit {
+	uint8 caster_type;   ///< enum chrif_map_state_caster
+	int caster_id;       ///< Char id, or mob id on the previous owner
+	char npc[NAME_LENGTH + 1]; ///< Unique name of the casting NPC
+	uint16 skill_id, skill_lv;
+	int16 x, y;          ///< Center of the skill
+	uint32 limit;        ///< Time left (ms)
+} __attribute__((packed));
+
 #if !defined(sun) && (!defined(__NETBSD__) || __NetBSD_Version__ >= 600000000) // NetBSD 5 and Solaris don't like pragma pack but accept the packed attribute
 #pragma pack(pop)
 #endif // not NetBSD < 6 / Solaris
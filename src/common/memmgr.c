@@ -48,6 +48,7 @@ struct malloc_interface *iMalloc;
 #	define MEMORY_USAGE()              ((size_t)0)
 #	define MEMORY_VERIFY(ptr)          mwIsSafeAddr((ptr), 1)
 #	define MEMORY_CHECK()              CHECK()
+#	define MEMORY_TRIM()               0
 
 #elif defined(DMALLOC)
 
@@ -62,6 +63,7 @@ struct malloc_interface *iMalloc;
 #	define MEMORY_USAGE()              dmalloc_memory_allocated()
 #	define MEMORY_VERIFY(ptr)          (dmalloc_verify(ptr) == DMALLOC_VERIFY_NOERROR)
 #	define MEMORY_CHECK()              do { dmalloc_log_stats(); dmalloc_log_unfreed() } while(0)
+#	define MEMORY_TRIM()               0
 
 #elif defined(GCOLLECT)
 
@@ -81,6 +83,7 @@ struct malloc_interface *iMalloc;
 #	define MEMORY_USAGE()              GC_get_heap_size()
 #	define MEMORY_VERIFY(ptr)          (GC_base(ptr) != NULL)
 #	define MEMORY_CHECK()              GC_gcollect()
+#	define MEMORY_TRIM()               0
 
 #else
 
@@ -92,6 +95,12 @@ struct malloc_interface *iMalloc;
 #	define MEMORY_USAGE()              ((size_t)0)
 #	define MEMORY_VERIFY(ptr)          true
 #	define MEMORY_CHECK()              (void)0
+#	if defined(__GLIBC__)
+#		include <malloc.h>
+#		define MEMORY_TRIM()               malloc_trim(0)
+#	else
+#		define MEMORY_TRIM()               0
+#	endif
 
 #endif
 
@@ -324,6 +333,9 @@ struct unit_head {
 	const  char*   file;
 	unsigned short line;
 	unsigned short size;
+#ifdef MEMMGR_STATS
+	struct memmgr_site_stats *site;
+#endif
 	long           checksum;
 };
 
@@ -349,6 +361,67 @@ static size_t        memmgr_usage_bytes_t;
 #define block2unit(p, n) ((struct unit_head*)(&(p)->data[ p->unit_size * (n) ]))
 #define memmgr_assert(v) do { if(!(v)) { ShowError("Memory manager: assertion '" #v "' failed!\n"); } } while(0)
 
+/* Marks the unused blocks being released by memmgr_trim() */
+#define BLOCK_TRIM_MARK 0xFFFF
+
+#ifdef MEMMGR_STATS
+/* Call site statistics */
+#define MEMMGR_SITE_MAX 16384 ///< Size of the call site table (power of 2)
+
+static struct memmgr_site_stats memmgr_sites[MEMMGR_SITE_MAX];
+static int memmgr_site_count;
+/// Shared by the call sites that don't fit in the table
+static struct memmgr_site_stats memmgr_site_other = { "(other)", "", 0, 0, 0, 0, 0, 0 };
+
+/**
+ * Finds or adds the statistics entry of an allocation call site.
+ *
+ * Sites are keyed by the address of their file name (a string literal of
+ * ALC_MARK) and their line.
+ */
+static struct memmgr_site_stats *memmgr_site(const char *file, int line, const char *func)
+{
+	uint32 hash = (uint32)(((uintptr_t)file >> 2) * 2654435761U) ^ ((uint32)line * 40503U);
+	int n;
+
+	if (file == NULL)
+		return &memmgr_site_other;
+
+	for (n = 0; n < MEMMGR_SITE_MAX; n++) {
+		struct memmgr_site_stats *site = &memmgr_sites[(hash + n) & (MEMMGR_SITE_MAX - 1)];
+		if (site->file == file && site->line == line)
+			return site;
+		if (site->file == NULL) {
+			// Keep the table sparse enough for short probes
+			if (memmgr_site_count >= MEMMGR_SITE_MAX / 4 * 3)
+				break;
+			site->file = file;
+			site->line = line;
+			site->func = func;
+			memmgr_site_count++;
+			return site;
+		}
+	}
+	return &memmgr_site_other;
+}
+
+static void memmgr_site_alloc(struct memmgr_site_stats *site, size_t size)
+{
+	site->live_count++;
+	site->live_bytes += size;
+	if (site->live_bytes > site->peak_bytes)
+		site->peak_bytes = site->live_bytes;
+	site->allocs++;
+}
+
+static void memmgr_site_free(struct memmgr_site_stats *site, size_t size)
+{
+	site->live_count--;
+	site->live_bytes -= size;
+	site->frees++;
+}
+#endif // MEMMGR_STATS
+
 static unsigned short size2hash(size_t size)
 {
 	if( size <= BLOCK_DATA_SIZE1 ) {
@@ -396,6 +469,10 @@ static void *mmalloc_(size_t size, const char *file, int line, const char *func)
 			p->unit_head.size  = 0;
 			p->unit_head.file  = file;
 			p->unit_head.line  = (unsigned short)line;
+#ifdef MEMMGR_STATS
+			p->unit_head.site  = memmgr_site(file, line, func);
+			memmgr_site_alloc(p->unit_head.site, size);
+#endif
 			p->prev = NULL;
 			if (unit_head_large_first == NULL)
 				p->next = NULL;
@@ -474,6 +551,10 @@ static void *mmalloc_(size_t size, const char *file, int line, const char *func)
 	head->file  = file;
 	head->line  = (unsigned short)line;
 	head->size  = (unsigned short)size;
+#ifdef MEMMGR_STATS
+	head->site  = memmgr_site(file, line, func);
+	memmgr_site_alloc(head->site, size);
+#endif
 	*(long*)((char*)head + sizeof(struct unit_head) - sizeof(long) + size) = 0xdeadbeaf;
 	return (char *)head + sizeof(struct unit_head) - sizeof(long);
 }
@@ -611,6 +692,9 @@ static void mfree_(void *ptr, const char *file, int line, const char *func)
 			}
 			memmgr_usage_bytes -= head_large->size;
 			memmgr_usage_bytes_t -= head_large->size + sizeof(struct unit_head_large);
+#ifdef MEMMGR_STATS
+			memmgr_site_free(head_large->unit_head.site, head_large->size);
+#endif
 #ifdef DEBUG_MEMMGR
 			// set freed memory to 0xfd
 			memset(ptr, 0xfd, head_large->size);
@@ -628,6 +712,9 @@ static void mfree_(void *ptr, const char *file, int line, const char *func)
 			ShowError("Memory manager: args of aFree 0x%p is overflowed pointer %s line %d\n", ptr, file, line);
 		} else {
 			memmgr_usage_bytes -= head->size;
+#ifdef MEMMGR_STATS
+			memmgr_site_free(head->site, head->size);
+#endif
 			head->block         = NULL;
 #ifdef DEBUG_MEMMGR
 			memset(ptr, 0xfd, block->unit_size - sizeof(struct unit_head) + sizeof(long) );
@@ -689,6 +776,7 @@ static struct block *block_malloc(unsigned short hash)
 				hash_unfill[0]   = &p[i];
 				p[i].unfill_prev = NULL;
 				p[i].unit_used = 0;
+				p[i].unit_hash = 0;
 			}
 			if(i != BLOCK_ALLOC -1) {
 				p[i].block_next = &p[i+1];
@@ -736,6 +824,127 @@ static size_t memmgr_usage(void)
 	return memmgr_usage_bytes / 1024;
 }
 
+/**
+ * Returns to the system the groups of BLOCK_ALLOC blocks that have no used unit left.
+ *
+ * Blocks are allocated BLOCK_ALLOC at a time and are otherwise kept for
+ * reuse after their last unit is freed, so the memory of a usage peak stays
+ * allocated until the groups are trimmed.
+ *
+ * @return the number of bytes released
+ */
+static size_t memmgr_trim(void)
+{
+	struct block *chunk, *prev = NULL, **free_block;
+	size_t released = 0;
+	bool marked = false;
+
+	for (chunk = block_first; chunk != NULL; chunk = chunk[BLOCK_ALLOC - 1].block_next) {
+		int i;
+		for (i = 0; i < BLOCK_ALLOC && chunk[i].unit_used == 0; i++)
+			;
+		if (i < BLOCK_ALLOC)
+			continue;
+		for (i = 0; i < BLOCK_ALLOC; i++)
+			chunk[i].unit_hash = BLOCK_TRIM_MARK;
+		marked = true;
+	}
+	if (!marked)
+		return 0;
+
+	// The unused blocks are all in the hash_unfill[0] list
+	free_block = &hash_unfill[0];
+	while (*free_block != NULL) {
+		if ((*free_block)->unit_hash == BLOCK_TRIM_MARK)
+			*free_block = (*free_block)->unfill_next;
+		else
+			free_block = &(*free_block)->unfill_next;
+	}
+
+	chunk = block_first;
+	while (chunk != NULL) {
+		struct block *next = chunk[BLOCK_ALLOC - 1].block_next;
+		if (chunk[0].unit_hash == BLOCK_TRIM_MARK) {
+			if (prev == NULL)
+				block_first = next;
+			else
+				prev[BLOCK_ALLOC - 1].block_next = next;
+			FREE(chunk, __FILE__, __LINE__, __func__);
+			memmgr_usage_bytes_t -= sizeof(struct block) * (BLOCK_ALLOC);
+			released += sizeof(struct block) * (BLOCK_ALLOC);
+		} else {
+			prev = chunk;
+		}
+		chunk = next;
+	}
+	block_last = (prev != NULL) ? &prev[BLOCK_ALLOC - 1] : NULL;
+
+	return released;
+}
+
+#ifdef MEMMGR_STATS
+static int memmgr_site_cmp(const void *a, const void *b)
+{
+	const struct memmgr_site_stats *sa = *(const struct memmgr_site_stats * const *)a;
+	const struct memmgr_site_stats *sb = *(const struct memmgr_site_stats * const *)b;
+
+	if (sa->live_bytes != sb->live_bytes)
+		return sa->live_bytes > sb->live_bytes ? -1 : 1;
+	if (sa->allocs != sb->allocs)
+		return sa->allocs > sb->allocs ? -1 : 1;
+	return 0;
+}
+
+/**
+ * Lists the call sites that allocated memory, by decreasing live bytes.
+ *
+ * @param count Set to the number of sites (the list is allocated with MALLOC and must be released with FREE)
+ */
+static struct memmgr_site_stats **memmgr_site_list(int *count)
+{
+	struct memmgr_site_stats **list = MALLOC(sizeof(*list) * (memmgr_site_count + 1), __FILE__, __LINE__, __func__);
+	int i, n = 0;
+
+	if (list == NULL) {
+		*count = 0;
+		return NULL;
+	}
+	for (i = 0; i < MEMMGR_SITE_MAX; i++) {
+		if (memmgr_sites[i].allocs != 0)
+			list[n++] = &memmgr_sites[i];
+	}
+	if (memmgr_site_other.allocs != 0)
+		list[n++] = &memmgr_site_other;
+	qsort(list, n, sizeof(*list), memmgr_site_cmp);
+	*count = n;
+	return list;
+}
+#endif // MEMMGR_STATS
+
+/**
+ * Copies the statistics of the call sites holding the most memory.
+ *
+ * @param stats Where to copy the statistics
+ * @param max   Maximum number of sites to copy
+ * @return the number of sites copied (0 when built without MEMMGR_STATS)
+ */
+static int memmgr_site_stats(struct memmgr_site_stats *stats, int max)
+{
+#ifdef MEMMGR_STATS
+	int i, count = 0;
+	struct memmgr_site_stats **list = memmgr_site_list(&count);
+
+	if (count > max)
+		count = max;
+	for (i = 0; i < count; i++)
+		stats[i] = *list[i];
+	FREE(list, __FILE__, __LINE__, __func__);
+	return count;
+#else
+	return 0;
+#endif
+}
+
 #ifdef LOG_MEMMGR
 static char memmer_logfile[128];
 static FILE *log_fp;
@@ -942,6 +1151,75 @@ void memmgr_report(int extra)
 
 }
 
+/**
+ * Shows the call sites holding the most memory.
+ *
+ * @param max          Number of lines to show
+ * @param by_subsystem Whether to add up the sites of each source file (subsystem)
+ */
+void memmgr_report_sites(int max, bool by_subsystem)
+{
+#ifdef MEMMGR_STATS
+	int i, count = 0;
+	struct memmgr_site_stats **list = memmgr_site_list(&count);
+
+	if (list == NULL)
+		return;
+
+	if (by_subsystem) {
+		// Add up the sites of each file, line is used as the number of sites
+		int files = 0;
+		struct memmgr_site_stats *totals = MALLOC(sizeof(*totals) * (count + 1), __FILE__, __LINE__, __func__);
+		struct memmgr_site_stats **sorted = MALLOC(sizeof(*sorted) * (count + 1), __FILE__, __LINE__, __func__);
+
+		if (totals == NULL || sorted == NULL) {
+			FREE(totals, __FILE__, __LINE__, __func__);
+			FREE(sorted, __FILE__, __LINE__, __func__);
+			FREE(list, __FILE__, __LINE__, __func__);
+			return;
+		}
+		for (i = 0; i < count; i++) {
+			int j;
+			for (j = 0; j < files && strcmp(totals[j].file, list[i]->file) != 0; j++)
+				;
+			if (j == files) {
+				memset(&totals[j], 0, sizeof(totals[j]));
+				totals[j].file = list[i]->file;
+				files++;
+			}
+			totals[j].line++; // Number of sites
+			totals[j].live_count += list[i]->live_count;
+			totals[j].live_bytes += list[i]->live_bytes;
+			totals[j].peak_bytes += list[i]->peak_bytes;
+			totals[j].allocs += list[i]->allocs;
+			totals[j].frees += list[i]->frees;
+		}
+		for (i = 0; i < files; i++)
+			sorted[i] = &totals[i];
+		qsort(sorted, files, sizeof(*sorted), memmgr_site_cmp);
+		for (i = 0; i < files && i < max; i++) {
+			ShowMessage("[malloc] : "CL_WHITE"%s"CL_RESET" (%d sites) %"PRIuS" blocks => %.2f MB (sum of peaks %.2f MB) | %"PRIu64" allocs, %"PRIu64" frees\n",
+				sorted[i]->file, sorted[i]->line, sorted[i]->live_count, (double)sorted[i]->live_bytes / 1024 / 1024,
+				(double)sorted[i]->peak_bytes / 1024 / 1024, sorted[i]->allocs, sorted[i]->frees);
+		}
+		ShowMessage("[malloc] : %d files, %d call sites\n", files, count);
+		FREE(sorted, __FILE__, __LINE__, __func__);
+		FREE(totals, __FILE__, __LINE__, __func__);
+	} else {
+		for (i = 0; i < count && i < max; i++) {
+			ShowMessage("[malloc] : "CL_WHITE"%s"CL_RESET":"CL_WHITE"%d"CL_RESET" (%s) %"PRIuS" blocks => %.2f MB (peak %.2f MB) | %"PRIu64" allocs, %"PRIu64" frees\n",
+				list[i]->file, list[i]->line, list[i]->func, list[i]->live_count, (double)list[i]->live_bytes / 1024 / 1024,
+				(double)list[i]->peak_bytes / 1024 / 1024, list[i]->allocs, list[i]->frees);
+		}
+		ShowMessage("[malloc] : %d call sites\n", count);
+	}
+	ShowMessage("[malloc] : internal usage %.2f MB | %.2f MB\n", (double)((memmgr_usage_bytes_t - memmgr_usage_bytes) / 1024) / 1024, (double)((memmgr_usage_bytes_t) / 1024) / 1024);
+	FREE(list, __FILE__, __LINE__, __func__);
+#else
+	ShowMessage("[malloc] : call site statistics are not available (built with NO_MEMMGR_STATS)\n");
+#endif
+}
+
 /**
  * Initializes the Memory Manager.
  */
@@ -999,6 +1277,31 @@ static size_t malloc_usage(void)
 #endif
 }
 
+/**
+ * Returns unused memory to the system.
+ *
+ * @return the number of bytes released by the memory manager (the system
+ *         allocator is trimmed as well when supported, but doesn't report it)
+ */
+static size_t malloc_trim_memory(void)
+{
+	size_t released = 0;
+#ifdef USE_MEMMGR
+	released = memmgr_trim();
+#endif
+	(void)MEMORY_TRIM();
+	return released;
+}
+
+static int malloc_site_stats(struct memmgr_site_stats *stats, int max)
+{
+#ifdef USE_MEMMGR
+	return memmgr_site_stats(stats, max);
+#else
+	return 0;
+#endif
+}
+
 static void malloc_final(void)
 {
 #ifdef USE_MEMMGR
@@ -1050,6 +1353,8 @@ void malloc_defaults(void)
 	iMalloc->final = malloc_final;
 	iMalloc->memory_check = malloc_memory_check;
 	iMalloc->usage = malloc_usage;
+	iMalloc->trim_memory = malloc_trim_memory;
+	iMalloc->site_stats = malloc_site_stats;
 	iMalloc->verify_ptr = malloc_verify_ptr;
 
 // Athena's built-in Memory Manager
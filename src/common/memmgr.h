@@ -42,6 +42,16 @@
 // Enable memory manager logging by default
 #define LOG_MEMMGR
 
+//////////////////////////////////////////////////////////////////////
+// Live statistics of each allocation call site (file/line of ALC_MARK),
+// kept by the built-in memory manager and shown by the `server mem_sites`
+// and `server mem_subsystems` console commands.
+// Costs a site table lookup per allocation and a pointer per block header,
+// define NO_MEMMGR_STATS (cmake -DENABLE_MEMMGR_STATS=OFF) to leave it out.
+#if defined(USE_MEMMGR) && !defined(NO_MEMMGR_STATS)
+#define MEMMGR_STATS
+#endif
+
 #define aMalloc(size)      (malloc_proxy((size), ALC_MARK))
 #define aCalloc(num, size) (calloc_proxy((num), (size), ALC_MARK))
 #define aFree(p)           (free_proxy((p), ALC_MARK))
@@ -72,6 +82,18 @@
 
 ////////////////////////////////////////////////
 
+/// Statistics of an allocation call site, @see malloc_interface::site_stats
+struct memmgr_site_stats {
+	const char *file;  ///< Source file of the call site
+	const char *func;  ///< Function of the call site (first one seen at this file and line)
+	int line;          ///< Line of the call site
+	size_t live_count; ///< Blocks currently allocated
+	size_t live_bytes; ///< Bytes currently allocated (requested sizes)
+	size_t peak_bytes; ///< Highest live_bytes seen
+	uint64 allocs;     ///< Total allocations
+	uint64 frees;      ///< Total releases
+};
+
 struct malloc_interface {
 	void (*init) (void);
 	void (*final) (void);
@@ -87,6 +109,8 @@ struct malloc_interface {
 	void (*memory_check)(void);
 	bool (*verify_ptr)(void* ptr);
 	size_t (*usage) (void);
+	size_t (*trim_memory) (void);
+	int (*site_stats) (struct memmgr_site_stats *stats, int max);
 	/* */
 	void (*post_shutdown) (void);
 	void (*init_messages) (void);
@@ -103,6 +127,7 @@ char *strndup_proxy(const char *p, size_t size, const char *file, int line, cons
 void malloc_defaults(void);
 
 void memmgr_report(int extra);
+void memmgr_report_sites(int max, bool by_subsystem);
 
 HPShared struct malloc_interface *iMalloc;
 #else
@@ -32,9 +32,9 @@ packetLen(0x2b00, 6)   /* H->M, map_setusers -> 'set the actual usercount? PACKE
 packetLen(0x2b01, -1)  /* M->H, chrif_save -> 'charsave of char XY account XY (complete struct)' */
 packetLen(0x2b02, 18)  /* M->H, chrif_charselectreq -> 'player returns from ingame to charserver to select another char.., this packets includes sessid etc' ? (not 100% sure) */
 packetLen(0x2b03, 7)   /* H->M, clif_charselectok -> '' (i think its the packet after enterworld?) (not sure) */
-packetLen(0x2b04, 0)   /* FREE */
-packetLen(0x2b05, 0)   /* FREE */
-packetLen(0x2b06, 0)   /* FREE */
+packetLen(0x2b04, -1)  /* H->M, chrif_recvmapowners -> 'maps owned by map-server ip:port (ip 0: no map-server)' */
+packetLen(0x2b05, 39)  /* M->H, chrif_changemapserver -> 'char XY moves to a map of another map-server' */
+packetLen(0x2b06, 31)  /* H->M, chrif_changemapserverack -> 'answer of the 2b05' */
 packetLen(0x2b07, 10)  /* M->H, chrif_removefriend -> 'Tell charserver to remove friend_id from char_id friend list' */
 packetLen(0x2b08, 6)   /* M->H, chrif_searchcharid -> '...' */
 packetLen(0x2b09, 30)  /* H->M, map_addchariddb -> 'Adds a name to the nick db' */
@@ -68,14 +68,14 @@ packetLen(0x2b24, 2)   /* H->M, chrif_keepalive_ack. charserver ping reply. */
 packetLen(0x2b25, 14)  /* H->M, chrif_deadopt -> 'Removes baby from Father ID and Mother ID' */
 packetLen(0x2b26, 19)  /* M->H, chrif_authreq -> 'client authentication request' */
 packetLen(0x2b27, 19)  /* H->M, chrif_authfail -> 'client authentication failed' */
-packetLen(0x2b28, 0)   /* FREE */
-packetLen(0x2b29, 0)   /* FREE */
-packetLen(0x2b2a, 0)   /* FREE */
-packetLen(0x2b2b, 0)   /* FREE */
-packetLen(0x2b2c, 0)   /* FREE */
-packetLen(0x2b2d, 0)   /* FREE */
-packetLen(0x2b2e, 0)   /* FREE */
-packetLen(0x2b2f, 0)   /* FREE */
+packetLen(0x2b28, -1)  /* M->H, chrif_save_send -> 'charsave of char XY, delta-encoded and/or compressed' */
+packetLen(0x2b29, 3)   /* M->H, chrif_save_mode_request -> 'save encodings supported by the map-server' */
+packetLen(0x2b2a, 3)   /* H->M, chrif_save_mode_ack -> 'save encodings accepted by the char-server' */
+packetLen(0x2b2b, 10)  /* H->M, chrif_save_resync -> 'delta base lost, send a full snapshot of char XY' */
+packetLen(0x2b2c, 8)   /* M->H, chrif_map_move -> 'move map XY to this map-server' */
+packetLen(0x2b2d, 9)   /* H->M, chrif_map_move_ack -> 'answer of the 2b2c' */
+packetLen(0x2b2e, -1)  /* M->H, chrif_map_state -> 'state of map XY, moved to map-server ip:port' */
+packetLen(0x2b2f, -1)  /* H->M, chrif_recv_map_state -> 'relay of the 2b2e to the new owner' */
 packetLen(0x2b30, 0)   /* FREE */
 packetLen(0x2b31, 0)   /* FREE */
 packetLen(0x2b32, 0)   /* FREE */
@@ -0,0 +1,523 @@
+/**
+ * This file is part of Hercules.
+ * http://herc.ws - http://github.com/HerculesWS/Hercules
+ *
+ * Copyright (C) 2026 Hercules Dev Team
+ *
+ * Hercules is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#define HERCULES_CORE
+
+#include "replay.h"
+
+#include "common/cbasetypes.h"
+#include "common/core.h"
+#include "common/memmgr.h"
+#include "common/mmo.h" // PACKETVER
+#include "common/nullpo.h"
+#include "common/random.h"
+#include "common/showmsg.h"
+#include "common/strlib.h"
+#include "common/timer.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/** @file
+ * Implementation of the trace record and replay interface.
+ */
+
+static struct replay_interface replay_s;
+struct replay_interface *replay;
+
+static const char *replay_record_names[REPLAY_RECORD_MAX] = {
+	"none", "tick", "listen", "accept", "connect", "recv", "eof", "timeout", "parse", "end"
+};
+
+/// Writes a little endian integer of the given size to the trace.
+static void replay_write_le(uint64 value, int size)
+{
+	for (int i = 0; i < size; i++)
+		fputc((int)((value >> (8 * i)) & 0xFF), replay->fp);
+}
+
+/// Reads a little endian integer of the given size from the trace.
+static bool replay_read_le(uint64 *value, int size)
+{
+	*value = 0;
+	for (int i = 0; i < size; i++) {
+		int c = fgetc(replay->fp);
+		if (c == EOF)
+			return false;
+		*value |= (uint64)c << (8 * i);
+	}
+	return true;
+}
+
+/// @copydoc replay_interface::final()
+static void replay_final(void)
+{
+	if (replay->mode != REPLAY_MODE_OFF)
+		replay->stop();
+	aFree(replay->filename);
+	replay->filename = NULL;
+	aFree(replay->buffer);
+	replay->buffer = NULL;
+	replay->buffer_size = 0;
+}
+
+/**
+ * Opens a trace and switches to the given mode.
+ *
+ * Called while parsing the command line, before the server is initialized.
+ * In record mode the rng is reseeded with a seed saved in the trace, in
+ * replay mode with the recorded seed.
+ *
+ * @param mode     REPLAY_MODE_RECORD or REPLAY_MODE_REPLAY.
+ * @param filename Trace file.
+ * @retval false if the trace can't be opened or isn't valid.
+ */
+static bool replay_start(enum replay_mode mode, const char *filename)
+{
+	struct replay_header *header = &replay->header;
+	uint64 value;
+
+	nullpo_retr(false, filename);
+	Assert_retr(false, mode == REPLAY_MODE_RECORD || mode == REPLAY_MODE_REPLAY);
+
+	if (replay->mode != REPLAY_MODE_OFF) {
+		ShowError("replay_start: a trace is already open (%s).\n", replay->filename);
+		return false;
+	}
+
+	if ((replay->fp = fopen(filename, mode == REPLAY_MODE_RECORD ? "wb" : "rb")) == NULL) {
+		ShowError("replay_start: can't open trace file '%s'.\n", filename);
+		return false;
+	}
+	setvbuf(replay->fp, NULL, _IOFBF, REPLAY_BUFFER_SIZE);
+
+	memset(&replay->stats, 0, sizeof(replay->stats));
+	memset(&replay->record, 0, sizeof(replay->record));
+	replay->peeked = false;
+	replay->finished = false;
+
+	if (mode == REPLAY_MODE_RECORD) {
+		memcpy(header->magic, REPLAY_MAGIC, sizeof(header->magic));
+		header->version = REPLAY_VERSION;
+		header->packetver = PACKETVER;
+		header->server_type = (uint32)SERVER_TYPE;
+		rnd->init(); // the core skips it while a trace is open
+		header->seed = (uint32)rnd->random();
+		header->start_time = (int64)time(NULL);
+		header->start_tick = timer->gettick_nocache();
+
+		fwrite(header->magic, 1, sizeof(header->magic), replay->fp);
+		replay_write_le(header->version, 2);
+		replay_write_le(header->packetver, 4);
+		replay_write_le(header->server_type, 4);
+		replay_write_le(header->seed, 4);
+		replay_write_le((uint64)header->start_time, 8);
+		replay_write_le((uint64)header->start_tick, 8);
+	} else {
+		if (fread(header->magic, 1, sizeof(header->magic), replay->fp) != sizeof(header->magic)
+		 || memcmp(header->magic, REPLAY_MAGIC, sizeof(header->magic)) != 0) {
+			ShowError("replay_start: '%s' is not a trace file.\n", filename);
+			fclose(replay->fp);
+			replay->fp = NULL;
+			return false;
+		}
+		if (!replay_read_le(&value, 2) || (header->version = (uint16)value) != REPLAY_VERSION) {
+			ShowError("replay_start: trace '%s' has an unsupported version.\n", filename);
+			fclose(replay->fp);
+			replay->fp = NULL;
+			return false;
+		}
+		if (!replay_read_le(&value, 4) || (header->packetver = (uint32)value, !replay_read_le(&value, 4))
+		 || (header->server_type = (uint32)value, !replay_read_le(&value, 4))
+		 || (header->seed = (uint32)value, !replay_read_le(&value, 8))
+		 || (header->start_time = (int64)value, !replay_read_le(&value, 8))) {
+			ShowError("replay_start: trace '%s' is truncated.\n", filename);
+			fclose(replay->fp);
+			replay->fp = NULL;
+			return false;
+		}
+		header->start_tick = (int64)value;
+
+		if (header->packetver != PACKETVER)
+			ShowWarning("replay_start: trace '%s' was recorded with PACKETVER %u, this server uses %d.\n", filename, header->packetver, PACKETVER);
+		if (header->server_type != (uint32)SERVER_TYPE)
+			ShowWarning("replay_start: trace '%s' was recorded by another server type (%u).\n", filename, header->server_type);
+	}
+
+	rnd->seed(header->seed);
+	srand((unsigned int)header->seed);
+
+	replay->last_tick = header->start_tick;
+	replay->stats.first_tick = header->start_tick;
+	replay->filename = aStrdup(filename);
+	replay->mode = mode;
+
+	ShowStatus("%s trace '"CL_WHITE"%s"CL_RESET"' (seed %u).\n", mode == REPLAY_MODE_RECORD ? "Recording" : "Replaying", filename, header->seed);
+	return true;
+}
+
+/// @copydoc replay_interface::stop()
+static void replay_stop(void)
+{
+	if (replay->mode == REPLAY_MODE_OFF)
+		return;
+
+	if (replay->mode == REPLAY_MODE_RECORD)
+		replay->write_record(REPLAY_RECORD_END, -1);
+	replay->report();
+
+	fclose(replay->fp);
+	replay->fp = NULL;
+	replay->mode = REPLAY_MODE_OFF;
+}
+
+/// Shows how much was recorded or replayed.
+static void replay_report(void)
+{
+	const struct replay_stats *stats = &replay->stats;
+	int64 traced = replay->last_tick - stats->first_tick;
+	int64 real = stats->real_last - stats->real_start;
+	StringBuf buf;
+
+	StrBuf->Init(&buf);
+	for (int i = REPLAY_RECORD_TICK; i < REPLAY_RECORD_END; i++) {
+		if (stats->records[i] != 0)
+			StrBuf->Printf(&buf, " %s:%"PRIu64, replay_record_names[i], stats->records[i]);
+	}
+
+	if (replay->mode == REPLAY_MODE_RECORD) {
+		ShowStatus("Recorded %"PRId64" ms into '"CL_WHITE"%s"CL_RESET"' (%ld KiB, %"PRIu64" KiB received).\n",
+			traced, replay->filename, ftell(replay->fp) / 1024, stats->recv_bytes / 1024);
+	} else {
+		ShowStatus("Replayed %"PRId64" ms of '"CL_WHITE"%s"CL_RESET"' in %"PRId64" ms (%"PRIu64" KiB received, %"PRIu64" KiB sent and discarded).\n",
+			traced, replay->filename, real, stats->recv_bytes / 1024, stats->sent_bytes / 1024);
+		if (stats->divergences != 0)
+			ShowWarning("Replay diverged from the trace %"PRIu64" times, the results may not match the recorded run.\n", stats->divergences);
+		if (!replay->finished)
+			ShowWarning("Replay stopped before the end of the trace.\n");
+	}
+	ShowInfo("Trace records:%s\n", StrBuf->Value(&buf));
+	StrBuf->Destroy(&buf);
+}
+
+/**
+ * Timer tick hook, called by timer->gettick.
+ *
+ * @param real_tick Tick of the system clock.
+ * @return the tick the server must use.
+ */
+static int64 replay_tick(int64 real_tick)
+{
+	if (replay->stats.real_start == 0)
+		replay->stats.real_start = real_tick;
+	replay->stats.real_last = real_tick;
+
+	if (replay->mode == REPLAY_MODE_RECORD) {
+		int64 delta = real_tick - replay->last_tick;
+		fputc(REPLAY_RECORD_TICK, replay->fp);
+		replay->write_varint(((uint64)delta << 1) ^ (uint64)(delta >> 63)); // zigzag
+		replay->last_tick = real_tick;
+		replay->stats.records[REPLAY_RECORD_TICK]++;
+		return real_tick;
+	}
+
+	if (replay->mode == REPLAY_MODE_REPLAY && !replay->finished) {
+		const struct replay_record *rec = replay->peek();
+		if (rec->type == REPLAY_RECORD_TICK)
+			replay->consume();
+		else if (rec->type != REPLAY_RECORD_END)
+			replay->stats.divergences++;
+	}
+	return replay->last_tick;
+}
+
+/// @copydoc replay_interface::write_varint()
+static void replay_write_varint(uint64 value)
+{
+	while (value >= 0x80) {
+		fputc((int)(value & 0x7F) | 0x80, replay->fp);
+		value >>= 7;
+	}
+	fputc((int)value, replay->fp);
+}
+
+/// Writes the type of a record and its fd, if the record has one.
+static void replay_write_record(enum replay_record_type type, int fd)
+{
+	fputc(type, replay->fp);
+	if (fd >= 0)
+		replay->write_varint((uint64)fd);
+	replay->stats.records[type]++;
+}
+
+/// @copydoc replay_interface::record_listen()
+static void replay_record_listen(int fd, uint32 ip, uint16 port)
+{
+	if (replay->mode != REPLAY_MODE_RECORD)
+		return;
+	replay->write_record(REPLAY_RECORD_LISTEN, fd);
+	replay_write_le(ip, 4);
+	replay_write_le(port, 2);
+}
+
+/// @copydoc replay_interface::record_accept()
+static void replay_record_accept(int listen_fd, int fd, uint32 ip)
+{
+	if (replay->mode != REPLAY_MODE_RECORD)
+		return;
+	replay->write_record(REPLAY_RECORD_ACCEPT, listen_fd);
+	replay->write_varint((uint64)fd);
+	replay_write_le(ip, 4);
+}
+
+/// @copydoc replay_interface::record_connect()
+static void replay_record_connect(int fd, uint32 ip, uint16 port)
+{
+	if (replay->mode != REPLAY_MODE_RECORD)
+		return;
+	replay->write_record(REPLAY_RECORD_CONNECT, fd);
+	replay_write_le(ip, 4);
+	replay_write_le(port, 2);
+}
+
+/// @copydoc replay_interface::record_recv()
+static void replay_record_recv(int fd, const uint8 *data, size_t len)
+{
+	if (replay->mode != REPLAY_MODE_RECORD || len == 0)
+		return;
+	nullpo_retv(data);
+	replay->write_record(REPLAY_RECORD_RECV, fd);
+	replay->write_varint((uint64)len);
+	fwrite(data, 1, len, replay->fp);
+	replay->stats.recv_bytes += len;
+}
+
+/// @copydoc replay_interface::record_eof()
+static void replay_record_eof(int fd)
+{
+	if (replay->mode != REPLAY_MODE_RECORD)
+		return;
+	replay->write_record(REPLAY_RECORD_EOF, fd);
+}
+
+/// @copydoc replay_interface::record_timeout()
+static void replay_record_timeout(int fd)
+{
+	if (replay->mode != REPLAY_MODE_RECORD)
+		return;
+	replay->write_record(REPLAY_RECORD_TIMEOUT, fd);
+}
+
+/// @copydoc replay_interface::record_parse()
+static void replay_record_parse(void)
+{
+	if (replay->mode != REPLAY_MODE_RECORD)
+		return;
+	replay->write_record(REPLAY_RECORD_PARSE, -1);
+}
+
+/// @copydoc replay_interface::read_varint()
+static bool replay_read_varint(uint64 *value)
+{
+	int shift = 0;
+
+	nullpo_retr(false, value);
+	*value = 0;
+	while (shift < 64) {
+		int c = fgetc(replay->fp);
+		if (c == EOF)
+			return false;
+		*value |= (uint64)(c & 0x7F) << shift;
+		if ((c & 0x80) == 0)
+			return true;
+		shift += 7;
+	}
+	return false;
+}
+
+/**
+ * Reads the next record of the trace without consuming it.
+ *
+ * At the end of the trace (or if it is truncated) the replay is ended and a
+ * REPLAY_RECORD_END record is returned from then on.
+ */
+static const struct replay_record *replay_peek(void)
+{
+	struct replay_record *rec = &replay->record;
+	uint64 a = 0, b = 0, c = 0;
+	bool ok = true;
+	int type;
+
+	if (replay->peeked)
+		return rec;
+	if (replay->finished) {
+		rec->type = REPLAY_RECORD_END;
+		return rec;
+	}
+
+	memset(rec, 0, sizeof(*rec));
+	rec->fd = -1;
+	if ((type = fgetc(replay->fp)) == EOF || type <= REPLAY_RECORD_NONE || type >= REPLAY_RECORD_MAX)
+		type = REPLAY_RECORD_END;
+	rec->type = (enum replay_record_type)type;
+
+	switch (rec->type) {
+	case REPLAY_RECORD_TICK:
+		if ((ok = replay->read_varint(&a)))
+			rec->tick = replay->last_tick + (int64)((a >> 1) ^ (~(a & 1) + 1)); // zigzag
+		break;
+	case REPLAY_RECORD_LISTEN:
+	case REPLAY_RECORD_CONNECT:
+		ok = replay->read_varint(&a) && replay_read_le(&b, 4) && replay_read_le(&c, 2);
+		rec->fd = (int)a;
+		rec->ip = (uint32)b;
+		rec->port = (uint16)c;
+		break;
+	case REPLAY_RECORD_ACCEPT:
+		ok = replay->read_varint(&a) && replay->read_varint(&b) && replay_read_le(&c, 4);
+		rec->listen_fd = (int)a;
+		rec->fd = (int)b;
+		rec->ip = (uint32)c;
+		break;
+	case REPLAY_RECORD_RECV:
+		if (!(ok = replay->read_varint(&a) && replay->read_varint(&b) && b <= UINT32_MAX))
+			break;
+		rec->fd = (int)a;
+		rec->len = (uint32)b;
+		if (rec->len > replay->buffer_size) {
+			replay->buffer_size = rec->len;
+			RECREATE(replay->buffer, uint8, replay->buffer_size);
+		}
+		rec->data = replay->buffer;
+		ok = fread(rec->data, 1, rec->len, replay->fp) == rec->len;
+		break;
+	case REPLAY_RECORD_EOF:
+	case REPLAY_RECORD_TIMEOUT:
+		ok = replay->read_varint(&a);
+		rec->fd = (int)a;
+		break;
+	case REPLAY_RECORD_NONE:
+	case REPLAY_RECORD_PARSE:
+	case REPLAY_RECORD_END:
+	case REPLAY_RECORD_MAX:
+		break;
+	}
+
+	if (!ok) {
+		ShowWarning("replay_peek: trace '%s' is truncated.\n", replay->filename);
+		rec->type = REPLAY_RECORD_END;
+	}
+	if (rec->type == REPLAY_RECORD_END) {
+		replay->end();
+		return rec;
+	}
+	replay->peeked = true;
+	return rec;
+}
+
+/// Consumes the record returned by replay->peek.
+static void replay_consume(void)
+{
+	const struct replay_record *rec = &replay->record;
+
+	if (!replay->peeked)
+		return;
+	replay->peeked = false;
+	replay->stats.records[rec->type]++;
+	if (rec->type == REPLAY_RECORD_TICK)
+		replay->last_tick = rec->tick;
+	else if (rec->type == REPLAY_RECORD_RECV)
+		replay->stats.recv_bytes += rec->len;
+}
+
+/**
+ * Consumes the next record if it has the expected type.
+ *
+ * Ticks read by the recorded run that have no counterpart in the replay are
+ * skipped (and counted as divergences) so that the socket layer stays in step.
+ *
+ * @return the consumed record, valid until the next read, or NULL if the
+ *         trace doesn't match.
+ */
+static const struct replay_record *replay_expect(enum replay_record_type type)
+{
+	const struct replay_record *rec = replay->peek();
+
+	while (type != REPLAY_RECORD_TICK && rec->type == REPLAY_RECORD_TICK) {
+		replay->consume();
+		replay->stats.divergences++;
+		rec = replay->peek();
+	}
+	if (rec->type != type) {
+		if (rec->type != REPLAY_RECORD_END)
+			replay->stats.divergences++;
+		return NULL;
+	}
+	replay->consume();
+	return rec;
+}
+
+/// Ends the replay and stops the server once the trace is exhausted.
+static void replay_end(void)
+{
+	if (replay->finished)
+		return;
+	replay->finished = true;
+	replay->peeked = false;
+	ShowStatus("End of trace '"CL_WHITE"%s"CL_RESET"' reached, shutting down.\n", replay->filename);
+	core->runflag = CORE_ST_STOP;
+}
+
+void replay_defaults(void)
+{
+	replay = &replay_s;
+
+	replay->mode = REPLAY_MODE_OFF;
+	replay->filename = NULL;
+	replay->fp = NULL;
+	memset(&replay->header, 0, sizeof(replay->header));
+	memset(&replay->stats, 0, sizeof(replay->stats));
+	replay->last_tick = 0;
+	memset(&replay->record, 0, sizeof(replay->record));
+	replay->peeked = false;
+	replay->buffer = NULL;
+	replay->buffer_size = 0;
+	replay->finished = false;
+
+	replay->final = replay_final;
+	replay->start = replay_start;
+	replay->stop = replay_stop;
+	replay->report = replay_report;
+	replay->tick = replay_tick;
+	replay->write_varint = replay_write_varint;
+	replay->write_record = replay_write_record;
+	replay->record_listen = replay_record_listen;
+	replay->record_accept = replay_record_accept;
+	replay->record_connect = replay_record_connect;
+	replay->record_recv = replay_record_recv;
+	replay->record_eof = replay_record_eof;
+	replay->record_timeout = replay_record_timeout;
+	replay->record_parse = replay_record_parse;
+	replay->read_varint = replay_read_varint;
+	replay->peek = replay_peek;
+	replay->consume = replay_consume;
+	replay->expect = replay_expect;
+	replay->end = replay_end;
+}
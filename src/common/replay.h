@@ -0,0 +1,148 @@
+/**
+ * This file is part of Hercules.
+ * http://herc.ws - http://github.com/HerculesWS/Hercules
+ *
+ * Copyright (C) 2026 Hercules Dev Team
+ *
+ * Hercules is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef COMMON_REPLAY_H
+#define COMMON_REPLAY_H
+
+#include "common/hercules.h"
+
+#include <stdio.h>
+
+/** @file
+ * Deterministic record and replay of a server run.
+ *
+ * In record mode (--trace-record <file>) the rng seed, every tick read by
+ * timer->gettick and everything the socket layer sees (new connections, data
+ * received, disconnections, timeouts) are written to a binary trace.
+ * In replay mode (--trace-replay <file>) the server runs without real
+ * sockets: the socket layer creates the recorded sessions and feeds them the
+ * recorded data, and timer->gettick returns the recorded ticks, so timers and
+ * packet parsing run in the same order as in the recorded run, as fast as the
+ * build allows. Data sent by the server is discarded.
+ *
+ * Results of SQL queries and time(NULL) aren't recorded: replay against a copy
+ * of the database taken when the recording started. Reads that don't match the
+ * trace are counted as divergences.
+ */
+
+#define REPLAY_MAGIC "HRCT"
+#define REPLAY_VERSION 1
+#define REPLAY_BUFFER_SIZE (1024 * 1024) ///< stdio buffer of the trace file
+
+/// Mode of the replay interface.
+enum replay_mode {
+	REPLAY_MODE_OFF = 0,
+	REPLAY_MODE_RECORD,
+	REPLAY_MODE_REPLAY,
+};
+
+/// Record types of the trace, fields are varints unless noted.
+enum replay_record_type {
+	REPLAY_RECORD_NONE = 0,
+	REPLAY_RECORD_TICK,    ///< timer tick read: <zigzag delta from the previous tick>
+	REPLAY_RECORD_LISTEN,  ///< listening socket: <fd> <ip>.L <port>.W
+	REPLAY_RECORD_ACCEPT,  ///< incoming connection: <listen fd> <fd> <ip>.L
+	REPLAY_RECORD_CONNECT, ///< outgoing connection: <fd, 0 if it failed> <ip>.L <port>.W
+	REPLAY_RECORD_RECV,    ///< data received: <fd> <len> <data>
+	REPLAY_RECORD_EOF,     ///< connection closed by the peer: <fd>
+	REPLAY_RECORD_TIMEOUT, ///< stall timeout of a session: <fd>
+	REPLAY_RECORD_PARSE,   ///< end of the receive phase of sockt->perform
+	REPLAY_RECORD_END,
+	REPLAY_RECORD_MAX
+};
+
+/// Header of a trace file, written field by field in little endian.
+struct replay_header {
+	char magic[4];
+	uint16 version;
+	uint32 packetver;   ///< PACKETVER of the recording build
+	uint32 server_type; ///< SERVER_TYPE of the recording server
+	uint32 seed;        ///< rng seed
+	int64 start_time;   ///< time(NULL) when the recording started
+	int64 start_tick;   ///< first tick, TICK records are relative to it
+};
+
+/// Record read from the trace.
+struct replay_record {
+	enum replay_record_type type;
+	int fd;
+	int listen_fd;
+	uint32 ip;
+	uint16 port;
+	int64 tick;
+	uint32 len;
+	uint8 *data;        ///< RECV payload, valid until the next record is read
+};
+
+struct replay_stats {
+	uint64 records[REPLAY_RECORD_MAX];
+	uint64 recv_bytes;
+	uint64 sent_bytes;  ///< data discarded by the replay sessions
+	uint64 divergences; ///< reads that didn't match the trace
+	int64 first_tick;   ///< first recorded tick
+	int64 real_start;   ///< real tick at the first tick read
+	int64 real_last;    ///< real tick at the last tick read
+};
+
+/**
+ * Replay.c Interface
+ **/
+struct replay_interface {
+	enum replay_mode mode;
+	char *filename;
+	FILE *fp;
+	struct replay_header header;
+	struct replay_stats stats;
+	int64 last_tick;            ///< last recorded or replayed tick
+	struct replay_record record; ///< next record of the trace (replay mode)
+	bool peeked;                ///< record holds a record not consumed yet
+	uint8 *buffer;              ///< storage of record.data
+	uint32 buffer_size;
+	bool finished;              ///< the end of the trace was reached
+
+	void (*final) (void);
+	bool (*start) (enum replay_mode mode, const char *filename);
+	void (*stop) (void);
+	void (*report) (void);
+	int64 (*tick) (int64 real_tick);
+	/* record mode */
+	void (*write_varint) (uint64 value);
+	void (*write_record) (enum replay_record_type type, int fd);
+	void (*record_listen) (int fd, uint32 ip, uint16 port);
+	void (*record_accept) (int listen_fd, int fd, uint32 ip);
+	void (*record_connect) (int fd, uint32 ip, uint16 port);
+	void (*record_recv) (int fd, const uint8 *data, size_t len);
+	void (*record_eof) (int fd);
+	void (*record_timeout) (int fd);
+	void (*record_parse) (void);
+	/* replay mode */
+	bool (*read_varint) (uint64 *value);
+	const struct replay_record *(*peek) (void);
+	void (*consume) (void);
+	const struct replay_record *(*expect) (enum replay_record_type type);
+	void (*end) (void);
+};
+
+#ifdef HERCULES_CORE
+void replay_defaults(void);
+#endif // HERCULES_CORE
+
+HPShared struct replay_interface *replay;
+
+#endif /* COMMON_REPLAY_H */
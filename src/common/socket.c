@@ -31,6 +31,7 @@
 #include "common/mmo.h"
 #include "common/nullpo.h"
 #include "common/packets.h"
+#include "common/replay.h"
 #include "common/showmsg.h"
 #include "common/strlib.h"
 #include "common/timer.h"
@@ -307,7 +308,6 @@ static uint32 send_shortlist_set[(MAXCONN + 31) / 32]; // to know if specific fd
 #endif  // SEND_SHORTLIST
 
 static int ip_rules = 1;
-static int connect_check(uint32 ip);
 
 static const char *error_msg(void)
 {
@@ -467,6 +467,7 @@ static int recv_to_fifo(int fd)
 	{//An exception has occurred
 		if( sErrno != S_EWOULDBLOCK ) {
 			//ShowDebug("recv_to_fifo: %s, closing connection #%d\n", error_msg(), fd);
+			replay->record_eof(fd);
 			sockt->eof(fd);
 		}
 		return 0;
@@ -474,10 +475,12 @@ static int recv_to_fifo(int fd)
 
 	if( len == 0 )
 	{//Normal connection end.
+		replay->record_eof(fd);
 		sockt->eof(fd);
 		return 0;
 	}
 
+	replay->record_recv(fd, sockt->session[fd]->rdata + sockt->session[fd]->rdata_size, (size_t)len);
 	sockt->session[fd]->rdata_size += len;
 	sockt->session[fd]->rdata_tick = sockt->last_tick;
 #ifdef SHOW_SERVER_STATS
@@ -511,6 +514,7 @@ static int send_from_fifo(int fd)
 			socket_data_qo -= sockt->session[fd]->wdata_size;
 #endif  // SHOW_SERVER_STATS
 			sockt->session[fd]->wdata_size = 0; //Clear the send queue as we can't send anymore. [Skotlex]
+			replay->record_eof(fd);
 			sockt->eof(fd);
 		}
 		return 0;
@@ -552,6 +556,146 @@ static void flush_fifos(void)
 		sockt->flush(i);
 }
 
+/*======================================
+ * CORE : Replay of a trace (see common/replay.h)
+ *--------------------------------------*/
+/// Discards the data sent to a replayed session.
+static int replay_send(int fd)
+{
+	if (!sockt->session_is_valid(fd))
+		return -1;
+
+	replay->stats.sent_bytes += sockt->session[fd]->wdata_size;
+	sockt->session[fd]->wdata_size = 0;
+	return 0;
+}
+
+/// Creates the session of a recorded listening socket.
+static int replay_listen(uint32 ip, uint16 port)
+{
+	const struct replay_record *rec = replay->expect(REPLAY_RECORD_LISTEN);
+
+	if (rec == NULL || rec->fd <= 0 || rec->fd >= MAXCONN || sockt->session[rec->fd] != NULL) {
+		ShowError("replay_listen: listening socket on port %u is not in the trace.\n", port);
+		return -1;
+	}
+
+	if (sockt->fd_max <= rec->fd) sockt->fd_max = rec->fd + 1;
+	sockt->create_session(rec->fd, null_recv, null_send, null_parse, null_client_connected, null_delete);
+	sockt->session[rec->fd]->client_addr = 0; // just listens
+	sockt->session[rec->fd]->rdata_tick = 0; // disable timeouts on this socket
+	sockt->session[rec->fd]->wdata_tick = 0;
+	return rec->fd;
+}
+
+/// Creates the session of a recorded outgoing connection.
+static int replay_connect(uint32 ip, uint16 port, struct hSockOpt *opt)
+{
+	const struct replay_record *rec = replay->expect(REPLAY_RECORD_CONNECT);
+
+	if (rec == NULL || rec->fd <= 0 || rec->fd >= MAXCONN || sockt->session[rec->fd] != NULL) {
+		if( !( opt && opt->silent ) )
+			ShowError("replay_connect: connection to %u.%u.%u.%u:%u failed in the trace.\n", CONVIP(ip), port);
+		return -1;
+	}
+	if (rec->ip != ip || rec->port != port)
+		replay->stats.divergences++;
+
+	if (sockt->fd_max <= rec->fd) sockt->fd_max = rec->fd + 1;
+	sockt->create_session(rec->fd, null_recv, replay_send, default_func_parse, null_parse, null_delete);
+	sockt->session[rec->fd]->client_addr = ip;
+	return rec->fd;
+}
+
+/// Creates the session of a recorded incoming connection.
+static void replay_accept(int fd, uint32 ip)
+{
+	if (fd <= 0 || fd >= MAXCONN || sockt->session[fd] != NULL) {
+		replay->stats.divergences++;
+		return;
+	}
+
+	if (sockt->fd_max <= fd) sockt->fd_max = fd + 1;
+	sockt->create_session(fd, null_recv, replay_send, default_func_parse, default_func_client_connected, default_func_delete);
+	sockt->session[fd]->client_addr = ip;
+	sockt->session[fd]->flag.validate = sockt->validate;
+	sockt->session[fd]->func_client_connected(fd);
+}
+
+/// Copies recorded data to the receive queue of a session.
+static void replay_recv(int fd, const uint8 *data, uint32 len)
+{
+	if (!sockt->session_is_active(fd)) {
+		replay->stats.divergences++;
+		return;
+	}
+	if (len > RFIFOSPACE(fd)) { // the queue was parsed differently
+		replay->stats.divergences++;
+		sockt->realloc_fifo(fd, (unsigned int)(sockt->session[fd]->rdata_size + len), (unsigned int)sockt->session[fd]->max_wdata);
+	}
+
+	memcpy(sockt->session[fd]->rdata + sockt->session[fd]->rdata_size, data, len);
+	sockt->session[fd]->rdata_size += len;
+	sockt->session[fd]->rdata_tick = sockt->last_tick;
+}
+
+/// Feeds the recorded socket events of one receive phase to the sessions.
+static void replay_receive(void)
+{
+	while (!replay->finished) {
+		const struct replay_record *rec = replay->peek();
+
+		if (rec->type == REPLAY_RECORD_END)
+			break;
+		replay->consume(); // rec stays valid until the next peek
+
+		switch (rec->type) {
+		case REPLAY_RECORD_PARSE:
+			return;
+		case REPLAY_RECORD_ACCEPT:
+			replay_accept(rec->fd, rec->ip);
+			break;
+		case REPLAY_RECORD_RECV:
+			replay_recv(rec->fd, rec->data, rec->len);
+			break;
+		case REPLAY_RECORD_EOF:
+			sockt->eof(rec->fd);
+			break;
+		case REPLAY_RECORD_TICK:
+			break; // read while accepting connections (ip rules)
+		case REPLAY_RECORD_NONE:
+		case REPLAY_RECORD_LISTEN:
+		case REPLAY_RECORD_CONNECT:
+		case REPLAY_RECORD_TIMEOUT:
+		case REPLAY_RECORD_END:
+		case REPLAY_RECORD_MAX:
+			replay->stats.divergences++;
+			break;
+		}
+	}
+}
+
+/**
+ * Checks whether a session stalled.
+ * Recorded as a timeout record, a replay uses the recorded timeouts instead
+ * of the clock.
+ */
+static bool socket_stalled(int fd)
+{
+	if (replay->mode == REPLAY_MODE_REPLAY) {
+		const struct replay_record *rec = replay->peek();
+		if (rec->type != REPLAY_RECORD_TIMEOUT || rec->fd != fd)
+			return false;
+		replay->consume();
+		return true;
+	}
+
+	if (sockt->session[fd]->rdata_tick == 0 || DIFF_TICK(sockt->last_tick, sockt->session[fd]->rdata_tick) <= sockt->stall_time)
+		return false;
+	replay->record_timeout(fd);
+	return true;
+}
+
 /*======================================
  * CORE : Connection functions
  *--------------------------------------*/
@@ -582,7 +726,7 @@ static int connect_client(int listen_fd)
 	setsocketopts(fd,NULL);
 	sockt->set_nonblocking(fd, 1);
 
-	if( ip_rules && !connect_check(ntohl(client_address.sin_addr.s_addr)) ) {
+	if( ip_rules && !sockt->connect_check(ntohl(client_address.sin_addr.s_addr)) ) {
 		sockt->close(fd);
 		return -1;
 	}
@@ -609,6 +753,7 @@ static int connect_client(int listen_fd)
 	sockt->create_session(fd, recv_to_fifo, send_from_fifo, default_func_parse, default_func_client_connected, default_func_delete);
 	sockt->session[fd]->client_addr = ntohl(client_address.sin_addr.s_addr);
 	sockt->session[fd]->flag.validate = sockt->validate;
+	replay->record_accept(listen_fd, fd, sockt->session[fd]->client_addr);
 	sockt->session[fd]->func_client_connected(fd);
 	return fd;
 }
@@ -619,6 +764,9 @@ static int make_listen_bind(uint32 ip, uint16 port)
 	int fd;
 	int result;
 
+	if (replay->mode == REPLAY_MODE_REPLAY)
+		return replay_listen(ip, port);
+
 	fd = sSocket(AF_INET, SOCK_STREAM, 0);
 
 	if( fd == -1 ) {
@@ -679,6 +827,7 @@ static int make_listen_bind(uint32 ip, uint16 port)
 	sockt->session[fd]->client_addr = 0; // just listens
 	sockt->session[fd]->rdata_tick = 0; // disable timeouts on this socket
 	sockt->session[fd]->wdata_tick = 0;
+	replay->record_listen(fd, ip, port);
 	return fd;
 }
 
@@ -688,6 +837,9 @@ static int make_connection(uint32 ip, uint16 port, struct hSockOpt *opt)
 	int fd;
 	int result;
 
+	if (replay->mode == REPLAY_MODE_REPLAY)
+		return replay_connect(ip, port, opt);
+
 	fd = sSocket(AF_INET, SOCK_STREAM, 0);
 
 	if (fd == -1) {
@@ -718,6 +870,7 @@ static int make_connection(uint32 ip, uint16 port, struct hSockOpt *opt)
 	if( result == SOCKET_ERROR ) {
 		if( !( opt && opt->silent ) )
 			ShowError("make_connection: connect failed (socket #%d, %s)!\n", fd, error_msg());
+		replay->record_connect(0, ip, port);
 		sockt->close(fd);
 		return -1;
 	}
@@ -746,6 +899,7 @@ static int make_connection(uint32 ip, uint16 port, struct hSockOpt *opt)
 
 	sockt->create_session(fd, recv_to_fifo, send_from_fifo, default_func_parse, null_parse, null_delete);
 	sockt->session[fd]->client_addr = ntohl(remote_address.sin_addr.s_addr);
+	replay->record_connect(fd, ip, port);
 
 	return fd;
 }
@@ -962,7 +1116,9 @@ static void wfifohead(int fd, size_t len)
 		sockt->realloc_writefifo(fd, len);
 }
 
-static int do_sockets(int next)
+/// Waits for socket events until the next timer and receives the incoming data.
+/// @retval false if interrupted by a signal.
+static bool socket_receive(int next)
 {
 #ifndef SOCKET_EPOLL
 	fd_set rfd;
@@ -970,20 +1126,6 @@ static int do_sockets(int next)
 #endif  // SOCKET_EPOLL
 	int ret,i;
 
-	// PRESEND Timers are executed before do_sendrecv and can send packets and/or set sessions to eof.
-	// Send remaining data and process client-side disconnects here.
-#ifdef SEND_SHORTLIST
-	send_shortlist_do_sends();
-#else  // SEND_SHORTLIST
-	for (i = 1; i < sockt->fd_max; i++) {
-		if (sockt->session[i] == NULL)
-			continue;
-
-		if (sockt->session[i]->wdata_size > 0)
-			sockt->session[i]->func_send(i);
-	}
-#endif  // SEND_SHORTLIST
-
 #ifndef SOCKET_EPOLL
 	// Select based Event Dispatcher:
 
@@ -1001,7 +1143,7 @@ static int do_sockets(int next)
 			ShowFatalError("do_sockets: select() failed, %s!\n", error_msg());
 			exit(EXIT_FAILURE);
 		}
-		return 0; // interrupted by a signal, just loop and try again
+		return false; // interrupted by a signal
 	}
 #else  // SOCKET_EPOLL
 	// Epoll based Event Dispatcher
@@ -1014,7 +1156,7 @@ static int do_sockets(int next)
 			ShowFatalError("do_sockets: epoll_wait() failed, %s!\n", error_msg());
 			exit(EXIT_FAILURE);
 		}
-		return 0; // interrupted by a signal, just loop and try again
+		return false; // interrupted by a signal
 	}
 #endif  // SOCKET_EPOLL
 
@@ -1044,6 +1186,7 @@ static int do_sockets(int next)
 			(!(it->events & EPOLLIN)))
 		{
 			// Got Error on this connection
+			replay->record_eof(it->data.fd);
 			sockt->eof( it->data.fd );
 
 		} else if (it->events & EPOLLIN) {
@@ -1066,6 +1209,35 @@ static int do_sockets(int next)
 	}
 #endif  // defined(SOCKET_EPOLL)
 
+	return true;
+}
+
+static int do_sockets(int next)
+{
+	int i;
+
+	// PRESEND Timers are executed before do_sendrecv and can send packets and/or set sessions to eof.
+	// Send remaining data and process client-side disconnects here.
+#ifdef SEND_SHORTLIST
+	send_shortlist_do_sends();
+#else  // SEND_SHORTLIST
+	for (i = 1; i < sockt->fd_max; i++) {
+		if (sockt->session[i] == NULL)
+			continue;
+
+		if (sockt->session[i]->wdata_size > 0)
+			sockt->session[i]->func_send(i);
+	}
+#endif  // SEND_SHORTLIST
+
+	if (replay->mode == REPLAY_MODE_REPLAY) {
+		sockt->last_tick = time(NULL);
+		replay_receive();
+	} else if (!socket_receive(next)) {
+		return 0; // interrupted by a signal, just loop and try again
+	}
+	replay->record_parse();
+
 	// POSTSEND Send remaining data and handle eof sessions.
 #ifdef SEND_SHORTLIST
 	send_shortlist_do_sends();
@@ -1091,7 +1263,7 @@ static int do_sockets(int next)
 		if(!sockt->session[i])
 			continue;
 
-		if (sockt->session[i]->rdata_tick && DIFF_TICK(sockt->last_tick, sockt->session[i]->rdata_tick) > sockt->stall_time) {
+		if (socket_stalled(i)) {
 			if( sockt->session[i]->flag.server ) {/* server is special */
 				if( sockt->session[i]->flag.ping != 2 )/* only update if necessary otherwise it'd resend the ping unnecessarily */
 					sockt->session[i]->flag.ping = 1;
@@ -1136,34 +1308,22 @@ static int do_sockets(int next)
 
 // IP rules and DDoS protection
 
-struct connect_history {
-	uint32 ip;
-	int64 tick;
-	int count;
-	unsigned ddos : 1;
-};
-
-struct access_control {
-	uint32 ip;
-	uint32 mask;
-};
-
-VECTOR_STRUCT_DECL(access_control_list, struct access_control);
-
 enum aco {
 	ACO_DENY_ALLOW,
 	ACO_ALLOW_DENY,
 	ACO_MUTUAL_FAILURE
 };
 
-static struct access_control_list access_allow;
-static struct access_control_list access_deny;
+#define ACCESS_PREFIX_MASK(len) ((len) == 0 ? 0 : 0xFFFFFFFFU << (32 - (len)))
+#define ACCESS_PREFIX_BIT(ip, pos) (((ip) >> (31 - (pos))) & 1)
+#define CONNECT_HISTORY_EVICT_WINDOW 32 ///< Slots looked at to find an entry to replace when the history is full
+
 static int access_order    = ACO_DENY_ALLOW;
 static int access_debug    = 0;
 static int ddos_count      = 10;
 static int ddos_interval   = 3*1000;
 static int ddos_autoreset  = 10*60*1000;
-static struct DBMap *connect_history = NULL;
+static int ddos_history_size = 16384;
 
 static int connect_check_(uint32 ip);
 
@@ -1184,38 +1344,31 @@ static int connect_check(uint32 ip)
 static int connect_check_(uint32 ip)
 {
 	struct connect_history *hist = NULL;
-	int i;
+	struct s_subnet match;
+	int64 tick;
 	int is_allowip = 0;
 	int is_denyip = 0;
 	int connect_ok = 0;
 
 	// Search the allow list
-	for (i = 0; i < VECTOR_LENGTH(access_allow); ++i) {
-		struct access_control *entry = &VECTOR_INDEX(access_allow, i);
-		if (SUBNET_MATCH(ip, entry->ip, entry->mask)) {
-			if (access_debug) {
-				ShowInfo("connect_check: Found match from allow list:%u.%u.%u.%u IP:%u.%u.%u.%u Mask:%u.%u.%u.%u\n",
-					CONVIP(ip),
-					CONVIP(entry->ip),
-					CONVIP(entry->mask));
-			}
-			is_allowip = 1;
-			break;
+	if (sockt->access_list_match(&sockt->access_allow, ip, &match)) {
+		if (access_debug) {
+			ShowInfo("connect_check: Found match from allow list:%u.%u.%u.%u IP:%u.%u.%u.%u Mask:%u.%u.%u.%u\n",
+				CONVIP(ip),
+				CONVIP(match.ip),
+				CONVIP(match.mask));
 		}
+		is_allowip = 1;
 	}
 	// Search the deny list
-	for (i = 0; i < VECTOR_LENGTH(access_deny); ++i) {
-		struct access_control *entry = &VECTOR_INDEX(access_deny, i);
-		if (SUBNET_MATCH(ip, entry->ip, entry->mask)) {
-			if (access_debug) {
-				ShowInfo("connect_check: Found match from deny list:%u.%u.%u.%u IP:%u.%u.%u.%u Mask:%u.%u.%u.%u\n",
-					CONVIP(ip),
-					CONVIP(entry->ip),
-					CONVIP(entry->mask));
-			}
-			is_denyip = 1;
-			break;
+	if (sockt->access_list_match(&sockt->access_deny, ip, &match)) {
+		if (access_debug) {
+			ShowInfo("connect_check: Found match from deny list:%u.%u.%u.%u IP:%u.%u.%u.%u Mask:%u.%u.%u.%u\n",
+				CONVIP(ip),
+				CONVIP(match.ip),
+				CONVIP(match.mask));
 		}
+		is_denyip = 1;
 	}
 	// Decide connection status
 	//  0 : Reject
@@ -1248,11 +1401,12 @@ static int connect_check_(uint32 ip)
 	}
 
 	// Inspect connection history
-	if( ( hist = uidb_get(connect_history, ip)) ) { //IP found
+	tick = timer->gettick();
+	if ((hist = sockt->connect_history_find(&sockt->connect_history, ip)) != NULL) { //IP found
 		if( hist->ddos ) {// flagged as DDoS
 			return (connect_ok == 2 ? 1 : 0);
-		} else if( DIFF_TICK(timer->gettick(),hist->tick) < ddos_interval ) {// connection within ddos_interval
-				hist->tick = timer->gettick();
+		} else if (DIFF_TICK(tick, hist->tick) < ddos_interval) {// connection within ddos_interval
+				hist->tick = tick;
 				if( ++hist->count >= ddos_count ) {// DDoS attack detected
 					hist->ddos = 1;
 					ShowWarning("connect_check: DDoS Attack detected from %u.%u.%u.%u!\n", CONVIP(ip));
@@ -1260,54 +1414,322 @@ static int connect_check_(uint32 ip)
 				}
 				return connect_ok;
 		} else {// not within ddos_interval, clear data
-			hist->tick  = timer->gettick();
+			hist->tick  = tick;
 			hist->count = 0;
 			return connect_ok;
 		}
 	}
 	// IP not found, add to history
-	CREATE(hist, struct connect_history, 1);
-	hist->ip   = ip;
-	hist->tick = timer->gettick();
-	uidb_put(connect_history, ip, hist);
+	sockt->connect_history_add(&sockt->connect_history, ip, tick);
 	return connect_ok;
 }
 
+/**
+ * Adds a range to an access list.
+ *
+ * @param list The list.
+ * @param ip   The ip of the range.
+ * @param mask The mask of the range.
+ *
+ * @retval false if the range was already in the list.
+ */
+static bool access_list_insert(struct access_list *list, uint32 ip, uint32 mask)
+{
+	int len = 0, idx = 0;
+
+	nullpo_retr(false, list);
+
+	if ((~mask & (~mask + 1)) != 0) { // non-contiguous mask
+		struct s_subnet subnet = { ip & mask, mask };
+		for (int i = 0; i < VECTOR_LENGTH(list->others); i++) {
+			if (VECTOR_INDEX(list->others, i).ip == subnet.ip && VECTOR_INDEX(list->others, i).mask == mask)
+				return false;
+		}
+		VECTOR_ENSURE(list->others, 1, 1);
+		VECTOR_PUSH(list->others, subnet);
+		list->count++;
+		return true;
+	}
+
+	while (len < 32 && (mask & (0x80000000U >> len)) != 0)
+		len++;
+	ip &= mask;
+
+	if (VECTOR_LENGTH(list->nodes) == 0) {
+		struct access_trie_node root = { 0 };
+		VECTOR_ENSURE(list->nodes, 64, 64);
+		VECTOR_PUSH(list->nodes, root);
+	}
+
+	while (true) {
+		struct access_trie_node *node = &VECTOR_INDEX(list->nodes, idx);
+		struct access_trie_node *child;
+		uint32 diff;
+		int bit, common;
+
+		if (node->len == len) {
+			if (node->rule)
+				return false;
+			node->rule = true;
+			list->count++;
+			return true;
+		}
+
+		bit = ACCESS_PREFIX_BIT(ip, node->len);
+		if (node->child[bit] == 0) {
+			struct access_trie_node leaf = { ip, (uint8)len, true, { 0, 0 } };
+			VECTOR_ENSURE(list->nodes, 1, 64);
+			VECTOR_PUSH(list->nodes, leaf);
+			VECTOR_INDEX(list->nodes, idx).child[bit] = VECTOR_LENGTH(list->nodes) - 1;
+			list->count++;
+			return true;
+		}
+
+		child = &VECTOR_INDEX(list->nodes, node->child[bit]);
+		diff = (child->prefix ^ ip);
+		common = 0;
+		while (common < 32 && (diff & (0x80000000U >> common)) == 0)
+			common++;
+		common = min(common, min(len, (int)child->len));
+		if (common == child->len) {
+			idx = node->child[bit];
+			continue;
+		}
+
+		// Split the edge to the child at the common prefix
+		{
+			struct access_trie_node split = { ip & ACCESS_PREFIX_MASK(common), (uint8)common, common == len, { 0, 0 } };
+			int child_idx = node->child[bit];
+			int split_idx;
+
+			split.child[ACCESS_PREFIX_BIT(child->prefix, common)] = child_idx;
+			VECTOR_ENSURE(list->nodes, 2, 64);
+			VECTOR_PUSH(list->nodes, split);
+			split_idx = VECTOR_LENGTH(list->nodes) - 1;
+			if (common != len) {
+				struct access_trie_node leaf = { ip, (uint8)len, true, { 0, 0 } };
+				VECTOR_PUSH(list->nodes, leaf);
+				VECTOR_INDEX(list->nodes, split_idx).child[ACCESS_PREFIX_BIT(ip, common)] = VECTOR_LENGTH(list->nodes) - 1;
+			}
+			VECTOR_INDEX(list->nodes, idx).child[bit] = split_idx;
+		}
+		list->count++;
+		return true;
+	}
+}
+
+/**
+ * Looks for a range of an access list that contains an ip.
+ *
+ * @param list  The list.
+ * @param ip    The ip.
+ * @param match Where to store the matching range (optional).
+ *
+ * @retval true if a range contains the ip.
+ */
+static bool access_list_match(const struct access_list *list, uint32 ip, struct s_subnet *match)
+{
+	int idx = 0;
+
+	nullpo_retr(false, list);
+
+	if (VECTOR_LENGTH(list->nodes) != 0) {
+		do {
+			const struct access_trie_node *node = &VECTOR_INDEX(list->nodes, idx);
+
+			if ((ip & ACCESS_PREFIX_MASK(node->len)) != node->prefix)
+				break;
+			if (node->rule) {
+				if (match != NULL) {
+					match->ip = node->prefix;
+					match->mask = ACCESS_PREFIX_MASK(node->len);
+				}
+				return true;
+			}
+			if (node->len == 32)
+				break;
+			idx = node->child[ACCESS_PREFIX_BIT(ip, node->len)];
+		} while (idx != 0);
+	}
+
+	for (int i = 0; i < VECTOR_LENGTH(list->others); i++) {
+		const struct s_subnet *entry = &VECTOR_INDEX(list->others, i);
+		if (SUBNET_MATCH(ip, entry->ip, entry->mask)) {
+			if (match != NULL)
+				*match = *entry;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void access_list_clear(struct access_list *list)
+{
+	nullpo_retv(list);
+
+	VECTOR_CLEAR(list->nodes);
+	VECTOR_CLEAR(list->others);
+	list->count = 0;
+}
+
+/// Home slot of an ip in the connection history.
+static inline uint32 connect_history_hash(const struct connect_history_table *table, uint32 ip)
+{
+	ip ^= ip >> 16;
+	ip *= 0x45d9f3bU;
+	ip ^= ip >> 16;
+	return ip & (table->size - 1);
+}
+
+/**
+ * Allocates the slots of a connection history.
+ *
+ * @param table The history.
+ * @param max   Max amount of ips kept, the table gets at least 4/3 as many slots.
+ */
+static void connect_history_init(struct connect_history_table *table, uint32 max)
+{
+	nullpo_retv(table);
+
+	if (table->slots != NULL)
+		aFree(table->slots);
+	table->max = max(max, 16);
+	table->size = 16;
+	while (table->size < table->max + table->max / 3)
+		table->size <<= 1;
+	table->slots = aCalloc(table->size, sizeof(*table->slots));
+	table->count = 0;
+	table->evicted = 0;
+}
+
+static struct connect_history *connect_history_find(struct connect_history_table *table, uint32 ip)
+{
+	uint32 slot;
+
+	nullpo_retr(NULL, table);
+
+	if (table->slots == NULL)
+		return NULL;
+
+	for (slot = connect_history_hash(table, ip); table->slots[slot].used; slot = (slot + 1) & (table->size - 1)) {
+		if (table->slots[slot].ip == ip)
+			return &table->slots[slot];
+	}
+	return NULL;
+}
+
+/**
+ * Removes the entry of a slot, moving back the entries of the same probe sequence.
+ */
+static void connect_history_remove(struct connect_history_table *table, uint32 slot)
+{
+	uint32 mask, hole, i;
+
+	nullpo_retv(table);
+	Assert_retv(slot < table->size && table->slots[slot].used);
+
+	mask = table->size - 1;
+	hole = slot;
+	for (i = (slot + 1) & mask; table->slots[i].used; i = (i + 1) & mask) {
+		uint32 home = connect_history_hash(table, table->slots[i].ip);
+
+		// The entry can fill the hole unless its home slot is between the hole and its slot
+		if (((i - home) & mask) >= ((i - hole) & mask)) {
+			table->slots[hole] = table->slots[i];
+			hole = i;
+		}
+	}
+	memset(&table->slots[hole], 0, sizeof(table->slots[hole]));
+	table->count--;
+}
+
+/**
+ * Adds an ip to the connection history. When the history is full, the
+ * oldest entry near the home slot of the ip is replaced, preferring entries
+ * that are not flagged as DDoS.
+ *
+ * @param table The history.
+ * @param ip    The ip, must not be in the history already.
+ * @param tick  The current tick.
+ */
+static struct connect_history *connect_history_add(struct connect_history_table *table, uint32 ip, int64 tick)
+{
+	uint32 slot;
+
+	nullpo_retr(NULL, table);
+
+	if (table->slots == NULL)
+		sockt->connect_history_init(table, (uint32)ddos_history_size);
+
+	if (table->count >= table->max) {
+		uint32 mask = table->size - 1;
+		uint32 victim = table->size;
+		int looked = 0;
+
+		slot = connect_history_hash(table, ip);
+		for (uint32 n = 0; n < table->size && (looked < CONNECT_HISTORY_EVICT_WINDOW || victim == table->size); n++, slot = (slot + 1) & mask) {
+			const struct connect_history *entry = &table->slots[slot];
+
+			looked++;
+			if (!entry->used)
+				continue;
+			if (victim == table->size
+			 || (table->slots[victim].ddos && !entry->ddos)
+			 || (table->slots[victim].ddos == entry->ddos && DIFF_TICK(entry->tick, table->slots[victim].tick) < 0))
+				victim = slot;
+		}
+		if (victim != table->size) {
+			sockt->connect_history_remove(table, victim);
+			table->evicted++;
+		}
+	}
+
+	for (slot = connect_history_hash(table, ip); table->slots[slot].used; slot = (slot + 1) & (table->size - 1))
+		continue;
+	table->slots[slot].ip = ip;
+	table->slots[slot].tick = tick;
+	table->slots[slot].used = 1;
+	table->count++;
+	return &table->slots[slot];
+}
+
 /// Timer function.
 /// Deletes old connection history records.
-static int connect_check_clear(int tid, int64 tick, int id, intptr_t data)
+static int connect_history_clear(int tid, int64 tick, int id, intptr_t data)
 {
+	struct connect_history_table *table = &sockt->connect_history;
 	int clear = 0;
-	int list  = 0;
-	struct connect_history *hist = NULL;
-	struct DBIterator *iter;
+	int list  = (int)table->count;
 
-	if( !db_size(connect_history) )
+	if (table->count == 0)
 		return 0;
 
-	iter = db_iterator(connect_history);
+	for (uint32 slot = 0; slot < table->size; ) {
+		const struct connect_history *hist = &table->slots[slot];
 
-	for( hist = dbi_first(iter); dbi_exists(iter); hist = dbi_next(iter) ){
-		if( (!hist->ddos && DIFF_TICK(tick,hist->tick) > ddos_interval*3) ||
-			(hist->ddos && DIFF_TICK(tick,hist->tick) > ddos_autoreset) )
-			{// Remove connection history
-				uidb_remove(connect_history, hist->ip);
-				clear++;
-			}
-		list++;
+		if (hist->used &&
+			((!hist->ddos && DIFF_TICK(tick,hist->tick) > ddos_interval*3) ||
+			(hist->ddos && DIFF_TICK(tick,hist->tick) > ddos_autoreset)))
+		{// Remove connection history, the slot may receive another entry
+			sockt->connect_history_remove(table, slot);
+			clear++;
+			continue;
+		}
+		slot++;
 	}
-	dbi_destroy(iter);
 
 	if( access_debug ){
-		ShowInfo("connect_check_clear: Cleared %d of %d from IP list.\n", clear, list);
+		ShowInfo("connect_check_clear: Cleared %d of %d from IP list (%u replaced because the list was full).\n", clear, list, table->evicted);
 	}
+	table->evicted = 0;
 
 	return list;
 }
 
 /// Parses the ip address and mask and puts it into acc.
 /// Returns 1 is successful, 0 otherwise.
-static int access_ipmask(const char *str, struct access_control *acc)
+static int access_ipmask(const char *str, struct s_subnet *acc)
 {
 	uint32 ip;
 	uint32 mask;
@@ -1363,7 +1785,7 @@ static int access_ipmask(const char *str, struct access_control *acc)
  *
  * @retval false in case of failure
  */
-static bool access_list_add(struct config_setting_t *setting, const char *list_name, struct access_control_list *access_list)
+static bool access_list_add(struct config_setting_t *setting, const char *list_name, struct access_list *access_list)
 {
 	const char *temp = NULL;
 	int i, setting_length;
@@ -1375,9 +1797,8 @@ static bool access_list_add(struct config_setting_t *setting, const char *list_n
 	if ((setting_length = libconfig->setting_length(setting)) <= 0)
 		return false;
 
-	VECTOR_ENSURE(*access_list, setting_length, 1);
 	for (i = 0; i < setting_length; i++) {
-		struct access_control acc;
+		struct s_subnet acc;
 		if ((temp = libconfig->setting_get_string_elem(setting, i)) == NULL) {
 			continue;
 		}
@@ -1386,7 +1807,7 @@ static bool access_list_add(struct config_setting_t *setting, const char *list_n
 			ShowError("access_list_add: Invalid ip or ip range %s '%d'!\n", list_name, i);
 			continue;
 		}
-		VECTOR_PUSH(*access_list, acc);
+		sockt->access_list_insert(access_list, acc.ip, acc.mask);
 	}
 
 	return true;
@@ -1436,14 +1857,14 @@ static bool socket_config_read_iprules(const char *filename, struct config_t *co
 		if (!imported)
 			ShowError("socket_config_read: socket_configuration/ip_rules/allow_list was not found in %s!\n", filename);
 	} else {
-		access_list_add(setting, "allow_list", &access_allow);
+		access_list_add(setting, "allow_list", &sockt->access_allow);
 	}
 
 	if ((setting = libconfig->lookup(config, "socket_configuration/ip_rules/deny_list")) == NULL) {
 		if (!imported)
 			ShowError("socket_config_read: socket_configuration/ip_rules/deny_list was not found in %s!\n", filename);
 	} else {
-		access_list_add(setting, "deny_list", &access_deny);
+		access_list_add(setting, "deny_list", &sockt->access_deny);
 	}
 
 	return true;
@@ -1475,6 +1896,10 @@ static bool socket_config_read_ddos(const char *filename, struct config_t *confi
 	libconfig->setting_lookup_int(setting, "interval", &ddos_interval);
 	libconfig->setting_lookup_int(setting, "count", &ddos_count);
 	libconfig->setting_lookup_int(setting, "autoreset", &ddos_autoreset);
+	if (libconfig->setting_lookup_int(setting, "history_size", &ddos_history_size) == CONFIG_TRUE) {
+		if (ddos_history_size < 16)
+			ddos_history_size = 16;
+	}
 
 	return true;
 }
@@ -1552,10 +1977,11 @@ static bool socket_config_read(const char *filename, bool imported)
 static void socket_final(void)
 {
 	int i;
-	if( connect_history )
-		db_destroy(connect_history);
-	VECTOR_CLEAR(access_allow);
-	VECTOR_CLEAR(access_deny);
+	if (sockt->connect_history.slots != NULL)
+		aFree(sockt->connect_history.slots);
+	sockt->connect_history.slots = NULL;
+	sockt->access_list_clear(&sockt->access_allow);
+	sockt->access_list_clear(&sockt->access_deny);
 
 	for( i = 1; i < sockt->fd_max; i++ )
 		if(sockt->session[i])
@@ -1593,6 +2019,12 @@ static void socket_close(int fd)
 
 	sockt->flush(fd); // Try to send what's left (although it might not succeed since it's a nonblocking socket)
 
+	if (replay->mode == REPLAY_MODE_REPLAY) { // replayed sessions have no socket
+		if (sockt->session[fd])
+			sockt->delete_session(fd);
+		return;
+	}
+
 #ifndef SOCKET_EPOLL
 	// Select based Event Dispatcher
 	sFD_CLR(fd, &readfds);// this needs to be done before closing the socket
@@ -1741,9 +2173,6 @@ static void socket_init(void)
 	}
 #endif  // defined(HAVE_SETRLIMIT) && !defined(CYGWIN)
 
-	VECTOR_INIT(access_allow);
-	VECTOR_INIT(access_deny);
-
 	// Get initial local ips
 	sockt->naddr_ = sockt->getips(sockt->addr_,16);
 
@@ -1783,9 +2212,9 @@ static void socket_init(void)
 	sockt->create_session(0, null_recv, null_send, null_parse, null_client_connected, null_delete);
 
 	// Delete old connection history every 5 minutes
-	connect_history = uidb_alloc(DB_OPT_RELEASE_DATA);
-	timer->add_func_list(connect_check_clear, "connect_check_clear");
-	timer->add_interval(timer->gettick()+1000, connect_check_clear, 0, 0, 5*60*1000);
+	sockt->connect_history_init(&sockt->connect_history, (uint32)ddos_history_size);
+	timer->add_func_list(sockt->connect_history_clear, "connect_check_clear");
+	timer->add_interval(timer->gettick()+1000, sockt->connect_history_clear, 0, 0, 5*60*1000);
 
 	ShowInfo("Server supports up to '"CL_WHITE"%"PRIu64""CL_RESET"' concurrent connections.\n", rlim_cur);
 }
@@ -2190,6 +2619,13 @@ void socket_defaults(void)
 	VECTOR_INIT(sockt->lan_subnets);
 	VECTOR_INIT(sockt->allowed_ips);
 	VECTOR_INIT(sockt->trusted_ips);
+	VECTOR_INIT(sockt->access_allow.nodes);
+	VECTOR_INIT(sockt->access_allow.others);
+	sockt->access_allow.count = 0;
+	VECTOR_INIT(sockt->access_deny.nodes);
+	VECTOR_INIT(sockt->access_deny.others);
+	sockt->access_deny.count = 0;
+	memset(&sockt->connect_history, 0, sizeof(sockt->connect_history));
 
 	sockt->init = socket_init;
 	sockt->final = socket_final;
@@ -2231,5 +2667,15 @@ void socket_defaults(void)
 	sockt->trusted_ip_check = socket_trusted_ip_check;
 	sockt->net_config_read_sub = socket_net_config_read_sub;
 	sockt->net_config_read = socket_net_config_read;
+	/* ip rules and DDoS protection */
+	sockt->connect_check = connect_check;
+	sockt->access_list_insert = access_list_insert;
+	sockt->access_list_match = access_list_match;
+	sockt->access_list_clear = access_list_clear;
+	sockt->connect_history_init = connect_history_init;
+	sockt->connect_history_find = connect_history_find;
+	sockt->connect_history_add = connect_history_add;
+	sockt->connect_history_remove = connect_history_remove;
+	sockt->connect_history_clear = connect_history_clear;
 	sockt->validateWfifo = socket_validateWfifo;
 }
@@ -174,6 +174,42 @@ struct s_subnet {
 /// A vector of subnets/IP ranges.
 VECTOR_STRUCT_DECL(s_subnet_vector, struct s_subnet);
 
+/// Node of an access_list trie. Path-compressed binary trie over the ip bits,
+/// a node covers the ips whose first `len` bits are `prefix`.
+struct access_trie_node {
+	uint32 prefix;
+	uint8 len;
+	bool rule;      ///< A rule of this exact prefix exists
+	int child[2];   ///< Index in access_list::nodes of the children by next bit (0: none)
+};
+
+/// List of ip_rules ranges.
+/// Ranges with a prefix mask go in the trie, lookups cost O(prefix length);
+/// ranges with a non-contiguous mask (e.g. 255.0.255.0) are checked one by one.
+struct access_list {
+	VECTOR_DECL(struct access_trie_node) nodes; ///< Trie nodes, nodes[0] is the root (/0)
+	struct s_subnet_vector others;              ///< Ranges with a non-contiguous mask
+	int count;                                  ///< Amount of rules added
+};
+
+/// Connection history of one ip, used for the DDoS protection.
+struct connect_history {
+	uint32 ip;
+	int64 tick;
+	int count;
+	unsigned ddos : 1;
+	unsigned used : 1;
+};
+
+/// Open-addressing hash table of connect_history, with a fixed amount of slots.
+struct connect_history_table {
+	struct connect_history *slots;
+	uint32 size;          ///< Amount of slots (power of 2)
+	uint32 count;         ///< Used slots
+	uint32 max;           ///< Max used slots, further ips replace old entries
+	unsigned int evicted; ///< Entries replaced because the table was full
+};
+
 /// Use a shortlist of sockets instead of iterating all sessions for sockets
 /// that have data to send or need eof handling.
 /// Adapted to use a static array instead of a linked list.
@@ -211,6 +247,10 @@ struct socket_interface {
 	struct s_subnet_vector trusted_ips; ///< Trusted IP ranges
 	struct s_subnet_vector allowed_ips; ///< Allowed server IP ranges
 
+	struct access_list access_allow; ///< ip_rules allow list
+	struct access_list access_deny;  ///< ip_rules deny list
+	struct connect_history_table connect_history;
+
 	/* */
 	void (*init) (void);
 	void (*final) (void);
@@ -257,6 +297,16 @@ struct socket_interface {
 	bool (*trusted_ip_check) (uint32 ip);
 	int (*net_config_read_sub) (struct config_setting_t *t, struct s_subnet_vector *list, const char *filename, const char *groupname);
 	void (*net_config_read) (const char *filename);
+	/* ip rules and DDoS protection */
+	int (*connect_check) (uint32 ip);
+	bool (*access_list_insert) (struct access_list *list, uint32 ip, uint32 mask);
+	bool (*access_list_match) (const struct access_list *list, uint32 ip, struct s_subnet *match);
+	void (*access_list_clear) (struct access_list *list);
+	void (*connect_history_init) (struct connect_history_table *table, uint32 max);
+	struct connect_history *(*connect_history_find) (struct connect_history_table *table, uint32 ip);
+	struct connect_history *(*connect_history_add) (struct connect_history_table *table, uint32 ip, int64 tick);
+	void (*connect_history_remove) (struct connect_history_table *table, uint32 slot);
+	int (*connect_history_clear) (int tid, int64 tick, int id, intptr_t data);
 };
 
 #ifdef HERCULES_CORE
@@ -26,6 +26,7 @@
 #include "common/db.h"
 #include "common/memmgr.h"
 #include "common/nullpo.h"
+#include "common/replay.h"
 #include "common/showmsg.h"
 #include "common/utils.h"
 
@@ -58,6 +59,35 @@ static int *free_timer_list = NULL;
 static int free_timer_list_max = 0;
 static int free_timer_list_pos = 0;
 
+/**
+ * Batched timers.
+ *
+ * Single-use timers of the functions passed to timer_add_batch_func aren't
+ * pushed to the timer heap. Their due ticks are rounded up to a multiple of
+ * TIMER_BATCH_GRANULARITY, and timers of the same rounded tick are chained to
+ * a batch timer instead, which is the only one in the heap. When it expires
+ * it runs them in tick order (insertion order for equal ticks), each with its
+ * own tick, so they're never run early and at most TIMER_BATCH_GRANULARITY-1
+ * ms late (the main loop already wakes up only every TIMER_MIN_INTERVAL ms
+ * when idle). Their ids, ticks and deletion work like the ones of any other
+ * timer.
+ */
+#define TIMER_BATCH_FUNC_MAX 8
+#define TIMER_BATCH_HASH_SIZE 4096 // power of 2
+
+/// Batch links of a timer (array, same size as timer_data).
+struct timer_batch_link {
+	int batch;     ///< Batch timer holding the timer, 0 if not batched
+	int prev;      ///< Previous timer of the batch (batch timer: last timer of the batch)
+	int next;      ///< Next timer of the batch (batch timer: first timer of the batch)
+	int hash_next; ///< Batch timer: next batch timer of the same hash bucket
+};
+static struct timer_batch_link *timer_links = NULL;
+static TimerFunc timer_batch_funcs[TIMER_BATCH_FUNC_MAX];
+static int timer_batch_func_count = 0;
+static int timer_batch_hash[TIMER_BATCH_HASH_SIZE];
+static struct timer_batch_stats timer_batch_counters;
+
 
 /// Comparator for the timer heap. (minimum tick at top)
 /// Returns negative if tid1's tick is smaller, positive if tid2's tick is smaller, 0 if equal.
@@ -224,6 +254,14 @@ static int64 sys_tick(void)
 #endif
 }
 
+/// System tick, or the traced tick while a trace is recorded or replayed.
+static int64 traced_tick(void)
+{
+	if (replay->mode == REPLAY_MODE_OFF)
+		return sys_tick();
+	return replay->tick(sys_tick());
+}
+
 //////////////////////////////////////////////////////////////////////////
 #if defined(TICK_CACHE) && TICK_CACHE > 1
 //////////////////////////////////////////////////////////////////////////
@@ -234,7 +272,7 @@ static int gettick_count = 1;
 static int64 timer_gettick_nocache(void)
 {
 	gettick_count = TICK_CACHE;
-	gettick_cache = sys_tick();
+	gettick_cache = traced_tick();
 	return gettick_cache;
 }
 
@@ -248,12 +286,12 @@ static int64 timer_gettick(void)
 // tick doesn't get cached
 static int64 timer_gettick_nocache(void)
 {
-	return sys_tick();
+	return traced_tick();
 }
 
 static int64 timer_gettick(void)
 {
-	return sys_tick();
+	return traced_tick();
 }
 //////////////////////////////////////////////////////////////////////////
 #endif
@@ -299,6 +337,11 @@ static int acquire_timer(void)
 		else
 			CREATE(timer_data, struct TimerData, timer_data_max);
 		memset(timer_data + (timer_data_max - 256), 0, sizeof(struct TimerData)*256);
+		if (timer_links)
+			RECREATE(timer_links, struct timer_batch_link, timer_data_max);
+		else
+			CREATE(timer_links, struct timer_batch_link, timer_data_max);
+		memset(timer_links + (timer_data_max - 256), 0, sizeof(struct timer_batch_link) * 256);
 	}
 
 	if( tid >= timer_data_num )
@@ -307,6 +350,182 @@ static int acquire_timer(void)
 	return tid;
 }
 
+/// Releases an expired timer, or schedules it again if it's an interval timer.
+static void timer_expired(int tid, int64 tick)
+{
+	// in the case the function didn't change anything...
+	if( timer_data[tid].type & TIMER_REMOVE_HEAP ) {
+		timer_data[tid].type &= ~TIMER_REMOVE_HEAP;
+
+		switch( timer_data[tid].type ) {
+			default:
+			case TIMER_ONCE_AUTODEL:
+				timer_data[tid].type = 0;
+				timer_data[tid].func = NULL;
+				if (free_timer_list_pos >= free_timer_list_max) {
+					free_timer_list_max += 256;
+					RECREATE(free_timer_list,int,free_timer_list_max);
+					memset(free_timer_list + (free_timer_list_max - 256), 0, 256 * sizeof(int));
+				}
+				free_timer_list[free_timer_list_pos++] = tid;
+			break;
+			case TIMER_INTERVAL:
+				if( DIFF_TICK(timer_data[tid].tick, tick) < -1000 )
+					timer_data[tid].tick = tick + timer_data[tid].interval;
+				else
+					timer_data[tid].tick += timer_data[tid].interval;
+				push_timer_heap(tid);
+			break;
+		}
+	}
+}
+
+/// Whether the single-use timers of func are batched.
+static bool timer_is_batched(TimerFunc func)
+{
+	int i;
+	ARR_FIND(0, timer_batch_func_count, i, timer_batch_funcs[i] == func);
+	return i < timer_batch_func_count;
+}
+
+/// Tick of the batch of a timer due at tick.
+static int64 timer_batch_tick(int64 tick)
+{
+	return (tick + TIMER_BATCH_GRANULARITY - 1) / TIMER_BATCH_GRANULARITY * TIMER_BATCH_GRANULARITY;
+}
+
+/// Hash bucket of the batch of a batch tick.
+static int *timer_batch_slot(int64 batch_tick)
+{
+	return &timer_batch_hash[(batch_tick / TIMER_BATCH_GRANULARITY) & (TIMER_BATCH_HASH_SIZE - 1)];
+}
+
+/**
+ * Runs the timers of an expired batch.
+ *
+ * @param tid  The batch timer.
+ * @param tick The tick the batch is run with (the current tick if it was
+ *             delayed for more than 1 second).
+ */
+static int timer_batch_run(int tid, int64 tick, int id, intptr_t data)
+{
+	int *slot = timer_batch_slot(timer_data[tid].tick);
+	bool delayed = (tick != timer_data[tid].tick);
+	int member;
+
+	// Timers added for this tick from now on go to a new batch
+	while (*slot != 0 && *slot != tid)
+		slot = &timer_links[*slot].hash_next;
+	if (*slot == tid)
+		*slot = timer_links[tid].hash_next;
+	timer_links[tid].hash_next = 0;
+
+	timer_batch_counters.batches++;
+	while ((member = timer_links[tid].next) != 0) {
+		timer_links[tid].next = timer_links[member].next;
+		if (timer_links[tid].next != 0)
+			timer_links[timer_links[tid].next].prev = 0;
+		else
+			timer_links[tid].prev = 0;
+		timer_links[member].batch = 0;
+		timer_links[member].next = 0;
+
+		timer_data[member].type |= TIMER_REMOVE_HEAP;
+		if (timer_data[member].func != NULL) {
+			timer_batch_counters.timers++;
+			timer_data[member].func(member, delayed ? tick : timer_data[member].tick, timer_data[member].id, timer_data[member].data);
+		}
+		timer_expired(member, tick);
+	}
+	return 0;
+}
+
+/// Adds a single-use timer to the batch of its tick, creating the batch if needed.
+static void timer_batch_insert(int tid)
+{
+	int64 tick = timer_batch_tick(timer_data[tid].tick);
+	int *slot = timer_batch_slot(tick);
+	int batch, prev;
+
+	for (batch = *slot; batch != 0 && timer_data[batch].tick != tick; batch = timer_links[batch].hash_next)
+		;
+	if (batch == 0) {
+		batch = acquire_timer();
+		slot = timer_batch_slot(tick);
+		timer_data[batch].tick     = tick;
+		timer_data[batch].func     = timer_batch_run;
+		timer_data[batch].id       = 0;
+		timer_data[batch].data     = 0;
+		timer_data[batch].type     = TIMER_ONCE_AUTODEL;
+		timer_data[batch].interval = 1000;
+		timer_links[batch].batch = 0;
+		timer_links[batch].prev = timer_links[batch].next = 0;
+		timer_links[batch].hash_next = *slot;
+		*slot = batch;
+		push_timer_heap(batch);
+	}
+
+	// Timers are mostly added in tick order, the walk back from the last one is short
+	for (prev = timer_links[batch].prev; prev != 0 && DIFF_TICK(timer_data[prev].tick, timer_data[tid].tick) > 0; prev = timer_links[prev].prev)
+		;
+	timer_links[tid].batch = batch;
+	timer_links[tid].prev = prev;
+	if (prev != 0) {
+		timer_links[tid].next = timer_links[prev].next;
+		timer_links[prev].next = tid;
+	} else {
+		timer_links[tid].next = timer_links[batch].next;
+		timer_links[batch].next = tid;
+	}
+	if (timer_links[tid].next != 0)
+		timer_links[timer_links[tid].next].prev = tid;
+	else
+		timer_links[batch].prev = tid;
+}
+
+/// Removes a timer from its batch, an emptied batch expires without effect.
+static void timer_batch_remove(int tid)
+{
+	int batch = timer_links[tid].batch;
+
+	if (timer_links[tid].prev != 0)
+		timer_links[timer_links[tid].prev].next = timer_links[tid].next;
+	else
+		timer_links[batch].next = timer_links[tid].next;
+	if (timer_links[tid].next != 0)
+		timer_links[timer_links[tid].next].prev = timer_links[tid].prev;
+	else
+		timer_links[batch].prev = timer_links[tid].prev;
+	timer_links[tid].batch = timer_links[tid].prev = timer_links[tid].next = 0;
+}
+
+/**
+ * Batches the single-use timers of a function: timers of that function due
+ * within the same TIMER_BATCH_GRANULARITY ms window share a single timer heap
+ * entry, and may run up to TIMER_BATCH_GRANULARITY-1 ms after their tick.
+ *
+ * Meant for functions with lots of concurrent timers (e.g. status changes).
+ */
+static void timer_add_batch_func(TimerFunc func)
+{
+	nullpo_retv(func);
+
+	if (timer_is_batched(func))
+		return;
+	if (timer_batch_func_count >= TIMER_BATCH_FUNC_MAX) {
+		ShowWarning("timer_add_batch_func: Too many batched functions, %p(%s) is not batched.\n", func, search_timer_func_list(func));
+		return;
+	}
+	timer_batch_funcs[timer_batch_func_count++] = func;
+}
+
+/// Retrieves the counters of the batched timers.
+static void timer_batch_stats(struct timer_batch_stats *stats)
+{
+	nullpo_retv(stats);
+	*stats = timer_batch_counters;
+}
+
 /// Starts a new timer that is deleted once it expires (single-use).
 /// Returns the timer's id.
 static int timer_add(int64 tick, TimerFunc func, int id, intptr_t data)
@@ -332,7 +551,10 @@ static int timer_add(int64 tick, TimerFunc func, int id, intptr_t data)
 	timer_data[tid].data     = data;
 	timer_data[tid].type     = TIMER_ONCE_AUTODEL;
 	timer_data[tid].interval = 1000;
-	push_timer_heap(tid);
+	if (timer_batch_func_count > 0 && timer_is_batched(func))
+		timer_batch_insert(tid);
+	else
+		push_timer_heap(tid);
 
 	return tid;
 }
@@ -436,6 +658,22 @@ static int64 timer_settick(int tid, int64 tick)
 {
 	int i;
 
+	if (tid > 0 && tid < timer_data_num && timer_links[tid].batch != 0) {
+		if (timer_data[tid].type == 0 || timer_data[tid].func == NULL) {
+			ShowError("timer_settick error: set tick for deleted timer [%d]\n", tid);
+			Assert_retr(-1, 0);
+			return -1;
+		}
+		if (tick == -1)
+			tick = 0; // add 1ms to avoid the error value -1
+		if (timer_data[tid].tick != tick) {
+			timer_batch_remove(tid);
+			timer_data[tid].tick = tick;
+			timer_batch_insert(tid);
+		}
+		return tick;
+	}
+
 	// search timer position
 	ARR_FIND(0, BHEAP_LENGTH(timer_heap), i, BHEAP_DATA(timer_heap)[i] == tid);
 	if (i == BHEAP_LENGTH(timer_heap)) {
@@ -498,31 +736,7 @@ static int do_timer(int64 tick)
 				timer_data[tid].func(tid, timer_data[tid].tick, timer_data[tid].id, timer_data[tid].data);
 		}
 
-		// in the case the function didn't change anything...
-		if( timer_data[tid].type & TIMER_REMOVE_HEAP ) {
-			timer_data[tid].type &= ~TIMER_REMOVE_HEAP;
-
-			switch( timer_data[tid].type ) {
-				default:
-				case TIMER_ONCE_AUTODEL:
-					timer_data[tid].type = 0;
-					timer_data[tid].func = NULL;
-					if (free_timer_list_pos >= free_timer_list_max) {
-						free_timer_list_max += 256;
-						RECREATE(free_timer_list,int,free_timer_list_max);
-						memset(free_timer_list + (free_timer_list_max - 256), 0, 256 * sizeof(int));
-					}
-					free_timer_list[free_timer_list_pos++] = tid;
-				break;
-				case TIMER_INTERVAL:
-					if( DIFF_TICK(timer_data[tid].tick, tick) < -1000 )
-						timer_data[tid].tick = tick + timer_data[tid].interval;
-					else
-						timer_data[tid].tick += timer_data[tid].interval;
-					push_timer_heap(tid);
-				break;
-			}
-		}
+		timer_expired(tid, tick);
 	}
 
 	return (int)cap_value(diff, TIMER_MIN_INTERVAL, TIMER_MAX_INTERVAL);
@@ -540,6 +754,7 @@ static void timer_init(void)
 #endif
 
 	time(&start_time);
+	timer->add_func_list(timer_batch_run, "timer_batch_run");
 }
 
 static void timer_final(void)
@@ -555,8 +770,11 @@ static void timer_final(void)
 	}
 
 	if (timer_data) aFree(timer_data);
+	if (timer_links) aFree(timer_links);
 	BHEAP_CLEAR(timer_heap);
 	if (free_timer_list) aFree(free_timer_list);
+	timer_batch_func_count = 0;
+	memset(timer_batch_hash, 0, sizeof(timer_batch_hash));
 }
 
 #ifdef BUILDBOT
@@ -654,6 +872,8 @@ void timer_defaults(void)
 	timer->add = timer_add;
 	timer->add_interval = timer_add_interval;
 	timer->add_func_list = timer_add_func_list;
+	timer->add_batch_func = timer_add_batch_func;
+	timer->batch_stats = timer_batch_stats;
 	timer->get = timer_get;
 	timer->delete_ = timer_do_delete;
 	timer->addtick = timer_addtick;
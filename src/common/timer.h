@@ -28,6 +28,10 @@
 
 #define INVALID_TIMER (-1)
 
+/// Batched timers (see timer->add_batch_func) due within the same window of
+/// this many ms share a batch, and run up to TIMER_BATCH_GRANULARITY-1 ms late.
+#define TIMER_BATCH_GRANULARITY 10
+
 // timer flags
 enum {
 	TIMER_ONCE_AUTODEL = 0x01,
@@ -50,6 +54,12 @@ struct TimerData {
 	intptr_t data;
 };
 
+/// Counters of the batched timers (see timer->add_batch_func).
+struct timer_batch_stats {
+	uint64 batches; ///< Batches that expired (one heap entry each)
+	uint64 timers;  ///< Batched timers that expired
+};
+
 
 /*=====================================
 * Interface : timer.h
@@ -71,6 +81,8 @@ struct timer_interface {
 	int64 (*settick) (int tid, int64 tick);
 
 	int (*add_func_list) (TimerFunc func, char* name);
+	void (*add_batch_func) (TimerFunc func);
+	void (*batch_stats) (struct timer_batch_stats *stats);
 
 	unsigned long (*get_uptime) (void);
 
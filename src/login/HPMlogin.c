@@ -25,6 +25,7 @@
 #include "common/cbasetypes.h"
 
 #include "login/account.h"
+#include "login/dnsbl.h"
 #include "login/ipban.h"
 #include "login/lapiif.h"
 #include "login/lclif.h"
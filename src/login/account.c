@@ -26,6 +26,7 @@
 #include "common/cbasetypes.h"
 #include "common/conf.h"
 #include "common/console.h"
+#include "common/db.h"
 #include "common/memmgr.h"
 #include "common/mmo.h"
 #include "common/nullpo.h"
@@ -33,6 +34,7 @@
 #include "common/socket.h"
 #include "common/sql.h"
 #include "common/strlib.h"
+#include "common/timer.h"
 
 #include <stdlib.h>
 
@@ -53,6 +55,8 @@ static AccountDB *account_db_sql(void)
 	db->vtable.get_property = account->db_sql_get_property;
 	db->vtable.set_property = account->db_sql_set_property;
 	db->vtable.save         = account->db_sql_save;
+	db->vtable.save_login   = account->db_sql_save_login;
+	db->vtable.flush        = account->db_sql_flush;
 	db->vtable.create       = account->db_sql_create;
 	db->vtable.remove       = account->db_sql_remove;
 	db->vtable.load_num     = account->db_sql_load_num;
@@ -73,6 +77,9 @@ static AccountDB *account_db_sql(void)
 	safestrncpy(db->account_db, "login", sizeof(db->account_db));
 	safestrncpy(db->global_acc_reg_num_db, "global_acc_reg_num_db", sizeof(db->global_acc_reg_num_db));
 	safestrncpy(db->global_acc_reg_str_db, "global_acc_reg_str_db", sizeof(db->global_acc_reg_str_db));
+	db->login_flush_interval = 1000;
+	db->cache = NULL;
+	db->flush_timer = INVALID_TIMER;
 
 	return &db->vtable;
 }
@@ -105,6 +112,13 @@ static bool account_db_sql_init(AccountDB *self)
 #ifdef CONSOLE_INPUT
 	console->input->setSQL(db->accounts);
 #endif
+
+	db->cache = idb_alloc(DB_OPT_RELEASE_DATA);
+	if (db->login_flush_interval > 0) {
+		timer->add_func_list(account->flush_timer, "account->flush_timer");
+		db->flush_timer = timer->add_interval(timer->gettick() + db->login_flush_interval, account->flush_timer, 0, (intptr_t)db, db->login_flush_interval);
+	}
+	db->stats.report_tick = timer->gettick();
 	return true;
 }
 
@@ -114,6 +128,16 @@ static void account_db_sql_destroy(AccountDB *self)
 	AccountDB_SQL* db = (AccountDB_SQL*)self;
 
 	nullpo_retv(db);
+	if (db->flush_timer != INVALID_TIMER) {
+		timer->delete_(db->flush_timer, account->flush_timer);
+		db->flush_timer = INVALID_TIMER;
+	}
+	if (db->cache != NULL) {
+		self->flush(self);
+		account->flush_report(db);
+		db_destroy(db->cache);
+		db->cache = NULL;
+	}
 	SQL->Free(db->accounts);
 	db->accounts = NULL;
 	aFree(db);
@@ -259,6 +283,9 @@ static bool account_db_sql_set_property(AccountDB *self, struct config_t *config
 	nullpo_ret(db);
 	nullpo_ret(config);
 
+	if ((setting = libconfig->lookup(config, "login_configuration/account")) != NULL)
+		libconfig->setting_lookup_int(setting, "login_flush_interval", &db->login_flush_interval);
+
 	if ((setting = libconfig->lookup(config, "login_configuration/account/sql_connection")) == NULL) {
 		if (imported)
 			return true;
@@ -356,6 +383,9 @@ static bool account_db_sql_remove(AccountDB *self, const int account_id)
 
 	result &= ( SQL_SUCCESS == SQL->QueryStr(sql_handle, (result == true) ? "COMMIT" : "ROLLBACK") );
 
+	if (result && db->cache != NULL)
+		idb_remove(db->cache, account_id);
+
 	return result;
 }
 
@@ -363,7 +393,71 @@ static bool account_db_sql_remove(AccountDB *self, const int account_id)
 static bool account_db_sql_save(AccountDB *self, const struct mmo_account *acc)
 {
 	AccountDB_SQL* db = (AccountDB_SQL*)self;
-	return account->mmo_auth_tosql(db, acc, false);
+
+	nullpo_ret(db);
+	nullpo_ret(acc);
+	if (!account->mmo_auth_tosql(db, acc, false))
+		return false;
+
+	// the whole row was written, including any pending login update
+	if (db->cache != NULL)
+		idb_remove(db->cache, acc->account_id);
+	return true;
+}
+
+/// keep the login fields of an account in memory until the next flush
+static bool account_db_sql_save_login(AccountDB *self, const struct mmo_account *acc)
+{
+	AccountDB_SQL* db = (AccountDB_SQL*)self;
+	struct account_cache_entry *entry;
+
+	nullpo_ret(db);
+	nullpo_ret(acc);
+	if (db->login_flush_interval <= 0 || db->cache == NULL)
+		return account->mmo_auth_tosql(db, acc, false);
+
+	if ((entry = idb_get(db->cache, acc->account_id)) != NULL) {
+		db->stats.buffered++;
+	} else {
+		CREATE(entry, struct account_cache_entry, 1);
+		entry->account_id = acc->account_id;
+		idb_put(db->cache, acc->account_id, entry);
+	}
+
+	if (strcmp(entry->lastlogin, acc->lastlogin) != 0) {
+		safestrncpy(entry->lastlogin, acc->lastlogin, sizeof(entry->lastlogin));
+		entry->dirty |= ACCOUNT_DIRTY_LASTLOGIN;
+	}
+	if (strcmp(entry->last_ip, acc->last_ip) != 0) {
+		safestrncpy(entry->last_ip, acc->last_ip, sizeof(entry->last_ip));
+		entry->dirty |= ACCOUNT_DIRTY_LAST_IP;
+	}
+	if (entry->logincount != acc->logincount) {
+		entry->logincount = acc->logincount;
+		entry->dirty |= ACCOUNT_DIRTY_LOGINCOUNT;
+	}
+	// a login lifts expired bans, always written
+	entry->unban_time = acc->unban_time;
+	entry->dirty |= ACCOUNT_DIRTY_UNBAN_TIME;
+
+	if (db_size(db->cache) >= ACCOUNT_FLUSH_BATCH)
+		account->flush_batch(db);
+	return true;
+}
+
+/// write all pending login updates
+static void account_db_sql_flush(AccountDB *self)
+{
+	AccountDB_SQL* db = (AccountDB_SQL*)self;
+
+	nullpo_retv(db);
+	if (db->cache == NULL)
+		return;
+
+	while (db_size(db->cache) > 0) {
+		if (!account->flush_batch(db))
+			break; // kept for the next flush
+	}
 }
 
 /// retrieve data from db and store it in the provided data structure
@@ -518,9 +612,122 @@ static bool account_mmo_auth_fromsql(AccountDB_SQL *db, struct mmo_account *acc,
 
 	SQL->FreeResult(sql_handle);
 
+	account->cache_apply(db, acc);
+
 	return true;
 }
 
+/// overwrites the login fields of acc that have an update pending
+static void account_cache_apply(AccountDB_SQL *db, struct mmo_account *acc)
+{
+	const struct account_cache_entry *entry;
+
+	nullpo_retv(db);
+	nullpo_retv(acc);
+	if (db->cache == NULL || (entry = idb_get(db->cache, acc->account_id)) == NULL)
+		return;
+
+	if ((entry->dirty & ACCOUNT_DIRTY_LASTLOGIN) != 0)
+		safestrncpy(acc->lastlogin, entry->lastlogin, sizeof(acc->lastlogin));
+	if ((entry->dirty & ACCOUNT_DIRTY_LAST_IP) != 0)
+		safestrncpy(acc->last_ip, entry->last_ip, sizeof(acc->last_ip));
+	if ((entry->dirty & ACCOUNT_DIRTY_LOGINCOUNT) != 0)
+		acc->logincount = entry->logincount;
+	if ((entry->dirty & ACCOUNT_DIRTY_UNBAN_TIME) != 0)
+		acc->unban_time = entry->unban_time;
+}
+
+/**
+ * Writes up to ACCOUNT_FLUSH_BATCH pending login updates with a single query.
+ *
+ * @return false if the query failed, the updates are kept in that case.
+ */
+static bool account_flush_batch(AccountDB_SQL *db)
+{
+	int account_ids[ACCOUNT_FLUSH_BATCH];
+	int count = 0;
+	struct DBIterator *iter;
+	struct account_cache_entry *entry;
+	StringBuf buf;
+	int64 tick, latency;
+
+	nullpo_ret(db);
+	if (db->cache == NULL || db_size(db->cache) == 0)
+		return true;
+
+	StrBuf->Init(&buf);
+	StrBuf->Printf(&buf, "UPDATE `%s` AS `l` JOIN (", db->account_db);
+
+	iter = db_iterator(db->cache);
+	for (entry = dbi_first(iter); dbi_exists(iter) && count < ACCOUNT_FLUSH_BATCH; entry = dbi_next(iter)) {
+		char esc_lastlogin[sizeof(entry->lastlogin) * 2 + 1];
+		char esc_last_ip[sizeof(entry->last_ip) * 2 + 1];
+
+		SQL->EscapeString(db->accounts, esc_lastlogin, entry->lastlogin);
+		SQL->EscapeString(db->accounts, esc_last_ip, entry->last_ip);
+		if (count > 0)
+			StrBuf->AppendStr(&buf, " UNION ALL ");
+		StrBuf->Printf(&buf, "SELECT %d AS `account_id`, %u AS `dirty`, '%s' AS `lastlogin`, '%s' AS `last_ip`, %u AS `logincount`, %"PRId64" AS `unban_time`",
+			entry->account_id, entry->dirty, esc_lastlogin, esc_last_ip, entry->logincount, (int64)entry->unban_time);
+		account_ids[count++] = entry->account_id;
+	}
+	dbi_destroy(iter);
+
+	StrBuf->Printf(&buf, ") AS `p` ON `l`.`account_id` = `p`.`account_id` SET"
+		" `l`.`lastlogin` = IF(`p`.`dirty` & %d, `p`.`lastlogin`, `l`.`lastlogin`),"
+		" `l`.`last_ip` = IF(`p`.`dirty` & %d, `p`.`last_ip`, `l`.`last_ip`),"
+		" `l`.`logincount` = IF(`p`.`dirty` & %d, `p`.`logincount`, `l`.`logincount`),"
+		" `l`.`unban_time` = IF(`p`.`dirty` & %d, `p`.`unban_time`, `l`.`unban_time`)",
+		ACCOUNT_DIRTY_LASTLOGIN, ACCOUNT_DIRTY_LAST_IP, ACCOUNT_DIRTY_LOGINCOUNT, ACCOUNT_DIRTY_UNBAN_TIME);
+
+	tick = timer->gettick_nocache();
+	if (SQL_ERROR == SQL->QueryStr(db->accounts, StrBuf->Value(&buf))) {
+		Sql_ShowDebug(db->accounts);
+		StrBuf->Destroy(&buf);
+		return false;
+	}
+	latency = timer->gettick_nocache() - tick;
+	StrBuf->Destroy(&buf);
+
+	for (int i = 0; i < count; i++)
+		idb_remove(db->cache, account_ids[i]);
+
+	db->stats.flushes++;
+	db->stats.rows += count;
+	db->stats.max_rows = max(db->stats.max_rows, count);
+	db->stats.latency_total += latency;
+	db->stats.latency_max = max(db->stats.latency_max, latency);
+	return true;
+}
+
+static int account_flush_timer(int tid, int64 tick, int id, intptr_t data)
+{
+	AccountDB_SQL *db = (AccountDB_SQL *)data;
+
+	nullpo_ret(db);
+	db->vtable.flush(&db->vtable);
+
+	if (db->stats.rows != db->stats.reported && DIFF_TICK(tick, db->stats.report_tick) >= 60 * 1000)
+		account->flush_report(db);
+	return 0;
+}
+
+static void account_flush_report(AccountDB_SQL *db)
+{
+	const struct account_flush_stats *stats;
+
+	nullpo_retv(db);
+	stats = &db->stats;
+	if (stats->flushes == 0)
+		return;
+
+	ShowInfo("Account login updates: %d written in %d flushes (largest %d, %d merged), %u pending, latency avg %"PRId64" ms, max %"PRId64" ms.\n",
+		stats->rows, stats->flushes, stats->max_rows, stats->buffered, db->cache != NULL ? db_size(db->cache) : 0,
+		stats->latency_total / stats->flushes, stats->latency_max);
+	db->stats.reported = stats->rows;
+	db->stats.report_tick = timer->gettick();
+}
+
 static bool account_mmo_auth_tosql(AccountDB_SQL *db, const struct mmo_account *acc, bool is_new)
 {
 	struct Sql *sql_handle;
@@ -829,6 +1036,10 @@ void account_defaults(void)
 	account->mmo_save_accreg2 = account_mmo_save_accreg2;
 	account->mmo_auth_fromsql = account_mmo_auth_fromsql;
 	account->mmo_auth_tosql = account_mmo_auth_tosql;
+	account->cache_apply = account_cache_apply;
+	account->flush_batch = account_flush_batch;
+	account->flush_timer = account_flush_timer;
+	account->flush_report = account_flush_report;
 
 	account->db_sql = account_db_sql;
 	account->db_sql_init = account_db_sql_init;
@@ -838,6 +1049,8 @@ void account_defaults(void)
 	account->db_sql_create = account_db_sql_create;
 	account->db_sql_remove = account_db_sql_remove;
 	account->db_sql_save = account_db_sql_save;
+	account->db_sql_save_login = account_db_sql_save_login;
+	account->db_sql_flush = account_db_sql_flush;
 	account->db_sql_load_num = account_db_sql_load_num;
 	account->db_sql_load_str = account_db_sql_load_str;
 	account->db_sql_iterator = account_db_sql_iterator;
@@ -25,6 +25,7 @@
 #include "common/mmo.h" // ACCOUNT_REG2_NUM
 
 /* Forward declarations */
+struct DBMap; // common/db.h
 struct Sql; // common/sql.h
 
 /* Forward Declarations */
@@ -131,6 +132,22 @@ struct AccountDB
 	/// @return true if successful
 	bool (*save)(AccountDB* self, const struct mmo_account* acc);
 
+	/// Records the fields changed by a successful login
+	/// (lastlogin, last_ip, logincount and unban_time).
+	/// The update may be kept in memory and written together with the
+	/// updates of other accounts on the next flush, loads return the
+	/// pending values in the meantime.
+	///
+	/// @param self Database
+	/// @param acc Account data
+	/// @return true if successful
+	bool (*save_login)(AccountDB* self, const struct mmo_account* acc);
+
+	/// Writes all pending login updates to the database.
+	///
+	/// @param self Database
+	void (*flush)(AccountDB* self);
+
 	/// Finds an account with account_id and copies it to acc.
 	///
 	/// @param self Database
@@ -154,6 +171,38 @@ struct AccountDB
 	AccountDBIterator* (*iterator)(AccountDB* self);
 };
 
+#define ACCOUNT_FLUSH_BATCH 500 ///< Maximum amount of accounts updated by one flush query
+
+/// Login fields of an account waiting to be flushed.
+enum account_dirty_field {
+	ACCOUNT_DIRTY_LASTLOGIN  = 0x1,
+	ACCOUNT_DIRTY_LAST_IP    = 0x2,
+	ACCOUNT_DIRTY_LOGINCOUNT = 0x4,
+	ACCOUNT_DIRTY_UNBAN_TIME = 0x8,
+	ACCOUNT_DIRTY_LOGIN      = ACCOUNT_DIRTY_LASTLOGIN | ACCOUNT_DIRTY_LAST_IP | ACCOUNT_DIRTY_LOGINCOUNT | ACCOUNT_DIRTY_UNBAN_TIME,
+};
+
+/// Account with login updates not written yet.
+struct account_cache_entry {
+	int account_id;
+	char lastlogin[24];
+	char last_ip[16];
+	unsigned int logincount;
+	time_t unban_time;
+	uint32 dirty;                ///< enum account_dirty_field
+};
+
+struct account_flush_stats {
+	int flushes;                 ///< flush queries executed
+	int rows;                    ///< account updates written
+	int max_rows;                ///< largest flush
+	int buffered;                ///< login updates merged into an already pending update
+	int64 latency_total;         ///< sum of flush durations, in milliseconds
+	int64 latency_max;
+	int reported;                ///< rows at the time of the last report
+	int64 report_tick;
+};
+
 typedef struct AccountDB_SQL
 {
 	AccountDB vtable;    // public interface
@@ -172,6 +221,11 @@ typedef struct AccountDB_SQL
 	char account_db[32];
 	char global_acc_reg_num_db[32];
 	char global_acc_reg_str_db[32];
+	int login_flush_interval;    // milliseconds between flushes of login updates (0: written immediately)
+
+	struct DBMap *cache;         // int account_id -> struct account_cache_entry*
+	int flush_timer;
+	struct account_flush_stats stats;
 } AccountDB_SQL;
 
 /// internal structure
@@ -192,6 +246,10 @@ struct account_interface {
 	void (*mmo_save_accreg2) (AccountDB* self, int fd, int account_id, int char_id);
 	bool (*mmo_auth_fromsql) (AccountDB_SQL* db, struct mmo_account* acc, int account_id);
 	bool (*mmo_auth_tosql) (AccountDB_SQL* db, const struct mmo_account* acc, bool is_new);
+	void (*cache_apply) (AccountDB_SQL* db, struct mmo_account* acc);
+	bool (*flush_batch) (AccountDB_SQL* db);
+	int (*flush_timer) (int tid, int64 tick, int id, intptr_t data);
+	void (*flush_report) (AccountDB_SQL* db);
 
 	AccountDB* (*db_sql) (void);
 	bool (*db_sql_init) (AccountDB* self);
@@ -201,6 +259,8 @@ struct account_interface {
 	bool (*db_sql_create) (AccountDB* self, struct mmo_account* acc);
 	bool (*db_sql_remove) (AccountDB* self, const int account_id);
 	bool (*db_sql_save) (AccountDB* self, const struct mmo_account* acc);
+	bool (*db_sql_save_login) (AccountDB* self, const struct mmo_account* acc);
+	void (*db_sql_flush) (AccountDB* self);
 	bool (*db_sql_load_num) (AccountDB* self, struct mmo_account* acc, const int account_id);
 	bool (*db_sql_load_str) (AccountDB* self, struct mmo_account* acc, const char* userid);
 	AccountDBIterator* (*db_sql_iterator) (AccountDB* self);
@@ -0,0 +1,621 @@
+/**
+ * This file is part of Hercules.
+ * http://herc.ws - http://github.com/HerculesWS/Hercules
+ *
+ * Copyright (C) 2026 Hercules Dev Team
+ *
+ * Hercules is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#define HERCULES_CORE
+
+#include "dnsbl.h"
+
+#include "login/login.h"
+#include "common/cbasetypes.h"
+#include "common/conf.h"
+#include "common/db.h"
+#include "common/memmgr.h"
+#include "common/mutex.h"
+#include "common/nullpo.h"
+#include "common/showmsg.h"
+#include "common/socket.h"
+#include "common/strlib.h"
+#include "common/thread.h"
+#include "common/timer.h"
+#include "common/utils.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef WIN32
+#	include "common/winapi.h"
+#else
+#	include <arpa/inet.h>
+#	include <netdb.h>
+#	include <netinet/in.h>
+#	include <sys/socket.h>
+#	include <sys/time.h>
+#	include <unistd.h>
+#endif
+
+/**
+ * DNS blacklist checks.
+ *
+ * Lookups are done by worker threads, so that a slow dnsbl server doesn't
+ * block the login server. Sessions of the ip being checked are held by
+ * lclif->parse until all answers arrived or the timeout passed.
+ *
+ * The worker threads only touch dnsbl->queries (under dnsbl->mutex) and
+ * never use the memory manager, everything else belongs to the main thread.
+ */
+
+static struct dnsbl_interface dnsbl_s;
+struct dnsbl_interface *dnsbl;
+
+static void dnsbl_init(void)
+{
+	dnsbl->cache = uidb_alloc(DB_OPT_RELEASE_DATA);
+	dnsbl->requests = uidb_alloc(DB_OPT_RELEASE_DATA);
+	dnsbl->mutex = mutex->create();
+	dnsbl->cond = mutex->cond_create();
+	memset(&dnsbl->stats, 0, sizeof(dnsbl->stats));
+
+	timer->add_func_list(dnsbl->cleanup, "dnsbl->cleanup");
+	dnsbl->cleanup_timer_id = timer->add_interval(timer->gettick() + 60 * 1000, dnsbl->cleanup, 0, 0, 60 * 1000);
+}
+
+static void dnsbl_final(void)
+{
+	dnsbl->stop_workers();
+	dnsbl->report();
+
+	if (dnsbl->cleanup_timer_id != INVALID_TIMER) {
+		timer->delete_(dnsbl->cleanup_timer_id, dnsbl->cleanup);
+		dnsbl->cleanup_timer_id = INVALID_TIMER;
+	}
+	if (dnsbl->cond != NULL) {
+		mutex->cond_destroy(dnsbl->cond);
+		dnsbl->cond = NULL;
+	}
+	if (dnsbl->mutex != NULL) {
+		mutex->destroy(dnsbl->mutex);
+		dnsbl->mutex = NULL;
+	}
+	if (dnsbl->cache != NULL) {
+		db_destroy(dnsbl->cache);
+		dnsbl->cache = NULL;
+	}
+	if (dnsbl->requests != NULL) {
+		db_destroy(dnsbl->requests);
+		dnsbl->requests = NULL;
+	}
+}
+
+/**
+ * Reads the lookup settings in 'login_configuration.permission.DNS_blacklist'.
+ *
+ * @param filename Path to configuration file (used in error and warning messages).
+ * @param config   The current config being parsed.
+ * @param imported Whether the current config is imported from another file.
+ *
+ * @retval false in case of error.
+ */
+static bool dnsbl_config_read(const char *filename, struct config_t *config, bool imported)
+{
+	struct config_setting_t *setting = NULL;
+	const char *str = NULL;
+
+	nullpo_retr(false, filename);
+	nullpo_retr(false, config);
+
+	if ((setting = libconfig->lookup(config, "login_configuration/permission/DNS_blacklist")) == NULL)
+		return imported;
+
+	libconfig->setting_lookup_int(setting, "cache_ttl_listed", &dnsbl->cache_ttl_listed);
+	libconfig->setting_lookup_int(setting, "cache_ttl_clean", &dnsbl->cache_ttl_clean);
+	libconfig->setting_lookup_int(setting, "timeout", &dnsbl->timeout);
+	if (libconfig->setting_lookup_int(setting, "workers", &dnsbl->worker_setting) == CONFIG_TRUE
+	 && (dnsbl->worker_setting < 1 || dnsbl->worker_setting > DNSBL_MAX_WORKERS)) {
+		ShowWarning("dnsbl_config_read: Invalid workers value %d, capping to 1 ~ %d.\n", dnsbl->worker_setting, DNSBL_MAX_WORKERS);
+		dnsbl->worker_setting = cap_value(dnsbl->worker_setting, 1, DNSBL_MAX_WORKERS);
+	}
+
+	if (libconfig->setting_lookup_string(setting, "resolver", &str) == CONFIG_TRUE) {
+		char host[64];
+		const char *port = strchr(str, ':');
+
+		dnsbl->resolver_ip = 0;
+		dnsbl->resolver_port = 53;
+		if (port != NULL) {
+			safestrncpy(host, str, min((size_t)(port - str + 1), sizeof(host)));
+			dnsbl->resolver_port = (uint16)atoi(port + 1);
+		} else {
+			safestrncpy(host, str, sizeof(host));
+		}
+		if (host[0] != '\0' && (dnsbl->resolver_ip = sockt->host2ip(host)) == 0)
+			ShowWarning("dnsbl_config_read: Can't resolve resolver '%s', using the system resolver.\n", host);
+	}
+
+	return true;
+}
+
+/**
+ * Starts the resolver threads, if they aren't running yet.
+ *
+ * @retval false if no thread could be started.
+ */
+static bool dnsbl_start_workers(void)
+{
+	if (dnsbl->worker_count > 0)
+		return true;
+
+	dnsbl->running = true;
+	for (int i = 0; i < dnsbl->worker_setting; i++) {
+		if ((dnsbl->workers[dnsbl->worker_count] = thread->create(dnsbl->worker, NULL)) == NULL) {
+			ShowError("dnsbl_start_workers: Failed to start resolver thread.\n");
+			break;
+		}
+		dnsbl->worker_count++;
+	}
+	return dnsbl->worker_count > 0;
+}
+
+static void dnsbl_stop_workers(void)
+{
+	if (dnsbl->worker_count == 0)
+		return;
+
+	mutex->lock(dnsbl->mutex);
+	dnsbl->running = false;
+	mutex->unlock(dnsbl->mutex);
+	mutex->cond_broadcast(dnsbl->cond);
+
+	// threads stuck on the system resolver are waited for, the same as the old blocking lookup
+	for (int i = 0; i < dnsbl->worker_count; i++)
+		thread->wait(dnsbl->workers[i], NULL);
+	dnsbl->worker_count = 0;
+
+	memset(dnsbl->queries, 0, sizeof(dnsbl->queries));
+	dnsbl->queued = 0;
+	dnsbl->done = 0;
+	db_clear(dnsbl->requests);
+}
+
+/**
+ * Checks an ip against the configured dnsbl servers, without blocking.
+ *
+ * Starts a lookup the first time an ip is seen, answers from the cache
+ * afterwards. Lookups that don't finish in time let the ip through.
+ *
+ * @param ip The ip to check (host byte order).
+ * @return DNSBL_PENDING while the lookup is in progress, DNSBL_CLEAN or DNSBL_LISTED afterwards.
+ */
+static enum dnsbl_status dnsbl_check(uint32 ip)
+{
+	const struct dnsbl_cache_entry *entry;
+	struct dnsbl_request *req;
+	enum dnsbl_status result;
+
+	dnsbl->collect();
+
+	if ((entry = uidb_get(dnsbl->cache, ip)) != NULL && DIFF_TICK(entry->expire_tick, timer->gettick()) > 0) {
+		dnsbl->stats.cache_hits++;
+		return entry->listed ? DNSBL_LISTED : DNSBL_CLEAN;
+	}
+
+	if ((req = uidb_get(dnsbl->requests, ip)) == NULL)
+		return dnsbl->request(ip) ? DNSBL_PENDING : DNSBL_CLEAN;
+
+	if (DIFF_TICK(timer->gettick(), req->timeout_tick) < 0)
+		return DNSBL_PENDING;
+
+	result = req->listed ? DNSBL_LISTED : DNSBL_CLEAN;
+	dnsbl->complete(req, true);
+	return result;
+}
+
+/**
+ * Queues the queries of an ip on all the dnsbl servers.
+ *
+ * @param ip The ip to check (host byte order).
+ * @retval false if there is nothing to wait for.
+ */
+static bool dnsbl_request(uint32 ip)
+{
+	const int count = VECTOR_LENGTH(login->config->dnsbl_servers);
+	struct dnsbl_request *req;
+	int free_slots = 0;
+
+	if (count == 0)
+		return false;
+
+	if (!dnsbl->start_workers()) {
+		dnsbl->stats.overflows++;
+		return false;
+	}
+
+	CREATE(req, struct dnsbl_request, 1);
+	req->ip = ip;
+	req->serial = ++dnsbl->next_serial;
+	req->pending = count;
+	req->start_tick = timer->gettick();
+	req->timeout_tick = req->start_tick + dnsbl->timeout;
+
+	mutex->lock(dnsbl->mutex);
+	for (int i = 0; i < DNSBL_MAX_QUERIES; i++) {
+		if (dnsbl->queries[i].state == DNSBL_QUERY_FREE)
+			free_slots++;
+	}
+	if (free_slots < count) {
+		mutex->unlock(dnsbl->mutex);
+		aFree(req);
+		dnsbl->stats.overflows++;
+		return false;
+	}
+	for (int i = 0, server = 0; i < DNSBL_MAX_QUERIES && server < count; i++) {
+		struct dnsbl_query *query = &dnsbl->queries[i];
+
+		if (query->state != DNSBL_QUERY_FREE)
+			continue;
+
+		// dnsbl zones are queried with the reversed octets of the ip
+		snprintf(query->name, sizeof(query->name), "%u.%u.%u.%u.%s",
+			ip & 0xFF, (ip >> 8) & 0xFF, (ip >> 16) & 0xFF, ip >> 24, trim(VECTOR_INDEX(login->config->dnsbl_servers, server)));
+		query->ip = ip;
+		query->serial = req->serial;
+		query->resolver_ip = dnsbl->resolver_ip;
+		query->resolver_port = dnsbl->resolver_port;
+		query->timeout = dnsbl->timeout;
+		query->answered = false;
+		query->listed = false;
+		query->state = DNSBL_QUERY_QUEUED;
+		dnsbl->queued++;
+		server++;
+	}
+	mutex->unlock(dnsbl->mutex);
+	mutex->cond_broadcast(dnsbl->cond);
+
+	uidb_put(dnsbl->requests, ip, req);
+	dnsbl->stats.checks++;
+	return true;
+}
+
+/**
+ * Collects the answers of the worker threads, completing the lookups that got all of them.
+ */
+static void dnsbl_collect(void)
+{
+	if (dnsbl->worker_count == 0)
+		return;
+
+	mutex->lock(dnsbl->mutex);
+	for (int i = 0; i < DNSBL_MAX_QUERIES && dnsbl->done > 0; i++) {
+		struct dnsbl_query *query = &dnsbl->queries[i];
+		struct dnsbl_request *req;
+
+		if (query->state != DNSBL_QUERY_DONE)
+			continue;
+
+		// answers of timed out lookups are dropped
+		if ((req = uidb_get(dnsbl->requests, query->ip)) != NULL && req->serial == query->serial) {
+			if (query->listed)
+				req->listed = true;
+			if (!query->answered)
+				req->failed = true;
+			if (--req->pending == 0)
+				dnsbl->complete(req, false);
+		}
+		query->state = DNSBL_QUERY_FREE;
+		dnsbl->done--;
+	}
+	mutex->unlock(dnsbl->mutex);
+}
+
+/**
+ * Caches the result of a lookup and removes it from dnsbl->requests.
+ *
+ * @param req       The lookup (freed by this function).
+ * @param timed_out Whether not all answers arrived in time.
+ */
+static void dnsbl_complete(struct dnsbl_request *req, bool timed_out)
+{
+	int64 latency;
+	int ttl;
+
+	nullpo_retv(req);
+
+	latency = DIFF_TICK(timer->gettick(), req->start_tick);
+	dnsbl->stats.completed++;
+	dnsbl->stats.latency_total += latency;
+	dnsbl->stats.latency_max = max(dnsbl->stats.latency_max, latency);
+	if (timed_out || req->failed)
+		dnsbl->stats.timeouts++;
+	if (req->listed)
+		dnsbl->stats.listed++;
+
+	if (req->listed)
+		ttl = dnsbl->cache_ttl_listed;
+	else if (timed_out || req->failed)
+		ttl = min(DNSBL_FAILED_TTL, dnsbl->cache_ttl_clean);
+	else
+		ttl = dnsbl->cache_ttl_clean;
+	dnsbl->cache_store(req->ip, req->listed, ttl);
+
+	uidb_remove(dnsbl->requests, req->ip);
+}
+
+/**
+ * Stores the blacklist status of an ip.
+ *
+ * @param ip     The ip (host byte order).
+ * @param listed Whether the ip is blacklisted.
+ * @param ttl    Seconds the status is kept.
+ */
+static void dnsbl_cache_store(uint32 ip, bool listed, int ttl)
+{
+	struct dnsbl_cache_entry *entry;
+
+	if ((entry = uidb_get(dnsbl->cache, ip)) == NULL) {
+		CREATE(entry, struct dnsbl_cache_entry, 1);
+		uidb_put(dnsbl->cache, ip, entry);
+	}
+	entry->listed = listed;
+	entry->expire_tick = timer->gettick() + (int64)ttl * 1000;
+}
+
+/// Removes expired cache entries and reports lookup statistics.
+static int dnsbl_cleanup(int tid, int64 tick, int id, intptr_t data)
+{
+	struct DBIterator *iter = db_iterator(dnsbl->cache);
+
+	for (struct dnsbl_cache_entry *entry = dbi_first(iter); dbi_exists(iter); entry = dbi_next(iter)) {
+		if (DIFF_TICK(entry->expire_tick, tick) <= 0)
+			dbi_remove(iter);
+	}
+	dbi_destroy(iter);
+
+	if (dnsbl->stats.checks != dnsbl->stats.reported)
+		dnsbl->report();
+	return 0;
+}
+
+static void dnsbl_report(void)
+{
+	const struct dnsbl_stats *stats = &dnsbl->stats;
+
+	if (stats->checks == 0 && stats->cache_hits == 0)
+		return;
+
+	ShowInfo("DNSBL: %d lookups (%d listed, %d timed out, %d not queued), %d cache hits, %u cached ips, latency avg %"PRId64" ms, max %"PRId64" ms.\n",
+		stats->checks, stats->listed, stats->timeouts, stats->overflows, stats->cache_hits, db_size(dnsbl->cache),
+		stats->completed > 0 ? stats->latency_total / stats->completed : 0, stats->latency_max);
+	dnsbl->stats.reported = stats->checks;
+}
+
+/// Resolver thread: answers queued queries until dnsbl->stop_workers is called.
+static void *dnsbl_worker(void *param)
+{
+	mutex->lock(dnsbl->mutex);
+	while (dnsbl->running) {
+		struct dnsbl_query *query = NULL;
+		struct dnsbl_query copy;
+
+		for (int i = 0; i < DNSBL_MAX_QUERIES && dnsbl->queued > 0; i++) {
+			if (dnsbl->queries[i].state == DNSBL_QUERY_QUEUED) {
+				query = &dnsbl->queries[i];
+				break;
+			}
+		}
+		if (query == NULL) {
+			mutex->cond_wait(dnsbl->cond, dnsbl->mutex, -1);
+			continue;
+		}
+
+		query->state = DNSBL_QUERY_RUNNING;
+		dnsbl->queued--;
+		memcpy(&copy, query, sizeof(copy));
+
+		// resolve without holding the lock, the slot isn't touched by the main thread while running
+		mutex->unlock(dnsbl->mutex);
+		dnsbl->resolve(&copy);
+		mutex->lock(dnsbl->mutex);
+
+		query->answered = copy.answered;
+		query->listed = copy.listed;
+		query->state = DNSBL_QUERY_DONE;
+		dnsbl->done++;
+	}
+	mutex->unlock(dnsbl->mutex);
+	return NULL;
+}
+
+/**
+ * Resolves one query (called from the resolver threads).
+ *
+ * Any address record means the ip is listed on that dnsbl server.
+ *
+ * @param query The query, answered and listed are filled in.
+ * @return Whether an answer was received.
+ */
+static bool dnsbl_resolve(struct dnsbl_query *query)
+{
+	struct addrinfo hints;
+	struct addrinfo *res = NULL;
+	int ret;
+
+	nullpo_retr(false, query);
+
+	if (query->resolver_ip != 0)
+		return dnsbl->resolve_udp(query);
+
+	memset(&hints, 0, sizeof(hints));
+	hints.ai_family = AF_INET;
+	hints.ai_socktype = SOCK_STREAM;
+
+	ret = getaddrinfo(query->name, NULL, &hints, &res);
+	if (ret == 0) {
+		freeaddrinfo(res);
+		query->answered = true;
+		query->listed = true;
+	} else if (ret == EAI_NONAME
+#ifdef EAI_NODATA
+	        || ret == EAI_NODATA
+#endif // EAI_NODATA
+	) {
+		query->answered = true;
+		query->listed = false;
+	} else {
+		query->answered = false;
+		query->listed = false;
+	}
+	return query->answered;
+}
+
+/**
+ * Resolves one query by asking the configured DNS server directly (called from the resolver threads).
+ *
+ * @param query The query, answered and listed are filled in.
+ * @return Whether an answer was received.
+ */
+static bool dnsbl_resolve_udp(struct dnsbl_query *query)
+{
+	uint8 buf[512];
+	size_t len = 12;
+	uint16 id;
+	struct sockaddr_in addr;
+#ifdef WIN32
+	SOCKET fd;
+	DWORD timeout;
+#else
+	int fd;
+	struct timeval timeout;
+#endif
+
+	nullpo_retr(false, query);
+	query->answered = false;
+	query->listed = false;
+	id = (uint16)(query->serial * 31 + query->ip);
+
+	// header: id, recursion desired, one question
+	memset(buf, 0, len);
+	buf[0] = (uint8)(id >> 8);
+	buf[1] = (uint8)id;
+	buf[2] = 0x01;
+	buf[5] = 1;
+
+	// question: name as length-prefixed labels, type A, class IN
+	for (const char *label = query->name; *label != '\0'; ) {
+		const char *end = strchr(label, '.');
+		const size_t label_len = (end != NULL) ? (size_t)(end - label) : strlen(label);
+
+		if (label_len == 0 || label_len > 63 || len + label_len + 1 + 5 > sizeof(buf))
+			return false;
+		buf[len++] = (uint8)label_len;
+		memcpy(buf + len, label, label_len);
+		len += label_len;
+		label += label_len;
+		if (*label == '.')
+			label++;
+	}
+	buf[len++] = 0;
+	buf[len++] = 0; buf[len++] = 1;
+	buf[len++] = 0; buf[len++] = 1;
+
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = htonl(query->resolver_ip);
+	addr.sin_port = htons(query->resolver_port);
+
+	fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+#ifdef WIN32
+	if (fd == INVALID_SOCKET)
+		return false;
+	timeout = query->timeout;
+#else
+	if (fd < 0)
+		return false;
+	timeout.tv_sec = query->timeout / 1000;
+	timeout.tv_usec = (query->timeout % 1000) * 1000;
+#endif
+	setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, (const char *)&timeout, sizeof(timeout));
+
+	if (sendto(fd, (const char *)buf, (int)len, 0, (struct sockaddr *)&addr, sizeof(addr)) == (int)len) {
+		// answers to other ids (late answers of a previous query on this port) are skipped
+		for (int tries = 0; tries < 4; tries++) {
+			const int received = (int)recvfrom(fd, (char *)buf, sizeof(buf), 0, NULL, NULL);
+			int rcode, answers;
+
+			if (received < 12)
+				break;
+			if (buf[0] != (uint8)(id >> 8) || buf[1] != (uint8)id || (buf[2] & 0x80) == 0)
+				continue;
+
+			rcode = buf[3] & 0x0F;
+			answers = (buf[6] << 8) | buf[7];
+			if (rcode == 0 || rcode == 3) { // NOERROR or NXDOMAIN
+				query->answered = true;
+				query->listed = (rcode == 0 && answers > 0);
+			}
+			break;
+		}
+	}
+
+#ifdef WIN32
+	closesocket(fd);
+#else
+	close(fd);
+#endif
+	return query->answered;
+}
+
+void dnsbl_defaults(void)
+{
+	dnsbl = &dnsbl_s;
+
+	dnsbl->cache = NULL;
+	dnsbl->requests = NULL;
+	memset(dnsbl->queries, 0, sizeof(dnsbl->queries));
+	dnsbl->queued = 0;
+	dnsbl->done = 0;
+	dnsbl->next_serial = 0;
+	dnsbl->mutex = NULL;
+	dnsbl->cond = NULL;
+	dnsbl->worker_count = 0;
+	dnsbl->running = false;
+	dnsbl->cleanup_timer_id = INVALID_TIMER;
+	memset(&dnsbl->stats, 0, sizeof(dnsbl->stats));
+
+	dnsbl->cache_ttl_listed = 3600;
+	dnsbl->cache_ttl_clean = 600;
+	dnsbl->timeout = 2000;
+	dnsbl->worker_setting = 4;
+	dnsbl->resolver_ip = 0;
+	dnsbl->resolver_port = 53;
+
+	dnsbl->init = dnsbl_init;
+	dnsbl->final = dnsbl_final;
+	dnsbl->config_read = dnsbl_config_read;
+	dnsbl->start_workers = dnsbl_start_workers;
+	dnsbl->stop_workers = dnsbl_stop_workers;
+	dnsbl->check = dnsbl_check;
+	dnsbl->request = dnsbl_request;
+	dnsbl->collect = dnsbl_collect;
+	dnsbl->complete = dnsbl_complete;
+	dnsbl->cache_store = dnsbl_cache_store;
+	dnsbl->cleanup = dnsbl_cleanup;
+	dnsbl->report = dnsbl_report;
+	dnsbl->worker = dnsbl_worker;
+	dnsbl->resolve = dnsbl_resolve;
+	dnsbl->resolve_udp = dnsbl_resolve_udp;
+}
@@ -0,0 +1,144 @@
+/**
+ * This file is part of Hercules.
+ * http://herc.ws - http://github.com/HerculesWS/Hercules
+ *
+ * Copyright (C) 2026 Hercules Dev Team
+ *
+ * Hercules is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LOGIN_DNSBL_H
+#define LOGIN_DNSBL_H
+
+#include "common/cbasetypes.h"
+#include "common/hercules.h"
+
+/* Forward Declarations */
+struct DBMap; // common/db.h
+struct config_t; // common/conf.h
+struct mutex_data; // common/mutex.h
+struct cond_data; // common/mutex.h
+struct thread_handle; // common/thread.h
+
+#define DNSBL_MAX_WORKERS 16  ///< Maximum amount of resolver threads
+#define DNSBL_MAX_QUERIES 512 ///< Maximum amount of queries queued or in progress
+#define DNSBL_FAILED_TTL 10   ///< Seconds an ip is let through after its lookup failed or timed out
+
+/// Result of a DNS blacklist check.
+enum dnsbl_status {
+	DNSBL_UNCHECKED = 0, ///< Not checked yet
+	DNSBL_PENDING,       ///< Waiting for answers
+	DNSBL_CLEAN,         ///< Not listed (or no answer before the timeout)
+	DNSBL_LISTED,        ///< Listed on at least one of the dnsbl servers
+};
+
+/// State of a slot in dnsbl_interface::queries.
+enum dnsbl_query_state {
+	DNSBL_QUERY_FREE = 0, ///< Unused
+	DNSBL_QUERY_QUEUED,   ///< Waiting for a worker
+	DNSBL_QUERY_RUNNING,  ///< Being resolved by a worker
+	DNSBL_QUERY_DONE,     ///< Answered, waiting to be collected by the main thread
+};
+
+/// Query of one ip on one dnsbl server, resolved by a worker thread.
+struct dnsbl_query {
+	enum dnsbl_query_state state;
+	uint32 ip;
+	uint32 serial;        ///< dnsbl_request::serial of the owner
+	char name[256];       ///< reversed ip + dnsbl zone
+	uint32 resolver_ip;   ///< DNS server to query over UDP (0: system resolver)
+	uint16 resolver_port;
+	int timeout;          ///< UDP answer timeout in milliseconds
+	bool answered;        ///< false if the resolver failed or timed out
+	bool listed;
+};
+
+/// Blacklist check of one ip, in progress.
+struct dnsbl_request {
+	uint32 ip;
+	uint32 serial;
+	int pending;          ///< queries not answered yet
+	bool listed;
+	bool failed;          ///< at least one query got no answer
+	int64 start_tick;
+	int64 timeout_tick;
+};
+
+/// Cached blacklist status of one ip.
+struct dnsbl_cache_entry {
+	bool listed;
+	int64 expire_tick;
+};
+
+struct dnsbl_stats {
+	int checks;           ///< lookups started
+	int cache_hits;
+	int listed;
+	int timeouts;         ///< lookups that missed at least one answer
+	int overflows;        ///< checks let through because the query queue was full
+	int64 latency_total;  ///< sum of lookup latencies, in milliseconds
+	int64 latency_max;
+	int completed;
+	int reported;         ///< checks at the time of the last report
+};
+
+/**
+ * Dnsbl.c Interface
+ **/
+struct dnsbl_interface {
+	struct DBMap *cache;      ///< uint32 ip -> struct dnsbl_cache_entry *
+	struct DBMap *requests;   ///< uint32 ip -> struct dnsbl_request *
+	struct dnsbl_query queries[DNSBL_MAX_QUERIES]; ///< guarded by mutex
+	int queued;               ///< amount of DNSBL_QUERY_QUEUED queries, guarded by mutex
+	int done;                 ///< amount of DNSBL_QUERY_DONE queries, guarded by mutex
+	uint32 next_serial;
+	struct mutex_data *mutex;
+	struct cond_data *cond;
+	struct thread_handle *workers[DNSBL_MAX_WORKERS];
+	int worker_count;
+	bool running;             ///< guarded by mutex
+	int cleanup_timer_id;
+	struct dnsbl_stats stats;
+
+	/* config */
+	int cache_ttl_listed;     ///< seconds a listed answer is kept
+	int cache_ttl_clean;      ///< seconds a clean answer is kept
+	int timeout;              ///< milliseconds to wait for all answers
+	int worker_setting;       ///< amount of resolver threads
+	uint32 resolver_ip;       ///< DNS server queried over UDP (0: system resolver)
+	uint16 resolver_port;
+
+	void (*init) (void);
+	void (*final) (void);
+	bool (*config_read) (const char *filename, struct config_t *config, bool imported);
+	bool (*start_workers) (void);
+	void (*stop_workers) (void);
+	enum dnsbl_status (*check) (uint32 ip);
+	bool (*request) (uint32 ip);
+	void (*collect) (void);
+	void (*complete) (struct dnsbl_request *req, bool timed_out);
+	void (*cache_store) (uint32 ip, bool listed, int ttl);
+	int (*cleanup) (int tid, int64 tick, int id, intptr_t data);
+	void (*report) (void);
+	void *(*worker) (void *param);
+	bool (*resolve) (struct dnsbl_query *query);
+	bool (*resolve_udp) (struct dnsbl_query *query);
+};
+
+#ifdef HERCULES_CORE
+void dnsbl_defaults(void);
+#endif // HERCULES_CORE
+
+HPShared struct dnsbl_interface *dnsbl;
+
+#endif /* LOGIN_DNSBL_H */
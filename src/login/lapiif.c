@@ -248,6 +248,20 @@ static void lapiif_parse_proxy_api_from_char(int fd)
 {
 	RFIFO_API_PROXY_PACKET(inPacket);
 	const int api_fd = inPacket->char_server_id;
+	if (api_fd == -1) {
+		// notification for all api servers
+		for (int i = 0; i < ARRAYLENGTH(login->dbs->api_server); ++i) {
+			const int fd2 = login->dbs->api_server[i].fd;
+			if (!sockt->session_is_active(fd2))
+				continue;
+			const int len = inPacket->packet_len;
+			WFIFOHEAD(fd2, len);
+			memcpy(WFIFOP(fd2, 0), inPacket, len);
+			WFIFOW(fd2, 0) = HEADER_API_PROXY_REPLY;
+			WFIFOSET(fd2, len);
+		}
+		return;
+	}
 	if (!sockt->session_is_active(api_fd))
 		return;
 	const int len = inPacket->packet_len;
@@ -21,6 +21,7 @@
 
 #include "lclif.p.h"
 
+#include "login/dnsbl.h"
 #include "login/ipban.h"
 #include "login/lapiif.h"
 #include "login/login.h"
@@ -438,6 +439,13 @@ static int lclif_parse(int fd)
 		if (packet_len < 2)
 			return 0;
 
+		// hold the packets until the DNS blacklist answers for this ip arrive
+		if (login->config->use_dnsbl && (sd->dnsbl_status == DNSBL_UNCHECKED || sd->dnsbl_status == DNSBL_PENDING)) {
+			sd->dnsbl_status = dnsbl->check(ipl);
+			if (sd->dnsbl_status == DNSBL_PENDING)
+				return 0;
+		}
+
 		result = lclif->p->parse_sub(fd, sd);
 
 		switch (result) {
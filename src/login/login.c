@@ -24,6 +24,7 @@
 
 #include "login/HPMlogin.h"
 #include "login/account.h"
+#include "login/dnsbl.h"
 #include "login/ipban.h"
 #include "login/lapiif.h"
 #include "login/loginlog.h"
@@ -1124,24 +1125,14 @@ static int login_mmo_auth(struct login_session_data *sd, bool isServer)
 	nullpo_ret(sd);
 	sockt->ip2str(sockt->session[sd->fd]->client_addr, ip);
 
-	// DNS Blacklist check
+	// DNS Blacklist check, the answers were waited for in lclif->parse
 	if (login->config->use_dnsbl) {
-		char r_ip[16];
-		char ip_dnsbl[256];
-		uint8* sin_addr = (uint8*)&sockt->session[sd->fd]->client_addr;
-		int i;
-
-		sprintf(r_ip, "%u.%u.%u.%u", sin_addr[0], sin_addr[1], sin_addr[2], sin_addr[3]);
-
-		for (i = 0; i < VECTOR_LENGTH(login->config->dnsbl_servers); i++) {
-			char *dnsbl_server = VECTOR_INDEX(login->config->dnsbl_servers, i);
-			sprintf(ip_dnsbl, "%s.%s", r_ip, trim(dnsbl_server));
-			if (sockt->host2ip(ip_dnsbl)) {
-				ShowInfo("DNSBL: (%s) Blacklisted. User Kicked.\n", r_ip);
-				return 3;
-			}
+		if (sd->dnsbl_status == DNSBL_UNCHECKED || sd->dnsbl_status == DNSBL_PENDING)
+			sd->dnsbl_status = dnsbl->check(sockt->session[sd->fd]->client_addr);
+		if (sd->dnsbl_status == DNSBL_LISTED) {
+			ShowInfo("DNSBL: (%s) Blacklisted. User Kicked.\n", ip);
+			return 3;
 		}
-
 	}
 
 	if (!isServer) {
@@ -1248,7 +1239,7 @@ static int login_mmo_auth(struct login_session_data *sd, bool isServer)
 	acc.unban_time = 0;
 	acc.logincount++;
 
-	accounts->save(accounts, &acc);
+	accounts->save_login(accounts, &acc);
 
 	if( sd->sex != 'S' && sd->account_id < START_ACCOUNT_NUM )
 		ShowWarning("Account %s has account id %d! Account IDs must be over %d to work properly!\n", sd->userid, sd->account_id, START_ACCOUNT_NUM);
@@ -1724,6 +1715,7 @@ static bool login_config_read_log(const char *filename, struct config_t *config,
 
 	libconfig->setting_lookup_bool_real(setting, "log_login", &login->config->log_login);
 	libconfig->setting_lookup_mutable_string(setting, "date_format", login->config->date_format, sizeof(login->config->date_format));
+	libconfig->setting_lookup_int(setting, "batch_interval", &loginlog->batch_interval);
 	return true;
 }
 
@@ -1941,6 +1933,9 @@ static bool login_config_read_permission_blacklist(const char *filename, struct
 	if ((setting = libconfig->lookup(config, "login_configuration/permission/DNS_blacklist/dnsbl_servers")) != NULL)
 		login->config_set_dnsbl_servers(setting);
 
+	if (!dnsbl->config_read(filename, config, imported))
+		return false;
+
 	return true;
 }
 
@@ -2121,6 +2116,7 @@ int do_final(void)
 		loginlog->final();
 
 	ipban->final();
+	dnsbl->final();
 
 	lapiif->final();
 
@@ -2257,6 +2253,7 @@ int do_init(int argc, char **argv)
 	}
 
 	ipban_defaults();
+	dnsbl_defaults();
 	lchrif_defaults();
 	lclif_defaults();
 	loginlog_defaults();
@@ -2312,6 +2309,9 @@ int do_init(int argc, char **argv)
 	// initialize static and dynamic ipban system
 	ipban->init();
 
+	// DNS blacklist lookups
+	dnsbl->init();
+
 	lapiif->init();
 
 	// Online user database init
@@ -76,6 +76,8 @@ struct login_session_data {
 	int fd;
 
 	time_t expiration_time;
+
+	uint8 dnsbl_status; ///< enum dnsbl_status of the session ip
 };
 
 struct mmo_char_server {
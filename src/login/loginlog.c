@@ -30,6 +30,7 @@
 #include "common/socket.h"
 #include "common/sql.h"
 #include "common/strlib.h"
+#include "common/timer.h"
 
 #include <stdlib.h> // exit
 
@@ -58,6 +59,17 @@ static unsigned long loginlog_failedattempts(uint32 ip, unsigned int minutes)
 		failures = strtoul(data, NULL, 10);
 		SQL->FreeResult(loginlog->sql_handle);
 	}
+
+	// failures not written yet
+	if (loginlog->entry_count > 0) {
+		int64 tick = timer->gettick();
+
+		for (int i = 0; i < loginlog->entry_count; i++) {
+			const struct loginlog_entry *entry = &loginlog->entries[i];
+			if (entry->ip == ip && entry->rcode == 1 && DIFF_TICK(tick, entry->tick) < (int64)minutes * 60 * 1000)
+				failures++;
+		}
+	}
 	return failures;
 }
 
@@ -77,6 +89,21 @@ static void loginlog_log(uint32 ip, const char *username, int rcode, const char
 	if( !loginlog->enabled )
 		return;
 
+	if (loginlog->batch_interval > 0 && loginlog->entry_count == LOGINLOG_BATCH_MAX)
+		loginlog->flush();
+
+	// rows stay queued when the flush fails, this one is then written on its own
+	if (loginlog->batch_interval > 0 && loginlog->entry_count < LOGINLOG_BATCH_MAX) {
+		struct loginlog_entry *entry = &loginlog->entries[loginlog->entry_count++];
+
+		entry->tick = timer->gettick();
+		entry->ip = ip;
+		entry->rcode = rcode;
+		SQL->EscapeStringLen(loginlog->sql_handle, entry->username, username, strnlen(username, NAME_LENGTH));
+		SQL->EscapeStringLen(loginlog->sql_handle, entry->message, message, strnlen(message, 255));
+		return;
+	}
+
 	SQL->EscapeStringLen(loginlog->sql_handle, esc_username, username, strnlen(username, NAME_LENGTH));
 	SQL->EscapeStringLen(loginlog->sql_handle, esc_message, message, strnlen(message, 255));
 
@@ -88,6 +115,70 @@ static void loginlog_log(uint32 ip, const char *username, int rcode, const char
 		Sql_ShowDebug(loginlog->sql_handle);
 }
 
+/**
+ * Writes the buffered rows with a single insert.
+ * The time of each row is the time of the event, relative to the database clock.
+ */
+static void loginlog_flush(void)
+{
+	StringBuf buf;
+	int64 tick, latency;
+
+	if (loginlog->entry_count == 0 || loginlog->sql_handle == NULL)
+		return;
+
+	tick = timer->gettick_nocache();
+	StrBuf->Init(&buf);
+	StrBuf->Printf(&buf, "INSERT INTO `%s`(`time`,`ip`,`user`,`rcode`,`log`) VALUES ", loginlog->dbs->log_login_db);
+	for (int i = 0; i < loginlog->entry_count; i++) {
+		const struct loginlog_entry *entry = &loginlog->entries[i];
+		int64 age = DIFF_TICK(tick, entry->tick) / 1000;
+
+		if (i > 0)
+			StrBuf->AppendStr(&buf, ",");
+		StrBuf->Printf(&buf, "(NOW() - INTERVAL %"PRId64" SECOND, '%s', '%s', '%d', '%s')",
+			max(age, 0), sockt->ip2str(entry->ip, NULL), entry->username, entry->rcode, entry->message);
+	}
+
+	if (SQL_ERROR == SQL->QueryStr(loginlog->sql_handle, StrBuf->Value(&buf))) {
+		// keep the rows for the next flush, as account_flush_batch does
+		Sql_ShowDebug(loginlog->sql_handle);
+		StrBuf->Destroy(&buf);
+		return;
+	}
+	StrBuf->Destroy(&buf);
+
+	latency = timer->gettick_nocache() - tick;
+	loginlog->stats.flushes++;
+	loginlog->stats.rows += loginlog->entry_count;
+	loginlog->stats.max_rows = max(loginlog->stats.max_rows, loginlog->entry_count);
+	loginlog->stats.latency_total += latency;
+	loginlog->stats.latency_max = max(loginlog->stats.latency_max, latency);
+	loginlog->entry_count = 0;
+}
+
+static int loginlog_flush_timer(int tid, int64 tick, int id, intptr_t data)
+{
+	loginlog->flush();
+
+	if (loginlog->stats.rows != loginlog->stats.reported && DIFF_TICK(tick, loginlog->stats.report_tick) >= 60 * 1000)
+		loginlog->report();
+	return 0;
+}
+
+static void loginlog_report(void)
+{
+	const struct loginlog_stats *stats = &loginlog->stats;
+
+	if (stats->flushes == 0)
+		return;
+
+	ShowInfo("Login log: %d rows written in %d inserts (largest %d), latency avg %"PRId64" ms, max %"PRId64" ms.\n",
+		stats->rows, stats->flushes, stats->max_rows, stats->latency_total / stats->flushes, stats->latency_max);
+	loginlog->stats.reported = stats->rows;
+	loginlog->stats.report_tick = timer->gettick();
+}
+
 static bool loginlog_init(void)
 {
 	loginlog->sql_handle = SQL->Malloc();
@@ -104,11 +195,25 @@ static bool loginlog_init(void)
 
 	loginlog->enabled = true;
 
+	loginlog->entry_count = 0;
+	loginlog->stats.report_tick = timer->gettick();
+	if (loginlog->batch_interval > 0) {
+		timer->add_func_list(loginlog->flush_timer, "loginlog->flush_timer");
+		loginlog->flush_timer_id = timer->add_interval(timer->gettick() + loginlog->batch_interval, loginlog->flush_timer, 0, 0, loginlog->batch_interval);
+	}
+
 	return true;
 }
 
 static bool loginlog_final(void)
 {
+	if (loginlog->flush_timer_id != INVALID_TIMER) {
+		timer->delete_(loginlog->flush_timer_id, loginlog->flush_timer);
+		loginlog->flush_timer_id = INVALID_TIMER;
+	}
+	loginlog->flush();
+	loginlog->report();
+
 	SQL->Free(loginlog->sql_handle);
 	loginlog->sql_handle = NULL;
 	return true;
@@ -224,6 +329,10 @@ void loginlog_defaults(void)
 
 	loginlog->sql_handle = NULL;
 	loginlog->enabled = false;
+	loginlog->entry_count = 0;
+	loginlog->batch_interval = 1000;
+	loginlog->flush_timer_id = INVALID_TIMER;
+	memset(&loginlog->stats, 0, sizeof(loginlog->stats));
 
 	// Sql settings
 	strcpy(loginlog->dbs->log_db_hostname, "127.0.0.1");
@@ -236,6 +345,9 @@ void loginlog_defaults(void)
 
 	loginlog->failedattempts = loginlog_failedattempts;
 	loginlog->log = loginlog_log;
+	loginlog->flush = loginlog_flush;
+	loginlog->flush_timer = loginlog_flush_timer;
+	loginlog->report = loginlog_report;
 	loginlog->init = loginlog_init;
 	loginlog->final = loginlog_final;
 	loginlog->config_read_names = loginlog_config_read_names;
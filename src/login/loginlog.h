@@ -23,9 +23,31 @@
 
 #include "common/hercules.h"
 #include "common/cbasetypes.h"
+#include "common/mmo.h" // NAME_LENGTH
 
 struct config_t;
 
+#define LOGINLOG_BATCH_MAX 256 ///< Maximum amount of rows kept before they are written
+
+/// Login log row waiting to be written.
+struct loginlog_entry {
+	int64 tick;                       ///< time of the event
+	uint32 ip;
+	int rcode;
+	char username[NAME_LENGTH*2+1];   ///< escaped
+	char message[255*2+1];            ///< escaped
+};
+
+struct loginlog_stats {
+	int flushes;                      ///< insert queries executed
+	int rows;                         ///< rows written
+	int max_rows;                     ///< largest insert
+	int64 latency_total;              ///< sum of insert durations, in milliseconds
+	int64 latency_max;
+	int reported;                     ///< rows at the time of the last report
+	int64 report_tick;
+};
+
 struct s_loginlog_dbs {
 	char log_db_hostname[32];
 	uint16 log_db_port;
@@ -43,8 +65,16 @@ struct loginlog_interface {
 	struct Sql *sql_handle;
 	bool enabled;
 	struct s_loginlog_dbs *dbs;
+	struct loginlog_entry entries[LOGINLOG_BATCH_MAX];
+	int entry_count;
+	int batch_interval;               ///< milliseconds between writes of buffered rows (0: written immediately)
+	int flush_timer_id;
+	struct loginlog_stats stats;
 	unsigned long (*failedattempts) (uint32 ip, unsigned int minutes);
 	void (*log) (uint32 ip, const char* username, int rcode, const char* message);
+	void (*flush) (void);
+	int (*flush_timer) (int tid, int64 tick, int id, intptr_t data);
+	void (*report) (void);
 	bool (*init) (void);
 	bool (*final) (void);
 	bool (*config_read_names) (const char *filename, struct config_t *config, bool imported);
@@ -43,6 +43,9 @@
 static struct achievement_interface achievement_s;
 struct achievement_interface *achievement;
 
+/// Key of the criteria index, @see enum achievement_criteria_key_kinds
+#define achievement_criteria_key(kind, value) ( ((int64)(kind) << 32) | (uint32)(value) )
+
 /**
  * Retrieve an achievement via it's ID.
  * @param aid as the achievement ID.
@@ -64,15 +67,12 @@ static const struct achievement_data *achievement_get(int aid)
 static struct achievement *achievement_ensure(struct map_session_data *sd, const struct achievement_data *ad)
 {
 	struct achievement *s_ad = NULL;
-	int i = 0;
 
 	nullpo_retr(NULL, sd);
 	nullpo_retr(NULL, ad);
 
 	/* Lookup for achievement entry */
-	ARR_FIND(0, VECTOR_LENGTH(sd->achievement), i, (s_ad = &VECTOR_INDEX(sd->achievement, i)) && s_ad->id == ad->id);
-
-	if (i == VECTOR_LENGTH(sd->achievement)) {
+	if ((s_ad = achievement->progress_find(sd, ad->id)) == NULL) {
 		struct achievement ta = { 0 };
 		ta.id = ad->id;
 
@@ -85,6 +85,84 @@ static struct achievement *achievement_ensure(struct map_session_data *sd, const
 	return s_ad;
 }
 
+/**
+ * Inserts an entry of the session's achievements in its hashed index.
+ * @param[in] sd       a pointer to map_session_data.
+ * @param[in] pos      position of the entry in sd->achievement.
+ */
+static void achievement_progress_index_add(struct map_session_data *sd, int pos)
+{
+	int mask = sd->achievement_index.size - 1;
+	int slot = VECTOR_INDEX(sd->achievement, pos).id & mask;
+
+	while (sd->achievement_index.slots[slot] != 0)
+		slot = (slot + 1) & mask;
+	sd->achievement_index.slots[slot] = pos + 1;
+}
+
+/**
+ * Looks up the session's progress of an achievement.
+ * Entries of sd->achievement are only ever appended, the ones added since the
+ * last lookup are hashed first (the index is rebuilt when it gets half full).
+ * @param[in] sd       a pointer to map_session_data.
+ * @param[in] aid      ID of the achievement.
+ * @return pointer to the session's achievement data, NULL if there is none.
+ */
+static struct achievement *achievement_progress_find(struct map_session_data *sd, int aid)
+{
+	int length, mask, slot;
+
+	nullpo_retr(NULL, sd);
+
+	length = VECTOR_LENGTH(sd->achievement);
+	if (sd->achievement_index.count > length) // list was cleared
+		achievement->progress_index_clear(sd);
+
+	if (sd->achievement_index.count < length) {
+		if (length * 2 > sd->achievement_index.size) {
+			int size = max(sd->achievement_index.size, 32);
+
+			while (length * 2 > size)
+				size *= 2;
+			if (sd->achievement_index.slots != NULL)
+				aFree(sd->achievement_index.slots);
+			CREATE(sd->achievement_index.slots, int, size);
+			sd->achievement_index.size = size;
+			sd->achievement_index.count = 0;
+		}
+		for (; sd->achievement_index.count < length; sd->achievement_index.count++)
+			achievement_progress_index_add(sd, sd->achievement_index.count);
+	}
+
+	if (sd->achievement_index.size == 0)
+		return NULL;
+
+	mask = sd->achievement_index.size - 1;
+	for (slot = aid & mask; sd->achievement_index.slots[slot] != 0; slot = (slot + 1) & mask) {
+		struct achievement *a = &VECTOR_INDEX(sd->achievement, sd->achievement_index.slots[slot] - 1);
+
+		if (a->id == aid)
+			return a;
+	}
+
+	return NULL;
+}
+
+/**
+ * Frees the hashed index of the session's achievements.
+ * @param[in] sd       a pointer to map_session_data.
+ */
+static void achievement_progress_index_clear(struct map_session_data *sd)
+{
+	nullpo_retv(sd);
+
+	if (sd->achievement_index.slots != NULL)
+		aFree(sd->achievement_index.slots);
+	sd->achievement_index.slots = NULL;
+	sd->achievement_index.size = 0;
+	sd->achievement_index.count = 0;
+}
+
 /**
  * Calculates the achievement's totals via reference.
  * @param[in] sd               pointer to map_session_data
@@ -287,8 +365,123 @@ static bool achievement_check_criteria(const struct achievement_objective *objec
 	return true;
 }
 
+/**
+ * Reads the unique criterion of an objective as the given unique type.
+ * @param[in] objective  pointer to the objective or criteria.
+ * @param[in] type       unique criteria type to read.
+ * @return value of the criterion.
+ */
+static int achievement_unique_criteria_value(const struct achievement_objective *objective, enum unique_criteria_types type)
+{
+	switch (type) {
+	case CRITERIA_UNIQUE_ACHIEVE_ID:
+		return objective->unique.achieve_id;
+	case CRITERIA_UNIQUE_ITEM_ID:
+		return objective->unique.itemid;
+	case CRITERIA_UNIQUE_STATUS_TYPE:
+		return (int)objective->unique.status_type;
+	case CRITERIA_UNIQUE_WEAPON_LV:
+		return objective->unique.weapon_lv;
+	case CRITERIA_UNIQUE_NONE:
+		break;
+	}
+	return 0;
+}
+
+/**
+ * Computes the key an objective is indexed under.
+ * @param[in] objective  pointer to the objective.
+ * @return criteria key. (@see achievement_criteria_key_kinds)
+ */
+static int64 achievement_objective_key(const struct achievement_objective *objective)
+{
+	nullpo_ret(objective);
+
+	if (objective->unique_type != CRITERIA_UNIQUE_NONE)
+		return achievement_criteria_key(ACH_CRITERIA_KEY_UNIQUE + objective->unique_type, achievement_unique_criteria_value(objective, objective->unique_type));
+	if (objective->mobid > 0)
+		return achievement_criteria_key(ACH_CRITERIA_KEY_MOBID, objective->mobid);
+	// All the job ids of the objective must match the criteria, see achievement_check_criteria()
+	if (VECTOR_LENGTH(objective->jobid) > 0)
+		return achievement_criteria_key(ACH_CRITERIA_KEY_JOBID, VECTOR_INDEX(objective->jobid, 0));
+	return achievement_criteria_key(ACH_CRITERIA_KEY_ANY, 0);
+}
+
+/**
+ * Builds the criteria index of every type from the categories.
+ */
+static void achievement_criteria_index_build(void)
+{
+	int type, i, j;
+
+	achievement->criteria_index_clear();
+
+	for (type = 0; type < ACH_TYPE_MAX; type++) {
+		struct achievement_criteria_index *index = &achievement->criteria_index[type];
+
+		index->lists = i64db_alloc(DB_OPT_RELEASE_DATA);
+
+		for (i = 0; i < VECTOR_LENGTH(achievement->category[type]); i++) {
+			const struct achievement_data *ad = NULL;
+
+			if ((ad = achievement->get(VECTOR_INDEX(achievement->category[type], i))) == NULL)
+				continue;
+
+			for (j = 0; j < VECTOR_LENGTH(ad->objective); j++) {
+				int64 key = achievement->objective_key(&VECTOR_INDEX(ad->objective, j));
+				struct achievement_criteria_list *list = i64db_get(index->lists, key);
+				struct achievement_criteria_entry entry = { 0 };
+
+				if (list == NULL) {
+					CREATE(list, struct achievement_criteria_list, 1);
+					VECTOR_INIT(list->entries);
+					i64db_put(index->lists, key, list);
+				}
+
+				entry.ad = ad;
+				entry.obj_idx = j;
+				entry.order = i * MAX_ACHIEVEMENT_OBJECTIVES + j;
+				VECTOR_ENSURE(list->entries, 1, 1);
+				VECTOR_PUSH(list->entries, entry);
+				index->kinds |= 1 << (int)(key >> 32);
+			}
+		}
+	}
+}
+
+/**
+ * Cleaning function called through achievement->criteria_index[type].lists->destroy()
+ */
+static int achievement_criteria_index_final(union DBKey key, struct DBData *data, va_list args)
+{
+	struct achievement_criteria_list *list = DB->data2ptr(data);
+
+	VECTOR_CLEAR(list->entries);
+
+	return 0;
+}
+
+/**
+ * Destroys the criteria index of every type.
+ */
+static void achievement_criteria_index_clear(void)
+{
+	int type;
+
+	for (type = 0; type < ACH_TYPE_MAX; type++) {
+		struct achievement_criteria_index *index = &achievement->criteria_index[type];
+
+		if (index->lists != NULL)
+			index->lists->destroy(index->lists, achievement->criteria_index_final);
+		index->lists = NULL;
+		index->kinds = 0;
+	}
+}
+
 /**
  * Validates an Achievement Objective of similar types.
+ * Only the objectives indexed under the keys of the criteria are checked,
+ * in the order of the category of the type.
  * @param[in] sd         as a pointer to the map session data.
  * @param[in] type       as the type of the achievement.
  * @param[in] criteria   as the criteria of the objective (mob id, job id etc.. 0 for no criteria).
@@ -297,7 +490,12 @@ static bool achievement_check_criteria(const struct achievement_objective *objec
  */
 static int achievement_validate_type(struct map_session_data *sd, enum achievement_types type, const struct achievement_objective *criteria, bool additive)
 {
-	int i = 0, total = 0;
+	const struct achievement_criteria_list *lists[ACH_CRITERIA_KEY_MAX];
+	int cursor[ACH_CRITERIA_KEY_MAX] = { 0 };
+	const struct achievement_criteria_index *index = NULL;
+	const struct achievement_data *current = NULL;
+	int i = 0, list_count = 0, total = 0;
+	bool updated = false;
 	struct achievement *ach = NULL;
 
 	nullpo_ret(sd);
@@ -316,36 +514,77 @@ static int achievement_validate_type(struct map_session_data *sd, enum achieveme
 		return 0;
 	}
 
-	/* Loop through all achievements of the type, checking for possible matches. */
-	for (i = 0; i < VECTOR_LENGTH(achievement->category[type]); i++) {
-		int j = 0;
-		bool updated = false;
-		const struct achievement_data *ad = NULL;
+	index = &achievement->criteria_index[type];
+	if (index->lists == NULL)
+		return 0;
+
+	/* Collect the objective lists matching the keys of the criteria. */
+	for (i = 0; i < ACH_CRITERIA_KEY_MAX; i++) {
+		int64 key;
 
-		if ((ad = achievement->get(VECTOR_INDEX(achievement->category[type], i))) == NULL)
+		if ((index->kinds & (1 << i)) == 0)
 			continue;
 
-		for (j = 0; j < VECTOR_LENGTH(ad->objective); j++) {
-			// Check if objective criteria matches.
-			if (achievement->check_criteria(&VECTOR_INDEX(ad->objective, j), criteria) == false)
-				continue;
-			// Ensure availability of the achievement.
-			if ((ach = achievement->ensure(sd, ad)) == NULL)
-				return false;
-			// Criteria passed, check if not completed and update progress.
-			if ((ach->completed_at == 0 && ach->objective[j] < VECTOR_INDEX(ad->objective, j).goal)) {
-				if (additive == true)
-					achievement->progress_add(sd, ad, j, criteria->goal);
-				else
-					achievement->progress_set(sd, ad, j, criteria->goal);
-				updated = true;
-			}
+		if (i == ACH_CRITERIA_KEY_ANY)
+			key = achievement_criteria_key(i, 0);
+		else if (i == ACH_CRITERIA_KEY_MOBID)
+			key = achievement_criteria_key(i, criteria->mobid);
+		else if (i == ACH_CRITERIA_KEY_JOBID && VECTOR_LENGTH(criteria->jobid) > 0)
+			key = achievement_criteria_key(i, VECTOR_INDEX(criteria->jobid, 0));
+		else if (i >= ACH_CRITERIA_KEY_UNIQUE)
+			key = achievement_criteria_key(i, achievement_unique_criteria_value(criteria, (enum unique_criteria_types)(i - ACH_CRITERIA_KEY_UNIQUE)));
+		else
+			continue;
+
+		if ((lists[list_count] = i64db_get(index->lists, key)) != NULL)
+			list_count++;
+	}
+
+	/* Merge the lists in category order, checking for possible matches. */
+	while (true) {
+		const struct achievement_criteria_entry *entry = NULL;
+		const struct achievement_data *ad = NULL;
+		int best = -1, j = 0;
+
+		for (i = 0; i < list_count; i++) {
+			if (cursor[i] < VECTOR_LENGTH(lists[i]->entries)
+			 && (best == -1 || VECTOR_INDEX(lists[i]->entries, cursor[i]).order < VECTOR_INDEX(lists[best]->entries, cursor[best]).order))
+				best = i;
+		}
+		if (best == -1)
+			break;
+
+		entry = &VECTOR_INDEX(lists[best]->entries, cursor[best]);
+		cursor[best]++;
+		ad = entry->ad;
+		j = entry->obj_idx;
+
+		if (ad != current) {
+			if (updated == true)
+				total++;
+			current = ad;
+			updated = false;
 		}
 
-		if (updated == true)
-			total++;
+		// Check if objective criteria matches.
+		if (achievement->check_criteria(&VECTOR_INDEX(ad->objective, j), criteria) == false)
+			continue;
+		// Ensure availability of the achievement.
+		if ((ach = achievement->ensure(sd, ad)) == NULL)
+			return false;
+		// Criteria passed, check if not completed and update progress.
+		if ((ach->completed_at == 0 && ach->objective[j] < VECTOR_INDEX(ad->objective, j).goal)) {
+			if (additive == true)
+				achievement->progress_add(sd, ad, j, criteria->goal);
+			else
+				achievement->progress_set(sd, ad, j, criteria->goal);
+			updated = true;
+		}
 	}
 
+	if (updated == true)
+		total++;
+
 	return total;
 }
 
@@ -1897,6 +2136,7 @@ static void do_init_achievement(bool minimal)
 	/* Read LibConfig Files */
 	achievement->readdb();
 	achievement->readdb_ranks();
+	achievement->criteria_index_build();
 }
 
 /**
@@ -1929,6 +2169,7 @@ static void do_final_achievement(void)
 {
 	int i = 0;
 
+	achievement->criteria_index_clear();
 	achievement->db->destroy(achievement->db, achievement->db_finalize);
 
 	for (i = 0; i < ACH_TYPE_MAX; i++)
@@ -1974,6 +2215,13 @@ void achievement_defaults(void)
 	/* */
 	achievement->get = achievement_get;
 	achievement->ensure = achievement_ensure;
+	achievement->progress_find = achievement_progress_find;
+	achievement->progress_index_clear = achievement_progress_index_clear;
+	/* */
+	achievement->criteria_index_build = achievement_criteria_index_build;
+	achievement->criteria_index_clear = achievement_criteria_index_clear;
+	achievement->criteria_index_final = achievement_criteria_index_final;
+	achievement->objective_key = achievement_objective_key;
 	/* */
 	achievement->calculate_totals = achievement_calculate_totals;
 	achievement->check_complete = achievement_check_complete;
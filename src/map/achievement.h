@@ -110,6 +110,21 @@ enum unique_criteria_types {
 	CRITERIA_UNIQUE_WEAPON_LV
 };
 
+/**
+ * Kinds of keys of the criteria index.
+ *
+ * Each objective is indexed under a single key, made of the first of its
+ * unique criterion, monster id or first job id that it has (ACH_CRITERIA_KEY_ANY
+ * if it has none). @see achievement_criteria_index_build()
+ */
+enum achievement_criteria_key_kinds {
+	ACH_CRITERIA_KEY_ANY,
+	ACH_CRITERIA_KEY_MOBID,
+	ACH_CRITERIA_KEY_JOBID,
+	ACH_CRITERIA_KEY_UNIQUE, // + enum unique_criteria_types
+	ACH_CRITERIA_KEY_MAX = ACH_CRITERIA_KEY_UNIQUE + CRITERIA_UNIQUE_WEAPON_LV + 1
+};
+
 /**
  * Achievement Objective Structure
  *
@@ -163,6 +178,30 @@ struct achievement_data {
 	struct achievement_rewards rewards;
 };
 
+/**
+ * Objective referenced by the criteria index.
+ */
+struct achievement_criteria_entry {
+	const struct achievement_data *ad;
+	int obj_idx;
+	int order; // Position of the objective in the category of its type.
+};
+
+/**
+ * Objectives of a type sharing a criteria key, in category order.
+ */
+struct achievement_criteria_list {
+	VECTOR_DECL(struct achievement_criteria_entry) entries;
+};
+
+/**
+ * Criteria index of an achievement type.
+ */
+struct achievement_criteria_index {
+	struct DBMap *lists; // int64 criteria key -> struct achievement_criteria_list *
+	uint32 kinds;        // Bitmask of the key kinds of the objectives (1 << enum achievement_criteria_key_kinds)
+};
+
 // Achievements types that use Mob ID as criteria.
 #define achievement_criteria_mobid(t) ( \
 		   (t) == ACH_KILL_MOB_CLASS \
@@ -212,6 +251,7 @@ struct achievement_interface {
 	/* */
 	VECTOR_DECL(int) rank_exp; // Achievement Rank Exp Requirements
 	VECTOR_DECL(int) category[ACH_TYPE_MAX]; /* A collection of Ids per type for faster processing. */
+	struct achievement_criteria_index criteria_index[ACH_TYPE_MAX]; /* Objectives per type and criteria, built from category. */
 	/* */
 	void (*init) (bool minimal);
 	void (*final) (void);
@@ -243,6 +283,13 @@ struct achievement_interface {
 	/* */
 	const struct achievement_data *(*get) (int aid);
 	struct achievement *(*ensure) (struct map_session_data *sd, const struct achievement_data *ad);
+	struct achievement *(*progress_find) (struct map_session_data *sd, int aid);
+	void (*progress_index_clear) (struct map_session_data *sd);
+	/* */
+	void (*criteria_index_build) (void);
+	void (*criteria_index_clear) (void);
+	int (*criteria_index_final) (union DBKey key, struct DBData *data, va_list args);
+	int64 (*objective_key) (const struct achievement_objective *objective);
 	/* */
 	void (*calculate_totals) (const struct map_session_data *sd, int *points, int *completed, int *rank, int *curr_rank_points);
 	bool (*check_complete) (struct map_session_data *sd, const struct achievement_data *ad);
@@ -469,6 +469,23 @@ ACMD(mapmove)
 	if (map_index)
 		m = map->mapindex2mapid(map_index);
 
+	if (map_index != 0 && (m < 0 || map->list[m].standby)) {
+		uint32 ip;
+		uint16 port;
+
+		if (map->mapindex2ipport(map_index, &ip, &port)) { // hosted by another map-server, which checks the cell
+			if (sd->bl.m >= 0 && map->list[sd->bl.m].flag.nowarp && !pc_has_permission(sd, PC_PERM_WARP_ANYWHERE)) {
+				clif->message(fd, msg_fd(fd, MSGTBL_CANT_WARP_FROM)); // You are not authorized to warp from your current map.
+				return false;
+			}
+			if (pc->setpos(sd, map_index, x, y, CLR_TELEPORT) != 0) {
+				clif->message(fd, msg_fd(fd, MSGTBL_MAP_NOT_FOUND)); // Map not found.
+				return false;
+			}
+			return true;
+		}
+	}
+
 	if (!map_index || m < 0) { // m < 0 means on different server or that map is disabled! [Kevin]
 		clif->message(fd, msg_fd(fd, MSGTBL_MAP_NOT_FOUND)); // Map not found.
 		return false;
@@ -4387,7 +4404,7 @@ ACMD(mount_peco)
 		return false;
 	}
 
-	if (sd->sc.data[SC_ALL_RIDING]) {
+	if (SC_ENTRY(&sd->sc, SC_ALL_RIDING)) {
 		clif->message(fd, msg_fd(fd, MSGTBL_ALREADY_MOUNTED)); // You are already mounting something else
 		return false;
 	}
@@ -4947,7 +4964,7 @@ ACMD(jail)
 		return false;
 	}
 
-	if (pl_sd->sc.data[SC_JAILED])
+	if (SC_ENTRY(&pl_sd->sc, SC_JAILED))
 	{
 		clif->message(fd, msg_fd(fd, MSGTBL_WARPED_TO_JAIL)); // Player warped in jails.
 		return false;
@@ -4999,7 +5016,7 @@ ACMD(unjail)
 		return false;
 	}
 
-	if (!pl_sd->sc.data[SC_JAILED])
+	if (!SC_ENTRY(&pl_sd->sc, SC_JAILED))
 	{
 		clif->message(fd, msg_fd(fd, MSGTBL_PLAYER_NOT_IN_JAIL)); // This player is not in jails.
 		return false;
@@ -5085,9 +5102,9 @@ ACMD(jailfor)
 	}
 
 	//Added by Coltaro
-	if (pl_sd->sc.data[SC_JAILED] && pl_sd->sc.data[SC_JAILED]->val1 != INT_MAX) {
+	if (SC_ENTRY(&pl_sd->sc, SC_JAILED) && SC_ENTRY(&pl_sd->sc, SC_JAILED)->val1 != INT_MAX) {
 		//Update the player's jail time
-		jailtime += pl_sd->sc.data[SC_JAILED]->val1;
+		jailtime += SC_ENTRY(&pl_sd->sc, SC_JAILED)->val1;
 		if (jailtime <= 0) {
 			jailtime = 0;
 			clif->message(pl_sd->fd, msg_fd(fd, MSGTBL_UNJAILED_BY_GM)); // GM has discharge you.
@@ -5126,23 +5143,23 @@ ACMD(jailtime)
 {
 	int year, month, day, hour, minute;
 
-	if (!sd->sc.data[SC_JAILED]) {
+	if (!SC_ENTRY(&sd->sc, SC_JAILED)) {
 		clif->message(fd, msg_fd(fd, MSGTBL_NOT_IN_JAIL)); // You are not in jail.
 		return false;
 	}
 
-	if (sd->sc.data[SC_JAILED]->val1 == INT_MAX) {
+	if (SC_ENTRY(&sd->sc, SC_JAILED)->val1 == INT_MAX) {
 		clif->message(fd, msg_fd(fd, MSGTBL_JAILED_INDEFINITELY)); // You have been jailed indefinitely.
 		return true;
 	}
 
-	if (sd->sc.data[SC_JAILED]->val1 <= 0) { // Was not jailed with @jailfor (maybe @jail? or warped there? or got recalled?)
+	if (SC_ENTRY(&sd->sc, SC_JAILED)->val1 <= 0) { // Was not jailed with @jailfor (maybe @jail? or warped there? or got recalled?)
 		clif->message(fd, msg_fd(fd, MSGTBL_JAILED_UNKNOWN_TIME)); // You have been jailed for an unknown amount of time.
 		return false;
 	}
 
 	//Get remaining jail time
-	atcommand->get_jail_time(sd->sc.data[SC_JAILED]->val1,&year,&month,&day,&hour,&minute);
+	atcommand->get_jail_time(SC_ENTRY(&sd->sc, SC_JAILED)->val1,&year,&month,&day,&hour,&minute);
 	snprintf(atcmd_output, sizeof(atcmd_output),msg_fd(fd, MSGTBL_JAILFOR_TIME),msg_fd(fd, MSGTBL_WILL_REMAIN),year,month,day,hour,minute); // You will remain in jail for %d years, %d months, %d days, %d hours and %d minutes
 
 	clif->message(fd, atcmd_output);
@@ -5187,7 +5204,7 @@ ACMD(disguise)
 		return false;
 	}
 
-	if (sd->sc.data[SC_MONSTER_TRANSFORM] != NULL || sd->sc.data[SC_ACTIVE_MONSTER_TRANSFORM] != NULL)
+	if (SC_ENTRY(&sd->sc, SC_MONSTER_TRANSFORM) != NULL || SC_ENTRY(&sd->sc, SC_ACTIVE_MONSTER_TRANSFORM) != NULL)
 	{
 		clif->message(fd, msg_fd(fd, MSGTBL_NOT_DISGUISE_WHILE_TRANSFORMED)); // Character cannot be disguised while in monster form.
 		return false;
@@ -7039,7 +7056,7 @@ ACMD(unmute)
 		return false;
 	}
 
-	if (!pl_sd->sc.data[SC_NOCHAT]) {
+	if (!SC_ENTRY(&pl_sd->sc, SC_NOCHAT)) {
 		clif->message(sd->fd,msg_fd(fd, MSGTBL_UNMUTE_NOT_MUTED)); // Player is not muted.
 		return false;
 	}
@@ -9316,7 +9333,7 @@ ACMD(cashmount)
 
 	clif->message(sd->fd, msg_fd(fd, MSGTBL_NEW_MOUNT_NOTICE)); // NOTICE: If you crash with mount, your Lua files are outdated.
 
-	if (!sd->sc.data[SC_ALL_RIDING]) {
+	if (!SC_ENTRY(&sd->sc, SC_ALL_RIDING)) {
 		clif->message(sd->fd, msg_fd(fd, MSGTBL_NEW_MOUNT_MOUNTED)); // You are mounted now.
 		sc_start(NULL, &sd->bl, SC_ALL_RIDING, 100, battle_config.boarding_halter_speed, INFINITE_DURATION, 0);
 	} else {
@@ -10301,7 +10318,7 @@ ACMD(costume)
 
 	if (!*message) {
 		for (k = 0; k < len; k++) {
-			if (sd->sc.data[name2id[k]]) {
+			if (SC_ENTRY(&sd->sc, name2id[k])) {
 				snprintf(atcmd_output, sizeof(atcmd_output), msg_fd(fd, MSGTBL_COSTUME_REMOVED), names[k]); // Costume '%s' removed.
 				clif->message(sd->fd, atcmd_output);
 				status_change_end(&sd->bl, name2id[k], INVALID_TIMER);
@@ -10324,7 +10341,7 @@ ACMD(costume)
 		return true;
 
 	for (k = 0; k < len; k++) {
-		if (sd->sc.data[name2id[k]]) {
+		if (SC_ENTRY(&sd->sc, name2id[k])) {
 			snprintf(atcmd_output, sizeof(atcmd_output), msg_fd(fd, MSGTBL_COSTUME_ALREADY), names[k]); // You're already with a '%s' costume, type '@costume' to remove it.
 			clif->message(sd->fd, atcmd_output);
 			return false;
@@ -10670,6 +10687,101 @@ ACMD(enchantui)
 #endif
 }
 
+/**
+ * Moves a map to this map-server, the players on it are sent here.
+ * The map must be loaded by this map-server.
+ */
+ACMD(hostmap)
+{
+	char map_name[MAP_NAME_LENGTH_EXT];
+	unsigned short map_index;
+
+	memset(map_name, '\0', sizeof(map_name));
+	if (!*message || sscanf(message, "%15s", map_name) < 1) {
+		clif->message(fd, "Please enter a map name (usage: @hostmap <map name>).");
+		return false;
+	}
+
+	if ((map_index = mapindex->name2id(map_name)) == 0 || map->mapindex2mapid(map_index) < 0) {
+		clif->message(fd, "Map not found or not loaded by this map-server.");
+		return false;
+	}
+
+	if (!chrif->map_move(sd->status.account_id, map_index)) {
+		clif->message(fd, "The char-server is not connected.");
+		return false;
+	}
+	return true;
+}
+
+#define MAPSTATS_TOP 10 ///< Maps listed by @mapstats without a map name
+
+/**
+ * Shows the objects and the activity of the busiest maps, or of one map.
+ * Rates are per second over the last sample of the map statistics.
+ * @mapstats [<map name>]
+ */
+ACMD(mapstats)
+{
+	char map_name[MAP_NAME_LENGTH_EXT];
+	int top[MAPSTATS_TOP], top_count = 0;
+
+	memset(map_name, '\0', sizeof(map_name));
+	if (*message != '\0' && sscanf(message, "%15s", map_name) == 1) {
+		int16 m = map->mapname2mapid(map_name);
+		const struct map_data *md;
+		int len = 0;
+
+		if (m < 0) {
+			clif->message(fd, msg_fd(fd, MSGTBL_MAP_NOT_FOUND)); // Map not found.
+			return false;
+		}
+		md = &map->list[m];
+		snprintf(atcmd_output, sizeof(atcmd_output), "------ Map Stats: %s (sampled every %d seconds) ------", md->name, map->stats_interval);
+		clif->message(fd, atcmd_output);
+		for (int i = 0; i < MAP_STATS_BL_TYPES && len < (int)sizeof(atcmd_output); i++)
+			len += snprintf(atcmd_output + len, sizeof(atcmd_output) - len, "%s%s: %d", i != 0 ? " | " : "", map->stats_type_name(i), md->stats.objects[i]);
+		clif->message(fd, atcmd_output);
+		for (int i = 0; i < MAP_STATS_MAX; i++) {
+			snprintf(atcmd_output, sizeof(atcmd_output), "%s: %u/s (%"PRIu64" in total)", map->stats_counter_name(i), md->stats.rate[i], md->stats.count[i]);
+			clif->message(fd, atcmd_output);
+		}
+		return true;
+	}
+
+	for (int m = 0; m < map->count; m++) {
+		unsigned int load = map->stats_load(&map->list[m]);
+		int i;
+
+		if (load == 0)
+			continue;
+		ARR_FIND(0, top_count, i, load > map->stats_load(&map->list[top[i]]));
+		if (i == MAPSTATS_TOP)
+			continue;
+		if (top_count < MAPSTATS_TOP)
+			top_count++;
+		memmove(&top[i + 1], &top[i], (top_count - i - 1) * sizeof(top[0]));
+		top[i] = m;
+	}
+
+	snprintf(atcmd_output, sizeof(atcmd_output), "------ Busiest maps (sampled every %d seconds) ------", map->stats_interval);
+	clif->message(fd, atcmd_output);
+	if (top_count == 0) {
+		clif->message(fd, "No activity was sampled yet.");
+		return true;
+	}
+	for (int i = 0; i < top_count; i++) {
+		const struct map_data *md = &map->list[top[i]];
+
+		snprintf(atcmd_output, sizeof(atcmd_output), "%s: %d players, %d mobs, %d skill units | AI %u/s, paths %u/s, area packets %u/s (%u KB/s), area scans %u/s (%u blocks/s)",
+			md->name, md->users, md->stats.objects[map->stats_type_index(BL_MOB)], md->stats.objects[map->stats_type_index(BL_SKILL)],
+			md->stats.rate[MAP_STATS_AI_THINKS], md->stats.rate[MAP_STATS_PATH_SEARCHES], md->stats.rate[MAP_STATS_AREA_PACKETS],
+			md->stats.rate[MAP_STATS_BYTES_SENT] / 1024, md->stats.rate[MAP_STATS_AREA_SCANS], md->stats.rate[MAP_STATS_AREA_BLOCKS]);
+		clif->message(fd, atcmd_output);
+	}
+	return true;
+}
+
 /**
  * Fills the reference of available commands in atcommand DBMap
  **/
@@ -10966,6 +11078,8 @@ static void atcommand_basecommands(void)
 		ACMD_DEF(reloadgradedb),
 		ACMD_DEF(itemreform),
 		ACMD_DEF(enchantui),
+		ACMD_DEF(hostmap),
+		ACMD_DEF(mapstats),
 	};
 	int i;
 
@@ -312,13 +312,13 @@ static int battle_delay_damage(int64 tick, int amotion, struct block_list *src,
 	sc = status->get_sc(target);
 
 	if (sc) {
-		if (sc->data[SC_DEVOTION] && sc->data[SC_DEVOTION]->val1)
-			d_tbl = map->id2bl(sc->data[SC_DEVOTION]->val1);
-		if (sc->data[SC_WATER_SCREEN_OPTION] && sc->data[SC_WATER_SCREEN_OPTION]->val1)
-			e_tbl = map->id2bl(sc->data[SC_WATER_SCREEN_OPTION]->val1);
+		if (SC_ENTRY(sc, SC_DEVOTION) && SC_ENTRY(sc, SC_DEVOTION)->val1)
+			d_tbl = map->id2bl(SC_ENTRY(sc, SC_DEVOTION)->val1);
+		if (SC_ENTRY(sc, SC_WATER_SCREEN_OPTION) && SC_ENTRY(sc, SC_WATER_SCREEN_OPTION)->val1)
+			e_tbl = map->id2bl(SC_ENTRY(sc, SC_WATER_SCREEN_OPTION)->val1);
 	}
 
-	if (((d_tbl && sc && check_distance_bl(target, d_tbl, sc->data[SC_DEVOTION]->val3)) || e_tbl) && damage > 0 && skill_id != PA_PRESSURE && skill_id != CR_REFLECTSHIELD)
+	if (((d_tbl && sc && check_distance_bl(target, d_tbl, SC_ENTRY(sc, SC_DEVOTION)->val3)) || e_tbl) && damage > 0 && skill_id != PA_PRESSURE && skill_id != CR_REFLECTSHIELD)
 		damage = 0;
 
 	if ( !battle_config.delay_battle_damage || amotion <= 1 ) {
@@ -392,16 +392,16 @@ static int64 battle_attr_fix(struct block_list *src, struct block_list *target,
 
 	ratio = battle->attr_fix_table[def_lv-1][atk_elem][def_type];
 	if (sc && sc->count) {
-		if(sc->data[SC_VOLCANO] && atk_elem == ELE_FIRE)
-			ratio += skill->enchant_eff[sc->data[SC_VOLCANO]->val1-1];
-		if(sc->data[SC_VIOLENTGALE] && atk_elem == ELE_WIND)
-			ratio += skill->enchant_eff[sc->data[SC_VIOLENTGALE]->val1-1];
-		if(sc->data[SC_DELUGE] && atk_elem == ELE_WATER)
-			ratio += skill->enchant_eff[sc->data[SC_DELUGE]->val1-1];
-		if(sc->data[SC_FIRE_CLOAK_OPTION] && atk_elem == ELE_FIRE)
-			damage += damage * sc->data[SC_FIRE_CLOAK_OPTION]->val2 / 100;
-		if (sc->data[SC_TELEKINESIS_INTENSE] != NULL && atk_elem == ELE_GHOST)
-			damage += damage * sc->data[SC_TELEKINESIS_INTENSE]->val3 / 100;
+		if(SC_ENTRY(sc, SC_VOLCANO) && atk_elem == ELE_FIRE)
+			ratio += skill->enchant_eff[SC_ENTRY(sc, SC_VOLCANO)->val1-1];
+		if(SC_ENTRY(sc, SC_VIOLENTGALE) && atk_elem == ELE_WIND)
+			ratio += skill->enchant_eff[SC_ENTRY(sc, SC_VIOLENTGALE)->val1-1];
+		if(SC_ENTRY(sc, SC_DELUGE) && atk_elem == ELE_WATER)
+			ratio += skill->enchant_eff[SC_ENTRY(sc, SC_DELUGE)->val1-1];
+		if(SC_ENTRY(sc, SC_FIRE_CLOAK_OPTION) && atk_elem == ELE_FIRE)
+			damage += damage * SC_ENTRY(sc, SC_FIRE_CLOAK_OPTION)->val2 / 100;
+		if (SC_ENTRY(sc, SC_TELEKINESIS_INTENSE) != NULL && atk_elem == ELE_GHOST)
+			damage += damage * SC_ENTRY(sc, SC_TELEKINESIS_INTENSE)->val3 / 100;
 	}
 	if( target && target->type == BL_SKILL ) {
 		if( atk_elem == ELE_FIRE && battle->get_current_skill(target) == GN_WALLOFTHORN ) {
@@ -428,43 +428,43 @@ static int64 battle_attr_fix(struct block_list *src, struct block_list *target,
 	if( tsc && tsc->count ) { //since an atk can only have one type let's optimize this a bit
 		switch(atk_elem){
 		case ELE_FIRE:
-			if( tsc->data[SC_SPIDERWEB]) {
-				tsc->data[SC_SPIDERWEB]->val1 = 0; // free to move now
-				if( tsc->data[SC_SPIDERWEB]->val2-- > 0 )
+			if( SC_ENTRY(tsc, SC_SPIDERWEB)) {
+				SC_ENTRY(tsc, SC_SPIDERWEB)->val1 = 0; // free to move now
+				if( SC_ENTRY(tsc, SC_SPIDERWEB)->val2-- > 0 )
 					damage <<= 1; // double damage
-				if( tsc->data[SC_SPIDERWEB]->val2 == 0 )
+				if( SC_ENTRY(tsc, SC_SPIDERWEB)->val2 == 0 )
 					status_change_end(target, SC_SPIDERWEB, INVALID_TIMER);
 			}
-			if( tsc->data[SC_THORNS_TRAP])
+			if( SC_ENTRY(tsc, SC_THORNS_TRAP))
 				status_change_end(target, SC_THORNS_TRAP, INVALID_TIMER);
-			if( tsc->data[SC_COLD] && target->type != BL_MOB)
+			if( SC_ENTRY(tsc, SC_COLD) && target->type != BL_MOB)
 				status_change_end(target, SC_COLD, INVALID_TIMER);
-			if( tsc->data[SC_EARTH_INSIGNIA]) damage += damage/2;
-			if( tsc->data[SC_FIRE_CLOAK_OPTION])
-				damage -= damage * tsc->data[SC_FIRE_CLOAK_OPTION]->val2 / 100;
-			if( tsc->data[SC_VOLCANIC_ASH]) damage += damage/2; //150%
+			if( SC_ENTRY(tsc, SC_EARTH_INSIGNIA)) damage += damage/2;
+			if( SC_ENTRY(tsc, SC_FIRE_CLOAK_OPTION))
+				damage -= damage * SC_ENTRY(tsc, SC_FIRE_CLOAK_OPTION)->val2 / 100;
+			if( SC_ENTRY(tsc, SC_VOLCANIC_ASH)) damage += damage/2; //150%
 			break;
 		case ELE_HOLY:
-			if( tsc->data[SC_ORATIO]) ratio += tsc->data[SC_ORATIO]->val1 * 2;
+			if( SC_ENTRY(tsc, SC_ORATIO)) ratio += SC_ENTRY(tsc, SC_ORATIO)->val1 * 2;
 			break;
 		case ELE_POISON:
-			if( tsc->data[SC_VENOMIMPRESS] && atk_elem == ELE_POISON ) ratio += tsc->data[SC_VENOMIMPRESS]->val2;
+			if( SC_ENTRY(tsc, SC_VENOMIMPRESS) && atk_elem == ELE_POISON ) ratio += SC_ENTRY(tsc, SC_VENOMIMPRESS)->val2;
 			break;
 		case ELE_WIND:
-			if( tsc->data[SC_COLD] && target->type != BL_MOB) damage += damage/2;
-			if( tsc->data[SC_WATER_INSIGNIA]) damage += damage/2;
+			if( SC_ENTRY(tsc, SC_COLD) && target->type != BL_MOB) damage += damage/2;
+			if( SC_ENTRY(tsc, SC_WATER_INSIGNIA)) damage += damage/2;
 			break;
 		case ELE_WATER:
-			if( tsc->data[SC_FIRE_INSIGNIA]) damage += damage/2;
+			if( SC_ENTRY(tsc, SC_FIRE_INSIGNIA)) damage += damage/2;
 			break;
 		case ELE_EARTH:
-			if( tsc->data[SC_WIND_INSIGNIA]) damage += damage/2;
+			if( SC_ENTRY(tsc, SC_WIND_INSIGNIA)) damage += damage/2;
 			break;
 		case ELE_NEUTRAL:
-			if (tsc->data[SC_ANTI_MATERIAL_BLAST]) ratio += tsc->data[SC_ANTI_MATERIAL_BLAST]->val2;
+			if (SC_ENTRY(tsc, SC_ANTI_MATERIAL_BLAST)) ratio += SC_ENTRY(tsc, SC_ANTI_MATERIAL_BLAST)->val2;
 			break;
 		case ELE_DARK:
-			if (tsc->data[SC_SOULCURSE] != NULL) ratio += 100;
+			if (SC_ENTRY(tsc, SC_SOULCURSE) != NULL) ratio += 100;
 			break;
 		}
 	} //end tsc check
@@ -514,22 +514,22 @@ static int64 battle_calc_weapon_damage(struct block_list *src, struct block_list
 		eatk += 15 * skill_lv;
 
 	if ( skill_id != ASC_METEORASSAULT ) {
-		if ( sc && sc->data[SC_SUB_WEAPONPROPERTY] ) // Temporary. [malufett]
-			damage += damage * sc->data[SC_SUB_WEAPONPROPERTY]->val2 / 100;
+		if ( sc && SC_ENTRY(sc, SC_SUB_WEAPONPROPERTY) ) // Temporary. [malufett]
+			damage += damage * SC_ENTRY(sc, SC_SUB_WEAPONPROPERTY)->val2 / 100;
 	}
 
 	if( sc && sc->count ){
-		if( sc->data[SC_ZENKAI] && watk->ele == sc->data[SC_ZENKAI]->val2 )
+		if( SC_ENTRY(sc, SC_ZENKAI) && watk->ele == SC_ENTRY(sc, SC_ZENKAI)->val2 )
 			eatk += 200;
 	}
 
 #ifdef RENEWAL_EDP
-	if (sc != NULL && sc->data[SC_EDP] != NULL
+	if (sc != NULL && SC_ENTRY(sc, SC_EDP) != NULL
 	    && skill_id != AS_GRIMTOOTH && skill_id != AS_VENOMKNIFE && skill_id != ASC_METEORASSAULT) {
 		struct status_data *tstatus;
 		tstatus = status->get_status_data(bl);
 		eatk += damage * 0x19 * battle->attr_fix_table[tstatus->ele_lv - 1][ELE_POISON][tstatus->def_ele] / 10000;
-		damage += (eatk + damage) * sc->data[SC_EDP]->val3 / 100 + eatk;
+		damage += (eatk + damage) * SC_ENTRY(sc, SC_EDP)->val3 / 100 + eatk;
 	} else /* fall through */
 #endif
 	damage += eatk;
@@ -592,7 +592,7 @@ static int64 battle_calc_base_damage(struct block_list *src, struct block_list *
 	if (src->type == BL_PC) {
 		int64 batk;
 		// Property from mild wind bypasses it
-		if (sc && sc->data[SC_TK_SEVENWIND])
+		if (sc && SC_ENTRY(sc, SC_TK_SEVENWIND))
 			batk = battle->calc_elefix(src, bl, skill_id, skill_lv, status->calc_batk(bl, sc, st->batk, false), nk, n_ele, s_ele, s_ele_, false, flag);
 		else
 			batk = battle->calc_elefix(src, bl, skill_id, skill_lv, status->calc_batk(bl, sc, st->batk, false), nk, n_ele, ELE_NEUTRAL, ELE_NEUTRAL, false, flag);
@@ -616,7 +616,7 @@ static int64 battle_calc_base_damage2(struct status_data *st, struct weapon_atk
 	nullpo_retr(damage, st);
 	nullpo_retr(damage, wa);
 	if (!sd) { //Mobs/Pets
-		if (sc != NULL && sc->data[SC_HLIF_CHANGE] != NULL)
+		if (sc != NULL && SC_ENTRY(sc, SC_HLIF_CHANGE) != NULL)
 			return st->matk_max; // [Aegis] simply uses raw max matk for base damage when Mental Charge active
 		if(flag&4) {
 			atkmin = st->matk_min;
@@ -648,7 +648,7 @@ static int64 battle_calc_base_damage2(struct status_data *st, struct weapon_atk
 		}
 	}
 
-	if (sc && sc->data[SC_MAXIMIZEPOWER])
+	if (sc && SC_ENTRY(sc, SC_MAXIMIZEPOWER))
 		atkmin = atkmax;
 
 	//Weapon Damage calculation
@@ -730,7 +730,7 @@ static int64 battle_addmastery(struct map_session_data *sd, struct block_list *t
 #endif
 	if((skill_lv = pc->checkskill(sd,HT_BEASTBANE)) > 0 && (st->race==RC_BRUTE || st->race==RC_INSECT) ) {
 		damage += (skill_lv * 4);
-		if (sd->sc.data[SC_SOULLINK] && sd->sc.data[SC_SOULLINK]->val2 == SL_HUNTER)
+		if (SC_ENTRY(&sd->sc, SC_SOULLINK) && SC_ENTRY(&sd->sc, SC_SOULLINK)->val2 == SL_HUNTER)
 			damage += sd->status.str;
 	}
 
@@ -882,28 +882,28 @@ static int64 battle_calc_masteryfix(struct block_list *src, struct block_list *t
 
 	if( sc ){ // sc considered as masteries
 		enum elements target_ele = status_get_element(target);
-		if (sc->data[SC_BASILICA_BUFF] != NULL && (target_ele == ELE_UNDEAD || target_ele == ELE_DARK))
-			damage += damage * sc->data[SC_BASILICA_BUFF]->val2 / 100;
-		if(sc->data[SC_GN_CARTBOOST])
-			damage += 10 * sc->data[SC_GN_CARTBOOST]->val1;
-		if(sc->data[SC_CAMOUFLAGE])
-			damage += 30 * ( 10 - sc->data[SC_CAMOUFLAGE]->val4 );
+		if (SC_ENTRY(sc, SC_BASILICA_BUFF) != NULL && (target_ele == ELE_UNDEAD || target_ele == ELE_DARK))
+			damage += damage * SC_ENTRY(sc, SC_BASILICA_BUFF)->val2 / 100;
+		if(SC_ENTRY(sc, SC_GN_CARTBOOST))
+			damage += 10 * SC_ENTRY(sc, SC_GN_CARTBOOST)->val1;
+		if(SC_ENTRY(sc, SC_CAMOUFLAGE))
+			damage += 30 * ( 10 - SC_ENTRY(sc, SC_CAMOUFLAGE)->val4 );
 #ifdef RENEWAL
-		if(sc->data[SC_GS_MADNESSCANCEL])
+		if(SC_ENTRY(sc, SC_GS_MADNESSCANCEL))
 			damage += 100;
-		if(sc->data[SC_GS_GATLINGFEVER]){
+		if(SC_ENTRY(sc, SC_GS_GATLINGFEVER)){
 			if(tstatus->size == SZ_SMALL)
-				damage += 10 * sc->data[SC_GS_GATLINGFEVER]->val1;
+				damage += 10 * SC_ENTRY(sc, SC_GS_GATLINGFEVER)->val1;
 			else if(tstatus->size == SZ_MEDIUM)
-				damage += -5 * sc->data[SC_GS_GATLINGFEVER]->val1;
+				damage += -5 * SC_ENTRY(sc, SC_GS_GATLINGFEVER)->val1;
 			else
-				damage += sc->data[SC_GS_GATLINGFEVER]->val1;
+				damage += SC_ENTRY(sc, SC_GS_GATLINGFEVER)->val1;
 		}
-		if (sc->data[SC_PLATINUM_ALTER])
-			damage += sc->data[SC_PLATINUM_ALTER]->val2;
+		if (SC_ENTRY(sc, SC_PLATINUM_ALTER))
+			damage += SC_ENTRY(sc, SC_PLATINUM_ALTER)->val2;
 #if 0
-		if(sc->data[SC_SPECIALZONE])
-			damage += sc->data[SC_SPECIALZONE]->val2 >> 4;
+		if(SC_ENTRY(sc, SC_SPECIALZONE))
+			damage += SC_ENTRY(sc, SC_SPECIALZONE)->val2 >> 4;
 #endif // 0
 #endif // RENEWAL
 	}
@@ -932,7 +932,7 @@ static int64 battle_calc_masteryfix(struct block_list *src, struct block_list *t
 #endif
 
 	// percentage factor masteries
-	if ( sc && sc->data[SC_MIRACLE] )
+	if ( sc && SC_ENTRY(sc, SC_MIRACLE) )
 		i = 2; //Star anger
 	else
 		ARR_FIND(0, MAX_PC_FEELHATE, i, status->get_class(target) == sd->hate_mob[i]);
@@ -995,12 +995,12 @@ static int64 battle_calc_elefix(struct block_list *src, struct block_list *targe
 		sstatus = status->get_status_data(src);
 		sc = status->get_sc(src);
 
-		if( sc && sc->data[SC_SUB_WEAPONPROPERTY] ) { // Descriptions indicate this means adding a percent of a normal attack in another element. [Skotlex]
-			int64 temp = battle->calc_base_damage2(sstatus, &sstatus->rhw, sc, tstatus->size, BL_CAST(BL_PC, src), (flag?2:0)) * sc->data[SC_SUB_WEAPONPROPERTY]->val2 / 100;
-			damage += battle->attr_fix(src, target, temp, sc->data[SC_SUB_WEAPONPROPERTY]->val1, tstatus->def_ele, tstatus->ele_lv);
+		if( sc && SC_ENTRY(sc, SC_SUB_WEAPONPROPERTY) ) { // Descriptions indicate this means adding a percent of a normal attack in another element. [Skotlex]
+			int64 temp = battle->calc_base_damage2(sstatus, &sstatus->rhw, sc, tstatus->size, BL_CAST(BL_PC, src), (flag?2:0)) * SC_ENTRY(sc, SC_SUB_WEAPONPROPERTY)->val2 / 100;
+			damage += battle->attr_fix(src, target, temp, SC_ENTRY(sc, SC_SUB_WEAPONPROPERTY)->val1, tstatus->def_ele, tstatus->ele_lv);
 			if( left ) {
-				temp = battle->calc_base_damage2(sstatus, &sstatus->lhw, sc, tstatus->size, BL_CAST(BL_PC, src), (flag?2:0)) * sc->data[SC_SUB_WEAPONPROPERTY]->val2 / 100;
-				damage += battle->attr_fix(src, target, temp, sc->data[SC_SUB_WEAPONPROPERTY]->val1, tstatus->def_ele, tstatus->ele_lv);
+				temp = battle->calc_base_damage2(sstatus, &sstatus->lhw, sc, tstatus->size, BL_CAST(BL_PC, src), (flag?2:0)) * SC_ENTRY(sc, SC_SUB_WEAPONPROPERTY)->val2 / 100;
+				damage += battle->attr_fix(src, target, temp, SC_ENTRY(sc, SC_SUB_WEAPONPROPERTY)->val1, tstatus->def_ele, tstatus->ele_lv);
 			}
 		}
 	}
@@ -1032,7 +1032,7 @@ static int64 battle_calc_cardfix2(struct block_list *src, struct block_list *bl,
 			else // SubRangeAttackDamage or bLongAtkDef
 				damage -= damage * tsd->bonus.long_attack_def_rate / 100;
 		}
-		if ( flag&BF_LONG && tsd->sc.data[SC_GS_ADJUSTMENT] ) {
+		if ( flag&BF_LONG && SC_ENTRY(&tsd->sc, SC_GS_ADJUSTMENT) ) {
 			damage -= 20 * damage / 100;
 		}
 	}
@@ -1040,20 +1040,81 @@ static int64 battle_calc_cardfix2(struct block_list *src, struct block_list *bl,
 	return damage;
 }
 
+/**
+ * Index of the cache entry of a card fix rate.
+ */
+static int battle_cardfix_cache_index(int src_id, int target_id, int attack_type, int s_ele, int cflag, int wflag)
+{
+	uint32 hash = (uint32)src_id * 2654435761U;
+
+	hash ^= (uint32)target_id * 40503U;
+	hash ^= (uint32)(attack_type | cflag << 4 | s_ele << 8) * 97U;
+	hash ^= (uint32)wflag;
+	return (int)((hash ^ hash >> 16) & (BATTLE_CARDFIX_CACHE_SIZE - 1));
+}
+
+/**
+ * Card fix rate of src against target, reused from the cache while the status
+ * of both units is unchanged.
+ * Units without status changes have no status version and are never cached.
+ */
+static int battle_cardfix_cached_rate(int attack_type, struct block_list *src, struct block_list *target, int nk, int s_ele, int s_ele_, int cflag, int wflag)
+{
+	const struct status_change *ssc = status->get_sc(src);
+	const struct status_change *tsc = status->get_sc(target);
+	const struct map_session_data *sd = BL_CCAST(BL_PC, src);
+	struct battle_cardfix_entry *entry;
+	int state;
+
+	if (ssc == NULL || tsc == NULL || ssc->version == 0 || tsc->version == 0)
+		return battle->calc_cardfix_rate(attack_type, src, target, nk, s_ele, s_ele_, cflag, wflag);
+
+	state = (sd != NULL && sd->state.arrow_atk ? 1 : 0) | (battle_config.left_cardfix_to_right ? 2 : 0);
+	entry = &battle->cardfix_cache.entry[battle_cardfix_cache_index(src->id, target->id, attack_type, s_ele, cflag, wflag)];
+	if (entry->src_id == src->id && entry->target_id == target->id
+	 && entry->src_version == ssc->version && entry->target_version == tsc->version
+	 && entry->attack_type == attack_type && entry->nk == nk && entry->s_ele == s_ele && entry->s_ele_ == s_ele_
+	 && entry->cflag == cflag && entry->wflag == wflag && entry->state == state) {
+		battle->cardfix_cache.hits++;
+		return entry->rate;
+	}
+
+	battle->cardfix_cache.misses++;
+	entry->src_id = src->id;
+	entry->target_id = target->id;
+	entry->src_version = ssc->version;
+	entry->target_version = tsc->version;
+	entry->attack_type = attack_type;
+	entry->nk = nk;
+	entry->s_ele = s_ele;
+	entry->s_ele_ = s_ele_;
+	entry->cflag = cflag;
+	entry->wflag = wflag;
+	entry->state = state;
+	entry->rate = battle->calc_cardfix_rate(attack_type, src, target, nk, s_ele, s_ele_, cflag, wflag);
+	return entry->rate;
+}
+
+/**
+ * Forgets the cached card fix rates.
+ */
+static void battle_cardfix_cache_clear(void)
+{
+	memset(&battle->cardfix_cache, 0, sizeof(battle->cardfix_cache));
+}
+
 /*==========================================
  * Calculates card bonuses damage adjustments.
  * cflag(cardfix flag):
  * &1 - calc for left hand.
  * &2 - atker side cardfix(BF_WEAPON) otherwise target side(BF_WEAPON).
+ * The rate only depends on the status of both units, it is cached
+ * (see battle_cardfix_cached_rate).
  *------------------------------------------*/
 // FIXME: wflag is undocumented
 static int64 battle_calc_cardfix(int attack_type, struct block_list *src, struct block_list *target, int nk, int s_ele, int s_ele_, int64 damage, int cflag, int wflag)
 {
-	struct map_session_data *sd, *tsd;
-	int cardfix = 1000;
-	int t_class, s_class, s_race2, t_race2;
-	struct status_data *sstatus, *tstatus;
-	int i;
+	int rate;
 
 	if( !damage )
 		return 0;
@@ -1061,6 +1122,26 @@ static int64 battle_calc_cardfix(int attack_type, struct block_list *src, struct
 	nullpo_ret(src);
 	nullpo_ret(target);
 
+	rate = battle_cardfix_cached_rate(attack_type, src, target, nk, s_ele, s_ele_, cflag, wflag);
+	if( rate != 1000 )
+		damage = damage * rate / 1000;
+	return damage;
+}
+
+/**
+ * Card bonuses rate of src against target (1000 = 100%), see battle_calc_cardfix.
+ */
+static int battle_calc_cardfix_rate(int attack_type, struct block_list *src, struct block_list *target, int nk, int s_ele, int s_ele_, int cflag, int wflag)
+{
+	struct map_session_data *sd, *tsd;
+	int cardfix = 1000;
+	int t_class, s_class, s_race2, t_race2;
+	struct status_data *sstatus, *tstatus;
+	int i;
+
+	nullpo_retr(1000, src);
+	nullpo_retr(1000, target);
+
 	sd = BL_CAST(BL_PC, src);
 	tsd = BL_CAST(BL_PC, target);
 	t_class = status->get_class(target);
@@ -1152,11 +1233,9 @@ static int64 battle_calc_cardfix(int attack_type, struct block_list *src, struct
 
 				cardfix = cardfix * ( 100 - tsd->bonus.magic_def_rate ) / 100;
 
-				if( tsd->sc.data[SC_PROTECT_MDEF] )
-					cardfix = cardfix * ( 100 - tsd->sc.data[SC_PROTECT_MDEF]->val1 ) / 100;
+				if( SC_ENTRY(&tsd->sc, SC_PROTECT_MDEF) )
+					cardfix = cardfix * ( 100 - SC_ENTRY(&tsd->sc, SC_PROTECT_MDEF)->val1 ) / 100;
 			}
-			if ( cardfix != 1000 )
-				damage = damage * cardfix / 1000;
 			break;
 		case BF_WEAPON:
 			t_race2 = status->get_race2(target);
@@ -1264,9 +1343,7 @@ static int64 battle_calc_cardfix(int attack_type, struct block_list *src, struct
 						cardfix = cardfix * (100 + sd->bonus.long_attack_atk_rate) / 100;
 #endif
 					if( (cflag&1) && cardfix_ != 1000 )
-						damage = damage * cardfix_ / 1000;
-					else if( cardfix != 1000 )
-						damage = damage * cardfix / 1000;
+						cardfix = cardfix_;
 				}
 			}else{
 				// Target side
@@ -1344,10 +1421,8 @@ static int64 battle_calc_cardfix(int attack_type, struct block_list *src, struct
 					else // BF_LONG (there's no other choice)
 						cardfix = cardfix * (100 - tsd->bonus.long_attack_def_rate) / 100;
 #endif
-					if( tsd->sc.data[SC_PROTECT_DEF] )
-						cardfix = cardfix * (100 - tsd->sc.data[SC_PROTECT_DEF]->val1) / 100;
-					if( cardfix != 1000 )
-						damage = damage * cardfix / 1000;
+					if( SC_ENTRY(&tsd->sc, SC_PROTECT_DEF) )
+						cardfix = cardfix * (100 - SC_ENTRY(&tsd->sc, SC_PROTECT_DEF)->val1) / 100;
 				}
 			}
 			break;
@@ -1379,13 +1454,11 @@ static int64 battle_calc_cardfix(int attack_type, struct block_list *src, struct
 				cardfix = cardfix*(100 - tsd->subsize[sstatus->size]) / 100;
 				cardfix = cardfix*(100 - tsd->subrace2[s_race2]) / 100;
 				cardfix = cardfix * (100 - tsd->bonus.misc_def_rate) / 100;
-				if ( cardfix != 1000 )
-					damage = damage * cardfix / 1000;
 			}
 			break;
 	}
 
-	return damage;
+	return cardfix;
 }
 
 /*==========================================
@@ -1448,8 +1521,8 @@ static int64 battle_calc_defense(int attack_type, struct block_list *src, struct
 				}
 			}
 
-			if( sc && sc->data[SC_EXPIATIO] ){
-				i = 5 * sc->data[SC_EXPIATIO]->val1; // 5% per level
+			if( sc && SC_ENTRY(sc, SC_EXPIATIO) ){
+				i = 5 * SC_ENTRY(sc, SC_EXPIATIO)->val1; // 5% per level
 				def1 -= def1 * i / 100;
 #ifndef RENEWAL
 				def2 -= def2 * i / 100;
@@ -1461,11 +1534,11 @@ static int64 battle_calc_defense(int attack_type, struct block_list *src, struct
 				if (target_count >= battle_config.vit_penalty_count) {
 					int penalty = (target_count - (battle_config.vit_penalty_count - 1)) * battle_config.vit_penalty_num;
 					if (battle_config.vit_penalty_type == 1) {
-						if (tsc == NULL || tsc->data[SC_STEELBODY] == NULL)
+						if (tsc == NULL || SC_ENTRY(tsc, SC_STEELBODY) == NULL)
 							def1 = def1 * (100 - penalty) / 100;
 						def2 = def2 * (100 - penalty) / 100;
 					} else { // Assume type 2
-						if (tsc == NULL || tsc->data[SC_STEELBODY] == NULL)
+						if (tsc == NULL || SC_ENTRY(tsc, SC_STEELBODY) == NULL)
 							def1 -= penalty;
 						def2 -= penalty;
 					}
@@ -1667,7 +1740,7 @@ static int battle_calc_skillratio(int attack_type, struct block_list *src, struc
 					break;
 				case AL_HOLYLIGHT:
 					skillratio += 25;
-					if (sc && sc->data[SC_SOULLINK] && sc->data[SC_SOULLINK]->val2 == SL_PRIEST)
+					if (sc && SC_ENTRY(sc, SC_SOULLINK) && SC_ENTRY(sc, SC_SOULLINK)->val2 == SL_PRIEST)
 						skillratio *= 5; //Does 5x damage include bonuses from other skills?
 					break;
 				case AL_RUWACH:
@@ -1772,7 +1845,7 @@ static int battle_calc_skillratio(int attack_type, struct block_list *src, struc
 #ifdef RENEWAL
 				case NJ_HYOUSENSOU:
 					skillratio -= 30;
-					if (sc != NULL && sc->data[SC_NJ_SUITON] != NULL)
+					if (sc != NULL && SC_ENTRY(sc, SC_NJ_SUITON) != NULL)
 						skillratio += 2 * skill_lv;
 					if (sd && sd->charm_type == CHARM_TYPE_WATER && sd->charm_count > 0)
 						skillratio += 5 * sd->charm_count;
@@ -1862,7 +1935,7 @@ static int battle_calc_skillratio(int attack_type, struct block_list *src, struc
 					RE_LVL_DMOD(100);
 					break;
 				case WL_JACKFROST:
-					if( tsc && tsc->data[SC_FROSTMISTY] ){
+					if( tsc && SC_ENTRY(tsc, SC_FROSTMISTY) ){
 						skillratio += 900 + 300 * skill_lv;
 						RE_LVL_DMOD(100);
 					}else{
@@ -1942,7 +2015,7 @@ static int battle_calc_skillratio(int attack_type, struct block_list *src, struc
 				{
 					uint16 lv = skill_lv;
 					int bandingBonus = 0;
-					if( sc && sc->data[SC_BANDING] )
+					if( sc && SC_ENTRY(sc, SC_BANDING) )
 						bandingBonus = 200 * (sd ? skill->check_pc_partner(sd,skill_id,&lv,skill->get_splash(skill_id,skill_lv),0) : 1);
 					skillratio = ((300 * skill_lv) + bandingBonus) * (sd ? sd->status.job_level : 1) / 25;
 				}
@@ -1964,50 +2037,50 @@ static int battle_calc_skillratio(int attack_type, struct block_list *src, struc
 				case SO_FIREWALK:
 					skillratio = 60 * skill_lv;
 					RE_LVL_DMOD(100);
-					if( sc && sc->data[SC_HEATER_OPTION] )
-						skillratio += sc->data[SC_HEATER_OPTION]->val3 / 2;
+					if( sc && SC_ENTRY(sc, SC_HEATER_OPTION) )
+						skillratio += SC_ENTRY(sc, SC_HEATER_OPTION)->val3 / 2;
 					break;
 				case SO_ELECTRICWALK:
 					skillratio = 60 * skill_lv;
 					RE_LVL_DMOD(100);
-					if( sc && sc->data[SC_BLAST_OPTION] )
-						skillratio += sc->data[SC_BLAST_OPTION]->val2 / 2;
+					if( sc && SC_ENTRY(sc, SC_BLAST_OPTION) )
+						skillratio += SC_ENTRY(sc, SC_BLAST_OPTION)->val2 / 2;
 					break;
 				case SO_EARTHGRAVE:
 					skillratio = st->int_ * skill_lv + 200 * (sd ? pc->checkskill(sd,SA_SEISMICWEAPON) : 1);
 					RE_LVL_DMOD(100);
-					if( sc && sc->data[SC_CURSED_SOIL_OPTION] )
-						skillratio += sc->data[SC_CURSED_SOIL_OPTION]->val3 * 5;
+					if( sc && SC_ENTRY(sc, SC_CURSED_SOIL_OPTION) )
+						skillratio += SC_ENTRY(sc, SC_CURSED_SOIL_OPTION)->val3 * 5;
 					break;
 				case SO_DIAMONDDUST:
 					skillratio = (st->int_ * skill_lv + 200 * (sd ? pc->checkskill(sd, SA_FROSTWEAPON) : 1)) * status->get_lv(src) / 100;
-					if( sc && sc->data[SC_COOLER_OPTION] )
-						skillratio += sc->data[SC_COOLER_OPTION]->val3 * 5;
+					if( sc && SC_ENTRY(sc, SC_COOLER_OPTION) )
+						skillratio += SC_ENTRY(sc, SC_COOLER_OPTION)->val3 * 5;
 					break;
 				case SO_POISON_BUSTER:
 					skillratio += 900 + 300 * skill_lv;
 					RE_LVL_DMOD(100);
-					if( sc && sc->data[SC_CURSED_SOIL_OPTION] )
-						skillratio += sc->data[SC_CURSED_SOIL_OPTION]->val3 * 5;
+					if( sc && SC_ENTRY(sc, SC_CURSED_SOIL_OPTION) )
+						skillratio += SC_ENTRY(sc, SC_CURSED_SOIL_OPTION)->val3 * 5;
 					break;
 				case SO_PSYCHIC_WAVE:
 					skillratio = 70 * skill_lv + 3 * st->int_;
 					RE_LVL_DMOD(100);
-					if( sc && ( sc->data[SC_HEATER_OPTION] || sc->data[SC_COOLER_OPTION]
-					         || sc->data[SC_BLAST_OPTION] || sc->data[SC_CURSED_SOIL_OPTION] ) )
+					if( sc && ( SC_ENTRY(sc, SC_HEATER_OPTION) || SC_ENTRY(sc, SC_COOLER_OPTION)
+					         || SC_ENTRY(sc, SC_BLAST_OPTION) || SC_ENTRY(sc, SC_CURSED_SOIL_OPTION) ) )
 						skillratio += skillratio * 20 / 100;
 					break;
 				case SO_VARETYR_SPEAR:
 					skillratio = status_get_int(src) * skill_lv + ( sd ? pc->checkskill(sd, SA_LIGHTNINGLOADER) * 50 : 0 );
 					RE_LVL_DMOD(100);
-					if( sc && sc->data[SC_BLAST_OPTION] )
-						skillratio += sc->data[SC_BLAST_OPTION]->val2 * 5;
+					if( sc && SC_ENTRY(sc, SC_BLAST_OPTION) )
+						skillratio += SC_ENTRY(sc, SC_BLAST_OPTION)->val2 * 5;
 					break;
 				case SO_CLOUD_KILL:
 					skillratio = 40 * skill_lv;
 					RE_LVL_DMOD(100);
-					if( sc && sc->data[SC_CURSED_SOIL_OPTION] )
-						skillratio += sc->data[SC_CURSED_SOIL_OPTION]->val3;
+					if( sc && SC_ENTRY(sc, SC_CURSED_SOIL_OPTION) )
+						skillratio += SC_ENTRY(sc, SC_CURSED_SOIL_OPTION)->val3;
 					break;
 				case GN_DEMONIC_FIRE: {
 						int fire_expansion_lv = skill_lv / 100;
@@ -2064,7 +2137,7 @@ static int battle_calc_skillratio(int attack_type, struct block_list *src, struc
 					skillratio += 100 + 100 * skill_lv;
 					break;
 				case SP_CURSEEXPLOSION:
-					if (tsc != NULL && tsc->data[SC_SOULCURSE] != NULL)
+					if (tsc != NULL && SC_ENTRY(tsc, SC_SOULCURSE) != NULL)
 						skillratio += 1400 + 200 * skill_lv;
 					else
 						skillratio += 300 + 100 * skill_lv;
@@ -2286,7 +2359,7 @@ static int battle_calc_skillratio(int attack_type, struct block_list *src, struc
 
 					// Cast and Target must be locked in BladeStop.
 					// In other words: A third player won't do extra damage from hitting another Monk's blade stop
-					if (tsc != NULL && tsc->data[SC_BLADESTOP] != NULL && sc->data[SC_BLADESTOP] != NULL)
+					if (tsc != NULL && SC_ENTRY(tsc, SC_BLADESTOP) != NULL && SC_ENTRY(sc, SC_BLADESTOP) != NULL)
 						ratio += ratio * 50 / 100;
 
 					skillratio += - 100 + ratio;
@@ -2301,7 +2374,7 @@ static int battle_calc_skillratio(int attack_type, struct block_list *src, struc
 
 					// Cast and Target must be locked in BladeStop.
 					// In other words: A third player won't do extra damage from hitting another Monk's blade stop
-					if (tsc != NULL && tsc->data[SC_BLADESTOP] != NULL && sc->data[SC_BLADESTOP] != NULL)
+					if (tsc != NULL && SC_ENTRY(tsc, SC_BLADESTOP) != NULL && SC_ENTRY(sc, SC_BLADESTOP) != NULL)
 						ratio += ratio * 50 / 100;
 
 					skillratio += - 100 + ratio;
@@ -2461,11 +2534,11 @@ static int battle_calc_skillratio(int attack_type, struct block_list *src, struc
 					break;
 				case TK_JUMPKICK:
 					skillratio += -70 + 10*skill_lv;
-					if (sc && sc->data[SC_COMBOATTACK] && sc->data[SC_COMBOATTACK]->val1 == skill_id)
+					if (sc && SC_ENTRY(sc, SC_COMBOATTACK) && SC_ENTRY(sc, SC_COMBOATTACK)->val1 == skill_id)
 						skillratio += 10 * status->get_lv(src) / 3; //Tumble bonus
 					if (flag) {
 						skillratio += 10 * status->get_lv(src) / 3; //Running bonus (TODO: What is the real bonus?)
-						if( sc && sc->data[SC_STRUP] )  // Spurt bonus
+						if( sc && SC_ENTRY(sc, SC_STRUP) )  // Spurt bonus
 							skillratio *= 2;
 					}
 					break;
@@ -2491,7 +2564,7 @@ static int battle_calc_skillratio(int attack_type, struct block_list *src, struc
 					break;
 				case GS_DESPERADO:
 					skillratio += 50 * (skill_lv - 1);
-					if (sc != NULL && sc->data[SC_FALLEN_ANGEL])
+					if (sc != NULL && SC_ENTRY(sc, SC_FALLEN_ANGEL))
 						skillratio *= 2;
 					break;
 				case GS_DUST:
@@ -2600,8 +2673,8 @@ static int battle_calc_skillratio(int attack_type, struct block_list *src, struc
 				case GC_CROSSRIPPERSLASHER:
 					skillratio += 300 + 80 * skill_lv;
 					RE_LVL_DMOD(100);
-					if( sc && sc->data[SC_ROLLINGCUTTER] )
-						skillratio += sc->data[SC_ROLLINGCUTTER]->val1 * status_get_agi(src);
+					if( sc && SC_ENTRY(sc, SC_ROLLINGCUTTER) )
+						skillratio += SC_ENTRY(sc, SC_ROLLINGCUTTER)->val1 * status_get_agi(src);
 					break;
 				case GC_DARKCROW:
 					skillratio += 100 * (skill_lv - 1);
@@ -2628,13 +2701,13 @@ static int battle_calc_skillratio(int attack_type, struct block_list *src, struc
 					break;
 				case RA_WUGDASH:// ATK 300%
 					skillratio = 300;
-					if( sc && sc->data[SC_DANCE_WITH_WUG] )
-						skillratio += 10 * sc->data[SC_DANCE_WITH_WUG]->val1 * (2 + battle->calc_chorusbonus(sd));
+					if( sc && SC_ENTRY(sc, SC_DANCE_WITH_WUG) )
+						skillratio += 10 * SC_ENTRY(sc, SC_DANCE_WITH_WUG)->val1 * (2 + battle->calc_chorusbonus(sd));
 					break;
 				case RA_WUGSTRIKE:
 					skillratio = 200 * skill_lv;
-					if( sc && sc->data[SC_DANCE_WITH_WUG] )
-						skillratio += 10 * sc->data[SC_DANCE_WITH_WUG]->val1 * (2 + battle->calc_chorusbonus(sd));
+					if( sc && SC_ENTRY(sc, SC_DANCE_WITH_WUG) )
+						skillratio += 10 * SC_ENTRY(sc, SC_DANCE_WITH_WUG)->val1 * (2 + battle->calc_chorusbonus(sd));
 					break;
 				case RA_WUGBITE:
 					skillratio += 300 + 200 * skill_lv;
@@ -2770,11 +2843,11 @@ static int battle_calc_skillratio(int attack_type, struct block_list *src, struc
 					break;
 				case LG_HESPERUSLIT:
 					skillratio = 120 * skill_lv;
-					if( sc && sc->data[SC_BANDING] )
-						skillratio += 200 * sc->data[SC_BANDING]->val2;
-					if( sc && sc->data[SC_BANDING] && sc->data[SC_BANDING]->val2 > 5 )
+					if( sc && SC_ENTRY(sc, SC_BANDING) )
+						skillratio += 200 * SC_ENTRY(sc, SC_BANDING)->val2;
+					if( sc && SC_ENTRY(sc, SC_BANDING) && SC_ENTRY(sc, SC_BANDING)->val2 > 5 )
 						skillratio = skillratio * 150 / 100;
-					if( sc && sc->data[SC_INSPIRATION] )
+					if( sc && SC_ENTRY(sc, SC_INSPIRATION) )
 						skillratio += 600;
 					RE_LVL_DMOD(100);
 					break;
@@ -2783,15 +2856,15 @@ static int battle_calc_skillratio(int attack_type, struct block_list *src, struc
 					RE_LVL_DMOD(100);
 					break;
 				case SR_SKYNETBLOW:
-					if( sc && sc->data[SC_COMBOATTACK] && sc->data[SC_COMBOATTACK]->val1 == SR_DRAGONCOMBO )//ATK [{(Skill Level x 100) + (Caster AGI) + 150} x Caster Base Level / 100] %
+					if( sc && SC_ENTRY(sc, SC_COMBOATTACK) && SC_ENTRY(sc, SC_COMBOATTACK)->val1 == SR_DRAGONCOMBO )//ATK [{(Skill Level x 100) + (Caster AGI) + 150} x Caster Base Level / 100] %
 						skillratio += 100 * skill_lv + status_get_agi(src) + 50;
 					else //ATK [{(Skill Level x 80) + (Caster AGI)} x Caster Base Level / 100] %
 						skillratio += -100 + 80 * skill_lv + status_get_agi(src);
 					RE_LVL_DMOD(100);
 					break;
 				case SR_EARTHSHAKER:
-					if( tsc && (tsc->data[SC_HIDING] || tsc->data[SC_CLOAKING] || // [(Skill Level x 150) x (Caster Base Level / 100) + (Caster INT x 3)] %
-						tsc->data[SC_CHASEWALK] || tsc->data[SC_CLOAKINGEXCEED] || tsc->data[SC__INVISIBILITY]) ){
+					if( tsc && (SC_ENTRY(tsc, SC_HIDING) || SC_ENTRY(tsc, SC_CLOAKING) || // [(Skill Level x 150) x (Caster Base Level / 100) + (Caster INT x 3)] %
+						SC_ENTRY(tsc, SC_CHASEWALK) || SC_ENTRY(tsc, SC_CLOAKINGEXCEED) || SC_ENTRY(tsc, SC__INVISIBILITY)) ){
 						skillratio += -100 + 150 * skill_lv;
 						RE_LVL_DMOD(100);
 						skillratio += status_get_int(src) * 3;
@@ -2809,7 +2882,7 @@ static int battle_calc_skillratio(int attack_type, struct block_list *src, struc
 					{
 						int hp = status_get_max_hp(src) * (10 + 2 * skill_lv) / 100,
 							sp = status_get_max_sp(src) * (6 + skill_lv) / 100;
-						if( sc && sc->data[SC_COMBOATTACK] && sc->data[SC_COMBOATTACK]->val1 == SR_FALLENEMPIRE ) // ATK [((Caster consumed HP + SP) / 2) x Caster Base Level / 100] %
+						if( sc && SC_ENTRY(sc, SC_COMBOATTACK) && SC_ENTRY(sc, SC_COMBOATTACK)->val1 == SR_FALLENEMPIRE ) // ATK [((Caster consumed HP + SP) / 2) x Caster Base Level / 100] %
 							skillratio += -100 + (hp+sp) / 2;
 						else
 							skillratio += -100 + (hp+sp) / 4;
@@ -2818,8 +2891,8 @@ static int battle_calc_skillratio(int attack_type, struct block_list *src, struc
 						break;
 				case SR_RAMPAGEBLASTER:
 					skillratio += 20 * skill_lv * (sd?sd->spiritball_old:5) - 100;
-					if( sc && sc->data[SC_EXPLOSIONSPIRITS] ) {
-						skillratio += sc->data[SC_EXPLOSIONSPIRITS]->val1 * 20;
+					if( sc && SC_ENTRY(sc, SC_EXPLOSIONSPIRITS) ) {
+						skillratio += SC_ENTRY(sc, SC_EXPLOSIONSPIRITS)->val1 * 20;
 						RE_LVL_DMOD(120);
 					} else {
 						RE_LVL_DMOD(150);
@@ -2840,8 +2913,8 @@ static int battle_calc_skillratio(int attack_type, struct block_list *src, struc
 					RE_LVL_DMOD(100);
 					break;
 				case SR_GATEOFHELL:
-					if( sc && sc->data[SC_COMBOATTACK]
-						&& sc->data[SC_COMBOATTACK]->val1 == SR_FALLENEMPIRE )
+					if( sc && SC_ENTRY(sc, SC_COMBOATTACK)
+						&& SC_ENTRY(sc, SC_COMBOATTACK)->val1 == SR_FALLENEMPIRE )
 						skillratio += 800 * skill_lv -100;
 					else
 						skillratio += 500 * skill_lv -100;
@@ -2924,7 +2997,7 @@ static int battle_calc_skillratio(int attack_type, struct block_list *src, struc
 					break;
 				case SO_VARETYR_SPEAR://ATK [{( Striking Level x 50 ) + ( Varetyr Spear Skill Level x 50 )} x Caster Base Level / 100 ] %
 					skillratio += -100 + 50 * skill_lv + ( sd ? pc->checkskill(sd, SO_STRIKING) * 50 : 0 );
-					if( sc && sc->data[SC_BLAST_OPTION] )
+					if( sc && SC_ENTRY(sc, SC_BLAST_OPTION) )
 						skillratio += (sd ? sd->status.job_level * 5 : 0);
 					break;
 					// Physical Elemental Spirits Attack Skills
@@ -2958,7 +3031,7 @@ static int battle_calc_skillratio(int attack_type, struct block_list *src, struc
 				case KO_JYUMONJIKIRI:
 					skillratio += -100 + 150 * skill_lv;
 					RE_LVL_DMOD(120);
-					if( tsc && tsc->data[SC_KO_JYUMONJIKIRI] )
+					if( tsc && SC_ENTRY(tsc, SC_KO_JYUMONJIKIRI) )
 						skillratio += status->get_lv(src) * skill_lv;
 					break;
 				case KO_HUUMARANKA:
@@ -2970,11 +3043,11 @@ static int battle_calc_skillratio(int attack_type, struct block_list *src, struc
 					if (tsc != NULL) {
 						struct status_change_entry *sce;
 
-						if ((sce = tsc->data[SC_SOULLINK]) != NULL
-						|| (sce = tsc->data[SC_SOULGOLEM]) != NULL
-						|| (sce = tsc->data[SC_SOULSHADOW]) != NULL
-						|| (sce = tsc->data[SC_SOULFALCON]) != NULL
-						|| (sce = tsc->data[SC_SOULFAIRY]) != NULL) // Bonus damage added when target is soul linked.
+						if ((sce = SC_ENTRY(tsc, SC_SOULLINK)) != NULL
+						|| (sce = SC_ENTRY(tsc, SC_SOULGOLEM)) != NULL
+						|| (sce = SC_ENTRY(tsc, SC_SOULSHADOW)) != NULL
+						|| (sce = SC_ENTRY(tsc, SC_SOULFALCON)) != NULL
+						|| (sce = SC_ENTRY(tsc, SC_SOULFAIRY)) != NULL) // Bonus damage added when target is soul linked.
 							skillratio += 200 * sce->val1;
 					}
 					break;
@@ -3049,8 +3122,8 @@ static int battle_calc_skillratio(int attack_type, struct block_list *src, struc
 				case SJ_FULLMOONKICK:
 					skillratio += 1000 + 100 * skill_lv;
 					RE_LVL_DMOD(100);
-					if (sc != NULL && sc->data[SC_LIGHTOFMOON] != NULL)
-						skillratio += skillratio * sc->data[SC_LIGHTOFMOON]->val2 / 100;
+					if (sc != NULL && SC_ENTRY(sc, SC_LIGHTOFMOON) != NULL)
+						skillratio += skillratio * SC_ENTRY(sc, SC_LIGHTOFMOON)->val2 / 100;
 					break;
 				case SJ_NEWMOONKICK:
 					skillratio += 600 + 100 * skill_lv;
@@ -3061,8 +3134,8 @@ static int battle_calc_skillratio(int attack_type, struct block_list *src, struc
 				case SJ_SOLARBURST:
 					skillratio += 900 + 220 * skill_lv;
 					RE_LVL_DMOD(100);
-					if (sc != NULL && sc->data[SC_LIGHTOFSUN] != NULL)
-						skillratio += skillratio * sc->data[SC_LIGHTOFSUN]->val2 / 100;
+					if (sc != NULL && SC_ENTRY(sc, SC_LIGHTOFSUN) != NULL)
+						skillratio += skillratio * SC_ENTRY(sc, SC_LIGHTOFSUN)->val2 / 100;
 					break;
 				case SJ_PROMINENCEKICK:
 						skillratio += 50 + 50 * skill_lv;
@@ -3071,8 +3144,8 @@ static int battle_calc_skillratio(int attack_type, struct block_list *src, struc
 				case SJ_FALLINGSTAR_ATK2:
 					skillratio += 100 * skill_lv;
 					RE_LVL_DMOD(100);
-					if (sc != NULL && sc->data[SC_LIGHTOFSTAR] != NULL)
-						skillratio += skillratio * sc->data[SC_LIGHTOFSTAR]->val2 / 100;
+					if (sc != NULL && SC_ENTRY(sc, SC_LIGHTOFSTAR) != NULL)
+						skillratio += skillratio * SC_ENTRY(sc, SC_LIGHTOFSTAR)->val2 / 100;
 					break;
 				default:
 					battle->calc_skillratio_weapon_unknown(&attack_type, src, target, &skill_id, &skill_lv, &skillratio, &flag);
@@ -3080,25 +3153,25 @@ static int battle_calc_skillratio(int attack_type, struct block_list *src, struc
 			}
 			//Skill damage modifiers that stack linearly
 			if(sc && skill_id != PA_SACRIFICE){
-				if(sc->data[SC_OVERTHRUST])
-					skillratio += sc->data[SC_OVERTHRUST]->val3;
-				if(sc->data[SC_OVERTHRUSTMAX])
-					skillratio += sc->data[SC_OVERTHRUSTMAX]->val2;
-				if(sc->data[SC_BERSERK])
+				if(SC_ENTRY(sc, SC_OVERTHRUST))
+					skillratio += SC_ENTRY(sc, SC_OVERTHRUST)->val3;
+				if(SC_ENTRY(sc, SC_OVERTHRUSTMAX))
+					skillratio += SC_ENTRY(sc, SC_OVERTHRUSTMAX)->val2;
+				if(SC_ENTRY(sc, SC_BERSERK))
 #ifndef RENEWAL
 					skillratio += 100;
 #else
 					skillratio += 200;
-				if( sc->data[SC_TRUESIGHT] )
-					skillratio += 2*sc->data[SC_TRUESIGHT]->val1;
+				if( SC_ENTRY(sc, SC_TRUESIGHT) )
+					skillratio += 2*SC_ENTRY(sc, SC_TRUESIGHT)->val1;
 #ifndef RENEWAL
-				if( sc->data[SC_LKCONCENTRATION] )
-					skillratio += sc->data[SC_LKCONCENTRATION]->val2;
+				if( SC_ENTRY(sc, SC_LKCONCENTRATION) )
+					skillratio += SC_ENTRY(sc, SC_LKCONCENTRATION)->val2;
 #endif
 				if (sd != NULL && sd->weapontype == W_KATAR && (i=pc->checkskill(sd,ASC_KATAR)) > 0)
 					skillratio += skillratio * (10 + 2 * i) / 100;
 #endif
-				if( (!skill_id || skill_id == KN_AUTOCOUNTER) && sc->data[SC_CRUSHSTRIKE] ){
+				if( (!skill_id || skill_id == KN_AUTOCOUNTER) && SC_ENTRY(sc, SC_CRUSHSTRIKE) ){
 					if( sd )
 					{//ATK [{Weapon Level * (Weapon Upgrade Level + 6) * 100} + (Weapon ATK) + (Weapon Weight)]%
 						short index = sd->equip_index[EQI_HAND_R];
@@ -3167,7 +3240,7 @@ static int64 battle_calc_damage(struct block_list *src, struct block_list *bl, s
 	s_sc = status->get_sc(src);
 	sc = status->get_sc(bl);
 
-	if( sc && sc->data[SC_INVINCIBLE] && !sc->data[SC_INVINCIBLEOFF] )
+	if( sc && SC_ENTRY(sc, SC_INVINCIBLE) && !SC_ENTRY(sc, SC_INVINCIBLEOFF) )
 		return 1;
 
 	switch(skill_id) {
@@ -3177,18 +3250,18 @@ static int64 battle_calc_damage(struct block_list *src, struct block_list *bl, s
 	case SP_SOULEXPLOSION:
 		return damage; //This skill bypass everything else.
 	}
-	if (skill_id == SJ_NOVAEXPLOSING && !(sc != NULL && (sc->data[SC_SAFETYWALL] != NULL || sc->data[SC_MILLENNIUMSHIELD] != NULL)))
+	if (skill_id == SJ_NOVAEXPLOSING && !(sc != NULL && (SC_ENTRY(sc, SC_SAFETYWALL) != NULL || SC_ENTRY(sc, SC_MILLENNIUMSHIELD) != NULL)))
 		return damage;
 
 	if( sc && sc->count )
 	{
 		//First, sc_*'s that reduce damage to 0.
-		if( sc->data[SC_BASILICA] && !(status_get_mode(src)&MD_BOSS) )
+		if( SC_ENTRY(sc, SC_BASILICA) && !(status_get_mode(src)&MD_BOSS) )
 		{
 			d->dmg_lv = ATK_BLOCK;
 			return 0;
 		}
-		if( sc->data[SC_WHITEIMPRISON] && skill_id != HW_GRAVITATION ) { // Gravitation and Pressure do damage without removing the effect
+		if( SC_ENTRY(sc, SC_WHITEIMPRISON) && skill_id != HW_GRAVITATION ) { // Gravitation and Pressure do damage without removing the effect
 			if( skill_id == MG_NAPALMBEAT ||
 				skill_id == MG_SOULSTRIKE ||
 				skill_id == WL_SOULEXPANSION ||
@@ -3204,15 +3277,15 @@ static int64 battle_calc_damage(struct block_list *src, struct block_list *bl, s
 			}
 		}
 
-		if( sc->data[SC_ZEPHYR] && ((flag&BF_LONG) || rnd()%100 < 10) ) {
+		if( SC_ENTRY(sc, SC_ZEPHYR) && ((flag&BF_LONG) || rnd()%100 < 10) ) {
 				d->dmg_lv = ATK_BLOCK;
 				return 0;
 		}
 
-		if( sc->data[SC_SAFETYWALL] && (flag&(BF_SHORT|BF_MAGIC))==BF_SHORT )
+		if( SC_ENTRY(sc, SC_SAFETYWALL) && (flag&(BF_SHORT|BF_MAGIC))==BF_SHORT )
 		{
-			struct skill_unit_group* group = skill->id2group(sc->data[SC_SAFETYWALL]->val3);
-			uint16 src_skill_id = sc->data[SC_SAFETYWALL]->val2;
+			struct skill_unit_group* group = skill->id2group(SC_ENTRY(sc, SC_SAFETYWALL)->val3);
+			uint16 src_skill_id = SC_ENTRY(sc, SC_SAFETYWALL)->val2;
 			if (group) {
 				d->dmg_lv = ATK_BLOCK;
 				if(src_skill_id == MH_STEINWAND){
@@ -3250,31 +3323,31 @@ static int64 battle_calc_damage(struct block_list *src, struct block_list *bl, s
 			status_change_end(bl, SC_SAFETYWALL, INVALID_TIMER);
 		}
 
-		if (((sc->data[SC_PNEUMA] && (flag&(BF_MAGIC|BF_LONG)) == BF_LONG) || (sc->data[SC__MANHOLE] || sc->data[SC_GRAVITYCONTROL])) && skill_id != SP_SOULEXPLOSION) {
+		if (((SC_ENTRY(sc, SC_PNEUMA) && (flag&(BF_MAGIC|BF_LONG)) == BF_LONG) || (SC_ENTRY(sc, SC__MANHOLE) || SC_ENTRY(sc, SC_GRAVITYCONTROL))) && skill_id != SP_SOULEXPLOSION) {
 			d->dmg_lv = ATK_BLOCK;
 			return 0;
 		}
-		if( sc->data[SC_NEUTRALBARRIER] && (flag&(BF_MAGIC|BF_LONG)) == BF_LONG && skill_id != CR_ACIDDEMONSTRATION ) {
+		if( SC_ENTRY(sc, SC_NEUTRALBARRIER) && (flag&(BF_MAGIC|BF_LONG)) == BF_LONG && skill_id != CR_ACIDDEMONSTRATION ) {
 			d->dmg_lv = ATK_BLOCK;
 			return 0;
 		}
-		if( sc->data[SC__MAELSTROM] && (flag&BF_MAGIC) && skill_id && (skill->get_inf(skill_id)&INF_GROUND_SKILL) ) {
+		if( SC_ENTRY(sc, SC__MAELSTROM) && (flag&BF_MAGIC) && skill_id && (skill->get_inf(skill_id)&INF_GROUND_SKILL) ) {
 			// {(Maelstrom Skill LevelxAbsorbed Skill Level)+(Caster's Job/5)}/2
-			int sp = (sc->data[SC__MAELSTROM]->val1 * skill_lv + (t_sd ? t_sd->status.job_level / 5 : 0)) / 2;
+			int sp = (SC_ENTRY(sc, SC__MAELSTROM)->val1 * skill_lv + (t_sd ? t_sd->status.job_level / 5 : 0)) / 2;
 			status->heal(bl, 0, sp, STATUS_HEAL_FORCED | STATUS_HEAL_SHOWEFFECT);
 			d->dmg_lv = ATK_BLOCK;
 			return 0;
 		}
-		if( sc->data[SC_WEAPONBLOCKING] && flag&(BF_SHORT|BF_WEAPON) && rnd()%100 < sc->data[SC_WEAPONBLOCKING]->val2 )
+		if( SC_ENTRY(sc, SC_WEAPONBLOCKING) && flag&(BF_SHORT|BF_WEAPON) && rnd()%100 < SC_ENTRY(sc, SC_WEAPONBLOCKING)->val2 )
 		{
 			clif->skill_nodamage(bl,src,GC_WEAPONBLOCKING,1,1);
 			d->dmg_lv = ATK_BLOCK;
 			sc_start2(src, bl, SC_COMBOATTACK, 100, GC_WEAPONBLOCKING, src->id, 2000, GC_WEAPONBLOCKING);
 			return 0;
 		}
-		if ((sce=sc->data[SC_AUTOGUARD]) && flag&BF_WEAPON && !(skill->get_nk(skill_id)&NK_NO_CARDFIX_ATK) && rnd()%100 < sce->val2) {
+		if ((sce=SC_ENTRY(sc, SC_AUTOGUARD)) && flag&BF_WEAPON && !(skill->get_nk(skill_id)&NK_NO_CARDFIX_ATK) && rnd()%100 < sce->val2) {
 			int delay;
-			struct status_change_entry *sce_d = sc->data[SC_DEVOTION];
+			struct status_change_entry *sce_d = SC_ENTRY(sc, SC_DEVOTION);
 
 			// different delay depending on skill level [celest]
 			if (sce->val1 <= 5)
@@ -3305,7 +3378,7 @@ static int64 battle_calc_damage(struct block_list *src, struct block_list *bl, s
 				clif->skill_nodamage(bl, bl, CR_AUTOGUARD, sce->val1, 1);
 				unit->set_walkdelay(bl, timer->gettick(), delay, 1);
 
-				if(sc->data[SC_CR_SHRINK] && rnd()%100<5*sce->val1)
+				if(SC_ENTRY(sc, SC_CR_SHRINK) && rnd()%100<5*sce->val1)
 					skill->blown(bl,src,skill->get_blewcount(CR_SHRINK,1),-1,0);
 
 				d->dmg_lv = ATK_MISS;
@@ -3313,7 +3386,7 @@ static int64 battle_calc_damage(struct block_list *src, struct block_list *bl, s
 			}
 		}
 
-		if( (sce = sc->data[SC_MILLENNIUMSHIELD]) && sce->val2 > 0 && damage > 0 ) {
+		if( (sce = SC_ENTRY(sc, SC_MILLENNIUMSHIELD)) && sce->val2 > 0 && damage > 0 ) {
 			clif->skill_nodamage(bl, bl, RK_MILLENNIUMSHIELD, 1, 1);
 			sce->val3 -= (int)cap_value(damage,INT_MIN,INT_MAX); // absorb damage
 			d->dmg_lv = ATK_BLOCK;
@@ -3329,29 +3402,29 @@ static int64 battle_calc_damage(struct block_list *src, struct block_list *bl, s
 			return 0;
 		}
 
-		if( (sce=sc->data[SC_PARRYING]) && flag&BF_WEAPON && skill_id != WS_CARTTERMINATION && rnd()%100 < sce->val2 )
+		if( (sce=SC_ENTRY(sc, SC_PARRYING)) && flag&BF_WEAPON && skill_id != WS_CARTTERMINATION && rnd()%100 < sce->val2 )
 		{ // attack blocked by Parrying
 			clif->skill_nodamage(bl, bl, LK_PARRYING, sce->val1,1);
 			return 0;
 		}
 
-		if(sc->data[SC_DODGE_READY] && ( !sc->opt1 || sc->opt1 == OPT1_BURNING ) &&
-			(flag&BF_LONG || sc->data[SC_STRUP])
+		if(SC_ENTRY(sc, SC_DODGE_READY) && ( !sc->opt1 || sc->opt1 == OPT1_BURNING ) &&
+			(flag&BF_LONG || SC_ENTRY(sc, SC_STRUP))
 			&& rnd()%100 < 20) {
 			if (t_sd && pc_issit(t_sd)) pc->setstand(t_sd); //Stand it to dodge.
 			clif->skill_nodamage(bl,bl,TK_DODGE,1,1);
-			if (!sc->data[SC_COMBOATTACK])
+			if (!SC_ENTRY(sc, SC_COMBOATTACK))
 				sc_start4(src, bl, SC_COMBOATTACK, 100, TK_JUMPKICK, src->id, 1, 0, 2000, TK_JUMPKICK);
 			return 0;
 		}
 
-		if((sc->data[SC_HERMODE]) && flag&BF_MAGIC)
+		if((SC_ENTRY(sc, SC_HERMODE)) && flag&BF_MAGIC)
 			return 0;
 
-		if(sc->data[SC_NJ_TATAMIGAESHI] && (flag&(BF_MAGIC|BF_LONG)) == BF_LONG)
+		if(SC_ENTRY(sc, SC_NJ_TATAMIGAESHI) && (flag&(BF_MAGIC|BF_LONG)) == BF_LONG)
 			return 0;
 
-		if ((sce=sc->data[SC_KAUPE]) && rnd()%100 < sce->val2) {
+		if ((sce=SC_ENTRY(sc, SC_KAUPE)) && rnd()%100 < sce->val2) {
 			//Kaupe blocks damage (skill or otherwise) from players, mobs, homuns, mercenaries.
 			clif->specialeffect(bl, 462, AREA);
 			//Shouldn't end until Breaker's non-weapon part connects.
@@ -3361,12 +3434,12 @@ static int64 battle_calc_damage(struct block_list *src, struct block_list *bl, s
 			return 0;
 		}
 
-		if (flag&BF_MAGIC && (sce=sc->data[SC_PRESTIGE]) != NULL && rnd()%100 < sce->val2) {
+		if (flag&BF_MAGIC && (sce=SC_ENTRY(sc, SC_PRESTIGE)) != NULL && rnd()%100 < sce->val2) {
 			clif->specialeffect(bl, 462, AREA); // Still need confirm it.
 			return 0;
 		}
 
-		if (((sce=sc->data[SC_NJ_UTSUSEMI]) || sc->data[SC_NJ_BUNSINJYUTSU])
+		if (((sce=SC_ENTRY(sc, SC_NJ_UTSUSEMI)) || SC_ENTRY(sc, SC_NJ_BUNSINJYUTSU))
 		&& flag&BF_WEAPON && !(skill->get_nk(skill_id)&NK_NO_CARDFIX_ATK)) {
 
 			skill->additional_effect (src, bl, skill_id, skill_lv, flag, ATK_BLOCK, timer->gettick() );
@@ -3379,7 +3452,7 @@ static int64 battle_calc_damage(struct block_list *src, struct block_list *bl, s
 			//Both need to be consumed if they are active.
 			if (sce && --(sce->val2) <= 0)
 				status_change_end(bl, SC_NJ_UTSUSEMI, INVALID_TIMER);
-			if ((sce=sc->data[SC_NJ_BUNSINJYUTSU]) && --(sce->val2) <= 0)
+			if ((sce=SC_ENTRY(sc, SC_NJ_BUNSINJYUTSU)) && --(sce->val2) <= 0)
 				status_change_end(bl, SC_NJ_BUNSINJYUTSU, INVALID_TIMER);
 
 			return 0;
@@ -3388,11 +3461,11 @@ static int64 battle_calc_damage(struct block_list *src, struct block_list *bl, s
 		//Now damage increasing effects
 #ifdef RENEWAL
 		// Increase melee damage taken by 400%[KeiKun]
-		if (sc->data[SC_KAITE] != NULL && (flag & (BF_SHORT | BF_MAGIC)) == BF_SHORT)
+		if (SC_ENTRY(sc, SC_KAITE) != NULL && (flag & (BF_SHORT | BF_MAGIC)) == BF_SHORT)
 			damage <<= 2;
 #endif
 
-		if( sc->data[SC_LEXAETERNA] && skill_id != PF_SOULBURN
+		if( SC_ENTRY(sc, SC_LEXAETERNA) && skill_id != PF_SOULBURN
 #ifdef RENEWAL
 		&& skill_id != CR_ACIDDEMONSTRATION
 #endif
@@ -3406,16 +3479,16 @@ static int64 battle_calc_damage(struct block_list *src, struct block_list *bl, s
 		}
 
 #ifdef RENEWAL
-		if (sc->data[SC_RAID] != NULL)
-			damage += damage * sc->data[SC_RAID]->val2 / 100;
+		if (SC_ENTRY(sc, SC_RAID) != NULL)
+			damage += damage * SC_ENTRY(sc, SC_RAID)->val2 / 100;
 #endif
 
 		if( damage ) {
-			if( sc->data[SC_DEEP_SLEEP] ) {
+			if( SC_ENTRY(sc, SC_DEEP_SLEEP) ) {
 				damage += damage / 2; // 1.5 times more damage while in Deep Sleep.
 				status_change_end(bl,SC_DEEP_SLEEP,INVALID_TIMER);
 			}
-			if( s_sd && t_sd && sc->data[SC_COLD] && flag&BF_WEAPON ){
+			if( s_sd && t_sd && SC_ENTRY(sc, SC_COLD) && flag&BF_WEAPON ){
 				switch (s_sd->weapontype) {
 					case W_MACE:
 					case W_2HMACE:
@@ -3441,14 +3514,14 @@ static int64 battle_calc_damage(struct block_list *src, struct block_list *bl, s
 						break;
 				}
 			}
-			if( sc->data[SC_SIREN] )
+			if( SC_ENTRY(sc, SC_SIREN) )
 				status_change_end(bl,SC_SIREN,INVALID_TIMER);
 		}
 
 		//Finally damage reductions....
 		// Assumptio doubles the def & mdef on RE mode, otherwise gives a reduction on the final damage. [Igniz]
 #ifndef RENEWAL
-		if( sc->data[SC_ASSUMPTIO] ) {
+		if( SC_ENTRY(sc, SC_ASSUMPTIO) ) {
 			if( map_flag_vs(bl->m) )
 				damage = damage*2/3; //Receive 66% damage
 			else
@@ -3456,20 +3529,20 @@ static int64 battle_calc_damage(struct block_list *src, struct block_list *bl, s
 		}
 #endif
 
-		if(sc->data[SC_DEFENDER] &&
+		if(SC_ENTRY(sc, SC_DEFENDER) &&
 #ifdef RENEWAL
 			((flag&(BF_LONG|BF_WEAPON)) == (BF_LONG|BF_WEAPON) || skill_id == CR_ACIDDEMONSTRATION))
 #else
 			(flag&(BF_LONG|BF_WEAPON)) == (BF_LONG|BF_WEAPON)) // In pre-re Defender doesn't reduce damage from Acid Demonstration
 #endif
-			damage = damage * ( 100 - sc->data[SC_DEFENDER]->val2 ) / 100;
+			damage = damage * ( 100 - SC_ENTRY(sc, SC_DEFENDER)->val2 ) / 100;
 
 #ifndef RENEWAL
-		if(sc->data[SC_GS_ADJUSTMENT] &&
+		if(SC_ENTRY(sc, SC_GS_ADJUSTMENT) &&
 			(flag&(BF_LONG|BF_WEAPON)) == (BF_LONG|BF_WEAPON))
 			damage -= damage * 20 / 100;
 #endif
-		if(sc->data[SC_FOGWALL]) {
+		if(SC_ENTRY(sc, SC_FOGWALL)) {
 			if(flag&BF_SKILL) { //25% reduction
 				if ( !(skill->get_inf(skill_id)&INF_GROUND_SKILL) && !(skill->get_nk(skill_id)&NK_SPLASH) )
 					damage -= 25*damage/100;
@@ -3478,54 +3551,54 @@ static int64 battle_calc_damage(struct block_list *src, struct block_list *bl, s
 			}
 		}
 
-		if ( sc->data[SC_WATER_BARRIER] )
+		if ( SC_ENTRY(sc, SC_WATER_BARRIER) )
 			damage = damage * ( 100 - 20 ) / 100;
 
-		if( sc->data[SC_FIRE_EXPANSION_SMOKE_POWDER] ) {
+		if( SC_ENTRY(sc, SC_FIRE_EXPANSION_SMOKE_POWDER) ) {
 			if( (flag&(BF_SHORT|BF_WEAPON)) == (BF_SHORT|BF_WEAPON) )
 				damage -= 15 * damage / 100;//15% reduction to physical melee attacks
 			else if( (flag&(BF_LONG|BF_WEAPON)) == (BF_LONG|BF_WEAPON) )
 				damage -= 50 * damage / 100;//50% reduction to physical ranged attacks
 		}
 
-		if (sc->data[SC_SU_STOOP])
+		if (SC_ENTRY(sc, SC_SU_STOOP))
 			damage -= damage * 90 / 100;
 
 		// Compressed code, fixed by map.h [Epoque]
 		if (src->type == BL_MOB) {
 			const struct mob_data *md = BL_UCCAST(BL_MOB, src);
 			int i;
-			if (sc->data[SC_MANU_DEF] != NULL) {
+			if (SC_ENTRY(sc, SC_MANU_DEF) != NULL) {
 				for (i = 0; i < ARRAYLENGTH(mob->manuk); i++) {
 					if (mob->manuk[i] == md->class_) {
-						damage -= damage * sc->data[SC_MANU_DEF]->val1 / 100;
+						damage -= damage * SC_ENTRY(sc, SC_MANU_DEF)->val1 / 100;
 						break;
 					}
 				}
 			}
-			if (sc->data[SC_SPL_DEF] != NULL) {
+			if (SC_ENTRY(sc, SC_SPL_DEF) != NULL) {
 				for (i = 0; i < ARRAYLENGTH(mob->splendide); i++) {
 					if (mob->splendide[i] == md->class_) {
-						damage -= damage * sc->data[SC_SPL_DEF]->val1 / 100;
+						damage -= damage * SC_ENTRY(sc, SC_SPL_DEF)->val1 / 100;
 						break;
 					}
 				}
 			}
-			if (sc->data[SC_MORA_BUFF] != NULL) {
+			if (SC_ENTRY(sc, SC_MORA_BUFF) != NULL) {
 				for (i = 0; i < ARRAYLENGTH(mob->mora); i++) {
 					if (mob->mora[i] == md->class_) {
-						damage -= damage * sc->data[SC_MORA_BUFF]->val1 / 100;
+						damage -= damage * SC_ENTRY(sc, SC_MORA_BUFF)->val1 / 100;
 						break;
 					}
 				}
 			}
 		}
 
-		if((sce=sc->data[SC_ARMOR]) && //NPC_DEFENDER
+		if((sce=SC_ENTRY(sc, SC_ARMOR)) && //NPC_DEFENDER
 			sce->val3&flag && sce->val4&flag)
-			damage -= damage * sc->data[SC_ARMOR]->val2 / 100;
+			damage -= damage * SC_ENTRY(sc, SC_ARMOR)->val2 / 100;
 
-		if( sc->data[SC_ENERGYCOAT] && (skill_id == GN_HELLS_PLANT_ATK ||
+		if( SC_ENTRY(sc, SC_ENERGYCOAT) && (skill_id == GN_HELLS_PLANT_ATK ||
 #ifdef RENEWAL
 			((flag&BF_WEAPON || flag&BF_MAGIC) && skill_id != WS_CARTTERMINATION)
 #else
@@ -3542,20 +3615,20 @@ static int64 battle_calc_damage(struct block_list *src, struct block_list *bl, s
 			//Reduction: 6% + 6% every 20%
 			damage -= damage * (6 * (1+per)) / 100;
 		}
-		if(sc->data[SC_GRANITIC_ARMOR]){
-			damage -= damage * sc->data[SC_GRANITIC_ARMOR]->val2 / 100;
+		if(SC_ENTRY(sc, SC_GRANITIC_ARMOR)){
+			damage -= damage * SC_ENTRY(sc, SC_GRANITIC_ARMOR)->val2 / 100;
 		}
-		if(sc->data[SC_PAIN_KILLER]){
-			damage -= damage * sc->data[SC_PAIN_KILLER]->val3 / 100;
+		if(SC_ENTRY(sc, SC_PAIN_KILLER)){
+			damage -= damage * SC_ENTRY(sc, SC_PAIN_KILLER)->val3 / 100;
 		}
-		if((sce=sc->data[SC_MAGMA_FLOW]) && (rnd()%100 <= sce->val2) ){
+		if((sce=SC_ENTRY(sc, SC_MAGMA_FLOW)) && (rnd()%100 <= sce->val2) ){
 			skill->castend_damage_id(bl,src,MH_MAGMA_FLOW,sce->val1,timer->gettick(),0);
 		}
 
-		if( sc->data[SC_DARKCROW] && (flag&(BF_SHORT|BF_MAGIC)) == BF_SHORT )
-			damage += damage * sc->data[SC_DARKCROW]->val2 / 100;
+		if( SC_ENTRY(sc, SC_DARKCROW) && (flag&(BF_SHORT|BF_MAGIC)) == BF_SHORT )
+			damage += damage * SC_ENTRY(sc, SC_DARKCROW)->val2 / 100;
 
-		if( (sce = sc->data[SC_STONEHARDSKIN]) && flag&(BF_SHORT|BF_WEAPON) && damage > 0 ) {
+		if( (sce = SC_ENTRY(sc, SC_STONEHARDSKIN)) && flag&(BF_SHORT|BF_WEAPON) && damage > 0 ) {
 			sce->val2 -= (int)cap_value(damage,INT_MIN,INT_MAX);
 			if( src->type == BL_PC ) {
 				if (s_sd != NULL && s_sd->weapontype != W_BOW)
@@ -3573,13 +3646,13 @@ static int64 battle_calc_damage(struct block_list *src, struct block_list *bl, s
  * In renewal steel body reduces all incoming damage by 1/10
  **/
 #ifdef RENEWAL
-		if( sc->data[SC_STEELBODY] ) {
+		if( SC_ENTRY(sc, SC_STEELBODY) ) {
 			damage = damage > 10 ? damage / 10 : 1;
 		}
 #endif
 
 		//Finally added to remove the status of immobile when aimedbolt is used. [Jobbie]
-		if( skill_id == RA_AIMEDBOLT && (sc->data[SC_WUGBITE] || sc->data[SC_ANKLESNARE] || sc->data[SC_ELECTRICSHOCKER]) )
+		if( skill_id == RA_AIMEDBOLT && (SC_ENTRY(sc, SC_WUGBITE) || SC_ENTRY(sc, SC_ANKLESNARE) || SC_ENTRY(sc, SC_ELECTRICSHOCKER)) )
 		{
 			status_change_end(bl, SC_WUGBITE, INVALID_TIMER);
 			status_change_end(bl, SC_ANKLESNARE, INVALID_TIMER);
@@ -3587,7 +3660,7 @@ static int64 battle_calc_damage(struct block_list *src, struct block_list *bl, s
 		}
 
 		//Finally Kyrie because it may, or not, reduce damage to 0.
-		if((sce = sc->data[SC_KYRIE]) && damage > 0){
+		if((sce = SC_ENTRY(sc, SC_KYRIE)) && damage > 0){
 			sce->val2 -= (int)cap_value(damage,INT_MIN,INT_MAX);
 			if(flag&BF_WEAPON || skill_id == TF_THROWSTONE){
 				if(sce->val2>=0)
@@ -3599,7 +3672,7 @@ static int64 battle_calc_damage(struct block_list *src, struct block_list *bl, s
 				status_change_end(bl, SC_KYRIE, INVALID_TIMER);
 		}
 
-		if ((sce = sc->data[SC_PLATINUM_ALTER]) != NULL && damage > 0) {
+		if ((sce = SC_ENTRY(sc, SC_PLATINUM_ALTER)) != NULL && damage > 0) {
 			clif->specialeffect(bl, 336, AREA);
 			sce->val3 -= (int)cap_value(damage, INT_MIN, INT_MAX);
 			if (sce->val3 >= 0)
@@ -3610,7 +3683,7 @@ static int64 battle_calc_damage(struct block_list *src, struct block_list *bl, s
 				status_change_end(bl, SC_PLATINUM_ALTER, INVALID_TIMER);
 		}
 
-		if ((sce = sc->data[SC_TUNAPARTY]) != NULL && damage > 0) {
+		if ((sce = SC_ENTRY(sc, SC_TUNAPARTY)) != NULL && damage > 0) {
 			clif->specialeffect(bl, 336, AREA);
 			sce->val2 -= (int)cap_value(damage, INT_MIN, INT_MAX);
 			if (sce->val2 >= 0) {
@@ -3623,26 +3696,26 @@ static int64 battle_calc_damage(struct block_list *src, struct block_list *bl, s
 			}
 		}
 
-		if ((sce = sc->data[SC_DIMENSION1]) != NULL && damage > 0) {
+		if ((sce = SC_ENTRY(sc, SC_DIMENSION1)) != NULL && damage > 0) {
 			sce->val2 -= (int)cap_value(damage, INT_MIN, INT_MAX);
 			if (sce->val2 <= 0)
 				status_change_end(bl, SC_DIMENSION1, INVALID_TIMER);
 			return 0;
 		}
 
-		if ((sce = sc->data[SC_DIMENSION2]) != NULL && damage > 0) {
+		if ((sce = SC_ENTRY(sc, SC_DIMENSION2)) != NULL && damage > 0) {
 			sce->val2 -= (int)cap_value(damage, INT_MIN, INT_MAX);
 			if (sce->val2 <= 0)
 				status_change_end(bl, SC_DIMENSION2, INVALID_TIMER);
 			return 0;
 		}
 
-		if( sc->data[SC_MEIKYOUSISUI] && rnd()%100 < 40 ) // custom value
+		if( SC_ENTRY(sc, SC_MEIKYOUSISUI) && rnd()%100 < 40 ) // custom value
 			damage = 0;
 
 		if (!damage) return 0;
 
-		if( (sce = sc->data[SC_LIGHTNINGWALK]) && flag&BF_LONG && rnd()%100 < sce->val1 ) {
+		if( (sce = SC_ENTRY(sc, SC_LIGHTNINGWALK)) && flag&BF_LONG && rnd()%100 < sce->val1 ) {
 			enum unit_dir dir = map->calc_dir(bl, src->x, src->y);
 			Assert_ret(dir >= UNIT_DIR_FIRST && dir < UNIT_DIR_MAX);
 			if (unit->move_pos(bl, src->x - dirx[dir], src->y - diry[dir], 1, true) == 0) {
@@ -3656,23 +3729,23 @@ static int64 battle_calc_damage(struct block_list *src, struct block_list *bl, s
 
 		//Probably not the most correct place, but it'll do here
 		//(since battle_drain is strictly for players currently)
-		if ((sce=sc->data[SC_HAMI_BLOODLUST]) && flag&BF_WEAPON && damage > 0 &&
+		if ((sce=SC_ENTRY(sc, SC_HAMI_BLOODLUST)) && flag&BF_WEAPON && damage > 0 &&
 			rnd()%100 < sce->val3)
 			status->heal(src, damage*sce->val4/100, 0, STATUS_HEAL_FORCED | STATUS_HEAL_SHOWEFFECT);
 
-		if( (sce = sc->data[SC_FORCEOFVANGUARD]) && flag&BF_WEAPON
+		if( (sce = SC_ENTRY(sc, SC_FORCEOFVANGUARD)) && flag&BF_WEAPON
 			&& rnd()%100 < sce->val2 && sc->fv_counter <= sce->val3 )
 				clif->millenniumshield(bl, sc->fv_counter++);
 
-		if (sc->data[SC_STYLE_CHANGE] && rnd()%2) {
+		if (SC_ENTRY(sc, SC_STYLE_CHANGE) && rnd()%2) {
 			struct homun_data *hd = BL_CAST(BL_HOM,bl);
 			if (hd) homun->addspiritball(hd, 10); //add a sphere
 		}
 
-		if( sc->data[SC__DEADLYINFECT] && flag&BF_SHORT && damage > 0 && rnd()%100 < 30 + 10 * sc->data[SC__DEADLYINFECT]->val1 && !is_boss(src) )
+		if( SC_ENTRY(sc, SC__DEADLYINFECT) && flag&BF_SHORT && damage > 0 && rnd()%100 < 30 + 10 * SC_ENTRY(sc, SC__DEADLYINFECT)->val1 && !is_boss(src) )
 			status->change_spread(bl, src, skill_id); // Deadly infect attacked side
 
-		if (t_sd && damage > 0 && (sce = sc->data[SC_GENTLETOUCH_ENERGYGAIN]) != NULL) {
+		if (t_sd && damage > 0 && (sce = SC_ENTRY(sc, SC_GENTLETOUCH_ENERGYGAIN)) != NULL) {
 			if ( rnd() % 100 < sce->val2 )
 				pc->addspiritball(t_sd, skill->get_time(MO_CALLSPIRITS, 1), pc->getmaxspiritball(t_sd, 0));
 		}
@@ -3680,23 +3753,23 @@ static int64 battle_calc_damage(struct block_list *src, struct block_list *bl, s
 
 	//SC effects from caster side.
 	if (s_sc && s_sc->count) {
-		if( s_sc->data[SC_INVINCIBLE] && !s_sc->data[SC_INVINCIBLEOFF] )
+		if( SC_ENTRY(s_sc, SC_INVINCIBLE) && !SC_ENTRY(s_sc, SC_INVINCIBLEOFF) )
 			damage += damage * 75 / 100;
 		// [Epoque]
 		if (bl->type == BL_MOB) {
 			const struct mob_data *md = BL_UCCAST(BL_MOB, bl);
 			int i;
 
-			if (((sce=s_sc->data[SC_MANU_ATK]) != NULL && (flag&BF_WEAPON))
-			 || ((sce=s_sc->data[SC_MANU_MATK]) != NULL && (flag&BF_MAGIC))) {
+			if (((sce=SC_ENTRY(s_sc, SC_MANU_ATK)) != NULL && (flag&BF_WEAPON))
+			 || ((sce=SC_ENTRY(s_sc, SC_MANU_MATK)) != NULL && (flag&BF_MAGIC))) {
 				for (i = 0; i < ARRAYLENGTH(mob->manuk); i++)
 					if (md->class_ == mob->manuk[i]) {
 						damage += damage * sce->val1 / 100;
 						break;
 					}
 			}
-			if (((sce=s_sc->data[SC_SPL_ATK]) != NULL && (flag&BF_WEAPON))
-			 || ((sce=s_sc->data[SC_SPL_MATK]) != NULL && (flag&BF_MAGIC))) {
+			if (((sce=SC_ENTRY(s_sc, SC_SPL_ATK)) != NULL && (flag&BF_WEAPON))
+			 || ((sce=SC_ENTRY(s_sc, SC_SPL_MATK)) != NULL && (flag&BF_MAGIC))) {
 				for (i = 0; i < ARRAYLENGTH(mob->splendide); i++)
 					if (md->class_ == mob->splendide[i]) {
 						damage += damage * sce->val1 / 100;
@@ -3704,26 +3777,26 @@ static int64 battle_calc_damage(struct block_list *src, struct block_list *bl, s
 					}
 			}
 		}
-		if (s_sc->data[SC_POISONINGWEAPON] != NULL) {
-			if (!(flag & BF_SKILL) && (flag & BF_WEAPON) && damage > 0 && rnd() % 100 < s_sc->data[SC_POISONINGWEAPON]->val3) {
-				sc_type poison_sc = s_sc->data[SC_POISONINGWEAPON]->val2;
+		if (SC_ENTRY(s_sc, SC_POISONINGWEAPON) != NULL) {
+			if (!(flag & BF_SKILL) && (flag & BF_WEAPON) && damage > 0 && rnd() % 100 < SC_ENTRY(s_sc, SC_POISONINGWEAPON)->val3) {
+				sc_type poison_sc = SC_ENTRY(s_sc, SC_POISONINGWEAPON)->val2;
 				int duration = skill->get_time2(GC_POISONINGWEAPON, (poison_sc == SC_VENOMBLEED ? 1 : 2));
-				sc_start(src, bl, poison_sc, 100, s_sc->data[SC_POISONINGWEAPON]->val1, duration, GC_POISONINGWEAPON);
+				sc_start(src, bl, poison_sc, 100, SC_ENTRY(s_sc, SC_POISONINGWEAPON)->val1, duration, GC_POISONINGWEAPON);
 			}
 		}
-		if( s_sc->data[SC__DEADLYINFECT] && flag&BF_SHORT && damage > 0 && rnd()%100 < 30 + 10 * s_sc->data[SC__DEADLYINFECT]->val1 && !is_boss(src) )
+		if( SC_ENTRY(s_sc, SC__DEADLYINFECT) && flag&BF_SHORT && damage > 0 && rnd()%100 < 30 + 10 * SC_ENTRY(s_sc, SC__DEADLYINFECT)->val1 && !is_boss(src) )
 			status->change_spread(src, bl, skill_id);
-		if (s_sc->data[SC_SHIELDSPELL_REF] && s_sc->data[SC_SHIELDSPELL_REF]->val1 == 1 && damage > 0)
+		if (SC_ENTRY(s_sc, SC_SHIELDSPELL_REF) && SC_ENTRY(s_sc, SC_SHIELDSPELL_REF)->val1 == 1 && damage > 0)
 			skill->break_equip(bl,EQP_ARMOR,10000,BCT_ENEMY );
-		if (s_sc->data[SC_STYLE_CHANGE] && rnd()%2) {
+		if (SC_ENTRY(s_sc, SC_STYLE_CHANGE) && rnd()%2) {
 			struct homun_data *hd = BL_CAST(BL_HOM,bl);
 			if (hd) homun->addspiritball(hd, 10);
 		}
-		if (src->type == BL_PC && damage > 0 && (sce = s_sc->data[SC_GENTLETOUCH_ENERGYGAIN]) != NULL) {
+		if (src->type == BL_PC && damage > 0 && (sce = SC_ENTRY(s_sc, SC_GENTLETOUCH_ENERGYGAIN)) != NULL) {
 			if (s_sd != NULL && rnd() % 100 < sce->val2)
 				pc->addspiritball(s_sd, skill->get_time(MO_CALLSPIRITS, 1), pc->getmaxspiritball(s_sd, 0));
 		}
-		if (s_sd != NULL && (sce = s_sc->data[SC_SOULREAPER]) != NULL) {
+		if (s_sd != NULL && (sce = SC_ENTRY(s_sc, SC_SOULREAPER)) != NULL) {
 			if (rnd() % 100 < sce->val2 && s_sd->soulball < MAX_SOUL_BALL) {
 				clif->specialeffect(src, 1208, AREA);
 				pc->addsoulball(s_sd, 5 + 3 * pc->checkskill(s_sd, SP_SOULENERGY));
@@ -4048,10 +4121,10 @@ static struct Damage battle_calc_magic_attack(struct block_list *src, struct blo
 
 	if( skill_id == SO_PSYCHIC_WAVE ) {
 		if( sc && sc->count ) {
-			if( sc->data[SC_HEATER_OPTION] ) s_ele = sc->data[SC_HEATER_OPTION]->val4;
-			else if( sc->data[SC_COOLER_OPTION] ) s_ele = sc->data[SC_COOLER_OPTION]->val4;
-			else if( sc->data[SC_BLAST_OPTION] ) s_ele = sc->data[SC_BLAST_OPTION]->val3;
-			else if( sc->data[SC_CURSED_SOIL_OPTION] ) s_ele = sc->data[SC_CURSED_SOIL_OPTION]->val4;
+			if( SC_ENTRY(sc, SC_HEATER_OPTION) ) s_ele = SC_ENTRY(sc, SC_HEATER_OPTION)->val4;
+			else if( SC_ENTRY(sc, SC_COOLER_OPTION) ) s_ele = SC_ENTRY(sc, SC_COOLER_OPTION)->val4;
+			else if( SC_ENTRY(sc, SC_BLAST_OPTION) ) s_ele = SC_ENTRY(sc, SC_BLAST_OPTION)->val3;
+			else if( SC_ENTRY(sc, SC_CURSED_SOIL_OPTION) ) s_ele = SC_ENTRY(sc, SC_CURSED_SOIL_OPTION)->val4;
 		}
 	}
 
@@ -4176,8 +4249,8 @@ static struct Damage battle_calc_magic_attack(struct block_list *src, struct blo
 					case MG_FIREBOLT:
 					case MG_COLDBOLT:
 					case MG_LIGHTNINGBOLT:
-						if ( sc && sc->data[SC_SPELLFIST] && mflag&BF_SHORT )  {
-							skillratio = sc->data[SC_SPELLFIST]->val2 * 50 + sc->data[SC_SPELLFIST]->val4 * 100;// val4 = used bolt level, val2 = used spellfist level. [Rytech]
+						if ( sc && SC_ENTRY(sc, SC_SPELLFIST) && mflag&BF_SHORT )  {
+							skillratio = SC_ENTRY(sc, SC_SPELLFIST)->val2 * 50 + SC_ENTRY(sc, SC_SPELLFIST)->val4 * 100;// val4 = used bolt level, val2 = used spellfist level. [Rytech]
 							ad.div_ = 1;// ad mods, to make it work similar to regular hits [Xazax]
 							ad.flag = BF_WEAPON|BF_SHORT;
 							ad.type = BDT_NORMAL;
@@ -4280,8 +4353,8 @@ static struct Damage battle_calc_magic_attack(struct block_list *src, struct blo
 				case MG_FROSTDIVER:
 				case WZ_EARTHSPIKE:
 				case WZ_HEAVENDRIVE:
-					if(sc->data[SC_GUST_OPTION] || sc->data[SC_PETROLOGY_OPTION]
-						|| sc->data[SC_PYROTECHNIC_OPTION] || sc->data[SC_AQUAPLAY_OPTION])
+					if(SC_ENTRY(sc, SC_GUST_OPTION) || SC_ENTRY(sc, SC_PETROLOGY_OPTION)
+						|| SC_ENTRY(sc, SC_PYROTECHNIC_OPTION) || SC_ENTRY(sc, SC_AQUAPLAY_OPTION))
 						ad.damage += (6 + sstatus->int_/4) + max(sstatus->dex-10,0)/30;
 					break;
 			}
@@ -4487,7 +4560,7 @@ static struct Damage battle_calc_misc_attack(struct block_list *src, struct bloc
 			short totaldef = (tmdef + tdef - ((uint64)(tmdef + tdef) >> 32)) >> 1; // FIXME: What's the >> 32 supposed to do here? tmdef and tdef are both 16-bit...
 
 			matk = battle->calc_magic_attack(src, target, skill_id, skill_lv, mflag).damage;
-			atk = battle->calc_base_damage(src, target, skill_id, skill_lv, nk, false, s_ele, ELE_NEUTRAL, EQI_HAND_R, (sc && sc->data[SC_MAXIMIZEPOWER]?1:0)|(sc && sc->data[SC_WEAPONPERFECT]?8:0), md.flag);
+			atk = battle->calc_base_damage(src, target, skill_id, skill_lv, nk, false, s_ele, ELE_NEUTRAL, EQI_HAND_R, (sc && SC_ENTRY(sc, SC_MAXIMIZEPOWER)?1:0)|(sc && SC_ENTRY(sc, SC_WEAPONPERFECT)?8:0), md.flag);
 			md.damage = matk + atk;
 			if( src->type == BL_MOB ){
 				totaldef = (tdef + tmdef) >> 1;
@@ -4509,7 +4582,7 @@ static struct Damage battle_calc_misc_attack(struct block_list *src, struct bloc
 					md.damage >>= 1;
 			}
 			md.damage -= totaldef;
-			if( tsc && tsc->data[SC_LEXAETERNA] ) {
+			if( tsc && SC_ENTRY(tsc, SC_LEXAETERNA) ) {
 				md.damage <<= 1;
 				status_change_end(target, SC_LEXAETERNA, INVALID_TIMER);
 			}
@@ -4561,7 +4634,7 @@ static struct Damage battle_calc_misc_attack(struct block_list *src, struct bloc
 		int ratio = 300 + 50 * skill_lv;
 		int64 matk = battle->calc_magic_attack(src, target, skill_id, skill_lv, mflag).damage;
 		short totaldef = status->get_total_def(target) + status->get_total_mdef(target);
-		int64 atk = battle->calc_base_damage(src, target, skill_id, skill_lv, nk, false, s_ele, ELE_NEUTRAL, EQI_HAND_R, (sc && sc->data[SC_MAXIMIZEPOWER] ? 1 : 0) | (sc && sc->data[SC_WEAPONPERFECT] ? 8 : 0), md.flag);
+		int64 atk = battle->calc_base_damage(src, target, skill_id, skill_lv, nk, false, s_ele, ELE_NEUTRAL, EQI_HAND_R, (sc && SC_ENTRY(sc, SC_MAXIMIZEPOWER) ? 1 : 0) | (sc && SC_ENTRY(sc, SC_WEAPONPERFECT) ? 8 : 0), md.flag);
 
 		md.damage = (matk + atk) * ratio / 100;
 		md.damage -= totaldef;
@@ -4978,8 +5051,8 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src, struct bl
 
 			//When in banding, the number of hits is equal to the number of Royal Guards in banding.
 			case LG_HESPERUSLIT:
-				if( sc && sc->data[SC_BANDING] && sc->data[SC_BANDING]->val2 > 3 )
-					wd.div_ = sc->data[SC_BANDING]->val2;
+				if( sc && SC_ENTRY(sc, SC_BANDING) && SC_ENTRY(sc, SC_BANDING)->val2 > 3 )
+					wd.div_ = SC_ENTRY(sc, SC_BANDING)->val2;
 				break;
 
 			case MO_INVESTIGATE:
@@ -4988,12 +5061,12 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src, struct bl
 				break;
 
 			case RA_AIMEDBOLT:
-				if( tsc && (tsc->data[SC_WUGBITE] || tsc->data[SC_ANKLESNARE] || tsc->data[SC_ELECTRICSHOCKER]) )
+				if( tsc && (SC_ENTRY(tsc, SC_WUGBITE) || SC_ENTRY(tsc, SC_ANKLESNARE) || SC_ENTRY(tsc, SC_ELECTRICSHOCKER)) )
 					wd.div_ = tstatus->size + 2 + ( (rnd()%100 < 50-tstatus->size*10) ? 1 : 0 );
 				break;
 
 			case RL_QD_SHOT:
-				wd.div_ = 1 + (sd != NULL ? sd->status.job_level : 1) / 20 + (tsc != NULL&& tsc->data[SC_CRIMSON_MARKER] ? 2 : 0);
+				wd.div_ = 1 + (sd != NULL ? sd->status.job_level : 1) / 20 + (tsc != NULL&& SC_ENTRY(tsc, SC_CRIMSON_MARKER) ? 2 : 0);
 				break;
 
 			case NPC_EARTHQUAKE:
@@ -5058,7 +5131,7 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src, struct bl
 			if (!sd) n_ele = false; //forced neutral for monsters
 			break;
 		case LG_HESPERUSLIT:
-			if ( sc && sc->data[SC_BANDING] && sc->data[SC_BANDING]->val2 == 5 )
+			if ( sc && SC_ENTRY(sc, SC_BANDING) && SC_ENTRY(sc, SC_BANDING)->val2 == 5 )
 				s_ele = ELE_HOLY; // Banding with 5 RGs: change atk element to Holy.
 			break;
 		case RL_H_MINE:
@@ -5073,7 +5146,7 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src, struct bl
 	if (!(nk & NK_NO_ELEFIX) && !n_ele)
 	    if (src->type == BL_HOM)
 		n_ele = true; //skill is "not elemental"
-	if (sc && sc->data[SC_GOLDENE_FERSE] && ((!skill_id && (rnd() % 100 < sc->data[SC_GOLDENE_FERSE]->val4)) || skill_id == MH_STAHL_HORN)) {
+	if (sc && SC_ENTRY(sc, SC_GOLDENE_FERSE) && ((!skill_id && (rnd() % 100 < SC_ENTRY(sc, SC_GOLDENE_FERSE)->val4)) || skill_id == MH_STAHL_HORN)) {
 	    s_ele = s_ele_ = ELE_HOLY;
 	    n_ele = false;
 	}
@@ -5092,10 +5165,10 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src, struct bl
 		//Check for double attack.
 		if (((skill_lv = pc->checkskill(sd, TF_DOUBLE)) > 0 && sd->weapontype1 == W_DAGGER)
 		 || (sd->bonus.double_rate > 0 && sd->weapontype1 != W_FIST) //Will fail bare-handed
-		 || (sc != NULL && sc->data[SC_KAGEMUSYA] != NULL && sd->weapontype1 != W_FIST) // Need confirmation
+		 || (sc != NULL && SC_ENTRY(sc, SC_KAGEMUSYA) != NULL && sd->weapontype1 != W_FIST) // Need confirmation
 		) {
 			// Success chance is not added, the higher one is used [Skotlex]
-			if (rnd() % 100 < (5 * skill_lv > sd->bonus.double_rate ? 5 * skill_lv : sc != NULL && sc->data[SC_KAGEMUSYA] != NULL ? sc->data[SC_KAGEMUSYA]->val1 * 3 : sd->bonus.double_rate))
+			if (rnd() % 100 < (5 * skill_lv > sd->bonus.double_rate ? 5 * skill_lv : sc != NULL && SC_ENTRY(sc, SC_KAGEMUSYA) != NULL ? SC_ENTRY(sc, SC_KAGEMUSYA)->val1 * 3 : sd->bonus.double_rate))
 			{
 				wd.div_ = skill->get_num(TF_DOUBLE, skill_lv != 0 ? skill_lv : 1);
 				wd.type = BDT_MULTIHIT;
@@ -5103,7 +5176,7 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src, struct bl
 			}
 		}
 		else if (((sd->weapontype1 == W_REVOLVER && (skill_lv = pc->checkskill(sd, GS_CHAINACTION)) > 0)
-			|| (sc && sc->count && sc->data[SC_ETERNAL_CHAIN] && (skill_lv = sc->data[SC_ETERNAL_CHAIN]->val1) > 0))
+			|| (sc && sc->count && SC_ENTRY(sc, SC_ETERNAL_CHAIN) && (skill_lv = SC_ENTRY(sc, SC_ETERNAL_CHAIN)->val1) > 0))
 			&& rnd() % 100 < 5 * skill_lv)
 		{
 			wd.div_ = skill->get_num(GS_CHAINACTION, skill_lv);
@@ -5111,10 +5184,10 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src, struct bl
 
 			sc_start(src, src, SC_QD_SHOT_READY, 100, target->id, skill->get_time(RL_QD_SHOT, 1), RL_QD_SHOT);
 		}
-		else if(sc && sc->data[SC_FEARBREEZE] && sd->weapontype1==W_BOW
+		else if(sc && SC_ENTRY(sc, SC_FEARBREEZE) && sd->weapontype1==W_BOW
 			&& (i = sd->equip_index[EQI_AMMO]) >= 0 && sd->inventory_data[i] && sd->status.inventory[i].amount > 1){
 				int chance = rnd()%100;
-				switch(sc->data[SC_FEARBREEZE]->val1){
+				switch(SC_ENTRY(sc, SC_FEARBREEZE)->val1){
 					case 5:
 						if( chance < 3){// 3 % chance to attack 5 times.
 							wd.div_ = 5;
@@ -5142,7 +5215,7 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src, struct bl
 				}
 				if ( wd.div_ > 1 ) {
 					wd.div_ = min(wd.div_, sd->status.inventory[i].amount);
-					sc->data[SC_FEARBREEZE]->val4 = wd.div_ - 1;
+					SC_ENTRY(sc, SC_FEARBREEZE)->val4 = wd.div_ - 1;
 					wd.type = BDT_MULTIHIT;
 				}
 		}
@@ -5172,8 +5245,8 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src, struct bl
 				cri += sd->bonus.arrow_cri;
 			}
 		}
-		if (sc && sc->data[SC_CAMOUFLAGE])
-			cri += 10 * (10-sc->data[SC_CAMOUFLAGE]->val4);
+		if (sc && SC_ENTRY(sc, SC_CAMOUFLAGE))
+			cri += 10 * (10-SC_ENTRY(sc, SC_CAMOUFLAGE)->val4);
 #ifndef RENEWAL
 		//The official equation is *2, but that only applies when sd's do critical.
 		//Therefore, we use the old value 3 on cases when an sd gets attacked by a mob
@@ -5182,12 +5255,12 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src, struct bl
 		cri -= status->get_lv(target) / 15 + 2 * status_get_luk(target);
 #endif
 
-		if( tsc && tsc->data[SC_SLEEP] ) {
+		if( tsc && SC_ENTRY(tsc, SC_SLEEP) ) {
 			cri <<= 1;
 		}
 		switch (skill_id) {
 			case 0:
-				if(!(sc && sc->data[SC_AUTOCOUNTER]))
+				if(!(sc && SC_ENTRY(sc, SC_AUTOCOUNTER)))
 					break;
 				status_change_end(src, SC_AUTOCOUNTER, INVALID_TIMER);
 				FALLTHROUGH
@@ -5225,7 +5298,7 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src, struct bl
 		//Check for Perfect Hit
 		if(sd && sd->bonus.perfect_hit > 0 && rnd()%100 < sd->bonus.perfect_hit)
 			flag.hit = 1;
-		if (sc && sc->data[SC_FUSION]) {
+		if (sc && SC_ENTRY(sc, SC_FUSION)) {
 			flag.hit = 1; //SG_FUSION always hit [Komurka]
 			flag.idef = flag.idef2 = 1; //def ignore [Komurka]
 		}
@@ -5237,7 +5310,7 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src, struct bl
 						flag.hit = 1;
 					break;
 				case CR_SHIELDBOOMERANG:
-					if( sc && sc->data[SC_SOULLINK] && sc->data[SC_SOULLINK]->val2 == SL_CRUSADER )
+					if( sc && SC_ENTRY(sc, SC_SOULLINK) && SC_ENTRY(sc, SC_SOULLINK)->val2 == SL_CRUSADER )
 						flag.hit = 1;
 					break;
 			}
@@ -5270,7 +5343,7 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src, struct bl
 		hitrate+= sstatus->hit - flee;
 
 		if(wd.flag&BF_LONG && !skill_id && //Fogwall's hit penalty is only for normal ranged attacks.
-			tsc && tsc->data[SC_FOGWALL])
+			tsc && SC_ENTRY(tsc, SC_FOGWALL))
 			hitrate -= 50;
 
 		if(sd && flag.arrow)
@@ -5412,8 +5485,8 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src, struct bl
 				{
 					short totaldef = status->get_total_def(target);
 					i = 0;
-					GET_NORMAL_ATTACK( (sc && sc->data[SC_MAXIMIZEPOWER]?1:0)|(sc && sc->data[SC_WEAPONPERFECT]?8:0), 0 );
-					if( sc && sc->data[SC_NJ_BUNSINJYUTSU] && (i=sc->data[SC_NJ_BUNSINJYUTSU]->val2) > 0 )
+					GET_NORMAL_ATTACK( (sc && SC_ENTRY(sc, SC_MAXIMIZEPOWER)?1:0)|(sc && SC_ENTRY(sc, SC_WEAPONPERFECT)?8:0), 0 );
+					if( sc && SC_ENTRY(sc, SC_NJ_BUNSINJYUTSU) && (i=SC_ENTRY(sc, SC_NJ_BUNSINJYUTSU)->val2) > 0 )
 						wd.div_ = ~( i++ + 2 ) + 1;
 					if( wd.damage ){
 						wd.damage = wd.damage * sstatus->hp * skill_lv;
@@ -5425,7 +5498,7 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src, struct bl
 				}
 				break;
 			case NJ_SYURIKEN: // [malufett]
-				GET_NORMAL_ATTACK( (sc && sc->data[SC_MAXIMIZEPOWER]?1:0)|(sc && sc->data[SC_WEAPONPERFECT]?8:0), 0);
+				GET_NORMAL_ATTACK( (sc && SC_ENTRY(sc, SC_MAXIMIZEPOWER)?1:0)|(sc && SC_ENTRY(sc, SC_WEAPONPERFECT)?8:0), 0);
 				ATK_ADD(battle->calc_masteryfix(src, target, skill_id, skill_lv, 4 * skill_lv + (sd ? sd->bonus.arrow_atk : 0), wd.div_, 0, flag.weapon));
 #endif
 				break;
@@ -5514,7 +5587,7 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src, struct bl
 			{
 				i = (flag.cri
 #ifdef RENEWAL
-					|| (sc && sc->data[SC_MAXIMIZEPOWER])
+					|| (sc && SC_ENTRY(sc, SC_MAXIMIZEPOWER))
 #endif
 					?1:0)|
 					(flag.arrow?2:0)|
@@ -5522,8 +5595,8 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src, struct bl
 					(skill_id == HW_MAGICCRASHER?4:0)|
 					(skill_id == MO_EXTREMITYFIST?8:0)|
 #endif
-					(!skill_id && sc && sc->data[SC_HLIF_CHANGE]?4:0)|
-					(sc && sc->data[SC_WEAPONPERFECT]?8:0);
+					(!skill_id && sc && SC_ENTRY(sc, SC_HLIF_CHANGE)?4:0)|
+					(sc && SC_ENTRY(sc, SC_WEAPONPERFECT)?8:0);
 				if (flag.arrow && sd)
 				switch (sd->weapontype) {
 					case W_BOW:
@@ -5579,11 +5652,11 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src, struct bl
 #endif
 					if(flag.cri && sd->bonus.crit_atk_rate)
 						ATK_ADDRATE(sd->bonus.crit_atk_rate);
-					if(flag.cri && sc && sc->data[SC_MTF_CRIDAMAGE])
-						ATK_ADDRATE(sc->data[SC_MTF_CRIDAMAGE]->val1);// temporary it should be 'bonus.crit_atk_rate'
+					if(flag.cri && sc && SC_ENTRY(sc, SC_MTF_CRIDAMAGE))
+						ATK_ADDRATE(SC_ENTRY(sc, SC_MTF_CRIDAMAGE)->val1);// temporary it should be 'bonus.crit_atk_rate'
 #ifdef RENEWAL
-					if (flag.cri && sc != NULL && sc->data[SC_FORTUNE] != NULL)
-						ATK_ADDRATE(sc->data[SC_FORTUNE]->val3);
+					if (flag.cri && sc != NULL && SC_ENTRY(sc, SC_FORTUNE) != NULL)
+						ATK_ADDRATE(SC_ENTRY(sc, SC_FORTUNE)->val3);
 #endif
 #ifndef RENEWAL
 					if(sd->status.party_id && (temp=pc->checkskill(sd,TK_POWER)) > 0){
@@ -5597,22 +5670,22 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src, struct bl
 			} //End default case
 		} //End switch(skill_id)
 
-		if( sc && skill_id != PA_SACRIFICE && sc->data[SC_UNLIMIT] && (wd.flag&(BF_LONG|BF_MAGIC)) == BF_LONG) {
+		if( sc && skill_id != PA_SACRIFICE && SC_ENTRY(sc, SC_UNLIMIT) && (wd.flag&(BF_LONG|BF_MAGIC)) == BF_LONG) {
 			switch(skill_id) {
 				case RA_WUGDASH:
 				case RA_WUGSTRIKE:
 				case RA_WUGBITE:
 					break;
 				default:
-					ATK_ADDRATE( 50 * sc->data[SC_UNLIMIT]->val1 );
+					ATK_ADDRATE( 50 * SC_ENTRY(sc, SC_UNLIMIT)->val1 );
 			}
 		}
 
-		if (sc != NULL && sc->data[SC_HEAT_BARREL])
-			ATK_ADDRATE(sc->data[SC_HEAT_BARREL]->val3);
+		if (sc != NULL && SC_ENTRY(sc, SC_HEAT_BARREL))
+			ATK_ADDRATE(SC_ENTRY(sc, SC_HEAT_BARREL)->val3);
 
-		if ( sc && !skill_id && sc->data[SC_EXEEDBREAK] ) {
-			ATK_ADDRATE(sc->data[SC_EXEEDBREAK]->val1);
+		if ( sc && !skill_id && SC_ENTRY(sc, SC_EXEEDBREAK) ) {
+			ATK_ADDRATE(SC_ENTRY(sc, SC_EXEEDBREAK)->val1);
 			status_change_end(src, SC_EXEEDBREAK, INVALID_TIMER);
 		}
 
@@ -5627,7 +5700,7 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src, struct bl
 			case KO_BAKURETSU:
 			{
 #ifdef RENEWAL
-				GET_NORMAL_ATTACK((sc && sc->data[SC_MAXIMIZEPOWER] ? 1 : 0) | (sc && sc->data[SC_WEAPONPERFECT] ? 8 : 0), skill_id);
+				GET_NORMAL_ATTACK((sc && SC_ENTRY(sc, SC_MAXIMIZEPOWER) ? 1 : 0) | (sc && SC_ENTRY(sc, SC_WEAPONPERFECT) ? 8 : 0), skill_id);
 #endif
 				skillratio = skill_lv * (50 + status_get_dex(src) / 4);
 				skillratio = (int)(skillratio * (sd ? pc->checkskill(sd, NJ_TOBIDOUGU) : 10) * 40.f / 100.0f * status->get_lv(src) / 120);
@@ -5637,12 +5710,12 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src, struct bl
 
 	#ifdef RENEWAL
 			case GS_MAGICALBULLET:
-				GET_NORMAL_ATTACK((sc && sc->data[SC_MAXIMIZEPOWER] ? 1 : 0) | (sc && sc->data[SC_WEAPONPERFECT] ? 8 : 0), skill_id);
+				GET_NORMAL_ATTACK((sc && SC_ENTRY(sc, SC_MAXIMIZEPOWER) ? 1 : 0) | (sc && SC_ENTRY(sc, SC_WEAPONPERFECT) ? 8 : 0), skill_id);
 				ATK_ADD(battle->attr_fix(src, target,
 					battle->calc_cardfix(BF_MAGIC, src, target, nk, s_ele, 0, status->get_matk(src, 2), 0, wd.flag), ELE_NEUTRAL, tstatus->def_ele, tstatus->ele_lv));
 				break;
 			case GS_PIERCINGSHOT:
-				GET_NORMAL_ATTACK((sc && sc->data[SC_MAXIMIZEPOWER] ? 1 : 0) | (sc && sc->data[SC_WEAPONPERFECT] ? 8 : 0), 0);
+				GET_NORMAL_ATTACK((sc && SC_ENTRY(sc, SC_MAXIMIZEPOWER) ? 1 : 0) | (sc && SC_ENTRY(sc, SC_WEAPONPERFECT) ? 8 : 0), 0);
 				if ( wd.damage ) {
 					if ( sd && sd->weapontype1 == W_RIFLE )
 						ATK_RATE(30 * (skill_lv + 5));
@@ -5653,7 +5726,7 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src, struct bl
 			case MO_EXTREMITYFIST: // [malufett]
 			{
 				short totaldef = status->get_total_def(target);
-				GET_NORMAL_ATTACK((sc != NULL && sc->data[SC_MAXIMIZEPOWER] != NULL ? 1 : 0) | 8, skill_id);
+				GET_NORMAL_ATTACK((sc != NULL && SC_ENTRY(sc, SC_MAXIMIZEPOWER) != NULL ? 1 : 0) | 8, skill_id);
 				if (wd.damage != 0) {
 					ATK_ADD(250 * (skill_lv + 1) + (10 * (status_get_sp(src) + 1) * wd.damage / 100) + (8 * wd.damage));
 					ATK_ADD(-totaldef);
@@ -5676,7 +5749,7 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src, struct bl
 			}
 
 			case PA_SHIELDCHAIN:
-				GET_NORMAL_ATTACK((sc && sc->data[SC_MAXIMIZEPOWER] ? 1 : 0) | (sc && sc->data[SC_WEAPONPERFECT] ? 8 : 0), skill_id);
+				GET_NORMAL_ATTACK((sc && SC_ENTRY(sc, SC_MAXIMIZEPOWER) ? 1 : 0) | (sc && SC_ENTRY(sc, SC_WEAPONPERFECT) ? 8 : 0), skill_id);
 				if ( sd ) {
 					short index = sd->equip_index[EQI_HAND_L];
 					if ( index >= 0 && sd->inventory_data[index] && sd->inventory_data[index]->type == IT_ARMOR ) {
@@ -5687,7 +5760,7 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src, struct bl
 				ATK_RATE(battle->calc_skillratio(BF_WEAPON, src, target, skill_id, skill_lv, skillratio, wflag));
 				break;
 			case GN_CARTCANNON:
-				GET_NORMAL_ATTACK((sc && sc->data[SC_MAXIMIZEPOWER] ? 1 : 0) | (sc && sc->data[SC_WEAPONPERFECT] ? 8 : 0), skill_id);
+				GET_NORMAL_ATTACK((sc && SC_ENTRY(sc, SC_MAXIMIZEPOWER) ? 1 : 0) | (sc && SC_ENTRY(sc, SC_WEAPONPERFECT) ? 8 : 0), skill_id);
 				ATK_ADD(sd ? sd->bonus.arrow_atk : 0);
 				wd.damage = battle->calc_masteryfix(src, target, skill_id, skill_lv, wd.damage, wd.div_, 0, flag.weapon);
 				ATK_RATE(battle->calc_skillratio(BF_WEAPON, src, target, skill_id, skill_lv, skillratio, wflag));
@@ -5703,7 +5776,7 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src, struct bl
 			case LK_SPIRALPIERCE:
 			case ML_SPIRALPIERCE: { // [malufett]
 				short index = sd?sd->equip_index[EQI_HAND_R]:0;
-				GET_NORMAL_ATTACK( (sc && sc->data[SC_MAXIMIZEPOWER]?1:0)|(sc && sc->data[SC_WEAPONPERFECT]?8:0), 0);
+				GET_NORMAL_ATTACK( (sc && SC_ENTRY(sc, SC_MAXIMIZEPOWER)?1:0)|(sc && SC_ENTRY(sc, SC_WEAPONPERFECT)?8:0), 0);
 				wd.damage = wd.damage * 70 / 100;
 				//n_ele = true; // FIXME: This is has no effect if it's after GET_NORMAL_ATTACK (was this intended, or was it supposed to be put above?)
 
@@ -5766,21 +5839,21 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src, struct bl
 				ATK_ADD( status_get_agi(src) * 2 + (sd?sd->status.job_level:0) * 4 );
 				break;
 			case RA_WUGDASH:
-				if( sc && sc->data[SC_DANCE_WITH_WUG] )
-					ATK_ADD(2 * sc->data[SC_DANCE_WITH_WUG]->val1 * (2 + battle->calc_chorusbonus(sd)));
+				if( sc && SC_ENTRY(sc, SC_DANCE_WITH_WUG) )
+					ATK_ADD(2 * SC_ENTRY(sc, SC_DANCE_WITH_WUG)->val1 * (2 + battle->calc_chorusbonus(sd)));
 				break;
 			case SR_TIGERCANNON:
 				ATK_ADD( skill_lv * 240 + status->get_lv(target) * 40 );
-				if( sc && sc->data[SC_COMBOATTACK]
-					&& sc->data[SC_COMBOATTACK]->val1 == SR_FALLENEMPIRE )
+				if( sc && SC_ENTRY(sc, SC_COMBOATTACK)
+					&& SC_ENTRY(sc, SC_COMBOATTACK)->val1 == SR_FALLENEMPIRE )
 						ATK_ADD( skill_lv * 500 + status->get_lv(target) * 40 );
 				break;
 			case RA_WUGSTRIKE:
 			case RA_WUGBITE:
 				if(sd)
 					ATK_ADD(30*pc->checkskill(sd, RA_TOOTHOFWUG));
-				if( sc && sc->data[SC_DANCE_WITH_WUG] )
-					ATK_ADD(2 * sc->data[SC_DANCE_WITH_WUG]->val1 * (2 + battle->calc_chorusbonus(sd)));
+				if( sc && SC_ENTRY(sc, SC_DANCE_WITH_WUG) )
+					ATK_ADD(2 * SC_ENTRY(sc, SC_DANCE_WITH_WUG)->val1 * (2 + battle->calc_chorusbonus(sd)));
 				break;
 			case LG_SHIELDPRESS:
 				if( sd ) {
@@ -5793,7 +5866,7 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src, struct bl
 				break;
 			case SR_GATEOFHELL:
 				ATK_ADD(sstatus->max_hp - status_get_hp(src));
-				if ( sc && sc->data[SC_COMBOATTACK] && sc->data[SC_COMBOATTACK]->val1 == SR_FALLENEMPIRE ) {
+				if ( sc && SC_ENTRY(sc, SC_COMBOATTACK) && SC_ENTRY(sc, SC_COMBOATTACK)->val1 == SR_FALLENEMPIRE ) {
 					ATK_ADD((sstatus->max_sp * (1 + skill_lv * 2 / 10)) + 40 * status->get_lv(src));
 				} else {
 					ATK_ADD((sstatus->sp * (1 + skill_lv * 2 / 10)) + 10 * status->get_lv(src));
@@ -5808,8 +5881,8 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src, struct bl
 				}
 				break;
 			case KO_SETSUDAN:
-				if( tsc && tsc->data[SC_SOULLINK] ){
-					ATK_ADDRATE(200*tsc->data[SC_SOULLINK]->val1);
+				if( tsc && SC_ENTRY(tsc, SC_SOULLINK) ){
+					ATK_ADDRATE(200*SC_ENTRY(tsc, SC_SOULLINK)->val1);
 					status_change_end(target,SC_SOULLINK,INVALID_TIMER);
 				}
 				break;
@@ -5824,21 +5897,21 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src, struct bl
 		//The following are applied on top of current damage and are stackable.
 		if ( sc ) {
 #ifndef RENEWAL
-			if( sc->data[SC_TRUESIGHT] )
-				ATK_ADDRATE(2*sc->data[SC_TRUESIGHT]->val1);
+			if( SC_ENTRY(sc, SC_TRUESIGHT) )
+				ATK_ADDRATE(2*SC_ENTRY(sc, SC_TRUESIGHT)->val1);
 #endif
 #ifndef RENEWAL_EDP
-			if( sc->data[SC_EDP] ){
+			if( SC_ENTRY(sc, SC_EDP) ){
 				switch(skill_id){
 					case AS_SPLASHER: // Needs more info
 					case ASC_BREAKER:
 					case ASC_METEORASSAULT: break;
 					default:
-						ATK_ADDRATE(sc->data[SC_EDP]->val3);
+						ATK_ADDRATE(SC_ENTRY(sc, SC_EDP)->val3);
 				}
 			}
 #endif
-			if(sc->data[SC_STYLE_CHANGE]){
+			if(SC_ENTRY(sc, SC_STYLE_CHANGE)){
 				struct homun_data *hd = BL_CAST(BL_HOM, src);
 				if (hd != NULL)
 					ATK_ADD(hd->homunculus.spiritball * 3);
@@ -5855,16 +5928,16 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src, struct bl
 
 		switch (skill_id) {
 			case AS_SONICBLOW:
-				if (sc && sc->data[SC_SOULLINK] &&
-					sc->data[SC_SOULLINK]->val2 == SL_ASSASIN)
+				if (sc && SC_ENTRY(sc, SC_SOULLINK) &&
+					SC_ENTRY(sc, SC_SOULLINK)->val2 == SL_ASSASIN)
 					ATK_ADDRATE(map_flag_gvg(src->m)?25:100); //+25% dmg on woe/+100% dmg on nonwoe
 
 				if(sd && pc->checkskill(sd,AS_SONICACCEL)>0)
 					ATK_ADDRATE(10);
 			break;
 			case CR_SHIELDBOOMERANG:
-				if(sc && sc->data[SC_SOULLINK] &&
-					sc->data[SC_SOULLINK]->val2 == SL_CRUSADER)
+				if(sc && SC_ENTRY(sc, SC_SOULLINK) &&
+					SC_ENTRY(sc, SC_SOULLINK)->val2 == SL_CRUSADER)
 					ATK_ADDRATE(100);
 				break;
 		}
@@ -5914,11 +5987,11 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src, struct bl
 	#ifdef RENEWAL
 			if( wd.flag&BF_LONG )
 				ATK_ADDRATE(sd->bonus.long_attack_atk_rate);
-			if( sc && sc->data[SC_MTF_RANGEATK] )
-				ATK_ADDRATE(sc->data[SC_MTF_RANGEATK]->val1);// temporary it should be 'bonus.long_attack_atk_rate'
+			if( sc && SC_ENTRY(sc, SC_MTF_RANGEATK) )
+				ATK_ADDRATE(SC_ENTRY(sc, SC_MTF_RANGEATK)->val1);// temporary it should be 'bonus.long_attack_atk_rate'
 	#endif
-			if (sc != NULL && sc->data[SC_ARCLOUSEDASH] != NULL && sc->data[SC_ARCLOUSEDASH]->val4 != 0) {
-				ATK_ADDRATE(sc->data[SC_ARCLOUSEDASH]->val4);
+			if (sc != NULL && SC_ENTRY(sc, SC_ARCLOUSEDASH) != NULL && SC_ENTRY(sc, SC_ARCLOUSEDASH)->val4 != 0) {
+				ATK_ADDRATE(SC_ENTRY(sc, SC_ARCLOUSEDASH)->val4);
 			}
 			if( (i=pc->checkskill(sd,AB_EUCHARISTICA)) > 0 &&
 				(tstatus->race == RC_DEMON || tstatus->def_ele == ELE_DARK) )
@@ -6025,12 +6098,12 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src, struct bl
 		//Post skill/vit reduction damage increases
 		if (sc) {
 			//SC skill damages
-			if(sc->data[SC_AURABLADE]
+			if(SC_ENTRY(sc, SC_AURABLADE)
 #ifndef RENEWAL
 					&& skill_id != LK_SPIRALPIERCE && skill_id != ML_SPIRALPIERCE
 #endif
 			){
-				int lv = sc->data[SC_AURABLADE]->val1;
+				int lv = SC_ENTRY(sc, SC_AURABLADE)->val1;
 #ifdef RENEWAL
 				if (skill_id == LK_SPIRALPIERCE || skill_id == ML_SPIRALPIERCE)
 					lv *= wd.div_; // +100 per hit in lv 5
@@ -6042,14 +6115,14 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src, struct bl
 			}
 
 			if( !skill_id ) {
-				if( sc->data[SC_ENCHANTBLADE] ) {
+				if( SC_ENTRY(sc, SC_ENCHANTBLADE) ) {
 					//[( ( Skill Lv x 20 ) + 100 ) x ( casterBaseLevel / 150 )] + casterInt
-					i = ( sc->data[SC_ENCHANTBLADE]->val1 * 20 + 100 ) * status->get_lv(src) / 150 + status_get_int(src);
+					i = ( SC_ENTRY(sc, SC_ENCHANTBLADE)->val1 * 20 + 100 ) * status->get_lv(src) / 150 + status_get_int(src);
 					i = i - status->get_total_mdef(target) + status->get_matk(src, 2);
 					if( i )
 						ATK_ADD(i);
 				}
-				if( sc->data[SC_GIANTGROWTH] && rnd()%100 < 15 )
+				if( SC_ENTRY(sc, SC_GIANTGROWTH) && rnd()%100 < 15 )
 					ATK_ADDRATE(200); // Triple Damage
 			}
 		}
@@ -6219,7 +6292,7 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src, struct bl
 	if(!flag.lh && wd.damage2)
 		wd.damage2=0;
 
-	if( sc && sc->data[SC_GLOOMYDAY] ) {
+	if( sc && SC_ENTRY(sc, SC_GLOOMYDAY) ) {
 		switch( skill_id ) {
 			case KN_BRANDISHSPEAR:
 			case LK_SPIRALPIERCE:
@@ -6228,13 +6301,13 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src, struct bl
 			case PA_SHIELDCHAIN:
 			case RK_HUNDREDSPEAR:
 			case LG_SHIELDPRESS:
-				wd.damage += wd.damage * sc->data[SC_GLOOMYDAY]->val2 / 100;
+				wd.damage += wd.damage * SC_ENTRY(sc, SC_GLOOMYDAY)->val2 / 100;
 		}
 	}
 
 	if( sc ) {
 		//SG_FUSION hp penalty [Komurka]
-		if (sc->data[SC_FUSION]) {
+		if (SC_ENTRY(sc, SC_FUSION)) {
 			int hp= sstatus->max_hp;
 			if (sd && tsd) {
 				hp = 8*hp/100;
@@ -6317,14 +6390,14 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src, struct bl
 	}
 	map->freeblock_lock();
 	//Reject Sword bugreport:4493 by Daegaladh
-	if (wd.damage != 0 && tsc != NULL && tsc->data[SC_SWORDREJECT] != NULL
+	if (wd.damage != 0 && tsc != NULL && SC_ENTRY(tsc, SC_SWORDREJECT) != NULL
 	 && (sd == NULL || sd->weapontype1 == W_DAGGER || sd->weapontype1 == W_1HSWORD || sd->weapontype == W_2HSWORD)
-	 && rnd()%100 < tsc->data[SC_SWORDREJECT]->val2
+	 && rnd()%100 < SC_ENTRY(tsc, SC_SWORDREJECT)->val2
 	) {
 		ATK_RATER(50);
 		status_fix_damage(target,src,wd.damage,clif->damage(target,src,0,0,wd.damage,0,BDT_NORMAL,0));
-		clif->skill_nodamage(target,target,ST_REJECTSWORD,tsc->data[SC_SWORDREJECT]->val1,1);
-		if( --(tsc->data[SC_SWORDREJECT]->val3) <= 0 )
+		clif->skill_nodamage(target,target,ST_REJECTSWORD,SC_ENTRY(tsc, SC_SWORDREJECT)->val1,1);
+		if( --(SC_ENTRY(tsc, SC_SWORDREJECT)->val3) <= 0 )
 			status_change_end(target, SC_SWORDREJECT, INVALID_TIMER);
 	}
 #ifndef RENEWAL
@@ -6436,14 +6509,14 @@ static void battle_reflect_damage(struct block_list *target, struct block_list *
 
 	if( sc ) {
 		if (wd->flag & BF_SHORT && !(skill->get_inf(skill_id) & (INF_GROUND_SKILL | INF_SELF_SKILL))) {
-			if( sc->data[SC_CRESCENTELBOW] && !is_boss(src) && rnd()%100 < sc->data[SC_CRESCENTELBOW]->val2 ){
+			if( SC_ENTRY(sc, SC_CRESCENTELBOW) && !is_boss(src) && rnd()%100 < SC_ENTRY(sc, SC_CRESCENTELBOW)->val2 ){
 				//ATK [{(Target HP / 100) x Skill Level} x Caster Base Level / 125] % + [Received damage x {1 + (Skill Level x 0.2)}]
-				int ratio = (status_get_hp(src) / 100) * sc->data[SC_CRESCENTELBOW]->val1 * status->get_lv(target) / 125;
+				int ratio = (status_get_hp(src) / 100) * SC_ENTRY(sc, SC_CRESCENTELBOW)->val1 * status->get_lv(target) / 125;
 				if (ratio > 5000) ratio = 5000; // Maximum of 5000% ATK
-				rdamage = ratio + (damage)* (10 + sc->data[SC_CRESCENTELBOW]->val1 * 20 / 10) / 10;
-				skill->blown(target, src, skill->get_blewcount(SR_CRESCENTELBOW_AUTOSPELL, sc->data[SC_CRESCENTELBOW]->val1), unit->getdir(src), 0);
+				rdamage = ratio + (damage)* (10 + SC_ENTRY(sc, SC_CRESCENTELBOW)->val1 * 20 / 10) / 10;
+				skill->blown(target, src, skill->get_blewcount(SR_CRESCENTELBOW_AUTOSPELL, SC_ENTRY(sc, SC_CRESCENTELBOW)->val1), unit->getdir(src), 0);
 				clif->skill_damage(target, src, tick, status_get_amotion(src), 0, rdamage,
-						   1, SR_CRESCENTELBOW_AUTOSPELL, sc->data[SC_CRESCENTELBOW]->val1, BDT_SKILL); // This is how official does
+						   1, SR_CRESCENTELBOW_AUTOSPELL, SC_ENTRY(sc, SC_CRESCENTELBOW)->val1, BDT_SKILL); // This is how official does
 				clif->delay_damage(tick + delay, src, target,status_get_amotion(src)+1000,0, rdamage/10, 1, BDT_NORMAL);
 				status->damage(src, target, status->damage(target, src, rdamage, 0, 0, 1)/10, 0, 0, 1);
 				status_change_end(target, SC_CRESCENTELBOW, INVALID_TIMER);
@@ -6454,16 +6527,16 @@ static void battle_reflect_damage(struct block_list *target, struct block_list *
 
 		if( wd->flag & BF_SHORT ) {
 			if( !is_boss(src) ) {
-				if( sc->data[SC_DEATHBOUND] && skill_id != WS_CARTTERMINATION ) {
+				if( SC_ENTRY(sc, SC_DEATHBOUND) && skill_id != WS_CARTTERMINATION ) {
 					enum unit_dir dir = map->calc_dir(target, src->x, src->y);
 					enum unit_dir t_dir = unit->getdir(target);
 
 					if (map->check_dir(dir, t_dir) == 0) {
-						int64 rd1 = damage * sc->data[SC_DEATHBOUND]->val2 / 100; // Amplify damage.
+						int64 rd1 = damage * SC_ENTRY(sc, SC_DEATHBOUND)->val2 / 100; // Amplify damage.
 
 						trdamage += rdamage = rd1 - (damage = rd1 * 30 / 100); // not normalized as intended.
-						rdelay = clif->skill_damage(src, target, tick, status_get_amotion(src), status_get_dmotion(src), -3000, 1, RK_DEATHBOUND, sc->data[SC_DEATHBOUND]->val1, BDT_SKILL);
-						skill->blown(target, src, skill->get_blewcount(RK_DEATHBOUND, sc->data[SC_DEATHBOUND]->val1), unit->getdir(src), 0);
+						rdelay = clif->skill_damage(src, target, tick, status_get_amotion(src), status_get_dmotion(src), -3000, 1, RK_DEATHBOUND, SC_ENTRY(sc, SC_DEATHBOUND)->val1, BDT_SKILL);
+						skill->blown(target, src, skill->get_blewcount(RK_DEATHBOUND, SC_ENTRY(sc, SC_DEATHBOUND)->val1), unit->getdir(src), 0);
 
 						if( tsd ) /* is this right? rdamage as both left and right? */
 							battle->drain(tsd, src, rdamage, rdamage, status_get_race(src), 0);
@@ -6478,7 +6551,7 @@ static void battle_reflect_damage(struct block_list *target, struct block_list *
 			}
 		}
 
-		if( sc->data[SC_KYOMU] ){
+		if( SC_ENTRY(sc, SC_KYOMU) ){
 			// Nullify reflecting ability of the conditions onwards
 			return;
 		}
@@ -6501,18 +6574,18 @@ static void battle_reflect_damage(struct block_list *target, struct block_list *
 		if( wd->dmg_lv >= ATK_BLOCK ) {/* yes block still applies, somehow gravity thinks it makes sense. */
 			struct status_change *ssc;
 			if( sc ) {
-				struct status_change_entry *sce_d = sc->data[SC_DEVOTION];
+				struct status_change_entry *sce_d = SC_ENTRY(sc, SC_DEVOTION);
 				struct block_list *d_bl = NULL;
 
 				if (sce_d && sce_d->val1)
 					d_bl = map->id2bl(sce_d->val1);
 
-				if( sc->data[SC_REFLECTSHIELD] && skill_id != WS_CARTTERMINATION && skill_id != GS_DESPERADO
+				if( SC_ENTRY(sc, SC_REFLECTSHIELD) && skill_id != WS_CARTTERMINATION && skill_id != GS_DESPERADO
 				  && !(d_bl && !(wd->flag&BF_SKILL)) // It should not be a basic attack if the target is under devotion
 				  && !(d_bl && sce_d && !check_distance_bl(target, d_bl, sce_d->val3)) // It should not be out of range if the target is under devotion
 				) {
 
-					NORMALIZE_RDAMAGE(damage * sc->data[SC_REFLECTSHIELD]->val2 / 100);
+					NORMALIZE_RDAMAGE(damage * SC_ENTRY(sc, SC_REFLECTSHIELD)->val2 / 100);
 #ifndef RENEWAL
 					rdelay = clif->delay_damage(tick+delay,src, src, status_get_amotion(src), status_get_dmotion(src), rdamage, 1, BDT_ENDURE);
 #else
@@ -6525,8 +6598,8 @@ static void battle_reflect_damage(struct block_list *target, struct block_list *
 
 					delay += 100;/* gradual increase so the numbers don't clip in the client */
 				}
-				if( sc->data[SC_LG_REFLECTDAMAGE] && rnd()%100 < (30 + 10*sc->data[SC_LG_REFLECTDAMAGE]->val1) ) {
-					NORMALIZE_RDAMAGE(damage * sc->data[SC_LG_REFLECTDAMAGE]->val2 / 100);
+				if( SC_ENTRY(sc, SC_LG_REFLECTDAMAGE) && rnd()%100 < (30 + 10*SC_ENTRY(sc, SC_LG_REFLECTDAMAGE)->val1) ) {
+					NORMALIZE_RDAMAGE(damage * SC_ENTRY(sc, SC_LG_REFLECTDAMAGE)->val2 / 100);
 
 					trdamage -= rdamage;/* wont count towards total */
 
@@ -6544,11 +6617,11 @@ static void battle_reflect_damage(struct block_list *target, struct block_list *
 
 					delay += 150;/* gradual increase so the numbers don't clip in the client */
 
-					if( (--sc->data[SC_LG_REFLECTDAMAGE]->val3) <= 0 )
+					if( (--SC_ENTRY(sc, SC_LG_REFLECTDAMAGE)->val3) <= 0 )
 						status_change_end(target, SC_LG_REFLECTDAMAGE, INVALID_TIMER);
 				}
-				if( sc->data[SC_SHIELDSPELL_DEF] && sc->data[SC_SHIELDSPELL_DEF]->val1 == 2 ){
-					NORMALIZE_RDAMAGE(damage * sc->data[SC_SHIELDSPELL_DEF]->val2 / 100);
+				if( SC_ENTRY(sc, SC_SHIELDSPELL_DEF) && SC_ENTRY(sc, SC_SHIELDSPELL_DEF)->val1 == 2 ){
+					NORMALIZE_RDAMAGE(damage * SC_ENTRY(sc, SC_SHIELDSPELL_DEF)->val2 / 100);
 
 					rdelay = clif->delay_damage(tick+delay,src, src, status_get_amotion(src), status_get_dmotion(src), rdamage, 1, BDT_ENDURE);
 
@@ -6559,8 +6632,8 @@ static void battle_reflect_damage(struct block_list *target, struct block_list *
 
 					delay += 100;/* gradual increase so the numbers don't clip in the client */
 				}
-				if (sc->data[SC_MVPCARD_ORCLORD]) {
-					NORMALIZE_RDAMAGE(damage * sc->data[SC_MVPCARD_ORCLORD]->val1 / 100);
+				if (SC_ENTRY(sc, SC_MVPCARD_ORCLORD)) {
+					NORMALIZE_RDAMAGE(damage * SC_ENTRY(sc, SC_MVPCARD_ORCLORD)->val1 / 100);
 
 					rdelay = clif->delay_damage(tick + delay, src, src, status_get_amotion(src), status_get_dmotion(src), rdamage, 1, BDT_ENDURE);
 
@@ -6572,7 +6645,7 @@ static void battle_reflect_damage(struct block_list *target, struct block_list *
 				}
 			}
 			if( ( ssc = status->get_sc(src) ) ) {
-				if( ssc->data[SC_INSPIRATION] ) {
+				if( SC_ENTRY(ssc, SC_INSPIRATION) ) {
 					NORMALIZE_RDAMAGE(damage / 100);
 
 					rdelay = clif->delay_damage(tick+delay,target, target, status_get_amotion(target), status_get_dmotion(target), rdamage, 1, BDT_ENDURE);
@@ -6791,7 +6864,7 @@ static bool battle_should_bladestop_attacker(struct block_list *attacker, struct
 	nullpo_retr(false, target);
 
 	struct status_change *tsc = status->get_sc(target);
-	if (tsc == NULL || tsc->data[SC_BLADESTOP_WAIT] == NULL)
+	if (tsc == NULL || SC_ENTRY(tsc, SC_BLADESTOP_WAIT) == NULL)
 		return false; // Target is not in BladeStop wait mode
 
 #ifndef RENEWAL
@@ -6857,19 +6930,19 @@ static enum damage_lv battle_weapon_attack(struct block_list *src, struct block_
 		}
 	}
 	if (sc && sc->count) {
-		if (sc->data[SC_CLOAKING] && !(sc->data[SC_CLOAKING]->val4 & 2))
+		if (SC_ENTRY(sc, SC_CLOAKING) && !(SC_ENTRY(sc, SC_CLOAKING)->val4 & 2))
 			status_change_end(src, SC_CLOAKING, INVALID_TIMER);
-		else if (sc->data[SC_CLOAKINGEXCEED] && !(sc->data[SC_CLOAKINGEXCEED]->val4 & 2))
+		else if (SC_ENTRY(sc, SC_CLOAKINGEXCEED) && !(SC_ENTRY(sc, SC_CLOAKINGEXCEED)->val4 & 2))
 			status_change_end(src, SC_CLOAKINGEXCEED, INVALID_TIMER);
-		else if (sc->data[SC_NEWMOON] != NULL && --(sc->data[SC_NEWMOON]->val2) <= 0)
+		else if (SC_ENTRY(sc, SC_NEWMOON) != NULL && --(SC_ENTRY(sc, SC_NEWMOON)->val2) <= 0)
 			status_change_end(src, SC_NEWMOON, INVALID_TIMER);
 	}
-	if( tsc && tsc->data[SC_AUTOCOUNTER] && status->check_skilluse(target, src, KN_AUTOCOUNTER, 1) ) {
+	if( tsc && SC_ENTRY(tsc, SC_AUTOCOUNTER) && status->check_skilluse(target, src, KN_AUTOCOUNTER, 1) ) {
 		enum unit_dir   dir = map->calc_dir(target, src->x, src->y);
 		enum unit_dir t_dir = unit->getdir(target);
 		int dist = distance_bl(src, target);
 		if(dist <= 0 || (map->check_dir(dir, t_dir) == 0 && dist <= tstatus->rhw.range + 1)) {
-			uint16 skill_lv = tsc->data[SC_AUTOCOUNTER]->val1;
+			uint16 skill_lv = SC_ENTRY(tsc, SC_AUTOCOUNTER)->val1;
 			clif->skillcastcancel(target); //Remove the casting bar. [Skotlex]
 			clif->damage(src, target, sstatus->amotion, 1, 0, 1, BDT_NORMAL, 0); //Display MISS.
 			status_change_end(target, SC_AUTOCOUNTER, INVALID_TIMER);
@@ -6878,7 +6951,7 @@ static enum damage_lv battle_weapon_attack(struct block_list *src, struct block_
 		}
 	}
 	if (tsc != NULL && battle->should_bladestop_attacker(src, target)) {
-		uint16 skill_lv = tsc->data[SC_BLADESTOP_WAIT]->val1;
+		uint16 skill_lv = SC_ENTRY(tsc, SC_BLADESTOP_WAIT)->val1;
 		status_change_end(target, SC_BLADESTOP_WAIT, INVALID_TIMER);
 
 #ifndef RENEWAL
@@ -6902,8 +6975,8 @@ static enum damage_lv battle_weapon_attack(struct block_list *src, struct block_
 #else
 		int triple_rate = 30; // Base Rate
 #endif
-		if (sc != NULL && sc->data[SC_SKILLRATE_UP] != NULL && sc->data[SC_SKILLRATE_UP]->val1 == MO_TRIPLEATTACK) {
-			triple_rate += triple_rate * (sc->data[SC_SKILLRATE_UP]->val2) / 100;
+		if (sc != NULL && SC_ENTRY(sc, SC_SKILLRATE_UP) != NULL && SC_ENTRY(sc, SC_SKILLRATE_UP)->val1 == MO_TRIPLEATTACK) {
+			triple_rate += triple_rate * (SC_ENTRY(sc, SC_SKILLRATE_UP)->val2) / 100;
 			status_change_end(src, SC_SKILLRATE_UP, INVALID_TIMER);
 		}
 		if (rnd() % 100 < triple_rate) {
@@ -6914,11 +6987,11 @@ static enum damage_lv battle_weapon_attack(struct block_list *src, struct block_
 	}
 
 	if (sc) {
-		if (sc->data[SC_SACRIFICE]) {
-			uint16 skill_lv = sc->data[SC_SACRIFICE]->val1;
+		if (SC_ENTRY(sc, SC_SACRIFICE)) {
+			uint16 skill_lv = SC_ENTRY(sc, SC_SACRIFICE)->val1;
 			damage_lv ret_val;
 
-			if( --sc->data[SC_SACRIFICE]->val2 <= 0 )
+			if( --SC_ENTRY(sc, SC_SACRIFICE)->val2 <= 0 )
 				status_change_end(src, SC_SACRIFICE, INVALID_TIMER);
 
 			/**
@@ -6932,35 +7005,35 @@ static enum damage_lv battle_weapon_attack(struct block_list *src, struct block_
 				return ATK_MISS;
 			return ret_val;
 		}
-		if (sc->data[SC_MAGICALATTACK]) {
-			if( skill->attack(BF_MAGIC,src,src,target,NPC_MAGICALATTACK,sc->data[SC_MAGICALATTACK]->val1,tick,0) )
+		if (SC_ENTRY(sc, SC_MAGICALATTACK)) {
+			if( skill->attack(BF_MAGIC,src,src,target,NPC_MAGICALATTACK,SC_ENTRY(sc, SC_MAGICALATTACK)->val1,tick,0) )
 				return ATK_DEF;
 			return ATK_MISS;
 		}
 
-		if( tsc && tsc->data[SC_MTF_MLEATKED] && rnd()%100 < 20 )
+		if( tsc && SC_ENTRY(tsc, SC_MTF_MLEATKED) && rnd()%100 < 20 )
 			clif->skill_nodamage(target, target, SM_ENDURE, 5,
 				sc_start(target, target, SC_ENDURE, 100, 5, skill->get_time(SM_ENDURE, 5), SM_ENDURE));
 	}
 
-	if(tsc && tsc->data[SC_KAAHI] && tsc->data[SC_KAAHI]->val4 == INVALID_TIMER && tstatus->hp < tstatus->max_hp)
-		tsc->data[SC_KAAHI]->val4 = timer->add(tick + skill->get_time2(SL_KAAHI,tsc->data[SC_KAAHI]->val1), status->kaahi_heal_timer, target->id, SC_KAAHI); //Activate heal.
+	if(tsc && SC_ENTRY(tsc, SC_KAAHI) && SC_ENTRY(tsc, SC_KAAHI)->val4 == INVALID_TIMER && tstatus->hp < tstatus->max_hp)
+		SC_ENTRY(tsc, SC_KAAHI)->val4 = timer->add(tick + skill->get_time2(SL_KAAHI,SC_ENTRY(tsc, SC_KAAHI)->val1), status->kaahi_heal_timer, target->id, SC_KAAHI); //Activate heal.
 
 	wd = battle->calc_attack(BF_WEAPON, src, target, 0, 0, flag);
 
 	if( sc && sc->count ) {
-		if( sc->data[SC_SPELLFIST] ) {
-			if( --(sc->data[SC_SPELLFIST]->val1) >= 0 ){
-				struct Damage ad = battle->calc_attack(BF_MAGIC,src,target,sc->data[SC_SPELLFIST]->val3,sc->data[SC_SPELLFIST]->val4,flag|BF_SHORT);
+		if( SC_ENTRY(sc, SC_SPELLFIST) ) {
+			if( --(SC_ENTRY(sc, SC_SPELLFIST)->val1) >= 0 ){
+				struct Damage ad = battle->calc_attack(BF_MAGIC,src,target,SC_ENTRY(sc, SC_SPELLFIST)->val3,SC_ENTRY(sc, SC_SPELLFIST)->val4,flag|BF_SHORT);
 				wd.damage = ad.damage;
 				damage_div_fix(wd.damage, wd.div_);
 			}else
 				status_change_end(src,SC_SPELLFIST,INVALID_TIMER);
 		}
 
-		if( sd && sc->data[SC_FEARBREEZE] && sc->data[SC_FEARBREEZE]->val4 > 0 && sd->status.inventory[sd->equip_index[EQI_AMMO]].amount >= sc->data[SC_FEARBREEZE]->val4 && battle_config.arrow_decrement){
-			pc->delitem(sd, sd->equip_index[EQI_AMMO], sc->data[SC_FEARBREEZE]->val4, 0, DELITEM_SKILLUSE, LOG_TYPE_CONSUME);
-			sc->data[SC_FEARBREEZE]->val4 = 0;
+		if( sd && SC_ENTRY(sc, SC_FEARBREEZE) && SC_ENTRY(sc, SC_FEARBREEZE)->val4 > 0 && sd->status.inventory[sd->equip_index[EQI_AMMO]].amount >= SC_ENTRY(sc, SC_FEARBREEZE)->val4 && battle_config.arrow_decrement){
+			pc->delitem(sd, sd->equip_index[EQI_AMMO], SC_ENTRY(sc, SC_FEARBREEZE)->val4, 0, DELITEM_SKILLUSE, LOG_TYPE_CONSUME);
+			SC_ENTRY(sc, SC_FEARBREEZE)->val4 = 0;
 		}
 	}
 	if (sd && sd->state.arrow_atk) //Consume arrow.
@@ -6980,14 +7053,14 @@ static enum damage_lv battle_weapon_attack(struct block_list *src, struct block_
 
 	damage = wd.damage + wd.damage2;
 	if( damage > 0 && src != target ) {
-		if( sc && sc->data[SC_DUPLELIGHT] && (wd.flag&BF_SHORT) && rnd()%100 <= 10+2*sc->data[SC_DUPLELIGHT]->val1 ){
+		if( sc && SC_ENTRY(sc, SC_DUPLELIGHT) && (wd.flag&BF_SHORT) && rnd()%100 <= 10+2*SC_ENTRY(sc, SC_DUPLELIGHT)->val1 ){
 			// Activates it only from melee damage
 			uint16 skill_id;
 			if( rnd()%2 == 1 )
 				skill_id = AB_DUPLELIGHT_MELEE;
 			else
 				skill_id = AB_DUPLELIGHT_MAGIC;
-			skill->attack(skill->get_type(skill_id, sc->data[SC_DUPLELIGHT]->val1), src, src, target, skill_id, sc->data[SC_DUPLELIGHT]->val1, tick, SD_LEVEL);
+			skill->attack(skill->get_type(skill_id, SC_ENTRY(sc, SC_DUPLELIGHT)->val1), src, src, target, skill_id, SC_ENTRY(sc, SC_DUPLELIGHT)->val1, tick, SD_LEVEL);
 		}
 	}
 
@@ -7015,8 +7088,8 @@ static enum damage_lv battle_weapon_attack(struct block_list *src, struct block_
 	}else
 		battle->delay_damage(tick, wd.amotion, src, target, wd.flag, 0, 0, damage, wd.dmg_lv, wd.dmotion, true);
 	if( tsc ) {
-		if( tsc->data[SC_DEVOTION] ) {
-			struct status_change_entry *sce = tsc->data[SC_DEVOTION];
+		if( SC_ENTRY(tsc, SC_DEVOTION) ) {
+			struct status_change_entry *sce = SC_ENTRY(tsc, SC_DEVOTION);
 			struct block_list *d_bl = map->id2bl(sce->val1);
 			struct mercenary_data *d_md = BL_CAST(BL_MER, d_bl);
 			struct map_session_data *d_sd = BL_CAST(BL_PC, d_bl);
@@ -7032,27 +7105,27 @@ static enum damage_lv battle_weapon_attack(struct block_list *src, struct block_
 			} else {
 				status_change_end(target, SC_DEVOTION, INVALID_TIMER);
 			}
-		} else if( tsc->data[SC_CIRCLE_OF_FIRE_OPTION] && (wd.flag&BF_SHORT) && target->type == BL_PC ) {
+		} else if( SC_ENTRY(tsc, SC_CIRCLE_OF_FIRE_OPTION) && (wd.flag&BF_SHORT) && target->type == BL_PC ) {
 			struct elemental_data *ed = BL_UCAST(BL_PC, target)->ed;
 			if (ed != NULL) {
-				clif->skill_damage(&ed->bl, target, tick, status_get_amotion(src), 0, -30000, 1, EL_CIRCLE_OF_FIRE, tsc->data[SC_CIRCLE_OF_FIRE_OPTION]->val1, BDT_SKILL);
-				skill->attack(BF_MAGIC,&ed->bl,&ed->bl,src,EL_CIRCLE_OF_FIRE,tsc->data[SC_CIRCLE_OF_FIRE_OPTION]->val1,tick,wd.flag);
+				clif->skill_damage(&ed->bl, target, tick, status_get_amotion(src), 0, -30000, 1, EL_CIRCLE_OF_FIRE, SC_ENTRY(tsc, SC_CIRCLE_OF_FIRE_OPTION)->val1, BDT_SKILL);
+				skill->attack(BF_MAGIC,&ed->bl,&ed->bl,src,EL_CIRCLE_OF_FIRE,SC_ENTRY(tsc, SC_CIRCLE_OF_FIRE_OPTION)->val1,tick,wd.flag);
 			}
-		} else if (tsc->data[SC_WATER_SCREEN_OPTION]) {
-			struct block_list *e_bl = map->id2bl(tsc->data[SC_WATER_SCREEN_OPTION]->val1);
+		} else if (SC_ENTRY(tsc, SC_WATER_SCREEN_OPTION)) {
+			struct block_list *e_bl = map->id2bl(SC_ENTRY(tsc, SC_WATER_SCREEN_OPTION)->val1);
 			if (e_bl && !status->isdead(e_bl)) {
 				clif->damage(e_bl, e_bl, 0, 0, damage, wd.div_, BDT_NORMAL, 0);
 				status_fix_damage(NULL, e_bl, damage, 0);
 			}
 		}
 	}
-	if (sc && sc->data[SC_AUTOSPELL] && rnd()%100 < sc->data[SC_AUTOSPELL]->val4) {
+	if (sc && SC_ENTRY(sc, SC_AUTOSPELL) && rnd()%100 < SC_ENTRY(sc, SC_AUTOSPELL)->val4) {
 		int sp = 0;
-		uint16 skill_id = sc->data[SC_AUTOSPELL]->val2;
-		uint16 skill_lv = sc->data[SC_AUTOSPELL]->val3;
+		uint16 skill_id = SC_ENTRY(sc, SC_AUTOSPELL)->val2;
+		uint16 skill_lv = SC_ENTRY(sc, SC_AUTOSPELL)->val3;
 #ifndef RENEWAL
 		int i = rnd() % 100;
-		if (sc->data[SC_SOULLINK] != NULL && sc->data[SC_SOULLINK]->val2 == SL_SAGE)
+		if (SC_ENTRY(sc, SC_SOULLINK) != NULL && SC_ENTRY(sc, SC_SOULLINK)->val2 == SL_SAGE)
 			i = 0; //Max chance, no skill_lv reduction. [Skotlex]
 
 		if (i >= 50)
@@ -7073,12 +7146,12 @@ static enum damage_lv battle_weapon_attack(struct block_list *src, struct block_
 	}
 	if (sd) {
 		if( wd.flag&BF_SHORT && sc
-		 && sc->data[SC__AUTOSHADOWSPELL] && rnd()%100 < sc->data[SC__AUTOSHADOWSPELL]->val3
-		 && sd->status.skill[skill->get_index(sc->data[SC__AUTOSHADOWSPELL]->val1)].id != 0
-		 && sd->status.skill[skill->get_index(sc->data[SC__AUTOSHADOWSPELL]->val1)].flag == SKILL_FLAG_PLAGIARIZED
+		 && SC_ENTRY(sc, SC__AUTOSHADOWSPELL) && rnd()%100 < SC_ENTRY(sc, SC__AUTOSHADOWSPELL)->val3
+		 && sd->status.skill[skill->get_index(SC_ENTRY(sc, SC__AUTOSHADOWSPELL)->val1)].id != 0
+		 && sd->status.skill[skill->get_index(SC_ENTRY(sc, SC__AUTOSHADOWSPELL)->val1)].flag == SKILL_FLAG_PLAGIARIZED
 		) {
-			int r_skill = sd->status.skill[skill->get_index(sc->data[SC__AUTOSHADOWSPELL]->val1)].id;
-			int r_lv = sc->data[SC__AUTOSHADOWSPELL]->val2;
+			int r_skill = sd->status.skill[skill->get_index(SC_ENTRY(sc, SC__AUTOSHADOWSPELL)->val1)].id;
+			int r_lv = SC_ENTRY(sc, SC__AUTOSHADOWSPELL)->val2;
 
 			if (r_skill != AL_HOLYLIGHT && r_skill != PR_MAGNUS) {
 				int type;
@@ -7121,11 +7194,11 @@ static enum damage_lv battle_weapon_attack(struct block_list *src, struct block_
 			}
 		}
 
-		if ((wd.flag & BF_WEAPON && sc != NULL && sc->data[SC_FALLINGSTAR] != NULL && rand() % 100 < sc->data[SC_FALLINGSTAR]->val2)) {
+		if ((wd.flag & BF_WEAPON && sc != NULL && SC_ENTRY(sc, SC_FALLINGSTAR) != NULL && rand() % 100 < SC_ENTRY(sc, SC_FALLINGSTAR)->val2)) {
 			if (sd != NULL)
 				sd->auto_cast_current.type = AUTOCAST_TEMP;
-			if (status->charge(src, 0, skill->get_sp(SJ_FALLINGSTAR_ATK, sc->data[SC_FALLINGSTAR]->val1)))
-				skill->castend_nodamage_id(src, src, SJ_FALLINGSTAR_ATK, sc->data[SC_FALLINGSTAR]->val1, tick, flag);
+			if (status->charge(src, 0, skill->get_sp(SJ_FALLINGSTAR_ATK, SC_ENTRY(sc, SC_FALLINGSTAR)->val1)))
+				skill->castend_nodamage_id(src, src, SJ_FALLINGSTAR_ATK, SC_ENTRY(sc, SC_FALLINGSTAR)->val1, tick, flag);
 			if (sd != NULL)
 				sd->auto_cast_current.type = AUTOCAST_NONE;
 		}
@@ -7139,15 +7212,15 @@ static enum damage_lv battle_weapon_attack(struct block_list *src, struct block_
 	}
 
 	if (tsc) {
-		if (tsc->data[SC_POISONREACT]
-		 && ( rnd()%100 < tsc->data[SC_POISONREACT]->val3
+		if (SC_ENTRY(tsc, SC_POISONREACT)
+		 && ( rnd()%100 < SC_ENTRY(tsc, SC_POISONREACT)->val3
 		    || sstatus->def_ele == ELE_POISON
 		    )
 		 /* && check_distance_bl(src, target, tstatus->rhw.range+1) Doesn't check range! o.O; */
 		 && status->check_skilluse(target, src, TF_POISON, 0)
 		) {
 			//Poison React
-			struct status_change_entry *sce = tsc->data[SC_POISONREACT];
+			struct status_change_entry *sce = SC_ENTRY(tsc, SC_POISONREACT);
 			if (sstatus->def_ele == ELE_POISON) {
 				sce->val2 = 0;
 				skill->attack(BF_WEAPON,target,target,src,AS_POISONREACT,sce->val1,tick,0);
@@ -7329,7 +7402,7 @@ static int battle_check_target(struct block_list *src, struct block_list *target
 			if (pc_isinvisible(t_sd))
 				return -1; //Cannot be targeted yet.
 			if (sc && sc->count) {
-				if (sc->data[SC_SIREN] && sc->data[SC_SIREN]->val2 == target->id)
+				if (SC_ENTRY(sc, SC_SIREN) && SC_ENTRY(sc, SC_SIREN)->val2 == target->id)
 					return -1;
 			}
 		}
@@ -7489,7 +7562,7 @@ static int battle_check_target(struct block_list *src, struct block_list *target
 			}
 			//Status changes that prevent traps from triggering
 			if (sc != NULL && sc->count != 0 && skill->get_inf2(su->group->skill_id)&INF2_TRAP) {
-				if (sc->data[SC_WZ_SIGHTBLASTER] != NULL && sc->data[SC_WZ_SIGHTBLASTER]->val2 > 0 && sc->data[SC_WZ_SIGHTBLASTER]->val4%2 == 0)
+				if (SC_ENTRY(sc, SC_WZ_SIGHTBLASTER) != NULL && SC_ENTRY(sc, SC_WZ_SIGHTBLASTER)->val2 > 0 && SC_ENTRY(sc, SC_WZ_SIGHTBLASTER)->val4%2 == 0)
 					return -1;
 			}
 		}
@@ -8465,6 +8538,7 @@ static void do_init_battle(bool minimal)
 		return;
 
 	battle->delay_damage_ers = ers_new(sizeof(struct delay_damage),"battle.c::delay_damage_ers",ERS_OPT_CLEAR);
+	battle->cardfix_cache_clear();
 	timer->add_func_list(battle->delay_damage_sub, "battle_delay_damage_sub");
 }
 
@@ -8504,6 +8578,8 @@ void battle_defaults(void)
 	battle->attr_ratio = battle_attr_ratio;
 	battle->attr_fix = battle_attr_fix;
 	battle->calc_cardfix = battle_calc_cardfix;
+	battle->calc_cardfix_rate = battle_calc_cardfix_rate;
+	battle->cardfix_cache_clear = battle_cardfix_cache_clear;
 	battle->calc_cardfix2 = battle_calc_cardfix2;
 	battle->calc_elefix = battle_calc_elefix;
 	battle->calc_masteryfix = battle_calc_masteryfix;
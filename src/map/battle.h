@@ -48,6 +48,8 @@ struct status_data;
 
 #define is_boss(bl)     ((status_get_mode(bl) & MD_BOSS) != 0x0) // Can refine later [Aru]
 
+#define BATTLE_CARDFIX_CACHE_SIZE 4096 ///< Entries of battle->cardfix_cache (power of 2)
+
 /**
  * Enumerations
  **/
@@ -684,6 +686,33 @@ struct delay_damage {
 	enum bl_type src_type;
 };
 
+/**
+ * Card fix rate of an attacker against a target, as computed by
+ * battle->calc_cardfix_rate. It stays valid while the status version of both
+ * units (status_change::version) is unchanged.
+ */
+struct battle_cardfix_entry {
+	int src_id;
+	int target_id;
+	unsigned int src_version;
+	unsigned int target_version;
+	int attack_type;
+	int nk;
+	int s_ele;
+	int s_ele_;
+	int cflag;
+	int wflag;
+	int state;   ///< Other inputs of the rate (arrow attack, left_cardfix_to_right)
+	int rate;    ///< Damage rate, 1000 = 100%
+};
+
+/// Card fix rates recently used in the damage calculations, indexed by a hash of their inputs.
+struct battle_cardfix_cache {
+	struct battle_cardfix_entry entry[BATTLE_CARDFIX_CACHE_SIZE];
+	uint64 hits;
+	uint64 misses;
+};
+
 /**
  * Battle.c Interface
  **/
@@ -693,6 +722,7 @@ struct battle_interface {
 	/* elemental damage rate. [Defending Element Level][Attacking Element][Defending Element] */
 	int attr_fix_table[4][ELE_MAX][ELE_MAX];
 	struct eri *delay_damage_ers; //For battle delay damage structures.
+	struct battle_cardfix_cache cardfix_cache;
 	/* init */
 	void (*init) (bool minimal);
 	/* final */
@@ -729,6 +759,9 @@ struct battle_interface {
 	int64 (*attr_fix) (struct block_list *src, struct block_list *target, int64 damage, int atk_elem, int def_type, int def_lv);
 	/* applies card modifiers */
 	int64 (*calc_cardfix) (int attack_type, struct block_list *src, struct block_list *target, int nk, int s_ele, int s_ele_, int64 damage, int left, int flag);
+	/* card modifiers rate (1000 = 100%), without the cache */
+	int (*calc_cardfix_rate) (int attack_type, struct block_list *src, struct block_list *target, int nk, int s_ele, int s_ele_, int left, int flag);
+	void (*cardfix_cache_clear) (void);
 	int64 (*calc_cardfix2) (struct block_list *src, struct block_list *bl, int64 damage, int s_ele, int nk, int flag);
 	/* applies element modifiers */
 	int64 (*calc_elefix) (struct block_list *src, struct block_list *target, uint16 skill_id, uint16 skill_lv, int64 damage, int nk, int n_ele, int s_ele, int s_ele_, bool left, int flag);
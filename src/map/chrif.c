@@ -41,7 +41,9 @@
 #include "map/storage.h"
 #include "common/HPM.h"
 #include "common/cbasetypes.h"
+#include "common/charmappackets.h"
 #include "common/ers.h"
+#include "common/grfio.h"
 #include "common/mapcharpackets.h"
 #include "common/memmgr.h"
 #include "common/msgtable.h"
@@ -275,14 +277,9 @@ static bool chrif_save(struct map_session_data *sd, int flag)
 	if (sd->vars_dirty)
 		intif->saveregistry(sd);
 
-	WFIFOHEAD(chrif->fd, sizeof(sd->status) + 13);
-	WFIFOW(chrif->fd,0) = 0x2b01;
-	WFIFOW(chrif->fd,2) = sizeof(sd->status) + 13;
-	WFIFOL(chrif->fd,4) = sd->status.account_id;
-	WFIFOL(chrif->fd,8) = sd->status.char_id;
-	WFIFOB(chrif->fd,12) = (flag==1)?1:0; //Flag to tell char-server this character is quitting.
-	memcpy(WFIFOP(chrif->fd,13), &sd->status, sizeof(sd->status));
-	WFIFOSET(chrif->fd, WFIFOW(chrif->fd,2));
+	chrif->save_send(sd, flag);
+	sd->save_dirty = 0;
+	sd->last_save_tick = timer->gettick();
 
 	if( sd->status.pet_id > 0 && sd->pd )
 		intif->save_petdata(sd->status.account_id,&sd->pd->pet);
@@ -306,6 +303,379 @@ static bool chrif_save(struct map_session_data *sd, int flag)
 	return true;
 }
 
+/**
+ * Sends the character data of sd to the char-server.
+ *
+ * When the char-server accepted delta saves, regular saves only carry the
+ * regions changed since the last snapshot sent for this character; a full
+ * snapshot is sent for the first save, every save_full_interval saves and
+ * when the character leaves the map-server.
+ *
+ * @param sd   The character to save.
+ * @param flag chrif->save flag (enum chrif_save_type).
+ */
+static void chrif_save_send(struct map_session_data *sd, int flag)
+{
+	static uint8 delta_buf[CHRIF_SAVE_DELTA_MAX];
+	static uint8 zip_buf[sizeof(struct mmo_charstatus) + sizeof(struct mmo_charstatus) / 64 + 64];
+	struct chrif_save_stats *stats;
+	struct chrif_save_base *base = NULL;
+	struct PACKET_MAPCHAR_SAVE_DELTA *p;
+	const uint8 *payload = (const uint8 *)&sd->status;
+	int raw_len = (int)sizeof(sd->status);
+	int len;
+	uint8 encoding = 0;
+
+	nullpo_retv(sd);
+	stats = &chrif->save_stats[flag >= 0 && flag < CHRIF_SAVE_TYPE_MAX ? flag : CHRIF_SAVE_REGULAR];
+	stats->saves++;
+	stats->raw_bytes += sizeof(sd->status) + 13;
+
+	if (chrif->save_modes == 0 || chrif->save_bases == NULL) {
+		WFIFOHEAD(chrif->fd, sizeof(sd->status) + 13);
+		WFIFOW(chrif->fd,0) = 0x2b01;
+		WFIFOW(chrif->fd,2) = sizeof(sd->status) + 13;
+		WFIFOL(chrif->fd,4) = sd->status.account_id;
+		WFIFOL(chrif->fd,8) = sd->status.char_id;
+		WFIFOB(chrif->fd,12) = (flag==1)?1:0; //Flag to tell char-server this character is quitting.
+		memcpy(WFIFOP(chrif->fd,13), &sd->status, sizeof(sd->status));
+		WFIFOSET(chrif->fd, WFIFOW(chrif->fd,2));
+		stats->full++;
+		stats->sent_bytes += sizeof(sd->status) + 13;
+		return;
+	}
+
+	base = idb_get(chrif->save_bases, sd->status.char_id);
+	if (base != NULL && flag == CHRIF_SAVE_REGULAR && (chrif->save_modes & CHRIF_SAVE_DELTA) != 0 && base->deltas < chrif->save_full_interval) {
+		int delta_len = chrif->save_delta_encode(&base->status, &sd->status, delta_buf, sizeof(delta_buf));
+		if (delta_len == 0) {
+			stats->skipped++;
+			return;
+		}
+		if (delta_len > 0) {
+			payload = delta_buf;
+			raw_len = delta_len;
+			encoding |= CHRIF_SAVE_DELTA;
+		}
+	}
+
+	len = raw_len;
+	if ((chrif->save_modes & CHRIF_SAVE_ZLIB) != 0 && raw_len >= CHRIF_SAVE_COMPRESS_MIN) {
+		unsigned long zip_len = sizeof(zip_buf);
+		if (grfio->encode_zip(zip_buf, &zip_len, payload, raw_len) == 0 && (int)zip_len < raw_len) {
+			payload = zip_buf;
+			len = (int)zip_len;
+			encoding |= CHRIF_SAVE_ZLIB;
+		}
+	}
+
+	WFIFOHEAD(chrif->fd, sizeof(*p) + len);
+	p = WFIFOP(chrif->fd, 0);
+	p->packetType = HEADER_MAPCHAR_SAVE_DELTA;
+	p->packetLength = (uint16)(sizeof(*p) + len);
+	p->account_id = sd->status.account_id;
+	p->char_id = sd->status.char_id;
+	p->flag = (flag == CHRIF_SAVE_QUIT) ? 1 : 0;
+	p->encoding = encoding;
+	p->seq = base != NULL ? base->seq + 1 : 1;
+	p->base_seq = base != NULL ? base->seq : 0;
+	p->raw_len = (uint16)raw_len;
+	memcpy(p->data, payload, len);
+	WFIFOSET(chrif->fd, p->packetLength);
+
+	if ((encoding & CHRIF_SAVE_DELTA) != 0)
+		stats->delta++;
+	else
+		stats->full++;
+	if ((encoding & CHRIF_SAVE_ZLIB) != 0)
+		stats->compressed++;
+	stats->sent_bytes += sizeof(*p) + len;
+
+	if (flag != CHRIF_SAVE_REGULAR) {
+		// the character leaves this map-server, the char-server drops its base too
+		idb_remove(chrif->save_bases, sd->status.char_id);
+		return;
+	}
+	if (base == NULL) {
+		CREATE(base, struct chrif_save_base, 1);
+		idb_put(chrif->save_bases, sd->status.char_id, base);
+	}
+	base->seq++;
+	base->deltas = (encoding & CHRIF_SAVE_DELTA) != 0 ? base->deltas + 1 : 0;
+	memcpy(&base->status, &sd->status, sizeof(base->status));
+}
+
+/**
+ * Encodes the differences between two snapshots of a character as runs of
+ * (W offset, W length, data).
+ *
+ * @param base     The snapshot known to the char-server.
+ * @param cur      The current data.
+ * @param out      Buffer that receives the runs.
+ * @param out_size Size of out.
+ * @return the length of the encoded data (0 if nothing changed), -1 if it doesn't fit in out.
+ */
+static int chrif_save_delta_encode(const struct mmo_charstatus *base, const struct mmo_charstatus *cur, uint8 *out, int out_size)
+{
+	const uint8 *a = (const uint8 *)base;
+	const uint8 *b = (const uint8 *)cur;
+	const int size = (int)sizeof(*cur);
+	int pos = 0, len = 0;
+
+	nullpo_retr(-1, base);
+	nullpo_retr(-1, cur);
+	nullpo_retr(-1, out);
+
+	while (pos < size) {
+		int start, end;
+
+		// skip unchanged words
+		while (pos + 8 <= size && memcmp(a + pos, b + pos, 8) == 0)
+			pos += 8;
+		while (pos < size && a[pos] == b[pos])
+			pos++;
+		if (pos == size)
+			break;
+
+		start = pos;
+		end = pos + 1;
+		for (pos = end; pos < size && pos - end < CHRIF_SAVE_DELTA_GAP; pos++) {
+			if (a[pos] != b[pos])
+				end = pos + 1;
+		}
+
+		if (len + 4 + (end - start) > out_size)
+			return -1;
+		WBUFW(out, len) = (uint16)start;
+		WBUFW(out, len + 2) = (uint16)(end - start);
+		memcpy(out + len + 4, b + start, end - start);
+		len += 4 + (end - start);
+		pos = end;
+	}
+
+	return len;
+}
+
+/// Asks the char-server for the save encodings enabled in the configuration.
+static void chrif_save_mode_request(int fd)
+{
+	struct PACKET_MAPCHAR_SAVE_MODE_REQ *p;
+	uint8 modes = 0;
+
+	if (chrif->save_delta)
+		modes |= CHRIF_SAVE_DELTA;
+	if (chrif->save_compress)
+		modes |= CHRIF_SAVE_ZLIB;
+	if (modes == 0)
+		return;
+
+	WFIFOHEAD(fd, sizeof(*p));
+	p = WFIFOP(fd, 0);
+	p->packetType = HEADER_MAPCHAR_SAVE_MODE_REQ;
+	p->modes = modes;
+	WFIFOSET(fd, sizeof(*p));
+}
+
+/// The char-server answered chrif->save_mode_request.
+static void chrif_save_mode_ack(int fd)
+{
+	const struct PACKET_CHARMAP_SAVE_MODE_ACK *p = RFIFOP(fd, 0);
+
+	chrif->save_modes = p->modes;
+	if (chrif->save_modes != 0)
+		ShowStatus("Character saves: %s%s%s.\n", (chrif->save_modes & CHRIF_SAVE_DELTA) != 0 ? "delta-encoded" : "full",
+			(chrif->save_modes & CHRIF_SAVE_ZLIB) != 0 ? ", " : "", (chrif->save_modes & CHRIF_SAVE_ZLIB) != 0 ? "zlib-compressed" : "");
+}
+
+/// The char-server couldn't apply a delta, the next save of the character is a full snapshot.
+static void chrif_save_resync(int fd)
+{
+	const struct PACKET_CHARMAP_SAVE_RESYNC *p = RFIFOP(fd, 0);
+	struct map_session_data *sd;
+
+	ShowWarning("chrif_save_resync: Char-server lost the save base of character %d:%d, sending a full snapshot.\n", p->account_id, p->char_id);
+	idb_remove(chrif->save_bases, p->char_id);
+	if ((sd = map->charid2sd(p->char_id)) != NULL && sd->state.active)
+		chrif->save(sd, 0);
+}
+
+/**
+ * Asks the char-server to move a character to another map-server.
+ * The character was saved and removed from the map right before.
+ *
+ * @param ip   The destination map-server, in host byte order.
+ * @param port The port of the destination map-server, in host byte order.
+ */
+static bool chrif_changemapserver(struct map_session_data *sd, uint32 ip, uint16 port)
+{
+	struct PACKET_MAPCHAR_CHANGE_MAPSERVER_REQ *p;
+
+	nullpo_retr(false, sd);
+	chrif_check(false);
+
+	WFIFOHEAD(chrif->fd, sizeof(*p));
+	p = WFIFOP(chrif->fd, 0);
+	p->packetType = HEADER_MAPCHAR_CHANGE_MAPSERVER_REQ;
+	p->account_id = sd->bl.id;
+	p->login_id1 = sd->login_id1;
+	p->login_id2 = sd->login_id2;
+	p->char_id = sd->status.char_id;
+	p->map_index = sd->mapindex;
+	p->x = sd->bl.x;
+	p->y = sd->bl.y;
+	p->ip = ip;
+	p->port = port;
+	p->sex = sd->status.sex;
+	p->client_addr = htonl(sockt->session[sd->fd] != NULL ? sockt->session[sd->fd]->client_addr : 0);
+	p->group_id = sd->group_id;
+	WFIFOSET(chrif->fd, sizeof(*p));
+	return true;
+}
+
+/// Answer of the char-server to a map-server change, tells the client where to connect.
+static void chrif_changemapserverack(int fd)
+{
+	const struct PACKET_CHARMAP_CHANGE_MAPSERVER_ACK *p = RFIFOP(fd, 0);
+	struct auth_node *node = chrif->auth_check(p->account_id, p->char_id, ST_MAPCHANGE);
+
+	if (node == NULL)
+		return;
+
+	if (p->result != 0 || node->sd == NULL) {
+		ShowError("chrif_changemapserverack: Map-server change failed for %d:%d.\n", p->account_id, p->char_id);
+		clif->authfail_fd(node->sd != NULL ? node->sd->fd : node->fd, 0);
+	} else {
+		clif->changemapserver(node->sd, p->map_index, p->x, p->y, p->ip, p->port, NULL);
+	}
+
+	//Player has been saved already, remove him from memory. [Skotlex]
+	chrif->auth_delete(p->account_id, p->char_id, ST_MAPCHANGE);
+}
+
+/// Receives the map-server owning a list of maps.
+static void chrif_recvmapowners(int fd)
+{
+	const struct PACKET_CHARMAP_MAP_OWNERS *p = RFIFOP(fd, 0);
+	int count = (p->packetLength - (int)sizeof(*p)) / (int)sizeof(p->maps[0]);
+
+	for (int i = 0; i < count; i++)
+		map->setipport(p->maps[i], p->ip, p->port);
+}
+
+/// Asks the char-server to move a map to this map-server, which must have it loaded.
+static bool chrif_map_move(int account_id, unsigned short map_index)
+{
+	struct PACKET_MAPCHAR_MAP_MOVE_REQ *p;
+
+	chrif_check(false);
+
+	WFIFOHEAD(chrif->fd, sizeof(*p));
+	p = WFIFOP(chrif->fd, 0);
+	p->packetType = HEADER_MAPCHAR_MAP_MOVE_REQ;
+	p->account_id = account_id;
+	p->map_index = map_index;
+	WFIFOSET(chrif->fd, sizeof(*p));
+	return true;
+}
+
+/// Answer of the char-server to a map move, told to the requesting player.
+static void chrif_map_move_ack(int fd)
+{
+	const struct PACKET_CHARMAP_MAP_MOVE_ACK *p = RFIFOP(fd, 0);
+	struct map_session_data *sd = map->id2sd(p->account_id);
+	const char *name = mapindex_id2name(p->map_index);
+	char output[CHAT_SIZE_MAX];
+
+	switch (p->result) {
+		case CHRIF_MAP_MOVE_OK:
+			ShowStatus("chrif_map_move_ack: Map '%s' is now owned by this map-server.\n", name);
+			snprintf(output, sizeof(output), "Map '%s' moved to this map-server.", name);
+			break;
+		case CHRIF_MAP_MOVE_NOT_LOADED:
+			snprintf(output, sizeof(output), "Map '%s' is not loaded by this map-server.", name);
+			break;
+		case CHRIF_MAP_MOVE_ALREADY:
+			snprintf(output, sizeof(output), "Map '%s' is already hosted by this map-server.", name);
+			break;
+		default:
+			snprintf(output, sizeof(output), "Unknown map.");
+			break;
+	}
+	if (sd != NULL)
+		clif->message(sd->fd, output);
+}
+
+/**
+ * Sends records of the state of a map that moved from this map-server, for
+ * the char-server to relay them to the new owner.
+ *
+ * @param ip        Address of the new owner, in host byte order.
+ * @param port      Port of the new owner, in host byte order.
+ * @param map_index The map index.
+ * @param type      enum chrif_map_state_type of the records.
+ * @param data      The records.
+ * @param count     Number of records.
+ * @param len       Length of the records.
+ */
+static bool chrif_map_state(uint32 ip, uint16 port, unsigned short map_index, uint8 type, const void *data, int count, int len)
+{
+	struct PACKET_MAPCHAR_MAP_STATE *p;
+	int plen = (int)sizeof(*p) + len;
+
+	chrif_check(false);
+	Assert_retr(false, len >= 0 && plen <= UINT16_MAX && count >= 0 && count <= UINT16_MAX);
+
+	WFIFOHEAD(chrif->fd, plen);
+	p = WFIFOP(chrif->fd, 0);
+	p->packetType = HEADER_MAPCHAR_MAP_STATE;
+	p->packetLength = plen;
+	p->ip = ip;
+	p->port = port;
+	p->map_index = map_index;
+	p->type = type;
+	p->count = count;
+	if (len > 0)
+		memcpy(p->data, data, len);
+	WFIFOSET(chrif->fd, plen);
+	return true;
+}
+
+/// Receives records of the state of a map that moved to this map-server.
+static void chrif_recv_map_state(int fd)
+{
+	const struct PACKET_CHARMAP_MAP_STATE *p = RFIFOP(fd, 0);
+
+	map->state_recv(p->map_index, p->type, p->data, p->count, p->packetLength - (int)sizeof(*p));
+}
+
+static void chrif_save_report(void)
+{
+	static const char *names[CHRIF_SAVE_TYPE_MAX] = { "regular", "quit", "map-server change" };
+
+	for (int i = 0; i < CHRIF_SAVE_TYPE_MAX; i++) {
+		const struct chrif_save_stats *stats = &chrif->save_stats[i];
+
+		if (stats->saves == 0)
+			continue;
+		ShowInfo("Character saves (%s): %u saves, %u full, %u delta, %u unchanged, %u compressed, %"PRIu64" bytes sent of %"PRIu64" (%"PRIu64" saved).\n",
+			names[i], stats->saves, stats->full, stats->delta, stats->skipped, stats->compressed,
+			stats->sent_bytes, stats->raw_bytes, stats->raw_bytes - stats->sent_bytes);
+	}
+}
+
+static int chrif_save_report_timer(int tid, int64 tick, int id, intptr_t data)
+{
+	static unsigned int reported = 0;
+	unsigned int saves = 0;
+
+	for (int i = 0; i < CHRIF_SAVE_TYPE_MAX; i++)
+		saves += chrif->save_stats[i].saves;
+	if (saves != reported)
+		chrif->save_report();
+	reported = saves;
+	return 0;
+}
+
 // connects to char-server (plaintext)
 static void chrif_connect(int fd)
 {
@@ -359,6 +729,11 @@ static void chrif_connectack(int fd)
 	chrif->state = 1;
 	chrif->connected = 1;
 
+	// the char-server starts without save bases
+	chrif->save_modes = 0;
+	db_clear(chrif->save_bases);
+	chrif->save_mode_request(fd);
+
 	chrif->sendmap(fd);
 
 	ShowStatus("Event '"CL_WHITE"OnInterIfInit"CL_RESET"' executed with '"CL_WHITE"%d"CL_RESET"' NPCs.\n", npc->event_doall("OnInterIfInit"));
@@ -392,13 +767,19 @@ static int chrif_reconnect(union DBKey key, struct DBData *data, va_list ap)
 			//Re-send final save
 			chrif->save(node->sd, 1);
 			break;
-		case ST_MAPCHANGE:
-			//Re-send map-change request.
-
-			// TODO: Remove this branch
-			// Multi-zone is not supported
-			clif->authfail_fd(node->sd->fd, 3); // timeout
+		case ST_MAPCHANGE: { //Re-send map-change request.
+			uint32 ip;
+			uint16 port;
+
+			if (node->sd != NULL && map->mapindex2ipport(node->sd->mapindex, &ip, &port)) {
+				chrif->changemapserver(node->sd, ip, port);
+			} else {
+				if (node->sd != NULL)
+					clif->authfail_fd(node->sd->fd, 3); // timeout
+				chrif->auth_delete(node->account_id, node->char_id, ST_MAPCHANGE);
+			}
 			break;
+		}
 	}
 	return 0;
 }
@@ -1094,11 +1475,9 @@ static bool chrif_save_scdata(struct map_session_data *sd)
 	WFIFOL(chrif->fd,4) = sd->status.account_id;
 	WFIFOL(chrif->fd,8) = sd->status.char_id;
 
-	for (i = 0; i < SC_MAX; i++) {
-		if (!sc->data[i])
-			continue;
-		if (sc->data[i]->timer != INVALID_TIMER) {
-			td = timer->get(sc->data[i]->timer);
+	STATUS_CHANGE_ITER(sc, i) {
+		if (SC_ENTRY(sc, i)->timer != INVALID_TIMER) {
+			td = timer->get(SC_ENTRY(sc, i)->timer);
 			if (td == NULL || td->func != status->change_timer)
 				continue;
 			if (DIFF_TICK32(td->tick,tick) > 0)
@@ -1108,12 +1487,12 @@ static bool chrif_save_scdata(struct map_session_data *sd)
 		} else {
 			data.tick = INFINITE_DURATION;
 		}
-		data.total_tick = sc->data[i]->total_tick;
+		data.total_tick = SC_ENTRY(sc, i)->total_tick;
 		data.type = i;
-		data.val1 = sc->data[i]->val1;
-		data.val2 = sc->data[i]->val2;
-		data.val3 = sc->data[i]->val3;
-		data.val4 = sc->data[i]->val4;
+		data.val1 = SC_ENTRY(sc, i)->val1;
+		data.val2 = SC_ENTRY(sc, i)->val2;
+		data.val3 = SC_ENTRY(sc, i)->val3;
+		data.val4 = SC_ENTRY(sc, i)->val4;
 		memcpy(WFIFOP(chrif->fd,14 +count*sizeof(struct status_change_data)),
 			&data, sizeof(struct status_change_data));
 		count++;
@@ -1249,6 +1628,9 @@ static void chrif_on_disconnect(void)
 	if( chrif->connected != 1 )
 		ShowWarning("Connection to Char Server lost.\n\n");
 	chrif->connected = 0;
+	chrif->save_modes = 0;
+	db_clear(chrif->save_bases);
+	// the map owners are kept, standby maps must not run here while another map-server may still host them
 
 	//Attempt to reconnect in a second. [Skotlex]
 	timer->add(timer->gettick() + 1000, chrif->check_connect_char_server, 0, 0);
@@ -1396,6 +1778,12 @@ static int chrif_parse(int fd)
 			case 0x2b24: chrif->keepalive_ack(fd); break;
 			case 0x2b25: chrif->deadopt(RFIFOL(fd,2), RFIFOL(fd,6), RFIFOL(fd,10)); break;
 			case 0x2b27: chrif->authfail(fd); break;
+			case HEADER_CHARMAP_SAVE_MODE_ACK: chrif->save_mode_ack(fd); break;
+			case HEADER_CHARMAP_SAVE_RESYNC: chrif->save_resync(fd); break;
+			case HEADER_CHARMAP_MAP_OWNERS: chrif->recvmapowners(fd); break;
+			case HEADER_CHARMAP_CHANGE_MAPSERVER_ACK: chrif->changemapserverack(fd); break;
+			case HEADER_CHARMAP_MAP_MOVE_ACK: chrif->map_move_ack(fd); break;
+			case HEADER_CHARMAP_MAP_STATE: chrif->recv_map_state(fd); break;
 			default:
 				ShowError("chrif_parse : unknown packet (session #%d): 0x%x. Disconnecting.\n", fd, (unsigned int)cmd);
 				sockt->eof(fd);
@@ -1581,6 +1969,10 @@ static void do_final_chrif(void)
 	chrif->auth_db->destroy(chrif->auth_db, chrif->auth_db_final);
 
 	ers_destroy(chrif->auth_db_ers);
+
+	chrif->save_report();
+	db_destroy(chrif->save_bases);
+	chrif->save_bases = NULL;
 }
 
 /*==========================================
@@ -1593,10 +1985,12 @@ static void do_init_chrif(bool minimal)
 
 	chrif->auth_db = idb_alloc(DB_OPT_BASE);
 	chrif->auth_db_ers = ers_new(sizeof(struct auth_node),"chrif.c::auth_db_ers",ERS_OPT_NONE);
+	chrif->save_bases = idb_alloc(DB_OPT_RELEASE_DATA);
 
 	timer->add_func_list(chrif->check_connect_char_server, "check_connect_char_server");
 	timer->add_func_list(chrif->auth_db_cleanup, "auth_db_cleanup");
 	timer->add_func_list(chrif->send_usercount_tochar, "send_usercount_tochar");
+	timer->add_func_list(chrif->save_report_timer, "chrif->save_report_timer");
 
 	// establish map-char connection if not present
 	timer->add_interval(timer->gettick() + 1000, chrif->check_connect_char_server, 0, 0, 10 * 1000);
@@ -1606,6 +2000,9 @@ static void do_init_chrif(bool minimal)
 
 	// send the user count every 10 seconds, to hide the charserver's online counting problem
 	timer->add_interval(timer->gettick() + 1000, chrif->send_usercount_tochar, 0, 0, UPDATE_INTERVAL);
+
+	// report the save link counters
+	timer->add_interval(timer->gettick() + CHRIF_SAVE_REPORT_INTERVAL, chrif->save_report_timer, 0, 0, CHRIF_SAVE_REPORT_INTERVAL);
 }
 
 /*=====================================
@@ -1628,6 +2025,12 @@ void chrif_defaults(void)
 	memset(chrif->userid,0,sizeof(chrif->userid));
 	memset(chrif->passwd,0,sizeof(chrif->passwd));
 	chrif->state = 0;
+	chrif->save_bases = NULL;
+	chrif->save_modes = 0;
+	chrif->save_delta = true;
+	chrif->save_compress = true;
+	chrif->save_full_interval = 20;
+	memset(chrif->save_stats, 0, sizeof(chrif->save_stats));
 
 	/* */
 	chrif->auth_db = NULL;
@@ -1709,4 +2112,19 @@ void chrif_defaults(void)
 	chrif->parse = chrif_parse;
 	chrif->save_scdata_single = chrif_save_scdata_single;
 	chrif->del_scdata_single = chrif_del_scdata_single;
+
+	chrif->save_send = chrif_save_send;
+	chrif->save_delta_encode = chrif_save_delta_encode;
+	chrif->save_mode_request = chrif_save_mode_request;
+	chrif->save_mode_ack = chrif_save_mode_ack;
+	chrif->save_resync = chrif_save_resync;
+	chrif->changemapserver = chrif_changemapserver;
+	chrif->changemapserverack = chrif_changemapserverack;
+	chrif->recvmapowners = chrif_recvmapowners;
+	chrif->map_move = chrif_map_move;
+	chrif->map_move_ack = chrif_map_move_ack;
+	chrif->map_state = chrif_map_state;
+	chrif->recv_map_state = chrif_recv_map_state;
+	chrif->save_report = chrif_save_report;
+	chrif->save_report_timer = chrif_save_report_timer;
 }
@@ -36,12 +36,28 @@ struct status_change_entry;
 #define CHECK_INTERVAL 3600000
 //Interval at which map server sends number of connected users. [Skotlex]
 #define UPDATE_INTERVAL 10000
+//Delta saves larger than this fraction of struct mmo_charstatus are sent as full snapshots.
+#define CHRIF_SAVE_DELTA_MAX (sizeof(struct mmo_charstatus) / 2)
+//Unchanged bytes merged into a delta run instead of starting a new one (a run header is 4 bytes).
+#define CHRIF_SAVE_DELTA_GAP 8
+//Payloads smaller than this are not compressed.
+#define CHRIF_SAVE_COMPRESS_MIN 256
+//Interval at which the save link counters are reported.
+#define CHRIF_SAVE_REPORT_INTERVAL 600000
 
 /**
  * Enumerations
  **/
 enum sd_state { ST_LOGIN, ST_LOGOUT, ST_MAPCHANGE };
 
+/// chrif->save flag values, used to split the save link counters.
+enum chrif_save_type {
+	CHRIF_SAVE_REGULAR,   ///< Autosave, trade, storage...
+	CHRIF_SAVE_QUIT,      ///< Character is quitting
+	CHRIF_SAVE_MAPSERVER, ///< Character is changing map-servers
+	CHRIF_SAVE_TYPE_MAX
+};
+
 /**
  * Structures
  **/
@@ -54,6 +70,24 @@ struct auth_node {
 	enum sd_state state;             //To track whether player was login in/out or changing maps.
 };
 
+/// Last snapshot of a character sent to the char-server, base of its next delta save.
+struct chrif_save_base {
+	uint32 seq;
+	int deltas;                    ///< Delta saves since the last full snapshot
+	struct mmo_charstatus status;
+};
+
+/// Save link counters of one enum chrif_save_type.
+struct chrif_save_stats {
+	unsigned int saves;
+	unsigned int full;             ///< Sent as full snapshots
+	unsigned int delta;            ///< Sent as deltas
+	unsigned int skipped;          ///< Not sent, nothing changed since the previous save
+	unsigned int compressed;
+	uint64 raw_bytes;              ///< Bytes a full uncompressed save would have used
+	uint64 sent_bytes;
+};
+
 #define chrif_char_offline(x) chrif->char_offline_nsd((x)->status.account_id,(x)->status.char_id)
 
 /*=====================================
@@ -78,6 +112,13 @@ struct chrif_interface {
 	uint16 port;
 	char userid[NAME_LENGTH], passwd[NAME_LENGTH];
 	int state;
+	/* save link */
+	struct DBMap *save_bases; // int char_id -> struct chrif_save_base*
+	uint8 save_modes;         ///< enum chrif_save_mode accepted by the char-server
+	bool save_delta;          ///< Request delta-encoded saves
+	bool save_compress;       ///< Request zlib-compressed saves
+	int save_full_interval;   ///< Delta saves between two full snapshots of a character
+	struct chrif_save_stats save_stats[CHRIF_SAVE_TYPE_MAX];
 	/* */
 	void (*init) (bool minimal);
 	void (*final) (void);
@@ -155,6 +196,21 @@ struct chrif_interface {
 	int (*parse) (int fd);
 	void (*save_scdata_single) (int account_id, int char_id, short type, struct status_change_entry *sce);
 	void (*del_scdata_single) (int account_id, int char_id, short type);
+
+	void (*save_send) (struct map_session_data *sd, int flag);
+	int (*save_delta_encode) (const struct mmo_charstatus *base, const struct mmo_charstatus *cur, uint8 *out, int out_size);
+	void (*save_mode_request) (int fd);
+	void (*save_mode_ack) (int fd);
+	void (*save_resync) (int fd);
+	bool (*changemapserver) (struct map_session_data *sd, uint32 ip, uint16 port);
+	void (*changemapserverack) (int fd);
+	void (*recvmapowners) (int fd);
+	bool (*map_move) (int account_id, unsigned short map_index);
+	void (*map_move_ack) (int fd);
+	bool (*map_state) (uint32 ip, uint16 port, unsigned short map_index, uint8 type, const void *data, int count, int len);
+	void (*recv_map_state) (int fd);
+	void (*save_report) (void);
+	int (*save_report_timer) (int tid, int64 tick, int id, intptr_t data);
 };
 
 #ifdef HERCULES_CORE
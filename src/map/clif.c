@@ -93,6 +93,7 @@ static struct clif_interface clif_s;
 struct clif_interface *clif;
 
 static struct s_packet_db packet_db[MAX_PACKET_DB + 1];
+static struct s_packet_dispatch packet_dispatch[MAX_PACKET_DB + 1];
 
 /* re-usable */
 static struct packet_itemlist_normal itemlist_normal;
@@ -403,9 +404,10 @@ static int clif_send_sub(struct block_list *bl, va_list ap)
 	}
 
 	/* unless visible, hold it here */
-	if( clif->ally_only && !sd->sc.data[SC_CLAIRVOYANCE] && !sd->special_state.intravision && battle->check_target( src_bl, &sd->bl, BCT_ENEMY ) > 0 )
+	if( clif->ally_only && !SC_ENTRY(&sd->sc, SC_CLAIRVOYANCE) && !sd->special_state.intravision && battle->check_target( src_bl, &sd->bl, BCT_ENEMY ) > 0 )
 		return 0;
 
+	map->list[sd->bl.m].stats.count[MAP_STATS_BYTES_SENT] += len;
 	return clif->send_actual(fd, buf, len);
 }
 
@@ -492,11 +494,15 @@ static bool clif_send(const void *buf, int len, struct block_list *bl, enum send
 			else
 				area_size = AREA_SIZE;
 			nullpo_retr(true, bl);
+			if (bl->m >= 0)
+				map->list[bl->m].stats.count[MAP_STATS_AREA_PACKETS]++;
 			map->foreachinarea(clif->send_sub, bl->m, bl->x - area_size, bl->y - area_size, bl->x + area_size, bl->y + area_size,
 				BL_PC, buf, len, bl, type);
 			break;
 		case AREA_CHAT_WOC:
 			nullpo_retr(true, bl);
+			if (bl->m >= 0)
+				map->list[bl->m].stats.count[MAP_STATS_AREA_PACKETS]++;
 			map->foreachinarea(clif->send_sub, bl->m, bl->x-CHAT_AREA_SIZE, bl->y-CHAT_AREA_SIZE,
 			                   bl->x+CHAT_AREA_SIZE, bl->y+CHAT_AREA_SIZE, BL_PC, buf, len, bl, AREA_WOC);
 			break;
@@ -1624,11 +1630,11 @@ static bool clif_spawn(struct block_list *bl)
 				for (i = 0; i < sd->sc_display_count; i++) {
 					enum sc_type type = sd->sc_display[i]->type;
 
-					if (sc->data[type] == NULL)
+					if (SC_ENTRY(sc, type) == NULL)
 						continue;
 
 					int tick = 0;
-					int tid = sc->data[type]->timer;
+					int tid = SC_ENTRY(sc, type)->timer;
 					const struct TimerData *td = (tid > 0) ? timer->get(tid) : NULL;
 
 					if (td != NULL)
@@ -4984,7 +4990,7 @@ static void clif_getareachar_pc(struct map_session_data *sd, struct map_session_
 	ARR_FIND( 0, MAX_PC_DEVOTION, i, dstsd->devotion[i] > 0 );
 	if( i < MAX_PC_DEVOTION ) clif->devotion(&dstsd->bl, sd);
 	// display link (dstsd - crusader) to sd
-	if( dstsd->sc.data[SC_DEVOTION] && (d_bl = map->id2bl(dstsd->sc.data[SC_DEVOTION]->val1)) != NULL )
+	if( SC_ENTRY(&dstsd->sc, SC_DEVOTION) && (d_bl = map->id2bl(SC_ENTRY(&dstsd->sc, SC_DEVOTION)->val1)) != NULL )
 		clif->devotion(d_bl, sd);
 }
 
@@ -5141,9 +5147,9 @@ static int clif_damage(struct block_list *src, struct block_list *dst, int sdela
 
 	sc = status->get_sc(dst);
 
-	if(sc && sc->count && sc->data[SC_ILLUSION]) {
-		if(in_damage) in_damage = in_damage*(sc->data[SC_ILLUSION]->val2) + rnd()%100;
-		if(in_damage2) in_damage2 = in_damage2*(sc->data[SC_ILLUSION]->val2) + rnd()%100;
+	if(sc && sc->count && SC_ENTRY(sc, SC_ILLUSION)) {
+		if(in_damage) in_damage = in_damage*(SC_ENTRY(sc, SC_ILLUSION)->val2) + rnd()%100;
+		if(in_damage2) in_damage2 = in_damage2*(SC_ENTRY(sc, SC_ILLUSION)->val2) + rnd()%100;
 	}
 
 #if PACKETVER < 20071113
@@ -5941,8 +5947,8 @@ static int clif_skill_damage(struct block_list *src, struct block_list *dst, int
 
 	const struct status_change *sc = status->get_sc(dst);
 	if (sc != NULL && sc->count) {
-		if (sc->data[SC_ILLUSION] != NULL && damage != 0)
-			damage = damage * (sc->data[SC_ILLUSION]->val2) + rnd() % 100;
+		if (SC_ENTRY(sc, SC_ILLUSION) != NULL && damage != 0)
+			damage = damage * (SC_ENTRY(sc, SC_ILLUSION)->val2) + rnd() % 100;
 	}
 
 	struct PACKET_ZC_NOTIFY_SKILL p = { 0 };
@@ -5996,8 +6002,8 @@ static int clif_skill_damage2(struct block_list *src, struct block_list *dst, in
 
 	const struct status_change *sc = status->get_sc(dst);
 	if (sc != NULL && sc->count) {
-		if (sc->data[SC_ILLUSION] != NULL && damage != 0)
-			damage = damage * (sc->data[SC_ILLUSION]->val2) + rnd() % 100;
+		if (SC_ENTRY(sc, SC_ILLUSION) != NULL && damage != 0)
+			damage = damage * (SC_ENTRY(sc, SC_ILLUSION)->val2) + rnd() % 100;
 	}
 
 	struct PACKET_ZC_NOTIFY_SKILL_POSITION p = { 0 };
@@ -11321,6 +11327,8 @@ static void clif_parse_LoadEndAck(int fd, struct map_session_data *sd)
 	sd->state.callshop = 0; // Reset the callshop flag if the character changes map.
 	map->addblock(&sd->bl); // Add the character to the map.
 	clif->spawn(&sd->bl); // Spawn character client side.
+	if (VECTOR_LENGTH(map->list[sd->bl.m].migration.units) > 0)
+		map->state_units_load(sd); // Ground skills it had before the map moved to this map-server.
 
 	clif->load_end_ack_sub_messages(sd, (sd->state.connect_new != 0), (sd->state.changemap != 0));
 
@@ -11588,7 +11596,7 @@ static void clif_parse_LoadEndAck(int fd, struct map_session_data *sd)
 	if (sd->sc.opt2 != 0) // Client loses these on warp.
 		clif->changeoption(&sd->bl);
 
-	if ((sd->sc.data[SC_MONSTER_TRANSFORM] != NULL || sd->sc.data[SC_ACTIVE_MONSTER_TRANSFORM] != NULL)
+	if ((SC_ENTRY(&sd->sc, SC_MONSTER_TRANSFORM) != NULL || SC_ENTRY(&sd->sc, SC_ACTIVE_MONSTER_TRANSFORM) != NULL)
 	    && battle_config.mon_trans_disable_in_gvg != 0
 	    && map_flag_gvg2(sd->bl.m)) {
 		status_change_end(&sd->bl, SC_MONSTER_TRANSFORM, INVALID_TIMER);
@@ -11863,7 +11871,7 @@ static void clif_parse_WalkToXY(int fd, struct map_session_data *sd)
 	else if (pc_cant_act_except_npc(sd) || (sd->npc_id != 0 && sd->state.using_megaphone == 0) || pc_isvending(sd))
 		return;
 
-	if(sd->sc.data[SC_RUN] || sd->sc.data[SC_WUGDASH])
+	if(SC_ENTRY(&sd->sc, SC_RUN) || SC_ENTRY(&sd->sc, SC_WUGDASH))
 		return;
 
 	RFIFOPOS(fd, packet_db[RFIFOW(fd, 0)].pos[0], &x, &y, NULL);
@@ -11909,13 +11917,13 @@ static void clif_parse_QuitGame(int fd, struct map_session_data *sd) __attribute
 static void clif_parse_QuitGame(int fd, struct map_session_data *sd)
 {
 	/* Rovert's prevent logout option fixed [Valaris] */
-	if (!sd->sc.data[SC_CLOAKING]
-		&& !sd->sc.data[SC_HIDING]
-		&& !sd->sc.data[SC_CHASEWALK]
-		&& !sd->sc.data[SC_CLOAKINGEXCEED]
-		&& !sd->sc.data[SC__INVISIBILITY]
-		&& !sd->sc.data[SC_SUHIDE]
-		&& !sd->sc.data[SC_NEWMOON]
+	if (!SC_ENTRY(&sd->sc, SC_CLOAKING)
+		&& !SC_ENTRY(&sd->sc, SC_HIDING)
+		&& !SC_ENTRY(&sd->sc, SC_CHASEWALK)
+		&& !SC_ENTRY(&sd->sc, SC_CLOAKINGEXCEED)
+		&& !SC_ENTRY(&sd->sc, SC__INVISIBILITY)
+		&& !SC_ENTRY(&sd->sc, SC_SUHIDE)
+		&& !SC_ENTRY(&sd->sc, SC_NEWMOON)
 		&& (!battle_config.prevent_logout || DIFF_TICK(timer->gettick(), sd->canlog_tick) > battle_config.prevent_logout)
 	) {
 		clif->disconnect_ack(sd, 0);
@@ -12208,12 +12216,12 @@ static void clif_parse_ActionRequest_sub(struct map_session_data *sd, enum actio
 	// Statuses that don't let the player sit / attack / talk with NPCs(targeted)
 	// (not all are included in pc_can_attack)
 	if (sd->sc.count && (
-		sd->sc.data[SC_TRICKDEAD] ||
-		(sd->sc.data[SC_AUTOCOUNTER] && action_type != ACT_ATTACK_REPEAT) ||
-		sd->sc.data[SC_BLADESTOP] ||
-		sd->sc.data[SC_DEEP_SLEEP] ||
-		sd->sc.data[SC_SUHIDE] ||
-		sd->sc.data[SC_GRAVITYCONTROL])
+		SC_ENTRY(&sd->sc, SC_TRICKDEAD) ||
+		(SC_ENTRY(&sd->sc, SC_AUTOCOUNTER) && action_type != ACT_ATTACK_REPEAT) ||
+		SC_ENTRY(&sd->sc, SC_BLADESTOP) ||
+		SC_ENTRY(&sd->sc, SC_DEEP_SLEEP) ||
+		SC_ENTRY(&sd->sc, SC_SUHIDE) ||
+		SC_ENTRY(&sd->sc, SC_GRAVITYCONTROL))
 		)
 		return;
 
@@ -12262,7 +12270,7 @@ static void clif_parse_ActionRequest_sub(struct map_session_data *sd, enum actio
 				break;
 			}
 
-			if (sd->sc.data[SC_SITDOWN_FORCE] || sd->sc.data[SC_BANANA_BOMB_SITDOWN_POSTDELAY])
+			if (SC_ENTRY(&sd->sc, SC_SITDOWN_FORCE) || SC_ENTRY(&sd->sc, SC_BANANA_BOMB_SITDOWN_POSTDELAY))
 				return;
 
 			if(pc_issit(sd)) {
@@ -12278,9 +12286,9 @@ static void clif_parse_ActionRequest_sub(struct map_session_data *sd, enum actio
 				break;
 
 			if (sd->sc.count && (
-				sd->sc.data[SC_DANCING] ||
-				sd->sc.data[SC_ANKLESNARE] ||
-				(sd->sc.data[SC_GRAVITATION] && sd->sc.data[SC_GRAVITATION]->val3 == BCT_SELF)
+				SC_ENTRY(&sd->sc, SC_DANCING) ||
+				SC_ENTRY(&sd->sc, SC_ANKLESNARE) ||
+				(SC_ENTRY(&sd->sc, SC_GRAVITATION) && SC_ENTRY(&sd->sc, SC_GRAVITATION)->val3 == BCT_SELF)
 			)) //No sitting during these states either.
 				break;
 
@@ -12292,7 +12300,7 @@ static void clif_parse_ActionRequest_sub(struct map_session_data *sd, enum actio
 		break;
 		case ACT_STAND: // standup
 
-			if (sd->sc.data[SC_SITDOWN_FORCE] || sd->sc.data[SC_BANANA_BOMB_SITDOWN_POSTDELAY])
+			if (SC_ENTRY(&sd->sc, SC_SITDOWN_FORCE) || SC_ENTRY(&sd->sc, SC_BANANA_BOMB_SITDOWN_POSTDELAY))
 				return;
 
 			if (!pc_issit(sd)) {
@@ -12360,13 +12368,13 @@ static void clif_parse_Restart(int fd, struct map_session_data *sd)
 			break;
 		case 0x01:
 			/* Rovert's Prevent logout option - Fixed [Valaris] */
-			if (!sd->sc.data[SC_CLOAKING]
-				&& !sd->sc.data[SC_HIDING]
-				&& !sd->sc.data[SC_CHASEWALK]
-				&& !sd->sc.data[SC_CLOAKINGEXCEED]
-				&& !sd->sc.data[SC__INVISIBILITY]
-				&& !sd->sc.data[SC_SUHIDE]
-				&& !sd->sc.data[SC_NEWMOON]
+			if (!SC_ENTRY(&sd->sc, SC_CLOAKING)
+				&& !SC_ENTRY(&sd->sc, SC_HIDING)
+				&& !SC_ENTRY(&sd->sc, SC_CHASEWALK)
+				&& !SC_ENTRY(&sd->sc, SC_CLOAKINGEXCEED)
+				&& !SC_ENTRY(&sd->sc, SC__INVISIBILITY)
+				&& !SC_ENTRY(&sd->sc, SC_SUHIDE)
+				&& !SC_ENTRY(&sd->sc, SC_NEWMOON)
 				&& (!battle_config.prevent_logout || DIFF_TICK(timer->gettick(), sd->canlog_tick) > battle_config.prevent_logout)
 			) {
 				//Send to char-server for character selection.
@@ -12546,13 +12554,13 @@ static void clif_parse_TakeItem(int fd, struct map_session_data *sd)
 			break;
 
 		if( sd->sc.count && (
-				 sd->sc.data[SC_HIDING] ||
-				 sd->sc.data[SC_CLOAKING] ||
-				 sd->sc.data[SC_TRICKDEAD] ||
-				 sd->sc.data[SC_BLADESTOP] ||
-				 sd->sc.data[SC_CLOAKINGEXCEED] ||
-				 sd->sc.data[SC_SUHIDE] ||
-				 sd->sc.data[SC_NEWMOON] ||
+				 SC_ENTRY(&sd->sc, SC_HIDING) ||
+				 SC_ENTRY(&sd->sc, SC_CLOAKING) ||
+				 SC_ENTRY(&sd->sc, SC_TRICKDEAD) ||
+				 SC_ENTRY(&sd->sc, SC_BLADESTOP) ||
+				 SC_ENTRY(&sd->sc, SC_CLOAKINGEXCEED) ||
+				 SC_ENTRY(&sd->sc, SC_SUHIDE) ||
+				 SC_ENTRY(&sd->sc, SC_NEWMOON) ||
 				 pc_ismuted(&sd->sc, MANNER_NOITEM)
 			) )
 			break;
@@ -12587,8 +12595,8 @@ static void clif_parse_DropItem(int fd, struct map_session_data *sd)
 			break;
 
 		if (sd->sc.count && (
-			sd->sc.data[SC_AUTOCOUNTER] ||
-			sd->sc.data[SC_BLADESTOP] ||
+			SC_ENTRY(&sd->sc, SC_AUTOCOUNTER) ||
+			SC_ENTRY(&sd->sc, SC_BLADESTOP) ||
 			pc_ismuted(&sd->sc, MANNER_NOITEM)
 		))
 			break;
@@ -13287,7 +13295,7 @@ static void clif_parse_RemoveOption(int fd, struct map_session_data *sd)
 		pc->setoption(sd,sd->sc.option&~(OPTION_RIDING|OPTION_FALCON|OPTION_DRAGON|OPTION_MADOGEAR));
 	} else {
 #ifdef NEW_CARTS
-		if (sd->sc.data[SC_PUSH_CART])
+		if (SC_ENTRY(&sd->sc, SC_PUSH_CART))
 			pc->setcart(sd,0);
 #else // not NEW_CARTS
 		pc->setoption(sd,sd->sc.option&~OPTION_CART);
@@ -13323,7 +13331,7 @@ static void clif_parse_reqGearOff(int fd, struct map_session_data *sd)
 		break;
 	case REMOVE_MOUNT_CART:
 		// this packet exists in clients with only new carts [4144]
-		if (sd->sc.data[SC_PUSH_CART])
+		if (SC_ENTRY(&sd->sc, SC_PUSH_CART))
 			pc->setcart(sd, 0);
 		break;
 	case REMOVE_MOUNT_0:
@@ -13470,7 +13478,7 @@ static void clif_parse_UseSkillToPos_homun(struct homun_data *hd, struct map_ses
 		return;
 	}
 
-	if( hd->sc.data[SC_BASILICA] )
+	if( SC_ENTRY(&hd->sc, SC_BASILICA) )
 		return;
 	lv = homun->checkskill(hd, skill_id);
 	if( skill_lv > lv )
@@ -13517,7 +13525,7 @@ static void clif_parse_UseSkillToPos_mercenary(struct mercenary_data *md, struct
 		return;
 	}
 
-	if( md->sc.data[SC_BASILICA] )
+	if( SC_ENTRY(&md->sc, SC_BASILICA) )
 		return;
 	lv = mercenary->checkskill(md, skill_id);
 	if( skill_lv > lv )
@@ -13602,9 +13610,9 @@ static void clif_useSkillToIdReal(int fd, struct map_session_data *sd, int skill
 		// Only for combo skills whose prerequisite induced delay
 		if (battle_config.combo_cache_skill
 			&& !skip_combo_check
-			&& sd->sc.data[SC_COMBOATTACK] != NULL
+			&& SC_ENTRY(&sd->sc, SC_COMBOATTACK) != NULL
 			&& skill->is_combo(skill_id)
-			&& skill->delay_fix(&sd->bl, sd->sc.data[SC_COMBOATTACK]->val1, pc->checkskill(sd, sd->sc.data[SC_COMBOATTACK]->val1)) > 0
+			&& skill->delay_fix(&sd->bl, SC_ENTRY(&sd->sc, SC_COMBOATTACK)->val1, pc->checkskill(sd, SC_ENTRY(&sd->sc, SC_COMBOATTACK)->val1)) > 0
 		) {
 			timer->add(sd->ud.canact_tick, clif->combo_delay_timer, sd->bl.id, (intptr_t)MakeDWord((uint16)skill_id, (uint16)skill_lv));
 			return;
@@ -13619,7 +13627,7 @@ static void clif_useSkillToIdReal(int fd, struct map_session_data *sd, int skill
 	if (sd->sc.option & OPTION_COSTUME && sd->auto_cast_current.type != AUTOCAST_ITEM) // Item skills can be used with costumes
 		return;
 
-	if (sd->sc.data[SC_BASILICA] && (skill_id != HP_BASILICA || sd->sc.data[SC_BASILICA]->val4 != sd->bl.id))
+	if (SC_ENTRY(&sd->sc, SC_BASILICA) && (skill_id != HP_BASILICA || SC_ENTRY(&sd->sc, SC_BASILICA)->val4 != sd->bl.id))
 		return; // On basilica only caster can use Basilica again to stop it.
 
 	if (sd->menuskill_id) {
@@ -13776,7 +13784,7 @@ static void clif_parse_UseSkillToPosSub(int fd, struct map_session_data *sd, uin
 	if( sd->sc.option&OPTION_COSTUME )
 		return;
 
-	if( sd->sc.data[SC_BASILICA] && (skill_id != HP_BASILICA || sd->sc.data[SC_BASILICA]->val4 != sd->bl.id) )
+	if( SC_ENTRY(&sd->sc, SC_BASILICA) && (skill_id != HP_BASILICA || SC_ENTRY(&sd->sc, SC_BASILICA)->val4 != sd->bl.id) )
 		return; // On basilica only caster can use Basilica again to stop it.
 
 	if( sd->menuskill_id ) {
@@ -17631,15 +17639,15 @@ static void clif_parse_AutoRevive(int fd, struct map_session_data *sd)
 	if (!pc_isdead(sd))
 		return;
 
-	if (sd->sc.data[SC_HELLPOWER]) //Cannot res while under the effect of SC_HELLPOWER.
+	if (SC_ENTRY(&sd->sc, SC_HELLPOWER)) //Cannot res while under the effect of SC_HELLPOWER.
 		return;
 
 	int item_position = pc->have_item_chain(sd, ECC_SIEGFRIED);
 	int hpsp = 100;
 
 	if (item_position == INDEX_NOT_FOUND) {
-		if (sd->sc.data[SC_LIGHT_OF_REGENE])
-			hpsp = 20 * sd->sc.data[SC_LIGHT_OF_REGENE]->val1;
+		if (SC_ENTRY(&sd->sc, SC_LIGHT_OF_REGENE))
+			hpsp = 20 * SC_ENTRY(&sd->sc, SC_LIGHT_OF_REGENE)->val1;
 		else
 			return;
 	}
@@ -18872,12 +18880,11 @@ static void clif_bossmapinfo(int fd, struct mob_data *md, enum bossmap_info_type
 		break;
 	case BOSS_INFO_DEAD:
 		if (md != NULL) {
-			const struct TimerData *timer_data = timer->get(md->spawn_timer);
 			unsigned int seconds;
 			int hours;
 			int minutes;
 
-			seconds = (unsigned int)(DIFF_TICK(timer_data->tick, timer->gettick()) / 1000 + 60);
+			seconds = (unsigned int)(DIFF_TICK(md->respawn_tick, timer->gettick()) / 1000 + 60);
 			hours = seconds / (60 * 60);
 			seconds = seconds - (60 * 60 * hours);
 			minutes = seconds / 60;
@@ -22064,8 +22071,8 @@ static int clif_delay_damage(int64 tick, struct block_list *src, struct block_li
 
 	sc = status->get_sc(dst);
 
-	if(sc && sc->count && sc->data[SC_ILLUSION]) {
-		if(in_damage) in_damage = in_damage*(sc->data[SC_ILLUSION]->val2) + rnd()%100;
+	if(sc && sc->count && SC_ENTRY(sc, SC_ILLUSION)) {
+		if(in_damage) in_damage = in_damage*(SC_ENTRY(sc, SC_ILLUSION)->val2) + rnd()%100;
 	}
 
 #if PACKETVER < 20071113
@@ -26300,6 +26307,7 @@ static int clif_parse(int fd)
 {
 	int cmd, packet_len;
 	struct map_session_data *sd;
+	const struct s_packet_dispatch *dispatch;
 	int pnum;
 
 	//TODO apply delays or disconnect based on packet throughput [FlavioJS]
@@ -26354,8 +26362,8 @@ static int clif_parse(int fd)
 				return 0;
 		}
 
-		// filter out invalid / unsupported packets
-		if (cmd > MAX_PACKET_DB || cmd < MIN_PACKET_DB || packets->db[cmd] == 0) {
+		// filter out invalid / unsupported packets (entries below MIN_PACKET_DB are always unsupported)
+		if (cmd > MAX_PACKET_DB || (dispatch = &packet_dispatch[cmd])->len == 0) {
 			ShowWarning("clif_parse: Received unsupported packet (packet 0x%04x (0x%04x), %"PRIuS" bytes received), disconnecting session #%d.\n",
 			            (unsigned int)cmd, RFIFOW(fd,0), RFIFOREST(fd), fd);
 #ifdef DUMP_INVALID_PACKET
@@ -26366,9 +26374,9 @@ static int clif_parse(int fd)
 		}
 
 		// determine real packet length
-		if ((packet_len = packets->db[cmd]) == -1) { // variable-length packet
+		if ((packet_len = dispatch->len) == -1) { // variable-length packet
 
-			if (RFIFOREST(fd) < 4)
+			if ((int)RFIFOREST(fd) < dispatch->min_len)
 				return 0;
 
 			packet_len = RFIFOW(fd,2);
@@ -26385,7 +26393,7 @@ static int clif_parse(int fd)
 
 		if ((int)RFIFOREST(fd) < packet_len) {
 			if (sd == NULL) {
-				if (packet_db[cmd].func != clif->pWantToConnection) {
+				if ((dispatch->flags & PACKET_DISPATCH_NO_SESSION) == 0) {
 					ShowWarning("clif_parse: Received first unsupported packet (packet 0x%04x (0x%04x), %"PRIuS" bytes received), disconnecting session #%d.\n",
 				            (unsigned int)cmd, RFIFOW(fd, 0), RFIFOREST(fd), fd);
 					sockt->eof(fd);
@@ -26406,16 +26414,16 @@ static int clif_parse(int fd)
 			}
 		}
 
-		if( packet_db[cmd].func == clif->pDebug )
-			packet_db[cmd].func(fd, sd);
-		else if( packet_db[cmd].func != NULL ) {
-			if( !sd && packet_db[cmd].func != clif->pWantToConnection )
+		if ((dispatch->flags & PACKET_DISPATCH_ALWAYS) != 0)
+			dispatch->func(fd, sd);
+		else if (dispatch->func != NULL) {
+			if (sd == NULL && (dispatch->flags & PACKET_DISPATCH_NO_SESSION) == 0)
 				; //Only valid packet when there is no session
 			else
-				if( sd && sd->bl.prev == NULL && packet_db[cmd].func != clif->pLoadEndAck )
+				if (sd != NULL && sd->bl.prev == NULL && (dispatch->flags & PACKET_DISPATCH_OFF_MAP) == 0)
 					; //Only valid packet when player is not on a map
 				else
-					packet_db[cmd].func(fd, sd);
+					dispatch->func(fd, sd);
 		}
 		else {
 #ifdef DUMP_UNKNOWN_PACKET
@@ -26469,6 +26477,58 @@ static const struct s_packet_db *clif_packet(int packet_id)
 	return &packet_db[packet_id];
 }
 
+/**
+ * Returns the dispatch entry of the given packet ID.
+ *
+ * @param packet_id The packet ID.
+ * @return The corresponding dispatch entry, if the packet is supported.
+ */
+static const struct s_packet_dispatch *clif_packet_dispatch(int packet_id)
+{
+	if (packet_id < MIN_PACKET_DB || packet_id > MAX_PACKET_DB || packet_dispatch[packet_id].len == 0)
+		return NULL;
+	return &packet_dispatch[packet_id];
+}
+
+/**
+ * Builds the packet dispatch table used by clif->parse.
+ *
+ * The table merges the handlers and field positions loaded from the packet
+ * headers (already specialised to PACKETVER at build time) with the packet
+ * lengths, so that decoding a packet is a single indexed load.
+ * Must be called again after changing packet lengths or handlers at runtime.
+ */
+static void clif_packet_dispatch_build(void)
+{
+	int cmd;
+
+	memset(packet_dispatch, 0, sizeof(packet_dispatch));
+
+	for (cmd = MIN_PACKET_DB; cmd <= MAX_PACKET_DB; cmd++) {
+		struct s_packet_dispatch *dispatch = &packet_dispatch[cmd];
+		int len = packets->db[cmd];
+
+		if (len == 0)
+			continue;
+		if (len != -1 && (len < 2 || len > INT16_MAX)) {
+			ShowError("clif_packet_dispatch_build: Invalid length %d of packet 0x%04x, ignoring packet.\n", len, (unsigned int)cmd);
+			continue;
+		}
+
+		dispatch->func = packet_db[cmd].func;
+		dispatch->len = (int16)len;
+		dispatch->min_len = len == -1 ? 4 : (uint16)len;
+		if (dispatch->func == NULL)
+			continue;
+		if (dispatch->func == clif->pDebug)
+			dispatch->flags |= PACKET_DISPATCH_ALWAYS;
+		if (dispatch->func == clif->pWantToConnection)
+			dispatch->flags |= PACKET_DISPATCH_NO_SESSION;
+		if (dispatch->func == clif->pLoadEndAck)
+			dispatch->flags |= PACKET_DISPATCH_OFF_MAP;
+	}
+}
+
 static void __attribute__ ((unused)) packetdb_addpacket(int cmd, ...)
 {
 	va_list va;
@@ -26569,6 +26629,7 @@ static int do_init_clif(bool minimal)
 		return 0;
 
 	packetdb_loaddb();
+	clif->packet_dispatch_build();
 
 	sockt->set_defaultparse(clif->parse);
 	sockt->validate = true;
@@ -26639,6 +26700,8 @@ void clif_defaults(void)
 	clif->parse_cmd = clif_parse_cmd_optional;
 	clif->decrypt_cmd = clif_decrypt_cmd;
 	clif->packet = clif_packet;
+	clif->packet_dispatch = clif_packet_dispatch;
+	clif->packet_dispatch_build = clif_packet_dispatch_build;
 	/* auth */
 	clif->authok = clif_authok;
 	clif->auth_error = clif_auth_error;
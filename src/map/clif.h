@@ -743,6 +743,26 @@ struct s_packet_db {
 	short pos[MAX_PACKET_POS];
 };
 
+/**
+ * Session states in which a packet handler is called (s_packet_dispatch::flags).
+ */
+enum packet_dispatch_flag {
+	PACKET_DISPATCH_NO_SESSION = 0x1, ///< Called before the session is authenticated (no map_session_data).
+	PACKET_DISPATCH_OFF_MAP    = 0x2, ///< Called while the character is not on a map.
+	PACKET_DISPATCH_ALWAYS     = 0x4, ///< Called in every session state.
+};
+
+/**
+ * Everything clif->parse needs to decode a client packet, in one entry per packet ID.
+ * Built from packet_db and the packet lengths by clif->packet_dispatch_build.
+ */
+struct s_packet_dispatch {
+	pFunc func;     ///< Packet handler, NULL if none.
+	int16 len;      ///< Packet length, -1 for variable-length packets, 0 for unsupported packets.
+	uint16 min_len; ///< Bytes required to determine the packet length.
+	uint8 flags;    ///< enum packet_dispatch_flag
+};
+
 struct hCSData {
 	int id;
 	int price;
@@ -961,6 +981,8 @@ struct clif_interface {
 	int (*send_actual) (int fd, void *buf, int len);
 	int (*parse) (int fd);
 	const struct s_packet_db *(*packet) (int packet_id);
+	const struct s_packet_dispatch *(*packet_dispatch) (int packet_id);
+	void (*packet_dispatch_build) (void);
 	unsigned short (*parse_cmd) ( int fd, struct map_session_data *sd );
 	unsigned short (*decrypt_cmd) ( int cmd, struct map_session_data *sd );
 	/* client-specific logic */
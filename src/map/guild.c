@@ -1561,7 +1561,7 @@ static void guild_guildaura_refresh(struct map_session_data *sd, uint16 skill_id
 		return;
 	if( !skill_lv )
 		return;
-	if (sd->sc.data[type] && (group = skill->id2group(sd->sc.data[type]->val4)) != NULL) {
+	if (SC_ENTRY(&sd->sc, type) && (group = skill->id2group(SC_ENTRY(&sd->sc, type)->val4)) != NULL) {
 		skill->del_unitgroup(group);
 		status_change_end(&sd->bl,type,INVALID_TIMER);
 	}
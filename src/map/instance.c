@@ -138,6 +138,7 @@ static int instance_create(int owner_id, const char *name, enum instance_owner_t
 	instance->list[i].owner_type = type;
 	instance->list[i].regs.vars = i64db_alloc(DB_OPT_RELEASE_DATA);
 	instance->list[i].regs.arrays = NULL;
+	instance->list[i].regs.slots = NULL;
 	instance->list[i].respawn.map = 0;
 	instance->list[i].respawn.y = 0;
 	instance->list[i].respawn.x = 0;
@@ -268,6 +269,12 @@ static int instance_add_map(const char *name, int instance_id, bool usebasename,
 	memset(map->list[im].moblist, 0x00, sizeof(map->list[im].moblist));
 	map->list[im].mob_delete_timer = INVALID_TIMER;
 
+	memset(&map->list[im].stats, 0x00, sizeof(map->list[im].stats));
+
+	map->list[im].migration.mob_ids = NULL;
+	VECTOR_INIT(map->list[im].migration.spawn_mobs);
+	VECTOR_INIT(map->list[im].migration.units);
+
 	//Mimic unit
 	if( map->list[m].unit_count ) {
 		map->list[im].unit_count = map->list[m].unit_count;
@@ -523,6 +530,7 @@ static void instance_del_map(int16 m)
 	}
 
 	VECTOR_CLEAR(map->list[m].qi_list);
+	VECTOR_CLEAR(map->list[m].migration.units);
 
 	// Remove from instance
 	for( i = 0; i < instance->list[map->list[m].instance_id].num_map; i++ ) {
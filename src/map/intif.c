@@ -1785,6 +1785,7 @@ static void intif_parse_QuestLog(int fd)
 			sd->quest_log = aRealloc(sd->quest_log, sizeof(struct quest)*sd->num_quests);
 		}
 	}
+	quest->index_invalidate(sd);
 
 	quest->pc_login(sd);
 }
@@ -74,6 +74,7 @@
 #include "common/ers.h"
 #include "common/extraconf.h"
 #include "common/grfio.h"
+#include "common/mapcharpackets.h"
 #include "common/md5calc.h"
 #include "common/memmgr.h"
 #include "common/nullpo.h"
@@ -91,7 +92,10 @@
 #include <stdlib.h>
 #include <string.h>
 #include <sys/stat.h>
+#include <time.h>
 #ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
 #include <unistd.h>
 #endif
 
@@ -153,6 +157,8 @@ static int map_freeblock(struct block_list *bl)
 	if (map->block_free_lock == 0) {
 		if( bl->type == BL_ITEM )
 			ers_free(map->flooritem_ers, bl);
+		else if( bl->type == BL_MOB )
+			mob->data_free(BL_UCAST(BL_MOB, bl));
 		else
 			aFree(bl);
 		bl = NULL;
@@ -194,6 +200,8 @@ static int map_freeblock_unlock(void)
 #endif
 			if( map->block_free[i]->type == BL_ITEM )
 				ers_free(map->flooritem_ers, map->block_free[i]);
+			else if( map->block_free[i]->type == BL_MOB )
+				mob->data_free(BL_UCAST(BL_MOB, map->block_free[i]));
 			else
 				aFree(map->block_free[i]);
 			map->block_free[i] = NULL;
@@ -220,6 +228,116 @@ static int map_freeblock_timer(int tid, int64 tick, int id, intptr_t data)
 	return 0;
 }
 
+/**
+ * Index of an object type in map_stats::objects.
+ * @param type A single bl_type (BL_PC to BL_ELEM)
+ * @return The index of the type, -1 when it isn't a single known type
+ */
+static int map_stats_type_index(enum bl_type type)
+{
+	int i = 0;
+
+	Assert_retr(-1, type != BL_NUL && (type & (type - 1)) == 0 && type <= BL_ELEM);
+	while ((type >> i) != 1)
+		i++;
+	return i;
+}
+
+/// Name of an index of map_stats::objects.
+static const char *map_stats_type_name(int index)
+{
+	static const char *names[MAP_STATS_BL_TYPES] = { "pc", "mob", "pet", "hom", "mer", "item", "skill", "npc", "chat", "elem" };
+
+	Assert_retr("?", index >= 0 && index < MAP_STATS_BL_TYPES);
+	return names[index];
+}
+
+/// Name of a counter of map_stats.
+static const char *map_stats_counter_name(enum map_stats_counter counter)
+{
+	static const char *names[MAP_STATS_MAX] = { "ai_thinks", "path_searches", "area_packets", "bytes_sent", "area_scans", "area_blocks" };
+
+	Assert_retr("?", counter >= 0 && counter < MAP_STATS_MAX);
+	return names[counter];
+}
+
+/**
+ * Operations per second done for a map at the last sample: monster AI runs,
+ * path searches, area broadcasts and area searches. Used to rank the maps.
+ */
+static unsigned int map_stats_load(const struct map_data *m)
+{
+	nullpo_ret(m);
+	return m->stats.rate[MAP_STATS_AI_THINKS] + m->stats.rate[MAP_STATS_PATH_SEARCHES]
+		+ m->stats.rate[MAP_STATS_AREA_PACKETS] + m->stats.rate[MAP_STATS_AREA_SCANS];
+}
+
+/**
+ * Computes the per second rates of the counters of all maps since the last sample.
+ */
+static void map_stats_sample(int64 tick)
+{
+	int64 elapsed = DIFF_TICK(tick, map->stats_tick);
+
+	if (elapsed <= 0)
+		return;
+	for (int i = 0; i < map->count; i++) {
+		struct map_stats *stats = &map->list[i].stats;
+		for (int j = 0; j < MAP_STATS_MAX; j++) {
+			stats->rate[j] = (unsigned int)((stats->count[j] - stats->sampled[j]) * 1000 / elapsed);
+			stats->sampled[j] = stats->count[j];
+		}
+	}
+	map->stats_tick = tick;
+}
+
+/**
+ * Appends the objects and the rates of the last sample of every map that
+ * has players or activity to map->stats_file, as tab separated values.
+ * A header line is written when the file is empty.
+ */
+static void map_stats_dump(int64 tick)
+{
+	FILE *fp;
+	time_t now = time(NULL);
+
+	if (map->stats_file[0] == '\0')
+		return;
+	if ((fp = fopen(map->stats_file, "a")) == NULL) {
+		ShowError("map_stats_dump: Can't write to '%s'.\n", map->stats_file);
+		return;
+	}
+	if (ftell(fp) == 0) {
+		fprintf(fp, "time\tmap\tusers");
+		for (int i = 0; i < MAP_STATS_BL_TYPES; i++)
+			fprintf(fp, "\t%s", map->stats_type_name(i));
+		for (int i = 0; i < MAP_STATS_MAX; i++)
+			fprintf(fp, "\t%s/s", map->stats_counter_name(i));
+		fprintf(fp, "\n");
+	}
+	for (int i = 0; i < map->count; i++) {
+		const struct map_data *m = &map->list[i];
+
+		if (m->users == 0 && map->stats_load(m) == 0)
+			continue;
+		fprintf(fp, "%"PRId64"\t%s\t%d", (int64)now, m->name, m->users);
+		for (int j = 0; j < MAP_STATS_BL_TYPES; j++)
+			fprintf(fp, "\t%d", m->stats.objects[j]);
+		for (int j = 0; j < MAP_STATS_MAX; j++)
+			fprintf(fp, "\t%u", m->stats.rate[j]);
+		fprintf(fp, "\n");
+	}
+	fclose(fp);
+}
+
+/// Timer sampling (and dumping) the map statistics every map->stats_interval seconds.
+static int map_stats_timer(int tid, int64 tick, int id, intptr_t data)
+{
+	map->stats_sample(tick);
+	map->stats_dump(tick);
+	return 0;
+}
+
 /**
  * Updates the counter (cell.cell_bl) of how many objects are on a tile.
  * @param add Whether the counter should be increased or decreased
@@ -257,7 +375,7 @@ static void map_update_cell_bl(struct block_list *bl, bool increase)
 static int map_addblock(struct block_list *bl)
 {
 	int16 m, x, y;
-	int pos;
+	int pos, type_index;
 
 	nullpo_ret(bl);
 
@@ -279,6 +397,7 @@ static int map_addblock(struct block_list *bl)
 	}
 
 	pos = x/BLOCK_SIZE+(y/BLOCK_SIZE)*map->list[m].bxs;
+	type_index = map->stats_type_index(bl->type);
 
 	if (bl->type == BL_MOB) {
 		Assert_ret(map->list[m].block_mob != NULL);
@@ -293,6 +412,8 @@ static int map_addblock(struct block_list *bl)
 		if (bl->next) bl->next->prev = bl;
 		map->list[m].block[pos] = bl;
 	}
+	if (type_index >= 0)
+		map->list[m].stats.objects[type_index]++;
 
 #ifdef CELL_NOSTACK
 	map->update_cell_bl(bl, true);
@@ -306,7 +427,7 @@ static int map_addblock(struct block_list *bl)
  *------------------------------------------*/
 static int map_delblock(struct block_list *bl)
 {
-	int pos;
+	int pos, type_index;
 	nullpo_ret(bl);
 
 	// blocklist (2ways chainlist)
@@ -340,6 +461,8 @@ static int map_delblock(struct block_list *bl)
 	}
 	bl->next = NULL;
 	bl->prev = NULL;
+	if ((type_index = map->stats_type_index(bl->type)) >= 0)
+		map->list[bl->m].stats.objects[type_index]--;
 
 	return 0;
 }
@@ -378,8 +501,8 @@ static int map_moveblock(struct block_list *bl, int x1, int y1, int64 tick)
 		status_change_end(bl, SC_NJ_TATAMIGAESHI, INVALID_TIMER);
 		status_change_end(bl, SC_MAGICROD, INVALID_TIMER);
 		status_change_end(bl, SC_SU_STOOP, INVALID_TIMER);
-		if (sc && sc->data[SC_PROPERTYWALK] &&
-			sc->data[SC_PROPERTYWALK]->val3 >= skill->get_maxcount(sc->data[SC_PROPERTYWALK]->val1,sc->data[SC_PROPERTYWALK]->val2) )
+		if (sc && SC_ENTRY(sc, SC_PROPERTYWALK) &&
+			SC_ENTRY(sc, SC_PROPERTYWALK)->val3 >= skill->get_maxcount(SC_ENTRY(sc, SC_PROPERTYWALK)->val1,SC_ENTRY(sc, SC_PROPERTYWALK)->val2) )
 			status_change_end(bl,SC_PROPERTYWALK,INVALID_TIMER);
 	} else if (bl->type == BL_NPC) {
 		npc->unsetcells(BL_UCAST(BL_NPC, bl));
@@ -412,46 +535,46 @@ static int map_moveblock(struct block_list *bl, int x1, int y1, int64 tick)
 		}
 
 		if (sc && sc->count) {
-			if (sc->data[SC_DANCING])
-				skill->unit_move_unit_group(skill->id2group(sc->data[SC_DANCING]->val2), bl->m, x1-x0, y1-y0);
+			if (SC_ENTRY(sc, SC_DANCING))
+				skill->unit_move_unit_group(skill->id2group(SC_ENTRY(sc, SC_DANCING)->val2), bl->m, x1-x0, y1-y0);
 			else {
-				if (sc->data[SC_CLOAKING])
-					skill->check_cloaking(bl, sc->data[SC_CLOAKING]);
-				if (sc->data[SC_WARM])
-					skill->unit_move_unit_group(skill->id2group(sc->data[SC_WARM]->val4), bl->m, x1-x0, y1-y0);
-				if (sc->data[SC_BANDING])
-					skill->unit_move_unit_group(skill->id2group(sc->data[SC_BANDING]->val4), bl->m, x1-x0, y1-y0);
-
-				if (sc->data[SC_NEUTRALBARRIER_MASTER])
-					skill->unit_move_unit_group(skill->id2group(sc->data[SC_NEUTRALBARRIER_MASTER]->val2), bl->m, x1-x0, y1-y0);
-				else if (sc->data[SC_STEALTHFIELD_MASTER])
-					skill->unit_move_unit_group(skill->id2group(sc->data[SC_STEALTHFIELD_MASTER]->val2), bl->m, x1-x0, y1-y0);
-
-				if( sc->data[SC__SHADOWFORM] ) {//Shadow Form Caster Moving
+				if (SC_ENTRY(sc, SC_CLOAKING))
+					skill->check_cloaking(bl, SC_ENTRY(sc, SC_CLOAKING));
+				if (SC_ENTRY(sc, SC_WARM))
+					skill->unit_move_unit_group(skill->id2group(SC_ENTRY(sc, SC_WARM)->val4), bl->m, x1-x0, y1-y0);
+				if (SC_ENTRY(sc, SC_BANDING))
+					skill->unit_move_unit_group(skill->id2group(SC_ENTRY(sc, SC_BANDING)->val4), bl->m, x1-x0, y1-y0);
+
+				if (SC_ENTRY(sc, SC_NEUTRALBARRIER_MASTER))
+					skill->unit_move_unit_group(skill->id2group(SC_ENTRY(sc, SC_NEUTRALBARRIER_MASTER)->val2), bl->m, x1-x0, y1-y0);
+				else if (SC_ENTRY(sc, SC_STEALTHFIELD_MASTER))
+					skill->unit_move_unit_group(skill->id2group(SC_ENTRY(sc, SC_STEALTHFIELD_MASTER)->val2), bl->m, x1-x0, y1-y0);
+
+				if( SC_ENTRY(sc, SC__SHADOWFORM) ) {//Shadow Form Caster Moving
 					struct block_list *d_bl;
-					if( (d_bl = map->id2bl(sc->data[SC__SHADOWFORM]->val2)) == NULL || !check_distance_bl(bl,d_bl,10) )
+					if( (d_bl = map->id2bl(SC_ENTRY(sc, SC__SHADOWFORM)->val2)) == NULL || !check_distance_bl(bl,d_bl,10) )
 						status_change_end(bl,SC__SHADOWFORM,INVALID_TIMER);
 				}
 
-				if (sc->data[SC_PROPERTYWALK]
-				 && sc->data[SC_PROPERTYWALK]->val3 < skill->get_maxcount(sc->data[SC_PROPERTYWALK]->val1,sc->data[SC_PROPERTYWALK]->val2)
+				if (SC_ENTRY(sc, SC_PROPERTYWALK)
+				 && SC_ENTRY(sc, SC_PROPERTYWALK)->val3 < skill->get_maxcount(SC_ENTRY(sc, SC_PROPERTYWALK)->val1,SC_ENTRY(sc, SC_PROPERTYWALK)->val2)
 				 && map->find_skill_unit_oncell(bl,bl->x,bl->y,SO_ELECTRICWALK,NULL,0) == NULL
 				 && map->find_skill_unit_oncell(bl,bl->x,bl->y,SO_FIREWALK,NULL,0) == NULL
-				 && skill->unitsetting(bl,sc->data[SC_PROPERTYWALK]->val1,sc->data[SC_PROPERTYWALK]->val2,x0, y0,0)
+				 && skill->unitsetting(bl,SC_ENTRY(sc, SC_PROPERTYWALK)->val1,SC_ENTRY(sc, SC_PROPERTYWALK)->val2,x0, y0,0)
 				) {
-					sc->data[SC_PROPERTYWALK]->val3++;
+					SC_ENTRY(sc, SC_PROPERTYWALK)->val3++;
 				}
 			}
 			/* Guild Aura Moving */
 			if (sd != NULL && sd->state.gmaster_flag) {
-				if (sc->data[SC_LEADERSHIP])
-					skill->unit_move_unit_group(skill->id2group(sc->data[SC_LEADERSHIP]->val4), bl->m, x1-x0, y1-y0);
-				if (sc->data[SC_GLORYWOUNDS])
-					skill->unit_move_unit_group(skill->id2group(sc->data[SC_GLORYWOUNDS]->val4), bl->m, x1-x0, y1-y0);
-				if (sc->data[SC_SOULCOLD])
-					skill->unit_move_unit_group(skill->id2group(sc->data[SC_SOULCOLD]->val4), bl->m, x1-x0, y1-y0);
-				if (sc->data[SC_HAWKEYES])
-					skill->unit_move_unit_group(skill->id2group(sc->data[SC_HAWKEYES]->val4), bl->m, x1-x0, y1-y0);
+				if (SC_ENTRY(sc, SC_LEADERSHIP))
+					skill->unit_move_unit_group(skill->id2group(SC_ENTRY(sc, SC_LEADERSHIP)->val4), bl->m, x1-x0, y1-y0);
+				if (SC_ENTRY(sc, SC_GLORYWOUNDS))
+					skill->unit_move_unit_group(skill->id2group(SC_ENTRY(sc, SC_GLORYWOUNDS)->val4), bl->m, x1-x0, y1-y0);
+				if (SC_ENTRY(sc, SC_SOULCOLD))
+					skill->unit_move_unit_group(skill->id2group(SC_ENTRY(sc, SC_SOULCOLD)->val4), bl->m, x1-x0, y1-y0);
+				if (SC_ENTRY(sc, SC_HAWKEYES))
+					skill->unit_move_unit_group(skill->id2group(SC_ENTRY(sc, SC_HAWKEYES)->val4), bl->m, x1-x0, y1-y0);
 			}
 		}
 	} else if (bl->type == BL_NPC) {
@@ -784,6 +907,9 @@ static int bl_getall_area(int type, int m, int x0, int y0, int x1, int y1, int (
 		const int y1b = y1 / BLOCK_SIZE;
 		const int bxs0 = listm->bxs;
 
+		map->list[m].stats.count[MAP_STATS_AREA_SCANS]++;
+		map->list[m].stats.count[MAP_STATS_AREA_BLOCKS] += (uint64)((x1b - x0b + 1) * (y1b - y0b + 1)) * (((type & ~BL_MOB) != 0) + ((type & BL_MOB) != 0));
+
 		// duplication for better performance
 		if (func != NULL) {
 			if (type & ~BL_MOB) {
@@ -1992,8 +2118,10 @@ static void map_addiddb(struct block_list *bl)
 			idb_put(map->bossid_db, bl->id, bl);
 	}
 
-	if( bl->type & BL_REGEN )
+	if (bl->type & BL_REGEN) {
 		idb_put(map->regen_db, bl->id, bl);
+		status->regen_add(bl);
+	}
 
 	idb_put(map->id_db,bl->id,bl);
 }
@@ -2014,8 +2142,10 @@ static void map_deliddb(struct block_list *bl)
 		idb_remove(map->bossid_db,bl->id);
 	}
 
-	if( bl->type & BL_REGEN )
+	if (bl->type & BL_REGEN) {
 		idb_remove(map->regen_db,bl->id);
+		status->regen_remove(bl);
+	}
 
 	idb_remove(map->id_db,bl->id);
 }
@@ -2081,14 +2211,12 @@ static int map_quit(struct map_session_data *sd)
 	//(changing map-servers invokes unit_free but bypasses map->quit)
 	if( sd->sc.count ) {
 		//Status that are not saved...
-		for(i=0; i < SC_MAX; i++){
+		STATUS_CHANGE_ITER(&sd->sc, i) {
 			if ( status->get_sc_type(i)&SC_NO_SAVE ) {
-				if ( !sd->sc.data[i] )
-					continue;
 				switch( i ){
 					case SC_ENDURE:
 					case SC_GDSKILL_REGENERATION:
-						if( !sd->sc.data[i]->val4 )
+						if( !SC_ENTRY(&sd->sc, i)->val4 )
 							break;
 						FALLTHROUGH
 					default:
@@ -2919,6 +3047,821 @@ static int16 map_mapindex2mapid(unsigned short map_index)
 	return map->index2mapid[map_index];
 }
 
+/**
+ * Sets the map-server owning a map.
+ *
+ * A map loaded here and owned by another map-server goes on standby, and the
+ * players on it are sent to the owner. When it was owned here, its state is
+ * sent to the new owner first (see map->state_send).
+ *
+ * @param map_index The map index.
+ * @param ip        IP address of the owner, in host byte order (0: no owner).
+ * @param port      Port of the owner, in host byte order.
+ */
+static void map_setipport(unsigned short map_index, uint32 ip, uint16 port)
+{
+	int16 m;
+	bool standby, was_owner;
+
+	if (map_index == 0 || map_index >= MAX_MAPINDEX)
+		return;
+
+	was_owner = (map->owner[map_index].ip == clif->map_ip && map->owner[map_index].port == clif->map_port);
+	map->owner[map_index].ip = ip;
+	map->owner[map_index].port = port;
+
+	if ((m = map->mapindex2mapid(map_index)) < 0)
+		return;
+	standby = (ip != 0 && (ip != clif->map_ip || port != clif->map_port));
+	if (standby == map->list[m].standby)
+		return;
+	map->list[m].standby = standby;
+	if (standby) {
+		ShowStatus("Map '%s' moved to map-server %u.%u.%u.%u:%d, now on standby.\n", map->list[m].name, CONVIP(ip), port);
+		if (was_owner)
+			map->state_send(m, ip, port);
+		map->standby_evacuate(m);
+	} else {
+		ShowStatus("Map '%s' is now hosted by this map-server.\n", map->list[m].name);
+	}
+}
+
+/**
+ * Returns the map-server owning a map, if it's not this one.
+ *
+ * @param map_index The map index.
+ * @param[out] ip   IP address of the owner, in host byte order.
+ * @param[out] port Port of the owner, in host byte order.
+ * @return Whether another map-server owns the map.
+ */
+static bool map_mapindex2ipport(unsigned short map_index, uint32 *ip, uint16 *port)
+{
+	const struct map_server_addr *owner;
+
+	nullpo_retr(false, ip);
+	nullpo_retr(false, port);
+	if (map_index == 0 || map_index >= MAX_MAPINDEX)
+		return false;
+
+	owner = &map->owner[map_index];
+	if (owner->ip == 0 || (owner->ip == clif->map_ip && owner->port == clif->map_port))
+		return false;
+	*ip = owner->ip;
+	*port = owner->port;
+	return true;
+}
+
+/// Forgets the owners of all maps, the standby maps are hosted here again.
+static void map_eraseallipport(void)
+{
+	memset(&map->owner, 0, sizeof(map->owner));
+	for (int i = 0; i < map->count; i++)
+		map->list[i].standby = false;
+}
+
+/// Sends the players on a standby map to the map-server owning it.
+static void map_standby_evacuate(int16 m)
+{
+	VECTOR_DECL(int) list;
+	struct s_mapiterator *iter;
+	struct map_session_data *sd;
+
+	Assert_retv(m >= 0 && m < map->count);
+	if (map->list[m].users == 0)
+		return;
+
+	// collect the players first, they are freed when they leave
+	VECTOR_INIT(list);
+	iter = mapit_getallusers();
+	for (sd = BL_UCAST(BL_PC, mapit->first(iter)); mapit->exists(iter); sd = BL_UCAST(BL_PC, mapit->next(iter))) {
+		if (sd->bl.m == m && sd->state.active) {
+			VECTOR_ENSURE(list, 1, 16);
+			VECTOR_PUSH(list, sd->bl.id);
+		}
+	}
+	mapit->free(iter);
+
+	for (int i = 0; i < VECTOR_LENGTH(list); i++) {
+		if ((sd = map->id2sd(VECTOR_INDEX(list, i))) != NULL && sd->bl.m == m)
+			pc->setpos(sd, map->list[m].index, sd->bl.x, sd->bl.y, CLR_TELEPORT);
+	}
+	VECTOR_CLEAR(list);
+}
+
+/**
+ * Sends the state of a map that moved from this map-server to its new owner,
+ * through the char-server, then removes it here: monsters, ground items,
+ * ground skills, and the look, timers and variables of the NPCs.
+ * The permanent spawns wait here for their respawn, as the map is on standby.
+ *
+ * @param m    The map.
+ * @param ip   IP address of the new owner, in host byte order.
+ * @param port Port of the new owner, in host byte order.
+ */
+static void map_state_send(int16 m, uint32 ip, uint16 port)
+{
+	struct map_state_buffer *buf;
+
+	Assert_retv(m >= 0 && m < map->count);
+
+	CREATE(buf, struct map_state_buffer, 1);
+	buf->ip = ip;
+	buf->port = port;
+	buf->map_index = map->list[m].index;
+	if (chrif->map_state(ip, port, buf->map_index, CHRIF_MAP_STATE_BEGIN, NULL, 0, 0)) {
+		map->state_send_npcs(buf, m);
+		map->state_send_mobs(buf, m);
+		map->state_send_items(buf, m);
+		map->state_send_units(buf, m);
+		map->state_flush(buf);
+		chrif->map_state(ip, port, buf->map_index, CHRIF_MAP_STATE_END, NULL, 0, 0);
+	}
+	aFree(buf);
+	map->state_clear(m, true);
+}
+
+/**
+ * Adds a record to the state of a map, sending the buffered records first if
+ * they are of another type or the record doesn't fit.
+ *
+ * @param buf  The buffered records.
+ * @param type enum chrif_map_state_type of the record.
+ * @param len  Length of the record.
+ * @return The zeroed record, NULL if it's longer than a packet.
+ */
+static void *map_state_push(struct map_state_buffer *buf, uint8 type, int len)
+{
+	void *p;
+
+	nullpo_retr(NULL, buf);
+	if (len <= 0 || len > MAP_STATE_BUFFER_SIZE)
+		return NULL;
+	if (buf->count > 0 && (buf->type != type || buf->len + len > MAP_STATE_BUFFER_SIZE || buf->count == UINT16_MAX))
+		map->state_flush(buf);
+
+	buf->type = type;
+	p = buf->data + buf->len;
+	memset(p, 0, len);
+	buf->len += len;
+	buf->count++;
+	return p;
+}
+
+/// Sends the buffered records of the state of a map.
+static void map_state_flush(struct map_state_buffer *buf)
+{
+	nullpo_retv(buf);
+	if (buf->count > 0)
+		chrif->map_state(buf->ip, buf->port, buf->map_index, buf->type, buf->data, buf->count, buf->len);
+	buf->count = 0;
+	buf->len = 0;
+}
+
+/// Adds the monsters of a map to its state, but slaves, clones and battleground monsters.
+static void map_state_send_mobs(struct map_state_buffer *buf, int16 m)
+{
+	struct s_mapiterator *iter;
+	struct mob_data *md;
+	int64 tick = timer->gettick();
+
+	nullpo_retv(buf);
+	iter = mapit_geteachmob();
+	for (md = BL_UCAST(BL_MOB, mapit->first(iter)); mapit->exists(iter); md = BL_UCAST(BL_MOB, mapit->next(iter))) {
+		struct chrif_map_state_mob *p;
+		const struct npc_data *nd;
+
+		if (md->bl.m != m || md->master_id != 0 || md->special_state.clone != 0 || md->bg_id != 0)
+			continue;
+		if (md->bl.prev == NULL && md->spawn == NULL)
+			continue;
+		if ((p = map->state_push(buf, CHRIF_MAP_STATE_MOB, (int)sizeof(*p))) == NULL)
+			continue;
+
+		p->id = md->bl.id;
+		p->class_ = md->class_;
+		p->x = md->bl.x;
+		p->y = md->bl.y;
+		p->dir = md->ud.dir;
+		p->size = md->special_state.size;
+		p->ai = md->special_state.ai;
+		if (md->bl.prev != NULL)
+			p->hp = md->status.hp;
+		else if (md->spawn_timer != INVALID_TIMER)
+			p->respawn = (uint32)max(DIFF_TICK(md->respawn_tick, tick), 0);
+		if (md->spawn != NULL) {
+			p->spawn = 1;
+			p->spawn_class = md->spawn->class_;
+			p->spawn_x = md->spawn->x;
+			p->spawn_y = md->spawn->y;
+			p->spawn_xs = md->spawn->xs;
+			p->spawn_ys = md->spawn->ys;
+		}
+		// the emperium gets its guardian data back when spawned
+		if (md->guardian_data != NULL && md->guardian_data->number < MAX_GUARDIANS) {
+			p->guardian = 1;
+			p->guardian_index = md->guardian_data->number;
+		}
+		safestrncpy(p->name, md->name, sizeof(p->name));
+		safestrncpy(p->event, md->npc_event, sizeof(p->event));
+		if (md->npc_id != 0 && (nd = map->id2nd(md->npc_id)) != NULL)
+			safestrncpy(p->npc, nd->exname, sizeof(p->npc));
+	}
+	mapit->free(iter);
+}
+
+/// Adds the items on the ground of a map to its state.
+static void map_state_send_items(struct map_state_buffer *buf, int16 m)
+{
+	struct s_mapiterator *iter;
+	struct block_list *bl;
+	int64 tick = timer->gettick();
+
+	nullpo_retv(buf);
+	iter = mapit->alloc(MAPIT_NORMAL, BL_ITEM);
+	for (bl = mapit->first(iter); mapit->exists(iter); bl = mapit->next(iter)) {
+		const struct flooritem_data *fitem = BL_UCCAST(BL_ITEM, bl);
+		const struct TimerData *td;
+		struct chrif_map_state_item *p;
+
+		if (bl->m != m || (p = map->state_push(buf, CHRIF_MAP_STATE_ITEM, (int)sizeof(*p))) == NULL)
+			continue;
+
+		memcpy(&p->item, &fitem->item_data, sizeof(p->item));
+		p->x = bl->x;
+		p->y = bl->y;
+		p->subx = fitem->subx;
+		p->suby = fitem->suby;
+		p->charid[0] = fitem->first_get_charid;
+		p->charid[1] = fitem->second_get_charid;
+		p->charid[2] = fitem->third_get_charid;
+		p->charid_time[0] = (uint32)max(DIFF_TICK(fitem->first_get_tick, tick), 0);
+		p->charid_time[1] = (uint32)max(DIFF_TICK(fitem->second_get_tick, tick), 0);
+		p->charid_time[2] = (uint32)max(DIFF_TICK(fitem->third_get_tick, tick), 0);
+		if ((td = timer->get(fitem->cleartimer)) != NULL)
+			p->lifetime = (uint32)max(DIFF_TICK(td->tick, tick), 0);
+		else
+			p->lifetime = battle_config.flooritem_lifetime;
+	}
+	mapit->free(iter);
+}
+
+/**
+ * Adds the NPCs of a map to its state: their look, position and timer, then
+ * their '.' variables.
+ * The variables of a duplicate are its source's, they stay with it.
+ */
+static void map_state_send_npcs(struct map_state_buffer *buf, int16 m)
+{
+	nullpo_retv(buf);
+
+	for (int i = 0; i < map->list[m].npc_num; i++) {
+		struct npc_data *nd = map->list[m].npc[i];
+		struct chrif_map_state_npc *p;
+
+		if (nd == NULL || (p = map->state_push(buf, CHRIF_MAP_STATE_NPC, (int)sizeof(*p))) == NULL)
+			continue;
+
+		safestrncpy(p->name, nd->exname, sizeof(p->name));
+		p->class_ = nd->class_;
+		p->x = nd->bl.x;
+		p->y = nd->bl.y;
+		p->dir = nd->dir;
+		p->option = nd->option;
+		if (nd->subtype == SCRIPT && nd->u.scr.rid == 0) {
+			p->timer_running = (nd->u.scr.timerid != INVALID_TIMER || nd->u.scr.timertick != 0) ? 1 : 0;
+			p->timer = (int)npc->gettimerevent_tick(nd);
+		}
+	}
+
+	for (int i = 0; i < map->list[m].npc_num; i++) {
+		struct npc_data *nd = map->list[m].npc[i];
+
+		if (nd != NULL && nd->subtype == SCRIPT && nd->src_id == 0 && nd->u.scr.script != NULL)
+			map->state_send_npc_vars(buf, nd);
+	}
+}
+
+/// Adds the '.' variables of an NPC to the state of its map.
+static void map_state_send_npc_vars(struct map_state_buffer *buf, struct npc_data *nd)
+{
+	const struct reg_db *n;
+
+	nullpo_retv(buf);
+	nullpo_retv(nd);
+	nullpo_retv(nd->u.scr.script);
+
+	n = &nd->u.scr.script->local;
+	if (n->vars != NULL) {
+		struct DBIterator *iter = db_iterator(n->vars);
+		union DBKey key;
+
+		for (struct DBData *data = iter->first(iter, &key); dbi_exists(iter); data = iter->next(iter, &key)) {
+			int id = script_getvarid(key.i64);
+
+			if (script->str_data[id].var_string)
+				map->state_send_npc_var(buf, nd, id, script_getvaridx(key.i64), 0, DB->data2ptr(data));
+			else
+				map->state_send_npc_var(buf, nd, id, script_getvaridx(key.i64), DB->data2i(data), NULL);
+		}
+		dbi_destroy(iter);
+	}
+	if (n->slots != NULL) {
+		for (int i = 0; i < n->slots->vars->count; i++) {
+			int id = n->slots->vars->ids[i];
+
+			if (!script->str_data[id].var_string)
+				map->state_send_npc_var(buf, nd, id, 0, n->slots->value[i].num, NULL);
+			else if (n->slots->value[i].str != NULL)
+				map->state_send_npc_var(buf, nd, id, 0, 0, n->slots->value[i].str);
+		}
+	}
+}
+
+/**
+ * Adds an NPC variable to the state of its map.
+ *
+ * @param buf   The buffered records.
+ * @param nd    The NPC.
+ * @param id    The variable.
+ * @param index Its array index.
+ * @param value Its value, for a number variable.
+ * @param str   Its value, for a string variable (NULL for a number).
+ */
+static void map_state_send_npc_var(struct map_state_buffer *buf, const struct npc_data *nd, int id, unsigned int index, int value, const char *str)
+{
+	struct chrif_map_state_npc_var *p;
+	int len = (str != NULL) ? (int)strlen(str) + 1 : 0;
+
+	nullpo_retv(buf);
+	nullpo_retv(nd);
+	if (str == NULL ? value == 0 : len == 1)
+		return; // not set
+	if ((p = map->state_push(buf, CHRIF_MAP_STATE_NPC_VAR, (int)sizeof(*p) + len)) == NULL) {
+		ShowWarning("map_state_send_npc_var: Value of variable '%s' of NPC '%s' is too long, not moved.\n", script->get_str(id), nd->exname);
+		return;
+	}
+
+	safestrncpy(p->npc, nd->exname, sizeof(p->npc));
+	safestrncpy(p->name, script->get_str(id), sizeof(p->name));
+	p->index = index;
+	p->value = value;
+	p->len = len;
+	if (len > 0)
+		memcpy(p + 1, str, len);
+}
+
+/**
+ * Adds the ground skills of a map to its state, but songs, dances and guild
+ * auras, which follow their caster.
+ * The skill of a character is set up again once it's on the map.
+ */
+static void map_state_send_units(struct map_state_buffer *buf, int16 m)
+{
+	struct s_mapiterator *iter;
+	struct block_list *bl;
+	struct chrif_map_state_unit *p;
+	int64 tick = timer->gettick();
+
+	nullpo_retv(buf);
+	iter = mapit->alloc(MAPIT_NORMAL, BL_SKILL);
+	for (bl = mapit->first(iter); mapit->exists(iter); bl = mapit->next(iter)) {
+		const struct skill_unit *su = BL_UCCAST(BL_SKILL, bl);
+		const struct skill_unit_group *group = su->group;
+		const struct block_list *src;
+		int64 limit, x = 0, y = 0;
+		int i;
+
+		if (bl->m != m || group == NULL || group->state.song_dance != 0 || group->state.guildaura != 0)
+			continue;
+		ARR_FIND(0, group->unit.count, i, group->unit.data[i].alive);
+		if (i == group->unit.count || &group->unit.data[i] != su)
+			continue; // sent with the first unit of its group
+		limit = group->limit - DIFF_TICK(tick, group->tick);
+		if (limit <= 0 || (src = map->id2bl(group->src_id)) == NULL || (src->type&(BL_PC|BL_MOB|BL_NPC)) == 0)
+			continue;
+		if ((p = map->state_push(buf, CHRIF_MAP_STATE_UNIT, (int)sizeof(*p))) == NULL)
+			continue;
+
+		if (src->type == BL_PC) {
+			p->caster_type = CHRIF_MAP_STATE_CASTER_PC;
+			p->caster_id = BL_UCCAST(BL_PC, src)->status.char_id;
+		} else if (src->type == BL_MOB) {
+			p->caster_type = CHRIF_MAP_STATE_CASTER_MOB;
+			p->caster_id = src->id;
+		} else {
+			p->caster_type = CHRIF_MAP_STATE_CASTER_NPC;
+			safestrncpy(p->npc, BL_UCCAST(BL_NPC, src)->exname, sizeof(p->npc));
+		}
+		// the center of its cells, where it was cast for the usual layouts
+		for (i = 0; i < group->unit.count; i++) {
+			x += group->unit.data[i].bl.x;
+			y += group->unit.data[i].bl.y;
+		}
+		p->x = (int16)(x / group->unit.count);
+		p->y = (int16)(y / group->unit.count);
+		p->skill_id = group->skill_id;
+		p->skill_lv = group->skill_lv;
+		p->limit = (uint32)limit;
+	}
+	mapit->free(iter);
+
+	// skills of characters that didn't come back since the map moved here
+	for (int i = 0; i < VECTOR_LENGTH(map->list[m].migration.units); i++) {
+		const struct map_state_unit *u = &VECTOR_INDEX(map->list[m].migration.units, i);
+
+		if (DIFF_TICK(u->expire, tick) <= 0 || (p = map->state_push(buf, CHRIF_MAP_STATE_UNIT, (int)sizeof(*p))) == NULL)
+			continue;
+		p->caster_type = CHRIF_MAP_STATE_CASTER_PC;
+		p->caster_id = u->char_id;
+		p->x = u->x;
+		p->y = u->y;
+		p->skill_id = u->skill_id;
+		p->skill_lv = u->skill_lv;
+		p->limit = (uint32)DIFF_TICK(u->expire, tick);
+	}
+}
+
+/**
+ * Removes the monsters, ground items and ground skills of a map.
+ *
+ * @param m       The map.
+ * @param respawn Whether the monsters of permanent spawns are removed too,
+ *                waiting for their respawn (else they're kept as they are).
+ */
+static void map_state_clear(int16 m, bool respawn)
+{
+	VECTOR_DECL(int) list;
+	struct s_mapiterator *iter;
+	struct block_list *bl;
+	int64 tick = timer->gettick();
+
+	Assert_retv(m >= 0 && m < map->count);
+
+	// collect the objects first, removing one may free others
+	VECTOR_INIT(list);
+	iter = mapit->alloc(MAPIT_NORMAL, BL_MOB|BL_ITEM|BL_SKILL);
+	for (bl = mapit->first(iter); mapit->exists(iter); bl = mapit->next(iter)) {
+		if (bl->m == m) {
+			VECTOR_ENSURE(list, 1, 64);
+			VECTOR_PUSH(list, bl->id);
+		}
+	}
+	mapit->free(iter);
+
+	for (int i = 0; i < VECTOR_LENGTH(list); i++) {
+		if ((bl = map->id2bl(VECTOR_INDEX(list, i))) == NULL || bl->m != m)
+			continue;
+		if (bl->type == BL_SKILL) {
+			struct skill_unit *su = BL_UCAST(BL_SKILL, bl);
+
+			if (su->group != NULL)
+				skill->del_unitgroup(su->group);
+		} else if (bl->type == BL_ITEM) {
+			map->clearflooritem(bl);
+		} else if (bl->type == BL_MOB) {
+			struct mob_data *md = BL_UCAST(BL_MOB, bl);
+
+			if (md->spawn == NULL) {
+				unit->free(bl, CLR_OUTSIGHT);
+			} else if (respawn && bl->prev != NULL) {
+				unit->remove_map(bl, CLR_OUTSIGHT, ALC_MARK);
+				mob->queue_respawn(md, tick + 5000);
+			}
+		}
+	}
+	VECTOR_CLEAR(list);
+	VECTOR_CLEAR(map->list[m].migration.units);
+}
+
+/**
+ * Receives records of the state of a map that moved to this map-server
+ * (see map->state_send).
+ *
+ * @param map_index The map index.
+ * @param type      enum chrif_map_state_type of the records.
+ * @param data      The records.
+ * @param count     Number of records.
+ * @param len       Length of the records.
+ */
+static void map_state_recv(unsigned short map_index, uint8 type, const uint8 *data, int count, int len)
+{
+	int16 m = map->mapindex2mapid(map_index);
+	struct s_mapiterator *iter;
+	struct mob_data *md;
+	int pos = 0;
+
+	nullpo_retv(data);
+	if (m < 0 || map->list[m].standby) {
+		if (type == CHRIF_MAP_STATE_BEGIN)
+			ShowWarning("map_state_recv: Map %d is not hosted by this map-server, its state is dropped.\n", map_index);
+		return;
+	}
+
+	switch (type) {
+		case CHRIF_MAP_STATE_BEGIN:
+			map->state_clear(m, false);
+			if (map->list[m].migration.mob_ids != NULL)
+				db_destroy(map->list[m].migration.mob_ids);
+			map->list[m].migration.mob_ids = idb_alloc(DB_OPT_BASE);
+			if (battle_config.dynamic_mobs)
+				map->spawnmobs(m);
+			// the monsters of the permanent spawns here take the place of the ones sent
+			VECTOR_TRUNCATE(map->list[m].migration.spawn_mobs);
+			iter = mapit_geteachmob();
+			for (md = BL_UCAST(BL_MOB, mapit->first(iter)); mapit->exists(iter); md = BL_UCAST(BL_MOB, mapit->next(iter))) {
+				if (md->bl.m == m && md->spawn != NULL) {
+					VECTOR_ENSURE(map->list[m].migration.spawn_mobs, 1, 64);
+					VECTOR_PUSH(map->list[m].migration.spawn_mobs, md->bl.id);
+				}
+			}
+			mapit->free(iter);
+			return;
+		case CHRIF_MAP_STATE_END:
+			if (map->list[m].migration.mob_ids == NULL)
+				return;
+			db_destroy(map->list[m].migration.mob_ids);
+			map->list[m].migration.mob_ids = NULL;
+			VECTOR_CLEAR(map->list[m].migration.spawn_mobs);
+			if (battle_config.dynamic_mobs && map->list[m].users == 0)
+				map->removemobs(m);
+			ShowStatus("Map '%s': state received from its previous map-server.\n", map->list[m].name);
+			return;
+	}
+
+	if (map->list[m].migration.mob_ids == NULL)
+		return; // the beginning of the state was dropped
+
+	for (int i = 0; i < count; i++) {
+		switch (type) {
+			case CHRIF_MAP_STATE_MOB:
+				if (pos + (int)sizeof(struct chrif_map_state_mob) > len)
+					break;
+				map->state_recv_mob(m, (const struct chrif_map_state_mob *)(data + pos));
+				pos += (int)sizeof(struct chrif_map_state_mob);
+				continue;
+			case CHRIF_MAP_STATE_ITEM:
+				if (pos + (int)sizeof(struct chrif_map_state_item) > len)
+					break;
+				map->state_recv_item(m, (const struct chrif_map_state_item *)(data + pos));
+				pos += (int)sizeof(struct chrif_map_state_item);
+				continue;
+			case CHRIF_MAP_STATE_NPC:
+				if (pos + (int)sizeof(struct chrif_map_state_npc) > len)
+					break;
+				map->state_recv_npc(m, (const struct chrif_map_state_npc *)(data + pos));
+				pos += (int)sizeof(struct chrif_map_state_npc);
+				continue;
+			case CHRIF_MAP_STATE_NPC_VAR: {
+				const struct chrif_map_state_npc_var *p = (const struct chrif_map_state_npc_var *)(data + pos);
+				const char *str = (const char *)(p + 1);
+
+				if (pos + (int)sizeof(*p) > len || pos + (int)sizeof(*p) + p->len > len || (p->len > 0 && str[p->len - 1] != '\0'))
+					break;
+				map->state_recv_npc_var(m, p, p->len > 0 ? str : NULL);
+				pos += (int)sizeof(*p) + p->len;
+				continue;
+			}
+			case CHRIF_MAP_STATE_UNIT:
+				if (pos + (int)sizeof(struct chrif_map_state_unit) > len)
+					break;
+				map->state_recv_unit(m, (const struct chrif_map_state_unit *)(data + pos));
+				pos += (int)sizeof(struct chrif_map_state_unit);
+				continue;
+		}
+		ShowError("map_state_recv: Invalid records of type %d for map '%s' (%d records, length %d).\n", type, map->list[m].name, count, len);
+		return;
+	}
+}
+
+/**
+ * Sets up a monster of a moved map.
+ * The monster of a permanent spawn takes the place of one of the same spawn
+ * here.
+ */
+static void map_state_recv_mob(int16 m, const struct chrif_map_state_mob *p)
+{
+	struct mob_data *md = NULL;
+	int64 tick = timer->gettick();
+
+	nullpo_retv(p);
+	if (p->x < 0 || p->x >= map->list[m].xs || p->y < 0 || p->y >= map->list[m].ys)
+		return;
+
+	if (p->spawn != 0) {
+		int i;
+
+		ARR_FIND(0, VECTOR_LENGTH(map->list[m].migration.spawn_mobs), i,
+			(md = map->id2md(VECTOR_INDEX(map->list[m].migration.spawn_mobs, i))) != NULL && md->spawn != NULL
+			&& md->spawn->class_ == p->spawn_class && md->spawn->x == p->spawn_x && md->spawn->y == p->spawn_y
+			&& md->spawn->xs == p->spawn_xs && md->spawn->ys == p->spawn_ys);
+		if (i == VECTOR_LENGTH(map->list[m].migration.spawn_mobs))
+			return; // no such spawn here
+		VECTOR_ERASE(map->list[m].migration.spawn_mobs, i);
+		idb_iput(map->list[m].migration.mob_ids, p->id, md->bl.id);
+
+		if (p->hp == 0) {
+			if (md->bl.prev != NULL)
+				unit->remove_map(&md->bl, CLR_OUTSIGHT, ALC_MARK);
+			mob->queue_respawn(md, tick + p->respawn);
+			return;
+		}
+		if (md->bl.prev == NULL && mob->spawn(md) != 0)
+			return; // no free cell, it respawns later
+	} else {
+		const struct npc_data *nd = (p->npc[0] != '\0') ? npc->name2id(p->npc) : NULL;
+		int npc_id = (nd != NULL) ? nd->bl.id : 0;
+		int id;
+
+		if (p->hp == 0 || mob->db_checkid(p->class_) == 0)
+			return;
+		if (p->guardian != 0)
+			id = mob->spawn_guardian(map->list[m].name, p->x, p->y, p->name, p->class_, p->event, p->guardian_index, p->guardian_index >= 0, npc_id);
+		else
+			id = mob->once_spawn(NULL, m, p->x, p->y, p->name, p->class_, 1, p->event, p->size, p->ai);
+		if ((md = map->id2md(id)) == NULL)
+			return;
+		md->npc_id = npc_id;
+		idb_iput(map->list[m].migration.mob_ids, p->id, md->bl.id);
+	}
+
+	if (md->bl.x != p->x || md->bl.y != p->y)
+		map->moveblock(&md->bl, p->x, p->y, tick);
+	md->ud.dir = p->dir;
+	md->status.hp = cap_value(p->hp, 1, md->status.max_hp);
+}
+
+/// Puts back an item on the ground of a moved map.
+static void map_state_recv_item(int16 m, const struct chrif_map_state_item *p)
+{
+	struct item item;
+	struct flooritem_data *fitem;
+	int64 tick = timer->gettick();
+	int id;
+
+	nullpo_retv(p);
+	if (p->x < 0 || p->x >= map->list[m].xs || p->y < 0 || p->y >= map->list[m].ys || itemdb->exists(p->item.nameid) == NULL)
+		return;
+
+	memcpy(&item, &p->item, sizeof(item));
+	id = map->addflooritem(NULL, &item, item.amount, m, p->x, p->y, p->charid[0], p->charid[1], p->charid[2], 0, false);
+	if ((fitem = BL_CAST(BL_ITEM, map->id2bl(id))) == NULL)
+		return;
+
+	if (fitem->bl.x != p->x || fitem->bl.y != p->y)
+		map->moveblock(&fitem->bl, p->x, p->y, tick);
+	fitem->subx = p->subx;
+	fitem->suby = p->suby;
+	fitem->first_get_tick = tick + p->charid_time[0];
+	fitem->second_get_tick = tick + p->charid_time[1];
+	fitem->third_get_tick = tick + p->charid_time[2];
+	timer->settick(fitem->cleartimer, tick + p->lifetime);
+}
+
+/**
+ * Sets the look, position and timer of an NPC of a moved map, and clears its
+ * '.' variables for the ones sent next.
+ */
+static void map_state_recv_npc(int16 m, const struct chrif_map_state_npc *p)
+{
+	struct npc_data *nd;
+
+	nullpo_retv(p);
+	if ((nd = npc->name2id(p->name)) == NULL || nd->bl.m != m)
+		return;
+
+	if (nd->class_ != p->class_)
+		npc->setclass(nd, p->class_);
+	if (nd->bl.x != p->x || nd->bl.y != p->y)
+		npc->movenpc(nd, p->x, p->y);
+	nd->dir = p->dir;
+	nd->option = p->option;
+
+	if (nd->subtype != SCRIPT)
+		return;
+	if (nd->u.scr.rid == 0) {
+		bool running = (nd->u.scr.timerid != INVALID_TIMER || nd->u.scr.timertick != 0);
+
+		if (running && p->timer_running == 0)
+			npc->timerevent_stop(nd);
+		else if (!running && p->timer_running != 0)
+			npc->timerevent_start(nd, -1);
+		npc->settimerevent_tick(nd, p->timer);
+	}
+	if (nd->src_id == 0 && nd->u.scr.script != NULL)
+		script->reg_db_clear(&nd->u.scr.script->local);
+}
+
+/// Sets a '.' variable of an NPC of a moved map.
+static void map_state_recv_npc_var(int16 m, const struct chrif_map_state_npc_var *p, const char *str)
+{
+	struct npc_data *nd;
+	struct reg_db *n;
+	int id;
+
+	nullpo_retv(p);
+	if ((nd = npc->name2id(p->npc)) == NULL || nd->bl.m != m || nd->subtype != SCRIPT || nd->src_id != 0 || nd->u.scr.script == NULL)
+		return;
+	id = script->search_str(p->name);
+	if (id < 0 || script->str_data[id].type != C_NAME || script->str_data[id].var_scope != SCRIPT_VAR_NPC)
+		return; // not used by the scripts here
+
+	n = &nd->u.scr.script->local;
+	if (n->vars == NULL)
+		n->vars = i64db_alloc(DB_OPT_RELEASE_DATA);
+	if (script->str_data[id].var_string)
+		script->set_reg_npc_str(NULL, n, reference_uid(id, p->index), p->name, str != NULL ? str : "");
+	else
+		script->set_reg_npc_num(NULL, n, reference_uid(id, p->index), p->name, p->value);
+}
+
+/**
+ * Sets up a ground skill of a moved map again.
+ * The skill of a character waits for it to be on the map.
+ */
+static void map_state_recv_unit(int16 m, const struct chrif_map_state_unit *p)
+{
+	struct block_list *src = NULL;
+
+	nullpo_retv(p);
+	if (skill->get_index(p->skill_id) == 0 || p->limit == 0)
+		return;
+
+	switch (p->caster_type) {
+		case CHRIF_MAP_STATE_CASTER_PC: {
+			struct map_state_unit u = { 0 };
+
+			u.char_id = p->caster_id;
+			u.skill_id = p->skill_id;
+			u.skill_lv = p->skill_lv;
+			u.x = p->x;
+			u.y = p->y;
+			u.expire = timer->gettick() + p->limit;
+			VECTOR_ENSURE(map->list[m].migration.units, 1, 8);
+			VECTOR_PUSH(map->list[m].migration.units, u);
+			return;
+		}
+		case CHRIF_MAP_STATE_CASTER_MOB:
+			src = map->id2bl(idb_iget(map->list[m].migration.mob_ids, p->caster_id));
+			break;
+		case CHRIF_MAP_STATE_CASTER_NPC: {
+			struct npc_data *nd = npc->name2id(p->npc);
+
+			src = (nd != NULL) ? &nd->bl : NULL;
+			break;
+		}
+	}
+	if (src != NULL && src->m == m && src->prev != NULL)
+		map->state_unitsetting(src, p->skill_id, p->skill_lv, p->x, p->y, p->limit);
+}
+
+/**
+ * Sets up a ground skill of a moved map again, with the time it had left.
+ *
+ * @param src      The caster, on the map.
+ * @param skill_id The skill.
+ * @param skill_lv Its level.
+ * @param x        X coordinate of its center.
+ * @param y        Y coordinate of its center.
+ * @param limit    Time left (ms).
+ */
+static void map_state_unitsetting(struct block_list *src, uint16 skill_id, uint16 skill_lv, int16 x, int16 y, int limit)
+{
+	struct skill_unit_group *group;
+
+	nullpo_retv(src);
+	if (limit <= 0 || (group = skill->unitsetting(src, skill_id, skill_lv, x, y, 0)) == NULL)
+		return;
+
+	group->tick = timer->gettick();
+	group->limit = limit;
+	for (int i = 0; i < group->unit.count; i++)
+		group->unit.data[i].limit = limit;
+}
+
+/// Sets up again the ground skills a character had on its map before the map moved here.
+static void map_state_units_load(struct map_session_data *sd)
+{
+	int64 tick = timer->gettick();
+	int16 m;
+	int i = 0;
+
+	nullpo_retv(sd);
+	m = sd->bl.m;
+	Assert_retv(m >= 0 && m < map->count);
+
+	while (i < VECTOR_LENGTH(map->list[m].migration.units)) {
+		struct map_state_unit u = VECTOR_INDEX(map->list[m].migration.units, i);
+
+		if (DIFF_TICK(u.expire, tick) > 0 && u.char_id != sd->status.char_id) {
+			i++;
+			continue;
+		}
+		VECTOR_ERASE(map->list[m].migration.units, i);
+		if (DIFF_TICK(u.expire, tick) > 0)
+			map->state_unitsetting(&sd->bl, u.skill_id, u.skill_lv, u.x, u.y, (int)DIFF_TICK(u.expire, tick));
+	}
+}
+
 /**
  * Checks if both dirs point in the same direction.
  * @param s_dir: direction source is facing
@@ -3154,7 +4097,8 @@ static int map_cell2gat(struct mapcell cell)
 }
 
 /**
- * Extracts a map's cell data from its compressed mapcache.
+ * Extracts a map's cell data from its compressed mapcache, or from the cell
+ * types in the shared map cache.
  *
  * @param[in, out] m The target map.
  */
@@ -3162,8 +4106,20 @@ static void map_cellfromcache(struct map_data *m)
 {
 	nullpo_retv(m);
 
-	if (m->cell_buf.data != NULL) {
-		char decode_buffer[MAX_MAP_SIZE];
+	if (m->shared_cell != NULL) {
+		int i;
+
+		// used in place, the pages this process changes are copied on write
+		m->cell = m->shared_cell;
+
+		m->getcellp = map->getcellp;
+		m->setcell  = map->setcell;
+
+		for(i = 0; i < m->npc_num; i++) {
+			npc->setcells(m->npc[i]);
+		}
+	} else if (m->cell_buf.data != NULL) {
+		uint8 decode_buffer[MAX_MAP_SIZE];
 		unsigned long size, xy;
 		int i;
 
@@ -3574,6 +4530,299 @@ static bool map_readfromcache_v1(FILE *fp, struct map_data *m, unsigned int file
 	return true;
 }
 
+/**
+ * Reads the header of a map's mapcache file.
+ *
+ * @param[in]  mapname The map name.
+ * @param[out] header  The header.
+ * @return The reading success state.
+ */
+static bool map_readcache_header(const char *mapname, struct map_cache_header *header)
+{
+	char file_path[256];
+	FILE *fp;
+	bool retval;
+
+	nullpo_retr(false, mapname);
+	nullpo_retr(false, header);
+
+	snprintf(file_path, sizeof(file_path), "%s%s%s.%s", "maps/", DBPATH, mapname, "mcache");
+	if ((fp = fopen(file_path, "rb")) == NULL)
+		return false;
+	retval = (fread(header, sizeof(*header), 1, fp) == 1 && header->version == 1);
+	fclose(fp);
+	return retval;
+}
+
+/**
+ * Compares two shared map cache entries by map name.
+ */
+static int map_shared_cache_compare(const void *a, const void *b)
+{
+	const struct map_shared_cache_entry *entry_a = a;
+	const struct map_shared_cache_entry *entry_b = b;
+
+	return strncmp(entry_a->name, entry_b->name, MAP_NAME_LENGTH);
+}
+
+/**
+ * Reads a map's cells from the attached shared map cache.
+ *
+ * The map is only taken from the shared map cache when its mapcache file
+ * still has the checksum recorded at export time. The cells are used in place
+ * when the map's cells are first accessed (see map_cellfromcache).
+ *
+ * @param[in,out] m The target map.
+ * @return The loading success state.
+ * @retval false if no shared map cache is attached, or the map isn't in it or changed since it was exported.
+ */
+static bool map_readfromshared(struct map_data *m)
+{
+	struct map_shared_cache_entry key = { 0 };
+	const struct map_shared_cache_entry *entry;
+	struct map_cache_header header;
+
+	nullpo_retr(false, m);
+
+	if (map->shared_cache.data == NULL)
+		return false;
+
+	safestrncpy(key.name, m->name, sizeof(key.name));
+	entry = bsearch(&key, map->shared_cache.entries, map->shared_cache.count, sizeof(*entry), map->shared_cache_compare);
+	if (entry == NULL)
+		return false;
+
+	if (!map->readcache_header(m->name, &header)
+	 || memcmp(header.md5_checksum, entry->md5_checksum, sizeof(header.md5_checksum)) != 0
+	 || header.xs != entry->xs || header.ys != entry->ys) {
+		ShowWarning("map_readfromshared: Map '%s' changed since the shared map cache was exported, export it again.\n", m->name);
+		return false;
+	}
+
+	m->xs = entry->xs;
+	m->ys = entry->ys;
+	m->shared_cell = (struct mapcell *)(map->shared_cache.data + entry->offset);
+	m->cell = (struct mapcell *)0xdeadbeaf;
+
+	return true;
+}
+
+/**
+ * Attaches a shared map cache file.
+ *
+ * The file is mapped privately: its pages are shared by every map-server
+ * process attaching it, until a process changes a cell (setcell, NPC cells,
+ * icewalls...), which copies that page for the process.
+ *
+ * @param filename The shared map cache file.
+ * @return The attaching success state.
+ */
+static bool map_shared_cache_attach(const char *filename)
+{
+#ifdef _WIN32
+	nullpo_retr(false, filename);
+	ShowWarning("map_shared_cache_attach: Shared map caches are not supported on this platform, '%s' was not attached.\n", filename);
+	return false;
+#else
+	const struct map_shared_cache_header *header;
+	const struct map_shared_cache_entry *entries;
+	struct stat st;
+	void *data;
+	uint32 i;
+	int fd;
+
+	nullpo_retr(false, filename);
+
+	map->shared_cache_detach();
+
+	if ((fd = open(filename, O_RDONLY)) < 0) {
+		ShowError("map_shared_cache_attach: Could not open the shared map cache '%s'.\n", filename);
+		return false;
+	}
+	if (fstat(fd, &st) != 0 || (uint64)st.st_size < sizeof(*header)) {
+		ShowError("map_shared_cache_attach: '%s' is not a shared map cache.\n", filename);
+		close(fd);
+		return false;
+	}
+	data = mmap(NULL, (size_t)st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED) {
+		ShowError("map_shared_cache_attach: Could not map the shared map cache '%s'.\n", filename);
+		return false;
+	}
+
+	header = data;
+	entries = (const struct map_shared_cache_entry *)(header + 1);
+	if (memcmp(header->magic, MAP_SHARED_CACHE_MAGIC, sizeof(header->magic)) != 0
+	 || header->version != MAP_SHARED_CACHE_VERSION || header->byte_order != MAP_SHARED_CACHE_BYTE_ORDER
+	 || header->cell_size != sizeof(struct mapcell)
+	 || header->size != (uint64)st.st_size
+	 || header->count > (header->size - sizeof(*header)) / sizeof(*entries)) {
+		ShowError("map_shared_cache_attach: '%s' is not a valid shared map cache for this build, export it again.\n", filename);
+		munmap(data, (size_t)st.st_size);
+		return false;
+	}
+	for (i = 0; i < header->count; i++) {
+		uint64 cells = (uint64)entries[i].xs * (uint64)entries[i].ys;
+		if (entries[i].xs <= 0 || entries[i].ys <= 0 || cells > MAX_MAP_SIZE
+		 || entries[i].offset % MAP_SHARED_CACHE_ALIGN != 0
+		 || entries[i].offset > header->size || cells * sizeof(struct mapcell) > header->size - entries[i].offset
+		 || (i > 0 && map->shared_cache_compare(&entries[i - 1], &entries[i]) >= 0)) {
+			ShowError("map_shared_cache_attach: Invalid entry %u in the shared map cache '%s'.\n", i, filename);
+			munmap(data, (size_t)st.st_size);
+			return false;
+		}
+	}
+
+	map->shared_cache.data = data;
+	map->shared_cache.size = (size_t)st.st_size;
+	map->shared_cache.entries = entries;
+	map->shared_cache.count = header->count;
+
+	ShowStatus("Attached the shared map cache '"CL_WHITE"%s"CL_RESET"' (%u maps, %"PRIu64" bytes).\n", filename, header->count, header->size);
+	return true;
+#endif // _WIN32
+}
+
+/**
+ * Detaches the shared map cache, if any.
+ *
+ * Must not be called while maps still use it (see map_data::shared_cell).
+ */
+static void map_shared_cache_detach(void)
+{
+	if (map->shared_cache.data == NULL)
+		return;
+#ifndef _WIN32
+	munmap(map->shared_cache.data, map->shared_cache.size);
+#endif // _WIN32
+	memset(&map->shared_cache, 0, sizeof(map->shared_cache));
+}
+
+/**
+ * Writes the cells of every loaded map to a shared map cache file.
+ *
+ * Only the cell types of the map cache are exported, not the cells changed
+ * at run time. Every map must have a mapcache file, whose checksum is
+ * recorded to detect maps changed after the export.
+ *
+ * The file is written next to the target and renamed over it, so servers
+ * already attached to the previous file keep using it until they restart.
+ *
+ * @param filename The target file.
+ * @return The export success state.
+ */
+static bool map_shared_cache_write(const char *filename)
+{
+	static const uint8 padding[MAP_SHARED_CACHE_ALIGN] = { 0 };
+	struct map_shared_cache_header header = { 0 };
+	struct map_shared_cache_entry *entries;
+	struct mapcell *cells;
+	uint8 *gat;
+	char tmp_path[300];
+	uint64 offset;
+	FILE *fp;
+	int i;
+	bool retval = true;
+
+	nullpo_retr(false, filename);
+
+	if (map->count <= 0) {
+		ShowError("map_shared_cache_write: No maps were loaded, nothing to export.\n");
+		return false;
+	}
+
+	CREATE(entries, struct map_shared_cache_entry, map->count);
+	for (i = 0; i < map->count; i++) {
+		struct map_cache_header mheader;
+
+		if (!map->readcache_header(map->list[i].name, &mheader)) {
+			ShowError("map_shared_cache_write: No mapcache file for map '%s'.\n", map->list[i].name);
+			aFree(entries);
+			return false;
+		}
+		safestrncpy(entries[i].name, map->list[i].name, sizeof(entries[i].name));
+		entries[i].xs = map->list[i].xs;
+		entries[i].ys = map->list[i].ys;
+		memcpy(entries[i].md5_checksum, mheader.md5_checksum, sizeof(entries[i].md5_checksum));
+	}
+	qsort(entries, map->count, sizeof(*entries), map->shared_cache_compare);
+
+	offset = sizeof(header) + (uint64)map->count * sizeof(*entries);
+	for (i = 0; i < map->count; i++) {
+		offset = (offset + MAP_SHARED_CACHE_ALIGN - 1) / MAP_SHARED_CACHE_ALIGN * MAP_SHARED_CACHE_ALIGN;
+		entries[i].offset = offset;
+		offset += (uint64)entries[i].xs * (uint64)entries[i].ys * sizeof(struct mapcell);
+	}
+
+	memcpy(header.magic, MAP_SHARED_CACHE_MAGIC, sizeof(header.magic));
+	header.version = MAP_SHARED_CACHE_VERSION;
+	header.byte_order = MAP_SHARED_CACHE_BYTE_ORDER;
+	header.cell_size = (uint32)sizeof(struct mapcell);
+	header.count = (uint32)map->count;
+	header.size = offset;
+
+	snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", filename);
+	if ((fp = fopen(tmp_path, "wb")) == NULL) {
+		ShowError("map_shared_cache_write: Could not open '%s' for writing.\n", tmp_path);
+		aFree(entries);
+		return false;
+	}
+	if (fwrite(&header, sizeof(header), 1, fp) != 1 || fwrite(entries, sizeof(*entries), map->count, fp) != (size_t)map->count)
+		retval = false;
+
+	CREATE(gat, uint8, MAX_MAP_SIZE);
+	CREATE(cells, struct mapcell, MAX_MAP_SIZE);
+	offset = sizeof(header) + (uint64)map->count * sizeof(*entries);
+	for (i = 0; i < map->count && retval; i++) {
+		struct map_data *m = &map->list[map->mapname2mapid(entries[i].name)];
+		unsigned long size = (unsigned long)m->xs * (unsigned long)m->ys;
+		unsigned long xy;
+
+		if (m->shared_cell != NULL) {
+			for (xy = 0; xy < size; xy++)
+				gat[xy] = (uint8)map->cell2gat(m->shared_cell[xy]);
+		} else if (m->cell_buf.data != NULL) {
+			grfio->decode_zip(gat, &size, m->cell_buf.data, m->cell_buf.len);
+		} else {
+			ShowError("map_shared_cache_write: No cell data for map '%s'.\n", m->name);
+			retval = false;
+			break;
+		}
+		// only the terrain, without the cells set at run time
+		for (xy = 0; xy < size; xy++)
+			cells[xy] = map->gat2cell(gat[xy]);
+
+		if (entries[i].offset > offset && fwrite(padding, (size_t)(entries[i].offset - offset), 1, fp) != 1)
+			retval = false;
+		if (fwrite(cells, sizeof(*cells), size, fp) != size)
+			retval = false;
+		offset = entries[i].offset + (uint64)size * sizeof(*cells);
+	}
+	aFree(cells);
+	aFree(gat);
+	aFree(entries);
+
+	if (fclose(fp) != 0)
+		retval = false;
+	if (!retval) {
+		ShowError("map_shared_cache_write: Could not write the shared map cache '%s'.\n", tmp_path);
+		remove(tmp_path);
+		return false;
+	}
+#ifdef _WIN32
+	remove(filename); // rename doesn't replace existing files
+#endif // _WIN32
+	if (rename(tmp_path, filename) != 0) {
+		ShowError("map_shared_cache_write: Could not rename '%s' to '%s'.\n", tmp_path, filename);
+		remove(tmp_path);
+		return false;
+	}
+
+	ShowStatus("Exported '"CL_WHITE"%u"CL_RESET"' maps to the shared map cache '"CL_WHITE"%s"CL_RESET"' (%"PRIu64" bytes).\n", header.count, filename, header.size);
+	return true;
+}
+
 /**
  * Adds a new empty map to the map list.
  *
@@ -3697,7 +4946,7 @@ static void map_clean(int i)
 {
 	Assert_retv(i >= 0 && i < map->count);
 
-	if (map->list[i].cell && map->list[i].cell != (struct mapcell *)0xdeadbeaf)
+	if (map->list[i].cell && map->list[i].cell != (struct mapcell *)0xdeadbeaf && map->list[i].cell != map->list[i].shared_cell)
 		aFree(map->list[i].cell);
 	if (map->list[i].block)
 		aFree(map->list[i].block);
@@ -3755,6 +5004,10 @@ static void map_clean(int i)
 		channel->delete_(map->list[i].channel);
 
 	VECTOR_CLEAR(map->list[i].qi_list);
+	if (map->list[i].migration.mob_ids != NULL)
+		db_destroy(map->list[i].migration.mob_ids);
+	VECTOR_CLEAR(map->list[i].migration.spawn_mobs);
+	VECTOR_CLEAR(map->list[i].migration.units);
 	HPM->data_store_destroy(&map->list[i].hdata);
 }
 static void do_final_maps(void)
@@ -3982,6 +5235,8 @@ static int map_readallmaps(void)
 	int i;
 	int maps_removed = 0;
 
+	int maps_shared = 0;
+
 	if (map->enable_grf) {
 		ShowStatus("Loading maps (using GRF files)...\n");
 	} else {
@@ -3996,7 +5251,9 @@ static int map_readallmaps(void)
 			ShowStatus("Loading maps [%i/%i]: %s"CL_CLL"\r", i, map->count, map->list[i].name);
 
 		// try to load the map
-		if( !
+		if (!map->enable_grf && map->readfromshared(&map->list[i])) {
+			maps_shared++;
+		} else if( !
 			(map->enable_grf?
 			map->readgat(&map->list[i])
 			:map->readfromcache(&map->list[i]))
@@ -4026,6 +5283,9 @@ static int map_readallmaps(void)
 
 		memset(map->list[i].moblist, 0, sizeof(map->list[i].moblist)); //Initialize moblist [Skotlex]
 		map->list[i].mob_delete_timer = INVALID_TIMER; //Initialize timer [Skotlex]
+		map->list[i].migration.mob_ids = NULL;
+		VECTOR_INIT(map->list[i].migration.spawn_mobs);
+		VECTOR_INIT(map->list[i].migration.units);
 
 		map->list[i].bxs = (map->list[i].xs + BLOCK_SIZE - 1) / BLOCK_SIZE;
 		map->list[i].bys = (map->list[i].ys + BLOCK_SIZE - 1) / BLOCK_SIZE;
@@ -4045,6 +5305,8 @@ static int map_readallmaps(void)
 	ShowInfo("Successfully loaded '"CL_WHITE"%d"CL_RESET"' maps."CL_CLL"\n",map->count);
 	instance->start_id = map->count; // Next Map Index will be instances
 
+	if (maps_shared)
+		ShowInfo("Maps read from the shared map cache: '"CL_WHITE"%d"CL_RESET"'\n", maps_shared);
 	if (maps_removed)
 		ShowNotice("Maps removed: '"CL_WHITE"%d"CL_RESET"'\n",maps_removed);
 
@@ -4165,6 +5427,14 @@ static bool map_config_read_inter(const char *filename, struct config_t *config,
 	if (libconfig->setting_lookup_string(setting, "bind_ip", &str) == CONFIG_TRUE)
 		clif->setbindip(str);
 
+	// Character save link
+	libconfig->setting_lookup_bool_real(setting, "save_delta", &chrif->save_delta);
+	libconfig->setting_lookup_bool_real(setting, "save_compress", &chrif->save_compress);
+	if (libconfig->setting_lookup_int(setting, "save_full_interval", &chrif->save_full_interval) == CONFIG_TRUE) {
+		if (chrif->save_full_interval < 0)
+			chrif->save_full_interval = 0;
+	}
+
 	return true;
 }
 
@@ -4204,6 +5474,19 @@ static bool map_config_read_database(const char *filename, struct config_t *conf
 		if (map->minsave_interval < 1)
 			map->minsave_interval = 1;
 	}
+	if (libconfig->setting_lookup_int(setting, "autosave_priority_time", &map->autosave_priority_interval) == CONFIG_TRUE) {
+		if (map->autosave_priority_interval < 1) // Same as any other change
+			map->autosave_priority_interval = 0;
+		else
+			map->autosave_priority_interval *= 1000; // Pass from s to ms
+	}
+	if (libconfig->setting_lookup_int(setting, "autosave_batch", &map->autosave_batch) == CONFIG_TRUE) {
+		map->autosave_batch = cap_value(map->autosave_batch, 1, PC_AUTOSAVE_BATCH_MAX);
+	}
+	if (libconfig->setting_lookup_int(setting, "autosave_bytes_per_second", &map->autosave_bytes_per_second) == CONFIG_TRUE) {
+		if (map->autosave_bytes_per_second < 0)
+			map->autosave_bytes_per_second = 0;
+	}
 
 	return true;
 }
@@ -4317,6 +5600,12 @@ static bool map_config_read(const char *filename, bool imported)
 	libconfig->setting_lookup_mutable_string(setting, "charhelp_txt", map->charhelp_txt, sizeof(map->charhelp_txt));
 	libconfig->setting_lookup_bool(setting, "enable_spy", &map->enable_spy);
 	libconfig->setting_lookup_bool(setting, "use_grf", &map->enable_grf);
+	libconfig->setting_lookup_mutable_string(setting, "shared_map_cache", map->shared_cache_file, sizeof(map->shared_cache_file));
+	libconfig->setting_lookup_mutable_string(setting, "map_stats_file", map->stats_file, sizeof(map->stats_file));
+	if (libconfig->setting_lookup_int(setting, "map_stats_interval", &map->stats_interval) == CONFIG_TRUE && map->stats_interval < 1) {
+		ShowWarning("map_config_read: map_stats_interval must be at least 1 second, defaulting to 10.\n");
+		map->stats_interval = 10;
+	}
 	libconfig->setting_lookup_mutable_string(setting, "default_language", map->default_lang_str, sizeof(map->default_lang_str));
 
 	if (!map->config_read_console(filename, &config, imported))
@@ -6595,8 +7884,14 @@ int do_final(void)
 		if (map->list[i].cell_buf.data != NULL)
 			aFree(map->list[i].cell_buf.data);
 		map->list[i].cell_buf.len = 0;
+		map->list[i].shared_cell = NULL;
 	}
 	aFree(map->list);
+	map->shared_cache_detach();
+	if (map->shared_cache_export != NULL) {
+		aFree(map->shared_cache_export);
+		map->shared_cache_export = NULL;
+	}
 
 	if( map->block_free )
 		aFree(map->block_free);
@@ -6720,6 +8015,15 @@ static CPCMD(gm_use)
 
 	map->cpsd_active = false;
 }
+static CPCMD(mob_pool)
+{
+	const struct mob_pool *pool = &mob->pool;
+
+	ShowInfo("mob_data: %"PRIu64" given, %"PRIu64" reused from the pool (allocations avoided), %"PRIu64" released, %d kept in the pool.\n",
+		pool->allocs, pool->reused, pool->released, VECTOR_LENGTH(pool->free));
+	ShowInfo("Respawns: %"PRIu64" queued, %"PRIu64" timers added (%"PRIu64" avoided), %"PRIu64" batches run.\n",
+		pool->respawns, pool->respawn_timers, pool->respawns > pool->respawn_timers ? pool->respawns - pool->respawn_timers : 0, pool->respawn_batches);
+}
 /* Hercules Console Parser */
 static void map_cp_defaults(void)
 {
@@ -6735,6 +8039,7 @@ static void map_cp_defaults(void)
 
 	console->input->addCommand("gm:info",CPCMD_A(gm_position));
 	console->input->addCommand("gm:use",CPCMD_A(gm_use));
+	console->input->addCommand("mob:pool",CPCMD_A(mob_pool));
 #endif
 }
 
@@ -6926,6 +8231,22 @@ static CMDLINEARG(scriptcheck)
 	map->scriptcheck = true;
 	return true;
 }
+/**
+ * --export-shared-mapcache handler
+ *
+ * Loads the maps, writes their cell types to a shared map cache file and
+ * quits without running.
+ * @see cmdline->exec
+ */
+static CMDLINEARG(exportsharedmapcache)
+{
+	map->minimal = true;
+	core->runflag = CORE_ST_STOP;
+	if (map->shared_cache_export != NULL)
+		aFree(map->shared_cache_export);
+	map->shared_cache_export = aStrdup(params);
+	return true;
+}
 /**
  * --load-script handler
  *
@@ -6956,6 +8277,7 @@ void cmdline_args_init_local(void)
 	CMDLINEARG_DEF2(log-config, logconfig, "Alternative logging configuration.", CMDLINE_OPT_NORMAL|CMDLINE_OPT_PARAM);
 	CMDLINEARG_DEF2(script-check, scriptcheck, "Doesn't run the server, only tests the scripts passed through --load-script.", CMDLINE_OPT_SILENT);
 	CMDLINEARG_DEF2(load-script, loadscript, "Loads an additional script (can be repeated).", CMDLINE_OPT_NORMAL|CMDLINE_OPT_PARAM);
+	CMDLINEARG_DEF2(export-shared-mapcache, exportsharedmapcache, "Writes the loaded maps to a shared map cache file and quits.", CMDLINE_OPT_NORMAL|CMDLINE_OPT_PARAM);
 }
 
 int do_init(int argc, char *argv[])
@@ -7088,13 +8410,22 @@ int do_init(int argc, char *argv[])
 	if (map->enable_grf)
 		grfio->init(map->GRF_PATH_FILENAME);
 
+	if (map->shared_cache_export == NULL && map->shared_cache_file[0] != '\0')
+		map->shared_cache_attach(map->shared_cache_file);
+
 	map->readallmaps();
 
+	if (map->shared_cache_export != NULL && !map->shared_cache_write(map->shared_cache_export))
+		map->retval = EXIT_FAILURE;
+
 	if (!minimal) {
 		timer->add_func_list(map->freeblock_timer, "map_freeblock_timer");
 		timer->add_func_list(map->clearflooritem_timer, "map_clearflooritem_timer");
 		timer->add_func_list(map->removemobs_timer, "map_removemobs_timer");
 		timer->add_interval(timer->gettick()+1000, map->freeblock_timer, 0, 0, 60*1000);
+		timer->add_func_list(map->stats_timer, "map_stats_timer");
+		map->stats_tick = timer->gettick();
+		timer->add_interval(map->stats_tick + map->stats_interval * 1000, map->stats_timer, 0, 0, map->stats_interval * 1000);
 
 	}
 	HPM->event(HPET_INIT);
@@ -7216,6 +8547,9 @@ void map_defaults(void)
 
 	map->autosave_interval = DEFAULT_MAP_AUTOSAVE_INTERVAL;
 	map->minsave_interval = 100;
+	map->autosave_priority_interval = 60000;
+	map->autosave_batch = 8;
+	map->autosave_bytes_per_second = 0;
 	map->save_settings = 0xFFFF;
 	map->agit_flag = 0;
 	map->agit2_flag = 0;
@@ -7248,8 +8582,15 @@ void map_defaults(void)
 	map->ip_set = 0;
 	map->char_ip_set = 0;
 	map->enable_grf = 0;
+	map->shared_cache_file[0] = '\0';
+	map->shared_cache_export = NULL;
+	map->stats_file[0] = '\0';
+	map->stats_interval = 10;
+	map->stats_tick = 0;
+	memset(&map->shared_cache, 0, sizeof(map->shared_cache));
 
 	memset(&map->index2mapid, -1, sizeof(map->index2mapid));
+	memset(&map->owner, 0, sizeof(map->owner));
 
 	map->id_db = NULL;
 	map->pc_db = NULL;
@@ -7380,6 +8721,28 @@ PRAGMA_GCC9(GCC diagnostic pop)
 	map->id2bl = map_id2bl;
 	map->blid_exists = map_blid_exists;
 	map->mapindex2mapid = map_mapindex2mapid;
+	map->setipport = map_setipport;
+	map->mapindex2ipport = map_mapindex2ipport;
+	map->eraseallipport = map_eraseallipport;
+	map->standby_evacuate = map_standby_evacuate;
+	map->state_send = map_state_send;
+	map->state_push = map_state_push;
+	map->state_flush = map_state_flush;
+	map->state_send_mobs = map_state_send_mobs;
+	map->state_send_items = map_state_send_items;
+	map->state_send_npcs = map_state_send_npcs;
+	map->state_send_npc_vars = map_state_send_npc_vars;
+	map->state_send_npc_var = map_state_send_npc_var;
+	map->state_send_units = map_state_send_units;
+	map->state_clear = map_state_clear;
+	map->state_recv = map_state_recv;
+	map->state_recv_mob = map_state_recv_mob;
+	map->state_recv_item = map_state_recv_item;
+	map->state_recv_npc = map_state_recv_npc;
+	map->state_recv_npc_var = map_state_recv_npc_var;
+	map->state_recv_unit = map_state_recv_unit;
+	map->state_unitsetting = map_state_unitsetting;
+	map->state_units_load = map_state_units_load;
 	map->mapname2mapid = map_mapname2mapid;
 	map->addiddb = map_addiddb;
 	map->deliddb = map_deliddb;
@@ -7416,6 +8779,13 @@ PRAGMA_GCC9(GCC diagnostic pop)
 	map->do_shutdown = do_shutdown;
 
 	map->freeblock_timer = map_freeblock_timer;
+	map->stats_type_index = map_stats_type_index;
+	map->stats_type_name = map_stats_type_name;
+	map->stats_counter_name = map_stats_counter_name;
+	map->stats_load = map_stats_load;
+	map->stats_sample = map_stats_sample;
+	map->stats_dump = map_stats_dump;
+	map->stats_timer = map_stats_timer;
 	map->searchrandfreecell = map_searchrandfreecell;
 	map->count_sub = map_count_sub;
 	map->create_charid2nick = create_charid2nick;
@@ -7429,6 +8799,12 @@ PRAGMA_GCC9(GCC diagnostic pop)
 	map->iwall_nextxy = map_iwall_nextxy;
 	map->readfromcache = map_readfromcache;
 	map->readfromcache_v1 = map_readfromcache_v1;
+	map->readcache_header = map_readcache_header;
+	map->readfromshared = map_readfromshared;
+	map->shared_cache_attach = map_shared_cache_attach;
+	map->shared_cache_detach = map_shared_cache_detach;
+	map->shared_cache_write = map_shared_cache_write;
+	map->shared_cache_compare = map_shared_cache_compare;
 	map->addmap = map_addmap;
 	map->delmapid = map_delmapid;
 	map->zone_db_clear = map_zone_db_clear;
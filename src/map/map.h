@@ -35,6 +35,11 @@
 /* Forward Declarations */
 struct Sql; // common/sql.h
 struct config_t; // common/conf.h
+struct chrif_map_state_item; // common/mapcharpackets.h
+struct chrif_map_state_mob; // common/mapcharpackets.h
+struct chrif_map_state_npc; // common/mapcharpackets.h
+struct chrif_map_state_npc_var; // common/mapcharpackets.h
+struct chrif_map_state_unit; // common/mapcharpackets.h
 struct mob_data;
 struct npc_data;
 struct channel_data;
@@ -499,6 +504,9 @@ struct spawn_data {
 		uint8 boss;    ///< 0: Non-boss monster | 1: Boss monster | 2: MVP
 	} state;
 	char name[NAME_LENGTH], eventname[EVENT_NAME_LENGTH]; //Name/event
+	struct mob_data *respawn_queue; ///< Dead mobs of the group waiting for their respawn (see mob->queue_respawn)
+	int respawn_timer;              ///< Timer respawning the queued mobs that are due, or INVALID_TIMER
+	int64 respawn_tick;             ///< Tick of respawn_timer
 };
 
 struct flooritem_data {
@@ -942,6 +950,27 @@ struct map_zone_data {
 	} info;
 };
 
+/// Activity counters kept per map (see map->stats_sample).
+enum map_stats_counter {
+	MAP_STATS_AI_THINKS,     ///< Runs of the monster AI
+	MAP_STATS_PATH_SEARCHES, ///< Path searches
+	MAP_STATS_AREA_PACKETS,  ///< Packets broadcast to an area
+	MAP_STATS_BYTES_SENT,    ///< Bytes of those packets, once per player receiving them
+	MAP_STATS_AREA_SCANS,    ///< Object searches in an area (bl_getall_area)
+	MAP_STATS_AREA_BLOCKS,   ///< Block lists visited by those searches
+	MAP_STATS_MAX
+};
+
+#define MAP_STATS_BL_TYPES 10 ///< Object types counted per map, BL_PC (0) to BL_ELEM (9)
+
+/// Objects and activity of a map, used to find the maps that take the most tick time.
+struct map_stats {
+	int objects[MAP_STATS_BL_TYPES];  ///< Objects in the blocks of the map, by bit of their bl_type
+	uint64 count[MAP_STATS_MAX];      ///< Cumulative counters
+	uint64 sampled[MAP_STATS_MAX];    ///< Counters at the last sample
+	unsigned int rate[MAP_STATS_MAX]; ///< Per second rates between the last two samples
+};
+
 struct map_drop_list {
 	int drop_id;
 	int drop_type;
@@ -953,6 +982,34 @@ struct map_drop_list {
  */
 #define MAPID_NONE -1
 
+/// Map-server owning a map, as told by the char-server.
+struct map_server_addr {
+	uint32 ip;   ///< Host byte order (0: no map-server)
+	uint16 port;
+};
+
+/// Size of the records of a map state packet (see map->state_send).
+#define MAP_STATE_BUFFER_SIZE 32768
+
+/// Records of the state of a map moved to another map-server, sent when full.
+struct map_state_buffer {
+	uint32 ip;        ///< Map-server the map moved to, host byte order
+	uint16 port;
+	uint16 map_index;
+	uint8 type;       ///< enum chrif_map_state_type of the records
+	int count;        ///< Number of records
+	int len;          ///< Length of the records
+	uint8 data[MAP_STATE_BUFFER_SIZE];
+};
+
+/// Ground skill of a moved map, set up again when its caster arrives.
+struct map_state_unit {
+	int char_id;
+	uint16 skill_id, skill_lv;
+	int16 x, y;
+	int64 expire;     ///< Tick the skill ends at
+};
+
 struct map_data {
 	char name[MAP_NAME_LENGTH];
 	uint16 index; // The map index used by the mapindex* functions.
@@ -978,6 +1035,7 @@ struct map_data {
 	int users;
 	int users_pvp;
 	int iwall_num; // Total of invisible walls in this map
+	bool standby; ///< Loaded here but owned by another map-server, players are sent there
 	struct map_flag {
 		unsigned town : 1; // [Suggestion to protect Mail System]
 		unsigned autotrade : 1;
@@ -1094,12 +1152,19 @@ struct map_data {
 		uint8 *data;
 		int len;
 	} cell_buf;
+	struct mapcell *shared_cell; ///< Cells of the map in the attached shared map cache, copied on write (NULL if not shared)
 
 	/* questinfo entries list */
 	VECTOR_DECL(struct npc_data *) qi_list;
 
 	/* speeds up clif_updatestatus processing by causing hpmeter to run only when someone with the permission can view it */
 	unsigned short hpmeter_visible;
+	struct map_stats stats; ///< Objects and activity counters
+	struct {
+		struct DBMap *mob_ids; ///< int id on the previous owner -> int id, while its state is received
+		VECTOR_DECL(int) spawn_mobs; ///< Permanent spawns not matched yet, while the state is received
+		VECTOR_DECL(struct map_state_unit) units; ///< Ground skills of characters not on the map yet
+	} migration; ///< State of the map received from its previous owner
 	struct hplugin_data_store *hdata; ///< HPM Plugin Data Store
 };
 
@@ -1237,6 +1302,19 @@ struct charid2nick {
 	struct charid_request* requests;// requests of notification on this nick
 };
 
+#define MAP_SHARED_CACHE_MAGIC "HMSC"
+#define MAP_SHARED_CACHE_VERSION 2
+#define MAP_SHARED_CACHE_BYTE_ORDER 0x01020304
+#define MAP_SHARED_CACHE_ALIGN 4096 ///< Alignment of the cells of each map in the file, a page on most hosts
+
+/// Shared map cache attached by this process.
+struct map_shared_cache {
+	uint8 *data;                                  ///< Private (copy on write) mapping of the file (NULL if not attached)
+	size_t size;
+	const struct map_shared_cache_entry *entries; ///< Sorted by name
+	uint32 count;
+};
+
 // New mcache file format header
 #if !defined(sun) && (!defined(__NETBSD__) || __NetBSD_Version__ >= 600000000) // NetBSD 5 and Solaris don't like pragma pack but accept the packed attribute
 #pragma pack(push, 1)
@@ -1248,6 +1326,32 @@ struct map_cache_header {
 	int16 ys;
 	int32 len;
 } __attribute__((packed));
+
+/**
+ * Shared map cache file (see map->shared_cache_write).
+ *
+ * The file holds the header, the entries sorted by map name and, for every
+ * entry, the xs * ys decoded cells of the map (struct mapcell, aligned to
+ * MAP_SHARED_CACHE_ALIGN). Offsets are relative to the start of the file, so
+ * the file can be mapped at any address by any number of map-server
+ * processes. Fields are in the byte order and cell layout of the build that
+ * exported it.
+ */
+struct map_shared_cache_header {
+	char magic[4];      ///< MAP_SHARED_CACHE_MAGIC
+	uint32 version;     ///< MAP_SHARED_CACHE_VERSION
+	uint32 byte_order;  ///< MAP_SHARED_CACHE_BYTE_ORDER
+	uint32 cell_size;   ///< sizeof(struct mapcell)
+	uint32 count;       ///< Number of entries
+	uint64 size;        ///< Size of the whole file
+} __attribute__((packed));
+struct map_shared_cache_entry {
+	char name[MAP_NAME_LENGTH];
+	int16 xs;
+	int16 ys;
+	uint8 md5_checksum[16]; ///< Checksum of the map cache file of the map (map_cache_header::md5_checksum)
+	uint64 offset;      ///< Offset of the cells in the file
+} __attribute__((packed));
 #if !defined(sun) && (!defined(__NETBSD__) || __NetBSD_Version__ >= 600000000) // NetBSD 5 and Solaris don't like pragma pack but accept the packed attribute
 #pragma pack(pop)
 #endif // not NetBSD < 6 / Solaris
@@ -1272,6 +1376,9 @@ struct map_interface {
 
 	int autosave_interval;
 	int minsave_interval;
+	int autosave_priority_interval; ///< Max time a zeny/item/exp change waits for an autosave, in ms
+	int autosave_batch;             ///< Max characters saved per autosave run
+	int autosave_bytes_per_second;  ///< Autosave traffic budget to the char-server (0: unlimited)
 	int save_settings;
 	int agit_flag;
 	int agit2_flag;
@@ -1314,10 +1421,17 @@ struct map_interface {
 	uint16 port;
 	int users;
 	int enable_grf; //To enable/disable reading maps from GRF files, bypassing mapcache [blackhole89]
+	char shared_cache_file[256]; ///< Shared map cache to attach (empty: disabled)
+	char stats_file[256];        ///< File the map statistics are appended to (empty: disabled)
+	int stats_interval;          ///< Seconds between two samples of the map statistics
+	int64 stats_tick;            ///< Tick of the last sample of the map statistics
+	char *shared_cache_export;   ///< Target file of --export-shared-mapcache
+	struct map_shared_cache shared_cache;
 	bool ip_set;
 	bool char_ip_set;
 
 	int16 index2mapid[MAX_MAPINDEX];
+	struct map_server_addr owner[MAX_MAPINDEX]; ///< Map-server owning each map index
 	/* */
 	struct DBMap *id_db;     // int id -> struct block_list*
 	struct DBMap *pc_db;     // int id -> struct map_session_data*
@@ -1446,6 +1560,28 @@ END_ZEROED_BLOCK;
 	bool (*blid_exists) (int id);
 	int16 (*mapindex2mapid) (unsigned short map_index);
 	int16 (*mapname2mapid) (const char* name);
+	void (*setipport) (unsigned short map_index, uint32 ip, uint16 port);
+	bool (*mapindex2ipport) (unsigned short map_index, uint32 *ip, uint16 *port);
+	void (*eraseallipport) (void);
+	void (*standby_evacuate) (int16 m);
+	void (*state_send) (int16 m, uint32 ip, uint16 port);
+	void *(*state_push) (struct map_state_buffer *buf, uint8 type, int len);
+	void (*state_flush) (struct map_state_buffer *buf);
+	void (*state_send_mobs) (struct map_state_buffer *buf, int16 m);
+	void (*state_send_items) (struct map_state_buffer *buf, int16 m);
+	void (*state_send_npcs) (struct map_state_buffer *buf, int16 m);
+	void (*state_send_npc_vars) (struct map_state_buffer *buf, struct npc_data *nd);
+	void (*state_send_npc_var) (struct map_state_buffer *buf, const struct npc_data *nd, int id, unsigned int index, int value, const char *str);
+	void (*state_send_units) (struct map_state_buffer *buf, int16 m);
+	void (*state_clear) (int16 m, bool respawn);
+	void (*state_recv) (unsigned short map_index, uint8 type, const uint8 *data, int count, int len);
+	void (*state_recv_mob) (int16 m, const struct chrif_map_state_mob *p);
+	void (*state_recv_item) (int16 m, const struct chrif_map_state_item *p);
+	void (*state_recv_npc) (int16 m, const struct chrif_map_state_npc *p);
+	void (*state_recv_npc_var) (int16 m, const struct chrif_map_state_npc_var *p, const char *str);
+	void (*state_recv_unit) (int16 m, const struct chrif_map_state_unit *p);
+	void (*state_unitsetting) (struct block_list *src, uint16 skill_id, uint16 skill_lv, int16 x, int16 y, int limit);
+	void (*state_units_load) (struct map_session_data *sd);
 	void (*addiddb) (struct block_list *bl);
 	void (*deliddb) (struct block_list *bl);
 	/* */
@@ -1482,6 +1618,13 @@ END_ZEROED_BLOCK;
 	void (*do_shutdown) (void);
 
 	int (*freeblock_timer) (int tid, int64 tick, int id, intptr_t data);
+	int (*stats_type_index) (enum bl_type type);
+	const char *(*stats_type_name) (int index);
+	const char *(*stats_counter_name) (enum map_stats_counter counter);
+	unsigned int (*stats_load) (const struct map_data *m);
+	void (*stats_sample) (int64 tick);
+	void (*stats_dump) (int64 tick);
+	int (*stats_timer) (int tid, int64 tick, int id, intptr_t data);
 	int (*searchrandfreecell) (int16 m, const struct block_list *bl, int16 *x, int16 *y, int stack);
 	int (*count_sub) (struct block_list *bl, va_list ap);
 	struct DBData (*create_charid2nick) (union DBKey key, va_list args);
@@ -1495,6 +1638,12 @@ END_ZEROED_BLOCK;
 	void (*iwall_nextxy) (int16 x, int16 y, int8 dir, int pos, int16 *x1, int16 *y1);
 	bool (*readfromcache) (struct map_data *m);
 	bool (*readfromcache_v1) (FILE *fp, struct map_data *m, unsigned int file_size);
+	bool (*readcache_header) (const char *mapname, struct map_cache_header *header);
+	bool (*readfromshared) (struct map_data *m);
+	bool (*shared_cache_attach) (const char *filename);
+	void (*shared_cache_detach) (void);
+	bool (*shared_cache_write) (const char *filename);
+	int (*shared_cache_compare) (const void *a, const void *b);
 	int (*addmap) (const char *mapname);
 	void (*delmapid) (int id);
 	void (*zone_db_clear) (void);
@@ -389,7 +389,7 @@ static struct mob_data *mob_spawn_dataset(struct spawn_data *data, int npc_id)
 {
 	nullpo_retr(NULL, data);
 
-	struct mob_data *md = (struct mob_data *)aCalloc(1, sizeof(struct mob_data));
+	struct mob_data *md = mob->data_alloc();
 
 	memcpy(md->name, data->name, NAME_LENGTH);
 	md->bl.id = npc->get_new_npc_id();
@@ -512,7 +512,7 @@ static bool mob_ksprotected(struct block_list *src, struct block_list *target)
 		if( md->db->mexp || md->master_id )
 			return false; // MVP, Slaves mobs ignores KS
 
-		if( (sce = md->sc.data[SC_KSPROTECTED]) == NULL )
+		if( (sce = SC_ENTRY(&md->sc, SC_KSPROTECTED)) == NULL )
 			break; // No KS Protected
 
 		if( sd->bl.id == sce->val1 || // Same Owner
@@ -640,7 +640,7 @@ static int mob_once_spawn(struct map_session_data *sd, int16 m, int16 x, int16 y
 		ai &= ~0x200;
 	}
 
-	if (m < 0 || amount <= 0)
+	if (m < 0 || amount <= 0 || map->list[m].standby)
 		return 0;
 
 	struct mob_data *md = NULL;
@@ -833,6 +833,8 @@ static int mob_spawn_guardian(const char *mapname, short x, short y, const char
 		ShowWarning("mob_spawn_guardian: Map [%s] not found.\n", mapname);
 		return 0;
 	}
+	if (map->list[map_id].standby) // the map-server owning the castle spawns them
+		return 0;
 
 	if ((x <= 0 || y <= 0) && map->search_free_cell(NULL, map_id, &x, &y, -1, -1, SFC_XY_CENTER) != 0) {
 		ShowWarning("mob_spawn_guardian: Couldn't locate a spawn cell for guardian class %d (index %d) on castle map %s.\n",
@@ -949,6 +951,8 @@ static int mob_spawn_bg(const char *mapname, short x, short y, const char *mobna
 		ShowWarning("mob_spawn_bg: Map [%s] not found.\n", mapname);
 		return 0;
 	}
+	if (map->list[map_id].standby)
+		return 0;
 
 	if ((x <= 0 || y <= 0) && map->search_free_cell(NULL, map_id, &x, &y, -1, -1, SFC_XY_CENTER) != 0) {
 		ShowWarning("mob_spawn_bg: Couldn't locate a spawn cell for guardian class %d (bg_id %u) on map %s.\n", class_, bg_id, mapname);
@@ -1096,9 +1100,7 @@ static int mob_setdelayspawn(struct mob_data *md)
 	if (spawntime < 5000) //Monsters should never respawn faster than within 5 seconds
 		spawntime = 5000;
 
-	if( md->spawn_timer != INVALID_TIMER )
-		timer->delete_(md->spawn_timer, mob->delayspawn);
-	md->spawn_timer = timer->add(timer->gettick()+spawntime, mob->delayspawn, md->bl.id, 0);
+	mob->queue_respawn(md, timer->gettick() + spawntime);
 
 	// Clear per-target ground skill tick cache for the next natural life.
 	memset(md->ud.skillunittick, 0, sizeof(md->ud.skillunittick));
@@ -1106,6 +1108,195 @@ static int mob_setdelayspawn(struct mob_data *md)
 	return 0;
 }
 
+/**
+ * Gives a cleared mob_data, reused from mob->pool when possible.
+ *
+ * @return The mob data, to be released with mob->data_free (through map->freeblock).
+ */
+static struct mob_data *mob_data_alloc(void)
+{
+	struct mob_data *md;
+
+	mob->pool.allocs++;
+	if (VECTOR_LENGTH(mob->pool.free) > 0) {
+		md = VECTOR_POP(mob->pool.free);
+		memset(md, 0, sizeof(*md));
+		mob->pool.reused++;
+		return md;
+	}
+	CREATE(md, struct mob_data, 1);
+	return md;
+}
+
+/**
+ * Releases a mob_data, keeping it in mob->pool unless the pool is full.
+ * The mob must have been freed by unit->free.
+ *
+ * @param md The mob data.
+ */
+static void mob_data_free(struct mob_data *md)
+{
+	nullpo_retv(md);
+
+	if (!mob->pool.enabled || VECTOR_LENGTH(mob->pool.free) >= MOB_POOL_SIZE) {
+		mob->pool.released++;
+		aFree(md);
+		return;
+	}
+	VECTOR_ENSURE(mob->pool.free, 1, 256);
+	VECTOR_PUSH(mob->pool.free, md);
+}
+
+/**
+ * (Re)starts the respawn timer of a spawn group for its first due mob, and
+ * gives it to the queued mobs.
+ *
+ * @param spawn The spawn group, with a non-empty respawn queue.
+ */
+static void mob_respawn_settimer(struct spawn_data *spawn)
+{
+	struct mob_data *md;
+	int64 tick;
+
+	nullpo_retv(spawn);
+	nullpo_retv(spawn->respawn_queue);
+
+	tick = spawn->respawn_queue->respawn_tick;
+	for (md = spawn->respawn_queue->respawn_next; md != NULL; md = md->respawn_next) {
+		if (DIFF_TICK(md->respawn_tick, tick) < 0)
+			tick = md->respawn_tick;
+	}
+
+	if (spawn->respawn_timer != INVALID_TIMER) {
+		if (spawn->respawn_tick == tick)
+			return;
+		timer->delete_(spawn->respawn_timer, mob->spawn_batch);
+	}
+	spawn->respawn_timer = timer->add(tick, mob->spawn_batch, 0, (intptr_t)spawn);
+	spawn->respawn_tick = tick;
+	mob->pool.respawn_timers++;
+	for (md = spawn->respawn_queue; md != NULL; md = md->respawn_next)
+		md->spawn_timer = spawn->respawn_timer;
+}
+
+/**
+ * Queues the respawn of a dead mob in its spawn group.
+ * The group's timer runs at the tick of its first due mob, and respawns the
+ * mobs due within MOB_RESPAWN_BATCH_WINDOW ms with it (see mob->spawn_batch).
+ * While queued, md->spawn_timer holds the group's timer.
+ *
+ * @param md   The mob, with spawn data.
+ * @param tick The tick of the respawn.
+ */
+static void mob_queue_respawn(struct mob_data *md, int64 tick)
+{
+	struct spawn_data *spawn;
+
+	nullpo_retv(md);
+	nullpo_retv(md->spawn);
+
+	mob->dequeue_respawn(md);
+
+	spawn = md->spawn;
+	md->respawn_tick = tick;
+	md->respawn_next = spawn->respawn_queue;
+	spawn->respawn_queue = md;
+	mob->pool.respawns++;
+
+	if (spawn->respawn_timer != INVALID_TIMER && DIFF_TICK(spawn->respawn_tick, md->respawn_tick) <= 0) {
+		// Joins the pending timer, which requeues the mobs that aren't due yet
+		md->spawn_timer = spawn->respawn_timer;
+		return;
+	}
+	mob_respawn_settimer(spawn);
+}
+
+/**
+ * Removes a mob from the respawn queue of its spawn group (or stops its own
+ * mob->delayspawn timer), if it's waiting for its respawn.
+ *
+ * @param md The mob.
+ */
+static void mob_dequeue_respawn(struct mob_data *md)
+{
+	struct spawn_data *spawn;
+	struct mob_data **link;
+
+	nullpo_retv(md);
+
+	if (md->spawn_timer == INVALID_TIMER)
+		return;
+
+	spawn = md->spawn;
+	if (spawn == NULL || md->spawn_timer != spawn->respawn_timer) {
+		timer->delete_(md->spawn_timer, mob->delayspawn);
+		md->spawn_timer = INVALID_TIMER;
+		return;
+	}
+
+	for (link = &spawn->respawn_queue; *link != NULL && *link != md; link = &(*link)->respawn_next)
+		;
+	if (*link == md)
+		*link = md->respawn_next;
+	md->respawn_next = NULL;
+	md->spawn_timer = INVALID_TIMER;
+
+	if (spawn->respawn_queue == NULL) {
+		timer->delete_(spawn->respawn_timer, mob->spawn_batch);
+		spawn->respawn_timer = INVALID_TIMER;
+	}
+}
+
+/**
+ * Respawns the due mobs of a spawn group (timer function), and the ones due
+ * within MOB_RESPAWN_BATCH_WINDOW ms, so that they share the timer.
+ *
+ * @param data The spawn group (struct spawn_data *).
+ */
+static int mob_spawn_batch(int tid, int64 tick, int id, intptr_t data)
+{
+	struct spawn_data *spawn = (struct spawn_data *)data;
+	struct mob_data **link;
+
+	nullpo_ret(spawn);
+
+	if (spawn->respawn_timer != tid) {
+		ShowError("mob_spawn_batch: Timer mismatch: %d != %d\n", tid, spawn->respawn_timer);
+		return 0;
+	}
+	spawn->respawn_timer = INVALID_TIMER;
+	mob->pool.respawn_batches++;
+
+	// Takes the due mobs out of the queue first, as mob->spawn may queue them again
+	VECTOR_TRUNCATE(mob->pool.batch);
+	link = &spawn->respawn_queue;
+	while (*link != NULL) {
+		struct mob_data *md = *link;
+
+		if (DIFF_TICK(md->respawn_tick, tick) > MOB_RESPAWN_BATCH_WINDOW) {
+			md->spawn_timer = INVALID_TIMER; // Given the new timer below
+			link = &md->respawn_next;
+			continue;
+		}
+		*link = md->respawn_next;
+		md->respawn_next = NULL;
+		md->spawn_timer = INVALID_TIMER;
+		VECTOR_ENSURE(mob->pool.batch, 1, 64);
+		VECTOR_PUSH(mob->pool.batch, md->bl.id);
+	}
+	if (spawn->respawn_queue != NULL)
+		mob_respawn_settimer(spawn);
+
+	for (int i = 0; i < VECTOR_LENGTH(mob->pool.batch); i++) {
+		struct mob_data *md = map->id2md(VECTOR_INDEX(mob->pool.batch, i));
+
+		// A mob spawned earlier in the batch may have removed it
+		if (md != NULL && md->spawn == spawn && md->spawn_timer == INVALID_TIMER && md->bl.prev == NULL)
+			mob->spawn(md);
+	}
+	return 0;
+}
+
 static int mob_count_sub(struct block_list *bl, va_list ap)
 {
 	int mobid[10] = { 0 }, i;
@@ -1140,6 +1331,11 @@ static int mob_spawn(struct mob_data *md)
 	}
 
 	if (md->spawn) { //Respawn data
+		if (map->list[md->spawn->m].standby) {
+			// retry again later (the map-server owning the map spawns it)
+			mob->queue_respawn(md, tick + 5000);
+			return 1;
+		}
 		md->bl.m = md->spawn->m;
 		md->bl.x = md->spawn->x;
 		md->bl.y = md->spawn->y;
@@ -1149,16 +1345,12 @@ static int mob_spawn(struct mob_data *md)
 			int sfc_flag = (battle_config.no_spawn_on_player != 0) ? SFC_AVOIDPLAYER : SFC_DEFAULT;
 			if (map->search_free_cell(&md->bl, -1, &md->bl.x, &md->bl.y, md->spawn->xs, md->spawn->ys, sfc_flag) != 0) {
 				// retry again later
-				if( md->spawn_timer != INVALID_TIMER )
-					timer->delete_(md->spawn_timer, mob->delayspawn);
-				md->spawn_timer = timer->add(tick+5000,mob->delayspawn,md->bl.id,0);
+				mob->queue_respawn(md, tick + 5000);
 				return 1;
 			}
 		} else if( battle_config.no_spawn_on_player > 99 && map->foreachinrange(mob->count_sub, &md->bl, AREA_SIZE, BL_PC) ) {
 			// retry again later (players on sight)
-			if( md->spawn_timer != INVALID_TIMER )
-				timer->delete_(md->spawn_timer, mob->delayspawn);
-			md->spawn_timer = timer->add(tick+5000,mob->delayspawn,md->bl.id,0);
+			mob->queue_respawn(md, tick + 5000);
 			return 1;
 		}
 	}
@@ -1171,11 +1363,7 @@ static int mob_spawn(struct mob_data *md)
 	md->ud.state.attack_continue = 0;
 	md->ud.target_to = 0;
 	md->ud.dir = 0;
-	if( md->spawn_timer != INVALID_TIMER )
-	{
-		timer->delete_(md->spawn_timer, mob->delayspawn);
-		md->spawn_timer = INVALID_TIMER;
-	}
+	mob->dequeue_respawn(md);
 
 	//md->master_id = 0;
 	md->master_dist = 0;
@@ -1728,19 +1916,20 @@ static bool mob_ai_sub_hard(struct mob_data *md, int64 tick)
 		return false;
 
 	md->last_thinktime = tick;
+	map->list[md->bl.m].stats.count[MAP_STATS_AI_THINKS]++;
 
 	if (md->ud.skilltimer != INVALID_TIMER)
 		return false;
 
 	// Abnormalities
 	if(( md->sc.opt1 > 0 && md->sc.opt1 != OPT1_STONEWAIT && md->sc.opt1 != OPT1_BURNING && md->sc.opt1 != OPT1_CRYSTALIZE )
-	  || md->sc.data[SC_DEEP_SLEEP] || md->sc.data[SC_BLADESTOP] || md->sc.data[SC__MANHOLE] || md->sc.data[SC_CURSEDCIRCLE_TARGET]) {
+	  || SC_ENTRY(&md->sc, SC_DEEP_SLEEP) || SC_ENTRY(&md->sc, SC_BLADESTOP) || SC_ENTRY(&md->sc, SC__MANHOLE) || SC_ENTRY(&md->sc, SC_CURSEDCIRCLE_TARGET)) {
 		//Should reset targets.
 		md->target_id = md->attacked_id = 0;
 		return false;
 	}
 
-	if (md->sc.count && md->sc.data[SC_BLIND])
+	if (md->sc.count && SC_ENTRY(&md->sc, SC_BLIND))
 		view_range = 3;
 	else
 		view_range = md->db->range2;
@@ -1775,9 +1964,9 @@ static bool mob_ai_sub_hard(struct mob_data *md, int64 tick)
 			//Rude attacked check.
 			if (!battle->check_range(&md->bl, tbl, md->status.rhw.range)
 			 && ( //Can't attack back and can't reach back.
-			       (!can_move && DIFF_TICK(tick, md->ud.canmove_tick) > 0 && (battle_config.mob_ai&0x2 || (md->sc.data[SC_SPIDERWEB] && md->sc.data[SC_SPIDERWEB]->val1)
-			      || md->sc.data[SC_WUGBITE] || md->sc.data[SC_VACUUM_EXTREME] || md->sc.data[SC_THORNS_TRAP]
-			      || md->sc.data[SC__MANHOLE] // Not yet confirmed if boss will teleport once it can't reach target.
+			       (!can_move && DIFF_TICK(tick, md->ud.canmove_tick) > 0 && (battle_config.mob_ai&0x2 || (SC_ENTRY(&md->sc, SC_SPIDERWEB) && SC_ENTRY(&md->sc, SC_SPIDERWEB)->val1)
+			      || SC_ENTRY(&md->sc, SC_WUGBITE) || SC_ENTRY(&md->sc, SC_VACUUM_EXTREME) || SC_ENTRY(&md->sc, SC_THORNS_TRAP)
+			      || SC_ENTRY(&md->sc, SC__MANHOLE) // Not yet confirmed if boss will teleport once it can't reach target.
 			      || md->walktoxy_fail_count > 0)
 			       )
 			    || !mob->can_reach(md, tbl, md->min_chase, MSS_RUSH)
@@ -1791,7 +1980,7 @@ static bool mob_ai_sub_hard(struct mob_data *md, int64 tick)
 				return true;
 			}
 		}
-		else if( (abl = map->id2bl(md->attacked_id)) && (!tbl || mob->can_changetarget(md, abl, mode) || (md->sc.count && md->sc.data[SC__CHAOS]))) {
+		else if( (abl = map->id2bl(md->attacked_id)) && (!tbl || mob->can_changetarget(md, abl, mode) || (md->sc.count && SC_ENTRY(&md->sc, SC__CHAOS)))) {
 			int dist;
 			if( md->bl.m != abl->m || abl->prev == NULL
 			 || (dist = distance_bl(&md->bl, abl)) >= MAX_MINCHASE // Attacker longer than visual area
@@ -1799,9 +1988,9 @@ static bool mob_ai_sub_hard(struct mob_data *md, int64 tick)
 			 || (battle_config.mob_ai&0x2 && !status->check_skilluse(&md->bl, abl, 0, 0)) // Cannot normal attack back to Attacker
 			 || (!battle->check_range(&md->bl, abl, md->status.rhw.range) // Not on Melee Range and ...
 			    && ( // Reach check
-					(!can_move && DIFF_TICK(tick, md->ud.canmove_tick) > 0 && (battle_config.mob_ai&0x2 || (md->sc.data[SC_SPIDERWEB] && md->sc.data[SC_SPIDERWEB]->val1)
-						|| md->sc.data[SC_WUGBITE] || md->sc.data[SC_VACUUM_EXTREME] || md->sc.data[SC_THORNS_TRAP]
-						|| md->sc.data[SC__MANHOLE] // Not yet confirmed if boss will teleport once it can't reach target.
+					(!can_move && DIFF_TICK(tick, md->ud.canmove_tick) > 0 && (battle_config.mob_ai&0x2 || (SC_ENTRY(&md->sc, SC_SPIDERWEB) && SC_ENTRY(&md->sc, SC_SPIDERWEB)->val1)
+						|| SC_ENTRY(&md->sc, SC_WUGBITE) || SC_ENTRY(&md->sc, SC_VACUUM_EXTREME) || SC_ENTRY(&md->sc, SC_THORNS_TRAP)
+						|| SC_ENTRY(&md->sc, SC__MANHOLE) // Not yet confirmed if boss will teleport once it can't reach target.
 						|| md->walktoxy_fail_count > 0)
 					)
 					   || !mob->can_reach(md, abl, dist+md->db->range3, MSS_RUSH)
@@ -1858,7 +2047,7 @@ static bool mob_ai_sub_hard(struct mob_data *md, int64 tick)
 
 	if ((!tbl && mode&MD_AGGRESSIVE) || md->state.skillstate == MSS_FOLLOW) {
 		map->foreachinrange(mob->ai_sub_hard_activesearch, &md->bl, view_range, DEFAULT_ENEMY_TYPE(md), md, &tbl, mode);
-	} else if ((mode&MD_CHANGECHASE && (md->state.skillstate == MSS_RUSH || md->state.skillstate == MSS_FOLLOW)) || (md->sc.count && md->sc.data[SC__CHAOS])) {
+	} else if ((mode&MD_CHANGECHASE && (md->state.skillstate == MSS_RUSH || md->state.skillstate == MSS_FOLLOW)) || (md->sc.count && SC_ENTRY(&md->sc, SC__CHAOS))) {
 		int search_size;
 		search_size = view_range<md->status.rhw.range ? view_range:md->status.rhw.range;
 		map->foreachinrange (mob->ai_sub_hard_changechase, &md->bl, search_size, DEFAULT_ENEMY_TYPE(md), md, &tbl);
@@ -2586,13 +2775,13 @@ static int mob_dead(struct mob_data *md, struct block_list *src, int type)
 		int pnum = 0;
 
 #ifndef RENEWAL
-		if (md->sc.data[SC_RICHMANKIM] != NULL)
-			bonus += md->sc.data[SC_RICHMANKIM]->val2;
+		if (SC_ENTRY(&md->sc, SC_RICHMANKIM) != NULL)
+			bonus += SC_ENTRY(&md->sc, SC_RICHMANKIM)->val2;
 #endif
 
 		if(sd) {
 			temp = status->get_class(&md->bl);
-			if(sd->sc.data[SC_MIRACLE]) i = 2; //All mobs are Star Targets
+			if(SC_ENTRY(&sd->sc, SC_MIRACLE)) i = 2; //All mobs are Star Targets
 			else
 			ARR_FIND(0, MAX_PC_FEELHATE, i, temp == sd->hate_mob[i] &&
 				(battle_config.allow_skill_without_day || pc->sg_info[i].day_func()));
@@ -2766,11 +2955,11 @@ static int mob_dead(struct mob_data *md, struct block_list *src, int type)
 
 					drop_rate_bonus += sd->dropaddrace[md->status.race] + (is_boss(src) ? sd->dropaddrace[RC_BOSS] : sd->dropaddrace[RC_NONBOSS]); // bonus2 bDropAddRace[KeiKun]
 
-					if (sd->sc.data[SC_CASH_RECEIVEITEM] != NULL) // Increase drop rate if user has SC_CASH_RECEIVEITEM
-						drop_rate_bonus += sd->sc.data[SC_CASH_RECEIVEITEM]->val1;
+					if (SC_ENTRY(&sd->sc, SC_CASH_RECEIVEITEM) != NULL) // Increase drop rate if user has SC_CASH_RECEIVEITEM
+						drop_rate_bonus += SC_ENTRY(&sd->sc, SC_CASH_RECEIVEITEM)->val1;
 
-					if (sd->sc.data[SC_OVERLAPEXPUP] != NULL)
-						drop_rate_bonus += sd->sc.data[SC_OVERLAPEXPUP]->val2;
+					if (SC_ENTRY(&sd->sc, SC_OVERLAPEXPUP) != NULL)
+						drop_rate_bonus += SC_ENTRY(&sd->sc, SC_OVERLAPEXPUP)->val2;
 
 					if (drop_rate_bonus != 100) {
 						drop_rate = (int)(0.5 + drop_rate * drop_rate_bonus / 100.);
@@ -2973,7 +3162,7 @@ static int mob_dead(struct mob_data *md, struct block_list *src, int type)
 		mvp_sd = NULL;
 	}
 
-	rebirth =  ( md->sc.data[SC_KAIZEL] || (md->sc.data[SC_REBIRTH] && !md->state.rebirth) );
+	rebirth =  ( SC_ENTRY(&md->sc, SC_KAIZEL) || (SC_ENTRY(&md->sc, SC_REBIRTH) && !md->state.rebirth) );
 	if( !rebirth ) { // Only trigger event on final kill
 		md->status.hp = 0; //So that npc_event invoked functions KNOW that mob is dead
 		if( src ) {
@@ -3539,11 +3728,11 @@ static int mob_getfriendstatus_sub(struct block_list *bl, va_list ap)
 
 	if (cond2 == -1) { // Check for any of the common status alignments.
 		for (int i = SC_COMMON_MIN; i <= SC_COMMON_MAX; i++) {
-			if ((flag = (sc->data[i] != NULL)) != 0) // Once an effect was found, break out. [Skotlex]
+			if ((flag = (SC_ENTRY(sc, i) != NULL)) != 0) // Once an effect was found, break out. [Skotlex]
 				break;
 		}
 	} else {
-		flag = (sc->data[cond2] != NULL);
+		flag = (SC_ENTRY(sc, cond2) != NULL);
 	}
 
 	if ((flag ^ (cond1 == MSC_FRIENDSTATUSOFF)) != 0)
@@ -3650,11 +3839,11 @@ static int mob_use_skill(struct mob_data *md, int64 tick, int event)
 			case MSC_MYSTATUSOFF: // Status change x is inactive.
 				if (cond_data == -1) { // Check for any of the common status alignments.
 					for (int j = SC_COMMON_MIN; j <= SC_COMMON_MAX; j++) {
-						if ((flag = (md->sc.data[j] != NULL)) != 0)
+						if ((flag = (SC_ENTRY(&md->sc, j) != NULL)) != 0)
 							break;
 					}
 				} else {
-					flag = (md->sc.data[cond_data] != NULL);
+					flag = (SC_ENTRY(&md->sc, cond_data) != NULL);
 				}
 
 				flag ^= (cast_cond == MSC_MYSTATUSOFF);
@@ -4947,6 +5136,7 @@ static int mob_db_validate_entry(struct mob_db *entry, int n, const char *source
 
 	// Fill in remaining status data by using a dummy monster.
 	data.bl.type = BL_MOB;
+	status->change_init(&data.bl);
 	data.level = entry->lv;
 	memcpy(&data.status, &entry->status, sizeof(struct status_data));
 	status->calc_misc(&data.bl, &entry->status, entry->lv);
@@ -6091,7 +6281,18 @@ static int do_init_mob(bool minimal)
 	if (minimal)
 		return 0;
 
+	VECTOR_INIT(mob->pool.free);
+	VECTOR_INIT(mob->pool.batch);
+	VECTOR_ENSURE(mob->pool.free, MOB_POOL_PREALLOC, 1);
+	for (int i = 0; i < MOB_POOL_PREALLOC; i++) {
+		struct mob_data *md = NULL;
+		CREATE(md, struct mob_data, 1);
+		VECTOR_PUSH(mob->pool.free, md);
+	}
+	mob->pool.enabled = true;
+
 	timer->add_func_list(mob->delayspawn,"mob_delayspawn");
+	timer->add_func_list(mob->spawn_batch, "mob_spawn_batch");
 	timer->add_func_list(mob->delay_item_drop,"mob_delay_item_drop");
 	timer->add_func_list(mob->ai_hard,"mob_ai_hard");
 	timer->add_func_list(mob->ai_lazy,"mob_ai_lazy");
@@ -6176,6 +6377,12 @@ static int do_final_mob(void)
 	db_destroy(mob->item_drop_ratio_other_db);
 	ers_destroy(item_drop_ers);
 	ers_destroy(item_drop_list_ers);
+
+	mob->pool.enabled = false;
+	while (VECTOR_LENGTH(mob->pool.free) > 0)
+		aFree(VECTOR_POP(mob->pool.free));
+	VECTOR_CLEAR(mob->pool.free);
+	VECTOR_CLEAR(mob->pool.batch);
 	return 0;
 }
 
@@ -6258,6 +6465,11 @@ void mob_defaults(void)
 	mob->linksearch = mob_linksearch;
 	mob->delayspawn = mob_delayspawn;
 	mob->setdelayspawn = mob_setdelayspawn;
+	mob->data_alloc = mob_data_alloc;
+	mob->data_free = mob_data_free;
+	mob->queue_respawn = mob_queue_respawn;
+	mob->dequeue_respawn = mob_dequeue_respawn;
+	mob->spawn_batch = mob_spawn_batch;
 	mob->count_sub = mob_count_sub;
 	mob->spawn = mob_spawn;
 	mob->can_changetarget = mob_can_changetarget;
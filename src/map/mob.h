@@ -58,6 +58,14 @@ struct hplugin_data_store;
 
 #define MAX_MOB_CHAT 250 //Max Skill's messages
 
+// Released mob_data kept for reuse, and mob_data allocated in advance at startup
+#define MOB_POOL_SIZE 2048
+#define MOB_POOL_PREALLOC 256
+
+// The timer of a spawn group runs at the tick of its first due mob, and also respawns
+// the mobs of the group due within this many ms (never later than their tick)
+#define MOB_RESPAWN_BATCH_WINDOW 500
+
 #define DEFAULT_MOB_NAME "--en--"
 #define DEFAULT_MOB_JNAME "--ja--"
 
@@ -257,6 +265,8 @@ struct mob_data {
 	int dmg_taken_rate;
 	struct spawn_data *spawn; //Spawn data.
 	int spawn_timer; //Required for Convex Mirror
+	int64 respawn_tick;              ///< Tick of the respawn, while queued in spawn->respawn_queue
+	struct mob_data *respawn_next;   ///< Next mob of spawn->respawn_queue
 	struct item *lootitem;
 	int class_;
 	unsigned int tdmg; //Stores total damage given to the mob, for exp calculations. [Skotlex]
@@ -483,6 +493,22 @@ struct item_drop_list {
 
 VECTOR_STRUCT_DECL(mob_group, int);
 
+/**
+ * Released mob_data kept for reuse by mob->data_alloc, and the counters of
+ * the allocations and timers avoided by the pool and the batched respawns.
+ */
+struct mob_pool {
+	VECTOR_DECL(struct mob_data *) free; ///< Released mob_data, cleared when reused
+	VECTOR_DECL(int) batch;              ///< Ids of the mobs respawned by the running mob->spawn_batch
+	bool enabled;           ///< Whether released mob_data are kept (false before init and after final)
+	uint64 allocs;          ///< mob_data given by mob->data_alloc
+	uint64 reused;          ///< Of which taken from the pool (allocations avoided)
+	uint64 released;        ///< mob_data given back to the memory manager, the pool being full
+	uint64 respawns;        ///< Respawns queued by mob->queue_respawn
+	uint64 respawn_timers;  ///< Timers added for them, the others joined a pending timer of their spawn group
+	uint64 respawn_batches; ///< Runs of mob->spawn_batch
+};
+
 #define mob_stop_walking(md, type) (unit->stop_walking(&(md)->bl, (type)))
 #define mob_stop_attack(md)        (unit->stop_attack(&(md)->bl))
 
@@ -500,6 +526,7 @@ struct mob_interface {
 	struct optdrop_group *opt_drop_groups;
 	int opt_drop_groups_count;
 	struct mob_group mob_groups[MOBG_MAX_GROUP];
+	struct mob_pool pool;
 	// Defines the Manuk/Splendide/Mora mob groups for the status reductions [Epoque & Frost]
 	int manuk[8];
 	int splendide[5];
@@ -542,6 +569,11 @@ struct mob_interface {
 	int (*linksearch) (struct block_list *bl, va_list ap);
 	int (*delayspawn) (int tid, int64 tick, int id, intptr_t data);
 	int (*setdelayspawn) (struct mob_data *md);
+	struct mob_data *(*data_alloc) (void);
+	void (*data_free) (struct mob_data *md);
+	void (*queue_respawn) (struct mob_data *md, int64 tick);
+	void (*dequeue_respawn) (struct mob_data *md);
+	int (*spawn_batch) (int tid, int64 tick, int id, intptr_t data);
 	int (*count_sub) (struct block_list *bl, va_list ap);
 	int (*spawn) (struct mob_data *md);
 	int (*can_changetarget) (const struct mob_data *md, const struct block_list *target, uint32 mode);
@@ -443,6 +443,9 @@ static void npc_event_doall_sub(void *key, void *data, va_list ap)
 			npc->event_sub(map->id2sd(rid), ev, buf);
 		}
 		else {
+			// global events run on the map-server owning the map
+			if (ev->nd->bl.m >= 0 && map->list[ev->nd->bl.m].standby)
+				return;
 			script->run_npc(ev->nd->u.scr.script, ev->pos, rid, ev->nd->bl.id);
 		}
 		(*c)++;
@@ -458,6 +461,8 @@ static int npc_event_do(const char *name)
 	}
 	else {
 		struct event_data *ev = strdb_get(npc->ev_db, name);
+		if (ev && ev->nd->bl.m >= 0 && map->list[ev->nd->bl.m].standby)
+			return 0; // runs on the map-server owning the map
 		if (ev) {
 			script->run_npc(ev->nd->u.scr.script, ev->pos, 0, ev->nd->bl.id);
 			return 1;
@@ -650,8 +655,9 @@ static int npc_timerevent(int tid, int64 tick, int id, intptr_t data)
 		ers_free(npc->timer_event_ers, ted);
 	}
 
-	// Run the script
-	script->run_npc(nd->u.scr.script,te->pos,nd->u.scr.rid,nd->bl.id);
+	// Run the script, unless the map-server owning the map runs it
+	if (nd->bl.m < 0 || !map->list[nd->bl.m].standby)
+		script->run_npc(nd->u.scr.script,te->pos,nd->u.scr.rid,nd->bl.id);
 
 	nd->u.scr.rid = old_rid; // Attached-rid should be restored anyway.
 	if( sd )
@@ -1059,7 +1065,7 @@ static int npc_touch_areanpc(struct map_session_data *sd, int16 m, int16 x, int1
 	}
 	switch(map->list[m].npc[i]->subtype) {
 		case WARP:
-			if( pc_ishiding(sd) || (sd->sc.count && sd->sc.data[SC_CAMOUFLAGE]) )
+			if( pc_ishiding(sd) || (sd->sc.count && SC_ENTRY(&sd->sc, SC_CAMOUFLAGE)) )
 				break; // hidden chars cannot use warps
 			pc->setpos(sd,map->list[m].npc[i]->u.warp.mapindex,map->list[m].npc[i]->u.warp.x,map->list[m].npc[i]->u.warp.y,CLR_OUTSIGHT);
 			break;
@@ -1074,7 +1080,7 @@ static int npc_touch_areanpc(struct map_session_data *sd, int16 m, int16 x, int1
 				 && (sd->bl.y >= (map->list[m].npc[j]->bl.y - map->list[m].npc[j]->u.warp.ys)
 				  && sd->bl.y <= (map->list[m].npc[j]->bl.y + map->list[m].npc[j]->u.warp.ys))
 				) {
-					if( pc_ishiding(sd) || (sd->sc.count && sd->sc.data[SC_CAMOUFLAGE]) )
+					if( pc_ishiding(sd) || (sd->sc.count && SC_ENTRY(&sd->sc, SC_CAMOUFLAGE)) )
 						break; // hidden chars cannot use warps
 					pc->setpos(sd,map->list[m].npc[j]->u.warp.mapindex,map->list[m].npc[j]->u.warp.x,map->list[m].npc[j]->u.warp.y,CLR_OUTSIGHT);
 					found_warp = 1;
@@ -4635,6 +4641,9 @@ static const char *npc_parse_function(const char *w1, const char *w2, const char
 		struct script_code *oldscript = (struct script_code*)DB->data2ptr(&old_data);
 		ShowWarning("npc_parse_function: Overwriting user function [%s] in file '%s', line '%d'.\n", w3, filepath, strline(buffer,start-buffer));
 		script->free_vars(oldscript->local.vars);
+		script->reg_slots_free(oldscript->local.slots);
+		script->var_slots_clear(&oldscript->scope_slots);
+		script->var_slots_clear(&oldscript->npc_slots);
 		VECTOR_CLEAR(oldscript->script_buf);
 		aFree(oldscript);
 	}
@@ -4838,6 +4847,7 @@ static const char *npc_parse_mob(const char *w1, const char *w2, const char *w3,
 	//Now that all has been validated. We allocate the actual memory that the re-spawn data will use.
 	data = (struct spawn_data*)aMalloc(sizeof(struct spawn_data));
 	memcpy(data, &mobspawn, sizeof(struct spawn_data));
+	data->respawn_timer = INVALID_TIMER;
 
 	// spawn / cache the new mobs
 	if( battle_config.dynamic_mobs && map->addmobtolist(data->m, data) >= 0 ) {
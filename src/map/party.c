@@ -674,7 +674,7 @@ static int party_member_withdraw(int party_id, int account_id, int char_id)
 		if( p && p->instances )
 			instance->check_kick(sd);
 	}
-	if (sd && sd->sc.data[SC_DANCING]) {
+	if (sd && SC_ENTRY(&sd->sc, SC_DANCING)) {
 		status_change_end(&sd->bl, SC_DANCING, INVALID_TIMER);
 		status_change_end(&sd->bl, SC_DRUMBATTLE, INVALID_TIMER);
 		status_change_end(&sd->bl, SC_NIBELUNGEN, INVALID_TIMER);
@@ -974,7 +974,7 @@ static int party_skill_check(struct map_session_data *sd, int party_id, uint16 s
 				break;
 			case MO_COMBOFINISH: //Increase Counter rate of Star Gladiators
 				if ((p_sd->job & MAPID_UPPERMASK) == MAPID_STAR_GLADIATOR
-					&& sd->sc.data[SC_COUNTERKICK_READY]
+					&& SC_ENTRY(&sd->sc, SC_COUNTERKICK_READY)
 					&& pc->checkskill(p_sd,SG_FRIEND)) {
 					sc_start4(&p_sd->bl,&p_sd->bl,SC_SKILLRATE_UP,100,TK_COUNTER,
 						50+50*pc->checkskill(p_sd,SG_FRIEND), //+100/150/200% rate
@@ -266,6 +266,7 @@ static bool path_search(struct walkpath_data *wpd, struct block_list *bl, int16
 	if (!map->list[m].cell)
 		return false;
 	md = &map->list[m];
+	md->stats.count[MAP_STATS_PATH_SEARCHES]++;
 
 	//Do not check starting cell as that would get you stuck.
 	if (x0 < 0 || x0 >= md->xs || y0 < 0 || y0 >= md->ys /*|| md->getcellp(md, bl, x0, y0, cell)*/)
@@ -224,8 +224,8 @@ static int pc_getmaxspiritball(struct map_session_data *sd, int min)
 
 	if ( min && result < min )
 		result = min;
-	else if ( sd->sc.data[SC_RAISINGDRAGON] )
-		result += sd->sc.data[SC_RAISINGDRAGON]->val1;
+	else if ( SC_ENTRY(&sd->sc, SC_RAISINGDRAGON) )
+		result += SC_ENTRY(&sd->sc, SC_RAISINGDRAGON)->val1;
 	if ( result > MAX_SPIRITBALL )
 		result = MAX_SPIRITBALL;
 	return result;
@@ -330,7 +330,7 @@ static void pc_addsoulball(struct map_session_data *sd, int max)
 
 	const struct status_change *sc = status->get_sc(&sd->bl);
 
-	if (sc == NULL || sc->data[SC_SOULENERGY] == NULL) {
+	if (sc == NULL || SC_ENTRY(sc, SC_SOULENERGY) == NULL) {
 		sc_start(&sd->bl, &sd->bl, SC_SOULENERGY, 100, 0, skill->get_time2(SP_SOULCOLLECT, 1), 0);
 		sd->soulball = 0;
 	}
@@ -359,14 +359,14 @@ static void pc_delsoulball(struct map_session_data *sd, int count, bool type)
 
 	struct status_change *sc = status->get_sc(&sd->bl);
 
-	if (sd->soulball <= 0 || sc == NULL || sc->data[SC_SOULENERGY] == NULL) {
+	if (sd->soulball <= 0 || sc == NULL || SC_ENTRY(sc, SC_SOULENERGY) == NULL) {
 		sd->soulball = 0;
 	} else {
 		sd->soulball -= cap_value(count, 0, sd->soulball);
 		if (sd->soulball == 0)
 			status_change_end(&sd->bl, SC_SOULENERGY, INVALID_TIMER);
 		else
-			sc->data[SC_SOULENERGY]->val1 = sd->soulball;
+			SC_ENTRY(sc, SC_SOULENERGY)->val1 = sd->soulball;
 	}
 
 	if (type == 0)
@@ -393,7 +393,7 @@ static int pc_check_banding(struct block_list *bl, va_list ap)
 
 	sc = status->get_sc(bl);
 
-	if( sc && sc->data[SC_BANDING] )
+	if( sc && SC_ENTRY(sc, SC_BANDING) )
 	{
 		b_sd[(*c)++] = tsd->bl.id;
 		return 1;
@@ -418,9 +418,9 @@ static int pc_banding(struct map_session_data *sd, uint16 skill_lv)
 
 	if( c < 1 ) {
 		//just recalc status no need to recalc hp
-		if( (sc = status->get_sc(&sd->bl)) != NULL  && sc->data[SC_BANDING] ) {
+		if( (sc = status->get_sc(&sd->bl)) != NULL  && SC_ENTRY(sc, SC_BANDING) ) {
 			// No more Royal Guards in Banding found.
-			sc->data[SC_BANDING]->val2 = 0; // Reset the counter
+			SC_ENTRY(sc, SC_BANDING)->val2 = 0; // Reset the counter
 			status_calc_bl(&sd->bl, status->sc2scb_flag(SC_BANDING));
 		}
 		return 0;
@@ -457,8 +457,8 @@ static int pc_banding(struct map_session_data *sd, uint16 skill_lv)
 		bsd = map->id2sd(b_sd[j]);
 		if( bsd != NULL ) {
 			status->set_hp(&bsd->bl, hp, STATUS_HEAL_DEFAULT); // Set hp
-			if( (sc = status->get_sc(&bsd->bl)) != NULL  && sc->data[SC_BANDING] ) {
-				sc->data[SC_BANDING]->val2 = c; // Set the counter. It doesn't count your self.
+			if( (sc = status->get_sc(&bsd->bl)) != NULL  && SC_ENTRY(sc, SC_BANDING) ) {
+				SC_ENTRY(sc, SC_BANDING)->val2 = c; // Set the counter. It doesn't count your self.
 				status_calc_bl(&bsd->bl, status->sc2scb_flag(SC_BANDING)); // Set atk and def.
 			}
 		}
@@ -699,7 +699,7 @@ static int pc_makesavestatus(struct map_session_data *sd)
 #else
 	sd->status.option = sd->sc.option&(OPTION_INVISIBLE|OPTION_CART|OPTION_FALCON|OPTION_RIDING|OPTION_DRAGON|OPTION_WUG|OPTION_WUGRIDER|OPTION_MADOGEAR);
 #endif
-	if (sd->sc.data[SC_JAILED]) { //When Jailed, do not move last point.
+	if (SC_ENTRY(&sd->sc, SC_JAILED)) { //When Jailed, do not move last point.
 		if(pc_isdead(sd)){
 			pc->setrestartvalue(sd,0);
 		} else {
@@ -837,6 +837,7 @@ static int pc_setinventorydata(struct map_session_data *sd)
 		int id = sd->status.inventory[i].nameid;
 		sd->inventory_data[i] = id?itemdb->search(id):NULL;
 	}
+	pc->inventory_index_build(sd);
 	return 0;
 }
 
@@ -1130,26 +1131,26 @@ static int pc_isequip(struct map_session_data *sd, int n)
 
 	if (sd->sc.count != 0) {
 		if ((item->equip & EQP_ARMS) != 0 && item->type == IT_WEAPON
-		    && (sd->sc.data[SC_NOEQUIPWEAPON] != NULL || sd->sc.data[SC_NO_SWITCH_WEAPON] != NULL)) { // Also works with left-hand weapons. [DracoRPG]
+		    && (SC_ENTRY(&sd->sc, SC_NOEQUIPWEAPON) != NULL || SC_ENTRY(&sd->sc, SC_NO_SWITCH_WEAPON) != NULL)) { // Also works with left-hand weapons. [DracoRPG]
 			return 0;
 		}
 
-		if ((item->equip & EQP_SHIELD) != 0 && item->type == IT_ARMOR && sd->sc.data[SC_NOEQUIPSHIELD] != NULL)
+		if ((item->equip & EQP_SHIELD) != 0 && item->type == IT_ARMOR && SC_ENTRY(&sd->sc, SC_NOEQUIPSHIELD) != NULL)
 			return 0;
 
-		if ((item->equip & EQP_ARMOR) != 0 && sd->sc.data[SC_NOEQUIPARMOR] != NULL)
+		if ((item->equip & EQP_ARMOR) != 0 && SC_ENTRY(&sd->sc, SC_NOEQUIPARMOR) != NULL)
 			return 0;
 
-		if ((item->equip & EQP_HEAD_TOP) != 0 && sd->sc.data[SC_NOEQUIPHELM] != NULL)
+		if ((item->equip & EQP_HEAD_TOP) != 0 && SC_ENTRY(&sd->sc, SC_NOEQUIPHELM) != NULL)
 			return 0;
 
-		if ((item->equip & EQP_ACC) != 0 && sd->sc.data[SC__STRIPACCESSARY] != NULL)
+		if ((item->equip & EQP_ACC) != 0 && SC_ENTRY(&sd->sc, SC__STRIPACCESSARY) != NULL)
 			return 0;
 
-		if (item->equip != 0 && sd->sc.data[SC_KYOUGAKU] != NULL)
+		if (item->equip != 0 && SC_ENTRY(&sd->sc, SC_KYOUGAKU) != NULL)
 			return 0;
 
-		if (sd->sc.data[SC_SOULLINK] != NULL && sd->sc.data[SC_SOULLINK]->val2 == SL_SUPERNOVICE) { // Spirit of Super Novice equip bonuses. [Skotlex]
+		if (SC_ENTRY(&sd->sc, SC_SOULLINK) != NULL && SC_ENTRY(&sd->sc, SC_SOULLINK)->val2 == SL_SUPERNOVICE) { // Spirit of Super Novice equip bonuses. [Skotlex]
 			if (sd->status.base_level > 90 && (item->equip & EQP_HELM) != 0)
 				return 1; // Can equip all helms.
 
@@ -1793,7 +1794,7 @@ static int pc_calc_skilltree(struct map_session_data *sd)
 				if(!sd->status.skill[idx].lv && (
 					(inf2&INF2_QUEST_SKILL && !battle_config.quest_skill_learn) ||
 					inf2&INF2_WEDDING_SKILL ||
-					(inf2&INF2_SPIRIT_SKILL && !sd->sc.data[SC_SOULLINK])
+					(inf2&INF2_SPIRIT_SKILL && !SC_ENTRY(&sd->sc, SC_SOULLINK))
 				))
 					continue; //Cannot be learned via normal means. Note this check DOES allows raising already known skills.
 
@@ -1907,7 +1908,7 @@ static void pc_check_skilltree(struct map_session_data *sd, int skill_id)
 			if( !sd->status.skill[idx].lv && (
 				(j&INF2_QUEST_SKILL && !battle_config.quest_skill_learn) ||
 				j&INF2_WEDDING_SKILL ||
-				(j&INF2_SPIRIT_SKILL && !sd->sc.data[SC_SOULLINK])
+				(j&INF2_SPIRIT_SKILL && !SC_ENTRY(&sd->sc, SC_SOULLINK))
 			) )
 				continue; //Cannot be learned via normal means.
 
@@ -2025,7 +2026,7 @@ static int pc_updateweightstatus(struct map_session_data *sd)
 
 	nullpo_retr(1, sd);
 
-	old_overweight = (sd->sc.data[SC_WEIGHTOVER90]) ? 2 : (sd->sc.data[SC_WEIGHTOVER50]) ? 1 : 0;
+	old_overweight = (SC_ENTRY(&sd->sc, SC_WEIGHTOVER90)) ? 2 : (SC_ENTRY(&sd->sc, SC_WEIGHTOVER50)) ? 1 : 0;
 	new_overweight = (pc_is90overweight(sd)) ? 2 : (pc_isoverhealweight(sd)) ? 1 : 0;
 
 	if( old_overweight == new_overweight )
@@ -4563,13 +4564,12 @@ static int pc_checkadditem(struct map_session_data *sd, int nameid, int amount)
 	if( data->stack.inventory && amount > data->stack.amount )
 		return ADDITEM_OVERAMOUNT;
 
-	for(int i = 0; i < sd->status.inventorySize; i++) {
-		// FIXME: This does not consider the checked item's cards, thus could check a wrong slot for stackability.
-		if(sd->status.inventory[i].nameid==nameid){
-			if( amount > MAX_AMOUNT - sd->status.inventory[i].amount || ( data->stack.inventory && amount > data->stack.amount - sd->status.inventory[i].amount ) )
-				return ADDITEM_OVERAMOUNT;
-			return ADDITEM_EXIST;
-		}
+	int i = pc->inventory_index_first(sd, nameid);
+	// FIXME: This does not consider the checked item's cards, thus could check a wrong slot for stackability.
+	if (i != INDEX_NOT_FOUND && i < sd->status.inventorySize) {
+		if( amount > MAX_AMOUNT - sd->status.inventory[i].amount || ( data->stack.inventory && amount > data->stack.amount - sd->status.inventory[i].amount ) )
+			return ADDITEM_OVERAMOUNT;
+		return ADDITEM_EXIST;
 	}
 
 	return ADDITEM_NEW;
@@ -4611,6 +4611,8 @@ static int pc_payzeny(struct map_session_data *sd, int zeny, enum e_log_pick_typ
 
 	sd->status.zeny -= zeny;
 	clif->updatestatus(sd,SP_ZENY);
+	if (zeny > 0)
+		pc->set_save_dirty(sd, PC_SAVE_DIRTY_ZENY);
 
 	if (zeny > 0) {
 		achievement->validate_zeny(sd, -zeny); // Achievements [Smokexyz/Hercules]
@@ -4750,6 +4752,8 @@ static int pc_getzeny(struct map_session_data *sd, int zeny, enum e_log_pick_typ
 
 	sd->status.zeny += zeny;
 	clif->updatestatus(sd,SP_ZENY);
+	if (zeny > 0)
+		pc->set_save_dirty(sd, PC_SAVE_DIRTY_ZENY);
 
 	if (zeny > 0) {
 		achievement->validate_zeny(sd, zeny); // Achievements [Smokexyz/Hercules]
@@ -4778,11 +4782,246 @@ static int pc_getzeny(struct map_session_data *sd, int zeny, enum e_log_pick_typ
  */
 static int pc_search_inventory(struct map_session_data *sd, int item_id)
 {
-	int i;
 	nullpo_retr(INDEX_NOT_FOUND, sd);
 
-	ARR_FIND(0, sd->status.inventorySize, i, sd->status.inventory[i].nameid == item_id && (sd->status.inventory[i].amount > 0 || item_id == 0));
-	return (i < sd->status.inventorySize) ? i : INDEX_NOT_FOUND;
+	for (int i = pc->inventory_index_first(sd, item_id); i != INDEX_NOT_FOUND; i = pc->inventory_index_next(sd, i)) {
+		if (i >= sd->status.inventorySize)
+			break; // Slots are linked in ascending order
+		if (sd->status.inventory[i].amount > 0 || item_id == 0)
+			return i;
+	}
+	return INDEX_NOT_FOUND;
+}
+
+/// Home bucket of an item ID in the inventory index.
+#define INVENTORY_INDEX_HASH(nameid) ((int)(((uint32)(nameid) * 2654435761U) >> 16) & (INVENTORY_INDEX_SIZE - 1))
+
+/**
+ * Finds the inventory index bucket of an item ID.
+ *
+ * @param idx    The inventory index.
+ * @param nameid The item ID.
+ * @return the bucket holding the item ID, or the unused bucket where it would be inserted.
+ */
+static int pc_inventory_index_bucket(const struct inventory_index *idx, int nameid)
+{
+	int pos = INVENTORY_INDEX_HASH(nameid);
+
+	// There are never more item IDs than slots, so there's always an unused bucket to stop at.
+	while (idx->buckets[pos].head != INDEX_NOT_FOUND && idx->buckets[pos].nameid != nameid)
+		pos = (pos + 1) & (INVENTORY_INDEX_SIZE - 1);
+	return pos;
+}
+
+/**
+ * Links an inventory slot into the list of the item ID it currently holds.
+ *
+ * @param idx    The inventory index.
+ * @param n      The inventory slot.
+ * @param nameid The item ID held by the slot.
+ */
+static void pc_inventory_index_link(struct inventory_index *idx, int n, int nameid)
+{
+	int pos = pc_inventory_index_bucket(idx, nameid);
+
+	idx->nameid[n] = nameid;
+	if (idx->buckets[pos].head == INDEX_NOT_FOUND || idx->buckets[pos].head > n) {
+		idx->buckets[pos].nameid = nameid;
+		idx->next[n] = idx->buckets[pos].head;
+		idx->buckets[pos].head = n;
+		return;
+	}
+
+	int prev = idx->buckets[pos].head;
+	while (idx->next[prev] != INDEX_NOT_FOUND && idx->next[prev] < n)
+		prev = idx->next[prev];
+	idx->next[n] = idx->next[prev];
+	idx->next[prev] = n;
+}
+
+/**
+ * Unlinks an inventory slot from the list of the item ID it was linked under.
+ * Releases the item ID bucket when its list becomes empty.
+ *
+ * @param idx The inventory index.
+ * @param n   The inventory slot.
+ */
+static void pc_inventory_index_unlink(struct inventory_index *idx, int n)
+{
+	int pos = pc_inventory_index_bucket(idx, idx->nameid[n]);
+
+	Assert_retv(idx->buckets[pos].head != INDEX_NOT_FOUND);
+
+	if (idx->buckets[pos].head == n) {
+		idx->buckets[pos].head = idx->next[n];
+	} else {
+		int prev = idx->buckets[pos].head;
+		while (idx->next[prev] != INDEX_NOT_FOUND && idx->next[prev] != n)
+			prev = idx->next[prev];
+		Assert_retv(idx->next[prev] == n);
+		idx->next[prev] = idx->next[n];
+	}
+	idx->next[n] = INDEX_NOT_FOUND;
+
+	if (idx->buckets[pos].head != INDEX_NOT_FOUND)
+		return;
+
+	// Backward shift deletion, so that probing never needs tombstones
+	int hole = pos;
+	for (int cur = (pos + 1) & (INVENTORY_INDEX_SIZE - 1); idx->buckets[cur].head != INDEX_NOT_FOUND; cur = (cur + 1) & (INVENTORY_INDEX_SIZE - 1)) {
+		int home = INVENTORY_INDEX_HASH(idx->buckets[cur].nameid);
+		if (((cur - home) & (INVENTORY_INDEX_SIZE - 1)) >= ((cur - hole) & (INVENTORY_INDEX_SIZE - 1))) {
+			idx->buckets[hole] = idx->buckets[cur];
+			hole = cur;
+		}
+	}
+	idx->buckets[hole].head = INDEX_NOT_FOUND;
+}
+
+/**
+ * (Re)builds the item ID to inventory slot index of a character from scratch.
+ *
+ * All MAX_INVENTORY slots are indexed, regardless of the current inventory size.
+ *
+ * @param sd The character.
+ */
+static void pc_inventory_index_build(struct map_session_data *sd)
+{
+	nullpo_retv(sd);
+
+	struct inventory_index *idx = &sd->inventory_index;
+
+	for (int i = 0; i < INVENTORY_INDEX_SIZE; i++)
+		idx->buckets[i].head = INDEX_NOT_FOUND;
+
+	// Walking backwards, pushing to the front of each list keeps them in ascending order.
+	for (int n = MAX_INVENTORY - 1; n >= 0; n--) {
+		int nameid = sd->status.inventory[n].nameid;
+		int pos = pc_inventory_index_bucket(idx, nameid);
+
+		idx->buckets[pos].nameid = nameid;
+		idx->nameid[n] = nameid;
+		idx->next[n] = idx->buckets[pos].head;
+		idx->buckets[pos].head = n;
+	}
+	idx->valid = true;
+}
+
+/**
+ * Updates the inventory index after the item ID held by an inventory slot changed.
+ *
+ * @param sd The character.
+ * @param n  The inventory slot.
+ */
+static void pc_inventory_index_update(struct map_session_data *sd, int n)
+{
+	nullpo_retv(sd);
+	Assert_retv(n >= 0 && n < MAX_INVENTORY);
+
+	struct inventory_index *idx = &sd->inventory_index;
+
+	if (!idx->valid)
+		return; // Will be built on the next lookup
+
+	if (idx->nameid[n] != sd->status.inventory[n].nameid) {
+		pc_inventory_index_unlink(idx, n);
+		pc_inventory_index_link(idx, n, sd->status.inventory[n].nameid);
+	}
+
+#if defined(DEBUG)
+	if (!pc->inventory_index_check(sd)) {
+		ShowDebug("pc_inventory_index_update: Inventory index of character %d is inconsistent, rebuilding.\n", sd->status.char_id);
+		pc->inventory_index_build(sd);
+	}
+#endif
+}
+
+/**
+ * Returns the first inventory slot holding a given item ID.
+ *
+ * Slots with zero amount and slots past the current inventory size are not
+ * filtered out. Use pc->inventory_index_next() to walk the remaining slots,
+ * which are returned in ascending order.
+ *
+ * @param sd     The character.
+ * @param nameid The item ID (0 for empty slots).
+ * @return the first slot holding the item ID.
+ * @retval INDEX_NOT_FOUND if no slot holds the item ID.
+ */
+static int pc_inventory_index_first(struct map_session_data *sd, int nameid)
+{
+	nullpo_retr(INDEX_NOT_FOUND, sd);
+
+	struct inventory_index *idx = &sd->inventory_index;
+
+	if (!idx->valid)
+		pc->inventory_index_build(sd);
+
+	return idx->buckets[pc_inventory_index_bucket(idx, nameid)].head;
+}
+
+/**
+ * Returns the next inventory slot holding the same item ID as a given slot.
+ *
+ * Callers that may delete or replace the item in slot n should fetch the next
+ * slot before doing so.
+ *
+ * @param sd The character.
+ * @param n  The current inventory slot, as returned by pc->inventory_index_first().
+ * @return the next slot holding the same item ID.
+ * @retval INDEX_NOT_FOUND if there are no more slots.
+ */
+static int pc_inventory_index_next(struct map_session_data *sd, int n)
+{
+	nullpo_retr(INDEX_NOT_FOUND, sd);
+	Assert_retr(INDEX_NOT_FOUND, n >= 0 && n < MAX_INVENTORY);
+
+	return sd->inventory_index.next[n];
+}
+
+/**
+ * Verifies that the inventory index of a character matches its inventory.
+ *
+ * Debugging aid, slow.
+ *
+ * @param sd The character.
+ * @retval true if the index is consistent (or not built yet).
+ */
+static bool pc_inventory_index_check(struct map_session_data *sd)
+{
+	nullpo_retr(false, sd);
+
+	const struct inventory_index *idx = &sd->inventory_index;
+	int linked = 0;
+
+	if (!idx->valid)
+		return true;
+
+	for (int pos = 0; pos < INVENTORY_INDEX_SIZE; pos++) {
+		if (idx->buckets[pos].head == INDEX_NOT_FOUND)
+			continue;
+		if (pc_inventory_index_bucket(idx, idx->buckets[pos].nameid) != pos) {
+			ShowDebug("pc_inventory_index_check: Item %d is unreachable in bucket %d.\n", idx->buckets[pos].nameid, pos);
+			return false;
+		}
+		for (int n = idx->buckets[pos].head, prev = INDEX_NOT_FOUND; n != INDEX_NOT_FOUND; prev = n, n = idx->next[n]) {
+			if (n <= prev || n >= MAX_INVENTORY || linked++ >= MAX_INVENTORY) {
+				ShowDebug("pc_inventory_index_check: Broken list for item %d.\n", idx->buckets[pos].nameid);
+				return false;
+			}
+			if (idx->nameid[n] != idx->buckets[pos].nameid || sd->status.inventory[n].nameid != idx->buckets[pos].nameid) {
+				ShowDebug("pc_inventory_index_check: Slot %d holds item %d but is linked under item %d.\n", n, sd->status.inventory[n].nameid, idx->buckets[pos].nameid);
+				return false;
+			}
+		}
+	}
+
+	if (linked != MAX_INVENTORY) {
+		ShowDebug("pc_inventory_index_check: %d slots linked, %d expected.\n", linked, MAX_INVENTORY);
+		return false;
+	}
+
+	return true;
 }
 
 /*==========================================
@@ -4850,9 +5089,8 @@ static int pc_additem(struct map_session_data *sd, const struct item *item_data,
 
 	// Stackable | Non Rental
 	if( itemdb->isstackable2(data) && item_data->expire_time == 0 ) {
-		for (i = 0; i < sd->status.inventorySize; i++) {
-			if( sd->status.inventory[i].nameid == item_data->nameid &&
-			    sd->status.inventory[i].bound == item_data->bound &&
+		for (i = pc->inventory_index_first(sd, item_data->nameid); i != INDEX_NOT_FOUND && i < sd->status.inventorySize; i = pc->inventory_index_next(sd, i)) {
+			if( sd->status.inventory[i].bound == item_data->bound &&
 			    sd->status.inventory[i].expire_time == 0 &&
 				sd->status.inventory[i].unique_id == item_data->unique_id &&
 			    memcmp(&sd->status.inventory[i].card, &item_data->card, sizeof(item_data->card)) == 0 ) {
@@ -4865,12 +5103,13 @@ static int pc_additem(struct map_session_data *sd, const struct item *item_data,
 		}
 	}
 
-	if (i >= sd->status.inventorySize) {
+	if (i == INDEX_NOT_FOUND || i >= sd->status.inventorySize) {
 		i = pc->search_inventory(sd,0);
 		if (i == INDEX_NOT_FOUND)
 			return 4;
 
 		memcpy(&sd->status.inventory[i], item_data, sizeof(sd->status.inventory[0]));
+		pc->inventory_index_update(sd, i);
 		// clear equip and favorite fields first, just in case
 		if( item_data->equip )
 			sd->status.inventory[i].equip = 0;
@@ -4903,6 +5142,8 @@ static int pc_additem(struct map_session_data *sd, const struct item *item_data,
 	if(data->flag.autoequip)
 		pc->equipitem(sd, i, data->equip);
 
+	pc->set_save_dirty(sd, PC_SAVE_DIRTY_ITEMS);
+
 	/* rental item check */
 	if (item_data->expire_time > 0) {
 		if (time(NULL) > item_data->expire_time) {
@@ -4943,6 +5184,7 @@ static int pc_delitem(struct map_session_data *sd, int n, int amount, int type,
 
 	sd->status.inventory[n].amount -= amount;
 	sd->weight -= sd->inventory_data[n]->weight*amount ;
+	pc->set_save_dirty(sd, PC_SAVE_DIRTY_ITEMS);
 
 	// It's here because the data would most likely get zeroed in following if [Hemagx]
 	struct item_data *itd = sd->inventory_data[n];
@@ -4953,6 +5195,7 @@ static int pc_delitem(struct map_session_data *sd, int n, int amount, int type,
 			pc->unequipitem(sd, n, PCUNEQUIPITEM_RECALC|PCUNEQUIPITEM_FORCE);
 		memset(&sd->status.inventory[n],0,sizeof(sd->status.inventory[0]));
 		sd->inventory_data[n] = NULL;
+		pc->inventory_index_update(sd, n);
 	}
 
 	if (is_rental && itd->rental_end_script != NULL)
@@ -5211,7 +5454,7 @@ static int pc_isUseitem(struct map_session_data *sd, int n)
 		case ITEMID_M_BERSERK_POTION:
 			if( sd->md == NULL || sd->md->db == NULL )
 				return 0;
-			if (sd->md->sc.data[SC_BERSERK])
+			if (SC_ENTRY(&sd->md->sc, SC_BERSERK))
 				return 0;
 			if( nameid == ITEMID_M_AWAKENING_POTION && sd->md->db->lv < 40 )
 				return 0;
@@ -5368,19 +5611,19 @@ static int pc_useitem(struct map_session_data *sd, int n)
 
 	// Statuses that don't let the player use items
 	if (sd->sc.count && (
-		sd->sc.data[SC_BERSERK] ||
-		(sd->sc.data[SC_GRAVITATION] && sd->sc.data[SC_GRAVITATION]->val3 == BCT_SELF) ||
-		sd->sc.data[SC_TRICKDEAD] ||
-		sd->sc.data[SC_HIDING] ||
-		sd->sc.data[SC__SHADOWFORM] ||
-		sd->sc.data[SC__INVISIBILITY] ||
-		sd->sc.data[SC__MANHOLE] ||
-		sd->sc.data[SC_KG_KAGEHUMI] ||
-		sd->sc.data[SC_WHITEIMPRISON] ||
-		sd->sc.data[SC_DEEP_SLEEP] ||
-		sd->sc.data[SC_SATURDAY_NIGHT_FEVER] ||
-		sd->sc.data[SC_COLD] ||
-		sd->sc.data[SC_SUHIDE] ||
+		SC_ENTRY(&sd->sc, SC_BERSERK) ||
+		(SC_ENTRY(&sd->sc, SC_GRAVITATION) && SC_ENTRY(&sd->sc, SC_GRAVITATION)->val3 == BCT_SELF) ||
+		SC_ENTRY(&sd->sc, SC_TRICKDEAD) ||
+		SC_ENTRY(&sd->sc, SC_HIDING) ||
+		SC_ENTRY(&sd->sc, SC__SHADOWFORM) ||
+		SC_ENTRY(&sd->sc, SC__INVISIBILITY) ||
+		SC_ENTRY(&sd->sc, SC__MANHOLE) ||
+		SC_ENTRY(&sd->sc, SC_KG_KAGEHUMI) ||
+		SC_ENTRY(&sd->sc, SC_WHITEIMPRISON) ||
+		SC_ENTRY(&sd->sc, SC_DEEP_SLEEP) ||
+		SC_ENTRY(&sd->sc, SC_SATURDAY_NIGHT_FEVER) ||
+		SC_ENTRY(&sd->sc, SC_COLD) ||
+		SC_ENTRY(&sd->sc, SC_SUHIDE) ||
 		pc_ismuted(&sd->sc, MANNER_NOITEM)
 	    ))
 		return 0;
@@ -5391,7 +5634,7 @@ static int pc_useitem(struct map_session_data *sd, int n)
 
 	/* Items with delayed consume are not meant to work while in mounts except reins of mount(12622) */
 	if (sd->inventory_data[n]->flag.delay_consume && nameid != ITEMID_BOARDING_HALTER) {
-		if( sd->sc.data[SC_ALL_RIDING] )
+		if( SC_ENTRY(&sd->sc, SC_ALL_RIDING) )
 			return 0;
 		else if( pc_issit(sd) )
 			return 0;
@@ -5450,8 +5693,8 @@ static int pc_useitem(struct map_session_data *sd, int n)
 
 				// If Earth Spike Scroll is used while SC_EARTHSCROLL is active, there is a chance to don't consume the scroll. [Kenpachi]
 				if ((nameid == ITEMID_EARTH_SCROLL_1_3 || nameid == ITEMID_EARTH_SCROLL_1_5)
-				    && sd->sc.count > 0 && sd->sc.data[SC_EARTHSCROLL] != NULL
-				    && rnd() % 100 > sd->sc.data[SC_EARTHSCROLL]->val2) {
+				    && sd->sc.count > 0 && SC_ENTRY(&sd->sc, SC_EARTHSCROLL) != NULL
+				    && rnd() % 100 > SC_ENTRY(&sd->sc, SC_EARTHSCROLL)->val2) {
 					return 0;
 				}
 
@@ -5486,7 +5729,7 @@ static int pc_useitem(struct map_session_data *sd, int n)
 	if (sd->status.inventory[n].card[0] == CARD0_CREATE
 	 && pc->fame_rank(MakeDWord(sd->status.inventory[n].card[2], sd->status.inventory[n].card[3]), RANKTYPE_ALCHEMIST) > 0) {
 		script->potion_flag = 2; // Famous player's potions have 50% more efficiency
-		if (sd->sc.data[SC_SOULLINK] && sd->sc.data[SC_SOULLINK]->val2 == SL_ROGUE)
+		if (SC_ENTRY(&sd->sc, SC_SOULLINK) && SC_ENTRY(&sd->sc, SC_SOULLINK)->val2 == SL_ROGUE)
 			script->potion_flag = 3; //Even more effective potions.
 	}
 
@@ -5501,7 +5744,7 @@ static int pc_useitem(struct map_session_data *sd, int n)
 
 	// If Earth Spike Scroll is used while SC_EARTHSCROLL is active, there is a chance to don't consume the scroll. [Kenpachi]
 	if ((nameid == ITEMID_EARTH_SCROLL_1_3 || nameid == ITEMID_EARTH_SCROLL_1_5) && sd->sc.count > 0
-	    && sd->sc.data[SC_EARTHSCROLL] != NULL && rnd() % 100 > sd->sc.data[SC_EARTHSCROLL]->val2) {
+	    && SC_ENTRY(&sd->sc, SC_EARTHSCROLL) != NULL && rnd() % 100 > SC_ENTRY(&sd->sc, SC_EARTHSCROLL)->val2) {
 		removeItem = false;
 	}
 
@@ -5650,6 +5893,7 @@ static int pc_cart_additem(struct map_session_data *sd, struct item *item_data,
 	logs->pick_pc(sd, log_type, amount, &sd->status.cart[i],data);
 
 	sd->cart_weight += w;
+	pc->set_save_dirty(sd, PC_SAVE_DIRTY_ITEMS);
 	clif->updatestatus(sd,SP_CARTINFO);
 
 	return 0;
@@ -5674,6 +5918,7 @@ static int pc_cart_delitem(struct map_session_data *sd, int n, int amount, int t
 
 	sd->status.cart[n].amount -= amount;
 	sd->cart_weight -= data->weight*amount ;
+	pc->set_save_dirty(sd, PC_SAVE_DIRTY_ITEMS);
 	if(sd->status.cart[n].amount <= 0){
 		memset(&sd->status.cart[n],0,sizeof(sd->status.cart[0]));
 		sd->cart_num--;
@@ -5918,7 +6163,7 @@ static int pc_steal_coin(struct map_session_data *sd, struct block_list *target,
 	if (sd == NULL || md == NULL)
 		return 0;
 
-	if (md->state.steal_coin_flag || md->sc.data[SC_STONE] || md->sc.data[SC_FREEZE] || md->status.mode&MD_BOSS)
+	if (md->state.steal_coin_flag || SC_ENTRY(&md->sc, SC_STONE) || SC_ENTRY(&md->sc, SC_FREEZE) || md->status.mode&MD_BOSS)
 		return 0;
 
 	if (mob_is_treasure(md))
@@ -5935,6 +6180,47 @@ static int pc_steal_coin(struct map_session_data *sd, struct block_list *target,
 	return 0;
 }
 
+/**
+ * Sends a character to another map-server.
+ *
+ * The character is saved and removed from this map-server, the client is told
+ * to connect to the other map-server when the char-server acknowledges the change.
+ *
+ * @param sd The related character.
+ * @param map_index The target map's index.
+ * @param x The target x-coordinate.
+ * @param y The target y-coordinate.
+ * @param ip The map-server owning the map, in host byte order.
+ * @param port The port of the map-server, in host byte order.
+ * @param clrtype The unit clear type, which should be used.
+ * @retval 0 Success.
+ * @retval 2 The char-server is not connected.
+ * @retval 3 No character data. (Parameter sd is a NULL pointer.)
+ **/
+static int pc_setpos_remote(struct map_session_data *sd, unsigned short map_index, int x, int y, uint32 ip, uint16 port, enum clr_type clrtype)
+{
+	nullpo_retr(3, sd);
+
+	if (!chrif->isconnected())
+		return 2;
+
+	if (sd->npc_id != 0)
+		npc->event_dequeue(sd);
+	npc->script_event(sd, NPCE_LOGOUT);
+	// remove from map, THEN change x/y coordinates
+	unit->remove_map_pc(sd, clrtype);
+	sd->mapindex = map_index;
+	sd->bl.x = x;
+	sd->bl.y = y;
+	pc->clean_skilltree(sd);
+	chrif->save(sd, CHRIF_SAVE_MAPSERVER);
+	chrif->changemapserver(sd, ip, port);
+
+	// free the character, it's deleted from the auth db when the char-server answers
+	unit->free_pc(sd);
+	return 0;
+}
+
 /**
  * Sets a character's position.
  *
@@ -5945,7 +6231,7 @@ static int pc_steal_coin(struct map_session_data *sd, struct block_list *target,
  * @param clrtype The unit clear type, which should be used.
  * @retval 0 Success.
  * @retval 1 Invalid map index.
- * @retval 2 (unused) Map not in this map-server, and failed to locate alternative map-server.
+ * @retval 2 Map owned by another map-server, and the char-server is not connected.
  * @retval 3 No character data. (Parameter sd is a NULL pointer.)
  * @retval 4 Character is jailed.
  *
@@ -5955,6 +6241,12 @@ static int pc_setpos(struct map_session_data *sd, unsigned short map_index, int
 	nullpo_retr(3, sd);
 
 	int map_id = map->mapindex2mapid(map_index);
+	uint32 ip;
+	uint16 port;
+
+	if (sd->state.active != 0 && map_index != 0 && (map_id == INDEX_NOT_FOUND || map->list[map_id].standby)
+	 && map->mapindex2ipport(map_index, &ip, &port))
+		return pc->setpos_remote(sd, map_index, x, y, ip, port, clrtype);
 
 	if (map_index == 0 || !mapindex_id2name(map_index) || map_id == INDEX_NOT_FOUND) {
 		ShowDebug("pc_setpos: Passed mapindex %d is invalid!\n", map_index);
@@ -6066,7 +6358,7 @@ static int pc_setpos(struct map_session_data *sd, unsigned short map_index, int
 			map->cellfromcache(&map->list[map_id]);
 
 		if (sd->sc.count != 0) { // Cancel some map related stuff.
-			if (sd->sc.data[SC_JAILED] != NULL)
+			if (SC_ENTRY(&sd->sc, SC_JAILED) != NULL)
 				return 4; // You may not get out!
 
 			status_change_end(&sd->bl, SC_CASH_BOSS_ALARM, INVALID_TIMER);
@@ -6080,8 +6372,8 @@ static int pc_setpos(struct map_session_data *sd, unsigned short map_index, int
 			status_change_end(&sd->bl, SC_STEALTHFIELD_MASTER, INVALID_TIMER);
 			status_change_end(&sd->bl, SC_STEALTHFIELD, INVALID_TIMER);
 
-			if (sd->sc.data[SC_KNOWLEDGE] != NULL) {
-				struct status_change_entry *sce = sd->sc.data[SC_KNOWLEDGE];
+			if (SC_ENTRY(&sd->sc, SC_KNOWLEDGE) != NULL) {
+				struct status_change_entry *sce = SC_ENTRY(&sd->sc, SC_KNOWLEDGE);
 
 				if (sce->timer != INVALID_TIMER)
 					timer->delete_(sce->timer, status->change_timer);
@@ -6356,18 +6648,18 @@ static int pc_checkallowskill(struct map_session_data *sd)
 		// Skills requiring specific weapon types
 		if( scw_list[i] == SC_DANCING && !battle_config.dancing_weaponswitch_fix )
 			continue;
-		if( sd->sc.data[scw_list[i]]
+		if( SC_ENTRY(&sd->sc, scw_list[i])
 		 && !pc_check_weapontype(sd,skill->get_weapontype(status->sc2skill(scw_list[i]))))
 			status_change_end(&sd->bl, scw_list[i], INVALID_TIMER);
 	}
 
-	if(sd->sc.data[SC_STRUP] && sd->weapontype != W_FIST)
+	if(SC_ENTRY(&sd->sc, SC_STRUP) && sd->weapontype != W_FIST)
 		// Spurt requires bare hands (feet, in fact xD)
 		status_change_end(&sd->bl, SC_STRUP, INVALID_TIMER);
 
 	if (!sd->has_shield) { // Skills requiring a shield
 		for (i = 0; i < ARRAYLENGTH(scs_list); i++)
-			if(sd->sc.data[scs_list[i]])
+			if(SC_ENTRY(&sd->sc, scs_list[i]))
 				status_change_end(&sd->bl, scs_list[i], INVALID_TIMER);
 	}
 	return 0;
@@ -6408,7 +6700,7 @@ int pc_get_skill_cooldown(struct map_session_data *sd, uint16 skill_id, uint16 s
 
 	if (skill_id == SJ_NOVAEXPLOSING) {
 		const struct status_change *sc = status->get_sc(&sd->bl);
-		if (sc != NULL && sc->data[SC_DIMENSION] != NULL)
+		if (sc != NULL && SC_ENTRY(sc, SC_DIMENSION) != NULL)
 			return 0;
 	}
 
@@ -6856,11 +7148,11 @@ static void pc_calcexp(struct map_session_data *sd, uint64 *base_exp, uint64 *jo
 
 #ifdef RENEWAL
 		// after rebalance, boss monsters does give more EXP, but "MVP" exp is not increased
-		if (sd->sc.data[SC_RICHMANKIM] != NULL && src->type == BL_MOB && (flags & EXP_FLAG_MVP) == 0) {
-			buff_ratio += sd->sc.data[SC_RICHMANKIM]->val1;
+		if (SC_ENTRY(&sd->sc, SC_RICHMANKIM) != NULL && src->type == BL_MOB && (flags & EXP_FLAG_MVP) == 0) {
+			buff_ratio += SC_ENTRY(&sd->sc, SC_RICHMANKIM)->val1;
 			// jexp is boosted by both buff_ration AND buff_job_ratio, so we should not use buff_job_ratio here
 			// or we will give the bonus twice for jexp
-			// buff_job_ratio += sd->sc.data[SC_RICHMANKIM]->val1;
+			// buff_job_ratio += SC_ENTRY(&sd->sc, SC_RICHMANKIM)->val1;
 		}
 #endif
 
@@ -6878,16 +7170,16 @@ static void pc_calcexp(struct map_session_data *sd, uint64 *base_exp, uint64 *jo
 
 
 	//Buffs modifier
-	if (sd->sc.data[SC_CASH_PLUSEXP]) {
-		buff_job_ratio += sd->sc.data[SC_CASH_PLUSEXP]->val1;
-		buff_ratio += sd->sc.data[SC_CASH_PLUSEXP]->val1;
+	if (SC_ENTRY(&sd->sc, SC_CASH_PLUSEXP)) {
+		buff_job_ratio += SC_ENTRY(&sd->sc, SC_CASH_PLUSEXP)->val1;
+		buff_ratio += SC_ENTRY(&sd->sc, SC_CASH_PLUSEXP)->val1;
 	}
-	if (sd->sc.data[SC_OVERLAPEXPUP]) {
-		buff_job_ratio  += sd->sc.data[SC_OVERLAPEXPUP]->val1;
-		buff_ratio += sd->sc.data[SC_OVERLAPEXPUP]->val1;
+	if (SC_ENTRY(&sd->sc, SC_OVERLAPEXPUP)) {
+		buff_job_ratio  += SC_ENTRY(&sd->sc, SC_OVERLAPEXPUP)->val1;
+		buff_ratio += SC_ENTRY(&sd->sc, SC_OVERLAPEXPUP)->val1;
 	}
-	if (sd->sc.data[SC_CASH_PLUSONLYJOBEXP])
-		buff_job_ratio += sd->sc.data[SC_CASH_PLUSONLYJOBEXP]->val1;
+	if (SC_ENTRY(&sd->sc, SC_CASH_PLUSONLYJOBEXP))
+		buff_job_ratio += SC_ENTRY(&sd->sc, SC_CASH_PLUSONLYJOBEXP)->val1;
 
 	//Applying Race and PK modifier First then Premium (Perment modifier) and finally buff modifier
 	jexp += apply_percentrate64(jexp, race_ratio, 100);
@@ -6983,6 +7275,9 @@ static bool pc_gainexp(struct map_session_data *sd, struct block_list *src, uint
 		clif->updatestatus(sd, SP_JOBEXP);
 	}
 
+	if (base_exp != 0 || job_exp != 0)
+		pc->set_save_dirty(sd, PC_SAVE_DIRTY_EXP);
+
 #if PACKETVER >= 20091027
 	bool is_quest = ((flags & EXP_FLAG_QUEST) != 0);
 	if(base_exp)
@@ -7621,7 +7916,7 @@ static int pc_resetskill(struct map_session_data *sd, int flag)
 		if (options&OPTION_CART && pc->checkskill(sd, MC_PUSHCART))
 			options &= ~OPTION_CART;
 #else
-		if( sd->sc.data[SC_PUSH_CART] )
+		if( SC_ENTRY(&sd->sc, SC_PUSH_CART) )
 			pc->setcart(sd, 0);
 #endif
 		if( options != sd->sc.option )
@@ -7630,7 +7925,7 @@ static int pc_resetskill(struct map_session_data *sd, int flag)
 		if( homun_alive(sd->hd) && pc->checkskill(sd, AM_CALLHOMUN) )
 			homun->vaporize(sd, HOM_ST_REST, true);
 
-		if ((sd->sc.data[SC_SPRITEMABLE] && pc->checkskill(sd, SU_SPRITEMABLE)))
+		if ((SC_ENTRY(&sd->sc, SC_SPRITEMABLE) && pc->checkskill(sd, SU_SPRITEMABLE)))
 			status_change_end(&sd->bl, SC_SPRITEMABLE, INVALID_TIMER);
 	}
 
@@ -7677,15 +7972,15 @@ static int pc_resetskill(struct map_session_data *sd, int flag)
 
 	if (!(flag&PCRESETSKILL_RECOUNT)) {
 		// Remove all SCs that can't be inactivated without a skill
-		if( sd->sc.data[SC_STORMKICK_READY] )
+		if( SC_ENTRY(&sd->sc, SC_STORMKICK_READY) )
 			status_change_end(&sd->bl, SC_STORMKICK_READY, INVALID_TIMER);
-		if( sd->sc.data[SC_DOWNKICK_READY] )
+		if( SC_ENTRY(&sd->sc, SC_DOWNKICK_READY) )
 			status_change_end(&sd->bl, SC_DOWNKICK_READY, INVALID_TIMER);
-		if( sd->sc.data[SC_TURNKICK_READY] )
+		if( SC_ENTRY(&sd->sc, SC_TURNKICK_READY) )
 			status_change_end(&sd->bl, SC_TURNKICK_READY, INVALID_TIMER);
-		if( sd->sc.data[SC_COUNTERKICK_READY] )
+		if( SC_ENTRY(&sd->sc, SC_COUNTERKICK_READY) )
 			status_change_end(&sd->bl, SC_COUNTERKICK_READY, INVALID_TIMER);
-		if( sd->sc.data[SC_DODGE_READY] )
+		if( SC_ENTRY(&sd->sc, SC_DODGE_READY) )
 			status_change_end(&sd->bl, SC_DODGE_READY, INVALID_TIMER);
 	}
 
@@ -7760,7 +8055,7 @@ static int pc_skillatk_bonus(struct map_session_data *sd, uint16 skill_id)
 	ARR_FIND(0, ARRAYLENGTH(sd->skillatk), i, sd->skillatk[i].id == skill_id);
 	if( i < ARRAYLENGTH(sd->skillatk) ) bonus = sd->skillatk[i].val;
 
-	if(sd->sc.data[SC_PYROTECHNIC_OPTION] || sd->sc.data[SC_AQUAPLAY_OPTION])
+	if(SC_ENTRY(&sd->sc, SC_PYROTECHNIC_OPTION) || SC_ENTRY(&sd->sc, SC_AQUAPLAY_OPTION))
 		bonus += 10;
 
 	return bonus;
@@ -8162,8 +8457,8 @@ static int pc_dead(struct map_session_data *sd, struct block_list *src)
 	}
 
 	if (battle_config.death_penalty_type != 0 && pc->isDeathPenaltyJob(sd->job) && !map_flag_gvg2(sd->bl.m)
-	    && map->list[sd->bl.m].flag.noexppenalty == 0 && sd->sc.data[SC_BABY] == NULL
-	    && sd->sc.data[SC_CASH_DEATHPENALTY] == NULL && !pc->auto_exp_insurance(sd)) {
+	    && map->list[sd->bl.m].flag.noexppenalty == 0 && SC_ENTRY(&sd->sc, SC_BABY) == NULL
+	    && SC_ENTRY(&sd->sc, SC_CASH_DEATHPENALTY) == NULL && !pc->auto_exp_insurance(sd)) {
 		if (battle_config.death_penalty_base > 0) {
 			unsigned int base_penalty = 0;
 			int rate = battle_config.death_penalty_base;
@@ -8741,20 +9036,20 @@ static int pc_itemheal(struct map_session_data *sd, int itemid, int hp, int sp)
 			hp = tmp;
 
 		// Recovery Potion
-		if( sd->sc.data[SC_HEALPLUS] )
-			hp += (int)(hp * sd->sc.data[SC_HEALPLUS]->val1/100.);
+		if( SC_ENTRY(&sd->sc, SC_HEALPLUS) )
+			hp += (int)(hp * SC_ENTRY(&sd->sc, SC_HEALPLUS)->val1/100.);
 
 		// 2014 Halloween Event : Pumpkin Bonus
-		if ( sd->sc.data[SC_MTF_PUMPKIN] && itemid == ITEMID_PUMPKIN )
-			hp += (int)(hp * sd->sc.data[SC_MTF_PUMPKIN]->val1/100);
+		if ( SC_ENTRY(&sd->sc, SC_MTF_PUMPKIN) && itemid == ITEMID_PUMPKIN )
+			hp += (int)(hp * SC_ENTRY(&sd->sc, SC_MTF_PUMPKIN)->val1/100);
 
 		// Activation Potion
-		if (sd->sc.data[SC_VITALIZE_POTION] != NULL)
-			hp += hp * sd->sc.data[SC_VITALIZE_POTION]->val3 / 100;
+		if (SC_ENTRY(&sd->sc, SC_VITALIZE_POTION) != NULL)
+			hp += hp * SC_ENTRY(&sd->sc, SC_VITALIZE_POTION)->val3 / 100;
 
 #ifdef RENEWAL
-		if (sd->sc.data[SC_APPLEIDUN] != NULL)
-			hp += hp * sd->sc.data[SC_APPLEIDUN]->val3 / 100;
+		if (SC_ENTRY(&sd->sc, SC_APPLEIDUN) != NULL)
+			hp += hp * SC_ENTRY(&sd->sc, SC_APPLEIDUN)->val3 / 100;
 #endif
 	}
 	if(sp) {
@@ -8769,34 +9064,34 @@ static int pc_itemheal(struct map_session_data *sd, int itemid, int hp, int sp)
 			sp = tmp;
 	}
 	if( sd->sc.count ) {
-		if ( sd->sc.data[SC_CRITICALWOUND] ) {
-			hp -= hp * sd->sc.data[SC_CRITICALWOUND]->val2 / 100;
-			sp -= sp * sd->sc.data[SC_CRITICALWOUND]->val2 / 100;
+		if ( SC_ENTRY(&sd->sc, SC_CRITICALWOUND) ) {
+			hp -= hp * SC_ENTRY(&sd->sc, SC_CRITICALWOUND)->val2 / 100;
+			sp -= sp * SC_ENTRY(&sd->sc, SC_CRITICALWOUND)->val2 / 100;
 		}
 
-		if( sd->sc.data[SC_VITALITYACTIVATION] ){
+		if( SC_ENTRY(&sd->sc, SC_VITALITYACTIVATION) ){
 			hp += hp / 2; // 1.5 times
 			sp -= sp / 2;
 		}
 
-		if ( sd->sc.data[SC_DEATHHURT] ) {
+		if ( SC_ENTRY(&sd->sc, SC_DEATHHURT) ) {
 			hp -= hp * 20 / 100;
 			sp -= sp * 20 / 100;
 		}
 
-		if( sd->sc.data[SC_WATER_INSIGNIA] && sd->sc.data[SC_WATER_INSIGNIA]->val1 == 2 ) {
+		if( SC_ENTRY(&sd->sc, SC_WATER_INSIGNIA) && SC_ENTRY(&sd->sc, SC_WATER_INSIGNIA)->val1 == 2 ) {
 			hp += hp / 10;
 			sp += sp / 10;
 		}
 #ifdef RENEWAL
-		if( sd->sc.data[SC_EXTREMITYFIST2] )
+		if( SC_ENTRY(&sd->sc, SC_EXTREMITYFIST2) )
 			sp = 0;
 #endif
-		if (sd->sc.data[SC_BITESCAR]) {
+		if (SC_ENTRY(&sd->sc, SC_BITESCAR)) {
 			hp = 0;
 		}
 
-		if (sd->sc.data[SC_NO_RECOVER_STATE]) {
+		if (SC_ENTRY(&sd->sc, SC_NO_RECOVER_STATE)) {
 			hp = 0;
 			sp = 0;
 		}
@@ -8913,7 +9208,7 @@ static int pc_jobchange(struct map_session_data *sd, int class_, int upper)
 		for (i = 0; i < MAX_SKILL_TREE && (id = pc->skill_tree[class_idx][i].id) > 0; i++) {
 			//Remove status specific to your current tree skills.
 			enum sc_type sc = skill->get_sc_type(id);
-			if (sc > SC_COMMON_MAX && sd->sc.data[sc])
+			if (sc > SC_COMMON_MAX && SC_ENTRY(&sd->sc, sc))
 				status_change_end(&sd->bl, sc, INVALID_TIMER);
 		}
 	}
@@ -9000,7 +9295,7 @@ static int pc_jobchange(struct map_session_data *sd, int class_, int upper)
 	if (options&OPTION_CART && !pc->checkskill(sd, MC_PUSHCART))
 		options &= ~OPTION_CART;
 #else
-	if( sd->sc.data[SC_PUSH_CART] && !pc->checkskill(sd, MC_PUSHCART) )
+	if( SC_ENTRY(&sd->sc, SC_PUSH_CART) && !pc->checkskill(sd, MC_PUSHCART) )
 		pc->setcart(sd, 0);
 #endif
 	if (options != sd->sc.option)
@@ -9009,7 +9304,7 @@ static int pc_jobchange(struct map_session_data *sd, int class_, int upper)
 	if(homun_alive(sd->hd) && !pc->checkskill(sd, AM_CALLHOMUN))
 		homun->vaporize(sd, HOM_ST_REST, true);
 
-	if ((sd->sc.data[SC_SPRITEMABLE] && pc->checkskill(sd, SU_SPRITEMABLE)))
+	if ((SC_ENTRY(&sd->sc, SC_SPRITEMABLE) && pc->checkskill(sd, SU_SPRITEMABLE)))
 		status_change_end(&sd->bl, SC_SPRITEMABLE, INVALID_TIMER);
 
 	if(sd->status.manner < 0)
@@ -9261,15 +9556,15 @@ static int pc_setoption(struct map_session_data *sd, int type)
 		status_calc_pc(sd, SCO_NONE);
 
 		// End all SCs that can be reset when mado is taken off
-		for( i = 0; i < SC_MAX; i++ ) {
-			if ( !sd->sc.data[i] || !status->get_sc_type(i) )
+		STATUS_CHANGE_ITER(&sd->sc, i) {
+			if ( !status->get_sc_type(i) )
 				continue;
 			if ( status->get_sc_type(i)&SC_MADO_NO_RESET )
 				continue;
 			switch (i) {
 				case SC_BERSERK:
 				case SC_SATURDAY_NIGHT_FEVER:
-					sd->sc.data[i]->val2 = 0;
+					SC_ENTRY(&sd->sc, i)->val2 = 0;
 					break;
 			}
 			status_change_end(&sd->bl, (sc_type)i, INVALID_TIMER);
@@ -9326,7 +9621,7 @@ static int pc_setcart(struct map_session_data *sd, int type)
 
 	switch( type ) {
 		case 0:
-			if( !sd->sc.data[SC_PUSH_CART] )
+			if( !SC_ENTRY(&sd->sc, SC_PUSH_CART) )
 				return 0;
 			status_change_end(&sd->bl,SC_PUSH_CART,INVALID_TIMER);
 			clif->clearcart(sd->fd);
@@ -9335,13 +9630,13 @@ static int pc_setcart(struct map_session_data *sd, int type)
 				pc->unequipitem(sd, sd->equip_index[EQI_AMMO], PCUNEQUIPITEM_FORCE);
 			break;
 		default:/* everything else is an allowed ID so we can move on */
-			if( !sd->sc.data[SC_PUSH_CART] ) /* first time, so fill cart data */
+			if( !SC_ENTRY(&sd->sc, SC_PUSH_CART) ) /* first time, so fill cart data */
 				clif->cartList(sd);
 			clif->updatestatus(sd, SP_CARTINFO);
 		        sc_start(NULL, &sd->bl, SC_PUSH_CART, 100, type, 0, MC_PUSHCART);
 			clif->sc_load(&sd->bl, sd->bl.id, AREA, status->get_sc_icon(SC_ON_PUSH_CART), type, 0, 0);
-			if( sd->sc.data[SC_PUSH_CART] )/* forcefully update */
-				sd->sc.data[SC_PUSH_CART]->val1 = type;
+			if( SC_ENTRY(&sd->sc, SC_PUSH_CART) )/* forcefully update */
+				SC_ENTRY(&sd->sc, SC_PUSH_CART)->val1 = type;
 			break;
 	}
 
@@ -9490,18 +9785,18 @@ static bool pc_can_attack(struct map_session_data *sd, int target_id)
 {
 	nullpo_retr(false, sd);
 
-	if( sd->sc.data[SC_BASILICA] ||
-		sd->sc.data[SC__SHADOWFORM] ||
-		sd->sc.data[SC__MANHOLE] ||
-		sd->sc.data[SC_CURSEDCIRCLE_ATKER] ||
-		sd->sc.data[SC_CURSEDCIRCLE_TARGET] ||
-		sd->sc.data[SC_COLD] ||
-		sd->sc.data[SC_ALL_RIDING] || // The client doesn't let you, this is to make cheat-safe
-		sd->sc.data[SC_TRICKDEAD] ||
-		(sd->sc.data[SC_SIREN] && sd->sc.data[SC_SIREN]->val2 == target_id) ||
-		sd->sc.data[SC_BLADESTOP] ||
-		sd->sc.data[SC_DEEP_SLEEP] ||
-		sd->sc.data[SC_FALLENEMPIRE] ||
+	if( SC_ENTRY(&sd->sc, SC_BASILICA) ||
+		SC_ENTRY(&sd->sc, SC__SHADOWFORM) ||
+		SC_ENTRY(&sd->sc, SC__MANHOLE) ||
+		SC_ENTRY(&sd->sc, SC_CURSEDCIRCLE_ATKER) ||
+		SC_ENTRY(&sd->sc, SC_CURSEDCIRCLE_TARGET) ||
+		SC_ENTRY(&sd->sc, SC_COLD) ||
+		SC_ENTRY(&sd->sc, SC_ALL_RIDING) || // The client doesn't let you, this is to make cheat-safe
+		SC_ENTRY(&sd->sc, SC_TRICKDEAD) ||
+		(SC_ENTRY(&sd->sc, SC_SIREN) && SC_ENTRY(&sd->sc, SC_SIREN)->val2 == target_id) ||
+		SC_ENTRY(&sd->sc, SC_BLADESTOP) ||
+		SC_ENTRY(&sd->sc, SC_DEEP_SLEEP) ||
+		SC_ENTRY(&sd->sc, SC_FALLENEMPIRE) ||
 		sd->block_action.attack)
 			return false;
 
@@ -9517,8 +9812,8 @@ static bool pc_can_talk(struct map_session_data *sd)
 {
 	nullpo_retr(false, sd);
 
-	if( sd->sc.data[SC_BERSERK] ||
-		(sd->sc.data[SC_DEEP_SLEEP] && sd->sc.data[SC_DEEP_SLEEP]->val2) ||
+	if( SC_ENTRY(&sd->sc, SC_BERSERK) ||
+		(SC_ENTRY(&sd->sc, SC_DEEP_SLEEP) && SC_ENTRY(&sd->sc, SC_DEEP_SLEEP)->val2) ||
 		pc_ismuted(&sd->sc, MANNER_NOCHAT) ||
 		sd->block_action.chat)
 		return false;
@@ -10263,7 +10558,7 @@ static int pc_equipitem(struct map_session_data *sd, int n, int req_pos)
 	}
 
 	// If the character is in berserk mode, the item can't be equipped.
-	if (sd->sc.count != 0 && (sd->sc.data[SC_BERSERK] != NULL || sd->sc.data[SC_NO_SWITCH_EQUIP] != NULL)) {
+	if (sd->sc.count != 0 && (SC_ENTRY(&sd->sc, SC_BERSERK) != NULL || SC_ENTRY(&sd->sc, SC_NO_SWITCH_EQUIP) != NULL)) {
 		clif->equipitemack(sd, n, 0, EIA_FAIL);
 		return 0;
 	}
@@ -10502,13 +10797,13 @@ static int pc_unequipitem(struct map_session_data *sd, int n, int flag)
 	}
 
 	// If the character is in berserk mode, the item can't be unequipped.
-	if (sd->sc.count != 0 && (sd->sc.data[SC_BERSERK] != NULL || sd->sc.data[SC_NO_SWITCH_EQUIP] != NULL)
+	if (sd->sc.count != 0 && (SC_ENTRY(&sd->sc, SC_BERSERK) != NULL || SC_ENTRY(&sd->sc, SC_NO_SWITCH_EQUIP) != NULL)
 	    && (flag & PCUNEQUIPITEM_FORCE) == 0) {
 		clif->unequipitemack(sd, n, 0, UIA_FAIL);
 		return 0;
 	}
 
-	if ((flag & PCUNEQUIPITEM_FORCE) == 0 && sd->sc.count != 0 && sd->sc.data[SC_KYOUGAKU] != NULL) {
+	if ((flag & PCUNEQUIPITEM_FORCE) == 0 && sd->sc.count != 0 && SC_ENTRY(&sd->sc, SC_KYOUGAKU) != NULL) {
 		clif->unequipitemack(sd, n, 0, UIA_FAIL);
 		return 0;
 	}
@@ -10533,7 +10828,7 @@ static int pc_unequipitem(struct map_session_data *sd, int n, int flag)
 
 	status_change_end(&sd->bl, SC_HEAT_BARREL, INVALID_TIMER);
 	if ((pos & EQP_ARMS) != 0 && sd->weapontype1 == W_FIST && sd->weapontype2 == W_FIST
-	    && (sd->sc.data[SC_TK_SEVENWIND] == NULL || sd->sc.data[SC_ASPERSIO] != NULL)) { // Check for Seven Wind. (But not level seven!)
+	    && (SC_ENTRY(&sd->sc, SC_TK_SEVENWIND) == NULL || SC_ENTRY(&sd->sc, SC_ASPERSIO) != NULL)) { // Check for Seven Wind. (But not level seven!)
 		skill->enchant_elemental_end(&sd->bl, -1);
 	}
 
@@ -10594,7 +10889,7 @@ static int pc_unequipitem(struct map_session_data *sd, int n, int flag)
 		status_calc_pc(sd, SCO_NONE);
 	}
 
-	if (sd->sc.data[SC_CRUCIS] != NULL && !battle->check_undead(sd->battle_status.race, sd->battle_status.def_ele))
+	if (SC_ENTRY(&sd->sc, SC_CRUCIS) != NULL && !battle->check_undead(sd->battle_status.race, sd->battle_status.def_ele))
 		status_change_end(&sd->bl, SC_CRUCIS, INVALID_TIMER);
 
 	// Execute unequip script. [Skotlex]
@@ -11076,44 +11371,141 @@ static int pc_setsavepoint(struct map_session_data *sd, short map_index, int x,
 	return 0;
 }
 
-/*==========================================
- * Save 1 player data at autosave intervall
- *------------------------------------------*/
+/**
+ * Flags changes that the autosave scheduler should save early.
+ *
+ * @param sd    The character.
+ * @param flags The changes (enum pc_save_dirty).
+ */
+static void pc_set_save_dirty(struct map_session_data *sd, uint32 flags)
+{
+	nullpo_retv(sd);
+
+	if (sd->save_dirty == 0)
+		sd->save_dirty_tick = timer->gettick();
+	sd->save_dirty |= flags;
+}
+
+/**
+ * Time at which the autosave scheduler should save a character.
+ *
+ * Every character is saved autosave_time after its last save, since not
+ * every change is tracked; zeny, item and exp changes bring it forward to
+ * autosave_priority_time after the first of them.
+ */
+static int64 pc_autosave_due(const struct map_session_data *sd)
+{
+	int64 due;
+
+	nullpo_ret(sd);
+
+	due = sd->last_save_tick + map->autosave_interval;
+	if ((sd->save_dirty & PC_SAVE_DIRTY_PRIORITY) != 0 && map->autosave_priority_interval > 0)
+		due = min(due, sd->save_dirty_tick + map->autosave_priority_interval);
+	return due;
+}
+
+static void pc_autosave_report(int64 tick)
+{
+	struct pc_autosave_stats *stats = &pc->autosave_stats;
+
+	if (stats->saves != 0) {
+		ShowInfo("Autosave: %u saves (%u early for zeny/item/exp changes), %"PRIu64" bytes, avg lag %"PRId64" ms, max lag %"PRId64" ms, queue %d (max %d), %u runs throttled.\n",
+			stats->saves, stats->priority_saves, stats->bytes, stats->lag_total / stats->saves, stats->lag_max,
+			stats->queue, stats->queue_max, stats->throttled);
+	}
+	memset(stats, 0, sizeof(*stats));
+	stats->report_tick = tick;
+}
+
+/**
+ * Autosave scheduler, runs every minsave_time.
+ *
+ * Saves the characters that are due (see pc_autosave_due), most overdue
+ * first, up to autosave_batch per run and within the autosave_bytes_per_second
+ * budget. The saves of one run reach the char-server in the same flush.
+ */
 static int pc_autosave(int tid, int64 tick, int id, intptr_t data)
 {
-	int interval;
-	struct s_mapiterator* iter;
-	struct map_session_data* sd;
-	static int last_save_id = 0, save_flag = 0;
+	struct map_session_data *batch[PC_AUTOSAVE_BATCH_MAX];
+	int64 batch_lag[PC_AUTOSAVE_BATCH_MAX];
+	int batch_count = 0, batch_max = cap_value(map->autosave_batch, 1, PC_AUTOSAVE_BATCH_MAX);
+	int queue = 0;
+	struct pc_autosave_stats *stats = &pc->autosave_stats;
+	struct s_mapiterator *iter;
+	struct map_session_data *sd;
 
-	if(save_flag == 2) //Someone was saved on last call, normal cycle
-		save_flag = 0;
-	else
-		save_flag = 1; //Noone was saved, so save first found char.
+	if (stats->report_tick == 0)
+		stats->report_tick = tick;
+	stats->runs++;
+
+	if (map->autosave_bytes_per_second > 0) {
+		int64 elapsed = pc->autosave_budget_tick != 0 ? DIFF_TICK(tick, pc->autosave_budget_tick) : 1000;
+
+		pc->autosave_budget = min(pc->autosave_budget + (int64)map->autosave_bytes_per_second * elapsed / 1000, (int64)map->autosave_bytes_per_second);
+		pc->autosave_budget_tick = tick;
+	}
 
 	iter = mapit_getallusers();
 	for (sd = BL_UCAST(BL_PC, mapit->first(iter)); mapit->exists(iter); sd = BL_UCAST(BL_PC, mapit->next(iter))) {
-		if(sd->bl.id == last_save_id && save_flag != 1) {
-			save_flag = 1;
+		int64 lag;
+		int i;
+
+		// Spread the first saves over autosave_time, instead of saving every character online in the same runs
+		if (sd->last_save_tick == 0)
+			sd->last_save_tick = tick - rnd() % max(map->autosave_interval, 1);
+		lag = DIFF_TICK(tick, pc->autosave_due(sd));
+		if (lag < 0)
 			continue;
+		queue++;
+
+		// Keep the most overdue characters, sorted by lag
+		for (i = batch_count; i > 0 && batch_lag[i - 1] < lag; i--) {
+			if (i < batch_max) {
+				batch[i] = batch[i - 1];
+				batch_lag[i] = batch_lag[i - 1];
+			}
+		}
+		if (i < batch_max) {
+			batch[i] = sd;
+			batch_lag[i] = lag;
+			if (batch_count < batch_max)
+				batch_count++;
 		}
+	}
+	mapit->free(iter);
 
-		if(save_flag != 1) //Not our turn to save yet.
-			continue;
+	stats->queue = queue;
+	stats->queue_max = max(stats->queue_max, queue);
 
-		//Save char.
-		last_save_id = sd->bl.id;
-		save_flag = 2;
+	for (int i = 0; i < batch_count; i++) {
+		uint64 sent = chrif->save_stats[CHRIF_SAVE_REGULAR].sent_bytes;
+		bool priority;
 
-		chrif->save(sd,0);
-		break;
+		if (map->autosave_bytes_per_second > 0 && pc->autosave_budget <= 0) {
+			stats->throttled++;
+			break;
+		}
+
+		sd = batch[i];
+		priority = DIFF_TICK(sd->last_save_tick + map->autosave_interval, tick) > 0;
+		if (!chrif->save(sd, 0))
+			break; // char-server is not connected
+
+		sent = chrif->save_stats[CHRIF_SAVE_REGULAR].sent_bytes - sent;
+		pc->autosave_budget -= (int64)sent;
+		stats->saves++;
+		if (priority)
+			stats->priority_saves++;
+		stats->bytes += sent;
+		stats->lag_total += batch_lag[i];
+		stats->lag_max = max(stats->lag_max, batch_lag[i]);
 	}
-	mapit->free(iter);
 
-	interval = map->autosave_interval/(map->usercount()+1);
-	if(interval < map->minsave_interval)
-		interval = map->minsave_interval;
-	timer->add(timer->gettick()+interval,pc->autosave,0,0);
+	if (DIFF_TICK(tick, stats->report_tick) >= PC_AUTOSAVE_REPORT_INTERVAL)
+		pc->autosave_report(tick);
+
+	timer->add(timer->gettick() + map->minsave_interval, pc->autosave, 0, 0);
 
 	return 0;
 }
@@ -11196,12 +11588,12 @@ static void pc_overheat(struct map_session_data *sd, int val)
 		limit[] = { 10, 20, 28, 46, 66 };
 
 	nullpo_retv(sd);
-	if( !pc_ismadogear(sd) || sd->sc.data[SC_OVERHEAT] )
+	if( !pc_ismadogear(sd) || SC_ENTRY(&sd->sc, SC_OVERHEAT) )
 		return; // already burning
 
 	skill_lv = cap_value(pc->checkskill(sd,NC_MAINFRAME),0,4);
-	if( sd->sc.data[SC_OVERHEAT_LIMITPOINT] ) {
-		heat += sd->sc.data[SC_OVERHEAT_LIMITPOINT]->val1;
+	if( SC_ENTRY(&sd->sc, SC_OVERHEAT_LIMITPOINT) ) {
+		heat += SC_ENTRY(&sd->sc, SC_OVERHEAT_LIMITPOINT)->val1;
 		status_change_end(&sd->bl,SC_OVERHEAT_LIMITPOINT,INVALID_TIMER);
 	}
 
@@ -12194,8 +12586,8 @@ static void pc_scdata_received(struct map_session_data *sd)
 	}
 
 
-	if (sd->sc.data[SC_SOULENERGY] != NULL)
-		sd->soulball = sd->sc.data[SC_SOULENERGY]->val1;
+	if (SC_ENTRY(&sd->sc, SC_SOULENERGY) != NULL)
+		sd->soulball = SC_ENTRY(&sd->sc, SC_SOULENERGY)->val1;
 
 	sd->state.scloaded = 1;
 	if (sd->state.standalone) {
@@ -12887,6 +13279,7 @@ static void pc_clear_existing_reproduceskill(struct map_session_data *sd, bool c
 
 static void do_final_pc(void)
 {
+	pc->autosave_report(timer->gettick());
 
 	db_destroy(pc->itemcd_db);
 	pc->at_db->destroy(pc->at_db,pc->autotrade_final);
@@ -12927,7 +13320,7 @@ static void do_init_pc(bool minimal)
 	timer->add_func_list(pc->global_expiration_timer,"pc_global_expiration_timer");
 	timer->add_func_list(pc->expiration_timer,"pc_expiration_timer");
 
-	timer->add(timer->gettick() + map->autosave_interval, pc->autosave, 0, 0);
+	timer->add(timer->gettick() + map->minsave_interval, pc->autosave, 0, 0);
 
 	// 0=day, 1=night [Yor]
 	map->night_flag = battle_config.night_at_start ? 1 : 0;
@@ -13031,6 +13424,7 @@ void pc_defaults(void)
 	pc->clean_skilltree = pc_clean_skilltree;
 
 	pc->setpos = pc_setpos;
+	pc->setpos_remote = pc_setpos_remote;
 	pc->setsavepoint = pc_setsavepoint;
 	pc->randomwarp = pc_randomwarp;
 	pc->memo = pc_memo;
@@ -13038,6 +13432,11 @@ void pc_defaults(void)
 	pc->checkadditem = pc_checkadditem;
 	pc->inventoryblank = pc_inventoryblank;
 	pc->search_inventory = pc_search_inventory;
+	pc->inventory_index_build = pc_inventory_index_build;
+	pc->inventory_index_update = pc_inventory_index_update;
+	pc->inventory_index_first = pc_inventory_index_first;
+	pc->inventory_index_next = pc_inventory_index_next;
+	pc->inventory_index_check = pc_inventory_index_check;
 	pc->payzeny = pc_payzeny;
 	pc->additem = pc_additem;
 	pc->getzeny = pc_getzeny;
@@ -13258,6 +13657,9 @@ void pc_defaults(void)
 	pc->daynight_timer_sub = pc_daynight_timer_sub;
 	pc->charm_timer = pc_charm_timer;
 	pc->autosave = pc_autosave;
+	pc->set_save_dirty = pc_set_save_dirty;
+	pc->autosave_due = pc_autosave_due;
+	pc->autosave_report = pc_autosave_report;
 	pc->follow_timer = pc_follow_timer;
 	pc->read_skill_tree = pc_read_skill_tree;
 	pc->read_skill_job_skip = pc_read_skill_job_skip;
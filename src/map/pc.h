@@ -49,6 +49,22 @@
 #define MAX_PC_FEELHATE 3
 #define MAX_PC_DEVOTION 5          ///< Max amount of devotion targets
 #define PVP_CALCRANK_INTERVAL 1000 ///< PVP calculation interval
+#define PC_AUTOSAVE_BATCH_MAX 64   ///< Max characters saved by one autosave run
+#define PC_AUTOSAVE_REPORT_INTERVAL 600000 ///< Interval of the autosave statistics report, in ms
+
+/// Amount of buckets in the per-character item ID to inventory slot index (power of two, at least twice MAX_INVENTORY)
+#if MAX_INVENTORY <= 128
+#define INVENTORY_INDEX_SIZE 256
+#elif MAX_INVENTORY <= 256
+#define INVENTORY_INDEX_SIZE 512
+#elif MAX_INVENTORY <= 512
+#define INVENTORY_INDEX_SIZE 1024
+#else
+#define INVENTORY_INDEX_SIZE 2048
+#endif
+#if MAX_INVENTORY > 1024
+#error MAX_INVENTORY is too big for the inventory index, please increase INVENTORY_INDEX_SIZE
+#endif
 
 enum delitem_reason;
 
@@ -201,6 +217,24 @@ struct autocast_data {
 	bool itemskill_instant_cast; // Used by itemskill() script command, to cast skill instantaneously.
 	bool itemskill_cast_on_self; // Used by itemskill() script command, to forcefully cast skill on invoking character.
 };
+/**
+ * Item ID to inventory slot index.
+ *
+ * Every inventory slot (empty ones included, under item ID 0) is linked into
+ * the list of the item ID it holds, in ascending slot order, so that lookups
+ * by item ID return the same slot a linear scan would.
+ * Kept up to date by pc->additem, pc->delitem and pc->setinventorydata.
+ */
+struct inventory_index {
+	bool valid;                 ///< Whether the index has been built (it's built lazily on first use otherwise)
+	int nameid[MAX_INVENTORY];  ///< Item ID each slot is currently linked under
+	int16 next[MAX_INVENTORY];  ///< Next slot holding the same item ID, INDEX_NOT_FOUND at the end of the list
+	struct {
+		int nameid;             ///< Item ID of this bucket
+		int16 head;             ///< First slot holding the item ID, INDEX_NOT_FOUND if the bucket is unused
+	} buckets[INVENTORY_INDEX_SIZE]; ///< Open addressing (linear probing) item ID -> list head table
+};
+
 struct map_session_data {
 	struct block_list bl;
 	struct unit_data ud;
@@ -299,6 +333,7 @@ struct map_session_data {
 
 	struct mmo_charstatus status;
 	struct item_data *inventory_data[MAX_INVENTORY]; // direct pointers to itemdb entries (faster than doing item_id lookups)
+	struct inventory_index inventory_index; ///< Item ID to inventory slot lookup table
 	struct {
 		int current;                           ///< Marker for the current storage ID in use.
 		enum storage_access_modes access;      ///< Access level for the user.
@@ -572,6 +607,12 @@ END_ZEROED_BLOCK;
 	int avail_quests;        ///< Number of Q_ACTIVE and Q_INACTIVE entries in quest log (index of the first Q_COMPLETE entry)
 	struct quest *quest_log; ///< Quest log entries (note: Q_COMPLETE quests follow the first <avail_quests>th enties
 	bool save_quest;         ///< Whether the quest_log entries were modified and are waitin to be saved
+	struct {
+		struct quest_index_entry *entries; ///< Objectives and drop bonuses of the Q_ACTIVE quests, by monster class
+		int count;
+		int max;
+		bool built;                        ///< Whether entries match quest_log (cleared by quest->index_invalidate)
+	} quest_index; ///< @see quest_index_build()
 
 	// temporary debug [flaviojs]
 	const char* debug_file;
@@ -659,6 +700,10 @@ END_ZEROED_BLOCK;
 	bool vars_ok;
 	bool vars_dirty;
 
+	uint32 save_dirty;       ///< Changes since the last save (enum pc_save_dirty)
+	int64 save_dirty_tick;   ///< When save_dirty was first set
+	int64 last_save_tick;    ///< Last time the character was sent to the char-server
+
 	struct {
 		short stage;
 		short prizeIdx;
@@ -685,6 +730,11 @@ END_ZEROED_BLOCK;
 
 	/* Achievement System */
 	struct char_achievements achievement;
+	struct {
+		int *slots; ///< Positions in achievement + 1 (0: empty), open addressing on the achievement id
+		int size;   ///< Number of slots, power of 2
+		int count;  ///< Number of leading entries of achievement that are in slots
+	} achievement_index; ///< @see achievement_progress_find()
 	bool achievements_received;
 	// Title
 	VECTOR_DECL(int) title_ids;
@@ -747,11 +797,11 @@ END_ZEROED_BLOCK;
 #define pc_ishiding(sd)       ( (sd)->sc.option&(OPTION_HIDE|OPTION_CLOAK|OPTION_CHASEWALK) )
 #define pc_iscloaking(sd)     ( !((sd)->sc.option&OPTION_CHASEWALK) && ((sd)->sc.option&OPTION_CLOAK) )
 #define pc_ischasewalk(sd)    ( (sd)->sc.option&OPTION_CHASEWALK )
-#define pc_ismuted(sc, type)  ( (sc)->data[SC_NOCHAT] != NULL && (battle_config.manner_system & (type)) != 0 )
+#define pc_ismuted(sc, type)  ( SC_ENTRY((sc), SC_NOCHAT) != NULL && (battle_config.manner_system & (type)) != 0 )
 #define pc_isvending(sd)      ((sd)->state.vending || (sd)->state.prevend || (sd)->state.buyingstore)
 
 #ifdef NEW_CARTS
-	#define pc_iscarton(sd)       ( (sd)->sc.data[SC_PUSH_CART] )
+	#define pc_iscarton(sd)       ( SC_ENTRY(&(sd)->sc, SC_PUSH_CART) )
 #else
 	#define pc_iscarton(sd)       ( (sd)->sc.option&OPTION_CART )
 #endif
@@ -812,13 +862,13 @@ END_ZEROED_BLOCK;
 	#define pc_leftside_mdef(sd) ((sd)->battle_status.mdef)
 	#define pc_rightside_mdef(sd) ( (sd)->battle_status.mdef2 - ((sd)->battle_status.vit>>1) )
 #define pc_leftside_matk(sd) (\
-	((sd)->sc.data[SC_MAGICPOWER] && (sd)->sc.data[SC_MAGICPOWER]->val4) \
-		?((sd)->battle_status.matk_min * 100 + 50) / ((sd)->sc.data[SC_MAGICPOWER]->val3+100) \
+	(SC_ENTRY(&(sd)->sc, SC_MAGICPOWER) && SC_ENTRY(&(sd)->sc, SC_MAGICPOWER)->val4) \
+		?((sd)->battle_status.matk_min * 100 + 50) / (SC_ENTRY(&(sd)->sc, SC_MAGICPOWER)->val3+100) \
 		:(sd)->battle_status.matk_min \
 )
 #define pc_rightside_matk(sd) (\
-	((sd)->sc.data[SC_MAGICPOWER] && (sd)->sc.data[SC_MAGICPOWER]->val4) \
-		?((sd)->battle_status.matk_max * 100 + 50) / ((sd)->sc.data[SC_MAGICPOWER]->val3+100) \
+	(SC_ENTRY(&(sd)->sc, SC_MAGICPOWER) && SC_ENTRY(&(sd)->sc, SC_MAGICPOWER)->val4) \
+		?((sd)->battle_status.matk_max * 100 + 50) / (SC_ENTRY(&(sd)->sc, SC_MAGICPOWER)->val3+100) \
 		:(sd)->battle_status.matk_max \
 )
 #endif
@@ -934,6 +984,27 @@ enum player_actions_when_dead_flags {
 	PCALLOWACTION_CHAT    = 0x2, // Allow open chat room when dead.
 };
 
+/// Changes tracked by the autosave scheduler (map_session_data::save_dirty).
+enum pc_save_dirty {
+	PC_SAVE_DIRTY_ZENY  = 0x1,
+	PC_SAVE_DIRTY_ITEMS = 0x2, ///< Inventory or cart
+	PC_SAVE_DIRTY_EXP   = 0x4,
+	PC_SAVE_DIRTY_PRIORITY = PC_SAVE_DIRTY_ZENY | PC_SAVE_DIRTY_ITEMS | PC_SAVE_DIRTY_EXP, ///< Saved after autosave_priority_time
+};
+
+struct pc_autosave_stats {
+	unsigned int runs;
+	unsigned int saves;
+	unsigned int priority_saves; ///< Saves brought forward by PC_SAVE_DIRTY_PRIORITY changes
+	unsigned int throttled;      ///< Runs stopped early by the bytes/sec budget
+	uint64 bytes;                ///< Bytes sent to the char-server by autosaves
+	int64 lag_total;             ///< Sum of the time characters waited past their due time, in ms
+	int64 lag_max;
+	int queue;                   ///< Characters due at the last run
+	int queue_max;
+	int64 report_tick;
+};
+
 /*=====================================
 * Interface : pc.h
 * Generated by HerculesInterfaceMaker
@@ -975,6 +1046,10 @@ END_ZEROED_BLOCK; /* End */
 	struct eri *str_reg_ers;
 	/* */
 	bool reg_load;
+	/* autosave scheduler */
+	struct pc_autosave_stats autosave_stats;
+	int64 autosave_budget;      ///< Bytes the scheduler may still send (token bucket)
+	int64 autosave_budget_tick; ///< Last refill of autosave_budget
 	/* funcs */
 	void (*init) (bool minimal);
 	void (*final) (void);
@@ -1014,6 +1089,7 @@ END_ZEROED_BLOCK; /* End */
 	int (*clean_skilltree) (struct map_session_data *sd);
 
 	int (*setpos) (struct map_session_data* sd, unsigned short map_index, int x, int y, enum clr_type clrtype);
+	int (*setpos_remote) (struct map_session_data *sd, unsigned short map_index, int x, int y, uint32 ip, uint16 port, enum clr_type clrtype);
 	int (*setsavepoint) (struct map_session_data *sd, short map_index, int x, int y);
 	int (*randomwarp) (struct map_session_data *sd, enum clr_type type);
 	int (*memo) (struct map_session_data* sd, int pos);
@@ -1021,6 +1097,11 @@ END_ZEROED_BLOCK; /* End */
 	int (*checkadditem) (struct map_session_data *sd,int nameid,int amount);
 	int (*inventoryblank) (struct map_session_data *sd);
 	int (*search_inventory) (struct map_session_data *sd,int item_id);
+	void (*inventory_index_build) (struct map_session_data *sd);
+	void (*inventory_index_update) (struct map_session_data *sd, int n);
+	int (*inventory_index_first) (struct map_session_data *sd, int nameid);
+	int (*inventory_index_next) (struct map_session_data *sd, int n);
+	bool (*inventory_index_check) (struct map_session_data *sd);
 	int (*payzeny) (struct map_session_data *sd,int zeny, enum e_log_pick_type type, struct map_session_data *tsd);
 	int (*additem) (struct map_session_data *sd, const struct item *item_data, int amount, e_log_pick_type log_type);
 	int (*getzeny) (struct map_session_data *sd,int zeny, enum e_log_pick_type type, struct map_session_data *tsd);
@@ -1241,6 +1322,9 @@ END_ZEROED_BLOCK; /* End */
 	int (*daynight_timer_sub) (struct map_session_data *sd,va_list ap);
 	int (*charm_timer) (int tid, int64 tick, int id, intptr_t data);
 	int (*autosave) (int tid, int64 tick, int id, intptr_t data);
+	void (*set_save_dirty) (struct map_session_data *sd, uint32 flags);
+	int64 (*autosave_due) (const struct map_session_data *sd);
+	void (*autosave_report) (int64 tick);
 	int (*follow_timer) (int tid, int64 tick, int id, intptr_t data);
 	void (*read_skill_tree) (void);
 	bool (*read_skill_job_skip) (short skill_id, int job_id);
@@ -149,6 +149,7 @@ static int quest_add(struct map_session_data *sd, int quest_id, unsigned int tim
 	sd->quest_log[n].state = Q_ACTIVE;
 
 	sd->save_quest = true;
+	quest->index_invalidate(sd);
 	sd->last_added_quest_id = qi->id;
 
 	clif->quest_add(sd, &sd->quest_log[n]);
@@ -207,6 +208,7 @@ static int quest_change(struct map_session_data *sd, int qid1, int qid2)
 	sd->quest_log[i].state = Q_ACTIVE;
 
 	sd->save_quest = true;
+	quest->index_invalidate(sd);
 
 	clif->quest_delete(sd, qid1);
 	clif->quest_add(sd, &sd->quest_log[i]);
@@ -256,6 +258,7 @@ static int quest_delete(struct map_session_data *sd, int quest_id)
 		RECREATE(sd->quest_log, struct quest, sd->num_quests);
 	}
 	sd->save_quest = true;
+	quest->index_invalidate(sd);
 
 	clif->quest_delete(sd, quest_id);
 	quest->questinfo_refresh(sd);
@@ -296,29 +299,193 @@ static int quest_update_objective_sub(struct block_list *bl, va_list ap)
 }
 
 
+/**
+ * Compares two quest index entries in the order of a quest_log scan: by quest,
+ * objectives before drop bonuses, then by position in the quest's DB entry.
+ *
+ * @see quest_update_objective
+ */
+static int quest_index_order_cmp(const struct quest_index_entry *ea, const struct quest_index_entry *eb)
+{
+	if (ea->idx != eb->idx)
+		return ea->idx < eb->idx ? -1 : 1;
+	if (ea->kind != eb->kind)
+		return ea->kind < eb->kind ? -1 : 1;
+	if (ea->j != eb->j)
+		return ea->j < eb->j ? -1 : 1;
+	return 0;
+}
+
+/**
+ * Compares two quest index entries, by monster class then in quest_log order.
+ *
+ * @see quest_index_build
+ */
+static int quest_index_cmp(const void *a, const void *b)
+{
+	const struct quest_index_entry *ea = a, *eb = b;
+
+	if (ea->mob_id != eb->mob_id)
+		return ea->mob_id < eb->mob_id ? -1 : 1;
+	return quest_index_order_cmp(ea, eb);
+}
+
+/**
+ * Appends an entry to a character's quest index.
+ *
+ * @see quest_index_build
+ */
+static void quest_index_push(struct map_session_data *sd, int mob_id, int idx, enum quest_index_kind kind, int j)
+{
+	struct quest_index_entry *entry;
+
+	if (sd->quest_index.count == sd->quest_index.max) {
+		sd->quest_index.max += 32;
+		RECREATE(sd->quest_index.entries, struct quest_index_entry, sd->quest_index.max);
+	}
+	entry = &sd->quest_index.entries[sd->quest_index.count++];
+	entry->mob_id = mob_id;
+	entry->idx = idx;
+	entry->kind = kind;
+	entry->j = j;
+}
+
+/**
+ * Builds the index of the objectives and drop bonuses of a character's
+ * active quests by monster class, so that a kill only visits the entries of
+ * the killed monster's class and the ones that apply to any class.
+ *
+ * @param sd Character's data
+ */
+static void quest_index_build(struct map_session_data *sd)
+{
+	int i, j;
+
+	nullpo_retv(sd);
+
+	sd->quest_index.count = 0;
+	for (i = 0; i < sd->avail_quests; i++) {
+		const struct quest_db *qi = NULL;
+
+		if (sd->quest_log[i].state != Q_ACTIVE)
+			continue;
+
+		qi = quest->db(sd->quest_log[i].quest_id);
+		for (j = 0; j < qi->objectives_count; j++)
+			quest_index_push(sd, qi->objectives[j].mob, i, QUEST_INDEX_OBJECTIVE, j);
+		for (j = 0; j < qi->dropitem_count; j++)
+			quest_index_push(sd, qi->dropitem[j].mob_id, i, QUEST_INDEX_DROPITEM, j);
+	}
+	if (sd->quest_index.count > 1)
+		qsort(sd->quest_index.entries, sd->quest_index.count, sizeof(*sd->quest_index.entries), quest_index_cmp);
+	sd->quest_index.built = true;
+}
+
+/**
+ * Marks a character's quest index as outdated, it will be rebuilt on the next kill.
+ *
+ * To be called whenever the Q_ACTIVE entries of quest_log or their position change.
+ *
+ * @param sd Character's data
+ */
+static void quest_index_invalidate(struct map_session_data *sd)
+{
+	nullpo_retv(sd);
+	sd->quest_index.built = false;
+}
+
+/**
+ * Frees a character's quest index.
+ *
+ * @param sd Character's data
+ */
+static void quest_index_clear(struct map_session_data *sd)
+{
+	nullpo_retv(sd);
+	aFree(sd->quest_index.entries);
+	sd->quest_index.entries = NULL;
+	sd->quest_index.count = sd->quest_index.max = 0;
+	sd->quest_index.built = false;
+}
+
+/**
+ * Looks up the quest index entries of a monster class, rebuilding the index if needed.
+ *
+ * @param sd     Character's data
+ * @param mob_id Monster class (0 for the entries that apply to any class)
+ * @param count  Set to the number of entries found
+ * @return the first entry of the class, in quest_log order
+ */
+static const struct quest_index_entry *quest_index_find(struct map_session_data *sd, int mob_id, int *count)
+{
+	int lo = 0, hi, start;
+
+	nullpo_retr(NULL, sd);
+	nullpo_retr(NULL, count);
+
+	if (!sd->quest_index.built)
+		quest->index_build(sd);
+
+	hi = sd->quest_index.count;
+	while (lo < hi) {
+		int mid = (lo + hi) / 2;
+		if (sd->quest_index.entries[mid].mob_id < mob_id)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	start = lo;
+	while (lo < sd->quest_index.count && sd->quest_index.entries[lo].mob_id == mob_id)
+		lo++;
+	*count = lo - start;
+	return sd->quest_index.entries + start;
+}
+
 /**
  * Updates the quest objectives for a character after killing a monster, including the handling of quest-granted drops.
  *
+ * Only the index entries of the monster's class and the ones that apply to
+ * any class are visited, merged back into quest_log order so that objectives
+ * and drop rolls happen in the same order as a full scan of the quest log.
+ *
  * @param sd     Character's data
  * @param mob_id Monster ID
  */
 static void quest_update_objective(struct map_session_data *sd, const struct mob_data *md)
 {
-	int i,j;
+	const struct quest_index_entry *any = NULL, *cls = NULL;
+	int any_count = 0, cls_count = 0;
+	int a = 0, c = 0;
 
 	nullpo_retv(sd);
 	nullpo_retv(md);
 
-	for (i = 0; i < sd->avail_quests; i++) {
+	if (sd->avail_quests == 0)
+		return;
+
+	any = quest->index_find(sd, 0, &any_count);
+	if (md->class_ != 0)
+		cls = quest->index_find(sd, md->class_, &cls_count);
+
+	while (a < any_count || c < cls_count) {
+		const struct quest_index_entry *entry = NULL;
 		struct quest_db *qi = NULL;
+		int i, j;
+
+		if (c == cls_count || (a < any_count && quest_index_order_cmp(&any[a], &cls[c]) < 0))
+			entry = &any[a++];
+		else
+			entry = &cls[c++];
 
-		if (sd->quest_log[i].state != Q_ACTIVE) // Skip inactive quests
+		i = entry->idx;
+		j = entry->j;
+		if (i >= sd->avail_quests || sd->quest_log[i].state != Q_ACTIVE) // Changed during this kill
 			continue;
 
 		qi = quest->db(sd->quest_log[i].quest_id);
 
-		for (j = 0; j < qi->objectives_count; j++) {
-			if ((qi->objectives[j].mob == 0 || qi->objectives[j].mob == md->class_) &&
+		if (entry->kind == QUEST_INDEX_OBJECTIVE) {
+			if (j < qi->objectives_count &&
 				sd->quest_log[i].count[j] < qi->objectives[j].count &&
 				(qi->objectives[j].level.min == 0 || qi->objectives[j].level.min <= md->level) &&
 				(qi->objectives[j].level.max == 0 || qi->objectives[j].level.max >= md->level) &&
@@ -330,16 +497,12 @@ static void quest_update_objective(struct map_session_data *sd, const struct mob
 					sd->save_quest = true;
 					clif->quest_update_objective(sd, &sd->quest_log[i]);
 			}
-		}
-
-		// process quest-granted extra drop bonuses
-		for (j = 0; j < qi->dropitem_count; j++) {
+		} else if (j < qi->dropitem_count) {
+			// process quest-granted extra drop bonuses
 			struct quest_dropitem *dropitem = &qi->dropitem[j];
 			struct item item;
 			struct item_data *data = NULL;
 			int temp;
-			if (dropitem->mob_id != 0 && dropitem->mob_id != md->class_)
-				continue;
 			// TODO: Should this be affected by server rates?
 			if (rnd()%10000 >= dropitem->rate)
 				continue;
@@ -380,6 +543,7 @@ static int quest_update_status(struct map_session_data *sd, int quest_id, enum q
 
 	sd->quest_log[i].state = qs;
 	sd->save_quest = true;
+	quest->index_invalidate(sd);
 
 	if( qs < Q_COMPLETE ) {
 		clif->quest_update_status(sd, quest_id, qs == Q_ACTIVE ? true : false);
@@ -739,6 +903,7 @@ static int quest_reload_check_sub(struct map_session_data *sd, va_list ap)
 	sd->num_quests = j;
 	ARR_FIND(0, sd->num_quests, i, sd->quest_log[i].state == Q_COMPLETE);
 	sd->avail_quests = i;
+	quest->index_invalidate(sd); // The quest DB entries were reloaded too
 
 	return 1;
 }
@@ -934,10 +1099,8 @@ static bool quest_questinfo_validate_items(struct map_session_data *sd, struct q
 	for (int i = 0; i < VECTOR_LENGTH(qi->items); i++) {
 		struct questinfo_itemreq *item = &VECTOR_INDEX(qi->items, i);
 		int count = 0;
-		for (int j = 0; j < sd->status.inventorySize; j++) {
-			if (sd->status.inventory[j].nameid == item->nameid)
-				count += sd->status.inventory[j].amount;
-		}
+		for (int j = pc->inventory_index_first(sd, item->nameid); j != INDEX_NOT_FOUND && j < sd->status.inventorySize; j = pc->inventory_index_next(sd, j))
+			count += sd->status.inventory[j].amount;
 		if (count < item->min || count > item->max)
 			return false;
 	}
@@ -1176,6 +1339,10 @@ void quest_defaults(void)
 	quest->update_objective_sub = quest_update_objective_sub;
 	quest->update_objective = quest_update_objective;
 	quest->update_status = quest_update_status;
+	quest->index_build = quest_index_build;
+	quest->index_invalidate = quest_index_invalidate;
+	quest->index_clear = quest_index_clear;
+	quest->index_find = quest_index_find;
 	quest->check = quest_check;
 	quest->clear = quest_clear_db;
 	quest->read_db = quest_read_db;
@@ -107,6 +107,25 @@ struct quest_db {
 	//char name[NAME_LENGTH];
 };
 
+/// Kinds of entries of a player's quest index
+enum quest_index_kind {
+	QUEST_INDEX_OBJECTIVE, ///< Hunting objective (quest_db::objectives)
+	QUEST_INDEX_DROPITEM,  ///< Quest-granted drop bonus (quest_db::dropitem)
+};
+
+/**
+ * Objective or drop bonus of one of a player's active quests.
+ *
+ * The entries of a player are sorted by monster class, then in the order
+ * quest_update_objective() used to visit them.
+ */
+struct quest_index_entry {
+	int mob_id;                ///< Monster class the entry applies to (0: any class, e.g. race/size/element objectives)
+	int idx;                   ///< Position of the quest in quest_log
+	enum quest_index_kind kind;
+	int j;                     ///< Position of the objective or drop bonus in the quest_db entry
+};
+
 // Questlog check types
 enum quest_check_type {
 	HAVEQUEST, ///< Query the state of the given quest
@@ -163,6 +182,10 @@ struct quest_interface {
 	int (*update_objective_sub) (struct block_list *bl, va_list ap);
 	void (*update_objective) (struct map_session_data *sd, const struct mob_data *md);
 	int (*update_status) (struct map_session_data *sd, int quest_id, enum quest_state qs);
+	void (*index_build) (struct map_session_data *sd);
+	void (*index_invalidate) (struct map_session_data *sd);
+	void (*index_clear) (struct map_session_data *sd);
+	const struct quest_index_entry *(*index_find) (struct map_session_data *sd, int mob_id, int *count);
 	int (*check) (struct map_session_data *sd, int quest_id, enum quest_check_type type);
 	void (*clear) (void);
 	int (*read_db) (void);
@@ -628,10 +628,58 @@ static int script_add_str(const char *p)
 	script->str_data[script->str_num].backpatch = -1;
 	script->str_data[script->str_num].label = -1;
 	script->str_pos += len+1;
+	script->classify_variable(script->str_num);
 
 	return script->str_num++;
 }
 
+/**
+ * Resolves the storage and type of a variable from its name, so that it
+ * doesn't need to be parsed again every time the variable is accessed.
+ *
+ * The result is only meaningful for entries that end up being C_NAME.
+ *
+ * @param key The str_data entry to classify.
+ */
+static void script_classify_variable(int key)
+{
+	struct str_data_struct *data;
+	const char *name;
+	size_t len;
+
+	Assert_retv(key >= 0 && key < script->str_data_size);
+	data = &script->str_data[key];
+	name = script->str_buf + data->str;
+	len = strlen(name);
+
+	data->var_string = (len > 0 && name[len - 1] == '$') ? 1 : 0;
+	data->var_toolong = (len > SCRIPT_VARNAME_LENGTH) ? 1 : 0;
+
+	switch (name[0]) {
+	case '\0':
+		data->var_scope = SCRIPT_VAR_NONE;
+		break;
+	case '@':
+		data->var_scope = SCRIPT_VAR_CHAR_TEMP;
+		break;
+	case '$':
+		data->var_scope = SCRIPT_VAR_SERVER;
+		break;
+	case '#':
+		data->var_scope = (name[1] == '#') ? SCRIPT_VAR_ACCOUNT_GLOBAL : SCRIPT_VAR_ACCOUNT;
+		break;
+	case '.':
+		data->var_scope = (name[1] == '@') ? SCRIPT_VAR_SCOPE : SCRIPT_VAR_NPC;
+		break;
+	case '\'':
+		data->var_scope = SCRIPT_VAR_INSTANCE;
+		break;
+	default:
+		data->var_scope = SCRIPT_VAR_CHAR;
+		break;
+	}
+}
+
 static int script_add_variable(const char *varname)
 {
 	int key = script->search_str(varname);
@@ -715,6 +763,10 @@ static void add_scriptl(int l)
 			break;
 		case C_NOP:
 		case C_USERFUNC:
+			if (script->str_data[l].var_scope == SCRIPT_VAR_SCOPE || script->str_data[l].var_scope == SCRIPT_VAR_NPC) {
+				VECTOR_ENSURE(script->parse_var_ids, 1, SCRIPT_BLOCK_SIZE);
+				VECTOR_PUSH(script->parse_var_ids, l);
+			}
 			// Embedded data backpatch there is a possibility of label
 			script->addc(C_NAME);
 			script->str_data[l].backpatch = VECTOR_LENGTH(script->buf);
@@ -728,6 +780,10 @@ static void add_scriptl(int l)
 				script->addc(C_NEG);
 			break;
 		default: // assume C_NAME
+			if (script->str_data[l].var_scope == SCRIPT_VAR_SCOPE || script->str_data[l].var_scope == SCRIPT_VAR_NPC) {
+				VECTOR_ENSURE(script->parse_var_ids, 1, SCRIPT_BLOCK_SIZE);
+				VECTOR_PUSH(script->parse_var_ids, l);
+			}
 			script->addc(C_NAME);
 			script->addb(l);
 			script->addb(l>>8);
@@ -2947,6 +3003,7 @@ static struct script_code *parse_script(const char *src, const char *file, int l
 	}
 
 	VECTOR_TRUNCATE(script->buf);
+	VECTOR_TRUNCATE(script->parse_var_ids);
 	script->parse_nextline(true, NULL);
 
 	// who called parse_script is responsible for clearing the database after using it, but just in case... lets clear it here
@@ -3133,6 +3190,10 @@ static struct script_code *parse_script(const char *src, const char *file, int l
 	VECTOR_PUSHARRAY(code->script_buf, VECTOR_DATA(script->buf), VECTOR_LENGTH(script->buf));
 	code->local.vars = NULL;
 	code->local.arrays = NULL;
+	script->var_slots_build(&code->scope_slots, SCRIPT_VAR_SCOPE);
+	script->var_slots_build(&code->npc_slots, SCRIPT_VAR_NPC);
+	code->local.slots = script->reg_slots_alloc(&code->npc_slots);
+	VECTOR_TRUNCATE(script->parse_var_ids);
 #ifdef ENABLE_CASE_CHECK
 	script->local_casecheck.clear();
 	script->parser_current_src = NULL;
@@ -3163,6 +3224,9 @@ static struct script_code *script_clone_script(struct script_code* original)
 
 	code->local.vars = NULL;
 	code->local.arrays = NULL;
+	script->var_slots_copy(&code->scope_slots, &original->scope_slots);
+	script->var_slots_copy(&code->npc_slots, &original->npc_slots);
+	code->local.slots = script->reg_slots_alloc(&code->npc_slots);
 
 	return code;
 }
@@ -3217,10 +3281,13 @@ static struct map_session_data *script_nick2sd(struct script_state *st, const ch
 
 static char *get_val_npcscope_str(struct script_state *st, struct reg_db *n, struct script_data *data)
 {
-	if (n)
-		return (char*)i64db_get(n->vars, reference_getuid(data));
-	else
+	union script_reg_value *slot;
+
+	if (n == NULL)
 		return NULL;
+	if ((slot = script->reg_slot(n, reference_getuid(data))) != NULL)
+		return slot->str;
+	return (char*)i64db_get(n->vars, reference_getuid(data));
 }
 
 static char *get_val_pc_ref_str(struct script_state *st, struct reg_db *n, struct script_data *data)
@@ -3245,10 +3312,13 @@ static char *get_val_instance_str(struct script_state *st, const char *name, str
 
 static int get_val_npcscope_num(struct script_state *st, struct reg_db *n, struct script_data *data)
 {
-	if (n)
-		return (int)i64db_iget(n->vars, reference_getuid(data));
-	else
+	union script_reg_value *slot;
+
+	if (n == NULL)
 		return 0;
+	if ((slot = script->reg_slot(n, reference_getuid(data))) != NULL)
+		return slot->num;
+	return (int)i64db_iget(n->vars, reference_getuid(data));
 }
 
 static int get_val_pc_ref_num(struct script_state *st, struct reg_db *n, struct script_data *data)
@@ -3280,28 +3350,27 @@ static int get_val_instance_num(struct script_state *st, const char *name, struc
 static struct script_data *get_val(struct script_state *st, struct script_data *data)
 {
 	const char* name;
-	char prefix;
-	char postfix;
+	const struct str_data_struct *var;
 	struct map_session_data *sd = NULL;
 
 	if (!data_isreference(data))
 		return data;// not a variable/constant
 
-	name = reference_getname(data);
-	prefix = name[0];
-	postfix = name[strlen(name) - 1];
+	// scope, type and length of the name are resolved by script->classify_variable
+	var = &script->str_data[reference_getid(data)];
+	name = script->str_buf + var->str;
 
-	if (strlen(name) > SCRIPT_VARNAME_LENGTH) {
+	if (var->var_toolong) {
 		ShowError("script_get_val: variable name too long. '%s'\n", name);
 		script->reportsrc(st);
 		st->state = END;
 		return data;
 	}
 
-	if (((reference_tovariable(data) && not_server_variable(prefix)) || reference_toparam(data)) && reference_getref(data) == NULL) {
+	if (((var->type == C_NAME && not_server_scope(var->var_scope)) || var->type == C_PARAM) && reference_getref(data) == NULL) {
 		sd = script->rid2sd(st);
 		if (sd == NULL) {// needs player attached
-			if (postfix == '$') {// string variable
+			if (var->var_string) {// string variable
 				ShowWarning("script_get_val: cannot access player variable '%s', defaulting to \"\"\n", name);
 				data->type = C_CONSTSTR;
 				data->u.str = "";
@@ -3314,40 +3383,50 @@ static struct script_data *get_val(struct script_state *st, struct script_data *
 		}
 	}
 
-	if (postfix == '$') {
+	if (var->var_string) {
 		// string variable
 		const char *str = NULL;
 
-		switch (prefix) {
-		case '@':
+		switch (var->var_scope) {
+		case SCRIPT_VAR_CHAR_TEMP:
 			if (data->ref) {
 				str = script->get_val_ref_str(st, data->ref, data);
 			} else {
 				str = pc->readregstr(sd, data->u.num);
 			}
 			break;
-		case '$':
+		case SCRIPT_VAR_SERVER:
 			str = mapreg->readregstr(data->u.num);
 			break;
-		case '#':
+		case SCRIPT_VAR_ACCOUNT_GLOBAL:
 			if (data->ref) {
 				str = script->get_val_pc_ref_str(st, data->ref, data);
-			} else if (name[1] == '#') {
+			} else {
 				str = pc_readaccountreg2str(sd, data->u.num);// global
+			}
+			break;
+		case SCRIPT_VAR_ACCOUNT:
+			if (data->ref) {
+				str = script->get_val_pc_ref_str(st, data->ref, data);
 			} else {
 				str = pc_readaccountregstr(sd, data->u.num);// local
 			}
 			break;
-		case '.':
+		case SCRIPT_VAR_SCOPE:
 			if (data->ref) {
 				str = script->get_val_ref_str(st, data->ref, data);
-			} else if (name[1] == '@') {
+			} else {
 				str = script->get_val_scope_str(st, &st->stack->scope, data);
+			}
+			break;
+		case SCRIPT_VAR_NPC:
+			if (data->ref) {
+				str = script->get_val_ref_str(st, data->ref, data);
 			} else {
 				str = script->get_val_npc_str(st, &st->script->local, data);
 			}
 			break;
-		case '\'':
+		case SCRIPT_VAR_INSTANCE:
 			str = script->get_val_instance_str(st, name, data);
 			break;
 		default:
@@ -3372,41 +3451,51 @@ static struct script_data *get_val(struct script_state *st, struct script_data *
 
 		data->type = C_INT;
 
-		if( reference_toconstant(data) ) {
-			data->u.num = reference_getconstant(data);
-		} else if( reference_toparam(data) ) {
-			data->u.num = pc->readparam(sd, reference_getparamtype(data));
+		if (var->type == C_INT) {
+			data->u.num = var->val;
+		} else if (var->type == C_PARAM) {
+			data->u.num = pc->readparam(sd, var->val);
 		} else {
-			switch (prefix) {
-			case '@':
+			switch (var->var_scope) {
+			case SCRIPT_VAR_CHAR_TEMP:
 				if (data->ref) {
 					data->u.num = script->get_val_ref_num(st, data->ref, data);
 				} else {
 					data->u.num = pc->readreg(sd, data->u.num);
 				}
 				break;
-			case '$':
+			case SCRIPT_VAR_SERVER:
 				data->u.num = mapreg->readreg(data->u.num);
 				break;
-			case '#':
+			case SCRIPT_VAR_ACCOUNT_GLOBAL:
 				if (data->ref) {
 					data->u.num = script->get_val_pc_ref_num(st, data->ref, data);
-				} else if (name[1] == '#') {
+				} else {
 					data->u.num = pc_readaccountreg2(sd, data->u.num);// global
+				}
+				break;
+			case SCRIPT_VAR_ACCOUNT:
+				if (data->ref) {
+					data->u.num = script->get_val_pc_ref_num(st, data->ref, data);
 				} else {
 					data->u.num = pc_readaccountreg(sd, data->u.num);// local
 				}
 				break;
-			case '.':
+			case SCRIPT_VAR_SCOPE:
 				if (data->ref) {
 					data->u.num = script->get_val_ref_num(st, data->ref, data);
-				} else if (name[1] == '@') {
+				} else {
 					data->u.num = script->get_val_scope_num(st, &st->stack->scope, data);
+				}
+				break;
+			case SCRIPT_VAR_NPC:
+				if (data->ref) {
+					data->u.num = script->get_val_ref_num(st, data->ref, data);
 				} else {
 					data->u.num = script->get_val_npc_num(st, &st->script->local, data);
 				}
 				break;
-			case '\'':
+			case SCRIPT_VAR_INSTANCE:
 				data->u.num = script->get_val_instance_num(st, name, data);
 				break;
 			default:
@@ -3717,7 +3806,14 @@ static void set_reg_npcscope_str(struct script_state *st, struct reg_db *n, int6
 {
 	if (n)
 	{
+		union script_reg_value *slot;
+
 		nullpo_retv(str);
+		if ((slot = script->reg_slot(n, num)) != NULL) {
+			aFree(slot->str);
+			slot->str = str[0] ? aStrdup(str) : NULL;
+			return;
+		}
 		if (str[0]) {
 			i64db_put(n->vars, num, aStrdup(str));
 			if (script_getvaridx(num))
@@ -3759,6 +3855,12 @@ static void set_reg_pc_ref_num(struct script_state *st, struct reg_db *n, int64
 static void set_reg_npcscope_num(struct script_state *st, struct reg_db *n, int64 num, const char *name, int val)
 {
 	if (n) {
+		union script_reg_value *slot;
+
+		if ((slot = script->reg_slot(n, num)) != NULL) {
+			slot->num = val;
+			return;
+		}
 		if (val != 0) {
 			i64db_iput(n->vars, num, val);
 			if (script_getvaridx(num))
@@ -3851,11 +3953,12 @@ static bool script_is_permanent_variable(const char *name)
  *------------------------------------------*/
 static int set_reg(struct script_state *st, struct map_session_data *sd, int64 num, const char *name, const void *value, struct reg_db *ref)
 {
-	char prefix;
+	const struct str_data_struct *var;
 	nullpo_ret(name);
-	prefix = name[0];
 
-	if (script->str_data[script_getvarid(num)].type != C_NAME && script->str_data[script_getvarid(num)].type != C_PARAM) {
+	// scope, type and length of the name are resolved by script->classify_variable
+	var = &script->str_data[script_getvarid(num)];
+	if (var->type != C_NAME && var->type != C_PARAM) {
 		ShowError("script:set_reg: not a variable! '%s'\n", name);
 
 		// to avoid this don't do script->add_str(") without setting its type.
@@ -3868,7 +3971,7 @@ static int set_reg(struct script_state *st, struct map_session_data *sd, int64 n
 		return 0;
 	}
 
-	if (strlen(name) > SCRIPT_VARNAME_LENGTH) {
+	if (var->var_toolong) {
 		ShowError("script:set_reg: variable name too long. '%s'\n", name);
 		if (st) {
 			script->reportsrc(st);
@@ -3877,7 +3980,7 @@ static int set_reg(struct script_state *st, struct map_session_data *sd, int64 n
 		return 0;
 	}
 
-	if (is_string_variable(name)) {// string variable
+	if (var->var_string) {// string variable
 		const char *str = (const char*)value;
 
 		if (script->is_permanent_variable(name) && strlen(str) > SCRIPT_STRING_VAR_LENGTH) {
@@ -3892,36 +3995,46 @@ static int set_reg(struct script_state *st, struct map_session_data *sd, int64 n
 			return 0;
 		}
 
-		switch (prefix) {
-		case '@':
+		switch (var->var_scope) {
+		case SCRIPT_VAR_CHAR_TEMP:
 			if (ref) {
 				script->set_reg_ref_str(st, ref, num, name, str);
 			} else {
 				pc->setregstr(sd, num, str);
 			}
 			return 1;
-		case '$':
+		case SCRIPT_VAR_SERVER:
 			mapreg->setregstr(num, str);
 			return 1;
-		case '#':
+		case SCRIPT_VAR_ACCOUNT_GLOBAL:
 			if (ref) {
 				script->set_reg_pc_ref_str(st, ref, num, name, str);
-			} else if (name[1] == '#') {
+			} else {
 				pc_setaccountreg2str(sd, num, str);
+			}
+			return 1;
+		case SCRIPT_VAR_ACCOUNT:
+			if (ref) {
+				script->set_reg_pc_ref_str(st, ref, num, name, str);
 			} else {
 				pc_setaccountregstr(sd, num, str);
 			}
 			return 1;
-		case '.':
+		case SCRIPT_VAR_SCOPE:
 			if (ref) {
 				script->set_reg_ref_str(st, ref, num, name, str);
-			} else if (name[1] == '@') {
+			} else {
 				script->set_reg_scope_str(st, &st->stack->scope, num, name, str);
+			}
+			return 1;
+		case SCRIPT_VAR_NPC:
+			if (ref) {
+				script->set_reg_ref_str(st, ref, num, name, str);
 			} else {
 				script->set_reg_npc_str(st, &st->script->local, num, name, str);
 			}
 			return 1;
-		case '\'':
+		case SCRIPT_VAR_INSTANCE:
 			set_reg_instance_str(st, num, name, str);
 			return 1;
 		default:
@@ -3937,8 +4050,8 @@ static int set_reg(struct script_state *st, struct map_session_data *sd, int64 n
 		// to a 32bit int, this will lead to overflows! [Panikon]
 		int val = (int)h64BPTRSIZE(value);
 
-		if (script->str_data[script_getvarid(num)].type == C_PARAM) {
-			if (pc->setparam(sd, script->str_data[script_getvarid(num)].val, val) == 0) {
+		if (var->type == C_PARAM) {
+			if (pc->setparam(sd, var->val, val) == 0) {
 				if (st != NULL) {
 					ShowError("script:set_reg: failed to set param '%s' to %d.\n", name, val);
 					script->reportsrc(st);
@@ -3954,36 +4067,46 @@ static int set_reg(struct script_state *st, struct map_session_data *sd, int64 n
 			return 1;
 		}
 
-		switch (prefix) {
-		case '@':
+		switch (var->var_scope) {
+		case SCRIPT_VAR_CHAR_TEMP:
 			if (ref) {
 				script->set_reg_ref_num(st, ref, num, name, val);
 			} else {
 				pc->setreg(sd, num, val);
 			}
 			return 1;
-		case '$':
+		case SCRIPT_VAR_SERVER:
 			mapreg->setreg(num, val);
 			return 1;
-		case '#':
+		case SCRIPT_VAR_ACCOUNT_GLOBAL:
 			if (ref) {
 				script->set_reg_pc_ref_num(st, ref, num, name, val);
-			} else if (name[1] == '#') {
+			} else {
 				pc_setaccountreg2(sd, num, val);
+			}
+			return 1;
+		case SCRIPT_VAR_ACCOUNT:
+			if (ref) {
+				script->set_reg_pc_ref_num(st, ref, num, name, val);
 			} else {
 				pc_setaccountreg(sd, num, val);
 			}
 			return 1;
-		case '.':
+		case SCRIPT_VAR_SCOPE:
 			if (ref) {
 				script->set_reg_ref_num(st, ref, num, name, val);
-			} else if (name[1] == '@') {
+			} else {
 				script->set_reg_scope_num(st, &st->stack->scope, num, name, val);
+			}
+			return 1;
+		case SCRIPT_VAR_NPC:
+			if (ref) {
+				script->set_reg_ref_num(st, ref, num, name, val);
 			} else {
 				script->set_reg_npc_num(st, &st->script->local, num, name, val);
 			}
 			return 1;
-		case '\'':
+		case SCRIPT_VAR_INSTANCE:
 			set_reg_instance_num(st, num, name, val);
 			return 1;
 		default:
@@ -4243,6 +4366,10 @@ static void pop_stack(struct script_state *st, int start, int end)
 				ri->scope.arrays->destroy(ri->scope.arrays,script->array_free_db);
 				ri->scope.arrays = NULL;
 			}
+			if (ri->scope.slots != NULL) {
+				script->reg_slots_free(ri->scope.slots);
+				ri->scope.slots = NULL;
+			}
 			if( data->ref )
 				aFree(data->ref);
 			aFree(ri);
@@ -4287,6 +4414,163 @@ static void script_free_vars(struct DBMap *var_storage)
 	}
 }
 
+static int script_var_slots_cmp(const void *a, const void *b)
+{
+	int id_a = *(const int *)a, id_b = *(const int *)b;
+	return (id_a > id_b) - (id_a < id_b);
+}
+
+/**
+ * Numbers the variables of a scope referred to by the script just parsed
+ * (script->parse_var_ids), so that their values get a slot in their reg_db.
+ * Variables only named at run time (getd/setd) have no slot.
+ *
+ * @param slots The script code's slots to build.
+ * @param scope SCRIPT_VAR_SCOPE or SCRIPT_VAR_NPC.
+ */
+static void script_var_slots_build(struct script_var_slots *slots, enum script_var_scope scope)
+{
+	int i, count = 0, size = 4;
+
+	nullpo_retv(slots);
+	memset(slots, 0, sizeof(*slots));
+	if (VECTOR_LENGTH(script->parse_var_ids) == 0)
+		return;
+
+	CREATE(slots->ids, int, VECTOR_LENGTH(script->parse_var_ids));
+	for (i = 0; i < VECTOR_LENGTH(script->parse_var_ids); i++) {
+		int id = VECTOR_INDEX(script->parse_var_ids, i);
+		// labels and functions were resolved by the end of the parse
+		if (script->str_data[id].type == C_NAME && script->str_data[id].var_scope == scope)
+			slots->ids[count++] = id;
+	}
+	if (count == 0) {
+		aFree(slots->ids);
+		slots->ids = NULL;
+		return;
+	}
+	qsort(slots->ids, count, sizeof(int), script_var_slots_cmp);
+	for (i = 1; i < count; i++) {
+		if (slots->ids[i] != slots->ids[slots->count])
+			slots->ids[++slots->count] = slots->ids[i];
+	}
+	slots->count++;
+	RECREATE(slots->ids, int, slots->count);
+
+	while (size < 2 * slots->count)
+		size *= 2;
+	slots->mask = size - 1;
+	CREATE(slots->hash, int, size);
+	for (i = 0; i < slots->count; i++) {
+		int h = slots->ids[i] & slots->mask;
+		while (slots->hash[h] != 0)
+			h = (h + 1) & slots->mask;
+		slots->hash[h] = i + 1;
+	}
+}
+
+/// Copies the variable slots of a script code to its clone.
+static void script_var_slots_copy(struct script_var_slots *dst, const struct script_var_slots *src)
+{
+	nullpo_retv(dst);
+	nullpo_retv(src);
+
+	*dst = *src;
+	if (src->count == 0)
+		return;
+	CREATE(dst->ids, int, src->count);
+	memcpy(dst->ids, src->ids, src->count * sizeof(int));
+	CREATE(dst->hash, int, src->mask + 1);
+	memcpy(dst->hash, src->hash, (src->mask + 1) * sizeof(int));
+}
+
+static void script_var_slots_clear(struct script_var_slots *slots)
+{
+	nullpo_retv(slots);
+
+	aFree(slots->ids);
+	aFree(slots->hash);
+	memset(slots, 0, sizeof(*slots));
+}
+
+/**
+ * Allocates the slot values of a frame or of the npc variables of a script.
+ *
+ * @param vars The script code's variable slots.
+ * @return The zeroed values, NULL if the code has no variable with a slot.
+ */
+static struct script_reg_slots *script_reg_slots_alloc(const struct script_var_slots *vars)
+{
+	struct script_reg_slots *slots;
+
+	nullpo_retr(NULL, vars);
+	if (vars->count == 0)
+		return NULL;
+	slots = aCalloc(1, sizeof(*slots) + vars->count * sizeof(slots->value[0]));
+	slots->vars = vars;
+	return slots;
+}
+
+static void script_reg_slots_free(struct script_reg_slots *slots)
+{
+	int i;
+
+	if (slots == NULL)
+		return;
+	for (i = 0; i < slots->vars->count; i++) {
+		if (script->str_data[slots->vars->ids[i]].var_string)
+			aFree(slots->value[i].str);
+	}
+	aFree(slots);
+}
+
+/**
+ * Finds the slot of a variable in a reg_db.
+ *
+ * @param n   The variables.
+ * @param uid The variable (id and index).
+ * @return The variable's value, NULL if it is stored in n->vars (array
+ *         element, or name without a slot in the script code).
+ */
+static union script_reg_value *script_reg_slot(struct reg_db *n, int64 uid)
+{
+	const struct script_var_slots *vars;
+	int id, h;
+
+	if (n == NULL || n->slots == NULL || script_getvaridx(uid) != 0)
+		return NULL;
+
+	vars = n->slots->vars;
+	id = script_getvarid(uid);
+	for (h = id & vars->mask; vars->hash[h] != 0; h = (h + 1) & vars->mask) {
+		if (vars->ids[vars->hash[h] - 1] == id)
+			return &n->slots->value[vars->hash[h] - 1];
+	}
+	return NULL;
+}
+
+/**
+ * Resets all the variables of a reg_db to 0 / "".
+ *
+ * @param n The variables.
+ */
+static void script_reg_db_clear(struct reg_db *n)
+{
+	nullpo_retv(n);
+
+	if (n->vars != NULL)
+		db_clear(n->vars);
+	if (n->arrays != NULL)
+		n->arrays->clear(n->arrays, script->array_free_db);
+	if (n->slots != NULL) {
+		for (int i = 0; i < n->slots->vars->count; i++) {
+			if (script->str_data[n->slots->vars->ids[i]].var_string)
+				aFree(n->slots->value[i].str);
+		}
+		memset(n->slots->value, 0, n->slots->vars->count * sizeof(n->slots->value[0]));
+	}
+}
+
 static void script_free_code(struct script_code *code)
 {
 	nullpo_retv(code);
@@ -4296,6 +4580,9 @@ static void script_free_code(struct script_code *code)
 	script->free_vars(code->local.vars);
 	if (code->local.arrays)
 		code->local.arrays->destroy(code->local.arrays,script->array_free_db);
+	script->reg_slots_free(code->local.slots);
+	script->var_slots_clear(&code->scope_slots);
+	script->var_slots_clear(&code->npc_slots);
 	VECTOR_CLEAR(code->script_buf);
 	aFree(code);
 }
@@ -4321,6 +4608,7 @@ static struct script_state *script_alloc_state(struct script_code *rootscript, i
 	st->stack->defsp = st->stack->sp;
 	st->stack->scope.vars = i64db_alloc(DB_OPT_RELEASE_DATA);
 	st->stack->scope.arrays = NULL;
+	st->stack->scope.slots = script->reg_slots_alloc(&rootscript->scope_slots);
 	st->state = RUN;
 	st->script = rootscript;
 	st->pos = pos;
@@ -4375,6 +4663,7 @@ static void script_free_state(struct script_state *st)
 			script->free_vars(st->stack->scope.vars);
 			if( st->stack->scope.arrays )
 				st->stack->scope.arrays->destroy(st->stack->scope.arrays,script->array_free_db);
+			script->reg_slots_free(st->stack->scope.slots);
 			script->pop_stack(st, 0, st->stack->sp);
 			aFree(st->stack->stack_data);
 			ers_free(script->stack_ers, st->stack);
@@ -4964,6 +5253,7 @@ static int run_func(struct script_state *st)
 		}
 		script->free_vars(st->stack->scope.vars);
 		st->stack->scope.arrays->destroy(st->stack->scope.arrays,script->array_free_db);
+		script->reg_slots_free(st->stack->scope.slots);
 
 		ri = st->stack->stack_data[st->stack->defsp-1].u.ri;
 		nargs = ri->nargs;
@@ -4971,6 +5261,7 @@ static int run_func(struct script_state *st)
 		st->script = ri->script;
 		st->stack->scope.vars = ri->scope.vars;
 		st->stack->scope.arrays = ri->scope.arrays;
+		st->stack->scope.slots = ri->scope.slots;
 		st->stack->defsp = ri->defsp;
 		memset(ri, 0, sizeof(struct script_retinfo));
 
@@ -6154,6 +6445,7 @@ static int script_translation_db_destroyer(union DBKey key, struct DBData *data,
 static void script_parser_clean_leftovers(void)
 {
 	VECTOR_CLEAR(script->buf);
+	VECTOR_CLEAR(script->parse_var_ids);
 
 	if( script->translation_db ) {
 		script->translation_db->destroy(script->translation_db,script->translation_db_destroyer);
@@ -7105,10 +7397,12 @@ static BUILDIN(callfunc)
 	if (!st->stack->scope.arrays)
 		st->stack->scope.arrays = idb_alloc(DB_OPT_BASE); // TODO: Can this happen? when?
 	ref[0].arrays = st->stack->scope.arrays;
+	ref[0].slots = st->stack->scope.slots;
 	ref[1].vars = st->script->local.vars;
 	if (!st->script->local.arrays)
 		st->script->local.arrays = idb_alloc(DB_OPT_BASE); // TODO: Can this happen? when?
 	ref[1].arrays = st->script->local.arrays;
+	ref[1].slots = st->script->local.slots;
 
 	for( i = st->start+3, j = 0; i < st->end; i++, j++ ) {
 		struct script_data* data = script->push_copy(st->stack,i);
@@ -7124,6 +7418,7 @@ static BUILDIN(callfunc)
 	ri->script       = st->script;              // script code
 	ri->scope.vars   = st->stack->scope.vars;   // scope variables
 	ri->scope.arrays = st->stack->scope.arrays; // scope arrays
+	ri->scope.slots  = st->stack->scope.slots;  // scope variable slots
 	ri->pos          = st->pos;                 // script location
 	ri->nargs        = j;                       // argument count
 	ri->defsp        = st->stack->defsp;        // default stack pointer
@@ -7135,6 +7430,7 @@ static BUILDIN(callfunc)
 	st->state = GOTO;
 	st->stack->scope.vars = i64db_alloc(DB_OPT_RELEASE_DATA);
 	st->stack->scope.arrays = idb_alloc(DB_OPT_BASE);
+	st->stack->scope.slots = script->reg_slots_alloc(&st->script->scope_slots);
 
 	if( !st->script->local.vars )
 		st->script->local.vars = i64db_alloc(DB_OPT_RELEASE_DATA);
@@ -7199,9 +7495,11 @@ static BUILDIN(callfunctionofnpc) {
 	// scope variables (.@var)
 	ref[0].vars = st->stack->scope.vars;
 	ref[0].arrays = st->stack->scope.arrays;
+	ref[0].slots = st->stack->scope.slots;
 	// npc variables (.var)
 	ref[1].vars = st->script->local.vars;
 	ref[1].arrays = st->script->local.arrays;
+	ref[1].slots = st->script->local.slots;
 
 	int i = 0;
 
@@ -7225,6 +7523,7 @@ static BUILDIN(callfunctionofnpc) {
 	ri->script       = st->script;              // script code
 	ri->scope.vars   = st->stack->scope.vars;   // scope variables
 	ri->scope.arrays = st->stack->scope.arrays; // scope arrays
+	ri->scope.slots  = st->stack->scope.slots;  // scope variable slots
 	ri->pos          = st->pos;                 // script location
 	ri->nargs        = i - st->start - 4;       // argument count
 	ri->defsp        = st->stack->defsp;        // default stack pointer
@@ -7237,6 +7536,7 @@ static BUILDIN(callfunctionofnpc) {
 	st->state = GOTO;
 	st->stack->scope.vars = i64db_alloc(DB_OPT_RELEASE_DATA);
 	st->stack->scope.arrays = idb_alloc(DB_OPT_BASE);
+	st->stack->scope.slots = script->reg_slots_alloc(&st->script->scope_slots);
 
 	// make sure local reg_db of the other NPC is initialized
 	if (st->script->local.vars == NULL) {
@@ -7269,6 +7569,7 @@ static BUILDIN(callsub)
 	if (!st->stack->scope.arrays)
 		st->stack->scope.arrays = idb_alloc(DB_OPT_BASE); // TODO: Can this happen? when?
 	ref[0].arrays = st->stack->scope.arrays;
+	ref[0].slots = st->stack->scope.slots;
 
 	for( i = st->start+3, j = 0; i < st->end; i++, j++ ) {
 		struct script_data* data = script->push_copy(st->stack,i);
@@ -7284,6 +7585,7 @@ static BUILDIN(callsub)
 	ri->script       = st->script;              // script code
 	ri->scope.vars   = st->stack->scope.vars;   // scope variables
 	ri->scope.arrays = st->stack->scope.arrays; // scope arrays
+	ri->scope.slots  = st->stack->scope.slots;  // scope variable slots
 	ri->pos          = st->pos;                 // script location
 	ri->nargs        = j;                       // argument count
 	ri->defsp        = st->stack->defsp;        // default stack pointer
@@ -7294,6 +7596,7 @@ static BUILDIN(callsub)
 	st->state = GOTO;
 	st->stack->scope.vars = i64db_alloc(DB_OPT_RELEASE_DATA);
 	st->stack->scope.arrays = idb_alloc(DB_OPT_BASE);
+	st->stack->scope.slots = script->reg_slots_alloc(&st->script->scope_slots);
 
 	return true;
 }
@@ -7368,6 +7671,7 @@ static BUILDIN(return)
 					if( !st->script->local.arrays )
 						st->script->local.arrays = idb_alloc(DB_OPT_BASE);
 					data->ref->arrays = st->script->local.arrays;
+					data->ref->slots = st->script->local.slots;
 				} else if( data->ref->vars == st->stack->stack_data[st->stack->defsp-1].u.ri->script->local.vars ) {
 					data->ref = NULL; // Reference to the parent scope's script, remove reference pointer.
 				}
@@ -7859,13 +8163,13 @@ static BUILDIN(percentheal)
 	if (sd == NULL)
 		return true;
 #ifdef RENEWAL
-	if( sd->sc.data[SC_EXTREMITYFIST2] )
+	if( SC_ENTRY(&sd->sc, SC_EXTREMITYFIST2) )
 		sp = 0;
 #endif
-	if (sd->sc.data[SC_BITESCAR]) {
+	if (SC_ENTRY(&sd->sc, SC_BITESCAR)) {
 		hp = 0;
 	}
-	if (sd->sc.data[SC_NO_RECOVER_STATE]) {
+	if (SC_ENTRY(&sd->sc, SC_NO_RECOVER_STATE)) {
 		hp = 0;
 		sp = 0;
 	}
@@ -7979,7 +8283,6 @@ static BUILDIN(__setr)
 	//struct script_data* datavalue;
 	int64 num;
 	const char* name;
-	char prefix;
 	struct reg_db *ref;
 
 	data = script_getdata(st,2);
@@ -7994,9 +8297,8 @@ static BUILDIN(__setr)
 	num = reference_getuid(data);
 	name = reference_getname(data);
 	ref = reference_getref(data);
-	prefix = *name;
 
-	if (not_server_variable(prefix)) {
+	if (not_server_scope(reference_getscope(data))) {
 		if (ref == NULL && (sd = script->rid2sd(st)) == NULL) {
 			ShowError("script:set: no player attached for player variable '%s'\n", name);
 			return true;
@@ -8034,7 +8336,7 @@ static BUILDIN(__setr)
 
 	if (script_hasdata(st, 4)) {
 		// Optional argument used by post-increment/post-decrement constructs to return the previous value
-		if (is_string_variable(name)) {
+		if (reference_isstring(data)) {
 			script_pushstrcopy(st, script_getstr(st, 4));
 		} else {
 			script_pushint(st, script_getnum(st, 4));
@@ -8044,7 +8346,7 @@ static BUILDIN(__setr)
 		script_pushcopy(st,2);
 	}
 
-	if (is_string_variable(name))
+	if (reference_isstring(data))
 		script->set_reg(st, sd, num, name, script_getstr(st, 3), ref);
 	else
 		script->set_reg(st, sd, num, name, (const void *)h64BPTRSIZE(script_getnum(st, 3)), ref);
@@ -8538,10 +8840,8 @@ static BUILDIN(countitem)
 
 	int nameid = id->nameid;
 
-	for (int i = 0; i < sd->status.inventorySize; i++) {
-		if (sd->status.inventory[i].nameid == nameid)
-			count += sd->status.inventory[i].amount;
-	}
+	for (int i = pc->inventory_index_first(sd, nameid); i != INDEX_NOT_FOUND && i < sd->status.inventorySize; i = pc->inventory_index_next(sd, i))
+		count += sd->status.inventory[i].amount;
 
 	script_pushint(st,count);
 	return true;
@@ -8584,9 +8884,9 @@ static BUILDIN(countitem2)
 	c3 = script_getnum(st,8);
 	c4 = script_getnum(st,9);
 
-	for (int i = 0; i < sd->status.inventorySize; i++)
+	for (int i = pc->inventory_index_first(sd, nameid); i != INDEX_NOT_FOUND && i < sd->status.inventorySize; i = pc->inventory_index_next(sd, i))
 		if (sd->status.inventory[i].nameid > 0 && sd->inventory_data[i] != NULL &&
-			sd->status.inventory[i].amount > 0 && sd->status.inventory[i].nameid == nameid &&
+			sd->status.inventory[i].amount > 0 &&
 			sd->status.inventory[i].identify == iden && sd->status.inventory[i].refine == ref &&
 			sd->status.inventory[i].attribute == attr && sd->status.inventory[i].card[0] == c1 &&
 			sd->status.inventory[i].card[1] == c2 && sd->status.inventory[i].card[2] == c3 &&
@@ -9461,7 +9761,7 @@ static void buildin_delitem_delete(struct map_session_data *sd, int idx, int *am
 static bool buildin_delitem_search(struct map_session_data *sd, struct item *it, bool exact_match)
 {
 	bool delete_items = false;
-	int i, amount;
+	int i, next, amount;
 	struct item* inv;
 
 	nullpo_retr(false, sd);
@@ -9482,7 +9782,9 @@ static bool buildin_delitem_search(struct map_session_data *sd, struct item *it,
 		amount = it->amount;
 
 		// 1st pass -- less important items / exact match
-		for (i = 0; amount && i < ARRAYLENGTH(sd->status.inventory); i++) {
+		// (the next slot is fetched in advance, as deleting the item unlinks the current one)
+		for (i = pc->inventory_index_first(sd, it->nameid); amount && i != INDEX_NOT_FOUND; i = next) {
+			next = pc->inventory_index_next(sd, i);
 			inv = &sd->status.inventory[i];
 
 			if (!inv->nameid || !sd->inventory_data[i] || inv->nameid != it->nameid) {
@@ -9523,7 +9825,8 @@ static bool buildin_delitem_search(struct map_session_data *sd, struct item *it,
 			// either everything was already consumed or no items were skipped
 			;
 		} else {
-			for (i = 0; amount && i < ARRAYLENGTH(sd->status.inventory); i++) {
+			for (i = pc->inventory_index_first(sd, it->nameid); amount && i != INDEX_NOT_FOUND; i = next) {
+				next = pc->inventory_index_next(sd, i);
 				inv = &sd->status.inventory[i];
 
 				if (!inv->nameid || !sd->inventory_data[i] || inv->nameid != it->nameid) {
@@ -13899,7 +14202,7 @@ static BUILDIN(sc_end)
 
 	if (type >= 0 && type < SC_MAX) {
 		struct status_change *sc = status->get_sc(bl);
-		struct status_change_entry *sce = sc ? sc->data[type] : NULL;
+		struct status_change_entry *sce = sc ? SC_ENTRY(sc, type) : NULL;
 
 		if (!sce)
 			return true;
@@ -13971,22 +14274,22 @@ static BUILDIN(getstatus)
 		return true;
 	}
 
-	if( sd->sc.count == 0 || !sd->sc.data[id] )
+	if( sd->sc.count == 0 || !SC_ENTRY(&sd->sc, id) )
 	{// no status is active
 		script_pushint(st, 0);
 		return true;
 	}
 
 	switch( type ) {
-		case 1: script_pushint(st, sd->sc.data[id]->val1); break;
-		case 2: script_pushint(st, sd->sc.data[id]->val2); break;
-		case 3: script_pushint(st, sd->sc.data[id]->val3); break;
-		case 4: script_pushint(st, sd->sc.data[id]->val4); break;
+		case 1: script_pushint(st, SC_ENTRY(&sd->sc, id)->val1); break;
+		case 2: script_pushint(st, SC_ENTRY(&sd->sc, id)->val2); break;
+		case 3: script_pushint(st, SC_ENTRY(&sd->sc, id)->val3); break;
+		case 4: script_pushint(st, SC_ENTRY(&sd->sc, id)->val4); break;
 		case 5:
-			if (sd->sc.data[id]->infinite_duration) {
+			if (SC_ENTRY(&sd->sc, id)->infinite_duration) {
 				script_pushint(st, INFINITE_DURATION);
 			} else {
-				const struct TimerData *td = timer->get(sd->sc.data[id]->timer);
+				const struct TimerData *td = timer->get(SC_ENTRY(&sd->sc, id)->timer);
 
 				if (td != NULL) {
 					// return the amount of time remaining
@@ -25106,7 +25409,7 @@ static BUILDIN(hascashmount)
 	if (sd == NULL)
 		return true;
 
-	if (sd->sc.data[SC_ALL_RIDING]) {
+	if (SC_ENTRY(&sd->sc, SC_ALL_RIDING)) {
 		script_pushint(st, 1);
 	} else {
 		script_pushint(st, 0);
@@ -25135,7 +25438,7 @@ static BUILDIN(setcashmount)
 #endif
 		script_pushint(st, 0); // Can't mount with one of these
 	} else {
-		if (sd->sc.data[SC_ALL_RIDING]) {
+		if (SC_ENTRY(&sd->sc, SC_ALL_RIDING)) {
 			status_change_end(&sd->bl, SC_ALL_RIDING, INVALID_TIMER);
 		} else {
 			sc_start(NULL, &sd->bl, SC_ALL_RIDING, 100, battle_config.boarding_halter_speed, INFINITE_DURATION, 0);
@@ -30845,6 +31148,7 @@ void script_defaults(void)
 	script->labels_size = 0;
 
 	VECTOR_INIT(script->buf);
+	VECTOR_INIT(script->parse_var_ids);
 	VECTOR_INIT(script->translation_buf);
 	VECTOR_INIT(script->conditional_features);
 
@@ -30931,6 +31235,13 @@ void script_defaults(void)
 	script->stop_instances = script_stop_instances;
 	script->free_code = script_free_code;
 	script->free_vars = script_free_vars;
+	script->var_slots_build = script_var_slots_build;
+	script->var_slots_copy = script_var_slots_copy;
+	script->var_slots_clear = script_var_slots_clear;
+	script->reg_slots_alloc = script_reg_slots_alloc;
+	script->reg_slots_free = script_reg_slots_free;
+	script->reg_slot = script_reg_slot;
+	script->reg_db_clear = script_reg_db_clear;
 	script->alloc_state = script_alloc_state;
 	script->free_state = script_free_state;
 	script->add_pending_ref = script_add_pending_ref;
@@ -30940,6 +31251,7 @@ void script_defaults(void)
 	script->config_read = script_config_read;
 	script->add_str = script_add_str;
 	script->add_variable = script_add_variable;
+	script->classify_variable = script_classify_variable;
 	script->get_str = script_get_str;
 	script->search_str = script_search_str;
 	script->setd_sub = setd_sub;
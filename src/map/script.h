@@ -161,6 +161,10 @@ struct item_data;
 #define reference_getconstant(data) ( script->str_data[reference_getid(data)].val )
 /// Returns the type of param
 #define reference_getparamtype(data) ( script->str_data[reference_getid(data)].val )
+/// Returns if this is a reference to a string variable
+#define reference_isstring(data) ( script->str_data[reference_getid(data)].var_string != 0 )
+/// Returns the storage of the referenced variable (enum script_var_scope)
+#define reference_getscope(data) ( (enum script_var_scope)script->str_data[reference_getid(data)].var_scope )
 
 /// Composes the uid of a reference from the id and the index
 #define reference_uid(id,idx) ( (int64) ((uint64)(id) & 0xFFFFFFFF) | ((uint64)(idx) << 32) )
@@ -176,6 +180,7 @@ struct item_data;
 #define script_getvaridx(var) ( (uint32)(int64)((var >> 32) & 0xFFFFFFFF) )
 
 #define not_server_variable(prefix) ( (prefix) != '$' && (prefix) != '.' && (prefix) != '\'')
+#define not_server_scope(scope) ( (scope) != SCRIPT_VAR_SERVER && (scope) != SCRIPT_VAR_NPC && (scope) != SCRIPT_VAR_SCOPE && (scope) != SCRIPT_VAR_INSTANCE )
 #define is_int_variable(name) ( (name)[strlen(name) - 1] != '$' )
 #define is_string_variable(name) ( (name)[strlen(name) - 1] == '$' )
 
@@ -255,6 +260,22 @@ enum ScriptQueueOptions {
 
 enum e_script_state { RUN,STOP,END,RERUNLINE,GOTO,RETFUNC,CLOSE };
 
+/**
+ * Storage of a variable, resolved from the prefix of its name when the name
+ * is added to str_data, so that get_val/set_reg don't have to parse it.
+ */
+enum script_var_scope {
+	SCRIPT_VAR_NONE = 0,       ///< Not a valid variable name
+	SCRIPT_VAR_CHAR,           ///< Permanent character variable (no prefix)
+	SCRIPT_VAR_CHAR_TEMP,      ///< Temporary character variable ('@')
+	SCRIPT_VAR_SERVER,         ///< Map server variable ('$', '$@')
+	SCRIPT_VAR_ACCOUNT,        ///< Permanent local account variable ('#')
+	SCRIPT_VAR_ACCOUNT_GLOBAL, ///< Permanent global account variable ('##')
+	SCRIPT_VAR_NPC,            ///< NPC variable ('.')
+	SCRIPT_VAR_SCOPE,          ///< Scope variable ('.@')
+	SCRIPT_VAR_INSTANCE,       ///< Instance variable ('\'')
+};
+
 enum script_parse_options {
 	SCRIPT_USE_LABEL_DB = 0x1,// records labels in scriptlabel_db
 	SCRIPT_IGNORE_EXTERNAL_BRACKETS = 0x2,// ignores the check for {} brackets around the script
@@ -660,12 +681,38 @@ struct Script_Config {
 	const char* onuntouch_name;
 };
 
+/**
+ * Scope (.@) or npc (.) variables named in a script code, numbered by the
+ * parser (see script->var_slots_build). The value of these variables, other
+ * than their array elements, is kept in the slots of their reg_db instead of
+ * its vars DB.
+ */
+struct script_var_slots {
+	int count; ///< Number of slots
+	int mask;  ///< Size of hash - 1
+	int *ids;  ///< str_data id of the variable of each slot
+	int *hash; ///< Slot + 1 of the variables by (id & mask), 0 when empty (linear probing)
+};
+
+/// Value of a variable kept in a slot.
+union script_reg_value {
+	int num;   ///< Number variable
+	char *str; ///< String variable, NULL for ""
+};
+
+/// Slot values of a reg_db.
+struct script_reg_slots {
+	const struct script_var_slots *vars; ///< Variables of the slots (owned by the script code)
+	union script_reg_value value[];      ///< Values by slot
+};
+
 /**
  * Generic reg database abstraction to be used with various types of regs/script variables.
  */
 struct reg_db {
 	struct DBMap *vars;
 	struct DBMap *arrays;
+	struct script_reg_slots *slots; ///< Values of the variables with a slot, NULL if none (see script->reg_slot)
 };
 
 struct script_retinfo {
@@ -706,6 +753,8 @@ struct script_code {
 	struct script_buf script_buf;
 	struct reg_db local; ///< Local (npc) vars
 	unsigned short instances;
+	struct script_var_slots scope_slots; ///< Scope variables with a slot in every frame of this code
+	struct script_var_slots npc_slots;   ///< Npc variables with a slot in local
 };
 
 struct script_stack {
@@ -781,6 +830,9 @@ struct str_data_struct {
 	int val;
 	int next;
 	uint8 deprecated : 1;
+	uint8 var_string : 1;  ///< Name ends with '$'
+	uint8 var_toolong : 1; ///< Name is longer than SCRIPT_VARNAME_LENGTH
+	uint8 var_scope : 4;   ///< enum script_var_scope
 };
 
 /** a label within a script (does not use the label db) */
@@ -889,6 +941,9 @@ struct script_interface {
 	/// temporary buffer for passing around compiled bytecode
 	/// @see add_scriptb, set_label, parse_script
 	struct script_buf buf;
+	/// str_data ids of the scope and npc variables referred to by the compiled bytecode
+	/// @see add_scriptl, script_var_slots_build
+	VECTOR_DECL(int) parse_var_ids;
 	/* */
 	struct script_syntax_data syntax;
 	/* */
@@ -1008,6 +1063,13 @@ struct script_interface {
 	void (*stop_instances) (struct script_code *code);
 	void (*free_code) (struct script_code* code);
 	void (*free_vars) (struct DBMap *var_storage);
+	void (*var_slots_build) (struct script_var_slots *slots, enum script_var_scope scope);
+	void (*var_slots_copy) (struct script_var_slots *dst, const struct script_var_slots *src);
+	void (*var_slots_clear) (struct script_var_slots *slots);
+	struct script_reg_slots *(*reg_slots_alloc) (const struct script_var_slots *vars);
+	void (*reg_slots_free) (struct script_reg_slots *slots);
+	union script_reg_value *(*reg_slot) (struct reg_db *n, int64 uid);
+	void (*reg_db_clear) (struct reg_db *n);
 	struct script_state* (*alloc_state) (struct script_code* rootscript, int pos, int rid, int oid);
 	void (*free_state) (struct script_state* st);
 	void (*add_pending_ref) (struct script_state *st, struct reg_db *ref);
@@ -1017,6 +1079,7 @@ struct script_interface {
 	bool (*config_read) (const char *filename, bool imported);
 	int (*add_str) (const char* p);
 	int (*add_variable) (const char *varname);
+	void (*classify_variable) (int key);
 	const char* (*get_str) (int id);
 	int (*search_str) (const char* p);
 	void (*setd_sub) (struct script_state *st, struct map_session_data *sd, const char *varname, int elem, const void *value, struct reg_db *ref);
@@ -1205,27 +1205,27 @@ static int skill_calc_heal(struct block_list *src, struct block_list *target, ui
 		hp += hp*skill2_lv/100;
 
 	sc = status->get_sc(src);
-	if( sc && sc->count && sc->data[SC_OFFERTORIUM] ) {
+	if( sc && sc->count && SC_ENTRY(sc, SC_OFFERTORIUM) ) {
 		if( skill_id == AB_HIGHNESSHEAL || skill_id == AB_CHEAL || skill_id == PR_SANCTUARY || skill_id == AL_HEAL )
-			hp += hp * sc->data[SC_OFFERTORIUM]->val2 / 100;
+			hp += hp * SC_ENTRY(sc, SC_OFFERTORIUM)->val2 / 100;
 	}
 	sc = status->get_sc(target);
 	if (sc && sc->count) {
-		if(sc->data[SC_CRITICALWOUND] && heal) // Critical Wound has no effect on offensive heal. [Inkfish]
-			hp -= hp * sc->data[SC_CRITICALWOUND]->val2/100;
-		if(sc->data[SC_DEATHHURT] && heal)
+		if(SC_ENTRY(sc, SC_CRITICALWOUND) && heal) // Critical Wound has no effect on offensive heal. [Inkfish]
+			hp -= hp * SC_ENTRY(sc, SC_CRITICALWOUND)->val2/100;
+		if(SC_ENTRY(sc, SC_DEATHHURT) && heal)
 			hp -= hp * 20/100;
-		if(sc->data[SC_HEALPLUS] && skill_id != NPC_EVILLAND && skill_id != BA_APPLEIDUN)
-			hp += hp * sc->data[SC_HEALPLUS]->val1/100; // Only affects Heal, Sanctuary and PotionPitcher.(like bHealPower) [Inkfish]
-		if (sc->data[SC_VITALIZE_POTION] != NULL && skill_id != NPC_EVILLAND && skill_id != BA_APPLEIDUN)
-			hp += hp * sc->data[SC_VITALIZE_POTION]->val3 / 100;
-		if(sc->data[SC_WATER_INSIGNIA] && sc->data[SC_WATER_INSIGNIA]->val1 == 2)
+		if(SC_ENTRY(sc, SC_HEALPLUS) && skill_id != NPC_EVILLAND && skill_id != BA_APPLEIDUN)
+			hp += hp * SC_ENTRY(sc, SC_HEALPLUS)->val1/100; // Only affects Heal, Sanctuary and PotionPitcher.(like bHealPower) [Inkfish]
+		if (SC_ENTRY(sc, SC_VITALIZE_POTION) != NULL && skill_id != NPC_EVILLAND && skill_id != BA_APPLEIDUN)
+			hp += hp * SC_ENTRY(sc, SC_VITALIZE_POTION)->val3 / 100;
+		if(SC_ENTRY(sc, SC_WATER_INSIGNIA) && SC_ENTRY(sc, SC_WATER_INSIGNIA)->val1 == 2)
 			hp += hp / 10;
-		if (sc->data[SC_ASSUMPTIO_BUFF] != NULL)
-			hp += hp * 2 * sc->data[SC_ASSUMPTIO_BUFF]->val1 / 100;
-		if (sc->data[SC_VITALITYACTIVATION])
+		if (SC_ENTRY(sc, SC_ASSUMPTIO_BUFF) != NULL)
+			hp += hp * 2 * SC_ENTRY(sc, SC_ASSUMPTIO_BUFF)->val1 / 100;
+		if (SC_ENTRY(sc, SC_VITALITYACTIVATION))
 			hp = hp * 150 / 100;
-		if (sc->data[SC_NO_RECOVER_STATE])
+		if (SC_ENTRY(sc, SC_NO_RECOVER_STATE))
 			hp = 0;
 	}
 
@@ -1242,8 +1242,8 @@ static int skill_calc_heal(struct block_list *src, struct block_list *target, ui
 	}
 
 	// In-game tests suggests that this effect applies AFTER the MATK bonus is calculated
-	if (sc->data[SC_APPLEIDUN] != NULL)
-		hp += hp * sc->data[SC_APPLEIDUN]->val3 / 100;
+	if (SC_ENTRY(sc, SC_APPLEIDUN) != NULL)
+		hp += hp * SC_ENTRY(sc, SC_APPLEIDUN)->val3 / 100;
 #endif // RENEWAL
 	return hp;
 }
@@ -1272,11 +1272,11 @@ static int can_copy(struct map_session_data *sd, uint16 skill_id)
 		return 0;
 
 	// Checks if preserve is active and if skill can be copied by Plagiarism
-	if (!sd->sc.data[SC_PRESERVE] && (skill->get_inf2(skill_id) & INF2_ALLOW_PLAGIARIZE))
+	if (!SC_ENTRY(&sd->sc, SC_PRESERVE) && (skill->get_inf2(skill_id) & INF2_ALLOW_PLAGIARIZE))
 		return 1;
 
 	/// Reproduce will only copy skills according on the list. [Jobbie]
-	if (sd->sc.data[SC__REPRODUCE] && sd->sc.data[SC__REPRODUCE]->val1 && (skill->get_inf2(skill_id) & INF2_ALLOW_REPRODUCE))
+	if (SC_ENTRY(&sd->sc, SC__REPRODUCE) && SC_ENTRY(&sd->sc, SC__REPRODUCE)->val1 && (skill->get_inf2(skill_id) & INF2_ALLOW_REPRODUCE))
 		return 2;
 
 	return 0;
@@ -1327,7 +1327,7 @@ static int skillnotok(uint16 skill_id, struct map_session_data *sd)
 	if (sd->auto_cast_current.type == AUTOCAST_ITEM)
 		return 0;
 
-	if( sd->sc.data[SC_ALL_RIDING] )
+	if( SC_ENTRY(&sd->sc, SC_ALL_RIDING) )
 		return 1;//You can't use skills while in the new mounts (The client doesn't let you, this is to make cheat-safe)
 
 	switch (skill_id) {
@@ -1434,11 +1434,11 @@ static int skillnotok_hom(uint16 skill_id, struct homun_data *hd)
 			}
 			break;
 	    case MH_GOLDENE_FERSE: //can be used with angriff
-			if(hd->sc.data[SC_ANGRIFFS_MODUS])
+			if(SC_ENTRY(&hd->sc, SC_ANGRIFFS_MODUS))
 				return 1;
 			/* Fall through */
 	    case MH_ANGRIFFS_MODUS:
-			if(hd->sc.data[SC_GOLDENE_FERSE])
+			if(SC_ENTRY(&hd->sc, SC_GOLDENE_FERSE))
 				return 1;
 			break;
 	    default:
@@ -1656,44 +1656,44 @@ static int skill_additional_effect(struct block_list *src, struct block_list *bl
 						clif->skill_fail(sd, RG_SNATCHER, USESKILL_FAIL_LEVEL, 0, 0);
 				}
 				// Chance to trigger Taekwon kicks [Dralnu]
-				if(sc && !sc->data[SC_COMBOATTACK]) {
-					if(sc->data[SC_STORMKICK_READY] &&
+				if(sc && !SC_ENTRY(sc, SC_COMBOATTACK)) {
+					if(SC_ENTRY(sc, SC_STORMKICK_READY) &&
 						sc_start4(src,src,SC_COMBOATTACK, 15, TK_STORMKICK,
 							bl->id, 2, 0,
 							(2000 - 4 * sstatus->agi - 2 * sstatus->dex), TK_STORMKICK))
 						; //Stance triggered
-					else if(sc->data[SC_DOWNKICK_READY] &&
+					else if(SC_ENTRY(sc, SC_DOWNKICK_READY) &&
 						sc_start4(src,src,SC_COMBOATTACK, 15, TK_DOWNKICK,
 							bl->id, 2, 0,
 							(2000 - 4 * sstatus->agi - 2 * sstatus->dex), TK_DOWNKICK))
 						; //Stance triggered
-					else if(sc->data[SC_TURNKICK_READY] &&
+					else if(SC_ENTRY(sc, SC_TURNKICK_READY) &&
 						sc_start4(src,src,SC_COMBOATTACK, 15, TK_TURNKICK,
 							bl->id, 2, 0,
 							(2000 - 4 * sstatus->agi - 2 * sstatus->dex), TK_TURNKICK))
 						; //Stance triggered
-						else if (sc->data[SC_COUNTERKICK_READY]) { //additional chance from SG_FRIEND [Komurka]
+						else if (SC_ENTRY(sc, SC_COUNTERKICK_READY)) { //additional chance from SG_FRIEND [Komurka]
 						rate = 20;
-						if (sc->data[SC_SKILLRATE_UP] && sc->data[SC_SKILLRATE_UP]->val1 == TK_COUNTER) {
-							rate += rate*sc->data[SC_SKILLRATE_UP]->val2/100;
+						if (SC_ENTRY(sc, SC_SKILLRATE_UP) && SC_ENTRY(sc, SC_SKILLRATE_UP)->val1 == TK_COUNTER) {
+							rate += rate*SC_ENTRY(sc, SC_SKILLRATE_UP)->val2/100;
 							status_change_end(src, SC_SKILLRATE_UP, INVALID_TIMER);
 						}
 						sc_start2(src, src, SC_COMBOATTACK, rate, TK_COUNTER, bl->id,
 							(2000 - 4 * sstatus->agi - 2 * sstatus->dex), TK_COUNTER);
 					}
 				}
-				if(sc && sc->data[SC_PYROCLASTIC] && (rnd() % 1000 <= sstatus->luk * 10 / 3 + 1) )
-					skill->castend_pos2(src, bl->x, bl->y, BS_HAMMERFALL,sc->data[SC_PYROCLASTIC]->val1, tick, 0);
+				if(sc && SC_ENTRY(sc, SC_PYROCLASTIC) && (rnd() % 1000 <= sstatus->luk * 10 / 3 + 1) )
+					skill->castend_pos2(src, bl->x, bl->y, BS_HAMMERFALL,SC_ENTRY(sc, SC_PYROCLASTIC)->val1, tick, 0);
 			}
 
 			if (sc) {
 				struct status_change_entry *sce;
 				// Enchant Poison gives a chance to poison attacked enemies
-				if((sce=sc->data[SC_ENCHANTPOISON])) //Don't use sc_start since chance comes in 1/10000 rate.
+				if((sce=SC_ENTRY(sc, SC_ENCHANTPOISON))) //Don't use sc_start since chance comes in 1/10000 rate.
 					status->change_start(src,bl,SC_POISON,sce->val2, sce->val1,src->id,0,0,
 						skill->get_time2(AS_ENCHANTPOISON, sce->val1), SCFLAG_NONE, skill_id);
 				// Enchant Deadly Poison gives a chance to deadly poison attacked enemies
-				if((sce=sc->data[SC_EDP]))
+				if((sce=SC_ENTRY(sc, SC_EDP)))
 					sc_start4(src,bl,SC_DPOISON,sce->val2, sce->val1,src->id,0,0,
 						skill->get_time2(ASC_EDP, sce->val1), skill_id);
 			}
@@ -1948,7 +1948,7 @@ static int skill_additional_effect(struct block_list *src, struct block_list *bl
 			break;
 
 		case PF_FOGWALL:
-			if (src != bl && !tsc->data[SC_DELUGE])
+			if (src != bl && !SC_ENTRY(tsc, SC_DELUGE))
 				sc_start(src, bl, SC_BLIND, 100, skill_lv, skill->get_time2(skill_id, skill_lv), skill_id);
 			break;
 
@@ -1996,7 +1996,7 @@ static int skill_additional_effect(struct block_list *src, struct block_list *bl
 			break;
 
 		case TK_JUMPKICK:
-			if (dstsd != NULL && (dstsd->job & MAPID_UPPERMASK) != MAPID_SOUL_LINKER && tsc->data[SC_PRESERVE] == NULL) {
+			if (dstsd != NULL && (dstsd->job & MAPID_UPPERMASK) != MAPID_SOUL_LINKER && SC_ENTRY(tsc, SC_PRESERVE) == NULL) {
 				// debuff the following statuses
 				status_change_end(bl, SC_SOULLINK, INVALID_TIMER);
 				status_change_end(bl, SC_ADRENALINE2, INVALID_TIMER);
@@ -2057,7 +2057,7 @@ static int skill_additional_effect(struct block_list *src, struct block_list *bl
 			sc_start4(src, bl, SC_FROSTMISTY, 15, skill_lv, 1000, src->id, 0, skill->get_time(skill_id, skill_lv), skill_id);
 			break;
 		case AB_ADORAMUS:
-			if( tsc && !tsc->data[SC_DEC_AGI] ) //Prevent duplicate agi-down effect.
+			if( tsc && !SC_ENTRY(tsc, SC_DEC_AGI) ) //Prevent duplicate agi-down effect.
 				sc_start(src, bl, SC_ADORAMUS, skill_lv * 4 + (sd ? sd->status.job_level : 50) / 2, skill_lv, skill->get_time(skill_id, skill_lv), skill_id);
 			break;
 		case WL_CRIMSONROCK:
@@ -2126,7 +2126,7 @@ static int skill_additional_effect(struct block_list *src, struct block_list *bl
 			break;
 		case NC_COLDSLOWER:
 			sc_start(src, bl, SC_FREEZE, 10 * skill_lv, skill_lv, skill->get_time(skill_id, skill_lv), skill_id);
-			if ( tsc && !tsc->data[SC_FREEZE] )
+			if ( tsc && !SC_ENTRY(tsc, SC_FREEZE) )
 				sc_start(src, bl, SC_FROSTMISTY, 20 + 10 * skill_lv, skill_lv, skill->get_time2(skill_id, skill_lv), skill_id);
 			break;
 		case NC_POWERSWING:
@@ -2150,10 +2150,10 @@ static int skill_additional_effect(struct block_list *src, struct block_list *bl
 			sc_start(src, bl, SC_STUN, rate, skill_lv, skill->get_time(skill_id, skill_lv), skill_id);
 			break;
 		case LG_HESPERUSLIT:
-			if ( sc && sc->data[SC_BANDING] ) {
-				if ( sc->data[SC_BANDING]->val2 == 4 ) // 4 banding RGs: Targets will be stunned at 100% chance for 4 ~ 8 seconds, irreducible by STAT.
+			if ( sc && SC_ENTRY(sc, SC_BANDING) ) {
+				if ( SC_ENTRY(sc, SC_BANDING)->val2 == 4 ) // 4 banding RGs: Targets will be stunned at 100% chance for 4 ~ 8 seconds, irreducible by STAT.
 					status->change_start(src, bl, SC_STUN, 10000, skill_lv, 0, 0, 0, 1000 * (4 + rnd() % 4), SCFLAG_FIXEDTICK, skill_id);
-				else if ( sc->data[SC_BANDING]->val2 == 6 ) // 6 banding RGs: activate Pinpoint Attack Lv1-5
+				else if ( SC_ENTRY(sc, SC_BANDING)->val2 == 6 ) // 6 banding RGs: activate Pinpoint Attack Lv1-5
 					skill->castend_damage_id(src,bl,LG_PINPOINTATTACK,1+rnd()%5,tick,0);
 			}
 			break;
@@ -2218,8 +2218,8 @@ static int skill_additional_effect(struct block_list *src, struct block_list *bl
 			break;
 		case SO_DIAMONDDUST:
 			rate = 5 + 5 * skill_lv;
-			if( sc && sc->data[SC_COOLER_OPTION] )
-				rate += sc->data[SC_COOLER_OPTION]->val3 / 5;
+			if( sc && SC_ENTRY(sc, SC_COOLER_OPTION) )
+				rate += SC_ENTRY(sc, SC_COOLER_OPTION)->val3 / 5;
 			sc_start(src, bl, SC_COLD, rate, skill_lv, skill->get_time2(skill_id, skill_lv), skill_id);
 			break;
 		case SO_VARETYR_SPEAR:
@@ -2277,7 +2277,7 @@ static int skill_additional_effect(struct block_list *src, struct block_list *bl
 			sc_start(src, bl, SC_STUN, 10 * skill_lv, skill_lv, 1000 * (skill_lv / 2 + 2), skill_id);
 			break;
 		case MH_LAVA_SLIDE:
-			if (tsc && !tsc->data[SC_BURNING])
+			if (tsc && !SC_ENTRY(tsc, SC_BURNING))
 				sc_start4(src, bl, SC_BURNING, 10 * skill_lv, skill_lv, 0, src->id, 0, skill->get_time(skill_id, skill_lv), skill_id);
 			break;
 		case MH_STAHL_HORN:
@@ -2322,7 +2322,7 @@ static int skill_additional_effect(struct block_list *src, struct block_list *bl
 			{
 				int i;
 				if ((dstsd != NULL && (dstsd->job & MAPID_UPPERMASK) == MAPID_SOUL_LINKER)
-					|| (tsc && tsc->data[SC_SOULLINK] && tsc->data[SC_SOULLINK]->val2 == SL_ROGUE)
+					|| (tsc && SC_ENTRY(tsc, SC_SOULLINK) && SC_ENTRY(tsc, SC_SOULLINK)->val2 == SL_ROGUE)
 					|| (dstsd && pc_ismadogear(dstsd))
 					|| rnd() % 100 >= 50 + 10 * skill_lv)
 				{
@@ -2332,9 +2332,7 @@ static int skill_additional_effect(struct block_list *src, struct block_list *bl
 				}
 				if (status->isimmune(bl) || !tsc || !tsc->count)
 					break;
-				for (i = 0; i < SC_MAX; i++) {
-					if (!tsc->data[i])
-						continue;
+				STATUS_CHANGE_ITER(tsc, i) {
 					if (SC_COMMON_MAX < i) {
 						if (status->get_sc_type(i) & SC_BB_NO_RESET)
 							continue;
@@ -2348,7 +2346,7 @@ static int skill_additional_effect(struct block_list *src, struct block_list *bl
 					case SC_DONTFORGETME:
 					case SC_FORTUNE:
 					case SC_SERVICEFORYOU:
-						if (tsc->data[i]->val4)
+						if (SC_ENTRY(tsc, i)->val4)
 							continue;
 						break;
 					case SC_ASSUMPTIO:
@@ -2358,7 +2356,7 @@ static int skill_additional_effect(struct block_list *src, struct block_list *bl
 						break;
 					case SC_BERSERK:
 					case SC_SATURDAY_NIGHT_FEVER:
-						tsc->data[i]->val2 = 0;
+						SC_ENTRY(tsc, i)->val2 = 0;
 						break;
 					}
 					status_change_end(bl, (sc_type)i, INVALID_TIMER);
@@ -2408,12 +2406,12 @@ static int skill_additional_effect(struct block_list *src, struct block_list *bl
 			rate = battle_config.equip_natural_break_rate;
 			if( sc )
 			{
-				if(sc->data[SC_GIANTGROWTH])
+				if(SC_ENTRY(sc, SC_GIANTGROWTH))
 					rate += 10;
 #ifndef RENEWAL
-				if(sc->data[SC_OVERTHRUST] != NULL)
+				if(SC_ENTRY(sc, SC_OVERTHRUST) != NULL)
 					rate += 10;
-				if(sc->data[SC_OVERTHRUSTMAX] != NULL)
+				if(SC_ENTRY(sc, SC_OVERTHRUSTMAX) != NULL)
 					rate += 10;
 #endif
 			}
@@ -2426,8 +2424,8 @@ static int skill_additional_effect(struct block_list *src, struct block_list *bl
 			rate = 0;
 			if( sd )
 				rate += sd->bonus.break_weapon_rate;
-			if( sc && sc->data[SC_MELTDOWN] )
-				rate += sc->data[SC_MELTDOWN]->val2;
+			if( sc && SC_ENTRY(sc, SC_MELTDOWN) )
+				rate += SC_ENTRY(sc, SC_MELTDOWN)->val2;
 			if( rate )
 				skill->break_equip(bl, EQP_WEAPON, rate, BCT_ENEMY);
 
@@ -2435,8 +2433,8 @@ static int skill_additional_effect(struct block_list *src, struct block_list *bl
 			rate = 0;
 			if( sd )
 				rate += sd->bonus.break_armor_rate;
-			if( sc && sc->data[SC_MELTDOWN] )
-				rate += sc->data[SC_MELTDOWN]->val3;
+			if( sc && SC_ENTRY(sc, SC_MELTDOWN) )
+				rate += SC_ENTRY(sc, SC_MELTDOWN)->val3;
 			if( rate )
 				skill->break_equip(bl, EQP_ARMOR, rate, BCT_ENEMY);
 		}
@@ -2456,14 +2454,14 @@ static int skill_additional_effect(struct block_list *src, struct block_list *bl
 	if( sd && sd->ed && sc && !status->isdead(bl) && !skill_id ) {
 		struct unit_data *ud = unit->bl2ud(src);
 
-		if( sc->data[SC_WILD_STORM_OPTION] )
-			temp = sc->data[SC_WILD_STORM_OPTION]->val2;
-		else if( sc->data[SC_UPHEAVAL_OPTION] )
-			temp = sc->data[SC_UPHEAVAL_OPTION]->val2;
-		else if( sc->data[SC_TROPIC_OPTION] )
-			temp = sc->data[SC_TROPIC_OPTION]->val3;
-		else if( sc->data[SC_CHILLY_AIR_OPTION] )
-			temp = sc->data[SC_CHILLY_AIR_OPTION]->val3;
+		if( SC_ENTRY(sc, SC_WILD_STORM_OPTION) )
+			temp = SC_ENTRY(sc, SC_WILD_STORM_OPTION)->val2;
+		else if( SC_ENTRY(sc, SC_UPHEAVAL_OPTION) )
+			temp = SC_ENTRY(sc, SC_UPHEAVAL_OPTION)->val2;
+		else if( SC_ENTRY(sc, SC_TROPIC_OPTION) )
+			temp = SC_ENTRY(sc, SC_TROPIC_OPTION)->val3;
+		else if( SC_ENTRY(sc, SC_CHILLY_AIR_OPTION) )
+			temp = SC_ENTRY(sc, SC_CHILLY_AIR_OPTION)->val3;
 		else
 			temp = 0;
 
@@ -2779,8 +2777,8 @@ static int skill_counter_additional_effect(struct block_list *src, struct block_
 			attack_type |= BF_WEAPON;
 			break;
 		case LG_HESPERUSLIT:
-			if ( sc && sc->data[SC_FORCEOFVANGUARD] && sc->data[SC_BANDING] && sc->data[SC_BANDING]->val2 > 6 ) {
-					for(int i = 0; i < sc->data[SC_FORCEOFVANGUARD]->val3 && sc->fv_counter <= sc->data[SC_FORCEOFVANGUARD]->val3 ; i++)
+			if ( sc && SC_ENTRY(sc, SC_FORCEOFVANGUARD) && SC_ENTRY(sc, SC_BANDING) && SC_ENTRY(sc, SC_BANDING)->val2 > 6 ) {
+					for(int i = 0; i < SC_ENTRY(sc, SC_FORCEOFVANGUARD)->val3 && sc->fv_counter <= SC_ENTRY(sc, SC_FORCEOFVANGUARD)->val3 ; i++)
 						clif->millenniumshield(bl, sc->fv_counter++);
 				}
 				break;
@@ -2828,11 +2826,11 @@ static int skill_counter_additional_effect(struct block_list *src, struct block_
 			sp += sd->bonus.magic_sp_gain_value;
 			hp += sd->bonus.magic_hp_gain_value;
 			if( skill_id == WZ_WATERBALL ) {// (bugreport:5303)
-				if( sc->data[SC_SOULLINK]
-				  && sc->data[SC_SOULLINK]->val2 == SL_WIZARD
-				  && sc->data[SC_SOULLINK]->val3 == WZ_WATERBALL
+				if( SC_ENTRY(sc, SC_SOULLINK)
+				  && SC_ENTRY(sc, SC_SOULLINK)->val2 == SL_WIZARD
+				  && SC_ENTRY(sc, SC_SOULLINK)->val3 == WZ_WATERBALL
 				)
-					sc->data[SC_SOULLINK]->val3 = 0; //Clear bounced spell check.
+					SC_ENTRY(sc, SC_SOULLINK)->val3 = 0; //Clear bounced spell check.
 			}
 		}
 		if (hp != 0 || sp != 0) {
@@ -2998,7 +2996,7 @@ static int skill_break_equip(struct block_list *bl, unsigned short where, int ra
 
 	for (i = 0; i < 4; i++) {
 		if (where&where_list[i]) {
-			if (sc && sc->count && sc->data[scdef[i]])
+			if (sc && sc->count && SC_ENTRY(sc, scdef[i]))
 				where&=~where_list[i];
 			else if (rnd()%10000 >= rate)
 				where&=~where_list[i];
@@ -3063,7 +3061,7 @@ static int skill_strip_equip(struct block_list *bl, unsigned short where, int ra
 		return 0;
 
 	for (i = 0; i < ARRAYLENGTH(pos); i++) {
-		if (where&pos[i] && sc->data[sc_def[i]])
+		if (where&pos[i] && SC_ENTRY(sc, sc_def[i]))
 			where&=~pos[i];
 	}
 	if (!where) return 0;
@@ -3108,7 +3106,7 @@ static int skill_blown(struct block_list *src, struct block_list *target, int co
 		case BL_PC:
 		{
 			struct map_session_data *sd = BL_UCAST(BL_PC, target);
-			if (sd->sc.data[SC_BASILICA] && sd->sc.data[SC_BASILICA]->val4 == sd->bl.id && !is_boss(src))
+			if (SC_ENTRY(&sd->sc, SC_BASILICA) && SC_ENTRY(&sd->sc, SC_BASILICA)->val4 == sd->bl.id && !is_boss(src))
 				return 0; // Basilica caster can't be knocked-back by normal monsters.
 			if (!(flag&0x2) && src != target && sd->special_state.no_knockback)
 				return 0;
@@ -3138,7 +3136,7 @@ static int skill_blown(struct block_list *src, struct block_list *target, int co
 
 	dir = unit_get_opposite_dir(dir); // take the reversed 'direction' and reverse it
 
-	if (tsc != NULL && tsc->data[SC_SU_STOOP]) // Any knockback will cancel it.
+	if (tsc != NULL && SC_ENTRY(tsc, SC_SU_STOOP)) // Any knockback will cancel it.
 		status_change_end(target, SC_SU_STOOP, INVALID_TIMER);
 
 	return unit->push(target, dir, count, (flag & 0x1) == 0x0); // send over the proper flag
@@ -3157,7 +3155,7 @@ static int skill_magic_reflect(struct block_list *src, struct block_list *bl, in
 	struct map_session_data* sd = BL_CAST(BL_PC, bl);
 
 	nullpo_ret(src);
-	if( sc && sc->data[SC_KYOMU] ) // Nullify reflecting ability
+	if( sc && SC_ENTRY(sc, SC_KYOMU) ) // Nullify reflecting ability
 		return  0;
 
 	// item-based reflection
@@ -3171,13 +3169,13 @@ static int skill_magic_reflect(struct block_list *src, struct block_list *bl, in
 	if( !sc || sc->count == 0 )
 		return 0;
 
-	if( sc->data[SC_MAGICMIRROR] && rnd()%100 < sc->data[SC_MAGICMIRROR]->val2 )
+	if( SC_ENTRY(sc, SC_MAGICMIRROR) && rnd()%100 < SC_ENTRY(sc, SC_MAGICMIRROR)->val2 )
 		return 1;
 
-	if( sc->data[SC_KAITE] && (src->type == BL_PC || status->get_lv(src) <= 80) )
+	if( SC_ENTRY(sc, SC_KAITE) && (src->type == BL_PC || status->get_lv(src) <= 80) )
 	{// Kaite only works against non-players if they are low-level.
 		clif->specialeffect(bl, 438, AREA);
-		if( --sc->data[SC_KAITE]->val2 <= 0 )
+		if( --SC_ENTRY(sc, SC_KAITE)->val2 <= 0 )
 			status_change_end(bl, SC_KAITE, INVALID_TIMER);
 		return 2;
 	}
@@ -3255,13 +3253,13 @@ static int skill_attack(int attack_type, struct block_list *src, struct block_li
 	if(skill_id == WZ_FROSTNOVA && dsrc->x == bl->x && dsrc->y == bl->y)
 		return 0;
 	 //Trick Dead protects you from damage, but not from buffs and the like, hence it's placed here.
-	if (sc && sc->data[SC_TRICKDEAD])
+	if (sc && SC_ENTRY(sc, SC_TRICKDEAD))
 		return 0;
 
 #ifndef RENEWAL // 2018.10 rebalance - HW_GRAVITATION is a basic magic damage skill now
 	if ( skill_id != HW_GRAVITATION ) {
 		struct status_change *csc = status->get_sc(src);
-		if(csc && csc->data[SC_GRAVITATION] && csc->data[SC_GRAVITATION]->val3 == BCT_SELF )
+		if(csc && SC_ENTRY(csc, SC_GRAVITATION) && SC_ENTRY(csc, SC_GRAVITATION)->val3 == BCT_SELF )
 			return 0;
 	}
 #endif
@@ -3305,15 +3303,15 @@ static int skill_attack(int attack_type, struct block_list *src, struct block_li
 			/* bugreport:7859 magical reflected zeroes blow count */
 			dmg.blewcount = 0;
 			//Spirit of Wizard blocks Kaite's reflection
-			if (reflecttype == 2 && sc && sc->data[SC_SOULLINK] && sc->data[SC_SOULLINK]->val2 == SL_WIZARD) {
+			if (reflecttype == 2 && sc && SC_ENTRY(sc, SC_SOULLINK) && SC_ENTRY(sc, SC_SOULLINK)->val2 == SL_WIZARD) {
 				//Consume one Fragment per hit of the casted skill? [Skotlex]
 				int consumeitem = tsd ? pc->search_inventory(tsd, ITEMID_FRAGMENT_OF_CRYSTAL) : 0;
 				if (consumeitem != INDEX_NOT_FOUND) {
 					if ( tsd ) pc->delitem(tsd, consumeitem, 1, 0, DELITEM_SKILLUSE, LOG_TYPE_CONSUME);
 					dmg.damage = dmg.damage2 = 0;
 					dmg.dmg_lv = ATK_MISS;
-					sc->data[SC_SOULLINK]->val3 = skill_id;
-					sc->data[SC_SOULLINK]->val4 = dsrc->id;
+					SC_ENTRY(sc, SC_SOULLINK)->val3 = skill_id;
+					SC_ENTRY(sc, SC_SOULLINK)->val4 = dsrc->id;
 				}
 			} else if( reflecttype != 2 ) /* Kaite bypasses */
 				additional_effects = false;
@@ -3342,7 +3340,7 @@ static int skill_attack(int attack_type, struct block_list *src, struct block_li
 
 				dmg.damage = battle->attr_fix(bl, bl, dmg.damage, s_ele, status_get_element(bl), status_get_element_level(bl));
 
-				if( sc && sc->data[SC_ENERGYCOAT] ) {
+				if( sc && SC_ENTRY(sc, SC_ENERGYCOAT) ) {
 					struct status_data *st = status->get_status_data(bl);
 					int per = 100*st->sp / st->max_sp -1; //100% should be counted as the 80~99% interval
 					per /=20; //Uses 20% SP intervals.
@@ -3355,16 +3353,16 @@ static int skill_attack(int attack_type, struct block_list *src, struct block_li
 			}
 		#endif /* MAGIC_REFLECTION_TYPE */
 		}
-		if (sc && sc->data[SC_MAGICROD] && src == dsrc) {
+		if (sc && SC_ENTRY(sc, SC_MAGICROD) && src == dsrc) {
 			int sp = skill->get_sp(skill_id, skill_lv);
 			dmg.damage = dmg.damage2 = 0;
 			dmg.dmg_lv = ATK_MISS; //This will prevent skill additional effect from taking effect. [Skotlex]
-			sp = sp * sc->data[SC_MAGICROD]->val2 / 100;
+			sp = sp * SC_ENTRY(sc, SC_MAGICROD)->val2 / 100;
 			if (skill_id == WZ_WATERBALL && skill_lv > 1)
 				sp = sp / ((skill_lv | 1) * (skill_lv | 1)); //Estimate SP cost of a single water-ball
 			status->heal(bl, 0, sp, STATUS_HEAL_SHOWEFFECT);
 			if (battle->bc->magicrod_type == 1)
-				clif->skill_nodamage(bl, bl, SA_MAGICROD, sc->data[SC_MAGICROD]->val1, 1); // Animation used here in eAthena [Wolfie]
+				clif->skill_nodamage(bl, bl, SA_MAGICROD, SC_ENTRY(sc, SC_MAGICROD)->val1, 1); // Animation used here in eAthena [Wolfie]
 		}
 	}
 
@@ -3384,10 +3382,10 @@ static int skill_attack(int attack_type, struct block_list *src, struct block_li
 
 	if( (skill_id == AL_INCAGI || skill_id == AL_BLESSING ||
 		skill_id == CASH_BLESSING || skill_id == CASH_INCAGI ||
-		skill_id == MER_INCAGI || skill_id == MER_BLESSING) && tsd && tsd->sc.data[SC_PROPERTYUNDEAD] )
+		skill_id == MER_INCAGI || skill_id == MER_BLESSING) && tsd && SC_ENTRY(&tsd->sc, SC_PROPERTYUNDEAD) )
 		damage = 1;
 
-	if( damage && sc && sc->data[SC_GENSOU] && dmg.flag&BF_MAGIC ){
+	if( damage && sc && SC_ENTRY(sc, SC_GENSOU) && dmg.flag&BF_MAGIC ){
 		struct block_list *nbl;
 		nbl = battle->get_enemy_area(bl,bl->x,bl->y,2,BL_CHAR,bl->id);
 		if (nbl) { // Only one target is chosen.
@@ -3417,7 +3415,7 @@ static int skill_attack(int attack_type, struct block_list *src, struct block_li
 		int combo = 0; //Used to signal if this skill can be combo'ed later on.
 		struct status_change_entry *sce;
 
-		if ((sce = sd->sc.data[SC_COMBOATTACK])) {//End combo state after skill is invoked. [Skotlex]
+		if ((sce = SC_ENTRY(&sd->sc, SC_COMBOATTACK))) {//End combo state after skill is invoked. [Skotlex]
 			switch (skill_id) {
 			case TK_TURNKICK:
 			case TK_STORMKICK:
@@ -3464,7 +3462,7 @@ static int skill_attack(int attack_type, struct block_list *src, struct block_li
 					combo = 1;
 				FALLTHROUGH
 			case CH_CHAINCRUSH:
-				if (!combo && pc->checkskill(sd, MO_EXTREMITYFIST) > 0 && sd->spiritball > 0 && sd->sc.data[SC_EXPLOSIONSPIRITS])
+				if (!combo && pc->checkskill(sd, MO_EXTREMITYFIST) > 0 && sd->spiritball > 0 && SC_ENTRY(&sd->sc, SC_EXPLOSIONSPIRITS))
 					combo = 1;
 				break;
 			case AC_DOUBLE:
@@ -3485,7 +3483,7 @@ static int skill_attack(int attack_type, struct block_list *src, struct block_li
 				break;
 			case SL_STIN:
 			case SL_STUN:
-				if (skill_lv >= 7 && !sd->sc.data[SC_SMA_READY])
+				if (skill_lv >= 7 && !SC_ENTRY(&sd->sc, SC_SMA_READY))
 					sc_start(src, src, SC_SMA_READY, 100, skill_lv, skill->get_time(SL_SMA, skill_lv), skill_id);
 				break;
 			case GS_FULLBUSTER:
@@ -3670,7 +3668,7 @@ static int skill_attack(int attack_type, struct block_list *src, struct block_li
 	// Plagiarism and Reproduce Code Block [KeiKun]
 	if (bl->type == BL_PC && damage > 0 && dmg.flag&BF_SKILL && tsd
 		&& (pc->checkskill(tsd, RG_PLAGIARISM) || pc->checkskill(tsd, SC_REPRODUCE))
-		&& (!tsd->sc.data[SC_PRESERVE] || tsd->sc.data[SC__REPRODUCE])
+		&& (!SC_ENTRY(&tsd->sc, SC_PRESERVE) || SC_ENTRY(&tsd->sc, SC__REPRODUCE))
 		&& damage < tsd->battle_status.hp // Updated to not be able to copy skills if the blow will kill you. [Skotlex]
 		) {
 		int copy_skill = 0;
@@ -3739,7 +3737,7 @@ static int skill_attack(int attack_type, struct block_list *src, struct block_li
 		break;
 		case 2: // Reproduce
 		{
-			lv = sc ? sc->data[SC__REPRODUCE]->val1 : 1;
+			lv = sc ? SC_ENTRY(sc, SC__REPRODUCE)->val1 : 1;
 			lv = min(lv, skill->get_max(copy_skill));
 			if (learned_lv > lv) {
 				pc->clear_existing_reproduceskill(tsd, true);
@@ -3777,7 +3775,7 @@ static int skill_attack(int attack_type, struct block_list *src, struct block_li
 
 	if( !dmg.amotion ) {
 		//Instant damage
-		if ((!sc || (!sc->data[SC_DEVOTION] && skill_id != CR_REFLECTSHIELD && !sc->data[SC_WATER_SCREEN_OPTION])) && !shadow_flag)
+		if ((!sc || (!SC_ENTRY(sc, SC_DEVOTION) && skill_id != CR_REFLECTSHIELD && !SC_ENTRY(sc, SC_WATER_SCREEN_OPTION))) && !shadow_flag)
 			status_fix_damage(src,bl,damage,dmg.dmotion); //Deal damage before knockback to allow stuff like firewall+storm gust combo.
 		if( !status->isdead(bl) && additional_effects )
 			skill->additional_effect(src,bl,skill_id,skill_lv,dmg.flag,dmg.dmg_lv,tick);
@@ -3866,8 +3864,8 @@ static int skill_attack(int attack_type, struct block_list *src, struct block_li
 	}
 
 	if (sc != NULL && skill_id != PA_PRESSURE && skill_id != SJ_NOVAEXPLOSING && skill_id != SP_SOULEXPLOSION) {
-		if (sc->data[SC_DEVOTION]) {
-			struct status_change_entry *sce = sc->data[SC_DEVOTION];
+		if (SC_ENTRY(sc, SC_DEVOTION)) {
+			struct status_change_entry *sce = SC_ENTRY(sc, SC_DEVOTION);
 			struct block_list *d_bl = map->id2bl(sce->val1);
 			struct mercenary_data *d_md = BL_CAST(BL_MER, d_bl);
 			struct map_session_data *d_sd = BL_CAST(BL_PC, d_bl);
@@ -3891,8 +3889,8 @@ static int skill_attack(int attack_type, struct block_list *src, struct block_li
 					status_fix_damage(src, bl, damage, dmg.dmotion);
 			}
 		}
-		if (sc->data[SC_WATER_SCREEN_OPTION]) {
-			struct status_change_entry *sce = sc->data[SC_WATER_SCREEN_OPTION];
+		if (SC_ENTRY(sc, SC_WATER_SCREEN_OPTION)) {
+			struct status_change_entry *sce = SC_ENTRY(sc, SC_WATER_SCREEN_OPTION);
 			struct block_list *e_bl = map->id2bl(sce->val1);
 
 			if (e_bl) {
@@ -3937,10 +3935,10 @@ static int skill_attack(int attack_type, struct block_list *src, struct block_li
 			case GC_VENOMPRESSURE:
 			{
 				struct status_change *ssc = status->get_sc(src);
-				if (ssc != NULL && ssc->data[SC_POISONINGWEAPON] != NULL && rnd() % 100 < 70 + 5 * skill_lv) {
-					sc_type poison_sc = ssc->data[SC_POISONINGWEAPON]->val2;
+				if (ssc != NULL && SC_ENTRY(ssc, SC_POISONINGWEAPON) != NULL && rnd() % 100 < 70 + 5 * skill_lv) {
+					sc_type poison_sc = SC_ENTRY(ssc, SC_POISONINGWEAPON)->val2;
 					int duration = skill->get_time2(GC_POISONINGWEAPON, (poison_sc == SC_VENOMBLEED ? 1 : 2));
-					sc_start(src, bl, poison_sc, 100, ssc->data[SC_POISONINGWEAPON]->val1, duration, skill_id);
+					sc_start(src, bl, poison_sc, 100, SC_ENTRY(ssc, SC_POISONINGWEAPON)->val1, duration, skill_id);
 					status_change_end(src, SC_POISONINGWEAPON, INVALID_TIMER);
 					clif->skill_nodamage(src, bl, skill_id, skill_lv, 1);
 				}
@@ -3963,8 +3961,8 @@ static int skill_attack(int attack_type, struct block_list *src, struct block_li
 	if (!(flag&2)
 	 && (skill_id == MG_COLDBOLT || skill_id == MG_FIREBOLT || skill_id == MG_LIGHTNINGBOLT)
 	 && (sc = status->get_sc(src)) != NULL
-	 && sc->data[SC_DOUBLECASTING]
-	 && rnd() % 100 < sc->data[SC_DOUBLECASTING]->val2
+	 && SC_ENTRY(sc, SC_DOUBLECASTING)
+	 && rnd() % 100 < SC_ENTRY(sc, SC_DOUBLECASTING)->val2
 	) {
 		//skill->addtimerskill(src, tick + dmg.div_*dmg.amotion, bl->id, 0, 0, skill_id, skill_lv, BF_MAGIC, flag|2);
 		skill->addtimerskill(src, tick + dmg.amotion, bl->id, 0, 0, skill_id, skill_lv, BF_MAGIC, flag|2);
@@ -4464,10 +4462,10 @@ static int skill_timerskill(int tid, int64 tick, int id, intptr_t data)
 					} else {
 						struct status_change *sc = status->get_sc(src);
 						if(sc) {
-							if(sc->data[SC_SOULLINK] &&
-								sc->data[SC_SOULLINK]->val2 == SL_WIZARD &&
-								sc->data[SC_SOULLINK]->val3 == skl->skill_id)
-								sc->data[SC_SOULLINK]->val3 = 0; //Clear bounced spell check.
+							if(SC_ENTRY(sc, SC_SOULLINK) &&
+								SC_ENTRY(sc, SC_SOULLINK)->val2 == SL_WIZARD &&
+								SC_ENTRY(sc, SC_SOULLINK)->val3 == skl->skill_id)
+								SC_ENTRY(sc, SC_SOULLINK)->val3 = 0; //Clear bounced spell check.
 						}
 					}
 					break;
@@ -4977,7 +4975,7 @@ static int skill_castend_damage_id(struct block_list *src, struct block_list *bl
 			break;
 
 		case MO_COMBOFINISH:
-			if (!(flag&1) && sc && sc->data[SC_SOULLINK] && sc->data[SC_SOULLINK]->val2 == SL_MONK) {
+			if (!(flag&1) && sc && SC_ENTRY(sc, SC_SOULLINK) && SC_ENTRY(sc, SC_SOULLINK)->val2 == SL_MONK) {
 				//Becomes a splash attack when Soul Linked.
 				map->foreachinrange(skill->area_sub, bl,
 				                    skill->get_splash(skill_id, skill_lv),skill->splash_target(src),
@@ -5243,7 +5241,7 @@ static int skill_castend_damage_id(struct block_list *src, struct block_list *bl
 				if( (skill->area_temp[1] != bl->id && !(skill->get_inf2(skill_id)&INF2_NPC_SKILL)) || flag&SD_ANIMATION )
 					sflag |= SD_ANIMATION; // original target gets no animation (as well as all NPC skills)
 
-				if ( tsc && tsc->data[SC_HOVERING] && ( skill_id == SR_WINDMILL || skill_id == LG_MOONSLASHER ) )
+				if ( tsc && SC_ENTRY(tsc, SC_HOVERING) && ( skill_id == SR_WINDMILL || skill_id == LG_MOONSLASHER ) )
 					break;
 
 				if ((skill_id == SP_SHA || skill_id == SP_SWHOO) && bl->type != BL_MOB)
@@ -5643,14 +5641,14 @@ static int skill_castend_damage_id(struct block_list *src, struct block_list *bl
 		case RK_DRAGONBREATH:
 		{
 
-			if (tsc != NULL && tsc->data[SC_HIDING]) {
+			if (tsc != NULL && SC_ENTRY(tsc, SC_HIDING)) {
 				clif->skill_nodamage(src,src,skill_id,skill_lv,1);
 			} else
 				skill->attack(BF_WEAPON,src,src,bl,skill_id,skill_lv,tick,flag);
 		}
 			break;
 		case NPC_SELFDESTRUCTION: {
-			if (tsc != NULL && tsc->data[SC_HIDING])
+			if (tsc != NULL && SC_ENTRY(tsc, SC_HIDING))
 				break;
 			}
 			FALLTHROUGH
@@ -5750,14 +5748,14 @@ static int skill_castend_damage_id(struct block_list *src, struct block_list *bl
 			}
 			break;
 		case GC_WEAPONCRUSH:
-			if( sc && sc->data[SC_COMBOATTACK] && sc->data[SC_COMBOATTACK]->val1 == GC_WEAPONBLOCKING )
+			if( sc && SC_ENTRY(sc, SC_COMBOATTACK) && SC_ENTRY(sc, SC_COMBOATTACK)->val1 == GC_WEAPONBLOCKING )
 				skill->attack(BF_WEAPON,src,src,bl,skill_id,skill_lv,tick,flag);
 			else if( sd )
 				clif->skill_fail(sd, skill_id, USESKILL_FAIL_GC_WEAPONBLOCKING, 0, 0);
 			break;
 
 		case GC_CROSSRIPPERSLASHER:
-			if( sd && !(sc && sc->data[SC_ROLLINGCUTTER]) )
+			if( sd && !(sc && SC_ENTRY(sc, SC_ROLLINGCUTTER)) )
 				clif->skill_fail(sd, skill_id, USESKILL_FAIL_CONDITION, 0, 0);
 			else
 			{
@@ -5769,7 +5767,7 @@ static int skill_castend_damage_id(struct block_list *src, struct block_list *bl
 		case GC_PHANTOMMENACE:
 			if( flag&1 ) {
 				// Only Hits Invisible Targets
-				if(tsc && (tsc->option&(OPTION_HIDE|OPTION_CLOAK|OPTION_CHASEWALK) || tsc->data[SC__INVISIBILITY]) )
+				if(tsc && (tsc->option&(OPTION_HIDE|OPTION_CLOAK|OPTION_CHASEWALK) || SC_ENTRY(tsc, SC__INVISIBILITY)) )
 					skill->attack(BF_WEAPON,src,src,bl,skill_id,skill_lv,tick,flag);
 			}
 			break;
@@ -5799,11 +5797,11 @@ static int skill_castend_damage_id(struct block_list *src, struct block_list *bl
 				int i = SC_SUMMON5, x = 0;
 				int types[][2] = {{0, 0}, {0, 0}, {0, 0}, {0, 0}};
 				for(; i >= SC_SUMMON1; i--) {
-					if (sc->data[i]) {
-						int skillid = WL_TETRAVORTEX_FIRE + (sc->data[i]->val1 - WLS_FIRE) + (sc->data[i]->val1 == WLS_WIND) - (sc->data[i]->val1 == WLS_WATER);
+					if (SC_ENTRY(sc, i)) {
+						int skillid = WL_TETRAVORTEX_FIRE + (SC_ENTRY(sc, i)->val1 - WLS_FIRE) + (SC_ENTRY(sc, i)->val1 == WLS_WIND) - (SC_ENTRY(sc, i)->val1 == WLS_WATER);
 						if (x < 4) {
 							int sc_index = 0, rate = 0;
-							types[x][0] = (sc->data[i]->val1 - WLS_FIRE) + 1;
+							types[x][0] = (SC_ENTRY(sc, i)->val1 - WLS_FIRE) + 1;
 							types[x][1] = 25; // 25% each for equal sharing
 							if (x == 3) {
 								x = 0;
@@ -5827,7 +5825,7 @@ static int skill_castend_damage_id(struct block_list *src, struct block_list *bl
 				clif->skill_nodamage(src, bl, skill_id, skill_lv, 1);
 				skill->toggle_magicpower(src, skill_id, skill_lv);
 				// Priority is to release SpellBook
-				if (sc && sc->data[SC_READING_SB]) {
+				if (sc && SC_ENTRY(sc, SC_READING_SB)) {
 					// SpellBook
 					uint16 spell_skill_id, spell_skill_lv, point, s = 0;
 					int spell[SC_SPELLBOOK7-SC_SPELLBOOK1 + 1];
@@ -5835,7 +5833,7 @@ static int skill_castend_damage_id(struct block_list *src, struct block_list *bl
 
 					// List all available spell to be released
 					for (i = SC_SPELLBOOK7; i >= SC_SPELLBOOK1; i--) {
-						if (sc->data[i])
+						if (SC_ENTRY(sc, i))
 							spell[s++] = i;
 					}
 
@@ -5843,18 +5841,18 @@ static int skill_castend_damage_id(struct block_list *src, struct block_list *bl
 						break;
 
 					i = spell[s==1?0:rnd()%s];// Random select of spell to be released.
-					if( s && sc->data[i] ){// Now extract the data from the preserved spell
-						spell_skill_id = sc->data[i]->val1;
-						spell_skill_lv = sc->data[i]->val2;
-						point = sc->data[i]->val3;
+					if( s && SC_ENTRY(sc, i) ){// Now extract the data from the preserved spell
+						spell_skill_id = SC_ENTRY(sc, i)->val1;
+						spell_skill_lv = SC_ENTRY(sc, i)->val2;
+						point = SC_ENTRY(sc, i)->val3;
 						status_change_end(src, (sc_type)i, INVALID_TIMER);
 					} else {
 						//something went wrong :(
 						break;
 					}
 
-					if( sc->data[SC_READING_SB]->val2 > point )
-						sc->data[SC_READING_SB]->val2 -= point;
+					if( SC_ENTRY(sc, SC_READING_SB)->val2 > point )
+						SC_ENTRY(sc, SC_READING_SB)->val2 -= point;
 					else // Last spell to be released
 						status_change_end(src, SC_READING_SB, INVALID_TIMER);
 
@@ -5870,8 +5868,8 @@ static int skill_castend_damage_id(struct block_list *src, struct block_list *bl
 						skill->blockpc_start(sd, spell_skill_id, cooldown);
 				}else if( sc ){ // Summon Balls
 					for(i = SC_SUMMON5; i >= SC_SUMMON1; i--){
-						if( sc->data[i] ){
-							int skillid = WL_SUMMON_ATK_FIRE + (sc->data[i]->val1 - WLS_FIRE);
+						if( SC_ENTRY(sc, i) ){
+							int skillid = WL_SUMMON_ATK_FIRE + (SC_ENTRY(sc, i)->val1 - WLS_FIRE);
 							skill->addtimerskill(src, tick + (int64)status_get_adelay(src) * (SC_SUMMON5 - i), bl->id, 0, 0, skillid, skill_lv, BF_MAGIC, flag);
 							status_change_end(src, (sc_type)i, INVALID_TIMER);
 							if(skill_lv == 1)
@@ -6031,12 +6029,12 @@ static int skill_castend_damage_id(struct block_list *src, struct block_list *bl
 
 		case WM_SOUND_OF_DESTRUCTION:
 			{
-				if( tsc && tsc->count && ( tsc->data[SC_SWING] || tsc->data[SC_SYMPHONY_LOVE] || tsc->data[SC_MOONLIT_SERENADE] ||
-						tsc->data[SC_RUSH_WINDMILL] || tsc->data[SC_ECHOSONG] || tsc->data[SC_HARMONIZE] ||
-						tsc->data[SC_SIREN] || tsc->data[SC_DEEP_SLEEP] || tsc->data[SC_SIRCLEOFNATURE] ||
-						tsc->data[SC_GLOOMYDAY] || tsc->data[SC_SONG_OF_MANA] ||
-						tsc->data[SC_DANCE_WITH_WUG] || tsc->data[SC_SATURDAY_NIGHT_FEVER] || tsc->data[SC_LERADS_DEW] ||
-						tsc->data[SC_MELODYOFSINK] || tsc->data[SC_BEYOND_OF_WARCRY] || tsc->data[SC_UNLIMITED_HUMMING_VOICE] ) &&
+				if( tsc && tsc->count && ( SC_ENTRY(tsc, SC_SWING) || SC_ENTRY(tsc, SC_SYMPHONY_LOVE) || SC_ENTRY(tsc, SC_MOONLIT_SERENADE) ||
+						SC_ENTRY(tsc, SC_RUSH_WINDMILL) || SC_ENTRY(tsc, SC_ECHOSONG) || SC_ENTRY(tsc, SC_HARMONIZE) ||
+						SC_ENTRY(tsc, SC_SIREN) || SC_ENTRY(tsc, SC_DEEP_SLEEP) || SC_ENTRY(tsc, SC_SIRCLEOFNATURE) ||
+						SC_ENTRY(tsc, SC_GLOOMYDAY) || SC_ENTRY(tsc, SC_SONG_OF_MANA) ||
+						SC_ENTRY(tsc, SC_DANCE_WITH_WUG) || SC_ENTRY(tsc, SC_SATURDAY_NIGHT_FEVER) || SC_ENTRY(tsc, SC_LERADS_DEW) ||
+						SC_ENTRY(tsc, SC_MELODYOFSINK) || SC_ENTRY(tsc, SC_BEYOND_OF_WARCRY) || SC_ENTRY(tsc, SC_UNLIMITED_HUMMING_VOICE) ) &&
 						rnd()%100 < 4 * skill_lv + 2 * (sd ? pc->checkskill(sd,WM_LESSON) : 10) + 10 * battle->calc_chorusbonus(sd)) {
 					skill->attack(BF_MISC,src,src,bl,skill_id,skill_lv,tick,flag);
 					status->change_start(src, bl, SC_STUN, 10000, skill_lv, 0, 0, 0, skill->get_time(skill_id, skill_lv), SCFLAG_FIXEDRATE, skill_id);
@@ -6063,7 +6061,7 @@ static int skill_castend_damage_id(struct block_list *src, struct block_list *bl
 
 		case SO_POISON_BUSTER:
 		{
-			if (tsc != NULL && tsc->data[SC_POISON]) {
+			if (tsc != NULL && SC_ENTRY(tsc, SC_POISON)) {
 				skill->attack(skill->get_type(skill_id, skill_lv), src, src, bl, skill_id, skill_lv, tick, flag);
 				status_change_end(bl, SC_POISON, INVALID_TIMER);
 			} else if( sd )
@@ -6139,7 +6137,7 @@ static int skill_castend_damage_id(struct block_list *src, struct block_list *bl
 
 				clif->skill_nodamage(src,battle->get_master(src),skill_id,skill_lv,1);
 				clif->skill_damage(src, src, tick, status_get_amotion(src), 0, -30000, 1, skill_id, skill_lv, BDT_SKILL);
-				if( (esc && esc->data[type2]) || (tsc && tsc->data[type]) ) {
+				if( (esc && SC_ENTRY(esc, type2)) || (tsc && SC_ENTRY(tsc, type)) ) {
 					elemental->clean_single_effect(ele, skill_id);
 				}
 				if( rnd()%100 < 50 )
@@ -6194,10 +6192,10 @@ static int skill_castend_damage_id(struct block_list *src, struct block_list *bl
 						status->change_start(src, bl, SC_HOWLING_MINE, 10000, skill_id, 0, 0, 0, skill->get_time(skill_id, skill_lv), SCFLAG_NOAVOID | SCFLAG_FIXEDTICK | SCFLAG_FIXEDRATE, skill_id);
 					break;
 				}
-				if (sd != NULL && sd->flicker && tsc != NULL && tsc->data[SC_HOWLING_MINE] != NULL && tsc->data[SC_HOWLING_MINE]->val2 == src->id) {
+				if (sd != NULL && sd->flicker && tsc != NULL && SC_ENTRY(tsc, SC_HOWLING_MINE) != NULL && SC_ENTRY(tsc, SC_HOWLING_MINE)->val2 == src->id) {
 					map->foreachinrange(skill->area_sub, bl, skill->get_splash(skill_id, skill_lv), BL_CHAR | BL_SKILL, src, skill_id, skill_lv, tick, flag | BCT_ENEMY | 1, skill->castend_damage_id);
 					flag |= 1; // Don't consume requirement
-					tsc->data[SC_HOWLING_MINE]->val3 = 1; // Mark the SC end because not expired
+					SC_ENTRY(tsc, SC_HOWLING_MINE)->val3 = 1; // Mark the SC end because not expired
 					status_change_end(bl, SC_HOWLING_MINE, INVALID_TIMER);
 					sc_start4(src, bl, SC_BURNING, 10 * skill_lv, skill_lv, 1000, src->id, 0, skill->get_time2(skill_id, skill_lv), skill_id);
 				}
@@ -6210,7 +6208,7 @@ static int skill_castend_damage_id(struct block_list *src, struct block_list *bl
 		case RL_QD_SHOT:
 			if (skill->area_temp[1] == bl->id)
 				break;
-			if ((flag & 1) && tsc != NULL && tsc->data[SC_CRIMSON_MARKER] != NULL)
+			if ((flag & 1) && tsc != NULL && SC_ENTRY(tsc, SC_CRIMSON_MARKER) != NULL)
 				skill->attack(skill->get_type(skill_id, skill_lv), src, src, bl, skill_id, skill_lv, tick, flag | SD_ANIMATION);
 			break;
 		case RL_D_TAIL:
@@ -6218,7 +6216,7 @@ static int skill_castend_damage_id(struct block_list *src, struct block_list *bl
 			if (flag & 1) {
 				skill->attack(skill->get_type(skill_id, skill_lv), src, src, bl, skill_id, skill_lv, tick, flag | SD_ANIMATION);
 			} else {
-				if (sd != NULL && tsc != NULL && tsc->data[SC_CRIMSON_MARKER] != NULL) {
+				if (sd != NULL && tsc != NULL && SC_ENTRY(tsc, SC_CRIMSON_MARKER) != NULL) {
 					int i;
 
 					ARR_FIND(0, MAX_SKILL_CRIMSON_MARKER, i, sd->c_marker[i] == bl->id);
@@ -6249,8 +6247,8 @@ static int skill_castend_damage_id(struct block_list *src, struct block_list *bl
 			}
 
 			// Check if the target is already tagged by another source.
-			if ((tsd != NULL && tsd->sc.data[SC_FLASHKICK] != NULL && tsd->sc.data[SC_FLASHKICK]->val1 != src->id) ||
-				(tmd != NULL && tmd->sc.data[SC_FLASHKICK] != NULL && tmd->sc.data[SC_FLASHKICK]->val1 != src->id)
+			if ((tsd != NULL && SC_ENTRY(&tsd->sc, SC_FLASHKICK) != NULL && SC_ENTRY(&tsd->sc, SC_FLASHKICK)->val1 != src->id) ||
+				(tmd != NULL && SC_ENTRY(&tmd->sc, SC_FLASHKICK) != NULL && SC_ENTRY(&tmd->sc, SC_FLASHKICK)->val1 != src->id)
 			) { // Same as the above check, but for monsters.
 				// Can't tag a player that was already tagged from another source.
 				if (sd != NULL) {
@@ -6292,7 +6290,7 @@ static int skill_castend_damage_id(struct block_list *src, struct block_list *bl
 			break;
 		case SJ_FALLINGSTAR_ATK:
 			if (sd != NULL) { // If a player used the skill it will search for targets marked by that player.
-				if (tsc != NULL && tsc->data[SC_FLASHKICK] != NULL && tsc->data[SC_FLASHKICK]->val4 == 1) { // Mark placed by a player.
+				if (tsc != NULL && SC_ENTRY(tsc, SC_FLASHKICK) != NULL && SC_ENTRY(tsc, SC_FLASHKICK)->val4 == 1) { // Mark placed by a player.
 					int i = 0;
 
 					ARR_FIND(0, MAX_STELLAR_MARKS, i, sd->stellar_mark[i] == bl->id);
@@ -6301,7 +6299,7 @@ static int skill_castend_damage_id(struct block_list *src, struct block_list *bl
 						skill->castend_damage_id(src, bl, SJ_FALLINGSTAR_ATK2, skill_lv, tick, 0);
 					}
 				}
-			} else if (tsc != NULL && tsc->data[SC_FLASHKICK] != NULL && tsc->data[SC_FLASHKICK]->val4 == 2) { // Mark placed by a monster.
+			} else if (tsc != NULL && SC_ENTRY(tsc, SC_FLASHKICK) != NULL && SC_ENTRY(tsc, SC_FLASHKICK)->val4 == 2) { // Mark placed by a monster.
 				// If a monster used the skill it will search for targets marked by any monster since they can't track their own targets.
 				skill->attack(BF_WEAPON, src, src, bl, skill_id, skill_lv, tick, flag);
 				skill->castend_damage_id(src, bl, SJ_FALLINGSTAR_ATK2, skill_lv, tick, 0);
@@ -6312,7 +6310,7 @@ static int skill_castend_damage_id(struct block_list *src, struct block_list *bl
 			skill->attack(BF_MISC, src, src, bl, skill_id, skill_lv, tick, flag);
 
 			// We can end Dimension here since the cooldown code is processed before this point.
-			if (sc != NULL && sc->data[SC_DIMENSION] != NULL)
+			if (sc != NULL && SC_ENTRY(sc, SC_DIMENSION) != NULL)
 				status_change_end(src, SC_DIMENSION, INVALID_TIMER);
 			else // Dimension not active? Activate the 2 second skill block penalty.
 				sc_start(src, &sd->bl, SC_NOVAEXPLOSING, 100, skill_lv, skill->get_time(skill_id, skill_lv), skill_id);
@@ -6320,11 +6318,11 @@ static int skill_castend_damage_id(struct block_list *src, struct block_list *bl
 			break;
 		case SP_SOULEXPLOSION:
 			if (!((tsc != NULL &&
-				(tsc->data[SC_SOULLINK] != NULL ||
-				tsc->data[SC_SOULGOLEM] != NULL ||
-				tsc->data[SC_SOULSHADOW] != NULL ||
-				tsc->data[SC_SOULFALCON] != NULL ||
-				tsc->data[SC_SOULFAIRY] != NULL))
+				(SC_ENTRY(tsc, SC_SOULLINK) != NULL ||
+				SC_ENTRY(tsc, SC_SOULGOLEM) != NULL ||
+				SC_ENTRY(tsc, SC_SOULSHADOW) != NULL ||
+				SC_ENTRY(tsc, SC_SOULFALCON) != NULL ||
+				SC_ENTRY(tsc, SC_SOULFAIRY) != NULL))
 				|| tstatus->hp > (10 * tstatus->max_hp / 100)
 			)) {
 				// Requires target to have a soul link or target to have more than 10% of MaxHP.
@@ -6358,7 +6356,7 @@ static int skill_castend_damage_id(struct block_list *src, struct block_list *bl
 			break;
 	}
 
-	if( sc && sc->data[SC_CURSEDCIRCLE_ATKER] ) //Should only remove after the skill has been casted.
+	if( sc && SC_ENTRY(sc, SC_CURSEDCIRCLE_ATKER) ) //Should only remove after the skill has been casted.
 		status_change_end(src,SC_CURSEDCIRCLE_ATKER,INVALID_TIMER);
 
 	map->freeblock_unlock();
@@ -6509,7 +6507,7 @@ static int skill_castend_id(int tid, int64 tick, int id, intptr_t data)
 
 		if( ud->skill_id == PR_LEXDIVINA || ud->skill_id == MER_LEXDIVINA ) {
 			sc = status->get_sc(target);
-			if( battle->check_target(src,target, BCT_ENEMY) <= 0 && (!sc || !sc->data[SC_SILENCE]) )
+			if( battle->check_target(src,target, BCT_ENEMY) <= 0 && (!sc || !SC_ENTRY(sc, SC_SILENCE)) )
 			{ //If it's not an enemy, and not silenced, you can't use the skill on them. [Skotlex]
 				clif->skill_nodamage (src, target, ud->skill_id, ud->skill_lv, 0);
 				break;
@@ -6555,7 +6553,7 @@ static int skill_castend_id(int tid, int64 tick, int id, intptr_t data)
 			}
 
 			if ((inf & BCT_ENEMY) != 0 && ud->skill_id != PF_SOULCHANGE // PF_SOULCHANGE is a friendly skill in Aegis under all circumstances.
-			 && (sc = status->get_sc(target)) != NULL && sc->data[SC_FOGWALL]
+			 && (sc = status->get_sc(target)) != NULL && SC_ENTRY(sc, SC_FOGWALL)
 			 && rnd() % 100 < 75
 			) {
 				// Fogwall makes all offensive-type targeted skills fail at 75%
@@ -6627,8 +6625,8 @@ static int skill_castend_id(int tid, int64 tick, int id, intptr_t data)
 				break;
 			case CR_GRANDCROSS:
 			case NPC_GRANDDARKNESS:
-				if( (sc = status->get_sc(src)) && sc->data[SC_NOEQUIPSHIELD] ) {
-					const struct TimerData *td = timer->get(sc->data[SC_NOEQUIPSHIELD]->timer);
+				if( (sc = status->get_sc(src)) && SC_ENTRY(sc, SC_NOEQUIPSHIELD) ) {
+					const struct TimerData *td = timer->get(SC_ENTRY(sc, SC_NOEQUIPSHIELD)->timer);
 					if( td && td->func == status->change_timer && DIFF_TICK(td->tick,timer->gettick()+skill->get_time(ud->skill_id, ud->skill_lv)) > 0 )
 						break;
 				}
@@ -6660,15 +6658,15 @@ static int skill_castend_id(int tid, int64 tick, int id, intptr_t data)
 
 		sc = status->get_sc(src);
 		if(sc && sc->count) {
-			if( sc->data[SC_SOULLINK]
-			 && sc->data[SC_SOULLINK]->val2 == SL_WIZARD
-			 && sc->data[SC_SOULLINK]->val3 == ud->skill_id
+			if( SC_ENTRY(sc, SC_SOULLINK)
+			 && SC_ENTRY(sc, SC_SOULLINK)->val2 == SL_WIZARD
+			 && SC_ENTRY(sc, SC_SOULLINK)->val3 == ud->skill_id
 			 && ud->skill_id != WZ_WATERBALL
 			)
-				sc->data[SC_SOULLINK]->val3 = 0; //Clear bounced spell check.
+				SC_ENTRY(sc, SC_SOULLINK)->val3 = 0; //Clear bounced spell check.
 
 #ifndef RENEWAL
-			if (sc->data[SC_DANCING] != NULL && (skill->get_inf2(ud->skill_id) & INF2_SONG_DANCE) != 0 && sd != NULL)
+			if (SC_ENTRY(sc, SC_DANCING) != NULL && (skill->get_inf2(ud->skill_id) & INF2_SONG_DANCE) != 0 && sd != NULL)
 				skill->blockpc_start(sd,BD_ADAPTATION,3000);
 #endif
 		}
@@ -6693,7 +6691,7 @@ static int skill_castend_id(int tid, int64 tick, int id, intptr_t data)
 	} while(0);
 
 	//Skill failed.
-	if (ud->skill_id == MO_EXTREMITYFIST && sd && !(sc && sc->data[SC_FOGWALL])) {
+	if (ud->skill_id == MO_EXTREMITYFIST && sd && !(sc && SC_ENTRY(sc, SC_FOGWALL))) {
 		//When Asura fails... (except when it fails from Fog of Wall)
 		//Consume SP/spheres
 		skill->consume_requirement(sd,ud->skill_id, ud->skill_lv,1);
@@ -6933,7 +6931,7 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 
 	type = skill->get_sc_type(skill_id);
 	tsc = status->get_sc(bl);
-	tsce = (tsc != NULL && type != SC_NONE) ? tsc->data[type] : NULL;
+	tsce = (tsc != NULL && type != SC_NONE) ? SC_ENTRY(tsc, type) : NULL;
 
 	if (src != bl && type > SC_NONE
 	 && (element = skill->get_ele(skill_id, skill_lv)) > ELE_NEUTRAL
@@ -6970,9 +6968,9 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 
 				if (tsc && tsc->count)
 				{
-					if (tsc->data[SC_KAITE] && !(sstatus->mode&MD_BOSS))
+					if (SC_ENTRY(tsc, SC_KAITE) && !(sstatus->mode&MD_BOSS))
 					{ //Bounce back heal
-						if (--tsc->data[SC_KAITE]->val2 <= 0)
+						if (--SC_ENTRY(tsc, SC_KAITE)->val2 <= 0)
 							status_change_end(bl, SC_KAITE, INVALID_TIMER);
 						if (src == bl)
 							heal=0; //When you try to heal yourself under Kaite, the heal is voided.
@@ -6981,14 +6979,14 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 							dstsd = sd;
 						}
 					}
-					else if (tsc->data[SC_BERSERK])
+					else if (SC_ENTRY(tsc, SC_BERSERK))
 						heal = 0; //Needed so that it actually displays 0 when healing.
 				}
 				if (skill_id == AL_HEAL) {
 					status_change_end(bl, SC_BITESCAR, INVALID_TIMER);
 				}
 				clif->skill_nodamage (src, bl, skill_id, heal, 1);
-				if( tsc && tsc->data[SC_AKAITSUKI] && heal && skill_id != HLIF_HEAL )
+				if( tsc && SC_ENTRY(tsc, SC_AKAITSUKI) && heal && skill_id != HLIF_HEAL )
 					heal = ~heal + 1;
 				heal_get_jobexp = status->heal(bl, heal, 0, STATUS_HEAL_DEFAULT);
 
@@ -7042,7 +7040,7 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 				break;
 			{
 				int per = 0, sper = 0;
-				if (tsc && tsc->data[SC_HELLPOWER])
+				if (tsc && SC_ENTRY(tsc, SC_HELLPOWER))
 					break;
 
 				if (map->list[bl->m].flag.pvp && dstsd && dstsd->pvp_point < 0)
@@ -7086,7 +7084,7 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 			break;
 
 		case MER_DECAGI:
-			if( tsc && !tsc->data[SC_ADORAMUS] ) //Prevent duplicate agi-down effect.
+			if( tsc && !SC_ENTRY(tsc, SC_ADORAMUS) ) //Prevent duplicate agi-down effect.
 				clif->skill_nodamage(src, bl, skill_id, skill_lv,
 					sc_start(src, bl, type, (40 + skill_lv * 2 + (status->get_lv(src) + sstatus->int_) / 5), skill_lv, skill->get_time(skill_id, skill_lv), skill_id));
 			break;
@@ -7244,9 +7242,9 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 					int i;
 					const enum sc_type scs[] = { SC_QUAGMIRE, SC_PROVOKE, SC_ROKISWEIL, SC_GRAVITATION, SC_NJ_SUITON, SC_NOEQUIPWEAPON, SC_NOEQUIPSHIELD, SC_NOEQUIPARMOR, SC_NOEQUIPHELM, SC_BLADESTOP };
 					for (i = SC_COMMON_MIN; i <= SC_COMMON_MAX; i++)
-						if (tsc->data[i]) status_change_end(bl, (sc_type)i, INVALID_TIMER);
+						if (SC_ENTRY(tsc, i)) status_change_end(bl, (sc_type)i, INVALID_TIMER);
 					for (i = 0; i < ARRAYLENGTH(scs); i++)
-						if (tsc->data[scs[i]]) status_change_end(bl, scs[i], INVALID_TIMER);
+						if (SC_ENTRY(tsc, scs[i])) status_change_end(bl, scs[i], INVALID_TIMER);
 				}
 			}
 			break;
@@ -7302,12 +7300,12 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 				}
 
 				if( sc && tsc ) {
-					if( !sc->data[SC_MARIONETTE_MASTER] && !tsc->data[SC_MARIONETTE] ) {
+					if( !SC_ENTRY(sc, SC_MARIONETTE_MASTER) && !SC_ENTRY(tsc, SC_MARIONETTE) ) {
 						sc_start(src, src, SC_MARIONETTE_MASTER, 100, bl->id, skill->get_time(skill_id, skill_lv), skill_id);
 						sc_start(src, bl, SC_MARIONETTE, 100, src->id, skill->get_time(skill_id, skill_lv), skill_id);
 						clif->skill_nodamage(src,bl,skill_id,skill_lv,1);
-					} else if( sc->data[SC_MARIONETTE_MASTER ] && sc->data[SC_MARIONETTE_MASTER ]->val1 == bl->id
-					        && tsc->data[SC_MARIONETTE] && tsc->data[SC_MARIONETTE]->val1 == src->id
+					} else if( SC_ENTRY(sc, SC_MARIONETTE_MASTER) && SC_ENTRY(sc, SC_MARIONETTE_MASTER)->val1 == bl->id
+					        && SC_ENTRY(tsc, SC_MARIONETTE) && SC_ENTRY(tsc, SC_MARIONETTE)->val1 == src->id
 					) {
 						status_change_end(src, SC_MARIONETTE_MASTER, INVALID_TIMER);
 						status_change_end(bl, SC_MARIONETTE, INVALID_TIMER);
@@ -7331,15 +7329,15 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 		case SA_SEISMICWEAPON: {
 			if (dstsd) {
 				if (dstsd->weapontype == W_FIST ||
-					(dstsd->sc.count && !dstsd->sc.data[type] &&
+					(dstsd->sc.count && !SC_ENTRY(&dstsd->sc, type) &&
 					( //Allow re-enchanting to lengthen time. [Skotlex]
-						dstsd->sc.data[SC_PROPERTYFIRE] ||
-						dstsd->sc.data[SC_PROPERTYWATER] ||
-						dstsd->sc.data[SC_PROPERTYWIND] ||
-						dstsd->sc.data[SC_PROPERTYGROUND] ||
-						dstsd->sc.data[SC_PROPERTYDARK] ||
-						dstsd->sc.data[SC_PROPERTYTELEKINESIS] ||
-						dstsd->sc.data[SC_ENCHANTPOISON]
+						SC_ENTRY(&dstsd->sc, SC_PROPERTYFIRE) ||
+						SC_ENTRY(&dstsd->sc, SC_PROPERTYWATER) ||
+						SC_ENTRY(&dstsd->sc, SC_PROPERTYWIND) ||
+						SC_ENTRY(&dstsd->sc, SC_PROPERTYGROUND) ||
+						SC_ENTRY(&dstsd->sc, SC_PROPERTYDARK) ||
+						SC_ENTRY(&dstsd->sc, SC_PROPERTYTELEKINESIS) ||
+						SC_ENTRY(&dstsd->sc, SC_ENCHANTPOISON)
 					))
 					) {
 					if (sd) clif->skill_fail(sd, skill_id, USESKILL_FAIL_LEVEL, 0, 0);
@@ -7430,7 +7428,7 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 		case AL_BLESSING:
 		case MER_INCAGI:
 		case MER_BLESSING:
-			if (dstsd != NULL && tsc->data[SC_PROPERTYUNDEAD]) {
+			if (dstsd != NULL && SC_ENTRY(tsc, SC_PROPERTYUNDEAD)) {
 				skill->attack(BF_MISC,src,src,bl,skill_id,skill_lv,tick,flag);
 				break;
 			}
@@ -7618,13 +7616,13 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 			break;
 		case AS_ENCHANTPOISON: // Prevent spamming [Valaris]
 			if (sd && dstsd && dstsd->sc.count) {
-				if (dstsd->sc.data[SC_PROPERTYFIRE] ||
-					dstsd->sc.data[SC_PROPERTYWATER] ||
-					dstsd->sc.data[SC_PROPERTYWIND] ||
-					dstsd->sc.data[SC_PROPERTYGROUND] ||
-					dstsd->sc.data[SC_PROPERTYDARK] ||
-					dstsd->sc.data[SC_PROPERTYTELEKINESIS]
-					//dstsd->sc.data[SC_ENCHANTPOISON] //People say you should be able to recast to lengthen the timer. [Skotlex]
+				if (SC_ENTRY(&dstsd->sc, SC_PROPERTYFIRE) ||
+					SC_ENTRY(&dstsd->sc, SC_PROPERTYWATER) ||
+					SC_ENTRY(&dstsd->sc, SC_PROPERTYWIND) ||
+					SC_ENTRY(&dstsd->sc, SC_PROPERTYGROUND) ||
+					SC_ENTRY(&dstsd->sc, SC_PROPERTYDARK) ||
+					SC_ENTRY(&dstsd->sc, SC_PROPERTYTELEKINESIS)
+					//SC_ENTRY(&dstsd->sc, SC_ENCHANTPOISON) //People say you should be able to recast to lengthen the timer. [Skotlex]
 				) {
 						clif->skill_nodamage(src,bl,skill_id,skill_lv,0);
 						clif->skill_fail(sd, skill_id, USESKILL_FAIL_LEVEL, 0, 0);
@@ -7706,7 +7704,7 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 			if( tsc && tsc->count )
 			{
 				status_change_end(bl, SC_FREEZE, INVALID_TIMER);
-				if( tsc->data[SC_STONE] && tsc->opt1 == OPT1_STONE )
+				if( SC_ENTRY(tsc, SC_STONE) && tsc->opt1 == OPT1_STONE )
 					status_change_end(bl, SC_STONE, INVALID_TIMER);
 				status_change_end(bl, SC_SLEEP, INVALID_TIMER);
 				status_change_end(bl, SC_TRICKDEAD, INVALID_TIMER);
@@ -7734,10 +7732,10 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 				if( (lv = status->get_lv(src) - dstsd->status.base_level) < 0 )
 					lv = -lv;
 				if( lv > battle_config.devotion_level_difference || // Level difference requeriments
-					(dstsd->sc.data[type] && dstsd->sc.data[type]->val1 != src->id) || // Cannot Devote a player devoted from another source
+					(SC_ENTRY(&dstsd->sc, type) && SC_ENTRY(&dstsd->sc, type)->val1 != src->id) || // Cannot Devote a player devoted from another source
 					(skill_id == ML_DEVOTION && (!mer || mer != dstsd->md)) || // Mercenary only can devote owner
 					(dstsd->job & MAPID_UPPERMASK) == MAPID_CRUSADER || // Crusader Cannot be devoted
-					(dstsd->sc.data[SC_HELLPOWER])) // Players affected by SC_HELLPOWERR cannot be devoted.
+					(SC_ENTRY(&dstsd->sc, SC_HELLPOWER))) // Players affected by SC_HELLPOWERR cannot be devoted.
 				{
 					if( sd )
 						clif->skill_fail(sd, skill_id, USESKILL_FAIL_LEVEL, 0, 0);
@@ -7783,7 +7781,7 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 					break;
 				}
 
-				if (dstsd->sc.data[type] && dstsd->sc.data[type]->val2 != src->id) { // Fail if a player is in unity with another source.
+				if (SC_ENTRY(&dstsd->sc, type) && SC_ENTRY(&dstsd->sc, type)->val2 != src->id) { // Fail if a player is in unity with another source.
 					if (sd != NULL)
 						clif->skill_fail(sd, skill_id, USESKILL_FAIL, 0, 0);
 					map->freeblock_unlock();
@@ -7933,7 +7931,7 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 					sc_start(src, bl, type, 100, skill_lv, skill->get_time(skill_id, skill_lv), skill_id);
 				}
 			}
-			if (skill_id == SJ_STAREMPEROR && sc != NULL && sc->data[SC_DIMENSION] != NULL) {
+			if (skill_id == SJ_STAREMPEROR && sc != NULL && SC_ENTRY(sc, SC_DIMENSION) != NULL) {
 				if (sd != NULL) {
 					pc->delspiritball(sd, sd->spiritball, 0);
 					sc_start2(src, bl, SC_DIMENSION1, 100, skill_lv, status_get_max_sp(src), skill->get_time2(SJ_BOOKOFDIMENSION, 1), SJ_BOOKOFDIMENSION);
@@ -8066,8 +8064,8 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 						// Angelus may "succeed" (sc_result = 1) and not start the SC when you have the effect of a greater level.
 						// When this happen, we should not heal.
 						// Comparing val1 to skill_lv will ensure us that it has succeeded and uses the current skill_lv
-						if (sc->data[SC_ANGELUS] != NULL && sc->data[SC_ANGELUS]->val1 == skill_lv)
-							status->heal(bl, sc->data[SC_ANGELUS]->val3, 0, STATUS_HEAL_DEFAULT);
+						if (SC_ENTRY(sc, SC_ANGELUS) != NULL && SC_ENTRY(sc, SC_ANGELUS)->val1 == skill_lv)
+							status->heal(bl, SC_ENTRY(sc, SC_ANGELUS)->val3, 0, STATUS_HEAL_DEFAULT);
 					}
 #endif
 				}
@@ -8152,12 +8150,12 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 			if (sd != NULL) {
 				if (!dstsd ||
 					!(
-						(sd->sc.data[SC_SOULLINK] && sd->sc.data[SC_SOULLINK]->val2 == SL_SOULLINKER)
+						(SC_ENTRY(&sd->sc, SC_SOULLINK) && SC_ENTRY(&sd->sc, SC_SOULLINK)->val2 == SL_SOULLINKER)
 						|| (dstsd->job & MAPID_UPPERMASK) == MAPID_SOUL_LINKER
 						|| dstsd->status.char_id == sd->status.char_id
 						|| dstsd->status.char_id == sd->status.partner_id
 						|| dstsd->status.char_id == sd->status.child
-						|| (skill_id == SP_KAUTE && dstsd->sc.data[SC_SOULUNITY] != NULL)
+						|| (skill_id == SP_KAUTE && SC_ENTRY(&dstsd->sc, SC_SOULUNITY) != NULL)
 					)
 				) {
 					status->change_start(src, src, SC_STUN, 10000, skill_lv, 0, 0, 0, 500, SCFLAG_FIXEDRATE, skill_id);
@@ -8239,7 +8237,7 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 
 #ifndef RENEWAL
 		case BD_ADAPTATION:
-			if (tsc != NULL && tsc->data[SC_DANCING] != NULL) {
+			if (tsc != NULL && SC_ENTRY(tsc, SC_DANCING) != NULL) {
 				clif->skill_nodamage(src,bl,skill_id,skill_lv,1);
 				status_change_end(bl, SC_DANCING, INVALID_TIMER);
 			}
@@ -8312,10 +8310,10 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 				if(status->isimmune(bl) || !tsc)
 					break;
 
-				if (sd && sd->sc.data[SC_PETROLOGY_OPTION])
-					brate = sd->sc.data[SC_PETROLOGY_OPTION]->val3;
+				if (sd && SC_ENTRY(&sd->sc, SC_PETROLOGY_OPTION))
+					brate = SC_ENTRY(&sd->sc, SC_PETROLOGY_OPTION)->val3;
 
-				if (tsc->data[SC_STONE]) {
+				if (SC_ENTRY(tsc, SC_STONE)) {
 					status_change_end(bl, SC_STONE, INVALID_TIMER);
 					clif->skill_nodamage(src,bl,skill_id,skill_lv,1);
 					break;
@@ -8611,7 +8609,7 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 			}
 
 			//Special message when trying to use strip on FCP [Jobbie]
-			if( sd && skill_id == ST_FULLSTRIP && tsc && tsc->data[SC_PROTECTWEAPON] && tsc->data[SC_PROTECTHELM] && tsc->data[SC_PROTECTARMOR] && tsc->data[SC_PROTECTSHIELD])
+			if( sd && skill_id == ST_FULLSTRIP && tsc && SC_ENTRY(tsc, SC_PROTECTWEAPON) && SC_ENTRY(tsc, SC_PROTECTHELM) && SC_ENTRY(tsc, SC_PROTECTARMOR) && SC_ENTRY(tsc, SC_PROTECTSHIELD))
 			{
 				clif->gospel_info(sd, 0x28);
 				break;
@@ -8670,7 +8668,7 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 					script->potion_target = bl->id;
 					script->run_use_script(sd, sd->inventory_data[inventory_idx], 0);
 					script->potion_flag = script->potion_target = 0;
-					if( sd->sc.data[SC_SOULLINK] && sd->sc.data[SC_SOULLINK]->val2 == SL_ALCHEMIST )
+					if( SC_ENTRY(&sd->sc, SC_SOULLINK) && SC_ENTRY(&sd->sc, SC_SOULLINK)->val2 == SL_ALCHEMIST )
 						bonus += sd->status.base_level;
 					if( script->potion_per_hp > 0 || script->potion_per_sp > 0 ) {
 						hp = tstatus->max_hp * script->potion_per_hp / 100;
@@ -8724,19 +8722,19 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 					sp += sp * i / 100;
 				}
 				if( tsc && tsc->count ) {
-					if( tsc->data[SC_CRITICALWOUND] ) {
-						hp -= hp * tsc->data[SC_CRITICALWOUND]->val2 / 100;
-						sp -= sp * tsc->data[SC_CRITICALWOUND]->val2 / 100;
+					if( SC_ENTRY(tsc, SC_CRITICALWOUND) ) {
+						hp -= hp * SC_ENTRY(tsc, SC_CRITICALWOUND)->val2 / 100;
+						sp -= sp * SC_ENTRY(tsc, SC_CRITICALWOUND)->val2 / 100;
 					}
-					if( tsc->data[SC_DEATHHURT] ) {
+					if( SC_ENTRY(tsc, SC_DEATHHURT) ) {
 						hp -= hp * 20 / 100;
 						sp -= sp * 20 / 100;
 					}
-					if( tsc->data[SC_WATER_INSIGNIA] && tsc->data[SC_WATER_INSIGNIA]->val1 == 2 ) {
+					if( SC_ENTRY(tsc, SC_WATER_INSIGNIA) && SC_ENTRY(tsc, SC_WATER_INSIGNIA)->val1 == 2 ) {
 						hp += hp / 10;
 						sp += sp / 10;
 					}
-					if (tsc->data[SC_NO_RECOVER_STATE]) {
+					if (SC_ENTRY(tsc, SC_NO_RECOVER_STATE)) {
 						hp = 0;
 						sp = 0;
 					}
@@ -8748,10 +8746,10 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 					clif->skill_nodamage(NULL,bl,MG_SRECOVERY,sp,1);
 				if (tsc) {
 #ifdef RENEWAL
-					if (tsc->data[SC_EXTREMITYFIST2])
+					if (SC_ENTRY(tsc, SC_EXTREMITYFIST2))
 						sp = 0;
 #endif
-					if (tsc->data[SC_NO_RECOVER_STATE]) {
+					if (SC_ENTRY(tsc, SC_NO_RECOVER_STATE)) {
 						hp = 0;
 						sp = 0;
 					}
@@ -8827,7 +8825,7 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 				}
 				clif->skill_nodamage(src,bl,skill_id,skill_lv,1);
 				if ((dstsd != NULL && (dstsd->job & MAPID_UPPERMASK) == MAPID_SOUL_LINKER)
-					|| (tsc && tsc->data[SC_SOULLINK] && tsc->data[SC_SOULLINK]->val2 == SL_ROGUE) //Rogue's spirit defends against dispel.
+					|| (tsc && SC_ENTRY(tsc, SC_SOULLINK) && SC_ENTRY(tsc, SC_SOULLINK)->val2 == SL_ROGUE) //Rogue's spirit defends against dispel.
 					|| (dstsd && pc_ismadogear(dstsd))
 					|| rnd()%100 >= 50+10*skill_lv )
 				{
@@ -8837,9 +8835,7 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 				}
 				if(status->isimmune(bl) || !tsc || !tsc->count)
 					break;
-				for(i = 0; i < SC_MAX; i++) {
-					if ( !tsc->data[i] )
-							continue;
+				STATUS_CHANGE_ITER(tsc, i) {
 					if( SC_COMMON_MAX < i ) {
 						if ( status->get_sc_type(i)&SC_NO_DISPELL )
 							continue;
@@ -8857,7 +8853,7 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 						case SC_DONTFORGETME:
 						case SC_FORTUNE:
 						case SC_SERVICEFORYOU:
-							if (tsc->data[i]->val4 != 0) // val4 = out-of-song-area
+							if (SC_ENTRY(tsc, i)->val4 != 0) // val4 = out-of-song-area
 								continue;
 							break;
 #endif
@@ -8869,7 +8865,7 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 							break;
 						case SC_BERSERK:
 						case SC_SATURDAY_NIGHT_FEVER:
-							tsc->data[i]->val2=0;  //Mark a dispelled berserk to avoid setting hp to 100 by setting hp penalty to 0.
+							SC_ENTRY(tsc, i)->val2=0;  //Mark a dispelled berserk to avoid setting hp to 100 by setting hp penalty to 0.
 							break;
 					}
 					status_change_end(bl, (sc_type)i, INVALID_TIMER);
@@ -8934,9 +8930,9 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 		case SA_SPELLBREAKER:
 			{
 				int sp;
-				if(tsc && tsc->data[SC_MAGICROD]) {
+				if(tsc && SC_ENTRY(tsc, SC_MAGICROD)) {
 					sp = skill->get_sp(skill_id,skill_lv);
-					sp = sp * tsc->data[SC_MAGICROD]->val2 / 100;
+					sp = sp * SC_ENTRY(tsc, SC_MAGICROD)->val2 / 100;
 					if(sp < 1) sp = 1;
 					status->heal(bl, 0, sp, STATUS_HEAL_SHOWEFFECT);
 					status_percent_damage(bl, src, 0, -20, false); //20% max SP damage.
@@ -9370,7 +9366,7 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 
 				if(tsc && tsc->count){
 					status_change_end(bl, SC_FREEZE, INVALID_TIMER);
-					if(tsc->data[SC_STONE] && tsc->opt1 == OPT1_STONE)
+					if(SC_ENTRY(tsc, SC_STONE) && tsc->opt1 == OPT1_STONE)
 						status_change_end(bl, SC_STONE, INVALID_TIMER);
 					status_change_end(bl, SC_SLEEP, INVALID_TIMER);
 				}
@@ -9396,7 +9392,7 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 					clif->skill_nodamage(src,bl,skill_id,skill_lv,1);
 					break;
 				} else if (dstsd != NULL) {
-					if (tsc != NULL && tsc->data[SC_BERSERK] != NULL)
+					if (tsc != NULL && SC_ENTRY(tsc, SC_BERSERK) != NULL)
 						break; // [Aegis] can't use on berserked players.
 				}
 				sp1 = sstatus->sp;
@@ -9404,10 +9400,10 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 #ifdef RENEWAL
 				sp1 = sp1 / 2;
 				sp2 = sp2 / 2;
-				if (tsc && tsc->data[SC_EXTREMITYFIST2])
+				if (tsc && SC_ENTRY(tsc, SC_EXTREMITYFIST2))
 					sp1 = tstatus->sp;
 #endif // RENEWAL
-				if (tsc && tsc->data[SC_NO_RECOVER_STATE])
+				if (tsc && SC_ENTRY(tsc, SC_NO_RECOVER_STATE))
 					sp1 = tstatus->sp;
 				status->set_sp(src, sp2, STATUS_HEAL_FORCED | STATUS_HEAL_SHOWEFFECT);
 				status->set_sp(bl, sp1, STATUS_HEAL_FORCED | STATUS_HEAL_SHOWEFFECT);
@@ -9431,19 +9427,19 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 						sp = sp * (100 + pc->checkskill(dstsd,MG_SRECOVERY)*10 + pc->skillheal2_bonus(dstsd, skill_id))/100;
 				}
 				if( tsc && tsc->count ) {
-					if (tsc->data[SC_CRITICALWOUND]) {
-						hp -= hp * tsc->data[SC_CRITICALWOUND]->val2 / 100;
-						sp -= sp * tsc->data[SC_CRITICALWOUND]->val2 / 100;
+					if (SC_ENTRY(tsc, SC_CRITICALWOUND)) {
+						hp -= hp * SC_ENTRY(tsc, SC_CRITICALWOUND)->val2 / 100;
+						sp -= sp * SC_ENTRY(tsc, SC_CRITICALWOUND)->val2 / 100;
 					}
-					if (tsc->data[SC_DEATHHURT]) {
+					if (SC_ENTRY(tsc, SC_DEATHHURT)) {
 						hp -= hp * 20 / 100;
 						sp -= sp * 20 / 100;
 					}
-					if( tsc->data[SC_WATER_INSIGNIA] && tsc->data[SC_WATER_INSIGNIA]->val1 == 2) {
+					if( SC_ENTRY(tsc, SC_WATER_INSIGNIA) && SC_ENTRY(tsc, SC_WATER_INSIGNIA)->val1 == 2) {
 						hp += hp / 10;
 						sp += sp / 10;
 					}
-					if (tsc->data[SC_NO_RECOVER_STATE]) {
+					if (SC_ENTRY(tsc, SC_NO_RECOVER_STATE)) {
 						hp = 0;
 						sp = 0;
 					}
@@ -9486,7 +9482,7 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 
 		case CG_LONGINGFREEDOM:
 			{
-				if (tsc && !tsce && (tsce=tsc->data[SC_DANCING]) != NULL && tsce->val4
+				if (tsc && !tsce && (tsce=SC_ENTRY(tsc, SC_DANCING)) != NULL && tsce->val4
 					&& (tsce->val1&0xFFFF) != CG_MOONLIT) //Can't use Longing for Freedom while under Moonlight Petals. [Skotlex]
 				{
 					clif->skill_nodamage(src,bl,skill_id,skill_lv,
@@ -9498,7 +9494,7 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 		case CG_TAROTCARD:
 			{
 				int count = -1;
-				if (tsc && tsc->data[type]) {
+				if (tsc && SC_ENTRY(tsc, type)) {
 					map->freeblock_unlock();
 					return 0;
 				}
@@ -9622,10 +9618,10 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 		case SL_SUPERNOVICE:
 		case SL_WIZARD:
 			if (sd != NULL && tsc != NULL &&
-				(tsc->data[SC_SOULGOLEM] ||
-				tsc->data[SC_SOULSHADOW] ||
-				tsc->data[SC_SOULFALCON] ||
-				tsc->data[SC_SOULFAIRY])
+				(SC_ENTRY(tsc, SC_SOULGOLEM) ||
+				SC_ENTRY(tsc, SC_SOULSHADOW) ||
+				SC_ENTRY(tsc, SC_SOULFALCON) ||
+				SC_ENTRY(tsc, SC_SOULFAIRY))
 			) { // Soul links from Soul Linker and Soul Reaper skills don't stack.
 				clif->skill_fail(sd, skill_id, USESKILL_FAIL, 0, 0);
 				break;
@@ -9648,10 +9644,10 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 			break;
 		case SL_HIGH:
 			if (sd != NULL && tsc != NULL &&
-				(tsc->data[SC_SOULGOLEM] != NULL ||
-				tsc->data[SC_SOULSHADOW] != NULL ||
-				tsc->data[SC_SOULFALCON] != NULL ||
-				tsc->data[SC_SOULFAIRY] != NULL)
+				(SC_ENTRY(tsc, SC_SOULGOLEM) != NULL ||
+				SC_ENTRY(tsc, SC_SOULSHADOW) != NULL ||
+				SC_ENTRY(tsc, SC_SOULFALCON) != NULL ||
+				SC_ENTRY(tsc, SC_SOULFAIRY) != NULL)
 			) { // Soul links from Soul Linker and Soul Reaper skills don't stack.
 				clif->skill_fail(sd, skill_id, USESKILL_FAIL, 0, 0);
 				break;
@@ -9674,15 +9670,15 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 				break;
 			}
 			if (tsc != NULL) {
-				if (tsc->data[skill->get_sc_type(skill_id)]) { // Allow refreshing an already active soul link.
+				if (SC_ENTRY(tsc, skill->get_sc_type(skill_id))) { // Allow refreshing an already active soul link.
 					clif->skill_nodamage(src, bl, skill_id, skill_lv, sc_start(src, bl, type, 100, skill_lv, skill->get_time(skill_id, skill_lv), skill_id));
 					break;
 				} else if (
-					(tsc->data[SC_SOULLINK] != NULL ||
-					tsc->data[SC_SOULGOLEM] != NULL ||
-					tsc->data[SC_SOULSHADOW] != NULL ||
-					tsc->data[SC_SOULFALCON] != NULL ||
-					tsc->data[SC_SOULFAIRY] != NULL)
+					(SC_ENTRY(tsc, SC_SOULLINK) != NULL ||
+					SC_ENTRY(tsc, SC_SOULGOLEM) != NULL ||
+					SC_ENTRY(tsc, SC_SOULSHADOW) != NULL ||
+					SC_ENTRY(tsc, SC_SOULFALCON) != NULL ||
+					SC_ENTRY(tsc, SC_SOULFAIRY) != NULL)
 				) { // Soul links from Soul Linker and Soul Reaper skills don't stack.
 					clif->skill_fail(sd, skill_id, USESKILL_FAIL, 0, 0);
 					break;
@@ -9693,11 +9689,11 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 
 		case SP_SOULREVOLVE:
 			if (!(tsc != NULL &&
-				(tsc->data[SC_SOULLINK] != NULL ||
-				tsc->data[SC_SOULGOLEM] != NULL ||
-				tsc->data[SC_SOULSHADOW] != NULL ||
-				tsc->data[SC_SOULFALCON] != NULL ||
-				tsc->data[SC_SOULFAIRY] != NULL)
+				(SC_ENTRY(tsc, SC_SOULLINK) != NULL ||
+				SC_ENTRY(tsc, SC_SOULGOLEM) != NULL ||
+				SC_ENTRY(tsc, SC_SOULSHADOW) != NULL ||
+				SC_ENTRY(tsc, SC_SOULFALCON) != NULL ||
+				SC_ENTRY(tsc, SC_SOULFAIRY) != NULL)
 			)) {
 				if (sd != NULL)
 					clif->skill_fail(sd, skill_id, USESKILL_FAIL, 0, 0);
@@ -10151,17 +10147,17 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 				}
 			}else if( sd ){
 				if( tsc && tsc->count ){
-					if(tsc->data[SC_MILLENNIUMSHIELD])
+					if(SC_ENTRY(tsc, SC_MILLENNIUMSHIELD))
 						skill->area_temp[5] |= 0x10;
-					if(tsc->data[SC_REFRESH])
+					if(SC_ENTRY(tsc, SC_REFRESH))
 						skill->area_temp[5] |= 0x20;
-					if(tsc->data[SC_GIANTGROWTH])
+					if(SC_ENTRY(tsc, SC_GIANTGROWTH))
 						skill->area_temp[5] |= 0x40;
-					if(tsc->data[SC_STONEHARDSKIN])
+					if(SC_ENTRY(tsc, SC_STONEHARDSKIN))
 						skill->area_temp[5] |= 0x80;
-					if(tsc->data[SC_VITALITYACTIVATION])
+					if(SC_ENTRY(tsc, SC_VITALITYACTIVATION))
 						skill->area_temp[5] |= 0x100;
-					if(tsc->data[SC_ABUNDANCE])
+					if(SC_ENTRY(tsc, SC_ABUNDANCE))
 						skill->area_temp[5] |= 0x200;
 				}
 				clif->skill_nodamage(src, bl, skill_id, skill_lv, 1);
@@ -10176,9 +10172,9 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 				short count = 1;
 				skill->area_temp[2] = 0;
 				map->foreachinrange(skill->area_sub,src,skill->get_splash(skill_id,skill_lv),BL_CHAR,src,skill_id,skill_lv,tick,flag|BCT_ENEMY|SD_PREAMBLE|SD_SPLASH|1,skill->castend_damage_id);
-				if( tsc && tsc->data[SC_ROLLINGCUTTER] )
+				if( tsc && SC_ENTRY(tsc, SC_ROLLINGCUTTER) )
 				{ // Every time the skill is casted the status change is reseted adding a counter.
-					count += (short)tsc->data[SC_ROLLINGCUTTER]->val1;
+					count += (short)SC_ENTRY(tsc, SC_ROLLINGCUTTER)->val1;
 					if( count > 10 )
 						count = 10; // Max counter
 					status_change_end(bl, SC_ROLLINGCUTTER, INVALID_TIMER);
@@ -10189,7 +10185,7 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 			break;
 
 		case GC_WEAPONBLOCKING:
-			if( tsc && tsc->data[SC_WEAPONBLOCKING] )
+			if( tsc && SC_ENTRY(tsc, SC_WEAPONBLOCKING) )
 				status_change_end(bl, SC_WEAPONBLOCKING, INVALID_TIMER);
 			else
 				sc_start(src, bl, SC_WEAPONBLOCKING, 100, skill_lv, skill->get_time(skill_id, skill_lv), skill_id);
@@ -10297,7 +10293,7 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 			break;
 		case AB_CHEAL:
 			if( sd == NULL || sd->status.party_id == 0 || flag&1 ) {
-				if (sd && tstatus && !battle->check_undead(tstatus->race, tstatus->def_ele) && !(tsc && tsc->data[SC_BERSERK])) {
+				if (sd && tstatus && !battle->check_undead(tstatus->race, tstatus->def_ele) && !(tsc && SC_ENTRY(tsc, SC_BERSERK))) {
 					int lv = pc->checkskill(sd, AL_HEAL);
 					int heal = skill->calc_heal(src, bl, AL_HEAL, lv, true);
 
@@ -10310,7 +10306,7 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 						heal = 0;
 
 					clif->skill_nodamage(bl, bl, skill_id, heal, 1);
-					if( tsc && tsc->data[SC_AKAITSUKI] && heal )
+					if( tsc && SC_ENTRY(tsc, SC_AKAITSUKI) && heal )
 						heal = ~heal + 1;
 					status->heal(bl, heal, 0, STATUS_HEAL_FORCED);
 				}
@@ -10329,8 +10325,8 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 
 		case AB_LAUDAAGNUS:
 			if( (flag&1 || sd == NULL) || !sd->status.party_id) {
-				if( tsc && (tsc->data[SC_FREEZE] || tsc->data[SC_STONE] || tsc->data[SC_BLIND] ||
-					tsc->data[SC_BURNING] || tsc->data[SC_FROSTMISTY] || tsc->data[SC_COLD])) {
+				if( tsc && (SC_ENTRY(tsc, SC_FREEZE) || SC_ENTRY(tsc, SC_STONE) || SC_ENTRY(tsc, SC_BLIND) ||
+					SC_ENTRY(tsc, SC_BURNING) || SC_ENTRY(tsc, SC_FROSTMISTY) || SC_ENTRY(tsc, SC_COLD))) {
 					// Success Chance: (40 + 10 * Skill Level) %
 					if( rnd()%100 > 40+10*skill_lv ) break;
 					status_change_end(bl, SC_FREEZE, INVALID_TIMER);
@@ -10349,8 +10345,8 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 
 		case AB_LAUDARAMUS:
 			if( (flag&1 || sd == NULL) || !sd->status.party_id ) {
-				if( tsc && (tsc->data[SC_SLEEP] || tsc->data[SC_STUN] || tsc->data[SC_MANDRAGORA] ||
-					tsc->data[SC_SILENCE] || tsc->data[SC_DEEP_SLEEP]) ){
+				if( tsc && (SC_ENTRY(tsc, SC_SLEEP) || SC_ENTRY(tsc, SC_STUN) || SC_ENTRY(tsc, SC_MANDRAGORA) ||
+					SC_ENTRY(tsc, SC_SILENCE) || SC_ENTRY(tsc, SC_DEEP_SLEEP)) ){
 					// Success Chance: (40 + 10 * Skill Level) %
 					if( rnd()%100 > 40+10*skill_lv )  break;
 					status_change_end(bl, SC_SLEEP, INVALID_TIMER);
@@ -10384,9 +10380,7 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 				}
 				if(status->isimmune(bl) || !tsc || !tsc->count)
 					break;
-				for(i = 0; i < SC_MAX; i++) {
-					if ( !tsc->data[i] )
-						continue;
+				STATUS_CHANGE_ITER(tsc, i) {
 					if (status->get_sc_type(i)&SC_NO_CLEARANCE)
 						continue;
 					PRAGMA_GCC46(GCC diagnostic push)
@@ -10399,7 +10393,7 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 							break;
 						case SC_BERSERK:
 						case SC_SATURDAY_NIGHT_FEVER:
-							tsc->data[i]->val2=0;  //Mark a dispelled berserk to avoid setting hp to 100 by setting hp penalty to 0.
+							SC_ENTRY(tsc, i)->val2=0;  //Mark a dispelled berserk to avoid setting hp to 100 by setting hp penalty to 0.
 							break;
 					}
 					PRAGMA_GCC46(GCC diagnostic pop)
@@ -10442,7 +10436,7 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 				if( sd )
 					skill->blockpc_start(sd,skill_id,4000);
 
-				if( !(tsc && tsc->data[type]) ){
+				if( !(tsc && SC_ENTRY(tsc, type)) ){
 					int failure = sc_start2(src, bl, type, rate, skill_lv, src->id, (src == bl) ? 5000 : (bl->type == BL_PC) ? skill->get_time(skill_id, skill_lv) : skill->get_time2(skill_id, skill_lv), skill_id);
 					clif->skill_nodamage(src,bl,skill_id,skill_lv,failure);
 					if( sd && !failure )
@@ -10476,7 +10470,7 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 			if( flag&1 ) {
 				if( status->isimmune(bl) || !tsc )
 					break;
-				if( tsc && tsc->data[SC_STONE] )
+				if( tsc && SC_ENTRY(tsc, SC_STONE) )
 					status_change_end(bl,SC_STONE,INVALID_TIMER);
 				else
 					status->change_start(src, bl, SC_STONE, 10000, skill_lv, 0, 0, 500, skill->get_time(skill_id, skill_lv), SCFLAG_FIXEDTICK, skill_id);
@@ -10497,7 +10491,7 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 		{
 			int i;
 			for( i = SC_SUMMON1; i <= SC_SUMMON5; i++ ){
-				if( tsc && !tsc->data[i] ){ // officially it doesn't work like a stack
+				if( tsc && !SC_ENTRY(tsc, i) ){ // officially it doesn't work like a stack
 					int ele = WLS_FIRE + (skill_id - WL_SUMMONFB) - (skill_id == WL_SUMMONSTONE ? 4 : 0);
 					clif->skill_nodamage(src, bl, skill_id, skill_lv,
 						sc_start(src, bl, (sc_type)i, 100, ele, skill->get_time(skill_id, skill_lv), skill_id));
@@ -10513,7 +10507,7 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 				int i;
 
 				for( i = SC_SPELLBOOK1; i <= SC_SPELLBOOK7; i++)
-					if( sc && !sc->data[i] )
+					if( sc && !SC_ENTRY(sc, i) )
 						break;
 				if( i == SC_SPELLBOOK7 ) {
 					clif->skill_fail(sd, WL_READING_SB, USESKILL_FAIL_SPELLBOOK_READING, 0, 0);
@@ -10675,8 +10669,8 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 
 		case SC_BODYPAINT:
 			if( flag&1 ) {
-				if( tsc && (tsc->data[SC_HIDING] || tsc->data[SC_CLOAKING] ||
-							tsc->data[SC_CHASEWALK] || tsc->data[SC_CLOAKINGEXCEED] ) ) {
+				if( tsc && (SC_ENTRY(tsc, SC_HIDING) || SC_ENTRY(tsc, SC_CLOAKING) ||
+							SC_ENTRY(tsc, SC_CHASEWALK) || SC_ENTRY(tsc, SC_CLOAKINGEXCEED) ) ) {
 					status_change_end(bl, SC_HIDING, INVALID_TIMER);
 					status_change_end(bl, SC_CLOAKING, INVALID_TIMER);
 					status_change_end(bl, SC_CHASEWALK, INVALID_TIMER);
@@ -10699,7 +10693,7 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 		case SC_LAZINESS:
 		case SC_UNLUCKY:
 		case SC_WEAKNESS:
-			if( !(tsc && tsc->data[type]) ) {
+			if( !(tsc && SC_ENTRY(tsc, type)) ) {
 				int joblvbonus = 0;
 				int rate = 0;
 				if (is_boss(bl)) break;
@@ -10711,14 +10705,14 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 				//Finally we set the minimum success chance cap based on the caster's skill level and DEX.
 				rate = cap_value( rate, skill_lv + sstatus->dex / 20, 100);
 				clif->skill_nodamage(src, bl, skill_id, 0, sc_start(src, bl, type, rate, skill_lv, skill->get_time(skill_id, skill_lv), skill_id));
-				if ( tsc && tsc->data[SC__IGNORANCE] && skill_id == SC_IGNORANCE) {
+				if ( tsc && SC_ENTRY(tsc, SC__IGNORANCE) && skill_id == SC_IGNORANCE) {
 					//If the target was successfully inflected with the Ignorance status, drain some of the targets SP.
 					int sp = 100 * skill_lv;
 					if( dstmd ) sp = dstmd->level * 2;
 					if( status_zap(bl,0,sp) )
 						status->heal(src, 0, sp / 2, STATUS_HEAL_FORCED | STATUS_HEAL_SHOWEFFECT);
 				}
-				if ( tsc && tsc->data[SC__UNLUCKY] && skill_id == SC_UNLUCKY) {
+				if ( tsc && SC_ENTRY(tsc, SC__UNLUCKY) && skill_id == SC_UNLUCKY) {
 					//If the target was successfully inflected with the Unlucky status, give 1 of 3 random status's.
 					switch(rnd()%3) {//Targets in the Unlucky status will be affected by one of the 3 random status's regardless of resistance.
 						case 0:
@@ -10742,7 +10736,7 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 			break;
 
 		case LG_REFLECTDAMAGE:
-			if( tsc && tsc->data[type] )
+			if( tsc && SC_ENTRY(tsc, type) )
 				status_change_end(bl,type,INVALID_TIMER);
 			else
 				sc_start(src, bl, type, 100, skill_lv, skill->get_time(skill_id, skill_lv), skill_id);
@@ -10864,10 +10858,8 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 			if( flag&1 ){
 				int i;
 				sc_start(src, bl, type, 100, skill_lv, skill->get_time(skill_id, skill_lv), skill_id);
-				for(i=0; i<SC_MAX; i++)
+				STATUS_CHANGE_ITER(tsc, i)
 				{
-					if (!tsc->data[i])
-						continue;
 					switch(i){
 						case SC_POISON:
 						case SC_BLIND:
@@ -11092,7 +11084,7 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 			break;
 
 		case WM_GLOOMYDAY:
-			if ( tsc && tsc->data[type] ) {
+			if ( tsc && SC_ENTRY(tsc, type) ) {
 				 clif->skill_fail(sd, skill_id, USESKILL_FAIL_LEVEL, 0, 0);
 				break;
 			}
@@ -11420,7 +11412,7 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 				struct status_change *sc = status->get_sc(src);
 
 				if( sc && sc->bs_counter < skill->get_maxcount( skill_id , skill_lv) ) {
-					if( tsc && tsc->data[type] ){
+					if( tsc && SC_ENTRY(tsc, type) ){
 						(sc->bs_counter)--;
 						status_change_end(src, type, INVALID_TIMER); // the first one cancels and the last one will take effect resetting the timer
 					}
@@ -11521,7 +11513,7 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 				sc_type type2 = type-1;
 				struct status_change *sc = status->get_sc(&ele->bl);
 
-				if( (sc && sc->data[type2]) || (tsc && tsc->data[type]) ) {
+				if( (sc && SC_ENTRY(sc, type2)) || (tsc && SC_ENTRY(tsc, type)) ) {
 					elemental->clean_single_effect(ele, skill_id);
 				} else {
 					clif->skill_nodamage(src,src,skill_id,skill_lv,1);
@@ -11552,7 +11544,7 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 				sc_type type2 = type-1;
 
 				clif->skill_nodamage(src,src,skill_id,skill_lv,1);
-				if( (sc && sc->data[type2]) || (tsc && tsc->data[type]) ) {
+				if( (sc && SC_ENTRY(sc, type2)) || (tsc && SC_ENTRY(tsc, type)) ) {
 					elemental->clean_single_effect(ele, skill_id);
 				} else {
 					// This not heals at the end.
@@ -11609,7 +11601,7 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 			break;
 
 		case KO_JYUSATSU:
-			if( dstsd && tsc && !tsc->data[type]
+			if( dstsd && tsc && !SC_ENTRY(tsc, type)
 			 && rnd()%100 < (10 * (5 * skill_lv - status_get_int(bl) / 2 + 45 + 5 * skill_lv))
 			) {
 				clif->skill_nodamage(src, bl, skill_id, skill_lv,
@@ -11668,8 +11660,8 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 		case KG_KAGEHUMI:
 			if( flag&1 ){
 				if (tsc && (tsc->option & (OPTION_CLOAK | OPTION_HIDE) ||
-				    tsc->data[SC_CAMOUFLAGE] || tsc->data[SC__SHADOWFORM] ||
-				    tsc->data[SC_MARIONETTE_MASTER] || tsc->data[SC_HARMONIZE])) {
+				    SC_ENTRY(tsc, SC_CAMOUFLAGE) || SC_ENTRY(tsc, SC__SHADOWFORM) ||
+				    SC_ENTRY(tsc, SC_MARIONETTE_MASTER) || SC_ENTRY(tsc, SC_HARMONIZE))) {
 					sc_start(src, src, type, 100, skill_lv, skill->get_time(skill_id, skill_lv), skill_id);
 					sc_start(src, bl, type, 100, skill_lv, skill->get_time(skill_id, skill_lv), skill_id);
 					status_change_end(bl, SC_HIDING, INVALID_TIMER);
@@ -11717,7 +11709,7 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 			if(tsc){
 				int i;
 				for (i = 0; i < ARRAYLENGTH(scs); i++) {
-					if (tsc->data[scs[i]]) status_change_end(bl, scs[i], INVALID_TIMER);
+					if (SC_ENTRY(tsc, scs[i])) status_change_end(bl, scs[i], INVALID_TIMER);
 				}
 			}
 			heal = 5 * status->get_lv(&hd->bl) + status->base_matk(&hd->bl, &hd->battle_status, status->get_lv(&hd->bl));
@@ -11891,7 +11883,7 @@ static int skill_castend_nodamage_id(struct block_list *src, struct block_list *
 
 	if(skill_id != SR_CURSEDCIRCLE) {
 		struct status_change *sc = status->get_sc(src);
-		if( sc && sc->data[SC_CURSEDCIRCLE_ATKER] )//Should only remove after the skill had been casted.
+		if( sc && SC_ENTRY(sc, SC_CURSEDCIRCLE_ATKER) )//Should only remove after the skill had been casted.
 			status_change_end(src,SC_CURSEDCIRCLE_ATKER,INVALID_TIMER);
 	}
 
@@ -12254,22 +12246,22 @@ static int skill_castend_map(struct map_session_data *sd, uint16 skill_id, const
 		return 0;
 	}
 	if(sd->sc.count && (
-		sd->sc.data[SC_ENSEMBLEFATIGUE] ||
-		sd->sc.data[SC_SILENCE] ||
-		sd->sc.data[SC_ROKISWEIL] ||
-		sd->sc.data[SC_AUTOCOUNTER] ||
-		sd->sc.data[SC_STEELBODY] ||
-		(sd->sc.data[SC_DANCING] && skill_id < RK_ENCHANTBLADE && !pc->checkskill(sd, WM_LESSON)) ||
-		sd->sc.data[SC_BERSERK] ||
-		sd->sc.data[SC_BASILICA] ||
-		sd->sc.data[SC_MARIONETTE_MASTER] ||
-		sd->sc.data[SC_WHITEIMPRISON] ||
-		(sd->sc.data[SC_STASIS] && skill->block_check(&sd->bl, SC_STASIS, skill_id)) ||
-		(sd->sc.data[SC_KG_KAGEHUMI] && skill->block_check(&sd->bl, SC_KG_KAGEHUMI, skill_id)) ||
-		sd->sc.data[SC_OBLIVIONCURSE] ||
-		sd->sc.data[SC__MANHOLE] ||
-		sd->sc.data[SC_GRAVITYCONTROL] ||
-		(sd->sc.data[SC_VOLCANIC_ASH] && rnd()%2) //50% fail chance under ASH
+		SC_ENTRY(&sd->sc, SC_ENSEMBLEFATIGUE) ||
+		SC_ENTRY(&sd->sc, SC_SILENCE) ||
+		SC_ENTRY(&sd->sc, SC_ROKISWEIL) ||
+		SC_ENTRY(&sd->sc, SC_AUTOCOUNTER) ||
+		SC_ENTRY(&sd->sc, SC_STEELBODY) ||
+		(SC_ENTRY(&sd->sc, SC_DANCING) && skill_id < RK_ENCHANTBLADE && !pc->checkskill(sd, WM_LESSON)) ||
+		SC_ENTRY(&sd->sc, SC_BERSERK) ||
+		SC_ENTRY(&sd->sc, SC_BASILICA) ||
+		SC_ENTRY(&sd->sc, SC_MARIONETTE_MASTER) ||
+		SC_ENTRY(&sd->sc, SC_WHITEIMPRISON) ||
+		(SC_ENTRY(&sd->sc, SC_STASIS) && skill->block_check(&sd->bl, SC_STASIS, skill_id)) ||
+		(SC_ENTRY(&sd->sc, SC_KG_KAGEHUMI) && skill->block_check(&sd->bl, SC_KG_KAGEHUMI, skill_id)) ||
+		SC_ENTRY(&sd->sc, SC_OBLIVIONCURSE) ||
+		SC_ENTRY(&sd->sc, SC__MANHOLE) ||
+		SC_ENTRY(&sd->sc, SC_GRAVITYCONTROL) ||
+		(SC_ENTRY(&sd->sc, SC_VOLCANIC_ASH) && rnd()%2) //50% fail chance under ASH
 	 )) {
 		skill_failed(sd);
 		return 0;
@@ -12404,7 +12396,7 @@ static int skill_castend_pos2(struct block_list *src, int x, int y, uint16 skill
 
 	sc = status->get_sc(src);
 	type = skill->get_sc_type(skill_id);
-	sce = (sc != NULL && type != SC_NONE) ? sc->data[type] : NULL;
+	sce = (sc != NULL && type != SC_NONE) ? SC_ENTRY(sc, type) : NULL;
 
 	PRAGMA_GCC46(GCC diagnostic push)
 	PRAGMA_GCC46(GCC diagnostic ignored "-Wswitch-enum")
@@ -12633,7 +12625,7 @@ static int skill_castend_pos2(struct block_list *src, int x, int y, uint16 skill
 
 #ifndef RENEWAL // 2018.11 rebalance - Basilica changed to a self buff
 		case HP_BASILICA:
-			if( sc && sc->data[SC_BASILICA] )
+			if( sc && SC_ENTRY(sc, SC_BASILICA) )
 				status_change_end(src, SC_BASILICA, INVALID_TIMER); // Cancel Basilica
 			else { // Create Basilica. Start SC on caster. Unit timer start SC on others.
 				if( map->foreachinrange(skill->count_wos, src, 2, BL_MOB|BL_PC, src) ) {
@@ -12714,7 +12706,7 @@ static int skill_castend_pos2(struct block_list *src, int x, int y, uint16 skill
 					(skill_lv >= 4) ? sd->status.memo_point[2].map : 0
 				);
 			}
-			if( sc && sc->data[SC_CURSEDCIRCLE_ATKER] ) //Should only remove after the skill has been casted.
+			if( sc && SC_ENTRY(sc, SC_CURSEDCIRCLE_ATKER) ) //Should only remove after the skill has been casted.
 				status_change_end(src,SC_CURSEDCIRCLE_ATKER,INVALID_TIMER);
 			return 0; // not to consume item.
 
@@ -12975,7 +12967,7 @@ static int skill_castend_pos2(struct block_list *src, int x, int y, uint16 skill
 		 * Guilotine Cross
 		 **/
 		case GC_POISONSMOKE:
-			if( !(sc && sc->data[SC_POISONINGWEAPON]) ) {
+			if( !(sc && SC_ENTRY(sc, SC_POISONINGWEAPON)) ) {
 				if( sd )
 					clif->skill_fail(sd, skill_id, USESKILL_FAIL_GC_POISONINGWEAPON, 0, 0);
 				return 0;
@@ -13070,7 +13062,7 @@ static int skill_castend_pos2(struct block_list *src, int x, int y, uint16 skill
 			break;
 
 		case LG_BANDING:
-			if( sc && sc->data[SC_BANDING] )
+			if( sc && SC_ENTRY(sc, SC_BANDING) )
 				status_change_end(src,SC_BANDING,INVALID_TIMER);
 			else if( (sg = skill->unitsetting(src,skill_id,skill_lv,src->x,src->y,0)) != NULL ) {
 				sc_start4(src, src, SC_BANDING, 100, skill_lv, 0, 0, sg->group_id, skill->get_time(skill_id, skill_lv), skill_id);
@@ -13215,7 +13207,7 @@ static int skill_castend_pos2(struct block_list *src, int x, int y, uint16 skill
 	}
 	PRAGMA_GCC46(GCC diagnostic pop)
 
-	if( sc && sc->data[SC_CURSEDCIRCLE_ATKER] ) //Should only remove after the skill has been casted.
+	if( sc && SC_ENTRY(sc, SC_CURSEDCIRCLE_ATKER) ) //Should only remove after the skill has been casted.
 		status_change_end(src,SC_CURSEDCIRCLE_ATKER,INVALID_TIMER);
 
 	if( sd ) {// ensure that the skill last-cast tick is recorded
@@ -13411,7 +13403,7 @@ static struct skill_unit_group *skill_unitsetting(struct block_list *src, uint16
 		#endif
 			break;
 		case MG_FIREWALL:
-			if(sc && sc->data[SC_VIOLENTGALE])
+			if(sc && SC_ENTRY(sc, SC_VIOLENTGALE))
 				limit = limit*3/2;
 			val2=4+skill_lv;
 			break;
@@ -13678,10 +13670,10 @@ static struct skill_unit_group *skill_unitsetting(struct block_list *src, uint16
 			break;
 			}
 		case GC_POISONSMOKE:
-			if( !(sc && sc->data[SC_POISONINGWEAPON]) )
+			if( !(sc && SC_ENTRY(sc, SC_POISONINGWEAPON)) )
 				return NULL;
-			val2 = sc->data[SC_POISONINGWEAPON]->val2; // Type of Poison
-			val3 = sc->data[SC_POISONINGWEAPON]->val1;
+			val2 = SC_ENTRY(sc, SC_POISONINGWEAPON)->val2; // Type of Poison
+			val3 = SC_ENTRY(sc, SC_POISONINGWEAPON)->val1;
 			limit = 4000 + 2000 * skill_lv;
 			break;
 		case GD_LEADERSHIP:
@@ -13933,20 +13925,20 @@ static int skill_unit_onplace(struct skill_unit *src, struct block_list *bl, int
 	if (sc && sc->option&OPTION_HIDE && sg->skill_id != WZ_HEAVENDRIVE && sg->skill_id != WL_EARTHSTRAIN )
 		return 0; //Hidden characters are immune to AoE skills except to these. [Skotlex]
 
-	if (sc && sc->data[SC_VACUUM_EXTREME] && map->getcell(bl->m, bl, bl->x, bl->y, CELL_CHKLANDPROTECTOR))
+	if (sc && SC_ENTRY(sc, SC_VACUUM_EXTREME) && map->getcell(bl->m, bl, bl->x, bl->y, CELL_CHKLANDPROTECTOR))
 		status_change_end(bl, SC_VACUUM_EXTREME, INVALID_TIMER);
 
-	if ( sc && sc->data[SC_HOVERING] && ( sg->skill_id == SO_VACUUM_EXTREME || sg->skill_id == SO_ELECTRICWALK || sg->skill_id == SO_FIREWALK || sg->skill_id == WZ_QUAGMIRE ) )
+	if ( sc && SC_ENTRY(sc, SC_HOVERING) && ( sg->skill_id == SO_VACUUM_EXTREME || sg->skill_id == SO_ELECTRICWALK || sg->skill_id == SO_FIREWALK || sg->skill_id == WZ_QUAGMIRE ) )
 		return 0;
 
 	type = skill->get_sc_type(sg->skill_id);
-	sce = (sc != NULL && type != SC_NONE) ? sc->data[type] : NULL;
+	sce = (sc != NULL && type != SC_NONE) ? SC_ENTRY(sc, type) : NULL;
 	skill_id = sg->skill_id; //In case the group is deleted, we need to return the correct skill id, still.
 	switch (sg->unit_id) {
 		case UNT_SPIDERWEB:
-			if( sc && sc->data[SC_SPIDERWEB] && sc->data[SC_SPIDERWEB]->val1 > 0 ) {
+			if( sc && SC_ENTRY(sc, SC_SPIDERWEB) && SC_ENTRY(sc, SC_SPIDERWEB)->val1 > 0 ) {
 				// If you are fiberlocked and can't move, it will only increase your fireweakness level. [Inkfish]
-				sc->data[SC_SPIDERWEB]->val2++;
+				SC_ENTRY(sc, SC_SPIDERWEB)->val2++;
 				break;
 			} else if (sc && battle->check_target(&src->bl,bl,sg->target_flag) > 0) {
 				int sec = skill->get_time2(sg->skill_id,sg->skill_lv);
@@ -14042,7 +14034,7 @@ static int skill_unit_onplace(struct skill_unit *src, struct block_list *bl, int
 		case UNT_INTOABYSS:
 		case UNT_SIEGFRIED:
 			 //Needed to check when a dancer/bard leaves their ensemble area.
-			if (sg->src_id==bl->id && !(sc && sc->data[SC_SOULLINK] && sc->data[SC_SOULLINK]->val2 == SL_BARDDANCER))
+			if (sg->src_id==bl->id && !(sc && SC_ENTRY(sc, SC_SOULLINK) && SC_ENTRY(sc, SC_SOULLINK)->val2 == SL_BARDDANCER))
 				return skill_id;
 			if (!sce)
 				sc_start4(ss, bl, type, 100, sg->skill_lv, sg->val1, sg->val2, 0, sg->limit, skill_id);
@@ -14061,7 +14053,7 @@ static int skill_unit_onplace(struct skill_unit *src, struct block_list *bl, int
 		case UNT_FORTUNEKISS:
 		case UNT_SERVICEFORYOU:
 			// Don't buff themselves without link!
-			if (sg->src_id==bl->id && !(sc && sc->data[SC_SOULLINK] && sc->data[SC_SOULLINK]->val2 == SL_BARDDANCER))
+			if (sg->src_id==bl->id && !(sc && SC_ENTRY(sc, SC_SOULLINK) && SC_ENTRY(sc, SC_SOULLINK)->val2 == SL_BARDDANCER))
 				return 0;
 
 			if (!sc) return 0;
@@ -14114,7 +14106,7 @@ static int skill_unit_onplace(struct skill_unit *src, struct block_list *bl, int
 
 		case UNT_MOONLIT:
 			//Knockback out of area if affected char isn't in Moonlit effect
-			if (sc && sc->data[SC_DANCING] && (sc->data[SC_DANCING]->val1&0xFFFF) == CG_MOONLIT)
+			if (sc && SC_ENTRY(sc, SC_DANCING) && (SC_ENTRY(sc, SC_DANCING)->val1&0xFFFF) == CG_MOONLIT)
 				break;
 			if (ss == bl) //Also needed to prevent infinite loop crash.
 				break;
@@ -14202,7 +14194,7 @@ static int skill_unit_onplace_timer(struct skill_unit *src, struct block_list *b
 	ssc = status->get_sc(ss); // Status Effects for Unit caster.
 
 	// Maestro or Wanderer is unaffected by traps of trappers he or she charmed [SuperHulk]
-	if ( ssc && ssc->data[SC_SIREN] && ssc->data[SC_SIREN]->val2 == bl->id && (skill->get_inf2(sg->skill_id)&INF2_TRAP) )
+	if ( ssc && SC_ENTRY(ssc, SC_SIREN) && SC_ENTRY(ssc, SC_SIREN)->val2 == bl->id && (skill->get_inf2(sg->skill_id)&INF2_TRAP) )
 		return 0;
 
 	tstatus = status->get_status_data(bl);
@@ -14212,7 +14204,7 @@ static int skill_unit_onplace_timer(struct skill_unit *src, struct block_list *b
 
 	PRAGMA_GCC46(GCC diagnostic push)
 	PRAGMA_GCC46(GCC diagnostic ignored "-Wswitch-enum")
-	if ( tsc && tsc->data[SC_HOVERING] ) {
+	if ( tsc && SC_ENTRY(tsc, SC_HOVERING) ) {
 		switch ( skill_id ) {
 		case HT_SKIDTRAP:
 		case HT_LANDMINE:
@@ -14305,7 +14297,7 @@ static int skill_unit_onplace_timer(struct skill_unit *src, struct block_list *b
 				if (status->isimmune(bl))
 					heal = 0;
 				clif->skill_nodamage(&src->bl, bl, AL_HEAL, heal, 1);
-				if (tsc && tsc->data[SC_AKAITSUKI] && heal)
+				if (tsc && SC_ENTRY(tsc, SC_AKAITSUKI) && heal)
 					heal = ~heal + 1;
 				status->heal(bl, heal, 0, STATUS_HEAL_DEFAULT);
 				if (diff >= 500)
@@ -14417,7 +14409,7 @@ static int skill_unit_onplace_timer(struct skill_unit *src, struct block_list *b
 					) {
 					// Do nothing if target are the specified monsters on manhole
 				} else if (status->change_start(ss, bl, type, 10000, sg->skill_lv, sg->group_id, 0, 0, sec, SCFLAG_FIXEDRATE, skill_id)) {
-					const struct TimerData* td = tsc->data[type] ? timer->get(tsc->data[type]->timer) : NULL;
+					const struct TimerData* td = SC_ENTRY(tsc, type) ? timer->get(SC_ENTRY(tsc, type)->timer) : NULL;
 					if (td)
 						sec = DIFF_TICK32(td->tick, tick);
 					if (sg->unit_id == UNT_MANHOLE || battle_config.skill_trap_type || map_flag_gvg2(src->bl.m) != 0) {
@@ -14458,7 +14450,7 @@ static int skill_unit_onplace_timer(struct skill_unit *src, struct block_list *b
 			break;
 
 		case UNT_VENOMDUST:
-			if (tsc != NULL && tsc->data[type] == NULL)
+			if (tsc != NULL && SC_ENTRY(tsc, type) == NULL)
 				status->change_start(ss, bl, type, 10000, sg->skill_lv, battle_config.venom_dust_exp != 0 ? sg->src_id : sg->group_id, 0, 0, skill->get_time2(sg->skill_id, sg->skill_lv), SCFLAG_NONE, skill_id);
 			break;
 
@@ -14530,20 +14522,20 @@ static int skill_unit_onplace_timer(struct skill_unit *src, struct block_list *b
 				break;
 #endif
 			// Don't buff themselves!
-			if ((sg->src_id == bl->id && !(tsc && tsc->data[SC_SOULLINK] && tsc->data[SC_SOULLINK]->val2 == SL_BARDDANCER)))
+			if ((sg->src_id == bl->id && !(tsc && SC_ENTRY(tsc, SC_SOULLINK) && SC_ENTRY(tsc, SC_SOULLINK)->val2 == SL_BARDDANCER)))
 				break;
 
 			// Aegis style
 			// Check if the remaining time is enough to survive the next update
 			if (!battle_config.song_timer_reset
-					&& !(tsc && tsc->data[type] && tsc->data[type]->val4 == 1)) {
+					&& !(tsc && SC_ENTRY(tsc, type) && SC_ENTRY(tsc, type)->val4 == 1)) {
 				// Apple of Idun is not active. Start it now
 				sc_start4(ss, bl, type, 100, sg->skill_lv, sg->val1, sg->val2, 0, sg->limit, skill_id);
 			}
 
 			if (tstatus->hp < tstatus->max_hp) {
 				heal = skill->calc_heal(ss,bl,sg->skill_id, sg->skill_lv, true);
-				if( tsc && tsc->data[SC_AKAITSUKI] && heal )
+				if( tsc && SC_ENTRY(tsc, SC_AKAITSUKI) && heal )
 					heal = ~heal + 1;
 				clif->skill_nodamage(&src->bl, bl, AL_HEAL, heal, 1);
 				status->heal(bl, heal, 0, STATUS_HEAL_DEFAULT);
@@ -14561,21 +14553,21 @@ static int skill_unit_onplace_timer(struct skill_unit *src, struct block_list *b
 			if (battle_config.song_timer_reset)
 				break;
 			// Don't let buff themselves!
-			if (sg->src_id == bl->id && !(tsc && tsc->data[SC_SOULLINK] && tsc->data[SC_SOULLINK]->val2 == SL_BARDDANCER))
+			if (sg->src_id == bl->id && !(tsc && SC_ENTRY(tsc, SC_SOULLINK) && SC_ENTRY(tsc, SC_SOULLINK)->val2 == SL_BARDDANCER))
 				break;
 
 			// Aegis style
 			// Check if song has enough time to survive the next check
-			if (!(battle_config.song_timer_reset) && tsc && tsc->data[type] && tsc->data[type]->val4 == 1) {
-				const struct TimerData *td = timer->get(tsc->data[type]->timer);
+			if (!(battle_config.song_timer_reset) && tsc && SC_ENTRY(tsc, type) && SC_ENTRY(tsc, type)->val4 == 1) {
+				const struct TimerData *td = timer->get(SC_ENTRY(tsc, type)->timer);
 				if (DIFF_TICK32(td->tick, timer->gettick()) < sg->interval) {
 					// Update with new values as the current one will vanish
-					timer->delete_(tsc->data[type]->timer, status->change_timer);
-					tsc->data[type]->timer = timer->add(tick+sg->limit, status->change_timer, bl->id, type);
-					tsc->data[type]->val1 = sg->skill_lv;
-					tsc->data[type]->val2 = sg->val1;
-					tsc->data[type]->val3 = sg->val2;
-					tsc->data[type]->val4 = 0;
+					timer->delete_(SC_ENTRY(tsc, type)->timer, status->change_timer);
+					SC_ENTRY(tsc, type)->timer = timer->add(tick+sg->limit, status->change_timer, bl->id, type);
+					SC_ENTRY(tsc, type)->val1 = sg->skill_lv;
+					SC_ENTRY(tsc, type)->val2 = sg->val1;
+					SC_ENTRY(tsc, type)->val3 = sg->val2;
+					SC_ENTRY(tsc, type)->val4 = 0;
 				}
 				break; // Had enough time or not, it now has. Exit
 			}
@@ -14729,7 +14721,7 @@ static int skill_unit_onplace_timer(struct skill_unit *src, struct block_list *b
 		 * 3rd stuff
 		 **/
 		case UNT_POISONSMOKE:
-			if (battle->check_target(ss, bl, BCT_ENEMY) > 0 && !(tsc != NULL && tsc->data[sg->val2] != NULL)
+			if (battle->check_target(ss, bl, BCT_ENEMY) > 0 && !(tsc != NULL && SC_ENTRY(tsc, sg->val2) != NULL)
 			    && rnd() % 100 < 50) {
 				int duration = skill->get_time2(GC_POISONINGWEAPON, (sg->val2 == SC_VENOMBLEED ? 1 : 2));
 				sc_start(ss, bl, sg->val2, 100, sg->val1, duration, skill_id);
@@ -14803,7 +14795,7 @@ static int skill_unit_onplace_timer(struct skill_unit *src, struct block_list *b
 				if( !sg->val2 ) {
 					int sec = skill->get_time2(sg->skill_id, sg->skill_lv);
 					if (sc_start(ss, bl, type, 100, sg->skill_lv, sec, skill_id)) {
-						const struct TimerData* td = tsc->data[type]?timer->get(tsc->data[type]->timer):NULL;
+						const struct TimerData* td = SC_ENTRY(tsc, type)?timer->get(SC_ENTRY(tsc, type)->timer):NULL;
 						if( td )
 							sec = DIFF_TICK32(td->tick, tick);
 						///map->moveblock(bl, src->bl.x, src->bl.y, tick); // in official server it doesn't behave like this. [malufett]
@@ -14812,7 +14804,7 @@ static int skill_unit_onplace_timer(struct skill_unit *src, struct block_list *b
 					} else
 						sec = 3000; // Couldn't trap it?
 					sg->limit = DIFF_TICK32(tick, sg->tick) + sec;
-				} else if( tsc->data[SC_THORNS_TRAP] && bl->id == sg->val2 )
+				} else if( SC_ENTRY(tsc, SC_THORNS_TRAP) && bl->id == sg->val2 )
 					skill->attack(skill->get_type(GN_THORNS_TRAP, sg->skill_lv), ss, ss, bl, sg->skill_id, sg->skill_lv, tick, SD_LEVEL|SD_ANIMATION);
 			}
 			break;
@@ -14854,7 +14846,7 @@ static int skill_unit_onplace_timer(struct skill_unit *src, struct block_list *b
 			break;
 
 		case UNT_CLOUD_KILL:
-			if(tsc && !tsc->data[type])
+			if(tsc && !SC_ENTRY(tsc, type))
 				status->change_start(ss, bl, type, 10000, sg->skill_lv, sg->group_id, 0, 0, skill->get_time2(sg->skill_id, sg->skill_lv), SCFLAG_FIXEDRATE, skill_id);
 			skill->attack(skill->get_type(sg->skill_id, sg->skill_lv), ss, &src->bl, bl, sg->skill_id, sg->skill_lv, tick, 0);
 			break;
@@ -14863,13 +14855,13 @@ static int skill_unit_onplace_timer(struct skill_unit *src, struct block_list *b
 			{
 				// It has effect on everything, including monsters, undead property and demon
 				int hp = 0;
-				if( ssc && ssc->data[SC_HEATER_OPTION] )
+				if( ssc && SC_ENTRY(ssc, SC_HEATER_OPTION) )
 					hp = tstatus->max_hp * 3 * sg->skill_lv / 100;
 				else
 					hp = tstatus->max_hp * sg->skill_lv / 100;
 				if( tstatus->hp != tstatus->max_hp )
 					clif->skill_nodamage(&src->bl, bl, AL_HEAL, hp, 0);
-				if( tsc && tsc->data[SC_AKAITSUKI] && hp )
+				if( tsc && SC_ENTRY(tsc, SC_AKAITSUKI) && hp )
 					hp = ~hp + 1;
 				status->heal(bl, hp, 0, STATUS_HEAL_DEFAULT);
 				sc_start(ss, bl, type, 100, sg->skill_lv, sg->interval + 100, skill_id);
@@ -14900,7 +14892,7 @@ static int skill_unit_onplace_timer(struct skill_unit *src, struct block_list *b
 			break;
 
 		case UNT_VACUUM_EXTREME:
-			if (tsc && (tsc->data[SC_HALLUCINATIONWALK] || tsc->data[SC_VACUUM_EXTREME])) {
+			if (tsc && (SC_ENTRY(tsc, SC_HALLUCINATIONWALK) || SC_ENTRY(tsc, SC_VACUUM_EXTREME))) {
 				return 0;
 			} else {
 				struct status_data *bst = status->get_base_status(bl);
@@ -14999,7 +14991,7 @@ static int skill_unit_onplace_timer(struct skill_unit *src, struct block_list *b
 					int sec = skill->get_time(sg->skill_id, sg->skill_lv);
 
 					if (sc_start2(ss, bl, type, 100, sg->skill_lv, sg->group_id, sec, skill_id)) {
-						const struct TimerData* td = ((tsc->data[type])? timer->get(tsc->data[type]->timer) : NULL);
+						const struct TimerData* td = ((SC_ENTRY(tsc, type))? timer->get(SC_ENTRY(tsc, type)->timer) : NULL);
 
 						if (td != NULL)
 							sec = DIFF_TICK32(td->tick, tick);
@@ -15009,7 +15001,7 @@ static int skill_unit_onplace_timer(struct skill_unit *src, struct block_list *b
 						sec = 7000;
 					}
 					sg->limit = DIFF_TICK32(tick, sg->tick) + sec;
-				} else if (tsc->data[type] && bl->id == sg->val2) {
+				} else if (SC_ENTRY(tsc, type) && bl->id == sg->val2) {
 					skill->attack(skill->get_type(SU_SV_ROOTTWIST_ATK, sg->skill_lv), ss, &src->bl, bl, SU_SV_ROOTTWIST_ATK, sg->skill_lv, tick, SD_LEVEL|SD_ANIMATION);
 				}
 			}
@@ -15020,7 +15012,7 @@ static int skill_unit_onplace_timer(struct skill_unit *src, struct block_list *b
 				1, sg->skill_id, sg->skill_lv, BDT_SKILL);
 			break;
 		case UNT_B_TRAP:
-			if (tsc != NULL && tsc->data[type])
+			if (tsc != NULL && SC_ENTRY(tsc, type))
 				break;
 			sc_start(ss, bl, type, 100, sg->skill_lv, skill->get_time2(sg->skill_id, sg->skill_lv), skill_id);
 			src->val2++;
@@ -15055,7 +15047,7 @@ static int skill_unit_onout(struct skill_unit *src, struct block_list *bl, int64
 	nullpo_ret(sg=src->group);
 	sc = status->get_sc(bl);
 	type = skill->get_sc_type(sg->skill_id);
-	sce = (sc != NULL && type != SC_NONE) ? sc->data[type] : NULL;
+	sce = (sc != NULL && type != SC_NONE) ? SC_ENTRY(sc, type) : NULL;
 
 	if( bl->prev == NULL
 	 || (status->isdead(bl) && sg->unit_id != UNT_ANKLESNARE && sg->unit_id != UNT_SPIDERWEB && sg->unit_id != UNT_THORNS_TRAP)
@@ -15100,7 +15092,7 @@ static int skill_unit_onout(struct skill_unit *src, struct block_list *bl, int64
 		case UNT_DONTFORGETME:
 		case UNT_FORTUNEKISS:
 		case UNT_SERVICEFORYOU:
-			if (sg->src_id==bl->id && !(sc && sc->data[SC_SOULLINK] && sc->data[SC_SOULLINK]->val2 == SL_BARDDANCER))
+			if (sg->src_id==bl->id && !(sc && SC_ENTRY(sc, SC_SOULLINK) && SC_ENTRY(sc, SC_SOULLINK)->val2 == SL_BARDDANCER))
 				return -1;
 	}
 	return sg->skill_id;
@@ -15120,7 +15112,7 @@ static int skill_unit_onleft(uint16 skill_id, struct block_list *bl, int64 tick)
 		sc = NULL;
 
 	type = skill->get_sc_type(skill_id);
-	sce = (sc != NULL && type != SC_NONE) ? sc->data[type] : NULL;
+	sce = (sc != NULL && type != SC_NONE) ? SC_ENTRY(sc, type) : NULL;
 
 	PRAGMA_GCC46(GCC diagnostic push)
 	PRAGMA_GCC46(GCC diagnostic ignored "-Wswitch-enum")
@@ -15140,7 +15132,7 @@ static int skill_unit_onleft(uint16 skill_id, struct block_list *bl, int64 tick)
 		case BD_ROKISWEIL:
 		case BD_INTOABYSS:
 		case BD_SIEGFRIED:
-			if(sc && sc->data[SC_DANCING] && (sc->data[SC_DANCING]->val1&0xFFFF) == skill_id) {
+			if(sc && SC_ENTRY(sc, SC_DANCING) && (SC_ENTRY(sc, SC_DANCING)->val1&0xFFFF) == skill_id) {
 				//Check if you just stepped out of your ensemble skill to cancel dancing. [Skotlex]
 				//We don't check for SC_LONGING because someone could always have knocked you back and out of the song/dance.
 				//FIXME: This code is not perfect, it doesn't checks for the real ensemble's owner,
@@ -15201,7 +15193,7 @@ static int skill_unit_onleft(uint16 skill_id, struct block_list *bl, int64 tick)
 			if (sce) {
 				status_change_end(bl, type, INVALID_TIMER);
 				nullpo_retb(sc);
-				if ((sce = sc->data[SC_BLIND])) {
+				if ((sce = SC_ENTRY(sc, SC_BLIND))) {
 					if (bl->type == BL_PC) //Players get blind ended immediately, others have it still for 30 secs. [Skotlex]
 						status_change_end(bl, SC_BLIND, INVALID_TIMER);
 					else {
@@ -15340,7 +15332,7 @@ static int skill_check_condition_char_sub(struct block_list *bl, va_list ap)
 	if(pc_isdead(tsd))
 		return 0;
 
-	if (tsd->sc.data[SC_SILENCE] || tsd->sc.data[SC_ENSEMBLEFATIGUE] || ( tsd->sc.opt1 && tsd->sc.opt1 != OPT1_BURNING ))
+	if (SC_ENTRY(&tsd->sc, SC_SILENCE) || SC_ENTRY(&tsd->sc, SC_ENSEMBLEFATIGUE) || ( tsd->sc.opt1 && tsd->sc.opt1 != OPT1_BURNING ))
 		return 0;
 
 	if( skill->get_inf2(skill_id)&INF2_CHORUS_SKILL ) {
@@ -15371,7 +15363,7 @@ static int skill_check_condition_char_sub(struct block_list *bl, va_list ap)
 				p_sd[(*c)++] = tsd->bl.id;
 			return 1;
 		case LG_RAYOFGENESIS:
-			if (tsd->status.party_id == sd->status.party_id && (tsd->job & MAPID_THIRDMASK) == MAPID_ROYAL_GUARD && tsd->sc.data[SC_BANDING])
+			if (tsd->status.party_id == sd->status.party_id && (tsd->job & MAPID_THIRDMASK) == MAPID_ROYAL_GUARD && SC_ENTRY(&tsd->sc, SC_BANDING))
 				p_sd[(*c)++] = tsd->bl.id;
 			return 1;
 		default: //Warning: Assuming Ensemble Dance/Songs for code speed. [Skotlex]
@@ -15391,7 +15383,7 @@ static int skill_check_condition_char_sub(struct block_list *bl, va_list ap)
 						(tsd->weapontype1==W_MUSICAL || tsd->weapontype1==W_WHIP) &&
 						sd->status.party_id && tsd->status.party_id &&
 						sd->status.party_id == tsd->status.party_id &&
-						!tsd->sc.data[SC_DANCING])
+						!SC_ENTRY(&tsd->sc, SC_DANCING))
 				{
 					p_sd[(*c)++]=tsd->bl.id;
 					return skill_lv;
@@ -15439,9 +15431,9 @@ static int skill_check_pc_partner(struct map_session_data *sd, uint16 skill_id,
 				if( is_chorus )
 					break;//Chorus skills are not to be parsed as ensambles
 #ifndef RENEWAL
-				if (c > 0 && sd->sc.data[SC_DANCING] && (tsd = map->id2sd(p_sd[0])) != NULL) {
-					sd->sc.data[SC_DANCING]->val4 = tsd->bl.id;
-					sc_start4(&tsd->bl, &tsd->bl, SC_DANCING, 100, skill_id, sd->sc.data[SC_DANCING]->val2, *skill_lv, sd->bl.id, skill->get_time(skill_id, *skill_lv) + 1000, skill_id);
+				if (c > 0 && SC_ENTRY(&sd->sc, SC_DANCING) && (tsd = map->id2sd(p_sd[0])) != NULL) {
+					SC_ENTRY(&sd->sc, SC_DANCING)->val4 = tsd->bl.id;
+					sc_start4(&tsd->bl, &tsd->bl, SC_DANCING, 100, skill_id, SC_ENTRY(&sd->sc, SC_DANCING)->val2, *skill_lv, sd->bl.id, skill->get_time(skill_id, *skill_lv) + 1000, skill_id);
 					clif->skill_nodamage(&tsd->bl, &sd->bl, skill_id, *skill_lv, 1);
 					tsd->skill_id_dance = skill_id;
 					tsd->skill_lv_dance = *skill_lv;
@@ -15672,7 +15664,7 @@ static int skill_check_condition_castbegin(struct map_session_data *sd, uint16 s
 		return 0;
 	}
 
-	if( sc && ( sc->data[SC__SHADOWFORM] || sc->data[SC__IGNORANCE] ) )
+	if( sc && ( SC_ENTRY(sc, SC__SHADOWFORM) || SC_ENTRY(sc, SC__IGNORANCE) ) )
 		return 0;
 
 	PRAGMA_GCC46(GCC diagnostic push)
@@ -15704,7 +15696,7 @@ static int skill_check_condition_castbegin(struct map_session_data *sd, uint16 s
 		case SJ_UNIVERSESTANCE:
 		case SJ_SUNSTANCE:
 		case SP_SOULCOLLECT:
-			if (sc && sc->data[skill->get_sc_type(skill_id)])
+			if (sc && SC_ENTRY(sc, skill->get_sc_type(skill_id)))
 				return 1;
 			FALLTHROUGH
 		default:
@@ -15846,8 +15838,8 @@ static int skill_check_condition_castbegin(struct map_session_data *sd, uint16 s
 			}
 			break;
 		case MO_CALLSPIRITS:
-			if(sc && sc->data[SC_RAISINGDRAGON])
-				skill_lv += sc->data[SC_RAISINGDRAGON]->val1;
+			if(sc && SC_ENTRY(sc, SC_RAISINGDRAGON))
+				skill_lv += SC_ENTRY(sc, SC_RAISINGDRAGON)->val1;
 			if(sd->spiritball >= skill_lv) {
 				clif->skill_fail(sd, skill_id, USESKILL_FAIL_LEVEL, 0, 0);
 				return 0;
@@ -15865,10 +15857,10 @@ static int skill_check_condition_castbegin(struct map_session_data *sd, uint16 s
 		case MO_CHAINCOMBO:
 			if(!sc)
 				return 0;
-			if(sc->data[SC_BLADESTOP])
+			if(SC_ENTRY(sc, SC_BLADESTOP))
 				break;
-			if (sc->data[SC_COMBOATTACK]) {
-				if( sc->data[SC_COMBOATTACK]->val1 == MO_TRIPLEATTACK )
+			if (SC_ENTRY(sc, SC_COMBOATTACK)) {
+				if( SC_ENTRY(sc, SC_COMBOATTACK)->val1 == MO_TRIPLEATTACK )
 					break;
 				clif->skill_fail(sd, skill_id, USESKILL_FAIL_COMBOSKILL, MO_TRIPLEATTACK, 0);
 			}
@@ -15876,8 +15868,8 @@ static int skill_check_condition_castbegin(struct map_session_data *sd, uint16 s
 		case MO_COMBOFINISH:
 			if(!sc)
 				return 0;
-			if( sc && sc->data[SC_COMBOATTACK] ) {
-				if ( sc->data[SC_COMBOATTACK]->val1 == MO_CHAINCOMBO )
+			if( sc && SC_ENTRY(sc, SC_COMBOATTACK) ) {
+				if ( SC_ENTRY(sc, SC_COMBOATTACK)->val1 == MO_CHAINCOMBO )
 					break;
 				clif->skill_fail(sd, skill_id, USESKILL_FAIL_COMBOSKILL, MO_CHAINCOMBO, 0);
 			}
@@ -15885,8 +15877,8 @@ static int skill_check_condition_castbegin(struct map_session_data *sd, uint16 s
 		case CH_TIGERFIST:
 			if(!sc)
 				return 0;
-			if( sc && sc->data[SC_COMBOATTACK] ) {
-				if ( sc->data[SC_COMBOATTACK]->val1 == MO_COMBOFINISH )
+			if( sc && SC_ENTRY(sc, SC_COMBOATTACK) ) {
+				if ( SC_ENTRY(sc, SC_COMBOATTACK)->val1 == MO_COMBOFINISH )
 					break;
 				clif->skill_fail(sd, skill_id, USESKILL_FAIL_COMBOSKILL, MO_COMBOFINISH, 0);
 			}
@@ -15894,24 +15886,24 @@ static int skill_check_condition_castbegin(struct map_session_data *sd, uint16 s
 		case CH_CHAINCRUSH:
 			if(!sc)
 				return 0;
-			if( sc && sc->data[SC_COMBOATTACK] ) {
-				if (sc->data[SC_COMBOATTACK]->val1 == CH_TIGERFIST || sc->data[SC_COMBOATTACK]->val1 == MO_COMBOFINISH)
+			if( sc && SC_ENTRY(sc, SC_COMBOATTACK) ) {
+				if (SC_ENTRY(sc, SC_COMBOATTACK)->val1 == CH_TIGERFIST || SC_ENTRY(sc, SC_COMBOATTACK)->val1 == MO_COMBOFINISH)
 					break;
 				//clif->skill_fail(sd, skill_id, USESKILL_FAIL_COMBOSKILL, CH_TIGERFIST, 0);
 			}
 			return 0;
 		case MO_EXTREMITYFIST:
 #if 0 //To disable Asura during the 5 min skill block uncomment this block...
-			if(sc && sc->data[SC_EXTREMITYFIST])
+			if(sc && SC_ENTRY(sc, SC_EXTREMITYFIST))
 				return 0;
 #endif // 0
 #ifdef RENEWAL
 			sd->spiritball_old = sd->spiritball;
 #endif
-			if (sc && (sc->data[SC_BLADESTOP] || sc->data[SC_CURSEDCIRCLE_ATKER]))
+			if (sc && (SC_ENTRY(sc, SC_BLADESTOP) || SC_ENTRY(sc, SC_CURSEDCIRCLE_ATKER)))
 				break;
-			if (sc && sc->data[SC_COMBOATTACK]) {
-				switch(sc->data[SC_COMBOATTACK]->val1) {
+			if (sc && SC_ENTRY(sc, SC_COMBOATTACK)) {
+				switch(SC_ENTRY(sc, SC_COMBOATTACK)->val1) {
 					case MO_COMBOFINISH:
 					case CH_TIGERFIST:
 					case CH_CHAINCRUSH:
@@ -15952,17 +15944,17 @@ static int skill_check_condition_castbegin(struct map_session_data *sd, uint16 s
 		case TK_COUNTER:
 			if ((sd->job & MAPID_UPPERMASK) == MAPID_SOUL_LINKER)
 				return 0; //Anti-Soul Linker check in case you job-changed with Stances active.
-			if(!(sc && sc->data[SC_COMBOATTACK]) || sc->data[SC_COMBOATTACK]->val1 == TK_JUMPKICK)
+			if(!(sc && SC_ENTRY(sc, SC_COMBOATTACK)) || SC_ENTRY(sc, SC_COMBOATTACK)->val1 == TK_JUMPKICK)
 				return 0; //Combo needs to be ready
 
-			if (sc->data[SC_COMBOATTACK]->val3) { //Kick chain
+			if (SC_ENTRY(sc, SC_COMBOATTACK)->val3) { //Kick chain
 				//Do not repeat a kick.
-				if (sc->data[SC_COMBOATTACK]->val3 != skill_id)
+				if (SC_ENTRY(sc, SC_COMBOATTACK)->val3 != skill_id)
 					break;
 				status_change_end(&sd->bl, SC_COMBOATTACK, INVALID_TIMER);
 				return 0;
 			}
-			if (sc->data[SC_COMBOATTACK]->val1 != skill_id
+			if (SC_ENTRY(sc, SC_COMBOATTACK)->val1 != skill_id
 			 && !(sd != NULL && sd->status.base_level >= 90 && pc->fame_rank(sd->status.char_id, RANKTYPE_TAEKWON) > 0)) {
 				//Cancel combo wait.
 				unit->cancel_combo(&sd->bl);
@@ -15972,15 +15964,15 @@ static int skill_check_condition_castbegin(struct map_session_data *sd, uint16 s
 
 #ifndef RENEWAL
 		case BD_ADAPTATION: {
-			if (sc == NULL || sc->data[SC_DANCING] == NULL) {
+			if (sc == NULL || SC_ENTRY(sc, SC_DANCING) == NULL) {
 				clif->skill_fail(sd, skill_id, USESKILL_FAIL_LEVEL, 0, 0);
 				return 0;
 			}
 
-			int time = 1000 * (sc->data[SC_DANCING]->val3 >> 16);
+			int time = 1000 * (SC_ENTRY(sc, SC_DANCING)->val3 >> 16);
 
-			int dance_skill_id = (sc->data[SC_DANCING]->val1 & 0xFFFF);
-			int dance_skill_lv = (sc->data[SC_DANCING]->val1 >> 16);
+			int dance_skill_id = (SC_ENTRY(sc, SC_DANCING)->val1 & 0xFFFF);
+			int dance_skill_lv = (SC_ENTRY(sc, SC_DANCING)->val1 >> 16);
 			int dance_duration = skill->get_time(dance_skill_id, dance_skill_lv);
 
 			int interrupt_ticks = skill->get_time2(skill_id, skill_lv);
@@ -16002,12 +15994,12 @@ static int skill_check_condition_castbegin(struct map_session_data *sd, uint16 s
 			break;
 
 		case SL_SMA:
-			if(!(sc != NULL && (sc->data[SC_SMA_READY] != NULL || sc->data[SC_USE_SKILL_SP_SHA] != NULL)))
+			if(!(sc != NULL && (SC_ENTRY(sc, SC_SMA_READY) != NULL || SC_ENTRY(sc, SC_USE_SKILL_SP_SHA) != NULL)))
 				return 0;
 			break;
 
 		case HT_POWER:
-			if(!(sc && sc->data[SC_COMBOATTACK] && sc->data[SC_COMBOATTACK]->val1 == skill_id))
+			if(!(sc && SC_ENTRY(sc, SC_COMBOATTACK) && SC_ENTRY(sc, SC_COMBOATTACK)->val1 == skill_id))
 				return 0;
 			break;
 
@@ -16053,7 +16045,7 @@ static int skill_check_condition_castbegin(struct map_session_data *sd, uint16 s
 		case SG_SUN_WARM:
 		case SG_MOON_WARM:
 		case SG_STAR_WARM:
-			if (sc && sc->data[SC_MIRACLE])
+			if (sc && SC_ENTRY(sc, SC_MIRACLE))
 				break;
 			if (sd->bl.m == sd->feel_map[skill_id-SG_SUN_WARM].m)
 				break;
@@ -16063,7 +16055,7 @@ static int skill_check_condition_castbegin(struct map_session_data *sd, uint16 s
 		case SG_SUN_COMFORT:
 		case SG_MOON_COMFORT:
 		case SG_STAR_COMFORT:
-			if (sc && sc->data[SC_MIRACLE])
+			if (sc && SC_ENTRY(sc, SC_MIRACLE))
 				break;
 			if (sd->bl.m == sd->feel_map[skill_id-SG_SUN_COMFORT].m &&
 				(battle_config.allow_skill_without_day || pc->sg_info[skill_id-SG_SUN_COMFORT].day_func()))
@@ -16071,7 +16063,7 @@ static int skill_check_condition_castbegin(struct map_session_data *sd, uint16 s
 			clif->skill_fail(sd, skill_id, USESKILL_FAIL_LEVEL, 0, 0);
 			return 0;
 		case SG_FUSION:
-			if (sc && sc->data[SC_SOULLINK] && sc->data[SC_SOULLINK]->val2 == SL_STAR)
+			if (sc && SC_ENTRY(sc, SC_SOULLINK) && SC_ENTRY(sc, SC_SOULLINK)->val2 == SL_STAR)
 				break;
 			//Auron insists we should implement SP consumption when you are not Soul Linked. [Skotlex]
 			//Only invoke on skill begin cast (instant cast skill). [Kevin]
@@ -16115,7 +16107,7 @@ static int skill_check_condition_castbegin(struct map_session_data *sd, uint16 s
 			}
 			FALLTHROUGH
 		case NJ_BUNSINJYUTSU:
-			if (!(sc && sc->data[SC_NJ_NEN])) {
+			if (!(sc && SC_ENTRY(sc, SC_NJ_NEN))) {
 				clif->skill_fail(sd, skill_id, USESKILL_FAIL_LEVEL, 0, 0);
 				return 0;
 			}
@@ -16190,7 +16182,7 @@ static int skill_check_condition_castbegin(struct map_session_data *sd, uint16 s
 			{
 				int j, i = 0;
 				for(j = SC_SUMMON1; j <= SC_SUMMON5; j++)
-					if( sc && sc->data[j] )
+					if( sc && SC_ENTRY(sc, j) )
 						i++;
 
 				switch(skill_id){
@@ -16202,7 +16194,7 @@ static int skill_check_condition_castbegin(struct map_session_data *sd, uint16 s
 						break;
 					case WL_RELEASE:
 						for(j = SC_SPELLBOOK7; j >= SC_SPELLBOOK1; j--)
-							if( sc && sc->data[j] )
+							if( sc && SC_ENTRY(sc, j) )
 								i++;
 						if( i == 0 ){
 							clif->skill_fail(sd, skill_id, USESKILL_FAIL_SUMMON_NONE, 0, 0);
@@ -16221,14 +16213,14 @@ static int skill_check_condition_castbegin(struct map_session_data *sd, uint16 s
 		 * Guilotine Cross
 		 **/
 		case GC_HALLUCINATIONWALK:
-			if( sc && (sc->data[SC_HALLUCINATIONWALK] || sc->data[SC_HALLUCINATIONWALK_POSTDELAY]) ) {
+			if( sc && (SC_ENTRY(sc, SC_HALLUCINATIONWALK) || SC_ENTRY(sc, SC_HALLUCINATIONWALK_POSTDELAY)) ) {
 				clif->skill_fail(sd, skill_id, USESKILL_FAIL_LEVEL, 0, 0);
 				return 0;
 			}
 			break;
 		case GC_COUNTERSLASH:
 		case GC_WEAPONCRUSH:
-			if( !(sc && sc->data[SC_COMBOATTACK] && sc->data[SC_COMBOATTACK]->val1 == GC_WEAPONBLOCKING) ) {
+			if( !(sc && SC_ENTRY(sc, SC_COMBOATTACK) && SC_ENTRY(sc, SC_COMBOATTACK)->val1 == GC_WEAPONBLOCKING) ) {
 				clif->skill_fail(sd, skill_id, USESKILL_FAIL_GC_WEAPONBLOCKING, 0, 0);
 				return 0;
 			}
@@ -16237,8 +16229,8 @@ static int skill_check_condition_castbegin(struct map_session_data *sd, uint16 s
 		 * Ranger
 		 **/
 		case RA_WUGMASTERY:
-			if( pc_isfalcon(sd) || pc_isridingwug(sd) || sd->sc.data[SC__GROOMY] ) {
-				clif->skill_fail(sd, skill_id, sd->sc.data[SC__GROOMY] ? USESKILL_FAIL_MANUAL_NOTIFY : USESKILL_FAIL_CONDITION, 0, 0);
+			if( pc_isfalcon(sd) || pc_isridingwug(sd) || SC_ENTRY(&sd->sc, SC__GROOMY) ) {
+				clif->skill_fail(sd, skill_id, SC_ENTRY(&sd->sc, SC__GROOMY) ? USESKILL_FAIL_MANUAL_NOTIFY : USESKILL_FAIL_CONDITION, 0, 0);
 				return 0;
 			}
 			break;
@@ -16264,38 +16256,38 @@ static int skill_check_condition_castbegin(struct map_session_data *sd, uint16 s
 		 * Royal Guard
 		 **/
 		case LG_BANDING:
-			if( sc && sc->data[SC_INSPIRATION] ) {
+			if( sc && SC_ENTRY(sc, SC_INSPIRATION) ) {
 				clif->skill_fail(sd, skill_id, USESKILL_FAIL_LEVEL, 0, 0);
 				return 0;
 			}
 			break;
 		case LG_PRESTIGE:
-			if( sc && (sc->data[SC_BANDING] || sc->data[SC_INSPIRATION]) ) {
+			if( sc && (SC_ENTRY(sc, SC_BANDING) || SC_ENTRY(sc, SC_INSPIRATION)) ) {
 				clif->skill_fail(sd, skill_id, USESKILL_FAIL_LEVEL, 0, 0);
 				return 0;
 			}
 			break;
 		case LG_RAYOFGENESIS:
 		case LG_HESPERUSLIT:
-			if( sc && sc->data[SC_INSPIRATION]  )
+			if( sc && SC_ENTRY(sc, SC_INSPIRATION)  )
 				return 1; // Don't check for partner.
-			if( !(sc && sc->data[SC_BANDING]) ) {
+			if( !(sc && SC_ENTRY(sc, SC_BANDING)) ) {
 				clif->skill_fail(sd, skill_id, USESKILL_FAIL, 0, 0);
 				return 0;
 			}
-			if( sc->data[SC_BANDING] &&
-				sc->data[SC_BANDING]->val2 < (skill_id == LG_RAYOFGENESIS ? 2 : 3) )
+			if( SC_ENTRY(sc, SC_BANDING) &&
+				SC_ENTRY(sc, SC_BANDING)->val2 < (skill_id == LG_RAYOFGENESIS ? 2 : 3) )
 				return 0; // Just fails, no msg here.
 			break;
 		case SR_FALLENEMPIRE:
-			if( sc && sc->data[SC_COMBOATTACK] ) {
-				if( sc->data[SC_COMBOATTACK]->val1 == SR_DRAGONCOMBO )
+			if( sc && SC_ENTRY(sc, SC_COMBOATTACK) ) {
+				if( SC_ENTRY(sc, SC_COMBOATTACK)->val1 == SR_DRAGONCOMBO )
 					break;
 				clif->skill_fail(sd, skill_id, USESKILL_FAIL_COMBOSKILL, SR_DRAGONCOMBO, 0);
 			}
 			return 0;
 		case SR_CRESCENTELBOW:
-			if( sc && sc->data[SC_CRESCENTELBOW] ) {
+			if( sc && SC_ENTRY(sc, SC_CRESCENTELBOW) ) {
 				clif->skill_fail(sd, skill_id, USESKILL_FAIL_DUPLICATE, 0, 0);
 				return 0;
 			}
@@ -16323,7 +16315,7 @@ static int skill_check_condition_castbegin(struct map_session_data *sd, uint16 s
 			break;
 		case SC_MANHOLE:
 		case SC_DIMENSIONDOOR:
-			if( sc && sc->data[SC_MAGNETICFIELD] ) {
+			if( sc && SC_ENTRY(sc, SC_MAGNETICFIELD) ) {
 				clif->skill_fail(sd, skill_id, USESKILL_FAIL_LEVEL, 0, 0);
 				return 0;
 			}
@@ -16340,8 +16332,8 @@ static int skill_check_condition_castbegin(struct map_session_data *sd, uint16 s
 			break;
 		case SO_FIREWALK:
 		case SO_ELECTRICWALK: // Can't be casted until you've walked all cells.
-			if( sc && sc->data[SC_PROPERTYWALK] &&
-			   sc->data[SC_PROPERTYWALK]->val3 < skill->get_maxcount(sc->data[SC_PROPERTYWALK]->val1,sc->data[SC_PROPERTYWALK]->val2) ) {
+			if( sc && SC_ENTRY(sc, SC_PROPERTYWALK) &&
+			   SC_ENTRY(sc, SC_PROPERTYWALK)->val3 < skill->get_maxcount(SC_ENTRY(sc, SC_PROPERTYWALK)->val1,SC_ENTRY(sc, SC_PROPERTYWALK)->val2) ) {
 				clif->skill_fail(sd, skill_id, USESKILL_FAIL_LEVEL, 0, 0);
 				return 0;
 			}
@@ -16359,7 +16351,7 @@ static int skill_check_condition_castbegin(struct map_session_data *sd, uint16 s
 			}
 			break;
 		case CR_REFLECTSHIELD:
-			if( sc && sc->data[SC_KYOMU] && rnd()%100 < 5 * sc->data[SC_KYOMU]->val1 ){
+			if( sc && SC_ENTRY(sc, SC_KYOMU) && rnd()%100 < 5 * SC_ENTRY(sc, SC_KYOMU)->val1 ){
 				clif->skill_fail(sd, skill_id, USESKILL_FAIL_LEVEL, 0, 0);
 				return 0;
 			}
@@ -16389,13 +16381,13 @@ static int skill_check_condition_castbegin(struct map_session_data *sd, uint16 s
 			}
 			break;
 		case SJ_FULLMOONKICK:
-			if (!(sc != NULL && sc->data[SC_NEWMOON] != NULL)) {
+			if (!(sc != NULL && SC_ENTRY(sc, SC_NEWMOON) != NULL)) {
 				clif->skill_fail(sd, skill_id, USESKILL_FAIL_LEVEL, 0, 0);
 				return 0;
 			}
 			break;
 		case SJ_SOLARBURST:
-			if( !(sc != NULL && sc->data[SC_COMBOATTACK] != NULL && sc->data[SC_COMBOATTACK]->val1 == SJ_PROMINENCEKICK) ) {
+			if( !(sc != NULL && SC_ENTRY(sc, SC_COMBOATTACK) != NULL && SC_ENTRY(sc, SC_COMBOATTACK)->val1 == SJ_PROMINENCEKICK) ) {
 				clif->skill_fail(sd, skill_id, USESKILL_FAIL_COMBOSKILL, SJ_PROMINENCEKICK, 0);
 				return 0;
 			}
@@ -16413,7 +16405,7 @@ static int skill_check_condition_castbegin(struct map_session_data *sd, uint16 s
 			}
 			break;
 		case SP_SWHOO:
-			if (!(sc != NULL && sc->data[SC_USE_SKILL_SP_SPA] != NULL))
+			if (!(sc != NULL && SC_ENTRY(sc, SC_USE_SKILL_SP_SPA) != NULL))
 				return 0;
 			break;
 		case SP_KAUTE: // Fail if below 30% MaxHP.
@@ -16465,7 +16457,7 @@ static int skill_check_condition_castbegin(struct map_session_data *sd, uint16 s
 			}
 			break;
 		case ST_CARTBOOST:
-			if(!(sc && sc->data[SC_CARTBOOST])) {
+			if(!(sc && SC_ENTRY(sc, SC_CARTBOOST))) {
 				clif->skill_fail(sd, skill_id, USESKILL_FAIL_LEVEL, 0, 0);
 				return 0;
 			}
@@ -16483,13 +16475,13 @@ static int skill_check_condition_castbegin(struct map_session_data *sd, uint16 s
 			}
 			break;
 		case ST_SIGHT:
-			if(!(sc && sc->data[SC_SIGHT])) {
+			if(!(sc && SC_ENTRY(sc, SC_SIGHT))) {
 				clif->skill_fail(sd, skill_id, USESKILL_FAIL_LEVEL, 0, 0);
 				return 0;
 			}
 			break;
 		case ST_EXPLOSIONSPIRITS:
-			if(!(sc && sc->data[SC_EXPLOSIONSPIRITS])) {
+			if(!(sc && SC_ENTRY(sc, SC_EXPLOSIONSPIRITS))) {
 				clif->skill_fail(sd, skill_id, USESKILL_FAIL_EXPLOSIONSPIRITS, 0, 0);
 				return 0;
 			}
@@ -16501,7 +16493,7 @@ static int skill_check_condition_castbegin(struct map_session_data *sd, uint16 s
 			}
 			break;
 		case ST_MOVE_ENABLE:
-			if (sc && sc->data[SC_COMBOATTACK] && sc->data[SC_COMBOATTACK]->val1 == skill_id)
+			if (sc && SC_ENTRY(sc, SC_COMBOATTACK) && SC_ENTRY(sc, SC_COMBOATTACK)->val1 == skill_id)
 				sd->ud.canmove_tick = timer->gettick(); //When using a combo, cancel the can't move delay to enable the skill. [Skotlex]
 
 			if (!unit->can_move(&sd->bl)) {
@@ -16510,7 +16502,7 @@ static int skill_check_condition_castbegin(struct map_session_data *sd, uint16 s
 			}
 			break;
 		case ST_WATER:
-			if (sc && (sc->data[SC_DELUGE] || sc->data[SC_NJ_SUITON]))
+			if (sc && (SC_ENTRY(sc, SC_DELUGE) || SC_ENTRY(sc, SC_NJ_SUITON)))
 				break;
 			if (map->getcell(sd->bl.m, &sd->bl, sd->bl.x, sd->bl.y, CELL_CHKWATER))
 				break;
@@ -16547,25 +16539,25 @@ static int skill_check_condition_castbegin(struct map_session_data *sd, uint16 s
 			}
 			break;
 		case ST_POISONINGWEAPON:
-			if (!(sc && sc->data[SC_POISONINGWEAPON])) {
+			if (!(sc && SC_ENTRY(sc, SC_POISONINGWEAPON))) {
 				clif->skill_fail(sd, skill_id, USESKILL_FAIL_GC_POISONINGWEAPON, 0, 0);
 				return 0;
 			}
 			break;
 		case ST_ROLLINGCUTTER:
-			if (!(sc && sc->data[SC_ROLLINGCUTTER])) {
+			if (!(sc && SC_ENTRY(sc, SC_ROLLINGCUTTER))) {
 				clif->skill_fail(sd, skill_id, USESKILL_FAIL_CONDITION, 0, 0);
 				return 0;
 			}
 			break;
 		case ST_MH_FIGHTING:
-			if (!(sc && sc->data[SC_STYLE_CHANGE] && sc->data[SC_STYLE_CHANGE]->val2 == MH_MD_FIGHTING)){
+			if (!(sc && SC_ENTRY(sc, SC_STYLE_CHANGE) && SC_ENTRY(sc, SC_STYLE_CHANGE)->val2 == MH_MD_FIGHTING)){
 				clif->skill_fail(sd, skill_id, USESKILL_FAIL_LEVEL, 0, 0);
 				return 0;
 			}
 			FALLTHROUGH
 		case ST_MH_GRAPPLING:
-			if (!(sc && sc->data[SC_STYLE_CHANGE] && sc->data[SC_STYLE_CHANGE]->val2 == MH_MD_GRAPPLING)){
+			if (!(sc && SC_ENTRY(sc, SC_STYLE_CHANGE) && SC_ENTRY(sc, SC_STYLE_CHANGE)->val2 == MH_MD_GRAPPLING)){
 				clif->skill_fail(sd, skill_id, USESKILL_FAIL_LEVEL, 0, 0);
 				return 0;
 			}
@@ -16577,31 +16569,31 @@ static int skill_check_condition_castbegin(struct map_session_data *sd, uint16 s
 			}
 			break;
 		case ST_QD_SHOT_READY:
-			if (!(sc != NULL && sc->data[SC_QD_SHOT_READY])) {
+			if (!(sc != NULL && SC_ENTRY(sc, SC_QD_SHOT_READY))) {
 				clif->skill_fail(sd, skill_id, USESKILL_FAIL_LEVEL, 0, 0);
 				return 0;
 			}
 			break;
 		case ST_SUNSTANCE:
-			if (!(sc != NULL && (sc->data[SC_SUNSTANCE] != NULL || sc->data[SC_UNIVERSESTANCE] != NULL))) {
+			if (!(sc != NULL && (SC_ENTRY(sc, SC_SUNSTANCE) != NULL || SC_ENTRY(sc, SC_UNIVERSESTANCE) != NULL))) {
 				clif->skill_fail(sd, skill_id, USESKILL_FAIL_LEVEL, 0, 0);
 				return 0;
 			}
 			break;
 		case ST_MOONSTANCE:
-			if (!(sc != NULL && (sc->data[SC_LUNARSTANCE] != NULL || sc->data[SC_UNIVERSESTANCE] != NULL))) {
+			if (!(sc != NULL && (SC_ENTRY(sc, SC_LUNARSTANCE) != NULL || SC_ENTRY(sc, SC_UNIVERSESTANCE) != NULL))) {
 				clif->skill_fail(sd, skill_id, USESKILL_FAIL_LEVEL, 0, 0);
 				return 0;
 			}
 			break;
 		case ST_STARSTANCE:
-			if (!(sc != NULL && (sc->data[SC_STARSTANCE] != NULL || sc->data[SC_UNIVERSESTANCE] != NULL))) {
+			if (!(sc != NULL && (SC_ENTRY(sc, SC_STARSTANCE) != NULL || SC_ENTRY(sc, SC_UNIVERSESTANCE) != NULL))) {
 				clif->skill_fail(sd, skill_id, USESKILL_FAIL_LEVEL, 0, 0);
 				return 0;
 			}
 			break;
 		case ST_UNIVERSESTANCE:
-			if (!(sc != NULL && sc->data[SC_UNIVERSESTANCE] != NULL)) {
+			if (!(sc != NULL && SC_ENTRY(sc, SC_UNIVERSESTANCE) != NULL)) {
 				clif->skill_fail(sd, skill_id, USESKILL_FAIL_LEVEL, 0, 0);
 				return 0;
 			}
@@ -16678,7 +16670,7 @@ static int skill_check_condition_castbegin(struct map_session_data *sd, uint16 s
 	// There's no need to check if the skill is part of a combo if it's
 	// already been checked before, see unit_skilluse_id2 [Panikon]
 	// Note that if this check is read part of issue:8047 will reappear!
-	if( sd->sc.data[SC_COMBOATTACK] && !skill->is_combo(skill_id ) )
+	if( SC_ENTRY(&sd->sc, SC_COMBOATTACK) && !skill->is_combo(skill_id ) )
 		return 0;
 #endif // 0
 
@@ -17097,7 +17089,7 @@ static int skill_consume_requirement(struct map_session_data *sd, uint16 skill_i
 				req.sp = 0;
 				break;
 			case WZ_EARTHSPIKE:
-				if (sd->sc.count > 0 && sd->sc.data[SC_EARTHSCROLL] != NULL) // If Earth Spike Scroll is used while SC_EARTHSCROLL is active, 10 SP are consumed. [Kenpachi]
+				if (sd->sc.count > 0 && SC_ENTRY(&sd->sc, SC_EARTHSCROLL) != NULL) // If Earth Spike Scroll is used while SC_EARTHSCROLL is active, 10 SP are consumed. [Kenpachi]
 					req.sp = 10;
 
 				break;
@@ -17166,27 +17158,27 @@ static int skill_consume_requirement(struct map_session_data *sd, uint16 skill_i
 			if (any_item_index != INDEX_NOT_FOUND && any_item_index != i)
 				continue;
 
-			if( itemid_isgemstone(req.itemid[i]) && skill_id != HW_GANBANTEIN && sc && sc->data[SC_SOULLINK] && sc->data[SC_SOULLINK]->val2 == SL_WIZARD )
+			if( itemid_isgemstone(req.itemid[i]) && skill_id != HW_GANBANTEIN && sc && SC_ENTRY(sc, SC_SOULLINK) && SC_ENTRY(sc, SC_SOULLINK)->val2 == SL_WIZARD )
 				continue; //Gemstones are checked, but not subtracted from inventory.
 
 			switch( skill_id ){
 				case SA_SEISMICWEAPON:
-					if( sc && sc->data[SC_UPHEAVAL_OPTION] && rnd()%100 < 50 )
+					if( sc && SC_ENTRY(sc, SC_UPHEAVAL_OPTION) && rnd()%100 < 50 )
 						continue;
 					break;
 				case SA_FLAMELAUNCHER:
 				case SA_VOLCANO:
-					if( sc && sc->data[SC_TROPIC_OPTION] && rnd()%100 < 50 )
+					if( sc && SC_ENTRY(sc, SC_TROPIC_OPTION) && rnd()%100 < 50 )
 						continue;
 					break;
 				case SA_FROSTWEAPON:
 				case SA_DELUGE:
-					if( sc && sc->data[SC_CHILLY_AIR_OPTION] && rnd()%100 < 50 )
+					if( sc && SC_ENTRY(sc, SC_CHILLY_AIR_OPTION) && rnd()%100 < 50 )
 						continue;
 					break;
 				case SA_LIGHTNINGLOADER:
 				case SA_VIOLENTGALE:
-					if( sc && sc->data[SC_WILD_STORM_OPTION] && rnd()%100 < 50 )
+					if( sc && SC_ENTRY(sc, SC_WILD_STORM_OPTION) && rnd()%100 < 50 )
 						continue;
 					break;
 			}
@@ -17241,7 +17233,7 @@ static struct skill_condition skill_get_requirement(struct map_session_data *sd,
 		case SJ_STARSTANCE:
 		case SJ_UNIVERSESTANCE:
 		case SJ_SUNSTANCE:
-			if (sc && sc->data[skill->get_sc_type(skill_id)])
+			if (sc && SC_ENTRY(sc, skill->get_sc_type(skill_id)))
 				return req;
 			/* Fall through */
 		default:
@@ -17286,28 +17278,28 @@ static struct skill_condition skill_get_requirement(struct map_session_data *sd,
 	req.sp = cap_value(req.sp * sp_skill_rate_bonus / 100, 0, SHRT_MAX);
 
 	if (sc) {
-		if (sc->data[SC__LAZINESS])
-			req.sp += req.sp + sc->data[SC__LAZINESS]->val1 * 10;
-		if (sc->data[SC_UNLIMITED_HUMMING_VOICE])
-			req.sp += req.sp * sc->data[SC_UNLIMITED_HUMMING_VOICE]->val3 / 100;
-		if (sc->data[SC_RECOGNIZEDSPELL])
+		if (SC_ENTRY(sc, SC__LAZINESS))
+			req.sp += req.sp + SC_ENTRY(sc, SC__LAZINESS)->val1 * 10;
+		if (SC_ENTRY(sc, SC_UNLIMITED_HUMMING_VOICE))
+			req.sp += req.sp * SC_ENTRY(sc, SC_UNLIMITED_HUMMING_VOICE)->val3 / 100;
+		if (SC_ENTRY(sc, SC_RECOGNIZEDSPELL))
 			req.sp += req.sp / 4;
-		if (sc->data[SC_TELEKINESIS_INTENSE] && skill->get_ele(skill_id, skill_lv) == ELE_GHOST)
-			req.sp -= req.sp * sc->data[SC_TELEKINESIS_INTENSE]->val2 / 100;
-		if (sc->data[SC_TARGET_ASPD])
-			req.sp -= req.sp * sc->data[SC_TARGET_ASPD]->val1 / 100;
-		if (sc->data[SC_MVPCARD_MISTRESS])
-			req.sp -= req.sp * sc->data[SC_MVPCARD_MISTRESS]->val1 / 100;
+		if (SC_ENTRY(sc, SC_TELEKINESIS_INTENSE) && skill->get_ele(skill_id, skill_lv) == ELE_GHOST)
+			req.sp -= req.sp * SC_ENTRY(sc, SC_TELEKINESIS_INTENSE)->val2 / 100;
+		if (SC_ENTRY(sc, SC_TARGET_ASPD))
+			req.sp -= req.sp * SC_ENTRY(sc, SC_TARGET_ASPD)->val1 / 100;
+		if (SC_ENTRY(sc, SC_MVPCARD_MISTRESS))
+			req.sp -= req.sp * SC_ENTRY(sc, SC_MVPCARD_MISTRESS)->val1 / 100;
 #ifdef RENEWAL
-		if (sc->data[SC_ADAPTATION] && (skill->get_inf2(skill_id) & (INF2_SONG_DANCE | INF2_ENSEMBLE_SKILL)) != 0)
-			req.sp -= req.sp * sc->data[SC_ADAPTATION]->val2 / 100;
+		if (SC_ENTRY(sc, SC_ADAPTATION) && (skill->get_inf2(skill_id) & (INF2_SONG_DANCE | INF2_ENSEMBLE_SKILL)) != 0)
+			req.sp -= req.sp * SC_ENTRY(sc, SC_ADAPTATION)->val2 / 100;
 #endif
 	}
 
 	req.zeny = skill->dbs->db[idx].zeny[skill_lv-1];
 
-	if( sc && sc->data[SC__UNLUCKY] )
-		req.zeny += sc->data[SC__UNLUCKY]->val1 * 500;
+	if( sc && SC_ENTRY(sc, SC__UNLUCKY) )
+		req.zeny += SC_ENTRY(sc, SC__UNLUCKY)->val1 * 500;
 
 	req.spiritball = skill->dbs->db[idx].spiritball[skill_lv-1];
 
@@ -17371,13 +17363,13 @@ static struct skill_condition skill_get_requirement(struct map_session_data *sd,
 				else if (--req.amount[i] < 1)
 					req.amount[i] = 1; // Hocus Pocus always use at least 1 gem
 			}
-			if (sc && sc->data[SC_INTOABYSS]) {
+			if (sc && SC_ENTRY(sc, SC_INTOABYSS)) {
 				if (skill_id != SA_ABRACADABRA)
 					req.itemid[i] = req.amount[i] = 0;
 				else if (--req.amount[i] < 1)
 					req.amount[i] = 1; // Hocus Pocus always use at least 1 gem
 			}
-			if (sc && sc->data[SC_MVPCARD_MISTRESS]) {
+			if (sc && SC_ENTRY(sc, SC_MVPCARD_MISTRESS)) {
 				req.itemid[i] = req.amount[i] = 0;
 			}
 		}
@@ -17400,7 +17392,7 @@ static struct skill_condition skill_get_requirement(struct map_session_data *sd,
 				req.zeny -= req.zeny*10/100;
 			break;
 		case AL_HOLYLIGHT:
-			if(sc && sc->data[SC_SOULLINK] && sc->data[SC_SOULLINK]->val2 == SL_PRIEST)
+			if(sc && SC_ENTRY(sc, SC_SOULLINK) && SC_ENTRY(sc, SC_SOULLINK)->val2 == SL_PRIEST)
 				req.sp *= 5;
 			break;
 		case SL_SMA:
@@ -17424,23 +17416,23 @@ static struct skill_condition skill_get_requirement(struct map_session_data *sd,
 		case MO_COMBOFINISH:
 		case CH_TIGERFIST:
 		case CH_CHAINCRUSH:
-			if(sc && sc->data[SC_SOULLINK] && sc->data[SC_SOULLINK]->val2 == SL_MONK)
+			if(sc && SC_ENTRY(sc, SC_SOULLINK) && SC_ENTRY(sc, SC_SOULLINK)->val2 == SL_MONK)
 				req.sp -= req.sp*25/100; //FIXME: Need real data. this is a custom value.
 			break;
 		case MO_BODYRELOCATION:
-			if( sc && sc->data[SC_EXPLOSIONSPIRITS] )
+			if( sc && SC_ENTRY(sc, SC_EXPLOSIONSPIRITS) )
 				req.spiritball = 0;
 			break;
 		case MO_EXTREMITYFIST:
 			if (sc != NULL) {
-				if (sc->data[SC_BLADESTOP] != NULL) {
+				if (SC_ENTRY(sc, SC_BLADESTOP) != NULL) {
 #ifndef RENEWAL
 					req.spiritball--;
 #else
 					req.spiritball = 1;
 #endif
-				} else if (sc->data[SC_COMBOATTACK] != NULL) {
-					switch (sc->data[SC_COMBOATTACK]->val1) {
+				} else if (SC_ENTRY(sc, SC_COMBOATTACK) != NULL) {
+					switch (SC_ENTRY(sc, SC_COMBOATTACK)->val1) {
 						case MO_COMBOFINISH:
 #ifndef RENEWAL
 							req.spiritball = 4;
@@ -17455,7 +17447,7 @@ static struct skill_condition skill_get_requirement(struct map_session_data *sd,
 							req.spiritball = sd->spiritball?sd->spiritball:1;
 							break;
 					}
-				} else if (sc->data[SC_RAISINGDRAGON] != NULL && sd->spiritball > 5) {
+				} else if (SC_ENTRY(sc, SC_RAISINGDRAGON) != NULL && sd->spiritball > 5) {
 					req.spiritball = sd->spiritball; // must consume all regardless of the amount required
 				}
 			}
@@ -17464,7 +17456,7 @@ static struct skill_condition skill_get_requirement(struct map_session_data *sd,
 			req.spiritball = sd->spiritball?sd->spiritball:15;
 			break;
 		case SR_GATEOFHELL:
-			if( sc && sc->data[SC_COMBOATTACK] && sc->data[SC_COMBOATTACK]->val1 == SR_FALLENEMPIRE )
+			if( sc && SC_ENTRY(sc, SC_COMBOATTACK) && SC_ENTRY(sc, SC_COMBOATTACK)->val1 == SR_FALLENEMPIRE )
 				req.sp -= req.sp * 10 / 100;
 			break;
 		case SO_SUMMON_AGNI:
@@ -17478,7 +17470,7 @@ static struct skill_condition skill_get_requirement(struct map_session_data *sd,
 		}
 			break;
 		case SO_PSYCHIC_WAVE:
-			if( sc && (sc->data[SC_HEATER_OPTION] || sc->data[SC_COOLER_OPTION] || sc->data[SC_BLAST_OPTION] ||  sc->data[SC_CURSED_SOIL_OPTION] ))
+			if( sc && (SC_ENTRY(sc, SC_HEATER_OPTION) || SC_ENTRY(sc, SC_COOLER_OPTION) || SC_ENTRY(sc, SC_BLAST_OPTION) ||  SC_ENTRY(sc, SC_CURSED_SOIL_OPTION) ))
 				req.sp += req.sp * 150 / 100;
 			break;
 		default:
@@ -17569,26 +17561,26 @@ static int skill_castfix_sc(struct block_list *bl, int time)
 		return time;
 
 	if (sc && sc->count) {
-		if (sc->data[SC_SLOWCAST])
-			time += time * sc->data[SC_SLOWCAST]->val2 / 100;
-		if (sc->data[SC_NEEDLE_OF_PARALYZE])
-			time += sc->data[SC_NEEDLE_OF_PARALYZE]->val3;
-		if (sc->data[SC_SUFFRAGIUM]) {
-			time -= time * sc->data[SC_SUFFRAGIUM]->val2 / 100;
+		if (SC_ENTRY(sc, SC_SLOWCAST))
+			time += time * SC_ENTRY(sc, SC_SLOWCAST)->val2 / 100;
+		if (SC_ENTRY(sc, SC_NEEDLE_OF_PARALYZE))
+			time += SC_ENTRY(sc, SC_NEEDLE_OF_PARALYZE)->val3;
+		if (SC_ENTRY(sc, SC_SUFFRAGIUM)) {
+			time -= time * SC_ENTRY(sc, SC_SUFFRAGIUM)->val2 / 100;
 #ifndef RENEWAL
 			status_change_end(bl, SC_SUFFRAGIUM, INVALID_TIMER);
 #endif
 		}
-		if (sc->data[SC_MEMORIZE]) {
+		if (SC_ENTRY(sc, SC_MEMORIZE)) {
 			time>>=1;
-			if ((--sc->data[SC_MEMORIZE]->val2) <= 0)
+			if ((--SC_ENTRY(sc, SC_MEMORIZE)->val2) <= 0)
 				status_change_end(bl, SC_MEMORIZE, INVALID_TIMER);
 		}
-		if (sc->data[SC_POEMBRAGI])
-			time -= time * sc->data[SC_POEMBRAGI]->val2 / 100;
-		if (sc->data[SC_SKF_CAST] != NULL)
-			time -= time * sc->data[SC_SKF_CAST]->val1 / 100;
-		if (sc->data[SC_IZAYOI])
+		if (SC_ENTRY(sc, SC_POEMBRAGI))
+			time -= time * SC_ENTRY(sc, SC_POEMBRAGI)->val2 / 100;
+		if (SC_ENTRY(sc, SC_SKF_CAST) != NULL)
+			time -= time * SC_ENTRY(sc, SC_SKF_CAST)->val1 / 100;
+		if (SC_ENTRY(sc, SC_IZAYOI))
 			time -= time * 50 / 100;
 	}
 	time = max(time, 0);
@@ -17649,33 +17641,33 @@ static int skill_vfcastfix(struct block_list *bl, double time, uint16 skill_id,
 
 	if (sc && sc->count && !(skill->get_castnodex(skill_id, skill_lv)&2) ) {
 		// All variable cast additive bonuses must come first
-		if (sc->data[SC_SLOWCAST])
-			VARCAST_REDUCTION(-sc->data[SC_SLOWCAST]->val2);
-		if (sc->data[SC_FROSTMISTY])
+		if (SC_ENTRY(sc, SC_SLOWCAST))
+			VARCAST_REDUCTION(-SC_ENTRY(sc, SC_SLOWCAST)->val2);
+		if (SC_ENTRY(sc, SC_FROSTMISTY))
 			VARCAST_REDUCTION(-15);
 
 		// Variable cast reduction bonuses
-		if (sc->data[SC_SUFFRAGIUM]) {
-			VARCAST_REDUCTION(sc->data[SC_SUFFRAGIUM]->val2);
+		if (SC_ENTRY(sc, SC_SUFFRAGIUM)) {
+			VARCAST_REDUCTION(SC_ENTRY(sc, SC_SUFFRAGIUM)->val2);
 #ifndef RENEWAL
 			status_change_end(bl, SC_SUFFRAGIUM, INVALID_TIMER);
 #endif
 		}
-		if (sc->data[SC_MEMORIZE]) {
+		if (SC_ENTRY(sc, SC_MEMORIZE)) {
 			VARCAST_REDUCTION(50);
-			if ((--sc->data[SC_MEMORIZE]->val2) <= 0)
+			if ((--SC_ENTRY(sc, SC_MEMORIZE)->val2) <= 0)
 				status_change_end(bl, SC_MEMORIZE, INVALID_TIMER);
 		}
-		if (sc->data[SC_POEMBRAGI])
-			VARCAST_REDUCTION(sc->data[SC_POEMBRAGI]->val2);
-		if (sc->data[SC_IZAYOI])
+		if (SC_ENTRY(sc, SC_POEMBRAGI))
+			VARCAST_REDUCTION(SC_ENTRY(sc, SC_POEMBRAGI)->val2);
+		if (SC_ENTRY(sc, SC_IZAYOI))
 			VARCAST_REDUCTION(50);
-		if (sc->data[SC_WATER_INSIGNIA] && sc->data[SC_WATER_INSIGNIA]->val1 == 3 && (skill->get_ele(skill_id, skill_lv) == ELE_WATER))
+		if (SC_ENTRY(sc, SC_WATER_INSIGNIA) && SC_ENTRY(sc, SC_WATER_INSIGNIA)->val1 == 3 && (skill->get_ele(skill_id, skill_lv) == ELE_WATER))
 			VARCAST_REDUCTION(30); //Reduces 30% Variable Cast Time of Water spells.
-		if (sc->data[SC_TELEKINESIS_INTENSE])
-			VARCAST_REDUCTION(sc->data[SC_TELEKINESIS_INTENSE]->val2);
-		if (sc->data[SC_SOULLINK]){
-			if(sc->data[SC_SOULLINK]->val2 == SL_WIZARD || sc->data[SC_SOULLINK]->val2 == SL_BARDDANCER)
+		if (SC_ENTRY(sc, SC_TELEKINESIS_INTENSE))
+			VARCAST_REDUCTION(SC_ENTRY(sc, SC_TELEKINESIS_INTENSE)->val2);
+		if (SC_ENTRY(sc, SC_SOULLINK)){
+			if(SC_ENTRY(sc, SC_SOULLINK)->val2 == SL_WIZARD || SC_ENTRY(sc, SC_SOULLINK)->val2 == SL_BARDDANCER)
 				switch(skill_id){
 					case WZ_FIREPILLAR:
 						if(skill_lv < 5)
@@ -17689,38 +17681,38 @@ static int skill_vfcastfix(struct block_list *bl, double time, uint16 skill_id,
 						VARCAST_REDUCTION(50);
 				}
 		}
-		if (sc->data[SC_MYSTICSCROLL])
-			VARCAST_REDUCTION(sc->data[SC_MYSTICSCROLL]->val1);
-		if (sc->data[SC_SKF_CAST] != NULL)
-			VARCAST_REDUCTION(sc->data[SC_SKF_CAST]->val1);
-		if (sc->data[SC_SOULFAIRY] != NULL)
-			VARCAST_REDUCTION(sc->data[SC_SOULFAIRY]->val3);
+		if (SC_ENTRY(sc, SC_MYSTICSCROLL))
+			VARCAST_REDUCTION(SC_ENTRY(sc, SC_MYSTICSCROLL)->val1);
+		if (SC_ENTRY(sc, SC_SKF_CAST) != NULL)
+			VARCAST_REDUCTION(SC_ENTRY(sc, SC_SKF_CAST)->val1);
+		if (SC_ENTRY(sc, SC_SOULFAIRY) != NULL)
+			VARCAST_REDUCTION(SC_ENTRY(sc, SC_SOULFAIRY)->val3);
 
 		// Fixed cast reduction bonuses
-		if( sc->data[SC__LAZINESS] )
-			fixcast_r = max(fixcast_r, sc->data[SC__LAZINESS]->val2);
-		if( sc->data[SC_DANCE_WITH_WUG])
-			fixcast_r = max(fixcast_r, sc->data[SC_DANCE_WITH_WUG]->val4);
-		if( sc->data[SC_SECRAMENT] )
-			fixcast_r = max(fixcast_r, sc->data[SC_SECRAMENT]->val2);
+		if( SC_ENTRY(sc, SC__LAZINESS) )
+			fixcast_r = max(fixcast_r, SC_ENTRY(sc, SC__LAZINESS)->val2);
+		if( SC_ENTRY(sc, SC_DANCE_WITH_WUG))
+			fixcast_r = max(fixcast_r, SC_ENTRY(sc, SC_DANCE_WITH_WUG)->val4);
+		if( SC_ENTRY(sc, SC_SECRAMENT) )
+			fixcast_r = max(fixcast_r, SC_ENTRY(sc, SC_SECRAMENT)->val2);
 		if (sd && skill_id >= WL_WHITEIMPRISON && skill_id < WL_FREEZE_SP) {
 			int radius_lv = pc->checkskill(sd, WL_RADIUS);
 			if (radius_lv)
 				fixcast_r = max(fixcast_r, (status_get_int(bl) + status->get_lv(bl)) / 15 + radius_lv * 5); // [{(Caster?s INT / 15) + (Caster?s Base Level / 15) + (Radius Skill Level x 5)}] %
 		}
-		if (sc->data[SC_FENRIR_CARD])
-			fixcast_r = max(fixcast_r, sc->data[SC_FENRIR_CARD]->val2);
-		if (sc->data[SC_MAGIC_CANDY])
-			fixcast_r = max(fixcast_r, sc->data[SC_MAGIC_CANDY]->val2);
-		if (sc->data[SC_HEAT_BARREL])
-			fixcast_r = max(fixcast_r, sc->data[SC_HEAT_BARREL]->val2);
+		if (SC_ENTRY(sc, SC_FENRIR_CARD))
+			fixcast_r = max(fixcast_r, SC_ENTRY(sc, SC_FENRIR_CARD)->val2);
+		if (SC_ENTRY(sc, SC_MAGIC_CANDY))
+			fixcast_r = max(fixcast_r, SC_ENTRY(sc, SC_MAGIC_CANDY)->val2);
+		if (SC_ENTRY(sc, SC_HEAT_BARREL))
+			fixcast_r = max(fixcast_r, SC_ENTRY(sc, SC_HEAT_BARREL)->val2);
 
 		// Fixed cast non percentage bonuses
-		if( sc->data[SC_MANDRAGORA] )
-			fixed += sc->data[SC_MANDRAGORA]->val1 * 500;
-		if( sc->data[SC_IZAYOI] )
+		if( SC_ENTRY(sc, SC_MANDRAGORA) )
+			fixed += SC_ENTRY(sc, SC_MANDRAGORA)->val1 * 500;
+		if( SC_ENTRY(sc, SC_IZAYOI) )
 			fixed = 0;
-		if( sc->data[SC_GUST_OPTION] || sc->data[SC_BLAST_OPTION] || sc->data[SC_WILD_STORM_OPTION] )
+		if( SC_ENTRY(sc, SC_GUST_OPTION) || SC_ENTRY(sc, SC_BLAST_OPTION) || SC_ENTRY(sc, SC_WILD_STORM_OPTION) )
 			fixed -= 1000;
 	}
 
@@ -17783,7 +17775,7 @@ static int skill_delay_fix(struct block_list *bl, uint16 skill_id, uint16 skill_
 
 #ifndef RENEWAL // 2018.11 rebalance - Basilica changed to a self buff
 		case HP_BASILICA:
-			if( sc && !sc->data[SC_BASILICA] )
+			if( sc && !SC_ENTRY(sc, SC_BASILICA) )
 				time = 0; // There is no Delay on Basilica creation, only on cancel
 			break;
 #endif
@@ -17807,14 +17799,14 @@ static int skill_delay_fix(struct block_list *bl, uint16 skill_id, uint16 skill_
 			}
 	}
 
-	if ( sc && sc->data[SC_SOULLINK] ) {
+	if ( sc && SC_ENTRY(sc, SC_SOULLINK) ) {
 		switch (skill_id) {
 			case CR_SHIELDBOOMERANG:
-				if (sc->data[SC_SOULLINK]->val2 == SL_CRUSADER)
+				if (SC_ENTRY(sc, SC_SOULLINK)->val2 == SL_CRUSADER)
 					time /= 2;
 				break;
 			case AS_SONICBLOW:
-				if (!map_flag_gvg2(bl->m) && !map->list[bl->m].flag.battleground && sc->data[SC_SOULLINK]->val2 == SL_ASSASIN)
+				if (!map_flag_gvg2(bl->m) && !map->list[bl->m].flag.battleground && SC_ENTRY(sc, SC_SOULLINK)->val2 == SL_ASSASIN)
 					time /= 2;
 				break;
 		}
@@ -17823,16 +17815,16 @@ static int skill_delay_fix(struct block_list *bl, uint16 skill_id, uint16 skill_
 	if (!(delaynodex&2))
 	{
 		if (sc && sc->count) {
-			if (sc->data[SC_POEMBRAGI])
-				time -= time * sc->data[SC_POEMBRAGI]->val3 / 100;
-			if (sc->data[SC_WIND_INSIGNIA] && sc->data[SC_WIND_INSIGNIA]->val1 == 3 && (skill->get_ele(skill_id, skill_lv) == ELE_WIND))
+			if (SC_ENTRY(sc, SC_POEMBRAGI))
+				time -= time * SC_ENTRY(sc, SC_POEMBRAGI)->val3 / 100;
+			if (SC_ENTRY(sc, SC_WIND_INSIGNIA) && SC_ENTRY(sc, SC_WIND_INSIGNIA)->val1 == 3 && (skill->get_ele(skill_id, skill_lv) == ELE_WIND))
 				time /= 2; // After Delay of Wind element spells reduced by 50%.
 		}
 
 	}
 
-	if (sc != NULL && sc->data[SC_SOULDIVISION] != NULL)
-		time += time * sc->data[SC_SOULDIVISION]->val2 / 100;
+	if (sc != NULL && SC_ENTRY(sc, SC_SOULDIVISION) != NULL)
+		time += time * SC_ENTRY(sc, SC_SOULDIVISION)->val2 / 100;
 
 	if( !(delaynodex&4) && sd && sd->delayrate != 100 )
 		time = time * sd->delayrate / 100;
@@ -18305,7 +18297,7 @@ static int skill_autospell_spell_selected(struct map_session_data *sd, uint16 sk
 			max_lv = 1;
 	}
 
-	if (sk->spirit_boost && sd->sc.data[SC_SOULLINK] != NULL && sd->sc.data[SC_SOULLINK]->val2 == SL_SAGE)
+	if (sk->spirit_boost && SC_ENTRY(&sd->sc, SC_SOULLINK) != NULL && SC_ENTRY(&sd->sc, SC_SOULLINK)->val2 == SL_SAGE)
 		max_lv = skill->dbs->db[skill->get_index(skill_id)].max; // Soul Linker bonus. [Skotlex]
 
 	if (max_lv > skill_lv)
@@ -18970,7 +18962,7 @@ static int skill_enchant_elemental_end(struct block_list *bl, int type)
 	if (!sc->count) return 0;
 
 	for (i = 0; i < ARRAYLENGTH(scs); i++)
-		if (type != scs[i] && sc->data[scs[i]])
+		if (type != scs[i] && SC_ENTRY(sc, scs[i]))
 			status_change_end(bl, scs[i], INVALID_TIMER);
 
 	return 0;
@@ -19037,7 +19029,7 @@ static int skill_check_cloaking_end(struct block_list *bl, va_list ap)
 {
 	struct map_session_data *sd = BL_CAST(BL_PC, bl);
 
-	if (sd && sd->sc.data[SC_CLOAKING] && !skill->can_cloak(sd))
+	if (sd && SC_ENTRY(&sd->sc, SC_CLOAKING) && !skill->can_cloak(sd))
 		status_change_end(bl, SC_CLOAKING, INVALID_TIMER);
 
 	return 0;
@@ -19079,8 +19071,8 @@ static bool skill_check_shadowform(struct block_list *bl, int64 damage, int hit)
 
 	sc = status->get_sc(bl);
 
-	if (sc && sc->data[SC__SHADOWFORM] && damage) {
-		struct block_list *src = map->id2bl(sc->data[SC__SHADOWFORM]->val2);
+	if (sc && SC_ENTRY(sc, SC__SHADOWFORM) && damage) {
+		struct block_list *src = map->id2bl(SC_ENTRY(sc, SC__SHADOWFORM)->val2);
 		struct map_session_data *sd = BL_CAST(BL_PC, src);
 
 		if( !src || src->m != bl->m ) {
@@ -19098,7 +19090,7 @@ static bool skill_check_shadowform(struct block_list *bl, int64 damage, int hit)
 		status->damage(bl, src, damage, 0, clif->damage(src, src, 500, 500, damage, hit, (hit > 1 ? BDT_MULTIHIT : BDT_NORMAL), 0), 0);
 
 		/* because damage can cancel it */
-		if( sc->data[SC__SHADOWFORM] && (--sc->data[SC__SHADOWFORM]->val3) <= 0 ) {
+		if( SC_ENTRY(sc, SC__SHADOWFORM) && (--SC_ENTRY(sc, SC__SHADOWFORM)->val3) <= 0 ) {
 			status_change_end(bl, SC__SHADOWFORM, INVALID_TIMER);
 			if (sd != NULL)
 				sd->shadowform_id = 0;
@@ -19236,8 +19228,8 @@ static int skill_delunit(struct skill_unit *su)
 		case SC_MANHOLE: // Note : Removing the unit don't remove the status (official info)
 			if( group->val2 ) { // Someone Trapped
 				struct status_change *tsc = status->get_sc(map->id2bl(group->val2));
-				if( tsc && tsc->data[SC__MANHOLE] )
-					tsc->data[SC__MANHOLE]->val4 = 0; // Remove the Unit ID
+				if( tsc && SC_ENTRY(tsc, SC__MANHOLE) )
+					SC_ENTRY(tsc, SC__MANHOLE)->val4 = 0; // Remove the Unit ID
 			}
 			break;
 	}
@@ -19389,9 +19381,9 @@ static int skill_delunitgroup(struct skill_unit_group *group)
 
 	if (skill->get_unit_flag(group->skill_id)&(UF_DANCE|UF_SONG|UF_ENSEMBLE)) {
 		struct status_change* sc = status->get_sc(src);
-		if (sc && sc->data[SC_DANCING])
+		if (sc && SC_ENTRY(sc, SC_DANCING))
 		{
-			sc->data[SC_DANCING]->val2 = 0 ; //This prevents status_change_end attempting to re-delete the group. [Skotlex]
+			SC_ENTRY(sc, SC_DANCING)->val2 = 0 ; //This prevents status_change_end attempting to re-delete the group. [Skotlex]
 			status_change_end(src, SC_DANCING, INVALID_TIMER);
 		}
 	}
@@ -19400,8 +19392,8 @@ static int skill_delunitgroup(struct skill_unit_group *group)
 	// (needs to be done when the group is deleted by other means than skill deactivation)
 	if (group->unit_id == UNT_GOSPEL) {
 		struct status_change *sc = status->get_sc(src);
-		if(sc && sc->data[SC_GOSPEL]) {
-			sc->data[SC_GOSPEL]->val3 = 0; //Remove reference to this group. [Skotlex]
+		if(sc && SC_ENTRY(sc, SC_GOSPEL)) {
+			SC_ENTRY(sc, SC_GOSPEL)->val3 = 0; //Remove reference to this group. [Skotlex]
 			status_change_end(src, SC_GOSPEL, INVALID_TIMER);
 		}
 	}
@@ -19412,8 +19404,8 @@ static int skill_delunitgroup(struct skill_unit_group *group)
 		case SG_STAR_WARM:
 		{
 			struct status_change *sc = NULL;
-			if( (sc = status->get_sc(src)) != NULL  && sc->data[SC_WARM] ) {
-				sc->data[SC_WARM]->val4 = 0;
+			if( (sc = status->get_sc(src)) != NULL  && SC_ENTRY(sc, SC_WARM) ) {
+				SC_ENTRY(sc, SC_WARM)->val4 = 0;
 				status_change_end(src, SC_WARM, INVALID_TIMER);
 			}
 		}
@@ -19421,8 +19413,8 @@ static int skill_delunitgroup(struct skill_unit_group *group)
 		case NC_NEUTRALBARRIER:
 		{
 			struct status_change *sc = NULL;
-			if( (sc = status->get_sc(src)) != NULL && sc->data[SC_NEUTRALBARRIER_MASTER] ) {
-				sc->data[SC_NEUTRALBARRIER_MASTER]->val2 = 0;
+			if( (sc = status->get_sc(src)) != NULL && SC_ENTRY(sc, SC_NEUTRALBARRIER_MASTER) ) {
+				SC_ENTRY(sc, SC_NEUTRALBARRIER_MASTER)->val2 = 0;
 				status_change_end(src,SC_NEUTRALBARRIER_MASTER,INVALID_TIMER);
 			}
 		}
@@ -19430,8 +19422,8 @@ static int skill_delunitgroup(struct skill_unit_group *group)
 		case NC_STEALTHFIELD:
 		{
 			struct status_change *sc = NULL;
-			if( (sc = status->get_sc(src)) != NULL && sc->data[SC_STEALTHFIELD_MASTER] ) {
-				sc->data[SC_STEALTHFIELD_MASTER]->val2 = 0;
+			if( (sc = status->get_sc(src)) != NULL && SC_ENTRY(sc, SC_STEALTHFIELD_MASTER) ) {
+				SC_ENTRY(sc, SC_STEALTHFIELD_MASTER)->val2 = 0;
 				status_change_end(src,SC_STEALTHFIELD_MASTER,INVALID_TIMER);
 			}
 		}
@@ -19439,8 +19431,8 @@ static int skill_delunitgroup(struct skill_unit_group *group)
 		case LG_BANDING:
 		{
 			struct status_change *sc = NULL;
-			if( (sc = status->get_sc(src)) && sc->data[SC_BANDING] ) {
-				sc->data[SC_BANDING]->val4 = 0;
+			if( (sc = status->get_sc(src)) && SC_ENTRY(sc, SC_BANDING) ) {
+				SC_ENTRY(sc, SC_BANDING)->val4 = 0;
 				status_change_end(src,SC_BANDING,INVALID_TIMER);
 			}
 		}
@@ -19706,7 +19698,7 @@ static int skill_unit_timer_sub(union DBKey key, struct DBData *data, va_list ap
 			{
 				struct block_list *src = map->id2bl(group->src_id);
 				struct status_change *sc;
-				if( !src || (sc = status->get_sc(src)) == NULL || !sc->data[SC_BANDING] ) {
+				if( !src || (sc = status->get_sc(src)) == NULL || !SC_ENTRY(sc, SC_BANDING) ) {
 					skill->delunit(su);
 					break;
 				}
@@ -20814,11 +20806,11 @@ static void skill_toggle_magicpower(struct block_list *bl, uint16 skill_id, int
 	if ((skill->get_nk(skill_id) & NK_NO_DAMAGE) != 0 || (skill->get_type(skill_id, skill_lv) & BF_MAGIC) == 0)
 		return;
 
-	if (sc && sc->count && sc->data[SC_MAGICPOWER]) {
-		if (sc->data[SC_MAGICPOWER]->val4) {
+	if (sc && sc->count && SC_ENTRY(sc, SC_MAGICPOWER)) {
+		if (SC_ENTRY(sc, SC_MAGICPOWER)->val4) {
 			status_change_end(bl, SC_MAGICPOWER, INVALID_TIMER);
 		} else {
-			sc->data[SC_MAGICPOWER]->val4 = 1;
+			SC_ENTRY(sc, SC_MAGICPOWER)->val4 = 1;
 			status_calc_bl(bl, status->sc2scb_flag(SC_MAGICPOWER));
 #ifndef RENEWAL
 			if (bl->type == BL_PC) {// update current display.
@@ -20893,7 +20885,7 @@ static int skill_spellbook(struct map_session_data *sd, int nameid)
 	sc = status->get_sc(&sd->bl);
 	status_change_end(&sd->bl, SC_STOP, INVALID_TIMER);
 
-	for(i=SC_SPELLBOOK1; i <= SC_SPELLBOOK7; i++) if( sc && !sc->data[i] ) break;
+	for(i=SC_SPELLBOOK1; i <= SC_SPELLBOOK7; i++) if( sc && !SC_ENTRY(sc, i) ) break;
 	if( i > SC_SPELLBOOK7 )
 	{
 		clif->skill_fail(sd, WL_READING_SB, USESKILL_FAIL_SPELLBOOK_READING, 0, 0);
@@ -20913,14 +20905,14 @@ static int skill_spellbook(struct map_session_data *sd, int nameid)
 	max_preserve = 4 * pc->checkskill(sd, WL_FREEZE_SP) + (status_get_int(&sd->bl) + sd->status.base_level) / 10;
 	point = skill->dbs->spellbook_db[i].point;
 
-	if( sc && sc->data[SC_READING_SB] ) {
-		if( (sc->data[SC_READING_SB]->val2 + point) > max_preserve ) {
+	if( sc && SC_ENTRY(sc, SC_READING_SB) ) {
+		if( (SC_ENTRY(sc, SC_READING_SB)->val2 + point) > max_preserve ) {
 			clif->skill_fail(sd, WL_READING_SB, USESKILL_FAIL_SPELLBOOK_PRESERVATION_POINT, 0, 0);
 			return 0;
 		}
 		for(i = SC_SPELLBOOK7; i >= SC_SPELLBOOK1; i--){ // This is how official saves spellbook. [malufett]
-			if( !sc->data[i] ){
-				sc->data[SC_READING_SB]->val2 += point; // increase points
+			if( !SC_ENTRY(sc, i) ){
+				SC_ENTRY(sc, SC_READING_SB)->val2 += point; // increase points
 				sc_start4(&sd->bl, &sd->bl, (sc_type)i, 100, skill_id, pc->checkskill(sd, skill_id), point, 0, INFINITE_DURATION, skill_id);
 				break;
 			}
@@ -20938,8 +20930,8 @@ static int skill_select_menu(struct map_session_data *sd, uint16 skill_id)
 	int id, lv, prob, aslvl = 0, idx = 0;
 	nullpo_ret(sd);
 
-	if (sd->sc.data[SC_STOP]) {
-		aslvl = sd->sc.data[SC_STOP]->val1;
+	if (SC_ENTRY(&sd->sc, SC_STOP)) {
+		aslvl = SC_ENTRY(&sd->sc, SC_STOP)->val1;
 		status_change_end(&sd->bl,SC_STOP,INVALID_TIMER);
 	}
 
@@ -22016,7 +22008,7 @@ static void skill_add_bard_dancer_soullink_songs(struct map_session_data *sd)
 {
 	nullpo_retv(sd);
 
-	if (sd->sc.count == 0 || sd->sc.data[SC_SOULLINK] == NULL || sd->sc.data[SC_SOULLINK]->val2 != SL_BARDDANCER)
+	if (sd->sc.count == 0 || SC_ENTRY(&sd->sc, SC_SOULLINK) == NULL || SC_ENTRY(&sd->sc, SC_SOULLINK)->val2 != SL_BARDDANCER)
 		return;
 
 	const int bard_song_skillid[4] = {BA_WHISTLE, BA_ASSASSINCROSS, BA_POEMBRAGI, BA_APPLEIDUN};
@@ -294,7 +294,7 @@ static int status_damage(struct block_list *src, struct block_list *target, int6
 #endif // 0
 
 	sc = status->get_sc(target);
-	if( hp && battle_config.invincible_nodamage && src && sc && sc->data[SC_INVINCIBLE] && !sc->data[SC_INVINCIBLEOFF] )
+	if( hp && battle_config.invincible_nodamage && src && sc && SC_ENTRY(sc, SC_INVINCIBLE) && !SC_ENTRY(sc, SC_INVINCIBLEOFF) )
 		hp = 1;
 
 	if( hp && !(flag&1) ) {
@@ -302,7 +302,7 @@ static int status_damage(struct block_list *src, struct block_list *target, int6
 			struct status_change_entry *sce;
 
 #ifdef DEVOTION_REFLECT_DAMAGE
-			if (src && (sce = sc->data[SC_DEVOTION]) != NULL) {
+			if (src && (sce = SC_ENTRY(sc, SC_DEVOTION)) != NULL) {
 				struct block_list *d_bl = map->id2bl(sce->val1);
 				struct mercenary_data *d_md = BL_CAST(BL_MER, d_bl);
 				struct map_session_data *d_sd = BL_CAST(BL_PC, d_bl);
@@ -319,7 +319,7 @@ static int status_damage(struct block_list *src, struct block_list *target, int6
 				status_change_end(target, SC_DEVOTION, INVALID_TIMER);
 			}
 #endif
-			if (sc->data[SC_STONE] && sc->opt1 == OPT1_STONE)
+			if (SC_ENTRY(sc, SC_STONE) && sc->opt1 == OPT1_STONE)
 				status_change_end(target, SC_STONE, INVALID_TIMER);
 			status_change_end(target, SC_FREEZE, INVALID_TIMER);
 			status_change_end(target, SC_SLEEP, INVALID_TIMER);
@@ -332,13 +332,13 @@ static int status_damage(struct block_list *src, struct block_list *target, int6
 			status_change_end(target, SC_CAMOUFLAGE, INVALID_TIMER);
 			status_change_end(target, SC_SUHIDE, INVALID_TIMER);
 			status_change_end(target, SC_NEWMOON, INVALID_TIMER);
-			if ((sce=sc->data[SC_ENDURE]) && !sce->val4 && !sc->data[SC_LKCONCENTRATION]) {
+			if ((sce=SC_ENTRY(sc, SC_ENDURE)) && !sce->val4 && !SC_ENTRY(sc, SC_LKCONCENTRATION)) {
 				//Endure count is only reduced by non-players on non-gvg maps.
 				//val4 signals infinite endure. [Skotlex]
 				if (src && src->type != BL_PC && !map_flag_gvg2(target->m) && !map->list[target->m].flag.battleground && --(sce->val2) < 0)
 					status_change_end(target, SC_ENDURE, INVALID_TIMER);
 			}
-			if ((sce=sc->data[SC_GRAVITATION]) && sce->val3 == BCT_SELF) {
+			if ((sce=SC_ENTRY(sc, SC_GRAVITATION)) && sce->val3 == BCT_SELF) {
 				struct skill_unit_group* sg = skill->id2group(sce->val4);
 				if (sg) {
 					skill->del_unitgroup(sg);
@@ -346,11 +346,11 @@ static int status_damage(struct block_list *src, struct block_list *target, int6
 					status_change_end(target, SC_GRAVITATION, INVALID_TIMER);
 				}
 			}
-			if(sc->data[SC_DANCING] && (unsigned int)hp > st->max_hp>>2)
+			if(SC_ENTRY(sc, SC_DANCING) && (unsigned int)hp > st->max_hp>>2)
 				status_change_end(target, SC_DANCING, INVALID_TIMER);
-			if(sc->data[SC_CLOAKINGEXCEED] && --(sc->data[SC_CLOAKINGEXCEED]->val2) <= 0)
+			if(SC_ENTRY(sc, SC_CLOAKINGEXCEED) && --(SC_ENTRY(sc, SC_CLOAKINGEXCEED)->val2) <= 0)
 				status_change_end(target, SC_CLOAKINGEXCEED, INVALID_TIMER);
-			if(sc->data[SC_KAGEMUSYA] && --(sc->data[SC_KAGEMUSYA]->val3) <= 0)
+			if(SC_ENTRY(sc, SC_KAGEMUSYA) && --(SC_ENTRY(sc, SC_KAGEMUSYA)->val3) <= 0)
 				status_change_end(target, SC_KAGEMUSYA, INVALID_TIMER);
 		}
 		unit->skillcastcancel(target, 2);
@@ -360,15 +360,15 @@ static int status_damage(struct block_list *src, struct block_list *target, int6
 	st->sp-= sp;
 
 	if (sc && hp && st->hp) {
-		if (sc->data[SC_AUTOBERSERK] &&
-			(!sc->data[SC_PROVOKE] || !sc->data[SC_PROVOKE]->val2) &&
+		if (SC_ENTRY(sc, SC_AUTOBERSERK) &&
+			(!SC_ENTRY(sc, SC_PROVOKE) || !SC_ENTRY(sc, SC_PROVOKE)->val2) &&
 			st->hp < st->max_hp>>2)
 			sc_start4(src, target, SC_PROVOKE, 100, 10, 1, 0, 0, 0, SM_AUTOBERSERK);
-		if (sc->data[SC_BERSERK] && st->hp <= 100)
+		if (SC_ENTRY(sc, SC_BERSERK) && st->hp <= 100)
 			status_change_end(target, SC_BERSERK, INVALID_TIMER);
-		if( sc->data[SC_RAISINGDRAGON] && st->hp <= 1000 )
+		if( SC_ENTRY(sc, SC_RAISINGDRAGON) && st->hp <= 1000 )
 			status_change_end(target, SC_RAISINGDRAGON, INVALID_TIMER);
-		if (sc->data[SC_SATURDAY_NIGHT_FEVER] && st->hp <= 100)
+		if (SC_ENTRY(sc, SC_SATURDAY_NIGHT_FEVER) && st->hp <= 100)
 			status_change_end(target, SC_SATURDAY_NIGHT_FEVER, INVALID_TIMER);
 	}
 
@@ -447,14 +447,14 @@ static int status_damage(struct block_list *src, struct block_list *target, int6
 		}
 	}
 
-	if( sc && sc->data[SC_KAIZEL] && !map_flag_gvg2(target->m) ) {
+	if( sc && SC_ENTRY(sc, SC_KAIZEL) && !map_flag_gvg2(target->m) ) {
 		//flag&8 = disable Kaizel
-		int time = skill->get_time2(SL_KAIZEL,sc->data[SC_KAIZEL]->val1);
+		int time = skill->get_time2(SL_KAIZEL,SC_ENTRY(sc, SC_KAIZEL)->val1);
 		//Look for Osiris Card's bonus effect on the character and revive 100% or revive normally
 		if ( target->type == BL_PC && BL_CAST(BL_PC,target)->special_state.restart_full_recover )
 			status->revive(target, 100, 100);
 		else
-			status->revive(target, sc->data[SC_KAIZEL]->val2, 0);
+			status->revive(target, SC_ENTRY(sc, SC_KAIZEL)->val2, 0);
 		status->change_clear(target,0);
 		clif->skill_nodamage(target,target,ALL_RESURRECTION,1,1);
 		sc_start(target, target, skill->get_sc_type(PR_KYRIE), 100, 10, time, PR_KYRIE);
@@ -465,11 +465,11 @@ static int status_damage(struct block_list *src, struct block_list *target, int6
 		return (int)(hp+sp);
 	}
 
-	if (target->type == BL_MOB && sc != NULL && sc->data[SC_REBIRTH] != NULL) {
+	if (target->type == BL_MOB && sc != NULL && SC_ENTRY(sc, SC_REBIRTH) != NULL) {
 		struct mob_data *t_md = BL_UCAST(BL_MOB, target);
 		if (!t_md->state.rebirth) {
 			// Ensure the monster has not already reborn before doing so.
-			status->revive(target, sc->data[SC_REBIRTH]->val2, 0);
+			status->revive(target, SC_ENTRY(sc, SC_REBIRTH)->val2, 0);
 			status->change_clear(target,0);
 			t_md->state.rebirth = 1;
 
@@ -533,7 +533,7 @@ static int status_heal(struct block_list *bl, int64 in_hp, int64 in_sp, enum sta
 	}
 
 	if (hp != 0) {
-		if (sc && sc->data[SC_BERSERK] != NULL) {
+		if (sc && SC_ENTRY(sc, SC_BERSERK) != NULL) {
 			if ((flag & STATUS_HEAL_FORCED) != 0)
 				flag &= ~STATUS_HEAL_SHOWEFFECT;
 			else
@@ -561,9 +561,9 @@ static int status_heal(struct block_list *bl, int64 in_hp, int64 in_sp, enum sta
 	st->sp+= sp;
 
 	if( hp && sc
-	    && sc->data[SC_AUTOBERSERK]
-	    && sc->data[SC_PROVOKE]
-	    && sc->data[SC_PROVOKE]->val2==1
+	    && SC_ENTRY(sc, SC_AUTOBERSERK)
+	    && SC_ENTRY(sc, SC_PROVOKE)
+	    && SC_ENTRY(sc, SC_PROVOKE)->val2==1
 	    && st->hp>=st->max_hp>>2
 	 ) //End auto berserk.
 		status_change_end(bl, SC_PROVOKE, INVALID_TIMER);
@@ -817,7 +817,7 @@ static int status_check_skilluse(struct block_list *src, struct block_list *targ
 		//on dead characters, said checks are left to skill.c [Skotlex]
 		if (target && status->isdead(target))
 			return 0;
-		if( src && (sc = status->get_sc(src)) != NULL && sc->data[SC_COLD] && src->type != BL_MOB)
+		if( src && (sc = status->get_sc(src)) != NULL && SC_ENTRY(sc, SC_COLD) && src->type != BL_MOB)
 			return 0;
 	}
 
@@ -866,15 +866,15 @@ static int status_check_skilluse(struct block_list *src, struct block_list *targ
 		}
 
 		if (
-			(sc->data[SC_TRICKDEAD] && skill_id != NV_TRICKDEAD)
-			|| (sc->data[SC_AUTOCOUNTER] && !flag && skill_id)
-			|| (sc->data[SC_GOSPEL] && sc->data[SC_GOSPEL]->val4 == BCT_SELF && skill_id != PA_GOSPEL)
-			|| (sc->data[SC_SUHIDE] && skill_id != SU_HIDE)
+			(SC_ENTRY(sc, SC_TRICKDEAD) && skill_id != NV_TRICKDEAD)
+			|| (SC_ENTRY(sc, SC_AUTOCOUNTER) && !flag && skill_id)
+			|| (SC_ENTRY(sc, SC_GOSPEL) && SC_ENTRY(sc, SC_GOSPEL)->val4 == BCT_SELF && skill_id != PA_GOSPEL)
+			|| (SC_ENTRY(sc, SC_SUHIDE) && skill_id != SU_HIDE)
 			)
 			return 0;
 
-		if (sc->data[SC_DC_WINKCHARM] && target && !flag) { //Prevents skill usage
-			struct block_list *winkcharm_target = map->id2bl(sc->data[SC_DC_WINKCHARM]->val2);
+		if (SC_ENTRY(sc, SC_DC_WINKCHARM) && target && !flag) { //Prevents skill usage
+			struct block_list *winkcharm_target = map->id2bl(SC_ENTRY(sc, SC_DC_WINKCHARM)->val2);
 			if (winkcharm_target != NULL) {
 				if (unit->bl2ud(src) && (unit->bl2ud(src))->walktimer == INVALID_TIMER)
 					unit->walk_tobl(src, winkcharm_target, 3, 1);
@@ -885,8 +885,8 @@ static int status_check_skilluse(struct block_list *src, struct block_list *targ
 			}
 		}
 
-		if (sc->data[SC_BLADESTOP]) {
-			switch (sc->data[SC_BLADESTOP]->val1)
+		if (SC_ENTRY(sc, SC_BLADESTOP)) {
+			switch (SC_ENTRY(sc, SC_BLADESTOP)->val1)
 			{
 			case 5: if (skill_id == MO_EXTREMITYFIST) break;
 				FALLTHROUGH
@@ -900,12 +900,12 @@ static int status_check_skilluse(struct block_list *src, struct block_list *targ
 			}
 		}
 
-		if (sc->data[SC_DANCING] && flag!=2) {
+		if (SC_ENTRY(sc, SC_DANCING) && flag!=2) {
 			if (src->type == BL_PC && skill_id >= WA_SWING_DANCE && skill_id <= WM_UNLIMITED_HUMMING_VOICE) {
 				// Lvl 5 Lesson or higher allow you use 3rd job skills while dancing.v
 				if (pc->checkskill(sd, WM_LESSON) < 5)
 					return 0;
-			} else if(sc->data[SC_LONGING]) { //Allow everything except dancing/re-dancing. [Skotlex]
+			} else if(SC_ENTRY(sc, SC_LONGING)) { //Allow everything except dancing/re-dancing. [Skotlex]
 				if (skill_id == BD_ENCORE ||
 					skill->get_inf2(skill_id)&(INF2_SONG_DANCE|INF2_ENSEMBLE_SKILL)
 					)
@@ -924,7 +924,7 @@ static int status_check_skilluse(struct block_list *src, struct block_list *targ
 				}
 			}
 #ifndef RENEWAL
-			if ((sc->data[SC_DANCING]->val1 & 0xFFFF) == CG_HERMODE && skill_id == BD_ADAPTATION)
+			if ((SC_ENTRY(sc, SC_DANCING)->val1 & 0xFFFF) == CG_HERMODE && skill_id == BD_ADAPTATION)
 				return 0; //Can't amp out of Wand of Hermode :/ [Skotlex]
 #endif
 		}
@@ -932,42 +932,42 @@ static int status_check_skilluse(struct block_list *src, struct block_list *targ
 		if (skill_id != 0 /* Do not block item-casted skills.*/ && (src->type != BL_PC || sd->auto_cast_current.type != AUTOCAST_ITEM)) {
 			//Skills blocked through status changes...
 			if (!flag && ( //Blocked only from using the skill (stuff like autospell may still go through
-				(sc->data[SC_ENSEMBLEFATIGUE] != NULL && skill_id != CG_SPECIALSINGER) ||
-				sc->data[SC_SILENCE] ||
-				sc->data[SC_STEELBODY] ||
-				sc->data[SC_BERSERK] ||
-				sc->data[SC_OBLIVIONCURSE] ||
-				sc->data[SC_WHITEIMPRISON] ||
-				sc->data[SC__INVISIBILITY] ||
-				(sc->data[SC_COLD] && src->type != BL_MOB) ||
-				sc->data[SC__IGNORANCE] ||
-				sc->data[SC_DEEP_SLEEP] ||
-				sc->data[SC_SATURDAY_NIGHT_FEVER] ||
-				sc->data[SC_CURSEDCIRCLE_TARGET] ||
-				(sc->data[SC_MARIONETTE_MASTER] && skill_id != CG_MARIONETTE) || //Only skill you can use is marionette again to cancel it
-				(sc->data[SC_MARIONETTE] && skill_id == CG_MARIONETTE) || //Cannot use marionette if you are being buffed by another
-				(sc->data[SC_STASIS] && skill->block_check(src, SC_STASIS, skill_id)) ||
-				(sc->data[SC_KG_KAGEHUMI] && skill->block_check(src, SC_KG_KAGEHUMI, skill_id)) ||
-				(sc->data[SC_NOVAEXPLOSING] && skill->block_check(src, SC_NOVAEXPLOSING, skill_id)) ||
-				(sc->data[SC_GRAVITYCONTROL] && skill->block_check(src, SC_GRAVITYCONTROL, skill_id)) ||
-				sc->data[SC_ALL_RIDING] != NULL // New mounts can't attack nor use skills in the client; this check makes it cheat-safe. [Ind]
+				(SC_ENTRY(sc, SC_ENSEMBLEFATIGUE) != NULL && skill_id != CG_SPECIALSINGER) ||
+				SC_ENTRY(sc, SC_SILENCE) ||
+				SC_ENTRY(sc, SC_STEELBODY) ||
+				SC_ENTRY(sc, SC_BERSERK) ||
+				SC_ENTRY(sc, SC_OBLIVIONCURSE) ||
+				SC_ENTRY(sc, SC_WHITEIMPRISON) ||
+				SC_ENTRY(sc, SC__INVISIBILITY) ||
+				(SC_ENTRY(sc, SC_COLD) && src->type != BL_MOB) ||
+				SC_ENTRY(sc, SC__IGNORANCE) ||
+				SC_ENTRY(sc, SC_DEEP_SLEEP) ||
+				SC_ENTRY(sc, SC_SATURDAY_NIGHT_FEVER) ||
+				SC_ENTRY(sc, SC_CURSEDCIRCLE_TARGET) ||
+				(SC_ENTRY(sc, SC_MARIONETTE_MASTER) && skill_id != CG_MARIONETTE) || //Only skill you can use is marionette again to cancel it
+				(SC_ENTRY(sc, SC_MARIONETTE) && skill_id == CG_MARIONETTE) || //Cannot use marionette if you are being buffed by another
+				(SC_ENTRY(sc, SC_STASIS) && skill->block_check(src, SC_STASIS, skill_id)) ||
+				(SC_ENTRY(sc, SC_KG_KAGEHUMI) && skill->block_check(src, SC_KG_KAGEHUMI, skill_id)) ||
+				(SC_ENTRY(sc, SC_NOVAEXPLOSING) && skill->block_check(src, SC_NOVAEXPLOSING, skill_id)) ||
+				(SC_ENTRY(sc, SC_GRAVITYCONTROL) && skill->block_check(src, SC_GRAVITYCONTROL, skill_id)) ||
+				SC_ENTRY(sc, SC_ALL_RIDING) != NULL // New mounts can't attack nor use skills in the client; this check makes it cheat-safe. [Ind]
 				))
 				return 0;
 
 			//Skill blocking.
 			if (
-				(sc->data[SC_VOLCANO] && skill_id == WZ_ICEWALL) ||
+				(SC_ENTRY(sc, SC_VOLCANO) && skill_id == WZ_ICEWALL) ||
 #ifndef RENEWAL
-				(sc->data[SC_ROKISWEIL] != NULL && skill_id != BD_ADAPTATION) ||
+				(SC_ENTRY(sc, SC_ROKISWEIL) != NULL && skill_id != BD_ADAPTATION) ||
 #else
-				sc->data[SC_ROKISWEIL] != NULL ||
+				SC_ENTRY(sc, SC_ROKISWEIL) != NULL ||
 #endif
-				(sc->data[SC_HERMODE] && skill->get_inf(skill_id) & INF_SUPPORT_SKILL) ||
+				(SC_ENTRY(sc, SC_HERMODE) && skill->get_inf(skill_id) & INF_SUPPORT_SKILL) ||
 				pc_ismuted(sc, MANNER_NOSKILL)
 				)
 				return 0;
 
-			if( sc->data[SC__MANHOLE] || ((tsc = status->get_sc(target)) && tsc->data[SC__MANHOLE]) ) {
+			if( SC_ENTRY(sc, SC__MANHOLE) || ((tsc = status->get_sc(target)) && SC_ENTRY(tsc, SC__MANHOLE)) ) {
 				switch(skill_id) {//##TODO## make this a flag in skill_db?
 					// Skills that can be used even under Man Hole effects.
 				case SC_SHADOWFORM:
@@ -999,7 +999,7 @@ static int status_check_skilluse(struct block_list *src, struct block_list *targ
 			}
 		}
 		if ( sc->option&OPTION_CHASEWALK ) {
-			if ( sc->data[SC__INVISIBILITY] ) {
+			if ( SC_ENTRY(sc, SC__INVISIBILITY) ) {
 				if ( skill_id != 0 && skill_id != SC_INVISIBILITY )
 					return 0;
 			} else if ( skill_id != ST_CHASEWALK )
@@ -1014,16 +1014,16 @@ static int status_check_skilluse(struct block_list *src, struct block_list *targ
 
 	if(tsc && tsc->count) {
 		/* attacks in invincible are capped to 1 damage and handled in batte.c; allow spell break and eske for sealed shrine GDB when in INVINCIBLE state. */
-		if( tsc->data[SC_INVINCIBLE] && !tsc->data[SC_INVINCIBLEOFF] && skill_id && !(skill_id&(SA_SPELLBREAKER|SL_SKE)) )
+		if( SC_ENTRY(tsc, SC_INVINCIBLE) && !SC_ENTRY(tsc, SC_INVINCIBLEOFF) && skill_id && !(skill_id&(SA_SPELLBREAKER|SL_SKE)) )
 			return 0;
-		if(!skill_id && tsc->data[SC_TRICKDEAD])
+		if(!skill_id && SC_ENTRY(tsc, SC_TRICKDEAD))
 			return 0;
 		if((skill_id == WZ_STORMGUST || skill_id == WZ_FROSTNOVA || skill_id == NJ_HYOUSYOURAKU)
-			&& tsc->data[SC_FREEZE])
+			&& SC_ENTRY(tsc, SC_FREEZE))
 			return 0;
-		if(skill_id == PR_LEXAETERNA && (tsc->data[SC_FREEZE] || (tsc->data[SC_STONE] && tsc->opt1 == OPT1_STONE)))
+		if(skill_id == PR_LEXAETERNA && (SC_ENTRY(tsc, SC_FREEZE) || (SC_ENTRY(tsc, SC_STONE) && tsc->opt1 == OPT1_STONE)))
 			return 0;
-		if( ( tsc->data[SC_STEALTHFIELD] || tsc->data[SC_CAMOUFLAGE] ) && !(st->mode&(MD_BOSS|MD_DETECTOR)) && flag == 4 )
+		if( ( SC_ENTRY(tsc, SC_STEALTHFIELD) || SC_ENTRY(tsc, SC_CAMOUFLAGE) ) && !(st->mode&(MD_BOSS|MD_DETECTOR)) && flag == 4 )
 			return 0;
 	}
 	//If targeting, cloak+hide protect you, otherwise only hiding does.
@@ -1045,12 +1045,12 @@ static int status_check_skilluse(struct block_list *src, struct block_list *targ
 			if (tsc != NULL) {
 				if (tsc->option&hide_flag
 					&& !is_boss
-					&& (tsd->special_state.perfect_hiding || !is_detect || tsc->data[SC_CLOAKINGEXCEED] != NULL || tsc->data[SC_NEWMOON] != NULL)
+					&& (tsd->special_state.perfect_hiding || !is_detect || SC_ENTRY(tsc, SC_CLOAKINGEXCEED) != NULL || SC_ENTRY(tsc, SC_NEWMOON) != NULL)
 				)
 					return 0;
-				if (tsc->data[SC_CAMOUFLAGE] && !(is_boss || is_detect) && flag == 0)
+				if (SC_ENTRY(tsc, SC_CAMOUFLAGE) && !(is_boss || is_detect) && flag == 0)
 					return 0;
-				if (tsc->data[SC_STEALTHFIELD] && !is_boss)
+				if (SC_ENTRY(tsc, SC_STEALTHFIELD) && !is_boss)
 					return 0;
 			}
 		}
@@ -1083,7 +1083,7 @@ static int status_check_skilluse(struct block_list *src, struct block_list *targ
 			if( tsc ) {
 				if( tsc->option&hide_flag && !(st->mode&(MD_BOSS|MD_DETECTOR)))
 					return 0;
-				if( tsc->data[SC_STEALTHFIELD] && !(st->mode&MD_BOSS) )
+				if( SC_ENTRY(tsc, SC_STEALTHFIELD) && !(st->mode&MD_BOSS) )
 					return 0;
 			}
 	}
@@ -1522,7 +1522,7 @@ static int status_calc_pc_(struct map_session_data *sd, enum e_status_calc_opt o
 	memset(ZEROED_BLOCK_POS(&(sd->right_weapon)), 0, ZEROED_BLOCK_SIZE(&(sd->right_weapon)));
 	memset(ZEROED_BLOCK_POS(&(sd->left_weapon)), 0, ZEROED_BLOCK_SIZE(&(sd->left_weapon)));
 
-	if (sd->special_state.intravision && !sd->sc.data[SC_CLAIRVOYANCE]) //Clear intravision as long as nothing else is using it
+	if (sd->special_state.intravision && !SC_ENTRY(&sd->sc, SC_CLAIRVOYANCE)) //Clear intravision as long as nothing else is using it
 		clif->sc_end(&sd->bl, sd->bl.id, SELF, status->get_sc_icon(SC_CLAIRVOYANCE));
 
 	memset(&sd->special_state,0,sizeof(sd->special_state));
@@ -2174,8 +2174,8 @@ static int status_calc_pc_(struct map_session_data *sd, enum e_status_calc_opt o
 		sd->max_weight += 10000;
 	else if(pc_isridingdragon(sd))
 		sd->max_weight += 5000+2000*pc->checkskill(sd,RK_DRAGONTRAINING);
-	if(sc->data[SC_KNOWLEDGE])
-		sd->max_weight += sd->max_weight*sc->data[SC_KNOWLEDGE]->val1/10;
+	if(SC_ENTRY(sc, SC_KNOWLEDGE))
+		sd->max_weight += sd->max_weight*SC_ENTRY(sc, SC_KNOWLEDGE)->val1/10;
 	if((skill_lv=pc->checkskill(sd,ALL_INCCARRY))>0)
 		sd->max_weight += 2000*skill_lv;
 
@@ -2190,14 +2190,14 @@ static int status_calc_pc_(struct map_session_data *sd, enum e_status_calc_opt o
 	if((skill_lv=pc->checkskill(sd,HP_MANARECHARGE))>0 )
 		sd->dsprate -= 4*skill_lv;
 
-	if(sc->data[SC_SERVICEFORYOU])
-		sd->dsprate -= sc->data[SC_SERVICEFORYOU]->val3;
+	if(SC_ENTRY(sc, SC_SERVICEFORYOU))
+		sd->dsprate -= SC_ENTRY(sc, SC_SERVICEFORYOU)->val3;
 
-	if(sc->data[SC_ATKER_BLOOD])
-		sd->dsprate -= sc->data[SC_ATKER_BLOOD]->val1;
+	if(SC_ENTRY(sc, SC_ATKER_BLOOD))
+		sd->dsprate -= SC_ENTRY(sc, SC_ATKER_BLOOD)->val1;
 
 #ifdef RENEWAL
-	if (sc->data[SC_NIBELUNGEN] != NULL && sc->data[SC_NIBELUNGEN]->val2 == RINGNBL_EFF_SP_CONSUMPTION)
+	if (SC_ENTRY(sc, SC_NIBELUNGEN) != NULL && SC_ENTRY(sc, SC_NIBELUNGEN)->val2 == RINGNBL_EFF_SP_CONSUMPTION)
 		sd->dsprate -= 30;
 #endif
 
@@ -2256,12 +2256,12 @@ static int status_calc_pc_(struct map_session_data *sd, enum e_status_calc_opt o
 	}
 
 	if (sc->count) {
-		if (sc->data[SC_CONCENTRATION]) { // Update the card-bonus data
-			sc->data[SC_CONCENTRATION]->val3 = sd->param_bonus[1]; // Agi
-			sc->data[SC_CONCENTRATION]->val4 = sd->param_bonus[4]; // Dex
+		if (SC_ENTRY(sc, SC_CONCENTRATION)) { // Update the card-bonus data
+			SC_ENTRY(sc, SC_CONCENTRATION)->val3 = sd->param_bonus[1]; // Agi
+			SC_ENTRY(sc, SC_CONCENTRATION)->val4 = sd->param_bonus[4]; // Dex
 		}
-		if (sc->data[SC_SIEGFRIED]){
-			i = sc->data[SC_SIEGFRIED]->val2;
+		if (SC_ENTRY(sc, SC_SIEGFRIED)){
+			i = SC_ENTRY(sc, SC_SIEGFRIED)->val2;
 			sd->subele[ELE_WATER] += i;
 			sd->subele[ELE_EARTH] += i;
 			sd->subele[ELE_FIRE] += i;
@@ -2272,65 +2272,65 @@ static int status_calc_pc_(struct map_session_data *sd, enum e_status_calc_opt o
 			sd->subele[ELE_GHOST] += i;
 			sd->subele[ELE_UNDEAD] += i;
 		}
-		if (sc->data[SC_PROVIDENCE]){
-			sd->subele[ELE_HOLY] += sc->data[SC_PROVIDENCE]->val2;
+		if (SC_ENTRY(sc, SC_PROVIDENCE)){
+			sd->subele[ELE_HOLY] += SC_ENTRY(sc, SC_PROVIDENCE)->val2;
 #ifdef RENEWAL
-			sd->race_tolerance[RC_DEMON] += sc->data[SC_PROVIDENCE]->val2;
+			sd->race_tolerance[RC_DEMON] += SC_ENTRY(sc, SC_PROVIDENCE)->val2;
 #else
-			sd->subrace[RC_DEMON] += sc->data[SC_PROVIDENCE]->val2;
+			sd->subrace[RC_DEMON] += SC_ENTRY(sc, SC_PROVIDENCE)->val2;
 #endif
 		}
-		if (sc->data[SC_ARMORPROPERTY]) {
+		if (SC_ENTRY(sc, SC_ARMORPROPERTY)) {
 			//This status change should grant card-type elemental resist.
-			sd->subele[ELE_WATER] += sc->data[SC_ARMORPROPERTY]->val1;
-			sd->subele[ELE_EARTH] += sc->data[SC_ARMORPROPERTY]->val2;
-			sd->subele[ELE_FIRE] += sc->data[SC_ARMORPROPERTY]->val3;
-			sd->subele[ELE_WIND] += sc->data[SC_ARMORPROPERTY]->val4;
-		}
-		if (sc->data[SC_ARMOR_RESIST]) { // Undead Scroll
-			sd->subele[ELE_WATER] += sc->data[SC_ARMOR_RESIST]->val1;
-			sd->subele[ELE_EARTH] += sc->data[SC_ARMOR_RESIST]->val2;
-			sd->subele[ELE_FIRE] += sc->data[SC_ARMOR_RESIST]->val3;
-			sd->subele[ELE_WIND] += sc->data[SC_ARMOR_RESIST]->val4;
-		}
-		if (sc->data[SC_RESIST_PROPERTY_WATER] != NULL) { // Coldproof Potion
-			sd->subele[ELE_WATER] += sc->data[SC_RESIST_PROPERTY_WATER]->val1;
-			sd->subele[ELE_WIND] += sc->data[SC_RESIST_PROPERTY_WATER]->val2;
-		}
-		if (sc->data[SC_RESIST_PROPERTY_GROUND] != NULL) { // Earthproof Potion
-			sd->subele[ELE_EARTH] += sc->data[SC_RESIST_PROPERTY_GROUND]->val1;
-			sd->subele[ELE_FIRE] += sc->data[SC_RESIST_PROPERTY_GROUND]->val2;
-		}
-		if (sc->data[SC_RESIST_PROPERTY_FIRE] != NULL) { // Fireproof Potion
-			sd->subele[ELE_FIRE] += sc->data[SC_RESIST_PROPERTY_FIRE]->val1;
-			sd->subele[ELE_WATER] += sc->data[SC_RESIST_PROPERTY_FIRE]->val2;
-		}
-		if (sc->data[SC_RESIST_PROPERTY_WIND] != NULL) { // Thunderproof Potion
-			sd->subele[ELE_WIND] += sc->data[SC_RESIST_PROPERTY_WIND]->val1;
-			sd->subele[ELE_EARTH] += sc->data[SC_RESIST_PROPERTY_WIND]->val2;
-		}
-		if (sc->data[SC_FIRE_CLOAK_OPTION]) {
-			i = sc->data[SC_FIRE_CLOAK_OPTION]->val2;
+			sd->subele[ELE_WATER] += SC_ENTRY(sc, SC_ARMORPROPERTY)->val1;
+			sd->subele[ELE_EARTH] += SC_ENTRY(sc, SC_ARMORPROPERTY)->val2;
+			sd->subele[ELE_FIRE] += SC_ENTRY(sc, SC_ARMORPROPERTY)->val3;
+			sd->subele[ELE_WIND] += SC_ENTRY(sc, SC_ARMORPROPERTY)->val4;
+		}
+		if (SC_ENTRY(sc, SC_ARMOR_RESIST)) { // Undead Scroll
+			sd->subele[ELE_WATER] += SC_ENTRY(sc, SC_ARMOR_RESIST)->val1;
+			sd->subele[ELE_EARTH] += SC_ENTRY(sc, SC_ARMOR_RESIST)->val2;
+			sd->subele[ELE_FIRE] += SC_ENTRY(sc, SC_ARMOR_RESIST)->val3;
+			sd->subele[ELE_WIND] += SC_ENTRY(sc, SC_ARMOR_RESIST)->val4;
+		}
+		if (SC_ENTRY(sc, SC_RESIST_PROPERTY_WATER) != NULL) { // Coldproof Potion
+			sd->subele[ELE_WATER] += SC_ENTRY(sc, SC_RESIST_PROPERTY_WATER)->val1;
+			sd->subele[ELE_WIND] += SC_ENTRY(sc, SC_RESIST_PROPERTY_WATER)->val2;
+		}
+		if (SC_ENTRY(sc, SC_RESIST_PROPERTY_GROUND) != NULL) { // Earthproof Potion
+			sd->subele[ELE_EARTH] += SC_ENTRY(sc, SC_RESIST_PROPERTY_GROUND)->val1;
+			sd->subele[ELE_FIRE] += SC_ENTRY(sc, SC_RESIST_PROPERTY_GROUND)->val2;
+		}
+		if (SC_ENTRY(sc, SC_RESIST_PROPERTY_FIRE) != NULL) { // Fireproof Potion
+			sd->subele[ELE_FIRE] += SC_ENTRY(sc, SC_RESIST_PROPERTY_FIRE)->val1;
+			sd->subele[ELE_WATER] += SC_ENTRY(sc, SC_RESIST_PROPERTY_FIRE)->val2;
+		}
+		if (SC_ENTRY(sc, SC_RESIST_PROPERTY_WIND) != NULL) { // Thunderproof Potion
+			sd->subele[ELE_WIND] += SC_ENTRY(sc, SC_RESIST_PROPERTY_WIND)->val1;
+			sd->subele[ELE_EARTH] += SC_ENTRY(sc, SC_RESIST_PROPERTY_WIND)->val2;
+		}
+		if (SC_ENTRY(sc, SC_FIRE_CLOAK_OPTION)) {
+			i = SC_ENTRY(sc, SC_FIRE_CLOAK_OPTION)->val2;
 			sd->subele[ELE_FIRE] += i;
 			sd->subele[ELE_WATER] -= i;
 		}
-		if (sc->data[SC_WATER_DROP_OPTION]) {
-			i = sc->data[SC_WATER_DROP_OPTION]->val2;
+		if (SC_ENTRY(sc, SC_WATER_DROP_OPTION)) {
+			i = SC_ENTRY(sc, SC_WATER_DROP_OPTION)->val2;
 			sd->subele[ELE_WATER] += i;
 			sd->subele[ELE_WIND] -= i;
 		}
-		if (sc->data[SC_WIND_CURTAIN_OPTION]) {
-			i = sc->data[SC_WIND_CURTAIN_OPTION]->val2;
+		if (SC_ENTRY(sc, SC_WIND_CURTAIN_OPTION)) {
+			i = SC_ENTRY(sc, SC_WIND_CURTAIN_OPTION)->val2;
 			sd->subele[ELE_WIND] += i;
 			sd->subele[ELE_EARTH] -= i;
 		}
-		if (sc->data[SC_STONE_SHIELD_OPTION]) {
-			i = sc->data[SC_STONE_SHIELD_OPTION]->val2;
+		if (SC_ENTRY(sc, SC_STONE_SHIELD_OPTION)) {
+			i = SC_ENTRY(sc, SC_STONE_SHIELD_OPTION)->val2;
 			sd->subele[ELE_EARTH] += i;
 			sd->subele[ELE_FIRE] -= i;
 		}
-		if (sc->data[SC_POPECOOKIE] != NULL) {
-			i = sc->data[SC_POPECOOKIE]->val3;
+		if (SC_ENTRY(sc, SC_POPECOOKIE) != NULL) {
+			i = SC_ENTRY(sc, SC_POPECOOKIE)->val3;
 			sd->subele[ELE_WATER] += i;
 			sd->subele[ELE_EARTH] += i;
 			sd->subele[ELE_FIRE] += i;
@@ -2341,75 +2341,75 @@ static int status_calc_pc_(struct map_session_data *sd, enum e_status_calc_opt o
 			sd->subele[ELE_GHOST] += i;
 			sd->subele[ELE_UNDEAD] += i;
 		}
-		if (sc->data[SC_MTF_MLEATKED])
-			sd->subele[ELE_NEUTRAL] += sc->data[SC_MTF_MLEATKED]->val1;
-		if (sc->data[SC_FIRE_INSIGNIA] && sc->data[SC_FIRE_INSIGNIA]->val1 == 3)
+		if (SC_ENTRY(sc, SC_MTF_MLEATKED))
+			sd->subele[ELE_NEUTRAL] += SC_ENTRY(sc, SC_MTF_MLEATKED)->val1;
+		if (SC_ENTRY(sc, SC_FIRE_INSIGNIA) && SC_ENTRY(sc, SC_FIRE_INSIGNIA)->val1 == 3)
 			sd->magic_addele[ELE_FIRE] += 25;
-		if (sc->data[SC_WATER_INSIGNIA] && sc->data[SC_WATER_INSIGNIA]->val1 == 3)
+		if (SC_ENTRY(sc, SC_WATER_INSIGNIA) && SC_ENTRY(sc, SC_WATER_INSIGNIA)->val1 == 3)
 			sd->magic_addele[ELE_WATER] += 25;
-		if (sc->data[SC_WIND_INSIGNIA] && sc->data[SC_WIND_INSIGNIA]->val1 == 3)
+		if (SC_ENTRY(sc, SC_WIND_INSIGNIA) && SC_ENTRY(sc, SC_WIND_INSIGNIA)->val1 == 3)
 			sd->magic_addele[ELE_WIND] += 25;
-		if (sc->data[SC_EARTH_INSIGNIA] && sc->data[SC_EARTH_INSIGNIA]->val1 == 3)
+		if (SC_ENTRY(sc, SC_EARTH_INSIGNIA) && SC_ENTRY(sc, SC_EARTH_INSIGNIA)->val1 == 3)
 			sd->magic_addele[ELE_EARTH] += 25;
 
 #ifdef RENEWAL
-		if (sc->data[SC_PROPERTYFIRE] != NULL)
-			sd->magic_atk_ele[ELE_FIRE] += sc->data[SC_PROPERTYFIRE]->val1;
-		if (sc->data[SC_PROPERTYWATER] != NULL)
-			sd->magic_atk_ele[ELE_WATER] += sc->data[SC_PROPERTYWATER]->val1;
-		if (sc->data[SC_PROPERTYWIND] != NULL)
-			sd->magic_atk_ele[ELE_WIND] += sc->data[SC_PROPERTYWIND]->val1;
-		if (sc->data[SC_PROPERTYGROUND] != NULL)
-			sd->magic_atk_ele[ELE_EARTH] += sc->data[SC_PROPERTYGROUND]->val1;
-#endif
-		if (sc->data[SC_BASILICA_BUFF] != NULL)
-			sd->magic_atk_ele[ELE_HOLY] += sc->data[SC_BASILICA_BUFF]->val1;
+		if (SC_ENTRY(sc, SC_PROPERTYFIRE) != NULL)
+			sd->magic_atk_ele[ELE_FIRE] += SC_ENTRY(sc, SC_PROPERTYFIRE)->val1;
+		if (SC_ENTRY(sc, SC_PROPERTYWATER) != NULL)
+			sd->magic_atk_ele[ELE_WATER] += SC_ENTRY(sc, SC_PROPERTYWATER)->val1;
+		if (SC_ENTRY(sc, SC_PROPERTYWIND) != NULL)
+			sd->magic_atk_ele[ELE_WIND] += SC_ENTRY(sc, SC_PROPERTYWIND)->val1;
+		if (SC_ENTRY(sc, SC_PROPERTYGROUND) != NULL)
+			sd->magic_atk_ele[ELE_EARTH] += SC_ENTRY(sc, SC_PROPERTYGROUND)->val1;
+#endif
+		if (SC_ENTRY(sc, SC_BASILICA_BUFF) != NULL)
+			sd->magic_atk_ele[ELE_HOLY] += SC_ENTRY(sc, SC_BASILICA_BUFF)->val1;
 
 		// Geffen Scrolls
-		if (sc->data[SC_SKELSCROLL]) {
+		if (SC_ENTRY(sc, SC_SKELSCROLL)) {
 #ifdef RENEWAL
-			sd->race_tolerance[RC_DEMIHUMAN] += sc->data[SC_SKELSCROLL]->val1;
+			sd->race_tolerance[RC_DEMIHUMAN] += SC_ENTRY(sc, SC_SKELSCROLL)->val1;
 #else
-			sd->subrace[RC_DEMIHUMAN] += sc->data[SC_SKELSCROLL]->val1;
+			sd->subrace[RC_DEMIHUMAN] += SC_ENTRY(sc, SC_SKELSCROLL)->val1;
 #endif
 		}
-		if (sc->data[SC_DISTRUCTIONSCROLL]) {
-			sd->right_weapon.addrace[RC_ANGEL] += sc->data[SC_DISTRUCTIONSCROLL]->val1;
-			sd->left_weapon.addrace[RC_ANGEL] += sc->data[SC_DISTRUCTIONSCROLL]->val1;
-			sd->right_weapon.addele[ELE_HOLY] += sc->data[SC_DISTRUCTIONSCROLL]->val1;
-			sd->left_weapon.addele[ELE_HOLY] += sc->data[SC_DISTRUCTIONSCROLL]->val1;
-			sd->right_weapon.addrace[RC_BOSS] += sc->data[SC_DISTRUCTIONSCROLL]->val1;
-			sd->left_weapon.addrace[RC_BOSS] += sc->data[SC_DISTRUCTIONSCROLL]->val1;
+		if (SC_ENTRY(sc, SC_DISTRUCTIONSCROLL)) {
+			sd->right_weapon.addrace[RC_ANGEL] += SC_ENTRY(sc, SC_DISTRUCTIONSCROLL)->val1;
+			sd->left_weapon.addrace[RC_ANGEL] += SC_ENTRY(sc, SC_DISTRUCTIONSCROLL)->val1;
+			sd->right_weapon.addele[ELE_HOLY] += SC_ENTRY(sc, SC_DISTRUCTIONSCROLL)->val1;
+			sd->left_weapon.addele[ELE_HOLY] += SC_ENTRY(sc, SC_DISTRUCTIONSCROLL)->val1;
+			sd->right_weapon.addrace[RC_BOSS] += SC_ENTRY(sc, SC_DISTRUCTIONSCROLL)->val1;
+			sd->left_weapon.addrace[RC_BOSS] += SC_ENTRY(sc, SC_DISTRUCTIONSCROLL)->val1;
 		}
-		if (sc->data[SC_ROYALSCROLL]) {
+		if (SC_ENTRY(sc, SC_ROYALSCROLL)) {
 #ifdef RENEWAL
-			sd->race_tolerance[RC_BOSS] += sc->data[SC_ROYALSCROLL]->val1;
+			sd->race_tolerance[RC_BOSS] += SC_ENTRY(sc, SC_ROYALSCROLL)->val1;
 #else
-			sd->subrace[RC_BOSS] += sc->data[SC_ROYALSCROLL]->val1;
+			sd->subrace[RC_BOSS] += SC_ENTRY(sc, SC_ROYALSCROLL)->val1;
 #endif
 		}
-		if (sc->data[SC_IMMUNITYSCROLL])
-			sd->subele[ELE_NEUTRAL] += sc->data[SC_IMMUNITYSCROLL]->val1;
+		if (SC_ENTRY(sc, SC_IMMUNITYSCROLL))
+			sd->subele[ELE_NEUTRAL] += SC_ENTRY(sc, SC_IMMUNITYSCROLL)->val1;
 
 		// Geffen Magic Tournament
-		if (sc->data[SC_GEFFEN_MAGIC1]) {
-			sd->right_weapon.addrace[RC_DEMIHUMAN] += sc->data[SC_GEFFEN_MAGIC1]->val1;
-			sd->left_weapon.addrace[RC_DEMIHUMAN] += sc->data[SC_GEFFEN_MAGIC1]->val1;
+		if (SC_ENTRY(sc, SC_GEFFEN_MAGIC1)) {
+			sd->right_weapon.addrace[RC_DEMIHUMAN] += SC_ENTRY(sc, SC_GEFFEN_MAGIC1)->val1;
+			sd->left_weapon.addrace[RC_DEMIHUMAN] += SC_ENTRY(sc, SC_GEFFEN_MAGIC1)->val1;
 		}
-		if (sc->data[SC_GEFFEN_MAGIC2])
-			sd->magic_addrace[RC_DEMIHUMAN] += sc->data[SC_GEFFEN_MAGIC2]->val1;
-		if (sc->data[SC_GEFFEN_MAGIC3]) {
+		if (SC_ENTRY(sc, SC_GEFFEN_MAGIC2))
+			sd->magic_addrace[RC_DEMIHUMAN] += SC_ENTRY(sc, SC_GEFFEN_MAGIC2)->val1;
+		if (SC_ENTRY(sc, SC_GEFFEN_MAGIC3)) {
 #ifdef RENEWAL
-			sd->race_tolerance[RC_DEMIHUMAN] += sc->data[SC_GEFFEN_MAGIC3]->val1;
+			sd->race_tolerance[RC_DEMIHUMAN] += SC_ENTRY(sc, SC_GEFFEN_MAGIC3)->val1;
 #else
-			sd->subrace[RC_DEMIHUMAN] += sc->data[SC_GEFFEN_MAGIC3]->val1;
+			sd->subrace[RC_DEMIHUMAN] += SC_ENTRY(sc, SC_GEFFEN_MAGIC3)->val1;
 #endif
 		}
-		if (sc->data[SC_CUP_OF_BOZA])
-			sd->subele[ELE_FIRE] += sc->data[SC_CUP_OF_BOZA]->val2;
-		if (sc->data[SC_PHI_DEMON]) {
-			sd->right_weapon.addrace[RC_DEMON] += sc->data[SC_PHI_DEMON]->val1;
-			sd->left_weapon.addrace[RC_DEMON] += sc->data[SC_PHI_DEMON]->val1;
+		if (SC_ENTRY(sc, SC_CUP_OF_BOZA))
+			sd->subele[ELE_FIRE] += SC_ENTRY(sc, SC_CUP_OF_BOZA)->val2;
+		if (SC_ENTRY(sc, SC_PHI_DEMON)) {
+			sd->right_weapon.addrace[RC_DEMON] += SC_ENTRY(sc, SC_PHI_DEMON)->val1;
+			sd->left_weapon.addrace[RC_DEMON] += SC_ENTRY(sc, SC_PHI_DEMON)->val1;
 		}
 	}
 	status->copy(&sd->battle_status, bstatus);
@@ -2656,28 +2656,28 @@ static void status_calc_regen_pc(struct map_session_data *sd, struct status_data
 
 	struct status_change *sc = &sd->sc;
 
-	if ((sc->data[SC_POISON] != NULL && sc->data[SC_SLOWPOISON] == NULL)
-		|| (sc->data[SC_DPOISON] != NULL && sc->data[SC_SLOWPOISON] == NULL)
-		|| sc->data[SC_BERSERK] != NULL
-		|| sc->data[SC_TRICKDEAD] != NULL
-		|| sc->data[SC_BLOODING] != NULL
-		|| sc->data[SC_MAGICMUSHROOM] != NULL
-		|| sc->data[SC_RAISINGDRAGON] != NULL
-		|| sc->data[SC_SATURDAY_NIGHT_FEVER] != NULL
+	if ((SC_ENTRY(sc, SC_POISON) != NULL && SC_ENTRY(sc, SC_SLOWPOISON) == NULL)
+		|| (SC_ENTRY(sc, SC_DPOISON) != NULL && SC_ENTRY(sc, SC_SLOWPOISON) == NULL)
+		|| SC_ENTRY(sc, SC_BERSERK) != NULL
+		|| SC_ENTRY(sc, SC_TRICKDEAD) != NULL
+		|| SC_ENTRY(sc, SC_BLOODING) != NULL
+		|| SC_ENTRY(sc, SC_MAGICMUSHROOM) != NULL
+		|| SC_ENTRY(sc, SC_RAISINGDRAGON) != NULL
+		|| SC_ENTRY(sc, SC_SATURDAY_NIGHT_FEVER) != NULL
 		) {
 		regen->flag = 0;
 		return; // Don't bother going on as no regen under those status.
 	}
 
-	if (sc->data[SC_DANCING] != NULL
-		|| sc->data[SC_OBLIVIONCURSE] != NULL
-		|| sc->data[SC_MAXIMIZEPOWER] != NULL
-		|| sc->data[SC_REBOUND] != NULL
-		|| sc->data[SC_VITALITYACTIVATION] != NULL
+	if (SC_ENTRY(sc, SC_DANCING) != NULL
+		|| SC_ENTRY(sc, SC_OBLIVIONCURSE) != NULL
+		|| SC_ENTRY(sc, SC_MAXIMIZEPOWER) != NULL
+		|| SC_ENTRY(sc, SC_REBOUND) != NULL
+		|| SC_ENTRY(sc, SC_VITALITYACTIVATION) != NULL
 		|| ((sd->job & MAPID_UPPERMASK) == MAPID_MONK
-			&& (sc->data[SC_EXTREMITYFIST] != NULL
-				|| (sc->data[SC_EXPLOSIONSPIRITS] != NULL
-					&& (sc->data[SC_SOULLINK] == NULL || sc->data[SC_SOULLINK]->val2 != SL_MONK)
+			&& (SC_ENTRY(sc, SC_EXTREMITYFIST) != NULL
+				|| (SC_ENTRY(sc, SC_EXPLOSIONSPIRITS) != NULL
+					&& (SC_ENTRY(sc, SC_SOULLINK) == NULL || SC_ENTRY(sc, SC_SOULLINK)->val2 != SL_MONK)
 					)
 				)
 			)
@@ -2685,8 +2685,8 @@ static void status_calc_regen_pc(struct map_session_data *sd, struct status_data
 		regen->flag &= ~RGN_SP; //No natural SP regen
 	}
 
-	if (sc->data[SC_GDSKILL_REGENERATION] != NULL && sc->data[SC_GDSKILL_REGENERATION]->val4 != 0) {
-			regen->flag &= ~sc->data[SC_GDSKILL_REGENERATION]->val4; //Remove regen as specified by val4
+	if (SC_ENTRY(sc, SC_GDSKILL_REGENERATION) != NULL && SC_ENTRY(sc, SC_GDSKILL_REGENERATION)->val4 != 0) {
+			regen->flag &= ~SC_ENTRY(sc, SC_GDSKILL_REGENERATION)->val4; //Remove regen as specified by val4
 	}
 
 	// Base HP/SP restore values formual
@@ -2708,21 +2708,21 @@ static void status_calc_regen_pc(struct map_session_data *sd, struct status_data
 	if ((skill_lv = pc->checkskill(sd, HP_MEDITATIO)) > 0)
 		regen->sp = regen->sp * (100 + 3 * skill_lv) / 100;
 
-	if (sc->data[SC_GENTLETOUCH_REVITALIZE] != NULL)
-		regen->hp += regen->hp * (30 * sc->data[SC_GENTLETOUCH_REVITALIZE]->val1 + 50) / 100;
+	if (SC_ENTRY(sc, SC_GENTLETOUCH_REVITALIZE) != NULL)
+		regen->hp += regen->hp * (30 * SC_ENTRY(sc, SC_GENTLETOUCH_REVITALIZE)->val1 + 50) / 100;
 
 	// Recovery Items
-	if (sc->data[SC_EXTRACT_WHITE_POTION_Z] != NULL)
-		regen->hp += regen->hp * sc->data[SC_EXTRACT_WHITE_POTION_Z]->val1 / 100;
-	if (sc->data[SC_VITATA_500] != NULL)
-		regen->sp += regen->sp * sc->data[SC_VITATA_500]->val1 / 100;
-	if (sc->data[SC_ATKER_ASPD] != NULL)
-		regen->hp += regen->hp * sc->data[SC_ATKER_ASPD]->val2 / 100;
-	if (sc->data[SC_ATKER_MOVESPEED] != NULL)
-		regen->sp += regen->sp * sc->data[SC_ATKER_MOVESPEED]->val2 / 100;
-	if (sc->data[SC_BUCHEDENOEL] != NULL) {
-		regen->hp += regen->hp * sc->data[SC_BUCHEDENOEL]->val1 / 100;
-		regen->sp += regen->sp * sc->data[SC_BUCHEDENOEL]->val2 / 100;
+	if (SC_ENTRY(sc, SC_EXTRACT_WHITE_POTION_Z) != NULL)
+		regen->hp += regen->hp * SC_ENTRY(sc, SC_EXTRACT_WHITE_POTION_Z)->val1 / 100;
+	if (SC_ENTRY(sc, SC_VITATA_500) != NULL)
+		regen->sp += regen->sp * SC_ENTRY(sc, SC_VITATA_500)->val1 / 100;
+	if (SC_ENTRY(sc, SC_ATKER_ASPD) != NULL)
+		regen->hp += regen->hp * SC_ENTRY(sc, SC_ATKER_ASPD)->val2 / 100;
+	if (SC_ENTRY(sc, SC_ATKER_MOVESPEED) != NULL)
+		regen->sp += regen->sp * SC_ENTRY(sc, SC_ATKER_MOVESPEED)->val2 / 100;
+	if (SC_ENTRY(sc, SC_BUCHEDENOEL) != NULL) {
+		regen->hp += regen->hp * SC_ENTRY(sc, SC_BUCHEDENOEL)->val1 / 100;
+		regen->sp += regen->sp * SC_ENTRY(sc, SC_BUCHEDENOEL)->val2 / 100;
 	}
 
 	// Skill HP/SP restore bonuses
@@ -2768,9 +2768,9 @@ static void status_calc_regen_homunculus(struct homun_data *hd, struct status_da
 
 	struct status_change *sc = &hd->sc;
 
-	if ((sc->data[SC_POISON] != NULL && sc->data[SC_SLOWPOISON] == NULL)
-		|| (sc->data[SC_DPOISON] != NULL && sc->data[SC_SLOWPOISON] == NULL)
-		|| sc->data[SC_BLOODING] != NULL
+	if ((SC_ENTRY(sc, SC_POISON) != NULL && SC_ENTRY(sc, SC_SLOWPOISON) == NULL)
+		|| (SC_ENTRY(sc, SC_DPOISON) != NULL && SC_ENTRY(sc, SC_SLOWPOISON) == NULL)
+		|| SC_ENTRY(sc, SC_BLOODING) != NULL
 		) {
 		regen->flag = 0;
 		return; // Don't bother going on as no regen under those status.
@@ -2791,9 +2791,9 @@ static void status_calc_regen_mercenary(struct mercenary_data *md, struct status
 
 	struct status_change *sc = &md->sc;
 
-	if ((sc->data[SC_POISON] != NULL && sc->data[SC_SLOWPOISON] == NULL)
-		|| (sc->data[SC_DPOISON] != NULL && sc->data[SC_SLOWPOISON] == NULL)
-		|| sc->data[SC_BLOODING] != NULL
+	if ((SC_ENTRY(sc, SC_POISON) != NULL && SC_ENTRY(sc, SC_SLOWPOISON) == NULL)
+		|| (SC_ENTRY(sc, SC_DPOISON) != NULL && SC_ENTRY(sc, SC_SLOWPOISON) == NULL)
+		|| SC_ENTRY(sc, SC_BLOODING) != NULL
 		) {
 		regen->flag = 0;
 		return; // Don't bother going on as no regen under those status.
@@ -2812,9 +2812,9 @@ static void status_calc_regen_elemental(struct elemental_data *md, struct status
 
 	struct status_change *sc = &md->sc;
 
-	if ((sc->data[SC_POISON] != NULL && sc->data[SC_SLOWPOISON] == NULL)
-		|| (sc->data[SC_DPOISON] != NULL && sc->data[SC_SLOWPOISON] == NULL)
-		|| sc->data[SC_BLOODING] != NULL
+	if ((SC_ENTRY(sc, SC_POISON) != NULL && SC_ENTRY(sc, SC_SLOWPOISON) == NULL)
+		|| (SC_ENTRY(sc, SC_DPOISON) != NULL && SC_ENTRY(sc, SC_SLOWPOISON) == NULL)
+		|| SC_ENTRY(sc, SC_BLOODING) != NULL
 		) {
 		regen->flag = 0;
 		return; // Don't bother going on as no regen under those status.
@@ -2894,12 +2894,12 @@ static void status_calc_regen_rate_pc(struct map_session_data *sd, struct regen_
 	}
 
 	struct status_change *sc = &sd->sc;
-	if (sc->data[SC_MAGNIFICAT] != NULL) {
+	if (SC_ENTRY(sc, SC_MAGNIFICAT) != NULL) {
 		regen->rate.sp *= 2;
 	}
 
-	if (sc->data[SC_GDSKILL_REGENERATION] != NULL) {
-		const struct status_change_entry *sce = sc->data[SC_GDSKILL_REGENERATION];
+	if (SC_ENTRY(sc, SC_GDSKILL_REGENERATION) != NULL) {
+		const struct status_change_entry *sce = SC_ENTRY(sc, SC_GDSKILL_REGENERATION);
 		if (sce->val4 == 0) {
 			regen->rate.hp += regen->rate.hp * sce->val2 / 100;
 			regen->rate.sp += regen->rate.sp * sce->val3 / 100;
@@ -2907,11 +2907,11 @@ static void status_calc_regen_rate_pc(struct map_session_data *sd, struct regen_
 	}
 
 #ifdef RENEWAL
-	if (sc->data[SC_APPLEIDUN] != NULL)
-		regen->hp += regen->hp * sc->data[SC_APPLEIDUN]->val3 / 100;
+	if (SC_ENTRY(sc, SC_APPLEIDUN) != NULL)
+		regen->hp += regen->hp * SC_ENTRY(sc, SC_APPLEIDUN)->val3 / 100;
 #endif
 
-	if (sc->data[SC_CATNIPPOWDER] != NULL) {
+	if (SC_ENTRY(sc, SC_CATNIPPOWDER) != NULL) {
 		regen->rate.hp *= 2;
 		regen->rate.sp *= 2;
 	}
@@ -2920,15 +2920,15 @@ static void status_calc_regen_rate_pc(struct map_session_data *sd, struct regen_
 	// in normal HP regeneration and Skill HP regeneration and only if
 	// player is non-overweight otherwise it has no affect to formula
 	// it's also applied last right before the actual heal function call [hemagx]
-	if (regen->state.overweight == 0 && sc->data[SC_TENSIONRELAX] != NULL) {
+	if (regen->state.overweight == 0 && SC_ENTRY(sc, SC_TENSIONRELAX) != NULL) {
 		regen->rate.hp *= 3;
 		regen->skill->rate.hp *= 3;
 	}
 
 #ifdef RENEWAL
-	if (sc->data[SC_NIBELUNGEN] != NULL && sc->data[SC_NIBELUNGEN]->val2 == RINGNBL_EFF_HP_RECOVERY)
+	if (SC_ENTRY(sc, SC_NIBELUNGEN) != NULL && SC_ENTRY(sc, SC_NIBELUNGEN)->val2 == RINGNBL_EFF_HP_RECOVERY)
 		regen->rate.hp += 100;
-	if (sc->data[SC_NIBELUNGEN] != NULL && sc->data[SC_NIBELUNGEN]->val2 == RINGNBL_EFF_SP_RECOVERY)
+	if (SC_ENTRY(sc, SC_NIBELUNGEN) != NULL && SC_ENTRY(sc, SC_NIBELUNGEN)->val2 == RINGNBL_EFF_SP_RECOVERY)
 		regen->rate.sp += 100;
 #endif
 }
@@ -2940,10 +2940,10 @@ static void status_calc_regen_rate_elemental(struct elemental_data *md, struct r
 
 	struct status_change *sc = &md->sc;
 
-	if ((sc->data[SC_FIRE_INSIGNIA] != NULL && sc->data[SC_FIRE_INSIGNIA]->val1 == 1)
-		|| (sc->data[SC_WATER_INSIGNIA] != NULL && sc->data[SC_WATER_INSIGNIA]->val1 == 1)
-		|| (sc->data[SC_EARTH_INSIGNIA] != NULL && sc->data[SC_EARTH_INSIGNIA]->val1 == 1)
-		|| (sc->data[SC_WIND_INSIGNIA] != NULL && sc->data[SC_WIND_INSIGNIA]->val1 == 1))
+	if ((SC_ENTRY(sc, SC_FIRE_INSIGNIA) != NULL && SC_ENTRY(sc, SC_FIRE_INSIGNIA)->val1 == 1)
+		|| (SC_ENTRY(sc, SC_WATER_INSIGNIA) != NULL && SC_ENTRY(sc, SC_WATER_INSIGNIA)->val1 == 1)
+		|| (SC_ENTRY(sc, SC_EARTH_INSIGNIA) != NULL && SC_ENTRY(sc, SC_EARTH_INSIGNIA)->val1 == 1)
+		|| (SC_ENTRY(sc, SC_WIND_INSIGNIA) != NULL && SC_ENTRY(sc, SC_WIND_INSIGNIA)->val1 == 1))
 		regen->rate.hp *= 2;
 }
 
@@ -3454,6 +3454,7 @@ static void status_calc_bl_(struct block_list *bl, e_scb_flag flag, enum e_statu
 {
 	struct status_data bst; // previous battle status
 	struct status_data *st; // pointer to current battle status
+	struct status_change *sc;
 
 	nullpo_retv(bl);
 	if (bl->type == BL_PC) {
@@ -3468,6 +3469,9 @@ static void status_calc_bl_(struct block_list *bl, e_scb_flag flag, enum e_statu
 		}
 	}
 
+	if ((sc = status->get_sc(bl)) != NULL)
+		status->bump_version(sc);
+
 	// remember previous values
 	st = status->get_status_data(bl);
 	memcpy(&bst, st, sizeof(struct status_data));
@@ -3686,12 +3690,12 @@ static int status_check_visibility(struct block_list *src, struct block_list *ta
 
 		switch ( target->type ) { //Check for chase-walk/hiding/cloaking opponents.
 		case BL_PC:
-			if ((tsc->data[SC_CLOAKINGEXCEED] != NULL || tsc->data[SC_NEWMOON] != NULL) && !(st->mode & MD_BOSS))
+			if ((SC_ENTRY(tsc, SC_CLOAKINGEXCEED) != NULL || SC_ENTRY(tsc, SC_NEWMOON) != NULL) && !(st->mode & MD_BOSS))
 				return 0;
 			if ((tsc->option&(OPTION_HIDE | OPTION_CLOAK | OPTION_CHASEWALK)
-			  || tsc->data[SC_STEALTHFIELD] != NULL
-			  || tsc->data[SC__INVISIBILITY] != NULL
-			  || tsc->data[SC_CAMOUFLAGE] != NULL
+			  || SC_ENTRY(tsc, SC_STEALTHFIELD) != NULL
+			  || SC_ENTRY(tsc, SC__INVISIBILITY) != NULL
+			  || SC_ENTRY(tsc, SC_CAMOUFLAGE) != NULL
 			    )
 			 && !(st->mode&MD_BOSS)
 			 && (BL_UCCAST(BL_PC, target)->special_state.perfect_hiding || !(st->mode&MD_DETECTOR)))
@@ -3709,7 +3713,7 @@ static int status_check_visibility(struct block_list *src, struct block_list *ta
 		case BL_PET:
 		case BL_ALL:
 		default:
-			if ( (tsc->option&(OPTION_HIDE | OPTION_CLOAK | OPTION_CHASEWALK) || tsc->data[SC_CAMOUFLAGE]) && !(st->mode&(MD_BOSS | MD_DETECTOR)) )
+			if ( (tsc->option&(OPTION_HIDE | OPTION_CLOAK | OPTION_CHASEWALK) || SC_ENTRY(tsc, SC_CAMOUFLAGE)) && !(st->mode&(MD_BOSS | MD_DETECTOR)) )
 				return 0;
 
 		}
@@ -3998,65 +4002,65 @@ static unsigned short status_calc_str(struct block_list *bl, struct status_chang
 	if(!sc || !sc->count)
 		return cap_value(str,0,USHRT_MAX);
 
-	if(sc->data[SC_FULL_THROTTLE])
+	if(SC_ENTRY(sc, SC_FULL_THROTTLE))
 		str += str * 20 / 100;
-	if(sc->data[SC_HARMONIZE]) {
-		str -= sc->data[SC_HARMONIZE]->val2;
+	if(SC_ENTRY(sc, SC_HARMONIZE)) {
+		str -= SC_ENTRY(sc, SC_HARMONIZE)->val2;
 		return (unsigned short)cap_value(str,0,USHRT_MAX);
 	}
-	if(sc->data[SC_BEYOND_OF_WARCRY])
-		str += sc->data[SC_BEYOND_OF_WARCRY]->val3;
-	if(sc->data[SC_INCALLSTATUS])
-		str += sc->data[SC_INCALLSTATUS]->val1;
-	if(sc->data[SC_CHASEWALK2])
-		str += sc->data[SC_CHASEWALK2]->val1;
-	if(sc->data[SC_FOOD_STR])
-		str += sc->data[SC_FOOD_STR]->val1;
-	if(sc->data[SC_FOOD_STR_CASH])
-		str += sc->data[SC_FOOD_STR_CASH]->val1;
-	if(sc->data[SC_GDSKILL_BATTLEORDER])
+	if(SC_ENTRY(sc, SC_BEYOND_OF_WARCRY))
+		str += SC_ENTRY(sc, SC_BEYOND_OF_WARCRY)->val3;
+	if(SC_ENTRY(sc, SC_INCALLSTATUS))
+		str += SC_ENTRY(sc, SC_INCALLSTATUS)->val1;
+	if(SC_ENTRY(sc, SC_CHASEWALK2))
+		str += SC_ENTRY(sc, SC_CHASEWALK2)->val1;
+	if(SC_ENTRY(sc, SC_FOOD_STR))
+		str += SC_ENTRY(sc, SC_FOOD_STR)->val1;
+	if(SC_ENTRY(sc, SC_FOOD_STR_CASH))
+		str += SC_ENTRY(sc, SC_FOOD_STR_CASH)->val1;
+	if(SC_ENTRY(sc, SC_GDSKILL_BATTLEORDER))
 		str += 5;
-	if(sc->data[SC_LEADERSHIP])
-		str += sc->data[SC_LEADERSHIP]->val1;
-	if (sc->data[SC_SHOUT] != NULL)
-		str += sc->data[SC_SHOUT]->val1;
-	if(sc->data[SC_TRUESIGHT])
+	if(SC_ENTRY(sc, SC_LEADERSHIP))
+		str += SC_ENTRY(sc, SC_LEADERSHIP)->val1;
+	if (SC_ENTRY(sc, SC_SHOUT) != NULL)
+		str += SC_ENTRY(sc, SC_SHOUT)->val1;
+	if(SC_ENTRY(sc, SC_TRUESIGHT))
 		str += 5;
-	if(sc->data[SC_STRUP])
+	if(SC_ENTRY(sc, SC_STRUP))
 		str += 10;
-	if(sc->data[SC_NJ_NEN])
-		str += sc->data[SC_NJ_NEN]->val1;
-	if(sc->data[SC_BLESSING]){
-		if(sc->data[SC_BLESSING]->val2)
-			str += sc->data[SC_BLESSING]->val2;
+	if(SC_ENTRY(sc, SC_NJ_NEN))
+		str += SC_ENTRY(sc, SC_NJ_NEN)->val1;
+	if(SC_ENTRY(sc, SC_BLESSING)){
+		if(SC_ENTRY(sc, SC_BLESSING)->val2)
+			str += SC_ENTRY(sc, SC_BLESSING)->val2;
 		else
 			str >>= 1;
 	}
-	if(sc->data[SC_MARIONETTE_MASTER])
-		str -= ((sc->data[SC_MARIONETTE_MASTER]->val3)>>16)&0xFF;
-	if(sc->data[SC_MARIONETTE])
-		str += ((sc->data[SC_MARIONETTE]->val3)>>16)&0xFF;
-	if(sc->data[SC_SOULLINK] && sc->data[SC_SOULLINK]->val2 == SL_HIGH)
-		str += ((sc->data[SC_SOULLINK]->val3)>>16)&0xFF;
-	if(sc->data[SC_GIANTGROWTH])
+	if(SC_ENTRY(sc, SC_MARIONETTE_MASTER))
+		str -= ((SC_ENTRY(sc, SC_MARIONETTE_MASTER)->val3)>>16)&0xFF;
+	if(SC_ENTRY(sc, SC_MARIONETTE))
+		str += ((SC_ENTRY(sc, SC_MARIONETTE)->val3)>>16)&0xFF;
+	if(SC_ENTRY(sc, SC_SOULLINK) && SC_ENTRY(sc, SC_SOULLINK)->val2 == SL_HIGH)
+		str += ((SC_ENTRY(sc, SC_SOULLINK)->val3)>>16)&0xFF;
+	if(SC_ENTRY(sc, SC_GIANTGROWTH))
 		str += 30;
-	if(sc->data[SC_SAVAGE_STEAK])
-		str += sc->data[SC_SAVAGE_STEAK]->val1;
-	if(sc->data[SC_INSPIRATION])
-		str += sc->data[SC_INSPIRATION]->val3;
-	if(sc->data[SC_STOMACHACHE])
-		str -= sc->data[SC_STOMACHACHE]->val1;
-	if(sc->data[SC_KYOUGAKU])
-		str -= sc->data[SC_KYOUGAKU]->val3;
-	if (sc->data[SC_2011RWC])
-		str += sc->data[SC_2011RWC]->val1;
-	if (sc->data[SC_STR_SCROLL])
-		str += sc->data[SC_STR_SCROLL]->val1;
-	if (sc->data[SC_UNIVERSESTANCE] != NULL)
-		str += sc->data[SC_UNIVERSESTANCE]->val2;
+	if(SC_ENTRY(sc, SC_SAVAGE_STEAK))
+		str += SC_ENTRY(sc, SC_SAVAGE_STEAK)->val1;
+	if(SC_ENTRY(sc, SC_INSPIRATION))
+		str += SC_ENTRY(sc, SC_INSPIRATION)->val3;
+	if(SC_ENTRY(sc, SC_STOMACHACHE))
+		str -= SC_ENTRY(sc, SC_STOMACHACHE)->val1;
+	if(SC_ENTRY(sc, SC_KYOUGAKU))
+		str -= SC_ENTRY(sc, SC_KYOUGAKU)->val3;
+	if (SC_ENTRY(sc, SC_2011RWC))
+		str += SC_ENTRY(sc, SC_2011RWC)->val1;
+	if (SC_ENTRY(sc, SC_STR_SCROLL))
+		str += SC_ENTRY(sc, SC_STR_SCROLL)->val1;
+	if (SC_ENTRY(sc, SC_UNIVERSESTANCE) != NULL)
+		str += SC_ENTRY(sc, SC_UNIVERSESTANCE)->val2;
 
 #ifdef RENEWAL
-	if (sc->data[SC_NIBELUNGEN] != NULL && sc->data[SC_NIBELUNGEN]->val2 == RINGNBL_EFF_ALLSTATS)
+	if (SC_ENTRY(sc, SC_NIBELUNGEN) != NULL && SC_ENTRY(sc, SC_NIBELUNGEN)->val2 == RINGNBL_EFF_ALLSTATS)
 		str += 15;
 #endif
 
@@ -4068,65 +4072,65 @@ static unsigned short status_calc_agi(struct block_list *bl, struct status_chang
 	if(!sc || !sc->count)
 		return cap_value(agi,0,USHRT_MAX);
 
-	if(sc->data[SC_FULL_THROTTLE])
+	if(SC_ENTRY(sc, SC_FULL_THROTTLE))
 		agi += agi * 20 / 100;
-	if(sc->data[SC_HARMONIZE]) {
-		agi -= sc->data[SC_HARMONIZE]->val2;
+	if(SC_ENTRY(sc, SC_HARMONIZE)) {
+		agi -= SC_ENTRY(sc, SC_HARMONIZE)->val2;
 		return (unsigned short)cap_value(agi,0,USHRT_MAX);
 	}
-	if(sc->data[SC_CONCENTRATION] && !sc->data[SC_QUAGMIRE])
-		agi += (agi-sc->data[SC_CONCENTRATION]->val3)*sc->data[SC_CONCENTRATION]->val2/100;
-	if(sc->data[SC_INCALLSTATUS])
-		agi += sc->data[SC_INCALLSTATUS]->val1;
-	if(sc->data[SC_INCAGI])
-		agi += sc->data[SC_INCAGI]->val1;
-	if(sc->data[SC_FOOD_AGI])
-		agi += sc->data[SC_FOOD_AGI]->val1;
-	if(sc->data[SC_FOOD_AGI_CASH])
-		agi += sc->data[SC_FOOD_AGI_CASH]->val1;
-	if(sc->data[SC_SOULCOLD])
-		agi += sc->data[SC_SOULCOLD]->val1;
-	if(sc->data[SC_TRUESIGHT])
+	if(SC_ENTRY(sc, SC_CONCENTRATION) && !SC_ENTRY(sc, SC_QUAGMIRE))
+		agi += (agi-SC_ENTRY(sc, SC_CONCENTRATION)->val3)*SC_ENTRY(sc, SC_CONCENTRATION)->val2/100;
+	if(SC_ENTRY(sc, SC_INCALLSTATUS))
+		agi += SC_ENTRY(sc, SC_INCALLSTATUS)->val1;
+	if(SC_ENTRY(sc, SC_INCAGI))
+		agi += SC_ENTRY(sc, SC_INCAGI)->val1;
+	if(SC_ENTRY(sc, SC_FOOD_AGI))
+		agi += SC_ENTRY(sc, SC_FOOD_AGI)->val1;
+	if(SC_ENTRY(sc, SC_FOOD_AGI_CASH))
+		agi += SC_ENTRY(sc, SC_FOOD_AGI_CASH)->val1;
+	if(SC_ENTRY(sc, SC_SOULCOLD))
+		agi += SC_ENTRY(sc, SC_SOULCOLD)->val1;
+	if(SC_ENTRY(sc, SC_TRUESIGHT))
 		agi += 5;
-	if(sc->data[SC_INC_AGI])
-		agi += sc->data[SC_INC_AGI]->val2;
-	if(sc->data[SC_GS_ACCURACY])
+	if(SC_ENTRY(sc, SC_INC_AGI))
+		agi += SC_ENTRY(sc, SC_INC_AGI)->val2;
+	if(SC_ENTRY(sc, SC_GS_ACCURACY))
 		agi += 4; // added based on skill updates [Reddozen]
-	if(sc->data[SC_DEC_AGI])
-		agi -= sc->data[SC_DEC_AGI]->val2;
-	if(sc->data[SC_QUAGMIRE])
-		agi -= sc->data[SC_QUAGMIRE]->val2;
-	if(sc->data[SC_NJ_SUITON] && sc->data[SC_NJ_SUITON]->val3)
-		agi -= sc->data[SC_NJ_SUITON]->val2;
-	if(sc->data[SC_MARIONETTE_MASTER])
-		agi -= ((sc->data[SC_MARIONETTE_MASTER]->val3)>>8)&0xFF;
-	if(sc->data[SC_MARIONETTE])
-		agi += ((sc->data[SC_MARIONETTE]->val3)>>8)&0xFF;
-	if(sc->data[SC_SOULLINK] && sc->data[SC_SOULLINK]->val2 == SL_HIGH)
-		agi += ((sc->data[SC_SOULLINK]->val3)>>8)&0xFF;
-	if(sc->data[SC_ADORAMUS])
-		agi -= sc->data[SC_ADORAMUS]->val2;
-	if(sc->data[SC_DROCERA_HERB_STEAMED])
-		agi += sc->data[SC_DROCERA_HERB_STEAMED]->val1;
-	if(sc->data[SC_INSPIRATION])
-		agi += sc->data[SC_INSPIRATION]->val3;
-	if(sc->data[SC_STOMACHACHE])
-		agi -= sc->data[SC_STOMACHACHE]->val1;
-	if(sc->data[SC_KYOUGAKU])
-		agi -= sc->data[SC_KYOUGAKU]->val3;
-	if (sc->data[SC_2011RWC])
-		agi += sc->data[SC_2011RWC]->val1;
-
-	if (sc->data[SC_MARSHOFABYSS])
-		agi -= agi * sc->data[SC_MARSHOFABYSS]->val2 / 100;
-
-	if (sc->data[SC_ARCLOUSEDASH])
-		agi += sc->data[SC_ARCLOUSEDASH]->val2;
-	if (sc->data[SC_UNIVERSESTANCE] != NULL)
-		agi += sc->data[SC_UNIVERSESTANCE]->val2;
+	if(SC_ENTRY(sc, SC_DEC_AGI))
+		agi -= SC_ENTRY(sc, SC_DEC_AGI)->val2;
+	if(SC_ENTRY(sc, SC_QUAGMIRE))
+		agi -= SC_ENTRY(sc, SC_QUAGMIRE)->val2;
+	if(SC_ENTRY(sc, SC_NJ_SUITON) && SC_ENTRY(sc, SC_NJ_SUITON)->val3)
+		agi -= SC_ENTRY(sc, SC_NJ_SUITON)->val2;
+	if(SC_ENTRY(sc, SC_MARIONETTE_MASTER))
+		agi -= ((SC_ENTRY(sc, SC_MARIONETTE_MASTER)->val3)>>8)&0xFF;
+	if(SC_ENTRY(sc, SC_MARIONETTE))
+		agi += ((SC_ENTRY(sc, SC_MARIONETTE)->val3)>>8)&0xFF;
+	if(SC_ENTRY(sc, SC_SOULLINK) && SC_ENTRY(sc, SC_SOULLINK)->val2 == SL_HIGH)
+		agi += ((SC_ENTRY(sc, SC_SOULLINK)->val3)>>8)&0xFF;
+	if(SC_ENTRY(sc, SC_ADORAMUS))
+		agi -= SC_ENTRY(sc, SC_ADORAMUS)->val2;
+	if(SC_ENTRY(sc, SC_DROCERA_HERB_STEAMED))
+		agi += SC_ENTRY(sc, SC_DROCERA_HERB_STEAMED)->val1;
+	if(SC_ENTRY(sc, SC_INSPIRATION))
+		agi += SC_ENTRY(sc, SC_INSPIRATION)->val3;
+	if(SC_ENTRY(sc, SC_STOMACHACHE))
+		agi -= SC_ENTRY(sc, SC_STOMACHACHE)->val1;
+	if(SC_ENTRY(sc, SC_KYOUGAKU))
+		agi -= SC_ENTRY(sc, SC_KYOUGAKU)->val3;
+	if (SC_ENTRY(sc, SC_2011RWC))
+		agi += SC_ENTRY(sc, SC_2011RWC)->val1;
+
+	if (SC_ENTRY(sc, SC_MARSHOFABYSS))
+		agi -= agi * SC_ENTRY(sc, SC_MARSHOFABYSS)->val2 / 100;
+
+	if (SC_ENTRY(sc, SC_ARCLOUSEDASH))
+		agi += SC_ENTRY(sc, SC_ARCLOUSEDASH)->val2;
+	if (SC_ENTRY(sc, SC_UNIVERSESTANCE) != NULL)
+		agi += SC_ENTRY(sc, SC_UNIVERSESTANCE)->val2;
 
 #ifdef RENEWAL
-	if (sc->data[SC_NIBELUNGEN] != NULL && sc->data[SC_NIBELUNGEN]->val2 == RINGNBL_EFF_ALLSTATS)
+	if (SC_ENTRY(sc, SC_NIBELUNGEN) != NULL && SC_ENTRY(sc, SC_NIBELUNGEN)->val2 == RINGNBL_EFF_ALLSTATS)
 		agi += 15;
 #endif
 
@@ -4138,53 +4142,53 @@ static unsigned short status_calc_vit(struct block_list *bl, struct status_chang
 	if(!sc || !sc->count)
 		return cap_value(vit,0,USHRT_MAX);
 
-	if(sc->data[SC_FULL_THROTTLE])
+	if(SC_ENTRY(sc, SC_FULL_THROTTLE))
 		vit += vit * 20 / 100;
-	if(sc->data[SC_HARMONIZE]) {
-		vit -= sc->data[SC_HARMONIZE]->val2;
+	if(SC_ENTRY(sc, SC_HARMONIZE)) {
+		vit -= SC_ENTRY(sc, SC_HARMONIZE)->val2;
 		return (unsigned short)cap_value(vit,0,USHRT_MAX);
 	}
-	if(sc->data[SC_INCALLSTATUS])
-		vit += sc->data[SC_INCALLSTATUS]->val1;
-	if(sc->data[SC_INCVIT])
-		vit += sc->data[SC_INCVIT]->val1;
-	if(sc->data[SC_FOOD_VIT])
-		vit += sc->data[SC_FOOD_VIT]->val1;
-	if(sc->data[SC_FOOD_VIT_CASH])
-		vit += sc->data[SC_FOOD_VIT_CASH]->val1;
-	if(sc->data[SC_HLIF_CHANGE])
-		vit += sc->data[SC_HLIF_CHANGE]->val2;
-	if(sc->data[SC_GLORYWOUNDS])
-		vit += sc->data[SC_GLORYWOUNDS]->val1;
-	if(sc->data[SC_TRUESIGHT])
+	if(SC_ENTRY(sc, SC_INCALLSTATUS))
+		vit += SC_ENTRY(sc, SC_INCALLSTATUS)->val1;
+	if(SC_ENTRY(sc, SC_INCVIT))
+		vit += SC_ENTRY(sc, SC_INCVIT)->val1;
+	if(SC_ENTRY(sc, SC_FOOD_VIT))
+		vit += SC_ENTRY(sc, SC_FOOD_VIT)->val1;
+	if(SC_ENTRY(sc, SC_FOOD_VIT_CASH))
+		vit += SC_ENTRY(sc, SC_FOOD_VIT_CASH)->val1;
+	if(SC_ENTRY(sc, SC_HLIF_CHANGE))
+		vit += SC_ENTRY(sc, SC_HLIF_CHANGE)->val2;
+	if(SC_ENTRY(sc, SC_GLORYWOUNDS))
+		vit += SC_ENTRY(sc, SC_GLORYWOUNDS)->val1;
+	if(SC_ENTRY(sc, SC_TRUESIGHT))
 		vit += 5;
-	if(sc->data[SC_MARIONETTE_MASTER])
-		vit -= sc->data[SC_MARIONETTE_MASTER]->val3&0xFF;
-	if(sc->data[SC_MARIONETTE])
-		vit += sc->data[SC_MARIONETTE]->val3&0xFF;
-	if(sc->data[SC_SOULLINK] && sc->data[SC_SOULLINK]->val2 == SL_HIGH)
-		vit += sc->data[SC_SOULLINK]->val3&0xFF;
-	if(sc->data[SC_LAUDAAGNUS])
-		vit += 4 + sc->data[SC_LAUDAAGNUS]->val1;
-	if(sc->data[SC_MINOR_BBQ])
-		vit += sc->data[SC_MINOR_BBQ]->val1;
-	if(sc->data[SC_INSPIRATION])
-		vit += sc->data[SC_INSPIRATION]->val3;
-	if(sc->data[SC_STOMACHACHE])
-		vit -= sc->data[SC_STOMACHACHE]->val1;
-	if(sc->data[SC_KYOUGAKU])
-		vit -= sc->data[SC_KYOUGAKU]->val3;
-	if(sc->data[SC_NOEQUIPARMOR])
-		vit -= vit * sc->data[SC_NOEQUIPARMOR]->val2 / 100;
-	if (sc->data[SC_CUP_OF_BOZA])
-		vit += sc->data[SC_CUP_OF_BOZA]->val1;
-	if (sc->data[SC_2011RWC])
-		vit += sc->data[SC_2011RWC]->val1;
-	if (sc->data[SC_UNIVERSESTANCE] != NULL)
-		vit += sc->data[SC_UNIVERSESTANCE]->val2;
+	if(SC_ENTRY(sc, SC_MARIONETTE_MASTER))
+		vit -= SC_ENTRY(sc, SC_MARIONETTE_MASTER)->val3&0xFF;
+	if(SC_ENTRY(sc, SC_MARIONETTE))
+		vit += SC_ENTRY(sc, SC_MARIONETTE)->val3&0xFF;
+	if(SC_ENTRY(sc, SC_SOULLINK) && SC_ENTRY(sc, SC_SOULLINK)->val2 == SL_HIGH)
+		vit += SC_ENTRY(sc, SC_SOULLINK)->val3&0xFF;
+	if(SC_ENTRY(sc, SC_LAUDAAGNUS))
+		vit += 4 + SC_ENTRY(sc, SC_LAUDAAGNUS)->val1;
+	if(SC_ENTRY(sc, SC_MINOR_BBQ))
+		vit += SC_ENTRY(sc, SC_MINOR_BBQ)->val1;
+	if(SC_ENTRY(sc, SC_INSPIRATION))
+		vit += SC_ENTRY(sc, SC_INSPIRATION)->val3;
+	if(SC_ENTRY(sc, SC_STOMACHACHE))
+		vit -= SC_ENTRY(sc, SC_STOMACHACHE)->val1;
+	if(SC_ENTRY(sc, SC_KYOUGAKU))
+		vit -= SC_ENTRY(sc, SC_KYOUGAKU)->val3;
+	if(SC_ENTRY(sc, SC_NOEQUIPARMOR))
+		vit -= vit * SC_ENTRY(sc, SC_NOEQUIPARMOR)->val2 / 100;
+	if (SC_ENTRY(sc, SC_CUP_OF_BOZA))
+		vit += SC_ENTRY(sc, SC_CUP_OF_BOZA)->val1;
+	if (SC_ENTRY(sc, SC_2011RWC))
+		vit += SC_ENTRY(sc, SC_2011RWC)->val1;
+	if (SC_ENTRY(sc, SC_UNIVERSESTANCE) != NULL)
+		vit += SC_ENTRY(sc, SC_UNIVERSESTANCE)->val2;
 
 #ifdef RENEWAL
-	if (sc->data[SC_NIBELUNGEN] != NULL && sc->data[SC_NIBELUNGEN]->val2 == RINGNBL_EFF_ALLSTATS)
+	if (SC_ENTRY(sc, SC_NIBELUNGEN) != NULL && SC_ENTRY(sc, SC_NIBELUNGEN)->val2 == RINGNBL_EFF_ALLSTATS)
 		vit += 15;
 #endif
 
@@ -4197,68 +4201,68 @@ static unsigned short status_calc_int(struct block_list *bl, struct status_chang
 	if(!sc || !sc->count)
 		return cap_value(int_,0,USHRT_MAX);
 
-	if(sc->data[SC_FULL_THROTTLE])
+	if(SC_ENTRY(sc, SC_FULL_THROTTLE))
 		int_ += int_ * 20 / 100;
-	if(sc->data[SC_HARMONIZE]) {
-		int_ -= sc->data[SC_HARMONIZE]->val2;
+	if(SC_ENTRY(sc, SC_HARMONIZE)) {
+		int_ -= SC_ENTRY(sc, SC_HARMONIZE)->val2;
 		return (unsigned short)cap_value(int_,0,USHRT_MAX);
 	}
-	if(sc->data[SC_MELODYOFSINK])
-		int_ -= sc->data[SC_MELODYOFSINK]->val3;
-	if(sc->data[SC_INCALLSTATUS])
-		int_ += sc->data[SC_INCALLSTATUS]->val1;
-	if(sc->data[SC_INCINT])
-		int_ += sc->data[SC_INCINT]->val1;
-	if(sc->data[SC_FOOD_INT])
-		int_ += sc->data[SC_FOOD_INT]->val1;
-	if(sc->data[SC_FOOD_INT_CASH])
-		int_ += sc->data[SC_FOOD_INT_CASH]->val1;
-	if(sc->data[SC_HLIF_CHANGE])
-		int_ += sc->data[SC_HLIF_CHANGE]->val3;
-	if(sc->data[SC_GDSKILL_BATTLEORDER])
+	if(SC_ENTRY(sc, SC_MELODYOFSINK))
+		int_ -= SC_ENTRY(sc, SC_MELODYOFSINK)->val3;
+	if(SC_ENTRY(sc, SC_INCALLSTATUS))
+		int_ += SC_ENTRY(sc, SC_INCALLSTATUS)->val1;
+	if(SC_ENTRY(sc, SC_INCINT))
+		int_ += SC_ENTRY(sc, SC_INCINT)->val1;
+	if(SC_ENTRY(sc, SC_FOOD_INT))
+		int_ += SC_ENTRY(sc, SC_FOOD_INT)->val1;
+	if(SC_ENTRY(sc, SC_FOOD_INT_CASH))
+		int_ += SC_ENTRY(sc, SC_FOOD_INT_CASH)->val1;
+	if(SC_ENTRY(sc, SC_HLIF_CHANGE))
+		int_ += SC_ENTRY(sc, SC_HLIF_CHANGE)->val3;
+	if(SC_ENTRY(sc, SC_GDSKILL_BATTLEORDER))
 		int_ += 5;
-	if(sc->data[SC_TRUESIGHT])
+	if(SC_ENTRY(sc, SC_TRUESIGHT))
 		int_ += 5;
-	if(sc->data[SC_BLESSING]){
-		if (sc->data[SC_BLESSING]->val2)
-			int_ += sc->data[SC_BLESSING]->val2;
+	if(SC_ENTRY(sc, SC_BLESSING)){
+		if (SC_ENTRY(sc, SC_BLESSING)->val2)
+			int_ += SC_ENTRY(sc, SC_BLESSING)->val2;
 		else
 			int_ >>= 1;
 	}
-	if(sc->data[SC_NJ_NEN])
-		int_ += sc->data[SC_NJ_NEN]->val1;
-	if(sc->data[SC_MARIONETTE_MASTER])
-		int_ -= ((sc->data[SC_MARIONETTE_MASTER]->val4)>>16)&0xFF;
-	if(sc->data[SC_MARIONETTE])
-		int_ += ((sc->data[SC_MARIONETTE]->val4)>>16)&0xFF;
-	if(sc->data[SC_SOULLINK] && sc->data[SC_SOULLINK]->val2 == SL_HIGH)
-		int_ += ((sc->data[SC_SOULLINK]->val4)>>16)&0xFF;
-	if(sc->data[SC_MANDRAGORA])
-		int_ -= 4 * sc->data[SC_MANDRAGORA]->val1;
-	if(sc->data[SC_COCKTAIL_WARG_BLOOD])
-		int_ += sc->data[SC_COCKTAIL_WARG_BLOOD]->val1;
-	if(sc->data[SC_INSPIRATION])
-		int_ += sc->data[SC_INSPIRATION]->val3;
-	if(sc->data[SC_STOMACHACHE])
-		int_ -= sc->data[SC_STOMACHACHE]->val1;
-	if(sc->data[SC_KYOUGAKU])
-		int_ -= sc->data[SC_KYOUGAKU]->val3;
-	if (sc->data[SC_2011RWC])
-		int_ += sc->data[SC_2011RWC]->val1;
-	if (sc->data[SC_INT_SCROLL])
-		int_ += sc->data[SC_INT_SCROLL]->val1;
+	if(SC_ENTRY(sc, SC_NJ_NEN))
+		int_ += SC_ENTRY(sc, SC_NJ_NEN)->val1;
+	if(SC_ENTRY(sc, SC_MARIONETTE_MASTER))
+		int_ -= ((SC_ENTRY(sc, SC_MARIONETTE_MASTER)->val4)>>16)&0xFF;
+	if(SC_ENTRY(sc, SC_MARIONETTE))
+		int_ += ((SC_ENTRY(sc, SC_MARIONETTE)->val4)>>16)&0xFF;
+	if(SC_ENTRY(sc, SC_SOULLINK) && SC_ENTRY(sc, SC_SOULLINK)->val2 == SL_HIGH)
+		int_ += ((SC_ENTRY(sc, SC_SOULLINK)->val4)>>16)&0xFF;
+	if(SC_ENTRY(sc, SC_MANDRAGORA))
+		int_ -= 4 * SC_ENTRY(sc, SC_MANDRAGORA)->val1;
+	if(SC_ENTRY(sc, SC_COCKTAIL_WARG_BLOOD))
+		int_ += SC_ENTRY(sc, SC_COCKTAIL_WARG_BLOOD)->val1;
+	if(SC_ENTRY(sc, SC_INSPIRATION))
+		int_ += SC_ENTRY(sc, SC_INSPIRATION)->val3;
+	if(SC_ENTRY(sc, SC_STOMACHACHE))
+		int_ -= SC_ENTRY(sc, SC_STOMACHACHE)->val1;
+	if(SC_ENTRY(sc, SC_KYOUGAKU))
+		int_ -= SC_ENTRY(sc, SC_KYOUGAKU)->val3;
+	if (SC_ENTRY(sc, SC_2011RWC))
+		int_ += SC_ENTRY(sc, SC_2011RWC)->val1;
+	if (SC_ENTRY(sc, SC_INT_SCROLL))
+		int_ += SC_ENTRY(sc, SC_INT_SCROLL)->val1;
 
 	if(bl->type != BL_PC){
-		if(sc->data[SC_NOEQUIPHELM])
-			int_ -= int_ * sc->data[SC_NOEQUIPHELM]->val2/100;
-		if(sc->data[SC__STRIPACCESSARY])
-			int_ -= int_ * sc->data[SC__STRIPACCESSARY]->val2 / 100;
+		if(SC_ENTRY(sc, SC_NOEQUIPHELM))
+			int_ -= int_ * SC_ENTRY(sc, SC_NOEQUIPHELM)->val2/100;
+		if(SC_ENTRY(sc, SC__STRIPACCESSARY))
+			int_ -= int_ * SC_ENTRY(sc, SC__STRIPACCESSARY)->val2 / 100;
 	}
-	if (sc->data[SC_UNIVERSESTANCE] != NULL)
-		int_ += sc->data[SC_UNIVERSESTANCE]->val2;
+	if (SC_ENTRY(sc, SC_UNIVERSESTANCE) != NULL)
+		int_ += SC_ENTRY(sc, SC_UNIVERSESTANCE)->val2;
 
 #ifdef RENEWAL
-	if (sc->data[SC_NIBELUNGEN] != NULL && sc->data[SC_NIBELUNGEN]->val2 == RINGNBL_EFF_ALLSTATS)
+	if (SC_ENTRY(sc, SC_NIBELUNGEN) != NULL && SC_ENTRY(sc, SC_NIBELUNGEN)->val2 == RINGNBL_EFF_ALLSTATS)
 		int_ += 15;
 #endif
 
@@ -4271,64 +4275,64 @@ static unsigned short status_calc_dex(struct block_list *bl, struct status_chang
 	if(!sc || !sc->count)
 		return cap_value(dex,0,USHRT_MAX);
 
-	if(sc->data[SC_FULL_THROTTLE])
+	if(SC_ENTRY(sc, SC_FULL_THROTTLE))
 		dex += dex * 20 / 100;
-	if(sc->data[SC_HARMONIZE]) {
-		dex -= sc->data[SC_HARMONIZE]->val2;
+	if(SC_ENTRY(sc, SC_HARMONIZE)) {
+		dex -= SC_ENTRY(sc, SC_HARMONIZE)->val2;
 		return (unsigned short)cap_value(dex,0,USHRT_MAX);
 	}
-	if(sc->data[SC_CONCENTRATION] && !sc->data[SC_QUAGMIRE])
-		dex += (dex-sc->data[SC_CONCENTRATION]->val4)*sc->data[SC_CONCENTRATION]->val2/100;
-	if(sc->data[SC_INCALLSTATUS])
-		dex += sc->data[SC_INCALLSTATUS]->val1;
-	if(sc->data[SC_INCDEX])
-		dex += sc->data[SC_INCDEX]->val1;
-	if(sc->data[SC_FOOD_DEX])
-		dex += sc->data[SC_FOOD_DEX]->val1;
-	if(sc->data[SC_FOOD_DEX_CASH])
-		dex += sc->data[SC_FOOD_DEX_CASH]->val1;
-	if(sc->data[SC_GDSKILL_BATTLEORDER])
+	if(SC_ENTRY(sc, SC_CONCENTRATION) && !SC_ENTRY(sc, SC_QUAGMIRE))
+		dex += (dex-SC_ENTRY(sc, SC_CONCENTRATION)->val4)*SC_ENTRY(sc, SC_CONCENTRATION)->val2/100;
+	if(SC_ENTRY(sc, SC_INCALLSTATUS))
+		dex += SC_ENTRY(sc, SC_INCALLSTATUS)->val1;
+	if(SC_ENTRY(sc, SC_INCDEX))
+		dex += SC_ENTRY(sc, SC_INCDEX)->val1;
+	if(SC_ENTRY(sc, SC_FOOD_DEX))
+		dex += SC_ENTRY(sc, SC_FOOD_DEX)->val1;
+	if(SC_ENTRY(sc, SC_FOOD_DEX_CASH))
+		dex += SC_ENTRY(sc, SC_FOOD_DEX_CASH)->val1;
+	if(SC_ENTRY(sc, SC_GDSKILL_BATTLEORDER))
 		dex += 5;
-	if(sc->data[SC_HAWKEYES])
-		dex += sc->data[SC_HAWKEYES]->val1;
-	if(sc->data[SC_TRUESIGHT])
+	if(SC_ENTRY(sc, SC_HAWKEYES))
+		dex += SC_ENTRY(sc, SC_HAWKEYES)->val1;
+	if(SC_ENTRY(sc, SC_TRUESIGHT))
 		dex += 5;
-	if(sc->data[SC_QUAGMIRE])
-		dex -= sc->data[SC_QUAGMIRE]->val2;
-	if(sc->data[SC_BLESSING]){
-		if (sc->data[SC_BLESSING]->val2)
-			dex += sc->data[SC_BLESSING]->val2;
+	if(SC_ENTRY(sc, SC_QUAGMIRE))
+		dex -= SC_ENTRY(sc, SC_QUAGMIRE)->val2;
+	if(SC_ENTRY(sc, SC_BLESSING)){
+		if (SC_ENTRY(sc, SC_BLESSING)->val2)
+			dex += SC_ENTRY(sc, SC_BLESSING)->val2;
 		else
 			dex >>= 1;
 	}
-	if(sc->data[SC_GS_ACCURACY])
+	if(SC_ENTRY(sc, SC_GS_ACCURACY))
 		dex += 4; // added based on skill updates [Reddozen]
-	if(sc->data[SC_MARIONETTE_MASTER])
-		dex -= ((sc->data[SC_MARIONETTE_MASTER]->val4)>>8)&0xFF;
-	if(sc->data[SC_MARIONETTE])
-		dex += ((sc->data[SC_MARIONETTE]->val4)>>8)&0xFF;
-	if(sc->data[SC_SOULLINK] && sc->data[SC_SOULLINK]->val2 == SL_HIGH)
-		dex += ((sc->data[SC_SOULLINK]->val4)>>8)&0xFF;
-	if(sc->data[SC_SIROMA_ICE_TEA])
-		dex += sc->data[SC_SIROMA_ICE_TEA]->val1;
-	if(sc->data[SC_INSPIRATION])
-		dex += sc->data[SC_INSPIRATION]->val3;
-	if(sc->data[SC_STOMACHACHE])
-		dex -= sc->data[SC_STOMACHACHE]->val1;
-	if(sc->data[SC_KYOUGAKU])
-		dex -= sc->data[SC_KYOUGAKU]->val3;
-	if (sc->data[SC_2011RWC])
-		dex += sc->data[SC_2011RWC]->val1;
-
-	if(sc->data[SC_MARSHOFABYSS])
-		dex -= dex * sc->data[SC_MARSHOFABYSS]->val2 / 100;
-	if(sc->data[SC__STRIPACCESSARY] && bl->type != BL_PC)
-		dex -= dex * sc->data[SC__STRIPACCESSARY]->val2 / 100;
-	if (sc->data[SC_UNIVERSESTANCE] != NULL)
-		dex += sc->data[SC_UNIVERSESTANCE]->val2;
+	if(SC_ENTRY(sc, SC_MARIONETTE_MASTER))
+		dex -= ((SC_ENTRY(sc, SC_MARIONETTE_MASTER)->val4)>>8)&0xFF;
+	if(SC_ENTRY(sc, SC_MARIONETTE))
+		dex += ((SC_ENTRY(sc, SC_MARIONETTE)->val4)>>8)&0xFF;
+	if(SC_ENTRY(sc, SC_SOULLINK) && SC_ENTRY(sc, SC_SOULLINK)->val2 == SL_HIGH)
+		dex += ((SC_ENTRY(sc, SC_SOULLINK)->val4)>>8)&0xFF;
+	if(SC_ENTRY(sc, SC_SIROMA_ICE_TEA))
+		dex += SC_ENTRY(sc, SC_SIROMA_ICE_TEA)->val1;
+	if(SC_ENTRY(sc, SC_INSPIRATION))
+		dex += SC_ENTRY(sc, SC_INSPIRATION)->val3;
+	if(SC_ENTRY(sc, SC_STOMACHACHE))
+		dex -= SC_ENTRY(sc, SC_STOMACHACHE)->val1;
+	if(SC_ENTRY(sc, SC_KYOUGAKU))
+		dex -= SC_ENTRY(sc, SC_KYOUGAKU)->val3;
+	if (SC_ENTRY(sc, SC_2011RWC))
+		dex += SC_ENTRY(sc, SC_2011RWC)->val1;
+
+	if(SC_ENTRY(sc, SC_MARSHOFABYSS))
+		dex -= dex * SC_ENTRY(sc, SC_MARSHOFABYSS)->val2 / 100;
+	if(SC_ENTRY(sc, SC__STRIPACCESSARY) && bl->type != BL_PC)
+		dex -= dex * SC_ENTRY(sc, SC__STRIPACCESSARY)->val2 / 100;
+	if (SC_ENTRY(sc, SC_UNIVERSESTANCE) != NULL)
+		dex += SC_ENTRY(sc, SC_UNIVERSESTANCE)->val2;
 
 #ifdef RENEWAL
-	if (sc->data[SC_NIBELUNGEN] != NULL && sc->data[SC_NIBELUNGEN]->val2 == RINGNBL_EFF_ALLSTATS)
+	if (SC_ENTRY(sc, SC_NIBELUNGEN) != NULL && SC_ENTRY(sc, SC_NIBELUNGEN)->val2 == RINGNBL_EFF_ALLSTATS)
 		dex += 15;
 #endif
 
@@ -4342,55 +4346,55 @@ static unsigned short status_calc_luk(struct block_list *bl, struct status_chang
 	if (!sc || !sc->count)
 		return cap_value(luk, 0, USHRT_MAX);
 
-	if (sc->data[SC_FULL_THROTTLE])
+	if (SC_ENTRY(sc, SC_FULL_THROTTLE))
 		luk += luk * 20 / 100;
-	if (sc->data[SC_HARMONIZE]) {
-		luk -= sc->data[SC_HARMONIZE]->val2;
+	if (SC_ENTRY(sc, SC_HARMONIZE)) {
+		luk -= SC_ENTRY(sc, SC_HARMONIZE)->val2;
 		return (unsigned short)cap_value(luk, 0, USHRT_MAX);
 	}
-	if (sc->data[SC_CURSE])
+	if (SC_ENTRY(sc, SC_CURSE))
 		return 0;
-	if (sc->data[SC_INCALLSTATUS])
-		luk += sc->data[SC_INCALLSTATUS]->val1;
-	if (sc->data[SC_INCLUK])
-		luk += sc->data[SC_INCLUK]->val1;
-	if (sc->data[SC_FOOD_LUK])
-		luk += sc->data[SC_FOOD_LUK]->val1;
-	if (sc->data[SC_FOOD_LUK_CASH])
-		luk += sc->data[SC_FOOD_LUK_CASH]->val1;
-	if (sc->data[SC_TRUESIGHT])
+	if (SC_ENTRY(sc, SC_INCALLSTATUS))
+		luk += SC_ENTRY(sc, SC_INCALLSTATUS)->val1;
+	if (SC_ENTRY(sc, SC_INCLUK))
+		luk += SC_ENTRY(sc, SC_INCLUK)->val1;
+	if (SC_ENTRY(sc, SC_FOOD_LUK))
+		luk += SC_ENTRY(sc, SC_FOOD_LUK)->val1;
+	if (SC_ENTRY(sc, SC_FOOD_LUK_CASH))
+		luk += SC_ENTRY(sc, SC_FOOD_LUK_CASH)->val1;
+	if (SC_ENTRY(sc, SC_TRUESIGHT))
 		luk += 5;
-	if (sc->data[SC_GLORIA])
+	if (SC_ENTRY(sc, SC_GLORIA))
 		luk += 30;
-	if (sc->data[SC_MARIONETTE_MASTER])
-		luk -= sc->data[SC_MARIONETTE_MASTER]->val4&0xFF;
-	if (sc->data[SC_MARIONETTE])
-		luk += sc->data[SC_MARIONETTE]->val4&0xFF;
-	if (sc->data[SC_SOULLINK] && sc->data[SC_SOULLINK]->val2 == SL_HIGH)
-		luk += sc->data[SC_SOULLINK]->val4&0xFF;
-	if (sc->data[SC_PUTTI_TAILS_NOODLES])
-		luk += sc->data[SC_PUTTI_TAILS_NOODLES]->val1;
-	if (sc->data[SC_INSPIRATION])
-		luk += sc->data[SC_INSPIRATION]->val3;
-	if (sc->data[SC_STOMACHACHE])
-		luk -= sc->data[SC_STOMACHACHE]->val1;
-	if (sc->data[SC_KYOUGAKU])
-		luk -= sc->data[SC_KYOUGAKU]->val3;
-	if (sc->data[SC_LAUDARAMUS])
-		luk += 4 + sc->data[SC_LAUDARAMUS]->val1;
-	if (sc->data[SC__STRIPACCESSARY] && bl->type != BL_PC)
-		luk -= luk * sc->data[SC__STRIPACCESSARY]->val2 / 100;
-	if (sc->data[SC_BANANA_BOMB])
-		luk -= luk * sc->data[SC_BANANA_BOMB]->val1 / 100;
-	if (sc->data[SC_2011RWC])
-		luk += sc->data[SC_2011RWC]->val1;
-	if (sc->data[SC_MYSTICPOWDER])
-		luk += sc->data[SC_MYSTICPOWDER]->val2;
-	if (sc->data[SC_UNIVERSESTANCE] != NULL)
-		luk += sc->data[SC_UNIVERSESTANCE]->val2;
+	if (SC_ENTRY(sc, SC_MARIONETTE_MASTER))
+		luk -= SC_ENTRY(sc, SC_MARIONETTE_MASTER)->val4&0xFF;
+	if (SC_ENTRY(sc, SC_MARIONETTE))
+		luk += SC_ENTRY(sc, SC_MARIONETTE)->val4&0xFF;
+	if (SC_ENTRY(sc, SC_SOULLINK) && SC_ENTRY(sc, SC_SOULLINK)->val2 == SL_HIGH)
+		luk += SC_ENTRY(sc, SC_SOULLINK)->val4&0xFF;
+	if (SC_ENTRY(sc, SC_PUTTI_TAILS_NOODLES))
+		luk += SC_ENTRY(sc, SC_PUTTI_TAILS_NOODLES)->val1;
+	if (SC_ENTRY(sc, SC_INSPIRATION))
+		luk += SC_ENTRY(sc, SC_INSPIRATION)->val3;
+	if (SC_ENTRY(sc, SC_STOMACHACHE))
+		luk -= SC_ENTRY(sc, SC_STOMACHACHE)->val1;
+	if (SC_ENTRY(sc, SC_KYOUGAKU))
+		luk -= SC_ENTRY(sc, SC_KYOUGAKU)->val3;
+	if (SC_ENTRY(sc, SC_LAUDARAMUS))
+		luk += 4 + SC_ENTRY(sc, SC_LAUDARAMUS)->val1;
+	if (SC_ENTRY(sc, SC__STRIPACCESSARY) && bl->type != BL_PC)
+		luk -= luk * SC_ENTRY(sc, SC__STRIPACCESSARY)->val2 / 100;
+	if (SC_ENTRY(sc, SC_BANANA_BOMB))
+		luk -= luk * SC_ENTRY(sc, SC_BANANA_BOMB)->val1 / 100;
+	if (SC_ENTRY(sc, SC_2011RWC))
+		luk += SC_ENTRY(sc, SC_2011RWC)->val1;
+	if (SC_ENTRY(sc, SC_MYSTICPOWDER))
+		luk += SC_ENTRY(sc, SC_MYSTICPOWDER)->val2;
+	if (SC_ENTRY(sc, SC_UNIVERSESTANCE) != NULL)
+		luk += SC_ENTRY(sc, SC_UNIVERSESTANCE)->val2;
 
 #ifdef RENEWAL
-	if (sc->data[SC_NIBELUNGEN] != NULL && sc->data[SC_NIBELUNGEN]->val2 == RINGNBL_EFF_ALLSTATS)
+	if (SC_ENTRY(sc, SC_NIBELUNGEN) != NULL && SC_ENTRY(sc, SC_NIBELUNGEN)->val2 == RINGNBL_EFF_ALLSTATS)
 		luk += 15;
 #endif
 
@@ -4413,40 +4417,40 @@ static int status_calc_atk_percent(struct block_list *bl, struct status_change *
 		return cap_value(atk_percent, 0, USHRT_MAX);
 
 	// Add/Subtract additively according to status changes.
-	if (sc->data[SC_TAROTCARD_ATK_PERC] != NULL)
-		atk_percent += sc->data[SC_TAROTCARD_ATK_PERC]->val1;
+	if (SC_ENTRY(sc, SC_TAROTCARD_ATK_PERC) != NULL)
+		atk_percent += SC_ENTRY(sc, SC_TAROTCARD_ATK_PERC)->val1;
 
-	if (sc->data[SC_GOSPEL_ATK_PERC] != NULL)
-		atk_percent += sc->data[SC_GOSPEL_ATK_PERC]->val1;
+	if (SC_ENTRY(sc, SC_GOSPEL_ATK_PERC) != NULL)
+		atk_percent += SC_ENTRY(sc, SC_GOSPEL_ATK_PERC)->val1;
 
-	if (sc->data[SC_PROVOKE] != NULL)
-		atk_percent += sc->data[SC_PROVOKE]->val3;
+	if (SC_ENTRY(sc, SC_PROVOKE) != NULL)
+		atk_percent += SC_ENTRY(sc, SC_PROVOKE)->val3;
 
 #ifndef RENEWAL
-	if (sc->data[SC_LKCONCENTRATION] != NULL)
-		atk_percent += sc->data[SC_LKCONCENTRATION]->val2;
+	if (SC_ENTRY(sc, SC_LKCONCENTRATION) != NULL)
+		atk_percent += SC_ENTRY(sc, SC_LKCONCENTRATION)->val2;
 #endif
 
-	if (sc->data[SC_HAMI_BLOODLUST] != NULL)
-		atk_percent += sc->data[SC_HAMI_BLOODLUST]->val2;
+	if (SC_ENTRY(sc, SC_HAMI_BLOODLUST) != NULL)
+		atk_percent += SC_ENTRY(sc, SC_HAMI_BLOODLUST)->val2;
 
-	if (sc->data[SC_JOINTBEAT] != NULL && (sc->data[SC_JOINTBEAT]->val2 & BREAK_WAIST) != 0)
+	if (SC_ENTRY(sc, SC_JOINTBEAT) != NULL && (SC_ENTRY(sc, SC_JOINTBEAT)->val2 & BREAK_WAIST) != 0)
 		atk_percent -= 25;
 
-	if (sc->data[SC_SKE] != NULL)
+	if (SC_ENTRY(sc, SC_SKE) != NULL)
 		atk_percent += 300;
 
-	if (sc->data[SC_HLIF_FLEET] != NULL)
-		atk_percent += sc->data[SC_HLIF_FLEET]->val3;
+	if (SC_ENTRY(sc, SC_HLIF_FLEET) != NULL)
+		atk_percent += SC_ENTRY(sc, SC_HLIF_FLEET)->val3;
 
-	if (sc->data[SC_CURSE] != NULL)
+	if (SC_ENTRY(sc, SC_CURSE) != NULL)
 		atk_percent -= 25;
 
-	if (sc->data[SC_INCATKRATE] != NULL) // should be used by NPC_POWERUP only
-		atk_percent += sc->data[SC_INCATKRATE]->val1;
+	if (SC_ENTRY(sc, SC_INCATKRATE) != NULL) // should be used by NPC_POWERUP only
+		atk_percent += SC_ENTRY(sc, SC_INCATKRATE)->val1;
 
-	if (sc->data[SC_NOEQUIPWEAPON] != NULL && bl->type != BL_PC)
-		atk_percent -= sc->data[SC_NOEQUIPWEAPON]->val2;
+	if (SC_ENTRY(sc, SC_NOEQUIPWEAPON) != NULL && bl->type != BL_PC)
+		atk_percent -= SC_ENTRY(sc, SC_NOEQUIPWEAPON)->val2;
 
 	return cap_value(atk_percent, 0, USHRT_MAX);
 }
@@ -4467,11 +4471,11 @@ static int status_calc_matk_percent(struct block_list *bl, struct status_change
 		return cap_value(matk_percent, 0, USHRT_MAX);
 
 	// Add/Subtract additively according to status changes.
-	if (sc->data[SC_TAROTCARD_MATK_PERC] != NULL)
-		matk_percent += sc->data[SC_TAROTCARD_MATK_PERC]->val1;
+	if (SC_ENTRY(sc, SC_TAROTCARD_MATK_PERC) != NULL)
+		matk_percent += SC_ENTRY(sc, SC_TAROTCARD_MATK_PERC)->val1;
 
-	if (sc->data[SC_MINDBREAKER] != NULL)
-		matk_percent += sc->data[SC_MINDBREAKER]->val2;
+	if (SC_ENTRY(sc, SC_MINDBREAKER) != NULL)
+		matk_percent += SC_ENTRY(sc, SC_MINDBREAKER)->val2;
 
 	return cap_value(matk_percent, 0, USHRT_MAX);
 }
@@ -4492,40 +4496,40 @@ static int status_calc_def_percent(struct block_list *bl, struct status_change *
 		return cap_value(def_percent, 0, USHRT_MAX);
 
 	// Add/Subtract additively according to status changes.
-	if (sc->data[SC_TAROTCARD_DEF_PERC] != NULL)
-		def_percent += sc->data[SC_TAROTCARD_DEF_PERC]->val1;
+	if (SC_ENTRY(sc, SC_TAROTCARD_DEF_PERC) != NULL)
+		def_percent += SC_ENTRY(sc, SC_TAROTCARD_DEF_PERC)->val1;
 
-	if (sc->data[SC_PROVOKE] != NULL)
-		def_percent -= sc->data[SC_PROVOKE]->val4; // passed as absolute value.
+	if (SC_ENTRY(sc, SC_PROVOKE) != NULL)
+		def_percent -= SC_ENTRY(sc, SC_PROVOKE)->val4; // passed as absolute value.
 
-	if (sc->data[SC_LKCONCENTRATION] != NULL)
-		def_percent -= sc->data[SC_LKCONCENTRATION]->val4; // passed as absolute value.
+	if (SC_ENTRY(sc, SC_LKCONCENTRATION) != NULL)
+		def_percent -= SC_ENTRY(sc, SC_LKCONCENTRATION)->val4; // passed as absolute value.
 
-	if (sc->data[SC_JOINTBEAT]) {
+	if (SC_ENTRY(sc, SC_JOINTBEAT)) {
 		// [Aegis] General (m)atk/m(def) percentage buffs/debuffs take the stronger one, as in max(abs(fst_perc), abs(snd_perc)).
 		// This is done individually for def, mdef, atk, def. And compared is only with same-skill originating changes.
-		if ((sc->data[SC_JOINTBEAT]->val2 & BREAK_SHOULDER) != 0)
+		if ((SC_ENTRY(sc, SC_JOINTBEAT)->val2 & BREAK_SHOULDER) != 0)
 			def_percent -= 50;
-		else if ((sc->data[SC_JOINTBEAT]->val2 & BREAK_WAIST) != 0)
+		else if ((SC_ENTRY(sc, SC_JOINTBEAT)->val2 & BREAK_WAIST) != 0)
 			def_percent -= 25;
 	}
 
-	if (sc->data[SC_SKE] != NULL)
+	if (SC_ENTRY(sc, SC_SKE) != NULL)
 		def_percent -= 50;
 
-	if (sc->data[SC_NOEQUIPSHIELD] != NULL)
-		def_percent -= sc->data[SC_NOEQUIPSHIELD]->val2;
+	if (SC_ENTRY(sc, SC_NOEQUIPSHIELD) != NULL)
+		def_percent -= SC_ENTRY(sc, SC_NOEQUIPSHIELD)->val2;
 
-	if (sc->data[SC_FLING] != NULL)
-		def_percent -= sc->data[SC_FLING]->val2;
+	if (SC_ENTRY(sc, SC_FLING) != NULL)
+		def_percent -= SC_ENTRY(sc, SC_FLING)->val2;
 
 #ifndef RENEWAL
-	if (sc->data[SC_ANGELUS] != NULL)
-		def_percent += sc->data[SC_ANGELUS]->val2;
+	if (SC_ENTRY(sc, SC_ANGELUS) != NULL)
+		def_percent += SC_ENTRY(sc, SC_ANGELUS)->val2;
 #endif
 
 	// [Aegis] These can't stack.
-	if (sc->data[SC_POISON] != NULL || sc->data[SC_DPOISON] != NULL)
+	if (SC_ENTRY(sc, SC_POISON) != NULL || SC_ENTRY(sc, SC_DPOISON) != NULL)
 		def_percent -= 25;
 
 	return cap_value(def_percent, 0, USHRT_MAX);
@@ -4547,8 +4551,8 @@ static int status_calc_mdef_percent(struct block_list *bl, struct status_change
 		return cap_value(mdef_percent, 0, USHRT_MAX);
 
 	// Add/Subtract additively according to status changes.
-	if (sc->data[SC_MINDBREAKER] != NULL)
-		mdef_percent -= sc->data[SC_MINDBREAKER]->val3;
+	if (SC_ENTRY(sc, SC_MINDBREAKER) != NULL)
+		mdef_percent -= SC_ENTRY(sc, SC_MINDBREAKER)->val3;
 
 	return cap_value(mdef_percent, 0, USHRT_MAX);
 }
@@ -4561,85 +4565,85 @@ static int status_calc_batk(struct block_list *bl, struct status_change *sc, int
 
 	if( !viewable ){
 		/* some statuses that are hidden in the status window */
-		if(sc->data[SC_PLUSATTACKPOWER])
-			batk += sc->data[SC_PLUSATTACKPOWER]->val1;
-		if (sc->data[SC_POPECOOKIE] != NULL)
-			batk += batk * sc->data[SC_POPECOOKIE]->val1 / 100;
-		if (sc->data[SC_VITALIZE_POTION] != NULL)
-			batk += batk * sc->data[SC_VITALIZE_POTION]->val1 / 100;
+		if(SC_ENTRY(sc, SC_PLUSATTACKPOWER))
+			batk += SC_ENTRY(sc, SC_PLUSATTACKPOWER)->val1;
+		if (SC_ENTRY(sc, SC_POPECOOKIE) != NULL)
+			batk += batk * SC_ENTRY(sc, SC_POPECOOKIE)->val1 / 100;
+		if (SC_ENTRY(sc, SC_VITALIZE_POTION) != NULL)
+			batk += batk * SC_ENTRY(sc, SC_VITALIZE_POTION)->val1 / 100;
 		return cap_value(batk, battle_config.batk_min, battle_config.batk_max);
 	}
 #ifndef RENEWAL
-	if(sc->data[SC_PLUSATTACKPOWER])
-		batk += sc->data[SC_PLUSATTACKPOWER]->val1;
-	if(sc->data[SC_GS_MADNESSCANCEL])
+	if(SC_ENTRY(sc, SC_PLUSATTACKPOWER))
+		batk += SC_ENTRY(sc, SC_PLUSATTACKPOWER)->val1;
+	if(SC_ENTRY(sc, SC_GS_MADNESSCANCEL))
 		batk += 100;
-	if(sc->data[SC_GS_GATLINGFEVER])
-		batk += sc->data[SC_GS_GATLINGFEVER]->val3;
+	if(SC_ENTRY(sc, SC_GS_GATLINGFEVER))
+		batk += SC_ENTRY(sc, SC_GS_GATLINGFEVER)->val3;
 #endif
-	if(sc->data[SC_BATKFOOD])
-		batk += sc->data[SC_BATKFOOD]->val1;
-	if(sc->data[SC_FIRE_INSIGNIA] && sc->data[SC_FIRE_INSIGNIA]->val1 == 2)
+	if(SC_ENTRY(sc, SC_BATKFOOD))
+		batk += SC_ENTRY(sc, SC_BATKFOOD)->val1;
+	if(SC_ENTRY(sc, SC_FIRE_INSIGNIA) && SC_ENTRY(sc, SC_FIRE_INSIGNIA)->val1 == 2)
 		batk += 50;
 	if(bl->type == BL_ELEM
-		&& ((sc->data[SC_FIRE_INSIGNIA] && sc->data[SC_FIRE_INSIGNIA]->val1 == 1)
-		|| (sc->data[SC_WATER_INSIGNIA] && sc->data[SC_WATER_INSIGNIA]->val1 == 1)
-		|| (sc->data[SC_WIND_INSIGNIA] && sc->data[SC_WIND_INSIGNIA]->val1 == 1)
-		|| (sc->data[SC_EARTH_INSIGNIA] && sc->data[SC_EARTH_INSIGNIA]->val1 == 1))
+		&& ((SC_ENTRY(sc, SC_FIRE_INSIGNIA) && SC_ENTRY(sc, SC_FIRE_INSIGNIA)->val1 == 1)
+		|| (SC_ENTRY(sc, SC_WATER_INSIGNIA) && SC_ENTRY(sc, SC_WATER_INSIGNIA)->val1 == 1)
+		|| (SC_ENTRY(sc, SC_WIND_INSIGNIA) && SC_ENTRY(sc, SC_WIND_INSIGNIA)->val1 == 1)
+		|| (SC_ENTRY(sc, SC_EARTH_INSIGNIA) && SC_ENTRY(sc, SC_EARTH_INSIGNIA)->val1 == 1))
 		)
 		batk += batk / 5;
-	if(sc->data[SC_FULL_SWING_K])
-		batk += sc->data[SC_FULL_SWING_K]->val1;
-	if(sc->data[SC_VOLCANIC_ASH] && (bl->type==BL_MOB)){
+	if(SC_ENTRY(sc, SC_FULL_SWING_K))
+		batk += SC_ENTRY(sc, SC_FULL_SWING_K)->val1;
+	if(SC_ENTRY(sc, SC_VOLCANIC_ASH) && (bl->type==BL_MOB)){
 		if(status_get_element(bl) == ELE_WATER) //water type
 			batk /= 2;
 	}
-	if(sc->data[SC_PYROCLASTIC])
-		batk += sc->data[SC_PYROCLASTIC]->val2;
-	if (sc->data[SC_ANGRIFFS_MODUS])
-		batk += sc->data[SC_ANGRIFFS_MODUS]->val2;
+	if(SC_ENTRY(sc, SC_PYROCLASTIC))
+		batk += SC_ENTRY(sc, SC_PYROCLASTIC)->val2;
+	if (SC_ENTRY(sc, SC_ANGRIFFS_MODUS))
+		batk += SC_ENTRY(sc, SC_ANGRIFFS_MODUS)->val2;
 
-	if( sc->data[SC_ZANGETSU] )
-		batk += sc->data[SC_ZANGETSU]->val2;
+	if( SC_ENTRY(sc, SC_ZANGETSU) )
+		batk += SC_ENTRY(sc, SC_ZANGETSU)->val2;
 #if 0 //Curse shouldn't effect on this?  <- Curse OR Bleeding??
-	if(sc->data[SC_BLOODING])
+	if(SC_ENTRY(sc, SC_BLOODING))
 		batk -= batk * 25/100;
 #endif // 0
-	if(sc->data[SC__ENERVATION])
-		batk -= batk * sc->data[SC__ENERVATION]->val2 / 100;
-	if(sc->data[SC_SATURDAY_NIGHT_FEVER])
-		batk += 100 * sc->data[SC_SATURDAY_NIGHT_FEVER]->val1;
-	if (sc->data[SC_BATTLESCROLL])
-		batk += batk * sc->data[SC_BATTLESCROLL]->val1 / 100;
+	if(SC_ENTRY(sc, SC__ENERVATION))
+		batk -= batk * SC_ENTRY(sc, SC__ENERVATION)->val2 / 100;
+	if(SC_ENTRY(sc, SC_SATURDAY_NIGHT_FEVER))
+		batk += 100 * SC_ENTRY(sc, SC_SATURDAY_NIGHT_FEVER)->val1;
+	if (SC_ENTRY(sc, SC_BATTLESCROLL))
+		batk += batk * SC_ENTRY(sc, SC_BATTLESCROLL)->val1 / 100;
 
 	// Eden Crystal Synthesis
-	if (sc->data[SC_QUEST_BUFF1])
-		batk += sc->data[SC_QUEST_BUFF1]->val1;
-	if (sc->data[SC_QUEST_BUFF2])
-		batk += sc->data[SC_QUEST_BUFF2]->val1;
-	if (sc->data[SC_QUEST_BUFF3])
-		batk += sc->data[SC_QUEST_BUFF3]->val1;
-
-	if (sc->data[SC_GM_BATTLE])
-		batk += batk * sc->data[SC_GM_BATTLE]->val1 / 100;
-	if (sc->data[SC_GM_BATTLE2])
-		batk += batk * sc->data[SC_GM_BATTLE2]->val1 / 100;
-	if (sc->data[SC_2011RWC])
-		batk += batk * sc->data[SC_2011RWC]->val2 / 100;
-	if (sc->data[SC_STEAMPACK])
-		batk += sc->data[SC_STEAMPACK]->val1;
-	if (sc->data[SC_SKF_ATK] != NULL)
-		batk += sc->data[SC_SKF_ATK]->val1;
-	if (sc->data[SC_ALMIGHTY] != NULL)
-		batk += sc->data[SC_ALMIGHTY]->val1;
-
-	if (sc->data[SC_SHRIMP])
-		batk += batk * sc->data[SC_SHRIMP]->val2 / 100;
-	if (sc->data[SC_SUNSTANCE] != NULL)
-		batk += batk * sc->data[SC_SUNSTANCE]->val2 / 100;
+	if (SC_ENTRY(sc, SC_QUEST_BUFF1))
+		batk += SC_ENTRY(sc, SC_QUEST_BUFF1)->val1;
+	if (SC_ENTRY(sc, SC_QUEST_BUFF2))
+		batk += SC_ENTRY(sc, SC_QUEST_BUFF2)->val1;
+	if (SC_ENTRY(sc, SC_QUEST_BUFF3))
+		batk += SC_ENTRY(sc, SC_QUEST_BUFF3)->val1;
+
+	if (SC_ENTRY(sc, SC_GM_BATTLE))
+		batk += batk * SC_ENTRY(sc, SC_GM_BATTLE)->val1 / 100;
+	if (SC_ENTRY(sc, SC_GM_BATTLE2))
+		batk += batk * SC_ENTRY(sc, SC_GM_BATTLE2)->val1 / 100;
+	if (SC_ENTRY(sc, SC_2011RWC))
+		batk += batk * SC_ENTRY(sc, SC_2011RWC)->val2 / 100;
+	if (SC_ENTRY(sc, SC_STEAMPACK))
+		batk += SC_ENTRY(sc, SC_STEAMPACK)->val1;
+	if (SC_ENTRY(sc, SC_SKF_ATK) != NULL)
+		batk += SC_ENTRY(sc, SC_SKF_ATK)->val1;
+	if (SC_ENTRY(sc, SC_ALMIGHTY) != NULL)
+		batk += SC_ENTRY(sc, SC_ALMIGHTY)->val1;
+
+	if (SC_ENTRY(sc, SC_SHRIMP))
+		batk += batk * SC_ENTRY(sc, SC_SHRIMP)->val2 / 100;
+	if (SC_ENTRY(sc, SC_SUNSTANCE) != NULL)
+		batk += batk * SC_ENTRY(sc, SC_SUNSTANCE)->val2 / 100;
 
 #ifdef RENEWAL
-	if (sc->data[SC_NIBELUNGEN] != NULL && sc->data[SC_NIBELUNGEN]->val2 == RINGNBL_EFF_ATK)
+	if (SC_ENTRY(sc, SC_NIBELUNGEN) != NULL && SC_ENTRY(sc, SC_NIBELUNGEN)->val2 == RINGNBL_EFF_ATK)
 		batk += batk * 20/100;
 #endif
 
@@ -4669,12 +4673,12 @@ static int status_calc_buff_extra_batk(struct block_list *bl, struct status_chan
 
 #ifdef RENEWAL
 	// In-game Tests (and iRO wiki) suggests SC_SHOUT ATK bonus is counted as Extra ATK
-	if (sc->data[SC_SHOUT] != NULL)
-		batk += sc->data[SC_SHOUT]->val2;
-	if (sc->data[SC_IMPOSITIO] != NULL)
-		batk += sc->data[SC_IMPOSITIO]->val2;
-	if (sc->data[SC_DRUMBATTLE] != NULL)
-		batk += sc->data[SC_DRUMBATTLE]->val2;
+	if (SC_ENTRY(sc, SC_SHOUT) != NULL)
+		batk += SC_ENTRY(sc, SC_SHOUT)->val2;
+	if (SC_ENTRY(sc, SC_IMPOSITIO) != NULL)
+		batk += SC_ENTRY(sc, SC_IMPOSITIO)->val2;
+	if (SC_ENTRY(sc, SC_DRUMBATTLE) != NULL)
+		batk += SC_ENTRY(sc, SC_DRUMBATTLE)->val2;
 #endif
 
 	return cap_value(batk, 0, battle_config.batk_max);
@@ -4688,86 +4692,86 @@ static int status_calc_watk(struct block_list *bl, struct status_change *sc, int
 
 	if( !viewable ){
 		/* some statuses that are hidden in the status window */
-		if( sc->data[SC_WATER_BARRIER] )
-			watk -= sc->data[SC_WATER_BARRIER]->val3;
-		if(sc->data[SC_GENTLETOUCH_CHANGE] && sc->data[SC_GENTLETOUCH_CHANGE]->val2)
-			watk += sc->data[SC_GENTLETOUCH_CHANGE]->val2;
+		if( SC_ENTRY(sc, SC_WATER_BARRIER) )
+			watk -= SC_ENTRY(sc, SC_WATER_BARRIER)->val3;
+		if(SC_ENTRY(sc, SC_GENTLETOUCH_CHANGE) && SC_ENTRY(sc, SC_GENTLETOUCH_CHANGE)->val2)
+			watk += SC_ENTRY(sc, SC_GENTLETOUCH_CHANGE)->val2;
 
 #ifdef RENEWAL
-		if (sc->data[SC_LKCONCENTRATION] != NULL)
-			watk += watk * sc->data[SC_LKCONCENTRATION]->val2 / 100;
+		if (SC_ENTRY(sc, SC_LKCONCENTRATION) != NULL)
+			watk += watk * SC_ENTRY(sc, SC_LKCONCENTRATION)->val2 / 100;
 #endif
 
 		return cap_value(watk, battle_config.watk_min, battle_config.watk_max);
 	}
 #ifndef RENEWAL
-	if(sc->data[SC_IMPOSITIO])
-		watk += sc->data[SC_IMPOSITIO]->val2;
-	if(sc->data[SC_DRUMBATTLE])
-		watk += sc->data[SC_DRUMBATTLE]->val2;
-#endif
-	if(sc->data[SC_WATKFOOD])
-		watk += sc->data[SC_WATKFOOD]->val1;
-	if(sc->data[SC_VOLCANO])
-		watk += sc->data[SC_VOLCANO]->val2;
-	if(sc->data[SC_MER_ATK])
-		watk += sc->data[SC_MER_ATK]->val2;
-	if(sc->data[SC_FIGHTINGSPIRIT])
-		watk += sc->data[SC_FIGHTINGSPIRIT]->val1;
-	if(sc->data[SC_SHIELDSPELL_DEF] && sc->data[SC_SHIELDSPELL_DEF]->val1 == 3)
-		watk += sc->data[SC_SHIELDSPELL_DEF]->val2;
-	if(sc->data[SC_INSPIRATION])
-		watk += sc->data[SC_INSPIRATION]->val2;
-	if( sc->data[SC_BANDING] && sc->data[SC_BANDING]->val2 > 1 )
-		watk += (10 + 10 * sc->data[SC_BANDING]->val1) * (sc->data[SC_BANDING]->val2);
-	if( sc->data[SC_TROPIC_OPTION] )
-		watk += sc->data[SC_TROPIC_OPTION]->val2;
-	if( sc->data[SC_HEATER_OPTION] )
-		watk += sc->data[SC_HEATER_OPTION]->val2;
-	if( sc->data[SC_PYROTECHNIC_OPTION] )
-		watk += sc->data[SC_PYROTECHNIC_OPTION]->val2;
+	if(SC_ENTRY(sc, SC_IMPOSITIO))
+		watk += SC_ENTRY(sc, SC_IMPOSITIO)->val2;
+	if(SC_ENTRY(sc, SC_DRUMBATTLE))
+		watk += SC_ENTRY(sc, SC_DRUMBATTLE)->val2;
+#endif
+	if(SC_ENTRY(sc, SC_WATKFOOD))
+		watk += SC_ENTRY(sc, SC_WATKFOOD)->val1;
+	if(SC_ENTRY(sc, SC_VOLCANO))
+		watk += SC_ENTRY(sc, SC_VOLCANO)->val2;
+	if(SC_ENTRY(sc, SC_MER_ATK))
+		watk += SC_ENTRY(sc, SC_MER_ATK)->val2;
+	if(SC_ENTRY(sc, SC_FIGHTINGSPIRIT))
+		watk += SC_ENTRY(sc, SC_FIGHTINGSPIRIT)->val1;
+	if(SC_ENTRY(sc, SC_SHIELDSPELL_DEF) && SC_ENTRY(sc, SC_SHIELDSPELL_DEF)->val1 == 3)
+		watk += SC_ENTRY(sc, SC_SHIELDSPELL_DEF)->val2;
+	if(SC_ENTRY(sc, SC_INSPIRATION))
+		watk += SC_ENTRY(sc, SC_INSPIRATION)->val2;
+	if( SC_ENTRY(sc, SC_BANDING) && SC_ENTRY(sc, SC_BANDING)->val2 > 1 )
+		watk += (10 + 10 * SC_ENTRY(sc, SC_BANDING)->val1) * (SC_ENTRY(sc, SC_BANDING)->val2);
+	if( SC_ENTRY(sc, SC_TROPIC_OPTION) )
+		watk += SC_ENTRY(sc, SC_TROPIC_OPTION)->val2;
+	if( SC_ENTRY(sc, SC_HEATER_OPTION) )
+		watk += SC_ENTRY(sc, SC_HEATER_OPTION)->val2;
+	if( SC_ENTRY(sc, SC_PYROTECHNIC_OPTION) )
+		watk += SC_ENTRY(sc, SC_PYROTECHNIC_OPTION)->val2;
 
 #ifndef RENEWAL
-	if(sc->data[SC_NIBELUNGEN]) {
+	if(SC_ENTRY(sc, SC_NIBELUNGEN)) {
 		if (bl->type != BL_PC) {
-			watk += sc->data[SC_NIBELUNGEN]->val2;
+			watk += SC_ENTRY(sc, SC_NIBELUNGEN)->val2;
 		} else {
 			const struct map_session_data *sd = BL_UCCAST(BL_PC, bl);
 			int index = sd->equip_index[sd->state.lr_flag?EQI_HAND_L:EQI_HAND_R];
 			if(index >= 0 && sd->inventory_data[index] && sd->inventory_data[index]->wlv == 4)
-				watk += sc->data[SC_NIBELUNGEN]->val2;
-		}
-	}
-#endif
-	if(sc->data[SC__ENERVATION])
-		watk -= watk * sc->data[SC__ENERVATION]->val2 / 100;
-	if(sc->data[SC_RUSH_WINDMILL])
-		watk += sc->data[SC_RUSH_WINDMILL]->val2;
-	if (sc->data[SC_ODINS_POWER])
-		watk += 40 + 30 * sc->data[SC_ODINS_POWER]->val1;
-	if(sc->data[SC_STRIKING])
-		watk += sc->data[SC_STRIKING]->val2;
-	if((sc->data[SC_FIRE_INSIGNIA] && sc->data[SC_FIRE_INSIGNIA]->val1 == 2)
-		|| (sc->data[SC_WATER_INSIGNIA] && sc->data[SC_WATER_INSIGNIA]->val1 == 2)
-		|| (sc->data[SC_WIND_INSIGNIA] && sc->data[SC_WIND_INSIGNIA]->val1 == 2)
-		|| (sc->data[SC_EARTH_INSIGNIA] && sc->data[SC_EARTH_INSIGNIA]->val1 == 2)
+				watk += SC_ENTRY(sc, SC_NIBELUNGEN)->val2;
+		}
+	}
+#endif
+	if(SC_ENTRY(sc, SC__ENERVATION))
+		watk -= watk * SC_ENTRY(sc, SC__ENERVATION)->val2 / 100;
+	if(SC_ENTRY(sc, SC_RUSH_WINDMILL))
+		watk += SC_ENTRY(sc, SC_RUSH_WINDMILL)->val2;
+	if (SC_ENTRY(sc, SC_ODINS_POWER))
+		watk += 40 + 30 * SC_ENTRY(sc, SC_ODINS_POWER)->val1;
+	if(SC_ENTRY(sc, SC_STRIKING))
+		watk += SC_ENTRY(sc, SC_STRIKING)->val2;
+	if((SC_ENTRY(sc, SC_FIRE_INSIGNIA) && SC_ENTRY(sc, SC_FIRE_INSIGNIA)->val1 == 2)
+		|| (SC_ENTRY(sc, SC_WATER_INSIGNIA) && SC_ENTRY(sc, SC_WATER_INSIGNIA)->val1 == 2)
+		|| (SC_ENTRY(sc, SC_WIND_INSIGNIA) && SC_ENTRY(sc, SC_WIND_INSIGNIA)->val1 == 2)
+		|| (SC_ENTRY(sc, SC_EARTH_INSIGNIA) && SC_ENTRY(sc, SC_EARTH_INSIGNIA)->val1 == 2)
 		)
 		watk += watk / 10;
-	if(sc->data[SC_TIDAL_WEAPON])
-		watk += watk * sc->data[SC_TIDAL_WEAPON]->val2 / 100;
-	if(sc->data[SC_ANGRIFFS_MODUS])
-		watk += watk * sc->data[SC_ANGRIFFS_MODUS]->val2/100;
-	if( sc->data[SC_FLASHCOMBO] )
-		watk += sc->data[SC_FLASHCOMBO]->val2;
-	if (sc->data[SC_CATNIPPOWDER])
-		watk -= watk * sc->data[SC_CATNIPPOWDER]->val2 / 100;
-	if (sc->data[SC_SUNSTANCE] != NULL)
-		watk += watk * sc->data[SC_SUNSTANCE]->val2 / 100;
-	if (sc->data[SC_SOULFALCON] != NULL)
-		watk += sc->data[SC_SOULFALCON]->val2;
+	if(SC_ENTRY(sc, SC_TIDAL_WEAPON))
+		watk += watk * SC_ENTRY(sc, SC_TIDAL_WEAPON)->val2 / 100;
+	if(SC_ENTRY(sc, SC_ANGRIFFS_MODUS))
+		watk += watk * SC_ENTRY(sc, SC_ANGRIFFS_MODUS)->val2/100;
+	if( SC_ENTRY(sc, SC_FLASHCOMBO) )
+		watk += SC_ENTRY(sc, SC_FLASHCOMBO)->val2;
+	if (SC_ENTRY(sc, SC_CATNIPPOWDER))
+		watk -= watk * SC_ENTRY(sc, SC_CATNIPPOWDER)->val2 / 100;
+	if (SC_ENTRY(sc, SC_SUNSTANCE) != NULL)
+		watk += watk * SC_ENTRY(sc, SC_SUNSTANCE)->val2 / 100;
+	if (SC_ENTRY(sc, SC_SOULFALCON) != NULL)
+		watk += SC_ENTRY(sc, SC_SOULFALCON)->val2;
 
 #ifdef RENEWAL
-	if (sc->data[SC_NIBELUNGEN] != NULL && sc->data[SC_NIBELUNGEN]->val2 == SC_INCATKRATE)
+	if (SC_ENTRY(sc, SC_NIBELUNGEN) != NULL && SC_ENTRY(sc, SC_NIBELUNGEN)->val2 == SC_INCATKRATE)
 		watk += watk * 20/100;
 #endif
 
@@ -4779,28 +4783,28 @@ static int status_calc_ematk(struct block_list *bl, struct status_change *sc, in
 #ifdef RENEWAL
 	if (!sc || !sc->count)
 		return cap_value(matk, battle_config.matk_min, battle_config.matk_max);
-	if (sc->data[SC_PLUSMAGICPOWER])
-		matk += sc->data[SC_PLUSMAGICPOWER]->val1;
-	if (sc->data[SC_MATKFOOD])
-		matk += sc->data[SC_MATKFOOD]->val1;
-	if(sc->data[SC_MANA_PLUS])
-		matk += sc->data[SC_MANA_PLUS]->val1;
-	if(sc->data[SC_AQUAPLAY_OPTION])
-		matk += sc->data[SC_AQUAPLAY_OPTION]->val2;
-	if(sc->data[SC_CHILLY_AIR_OPTION])
-		matk += sc->data[SC_CHILLY_AIR_OPTION]->val2;
-	if(sc->data[SC_COOLER_OPTION])
-		matk += sc->data[SC_COOLER_OPTION]->val2;
-	if(sc->data[SC_FIRE_INSIGNIA] && sc->data[SC_FIRE_INSIGNIA]->val1 == 3)
+	if (SC_ENTRY(sc, SC_PLUSMAGICPOWER))
+		matk += SC_ENTRY(sc, SC_PLUSMAGICPOWER)->val1;
+	if (SC_ENTRY(sc, SC_MATKFOOD))
+		matk += SC_ENTRY(sc, SC_MATKFOOD)->val1;
+	if(SC_ENTRY(sc, SC_MANA_PLUS))
+		matk += SC_ENTRY(sc, SC_MANA_PLUS)->val1;
+	if(SC_ENTRY(sc, SC_AQUAPLAY_OPTION))
+		matk += SC_ENTRY(sc, SC_AQUAPLAY_OPTION)->val2;
+	if(SC_ENTRY(sc, SC_CHILLY_AIR_OPTION))
+		matk += SC_ENTRY(sc, SC_CHILLY_AIR_OPTION)->val2;
+	if(SC_ENTRY(sc, SC_COOLER_OPTION))
+		matk += SC_ENTRY(sc, SC_COOLER_OPTION)->val2;
+	if(SC_ENTRY(sc, SC_FIRE_INSIGNIA) && SC_ENTRY(sc, SC_FIRE_INSIGNIA)->val1 == 3)
 		matk += 50;
-	if(sc->data[SC_ODINS_POWER])
-		matk += 40 + 30 * sc->data[SC_ODINS_POWER]->val1; //70 lvl1, 100lvl2
-	if(sc->data[SC_IZAYOI])
-		matk += 25 * sc->data[SC_IZAYOI]->val1;
-	if (sc->data[SC_SHRIMP])
-		matk += matk * sc->data[SC_SHRIMP]->val2 / 100;
-	if (sc->data[SC_SOULFAIRY] != NULL)
-		matk += sc->data[SC_SOULFAIRY]->val2;
+	if(SC_ENTRY(sc, SC_ODINS_POWER))
+		matk += 40 + 30 * SC_ENTRY(sc, SC_ODINS_POWER)->val1; //70 lvl1, 100lvl2
+	if(SC_ENTRY(sc, SC_IZAYOI))
+		matk += 25 * SC_ENTRY(sc, SC_IZAYOI)->val1;
+	if (SC_ENTRY(sc, SC_SHRIMP))
+		matk += matk * SC_ENTRY(sc, SC_SHRIMP)->val2 / 100;
+	if (SC_ENTRY(sc, SC_SOULFAIRY) != NULL)
+		matk += SC_ENTRY(sc, SC_SOULFAIRY)->val2;
 	return cap_value(matk, battle_config.matk_min, battle_config.matk_max);
 #else
 	return 0;
@@ -4814,79 +4818,79 @@ static int status_calc_matk(struct block_list *bl, struct status_change *sc, int
 
 	if (!viewable) {
 		/* some statuses that are hidden in the status window */
-		if (sc->data[SC_POPECOOKIE] != NULL)
-			matk += matk * sc->data[SC_POPECOOKIE]->val2 / 100;
-		if (sc->data[SC_VITALIZE_POTION] != NULL)
-			matk += matk * sc->data[SC_VITALIZE_POTION]->val2 / 100;
+		if (SC_ENTRY(sc, SC_POPECOOKIE) != NULL)
+			matk += matk * SC_ENTRY(sc, SC_POPECOOKIE)->val2 / 100;
+		if (SC_ENTRY(sc, SC_VITALIZE_POTION) != NULL)
+			matk += matk * SC_ENTRY(sc, SC_VITALIZE_POTION)->val2 / 100;
 		return cap_value(matk, battle_config.matk_min, battle_config.matk_max);
 	}
 
 #ifndef RENEWAL
 	// take note fixed value first before % modifiers
-	if (sc->data[SC_PLUSMAGICPOWER])
-		matk += sc->data[SC_PLUSMAGICPOWER]->val1;
-	if (sc->data[SC_MATKFOOD])
-		matk += sc->data[SC_MATKFOOD]->val1;
-	if (sc->data[SC_MANA_PLUS])
-		matk += sc->data[SC_MANA_PLUS]->val1;
-	if (sc->data[SC_AQUAPLAY_OPTION])
-		matk += sc->data[SC_AQUAPLAY_OPTION]->val2;
-	if (sc->data[SC_CHILLY_AIR_OPTION])
-		matk += sc->data[SC_CHILLY_AIR_OPTION]->val2;
-	if (sc->data[SC_COOLER_OPTION])
-		matk += sc->data[SC_COOLER_OPTION]->val2;
-	if (sc->data[SC_FIRE_INSIGNIA] && sc->data[SC_FIRE_INSIGNIA]->val1 == 3)
+	if (SC_ENTRY(sc, SC_PLUSMAGICPOWER))
+		matk += SC_ENTRY(sc, SC_PLUSMAGICPOWER)->val1;
+	if (SC_ENTRY(sc, SC_MATKFOOD))
+		matk += SC_ENTRY(sc, SC_MATKFOOD)->val1;
+	if (SC_ENTRY(sc, SC_MANA_PLUS))
+		matk += SC_ENTRY(sc, SC_MANA_PLUS)->val1;
+	if (SC_ENTRY(sc, SC_AQUAPLAY_OPTION))
+		matk += SC_ENTRY(sc, SC_AQUAPLAY_OPTION)->val2;
+	if (SC_ENTRY(sc, SC_CHILLY_AIR_OPTION))
+		matk += SC_ENTRY(sc, SC_CHILLY_AIR_OPTION)->val2;
+	if (SC_ENTRY(sc, SC_COOLER_OPTION))
+		matk += SC_ENTRY(sc, SC_COOLER_OPTION)->val2;
+	if (SC_ENTRY(sc, SC_FIRE_INSIGNIA) && SC_ENTRY(sc, SC_FIRE_INSIGNIA)->val1 == 3)
 		matk += 50;
-	if (sc->data[SC_ODINS_POWER])
-		matk += 40 + 30 * sc->data[SC_ODINS_POWER]->val1; //70 lvl1, 100lvl2
-	if (sc->data[SC_IZAYOI])
-		matk += 25 * sc->data[SC_IZAYOI]->val1;
+	if (SC_ENTRY(sc, SC_ODINS_POWER))
+		matk += 40 + 30 * SC_ENTRY(sc, SC_ODINS_POWER)->val1; //70 lvl1, 100lvl2
+	if (SC_ENTRY(sc, SC_IZAYOI))
+		matk += 25 * SC_ENTRY(sc, SC_IZAYOI)->val1;
 #else // RENEWAL
-	if (sc->data[SC_IMPOSITIO])
-		matk += sc->data[SC_IMPOSITIO]->val2;
+	if (SC_ENTRY(sc, SC_IMPOSITIO))
+		matk += SC_ENTRY(sc, SC_IMPOSITIO)->val2;
 	// FIXME: This (and SC_IMPOSITIO) should have their effects shown in status window.
-	if (sc->data[SC_VOLCANO] != NULL)
-		matk += sc->data[SC_VOLCANO]->val2;
-	if (sc->data[SC_NIBELUNGEN] != NULL && sc->data[SC_NIBELUNGEN]->val2 == RINGNBL_EFF_MATK)
+	if (SC_ENTRY(sc, SC_VOLCANO) != NULL)
+		matk += SC_ENTRY(sc, SC_VOLCANO)->val2;
+	if (SC_ENTRY(sc, SC_NIBELUNGEN) != NULL && SC_ENTRY(sc, SC_NIBELUNGEN)->val2 == RINGNBL_EFF_MATK)
 		matk += matk * 20/100;
 #endif
-	if (sc->data[SC_ZANGETSU])
-		matk += sc->data[SC_ZANGETSU]->val3;
-	if (sc->data[SC_MAGICPOWER] && sc->data[SC_MAGICPOWER]->val4)
-		matk += matk * sc->data[SC_MAGICPOWER]->val3 / 100;
-	if (sc->data[SC_INCMATKRATE]) // Apparently nothing in Hercules uses this. Why does this exist?
-		matk += matk * sc->data[SC_INCMATKRATE]->val1 / 100;
-	if (sc->data[SC_MOONLIT_SERENADE])
-		matk += matk * sc->data[SC_MOONLIT_SERENADE]->val2 / 100;
-	if (sc->data[SC_MTF_MATK])
-		matk += sc->data[SC_MTF_MATK]->val1;
-	if (sc->data[SC_MYSTICSCROLL])
-		matk += matk * sc->data[SC_MYSTICSCROLL]->val1 / 100;
+	if (SC_ENTRY(sc, SC_ZANGETSU))
+		matk += SC_ENTRY(sc, SC_ZANGETSU)->val3;
+	if (SC_ENTRY(sc, SC_MAGICPOWER) && SC_ENTRY(sc, SC_MAGICPOWER)->val4)
+		matk += matk * SC_ENTRY(sc, SC_MAGICPOWER)->val3 / 100;
+	if (SC_ENTRY(sc, SC_INCMATKRATE)) // Apparently nothing in Hercules uses this. Why does this exist?
+		matk += matk * SC_ENTRY(sc, SC_INCMATKRATE)->val1 / 100;
+	if (SC_ENTRY(sc, SC_MOONLIT_SERENADE))
+		matk += matk * SC_ENTRY(sc, SC_MOONLIT_SERENADE)->val2 / 100;
+	if (SC_ENTRY(sc, SC_MTF_MATK))
+		matk += SC_ENTRY(sc, SC_MTF_MATK)->val1;
+	if (SC_ENTRY(sc, SC_MYSTICSCROLL))
+		matk += matk * SC_ENTRY(sc, SC_MYSTICSCROLL)->val1 / 100;
 
 	// Eden Crystal Synthesis
-	if (sc->data[SC_QUEST_BUFF1])
-		matk += sc->data[SC_QUEST_BUFF1]->val1;
-	if (sc->data[SC_QUEST_BUFF2])
-		matk += sc->data[SC_QUEST_BUFF2]->val1;
-	if (sc->data[SC_QUEST_BUFF3])
-		matk += sc->data[SC_QUEST_BUFF3]->val1;
+	if (SC_ENTRY(sc, SC_QUEST_BUFF1))
+		matk += SC_ENTRY(sc, SC_QUEST_BUFF1)->val1;
+	if (SC_ENTRY(sc, SC_QUEST_BUFF2))
+		matk += SC_ENTRY(sc, SC_QUEST_BUFF2)->val1;
+	if (SC_ENTRY(sc, SC_QUEST_BUFF3))
+		matk += SC_ENTRY(sc, SC_QUEST_BUFF3)->val1;
 
 	// Geffen Magic Tournament
-	if (sc->data[SC_FENRIR_CARD])
-		matk += sc->data[SC_FENRIR_CARD]->val1;
-
-	if (sc->data[SC_GM_BATTLE])
-		matk += matk * sc->data[SC_GM_BATTLE]->val1 / 100;
-	if (sc->data[SC_GM_BATTLE2])
-		matk += matk * sc->data[SC_GM_BATTLE2]->val1 / 100;
-	if (sc->data[SC_2011RWC])
-		matk += matk * sc->data[SC_2011RWC]->val2 / 100;
-	if (sc->data[SC_MAGIC_CANDY])
-		matk += sc->data[SC_MAGIC_CANDY]->val1;
-	if (sc->data[SC_SKF_MATK] != NULL)
-		matk += sc->data[SC_SKF_MATK]->val1;
-	if (sc->data[SC_ALMIGHTY] != NULL)
-		matk += sc->data[SC_ALMIGHTY]->val2;
+	if (SC_ENTRY(sc, SC_FENRIR_CARD))
+		matk += SC_ENTRY(sc, SC_FENRIR_CARD)->val1;
+
+	if (SC_ENTRY(sc, SC_GM_BATTLE))
+		matk += matk * SC_ENTRY(sc, SC_GM_BATTLE)->val1 / 100;
+	if (SC_ENTRY(sc, SC_GM_BATTLE2))
+		matk += matk * SC_ENTRY(sc, SC_GM_BATTLE2)->val1 / 100;
+	if (SC_ENTRY(sc, SC_2011RWC))
+		matk += matk * SC_ENTRY(sc, SC_2011RWC)->val2 / 100;
+	if (SC_ENTRY(sc, SC_MAGIC_CANDY))
+		matk += SC_ENTRY(sc, SC_MAGIC_CANDY)->val1;
+	if (SC_ENTRY(sc, SC_SKF_MATK) != NULL)
+		matk += SC_ENTRY(sc, SC_SKF_MATK)->val1;
+	if (SC_ENTRY(sc, SC_ALMIGHTY) != NULL)
+		matk += SC_ENTRY(sc, SC_ALMIGHTY)->val2;
 
 	return cap_value(matk, battle_config.matk_min, battle_config.matk_max);
 }
@@ -4901,37 +4905,37 @@ static int status_calc_critical(struct block_list *bl, struct status_change *sc,
 		return cap_value(critical, battle_config.critical_min, battle_config.critical_max);
 	}
 
-	if (sc->data[SC_CRITICALPERCENT])
-		critical += sc->data[SC_CRITICALPERCENT]->val2;
-	if (sc->data[SC_FOOD_CRITICALSUCCESSVALUE])
-		critical += sc->data[SC_FOOD_CRITICALSUCCESSVALUE]->val1;
-	if (sc->data[SC_EXPLOSIONSPIRITS])
-		critical += sc->data[SC_EXPLOSIONSPIRITS]->val2;
-	if (sc->data[SC_FORTUNE] != NULL)
-		critical += sc->data[SC_FORTUNE]->val2;
-	if (sc->data[SC_TRUESIGHT])
-		critical += sc->data[SC_TRUESIGHT]->val2;
-	if (sc->data[SC_CLOAKING])
+	if (SC_ENTRY(sc, SC_CRITICALPERCENT))
+		critical += SC_ENTRY(sc, SC_CRITICALPERCENT)->val2;
+	if (SC_ENTRY(sc, SC_FOOD_CRITICALSUCCESSVALUE))
+		critical += SC_ENTRY(sc, SC_FOOD_CRITICALSUCCESSVALUE)->val1;
+	if (SC_ENTRY(sc, SC_EXPLOSIONSPIRITS))
+		critical += SC_ENTRY(sc, SC_EXPLOSIONSPIRITS)->val2;
+	if (SC_ENTRY(sc, SC_FORTUNE) != NULL)
+		critical += SC_ENTRY(sc, SC_FORTUNE)->val2;
+	if (SC_ENTRY(sc, SC_TRUESIGHT))
+		critical += SC_ENTRY(sc, SC_TRUESIGHT)->val2;
+	if (SC_ENTRY(sc, SC_CLOAKING))
 		critical += critical;
-	if (sc->data[SC_STRIKING])
-		critical += sc->data[SC_STRIKING]->val1;
+	if (SC_ENTRY(sc, SC_STRIKING))
+		critical += SC_ENTRY(sc, SC_STRIKING)->val1;
 #ifdef RENEWAL
-	if (sc->data[SC_SPEARQUICKEN])
-		critical += 3*sc->data[SC_SPEARQUICKEN]->val1 * 10;
-	if (sc->data[SC_TWOHANDQUICKEN] != NULL)
-		critical += 20 + sc->data[SC_TWOHANDQUICKEN]->val1 * 10;
-#endif
-
-	if (sc->data[SC__INVISIBILITY])
-		critical += sc->data[SC__INVISIBILITY]->val3;
-	if (sc->data[SC__UNLUCKY])
-		critical -= critical * sc->data[SC__UNLUCKY]->val2 / 100;
-	if (sc->data[SC_BEYOND_OF_WARCRY])
-		critical += sc->data[SC_BEYOND_OF_WARCRY]->val3 * 10;
-	if (sc->data[SC_BUCHEDENOEL])
-		critical += sc->data[SC_BUCHEDENOEL]->val4 * 10;
-	if (sc->data[SC_SOULSHADOW] != NULL)
-		critical += 10 * sc->data[SC_SOULSHADOW]->val3;
+	if (SC_ENTRY(sc, SC_SPEARQUICKEN))
+		critical += 3*SC_ENTRY(sc, SC_SPEARQUICKEN)->val1 * 10;
+	if (SC_ENTRY(sc, SC_TWOHANDQUICKEN) != NULL)
+		critical += 20 + SC_ENTRY(sc, SC_TWOHANDQUICKEN)->val1 * 10;
+#endif
+
+	if (SC_ENTRY(sc, SC__INVISIBILITY))
+		critical += SC_ENTRY(sc, SC__INVISIBILITY)->val3;
+	if (SC_ENTRY(sc, SC__UNLUCKY))
+		critical -= critical * SC_ENTRY(sc, SC__UNLUCKY)->val2 / 100;
+	if (SC_ENTRY(sc, SC_BEYOND_OF_WARCRY))
+		critical += SC_ENTRY(sc, SC_BEYOND_OF_WARCRY)->val3 * 10;
+	if (SC_ENTRY(sc, SC_BUCHEDENOEL))
+		critical += SC_ENTRY(sc, SC_BUCHEDENOEL)->val4 * 10;
+	if (SC_ENTRY(sc, SC_SOULSHADOW) != NULL)
+		critical += 10 * SC_ENTRY(sc, SC_SOULSHADOW)->val3;
 
 	return cap_value(critical, battle_config.critical_min, battle_config.critical_max);
 }
@@ -4944,61 +4948,61 @@ static int status_calc_hit(struct block_list *bl, struct status_change *sc, int
 
 	if (!viewable) {
 		/* some statuses that are hidden in the status window */
-		if (sc->data[SC_MTF_ASPD])
-			hit += sc->data[SC_MTF_ASPD]->val2;
+		if (SC_ENTRY(sc, SC_MTF_ASPD))
+			hit += SC_ENTRY(sc, SC_MTF_ASPD)->val2;
 		return cap_value(hit, battle_config.hit_min, battle_config.hit_max);
 	}
 
-	if (sc->data[SC_INCHIT])
-		hit += sc->data[SC_INCHIT]->val1;
-	if (sc->data[SC_MTF_HITFLEE])
-		hit += sc->data[SC_MTF_HITFLEE]->val1;
-	if (sc->data[SC_FOOD_BASICHIT])
-		hit += sc->data[SC_FOOD_BASICHIT]->val1;
-	if (sc->data[SC_TRUESIGHT])
-		hit += sc->data[SC_TRUESIGHT]->val3;
-	if (sc->data[SC_HUMMING])
-		hit += sc->data[SC_HUMMING]->val2;
-	if (sc->data[SC_LKCONCENTRATION])
-		hit += sc->data[SC_LKCONCENTRATION]->val3;
-	if (sc->data[SC_INSPIRATION])
-		hit += 5 * sc->data[SC_INSPIRATION]->val1 + 25;
-	if (sc->data[SC_GS_ADJUSTMENT])
+	if (SC_ENTRY(sc, SC_INCHIT))
+		hit += SC_ENTRY(sc, SC_INCHIT)->val1;
+	if (SC_ENTRY(sc, SC_MTF_HITFLEE))
+		hit += SC_ENTRY(sc, SC_MTF_HITFLEE)->val1;
+	if (SC_ENTRY(sc, SC_FOOD_BASICHIT))
+		hit += SC_ENTRY(sc, SC_FOOD_BASICHIT)->val1;
+	if (SC_ENTRY(sc, SC_TRUESIGHT))
+		hit += SC_ENTRY(sc, SC_TRUESIGHT)->val3;
+	if (SC_ENTRY(sc, SC_HUMMING))
+		hit += SC_ENTRY(sc, SC_HUMMING)->val2;
+	if (SC_ENTRY(sc, SC_LKCONCENTRATION))
+		hit += SC_ENTRY(sc, SC_LKCONCENTRATION)->val3;
+	if (SC_ENTRY(sc, SC_INSPIRATION))
+		hit += 5 * SC_ENTRY(sc, SC_INSPIRATION)->val1 + 25;
+	if (SC_ENTRY(sc, SC_GS_ADJUSTMENT))
 		hit -= 30;
-	if (sc->data[SC_GS_ACCURACY])
+	if (SC_ENTRY(sc, SC_GS_ACCURACY))
 		hit += 20; // RockmanEXE; changed based on updated [Reddozen]
-	if (sc->data[SC_MER_HIT])
-		hit += sc->data[SC_MER_HIT]->val2;
-	if (sc->data[SC_INCHITRATE])
-		hit += hit * sc->data[SC_INCHITRATE]->val1/100;
-	if (sc->data[SC_BLIND])
+	if (SC_ENTRY(sc, SC_MER_HIT))
+		hit += SC_ENTRY(sc, SC_MER_HIT)->val2;
+	if (SC_ENTRY(sc, SC_INCHITRATE))
+		hit += hit * SC_ENTRY(sc, SC_INCHITRATE)->val1/100;
+	if (SC_ENTRY(sc, SC_BLIND))
 		hit -= hit * 25/100;
-	if (sc->data[SC_FIRE_EXPANSION_TEAR_GAS])
+	if (SC_ENTRY(sc, SC_FIRE_EXPANSION_TEAR_GAS))
 		hit -= hit * 50 / 100;
-	if (sc->data[SC__GROOMY])
-		hit -= hit * sc->data[SC__GROOMY]->val3 / 100;
-	if (sc->data[SC_FEAR])
+	if (SC_ENTRY(sc, SC__GROOMY))
+		hit -= hit * SC_ENTRY(sc, SC__GROOMY)->val3 / 100;
+	if (SC_ENTRY(sc, SC_FEAR))
 		hit -= hit * 20 / 100;
-	if (sc->data[SC_VOLCANIC_ASH])
+	if (SC_ENTRY(sc, SC_VOLCANIC_ASH))
 		hit /= 2;
-	if (sc->data[SC_ILLUSIONDOPING])
-		hit -= hit * (5 + sc->data[SC_ILLUSIONDOPING]->val1) / 100; //custom
-	if (sc->data[SC_ACARAJE])
-		hit += sc->data[SC_ACARAJE]->val1;
-	if (sc->data[SC_BUCHEDENOEL])
-		hit += sc->data[SC_BUCHEDENOEL]->val3;
-	if (sc->data[SC_HEAT_BARREL])
-		hit -= sc->data[SC_HEAT_BARREL]->val4;
-	if (sc->data[SC_SOULFALCON] != NULL)
-		hit += sc->data[SC_SOULFALCON]->val3;
+	if (SC_ENTRY(sc, SC_ILLUSIONDOPING))
+		hit -= hit * (5 + SC_ENTRY(sc, SC_ILLUSIONDOPING)->val1) / 100; //custom
+	if (SC_ENTRY(sc, SC_ACARAJE))
+		hit += SC_ENTRY(sc, SC_ACARAJE)->val1;
+	if (SC_ENTRY(sc, SC_BUCHEDENOEL))
+		hit += SC_ENTRY(sc, SC_BUCHEDENOEL)->val3;
+	if (SC_ENTRY(sc, SC_HEAT_BARREL))
+		hit -= SC_ENTRY(sc, SC_HEAT_BARREL)->val4;
+	if (SC_ENTRY(sc, SC_SOULFALCON) != NULL)
+		hit += SC_ENTRY(sc, SC_SOULFALCON)->val3;
 #ifdef RENEWAL
-	if (sc->data[SC_BLESSING] != NULL)
-		hit += sc->data[SC_BLESSING]->val3;
-	if (sc->data[SC_TWOHANDQUICKEN] != NULL)
-		hit += 2 * sc->data[SC_TWOHANDQUICKEN]->val1;
-	if (sc->data[SC_ADRENALINE] != NULL)
-		hit += sc->data[SC_ADRENALINE]->val4;
-	if (sc->data[SC_NIBELUNGEN] != NULL && sc->data[SC_NIBELUNGEN]->val2 == RINGNBL_EFF_HIT)
+	if (SC_ENTRY(sc, SC_BLESSING) != NULL)
+		hit += SC_ENTRY(sc, SC_BLESSING)->val3;
+	if (SC_ENTRY(sc, SC_TWOHANDQUICKEN) != NULL)
+		hit += 2 * SC_ENTRY(sc, SC_TWOHANDQUICKEN)->val1;
+	if (SC_ENTRY(sc, SC_ADRENALINE) != NULL)
+		hit += SC_ENTRY(sc, SC_ADRENALINE)->val4;
+	if (SC_ENTRY(sc, SC_NIBELUNGEN) != NULL && SC_ENTRY(sc, SC_NIBELUNGEN)->val2 == RINGNBL_EFF_HIT)
 		hit += 50;
 #endif
 
@@ -5024,84 +5028,84 @@ static int status_calc_flee(struct block_list *bl, struct status_change *sc, int
 		return cap_value(flee, battle_config.flee_min, battle_config.flee_max);
 	}
 
-	if (sc->data[SC_INCFLEE])
-		flee += sc->data[SC_INCFLEE]->val1;
-	if (sc->data[SC_MTF_HITFLEE])
-		flee += sc->data[SC_MTF_HITFLEE]->val2;
-	if (sc->data[SC_FOOD_BASICAVOIDANCE])
-		flee += sc->data[SC_FOOD_BASICAVOIDANCE]->val1;
-	if (sc->data[SC_WHISTLE])
-		flee += sc->data[SC_WHISTLE]->val2;
-	if (sc->data[SC_WINDWALK])
-		flee += sc->data[SC_WINDWALK]->val2;
-	if (sc->data[SC_VIOLENTGALE])
-		flee += sc->data[SC_VIOLENTGALE]->val2;
-	if (sc->data[SC_MOON_COMFORT]) // SG skill [Komurka]
-		flee += sc->data[SC_MOON_COMFORT]->val2;
-	if (sc->data[SC_RG_CCONFINE_M])
+	if (SC_ENTRY(sc, SC_INCFLEE))
+		flee += SC_ENTRY(sc, SC_INCFLEE)->val1;
+	if (SC_ENTRY(sc, SC_MTF_HITFLEE))
+		flee += SC_ENTRY(sc, SC_MTF_HITFLEE)->val2;
+	if (SC_ENTRY(sc, SC_FOOD_BASICAVOIDANCE))
+		flee += SC_ENTRY(sc, SC_FOOD_BASICAVOIDANCE)->val1;
+	if (SC_ENTRY(sc, SC_WHISTLE))
+		flee += SC_ENTRY(sc, SC_WHISTLE)->val2;
+	if (SC_ENTRY(sc, SC_WINDWALK))
+		flee += SC_ENTRY(sc, SC_WINDWALK)->val2;
+	if (SC_ENTRY(sc, SC_VIOLENTGALE))
+		flee += SC_ENTRY(sc, SC_VIOLENTGALE)->val2;
+	if (SC_ENTRY(sc, SC_MOON_COMFORT)) // SG skill [Komurka]
+		flee += SC_ENTRY(sc, SC_MOON_COMFORT)->val2;
+	if (SC_ENTRY(sc, SC_RG_CCONFINE_M))
 		flee += 10;
-	if (sc->data[SC_ANGRIFFS_MODUS])
-		flee -= sc->data[SC_ANGRIFFS_MODUS]->val3;
-	if (sc->data[SC_GS_ADJUSTMENT])
+	if (SC_ENTRY(sc, SC_ANGRIFFS_MODUS))
+		flee -= SC_ENTRY(sc, SC_ANGRIFFS_MODUS)->val3;
+	if (SC_ENTRY(sc, SC_GS_ADJUSTMENT))
 		flee += 30;
-	if (sc->data[SC_HLIF_SPEED])
-		flee += 10 + sc->data[SC_HLIF_SPEED]->val1 * 10;
-	if (sc->data[SC_GS_GATLINGFEVER])
-		flee -= sc->data[SC_GS_GATLINGFEVER]->val4;
-	if (sc->data[SC_PARTYFLEE])
-		flee += sc->data[SC_PARTYFLEE]->val1 * 10;
-	if (sc->data[SC_MER_FLEE])
-		flee += sc->data[SC_MER_FLEE]->val2;
-	if (sc->data[SC_HALLUCINATIONWALK])
-		flee += sc->data[SC_HALLUCINATIONWALK]->val2;
-	if (sc->data[SC_WATER_BARRIER])
-		flee -= sc->data[SC_WATER_BARRIER]->val3;
+	if (SC_ENTRY(sc, SC_HLIF_SPEED))
+		flee += 10 + SC_ENTRY(sc, SC_HLIF_SPEED)->val1 * 10;
+	if (SC_ENTRY(sc, SC_GS_GATLINGFEVER))
+		flee -= SC_ENTRY(sc, SC_GS_GATLINGFEVER)->val4;
+	if (SC_ENTRY(sc, SC_PARTYFLEE))
+		flee += SC_ENTRY(sc, SC_PARTYFLEE)->val1 * 10;
+	if (SC_ENTRY(sc, SC_MER_FLEE))
+		flee += SC_ENTRY(sc, SC_MER_FLEE)->val2;
+	if (SC_ENTRY(sc, SC_HALLUCINATIONWALK))
+		flee += SC_ENTRY(sc, SC_HALLUCINATIONWALK)->val2;
+	if (SC_ENTRY(sc, SC_WATER_BARRIER))
+		flee -= SC_ENTRY(sc, SC_WATER_BARRIER)->val3;
 #ifdef RENEWAL
-	if (sc->data[SC_SPEARQUICKEN])
-		flee += sc->data[SC_SPEARQUICKEN]->val1 * 2;
-	if (sc->data[SC_NIBELUNGEN] != NULL && sc->data[SC_NIBELUNGEN]->val2 == RINGNBL_EFF_FLEE)
+	if (SC_ENTRY(sc, SC_SPEARQUICKEN))
+		flee += SC_ENTRY(sc, SC_SPEARQUICKEN)->val1 * 2;
+	if (SC_ENTRY(sc, SC_NIBELUNGEN) != NULL && SC_ENTRY(sc, SC_NIBELUNGEN)->val2 == RINGNBL_EFF_FLEE)
 		flee += 50;
 #endif
-	if (sc->data[SC_INCFLEERATE])
-		flee += flee * sc->data[SC_INCFLEERATE]->val1 / 100;
-	if (sc->data[SC_SPIDERWEB] && sc->data[SC_SPIDERWEB]->val1)
+	if (SC_ENTRY(sc, SC_INCFLEERATE))
+		flee += flee * SC_ENTRY(sc, SC_INCFLEERATE)->val1 / 100;
+	if (SC_ENTRY(sc, SC_SPIDERWEB) && SC_ENTRY(sc, SC_SPIDERWEB)->val1)
 		flee -= flee * 50 / 100;
-	if (sc->data[SC_BERSERK])
+	if (SC_ENTRY(sc, SC_BERSERK))
 		flee -= flee * 50 / 100;
-	if (sc->data[SC_BLIND])
+	if (SC_ENTRY(sc, SC_BLIND))
 		flee -= flee * 25 / 100;
-	if (sc->data[SC_FEAR])
+	if (SC_ENTRY(sc, SC_FEAR))
 		flee -= flee * 20 / 100;
-	if (sc->data[SC_PARALYSE])
+	if (SC_ENTRY(sc, SC_PARALYSE))
 		flee -= flee / 10; // 10% Flee reduction
-	if (sc->data[SC_INFRAREDSCAN])
+	if (SC_ENTRY(sc, SC_INFRAREDSCAN))
 		flee -= flee * 30 / 100;
-	if (sc->data[SC__LAZINESS])
-		flee -= flee * sc->data[SC__LAZINESS]->val3 / 100;
-	if (sc->data[SC_GLOOMYDAY])
-		flee -= flee * ( 20 + 5 * sc->data[SC_GLOOMYDAY]->val1 ) / 100;
-	if (sc->data[SC_SATURDAY_NIGHT_FEVER])
-		flee -= flee * (40 + 10 * sc->data[SC_SATURDAY_NIGHT_FEVER]->val1) / 100;
-	if (sc->data[SC_FIRE_EXPANSION_SMOKE_POWDER])
+	if (SC_ENTRY(sc, SC__LAZINESS))
+		flee -= flee * SC_ENTRY(sc, SC__LAZINESS)->val3 / 100;
+	if (SC_ENTRY(sc, SC_GLOOMYDAY))
+		flee -= flee * ( 20 + 5 * SC_ENTRY(sc, SC_GLOOMYDAY)->val1 ) / 100;
+	if (SC_ENTRY(sc, SC_SATURDAY_NIGHT_FEVER))
+		flee -= flee * (40 + 10 * SC_ENTRY(sc, SC_SATURDAY_NIGHT_FEVER)->val1) / 100;
+	if (SC_ENTRY(sc, SC_FIRE_EXPANSION_SMOKE_POWDER))
 		flee += flee * 20 / 100;
-	if (sc->data[SC_FIRE_EXPANSION_TEAR_GAS])
+	if (SC_ENTRY(sc, SC_FIRE_EXPANSION_TEAR_GAS))
 		flee -= flee * 50 / 100;
-	if (sc->data[SC_CRIMSON_MARKER])
-		flee -= sc->data[SC_CRIMSON_MARKER]->val3;
-	if (sc->data[SC_WIND_STEP_OPTION])
-		flee += flee * sc->data[SC_WIND_STEP_OPTION]->val2 / 100;
-	if (sc->data[SC_ZEPHYR])
-		flee += sc->data[SC_ZEPHYR]->val2;
-	if (sc->data[SC_VOLCANIC_ASH] && (bl->type == BL_MOB)) { // mob
+	if (SC_ENTRY(sc, SC_CRIMSON_MARKER))
+		flee -= SC_ENTRY(sc, SC_CRIMSON_MARKER)->val3;
+	if (SC_ENTRY(sc, SC_WIND_STEP_OPTION))
+		flee += flee * SC_ENTRY(sc, SC_WIND_STEP_OPTION)->val2 / 100;
+	if (SC_ENTRY(sc, SC_ZEPHYR))
+		flee += SC_ENTRY(sc, SC_ZEPHYR)->val2;
+	if (SC_ENTRY(sc, SC_VOLCANIC_ASH) && (bl->type == BL_MOB)) { // mob
 		if(status_get_element(bl) == ELE_WATER) // water type
 			flee /= 2;
 	}
-	if (sc->data[SC_OVERED_BOOST]) // should be final and unmodifiable by any means
-		flee = sc->data[SC_OVERED_BOOST]->val2;
-	if (sc->data[SC_ARMORSCROLL])
-		flee += sc->data[SC_ARMORSCROLL]->val2;
-	if (sc->data[SC_MYSTICPOWDER])
-		flee += sc->data[SC_MYSTICPOWDER]->val2;
+	if (SC_ENTRY(sc, SC_OVERED_BOOST)) // should be final and unmodifiable by any means
+		flee = SC_ENTRY(sc, SC_OVERED_BOOST)->val2;
+	if (SC_ENTRY(sc, SC_ARMORSCROLL))
+		flee += SC_ENTRY(sc, SC_ARMORSCROLL)->val2;
+	if (SC_ENTRY(sc, SC_MYSTICPOWDER))
+		flee += SC_ENTRY(sc, SC_MYSTICPOWDER)->val2;
 
 	return cap_value(flee, battle_config.flee_min, battle_config.flee_max);
 }
@@ -5116,14 +5120,14 @@ static int status_calc_flee2(struct block_list *bl, struct status_change *sc, in
 		return cap_value(flee2, battle_config.flee2_min, battle_config.flee2_max);
 	}
 
-	if(sc->data[SC_PLUSAVOIDVALUE])
-		flee2 += sc->data[SC_PLUSAVOIDVALUE]->val2;
-	if(sc->data[SC_WHISTLE])
-		flee2 += sc->data[SC_WHISTLE]->val3*10;
-	if(sc->data[SC__UNLUCKY])
-		flee2 -= flee2 * sc->data[SC__UNLUCKY]->val2 / 100;
-	if (sc->data[SC_FREYJASCROLL])
-		flee2 += sc->data[SC_FREYJASCROLL]->val2;
+	if(SC_ENTRY(sc, SC_PLUSAVOIDVALUE))
+		flee2 += SC_ENTRY(sc, SC_PLUSAVOIDVALUE)->val2;
+	if(SC_ENTRY(sc, SC_WHISTLE))
+		flee2 += SC_ENTRY(sc, SC_WHISTLE)->val3*10;
+	if(SC_ENTRY(sc, SC__UNLUCKY))
+		flee2 -= flee2 * SC_ENTRY(sc, SC__UNLUCKY)->val2 / 100;
+	if (SC_ENTRY(sc, SC_FREYJASCROLL))
+		flee2 += SC_ENTRY(sc, SC_FREYJASCROLL)->val2;
 
 	return cap_value(flee2, battle_config.flee2_min, battle_config.flee2_max);
 }
@@ -5137,95 +5141,95 @@ static defType status_calc_def(struct block_list *bl, struct status_change *sc,
 
 	if (!viewable) {
 		/* some statuses that are hidden in the status window */
-		if (sc->data[SC_CAMOUFLAGE])
-			def -= def * 5 * (10-sc->data[SC_CAMOUFLAGE]->val4) / 100;
-		if (sc->data[SC_OVERED_BOOST]  && bl->type == BL_PC)
+		if (SC_ENTRY(sc, SC_CAMOUFLAGE))
+			def -= def * 5 * (10-SC_ENTRY(sc, SC_CAMOUFLAGE)->val4) / 100;
+		if (SC_ENTRY(sc, SC_OVERED_BOOST)  && bl->type == BL_PC)
 			def -= def * 50 / 100;
-		if (sc->data[SC_NEUTRALBARRIER])
-			def += def * (10 + 5*sc->data[SC_NEUTRALBARRIER]->val1) / 100;
-		if (sc->data[SC_FORCEOFVANGUARD])
-			def += def * 2 * sc->data[SC_FORCEOFVANGUARD]->val1 / 100;
-		if (sc->data[SC_DEFSET])
-			return sc->data[SC_DEFSET]->val1;
+		if (SC_ENTRY(sc, SC_NEUTRALBARRIER))
+			def += def * (10 + 5*SC_ENTRY(sc, SC_NEUTRALBARRIER)->val1) / 100;
+		if (SC_ENTRY(sc, SC_FORCEOFVANGUARD))
+			def += def * 2 * SC_ENTRY(sc, SC_FORCEOFVANGUARD)->val1 / 100;
+		if (SC_ENTRY(sc, SC_DEFSET))
+			return SC_ENTRY(sc, SC_DEFSET)->val1;
 		return (defType)cap_value(def,DEFTYPE_MIN,DEFTYPE_MAX);
 	}
 
 #ifdef RENEWAL
-	if (sc->data[SC_ETERNALCHAOS] != NULL)
+	if (SC_ENTRY(sc, SC_ETERNALCHAOS) != NULL)
 		return 0;
 #endif
 
-	if (sc->data[SC_BERSERK])
+	if (SC_ENTRY(sc, SC_BERSERK))
 		return 0;
-	if (sc->data[SC_SKA])
-		return sc->data[SC_SKA]->val3;
-	if (sc->data[SC_BARRIER])
+	if (SC_ENTRY(sc, SC_SKA))
+		return SC_ENTRY(sc, SC_SKA)->val3;
+	if (SC_ENTRY(sc, SC_BARRIER))
 		return 100;
-	if (sc->data[SC_KEEPING])
+	if (SC_ENTRY(sc, SC_KEEPING))
 		return 90;
 #ifndef RENEWAL // does not provide 90 DEF in renewal mode
-	if (sc->data[SC_STEELBODY])
+	if (SC_ENTRY(sc, SC_STEELBODY))
 		return 90;
 #endif
 
-	if (sc->data[SC_STONEHARDSKIN])
-		def += sc->data[SC_STONEHARDSKIN]->val1;
-	if (sc->data[SC_DRUMBATTLE])
-		def += sc->data[SC_DRUMBATTLE]->val3;
+	if (SC_ENTRY(sc, SC_STONEHARDSKIN))
+		def += SC_ENTRY(sc, SC_STONEHARDSKIN)->val1;
+	if (SC_ENTRY(sc, SC_DRUMBATTLE))
+		def += SC_ENTRY(sc, SC_DRUMBATTLE)->val3;
 
-	if (sc->data[SC_STONESKIN])
-		def += sc->data[SC_STONESKIN]->val2;
-	if (sc->data[SC_HAMI_DEFENCE]) //[orn]
-		def += sc->data[SC_HAMI_DEFENCE]->val2;
+	if (SC_ENTRY(sc, SC_STONESKIN))
+		def += SC_ENTRY(sc, SC_STONESKIN)->val2;
+	if (SC_ENTRY(sc, SC_HAMI_DEFENCE)) //[orn]
+		def += SC_ENTRY(sc, SC_HAMI_DEFENCE)->val2;
 
-	if (sc->data[SC_EARTH_INSIGNIA] && sc->data[SC_EARTH_INSIGNIA]->val1 == 2)
+	if (SC_ENTRY(sc, SC_EARTH_INSIGNIA) && SC_ENTRY(sc, SC_EARTH_INSIGNIA)->val1 == 2)
 		def += 50;
-	if (sc->data[SC_ODINS_POWER])
-		def -= 20 * sc->data[SC_ODINS_POWER]->val1;
+	if (SC_ENTRY(sc, SC_ODINS_POWER))
+		def -= 20 * SC_ENTRY(sc, SC_ODINS_POWER)->val1;
 
 #ifndef RENEWAL
-	if (sc->data[SC_STONE] && sc->opt1 == OPT1_STONE)
+	if (SC_ENTRY(sc, SC_STONE) && sc->opt1 == OPT1_STONE)
 		def >>=1;
-	if (sc->data[SC_FREEZE])
+	if (SC_ENTRY(sc, SC_FREEZE))
 		def >>=1;
-	if (sc->data[SC_INCDEFRATE])
-		def += def * sc->data[SC_INCDEFRATE]->val1/100;
-#endif
-	if (sc->data[SC_ANGRIFFS_MODUS])
-		def -= 30 + 20 * sc->data[SC_ANGRIFFS_MODUS]->val1;
-	if (sc->data[SC_CRUCIS])
-		def -= def * sc->data[SC_CRUCIS]->val2/100;
-	if (sc->data[SC_ANALYZE])
-		def -= def * ( 14 * sc->data[SC_ANALYZE]->val1 ) / 100;
-	if (sc->data[SC_SATURDAY_NIGHT_FEVER])
-		def -= def * (10 + 10 * sc->data[SC_SATURDAY_NIGHT_FEVER]->val1) / 100;
-	if (sc->data[SC_EARTHDRIVE])
+	if (SC_ENTRY(sc, SC_INCDEFRATE))
+		def += def * SC_ENTRY(sc, SC_INCDEFRATE)->val1/100;
+#endif
+	if (SC_ENTRY(sc, SC_ANGRIFFS_MODUS))
+		def -= 30 + 20 * SC_ENTRY(sc, SC_ANGRIFFS_MODUS)->val1;
+	if (SC_ENTRY(sc, SC_CRUCIS))
+		def -= def * SC_ENTRY(sc, SC_CRUCIS)->val2/100;
+	if (SC_ENTRY(sc, SC_ANALYZE))
+		def -= def * ( 14 * SC_ENTRY(sc, SC_ANALYZE)->val1 ) / 100;
+	if (SC_ENTRY(sc, SC_SATURDAY_NIGHT_FEVER))
+		def -= def * (10 + 10 * SC_ENTRY(sc, SC_SATURDAY_NIGHT_FEVER)->val1) / 100;
+	if (SC_ENTRY(sc, SC_EARTHDRIVE))
 		def -= def * 25 / 100;
-	if (sc->data[SC_ROCK_CRUSHER])
-		def -= def * sc->data[SC_ROCK_CRUSHER]->val2 / 100;
-	if (sc->data[SC_FROSTMISTY])
+	if (SC_ENTRY(sc, SC_ROCK_CRUSHER))
+		def -= def * SC_ENTRY(sc, SC_ROCK_CRUSHER)->val2 / 100;
+	if (SC_ENTRY(sc, SC_FROSTMISTY))
 		def -= def * 10 / 100;
-	if (sc->data[SC_OVERED_BOOST] && bl->type == BL_HOM)
+	if (SC_ENTRY(sc, SC_OVERED_BOOST) && bl->type == BL_HOM)
 		def -= def * 50 / 100;
 
-	if (sc->data[SC_POWER_OF_GAIA])
-		def += def * sc->data[SC_POWER_OF_GAIA]->val2 / 100;
-	if (sc->data[SC_SHIELDSPELL_REF] && sc->data[SC_SHIELDSPELL_REF]->val1 == 2)
-		def += sc->data[SC_SHIELDSPELL_REF]->val2;
-	if (sc->data[SC_PRESTIGE])
-		def += sc->data[SC_PRESTIGE]->val1;
-	if (sc->data[SC_VOLCANIC_ASH] && (bl->type == BL_MOB)) {
+	if (SC_ENTRY(sc, SC_POWER_OF_GAIA))
+		def += def * SC_ENTRY(sc, SC_POWER_OF_GAIA)->val2 / 100;
+	if (SC_ENTRY(sc, SC_SHIELDSPELL_REF) && SC_ENTRY(sc, SC_SHIELDSPELL_REF)->val1 == 2)
+		def += SC_ENTRY(sc, SC_SHIELDSPELL_REF)->val2;
+	if (SC_ENTRY(sc, SC_PRESTIGE))
+		def += SC_ENTRY(sc, SC_PRESTIGE)->val1;
+	if (SC_ENTRY(sc, SC_VOLCANIC_ASH) && (bl->type == BL_MOB)) {
 		if (status_get_race(bl) == RC_PLANT)
 			def /= 2;
 	}
-	if (sc->data[SC_UNLIMIT])
+	if (SC_ENTRY(sc, SC_UNLIMIT))
 		return 1;
-	if (sc->data[SC_ARMORSCROLL])
-		def += sc->data[SC_ARMORSCROLL]->val1;
-	if (sc->data[SC_MVPCARD_TAOGUNKA])
-		def -= sc->data[SC_MVPCARD_TAOGUNKA]->val2;
-	if (sc->data[SC_SOULGOLEM] != NULL)
-		def += sc->data[SC_SOULGOLEM]->val2;
+	if (SC_ENTRY(sc, SC_ARMORSCROLL))
+		def += SC_ENTRY(sc, SC_ARMORSCROLL)->val1;
+	if (SC_ENTRY(sc, SC_MVPCARD_TAOGUNKA))
+		def -= SC_ENTRY(sc, SC_MVPCARD_TAOGUNKA)->val2;
+	if (SC_ENTRY(sc, SC_SOULGOLEM) != NULL)
+		def += SC_ENTRY(sc, SC_SOULGOLEM)->val2;
 
 	return (defType)cap_value(def,DEFTYPE_MIN,DEFTYPE_MAX);
 }
@@ -5243,18 +5247,18 @@ static signed short status_calc_def2(struct block_list *bl, struct status_change
 	if (!viewable) {
 		/* some statuses that are hidden in the status window */
 #ifdef RENEWAL
-		if (sc->data[SC_ASSUMPTIO])
+		if (SC_ENTRY(sc, SC_ASSUMPTIO))
 			def2 <<= 1;
 #endif
 		// @TODO: Is is hidden or it should show?
-		if (sc->data[SC_ASSUMPTIO_BUFF] != NULL)
-			def2 += sc->data[SC_ASSUMPTIO_BUFF]->val1 * 50;
-		if (sc->data[SC_CAMOUFLAGE])
-			def2 -= def2 * 5 * (10-sc->data[SC_CAMOUFLAGE]->val4) / 100;
-		if (sc->data[SC_GENTLETOUCH_REVITALIZE])
-			def2 += sc->data[SC_GENTLETOUCH_REVITALIZE]->val2;
-		if (sc->data[SC_DEFSET])
-			return sc->data[SC_DEFSET]->val1;
+		if (SC_ENTRY(sc, SC_ASSUMPTIO_BUFF) != NULL)
+			def2 += SC_ENTRY(sc, SC_ASSUMPTIO_BUFF)->val1 * 50;
+		if (SC_ENTRY(sc, SC_CAMOUFLAGE))
+			def2 -= def2 * 5 * (10-SC_ENTRY(sc, SC_CAMOUFLAGE)->val4) / 100;
+		if (SC_ENTRY(sc, SC_GENTLETOUCH_REVITALIZE))
+			def2 += SC_ENTRY(sc, SC_GENTLETOUCH_REVITALIZE)->val2;
+		if (SC_ENTRY(sc, SC_DEFSET))
+			return SC_ENTRY(sc, SC_DEFSET)->val1;
 #ifdef RENEWAL
 		return (short)cap_value(def2,SHRT_MIN,SHRT_MAX);
 #else
@@ -5262,29 +5266,29 @@ static signed short status_calc_def2(struct block_list *bl, struct status_change
 #endif
 	}
 
-	if (sc->data[SC_BERSERK])
+	if (SC_ENTRY(sc, SC_BERSERK))
 		return 0;
-	if (sc->data[SC_ETERNALCHAOS])
+	if (SC_ENTRY(sc, SC_ETERNALCHAOS))
 		return 0;
-	if (sc->data[SC_SUN_COMFORT])
-		def2 += sc->data[SC_SUN_COMFORT]->val2;
-	if (sc->data[SC_BANDING] && sc->data[SC_BANDING]->val2 > 1)
-		def2 += (5 + sc->data[SC_BANDING]->val1) * (sc->data[SC_BANDING]->val2);
+	if (SC_ENTRY(sc, SC_SUN_COMFORT))
+		def2 += SC_ENTRY(sc, SC_SUN_COMFORT)->val2;
+	if (SC_ENTRY(sc, SC_BANDING) && SC_ENTRY(sc, SC_BANDING)->val2 > 1)
+		def2 += (5 + SC_ENTRY(sc, SC_BANDING)->val1) * (SC_ENTRY(sc, SC_BANDING)->val2);
 #ifdef RENEWAL //in renewal only the VIT stat bonus is boosted by angelus
-	if (sc->data[SC_ANGELUS])
-		def2 += status_get_vit(bl) / 2 * sc->data[SC_ANGELUS]->val2/100;
-#endif
-	if (sc->data[SC_ANALYZE])
-		def2 -= def2 * ( 14 * sc->data[SC_ANALYZE]->val1 ) / 100;
-	if (sc->data[SC_ECHOSONG])
-		def2 += def2 * sc->data[SC_ECHOSONG]->val3/100;
-	if (sc->data[SC_VOLCANIC_ASH] && (bl->type==BL_MOB)) {
+	if (SC_ENTRY(sc, SC_ANGELUS))
+		def2 += status_get_vit(bl) / 2 * SC_ENTRY(sc, SC_ANGELUS)->val2/100;
+#endif
+	if (SC_ENTRY(sc, SC_ANALYZE))
+		def2 -= def2 * ( 14 * SC_ENTRY(sc, SC_ANALYZE)->val1 ) / 100;
+	if (SC_ENTRY(sc, SC_ECHOSONG))
+		def2 += def2 * SC_ENTRY(sc, SC_ECHOSONG)->val3/100;
+	if (SC_ENTRY(sc, SC_VOLCANIC_ASH) && (bl->type==BL_MOB)) {
 		if (status_get_race(bl)==RC_PLANT)
 			def2 /= 2;
 	}
-	if (sc->data[SC_NEEDLE_OF_PARALYZE])
-		def2 -= def2 * sc->data[SC_NEEDLE_OF_PARALYZE]->val2 / 100;
-	if (sc->data[SC_UNLIMIT])
+	if (SC_ENTRY(sc, SC_NEEDLE_OF_PARALYZE))
+		def2 -= def2 * SC_ENTRY(sc, SC_NEEDLE_OF_PARALYZE)->val2 / 100;
+	if (SC_ENTRY(sc, SC_UNLIMIT))
 		return 1;
 
 #ifdef RENEWAL
@@ -5302,53 +5306,53 @@ static defType status_calc_mdef(struct block_list *bl, struct status_change *sc,
 
 	if( !viewable ){
 		/* some statuses that are hidden in the status window */
-		if(sc->data[SC_NEUTRALBARRIER] )
-			mdef += mdef * (5 * sc->data[SC_NEUTRALBARRIER]->val1 + 10) / 100;
-		if(sc->data[SC_MDEFSET])
-			return sc->data[SC_MDEFSET]->val1;
+		if(SC_ENTRY(sc, SC_NEUTRALBARRIER) )
+			mdef += mdef * (5 * SC_ENTRY(sc, SC_NEUTRALBARRIER)->val1 + 10) / 100;
+		if(SC_ENTRY(sc, SC_MDEFSET))
+			return SC_ENTRY(sc, SC_MDEFSET)->val1;
 		return (defType)cap_value(mdef,DEFTYPE_MIN,DEFTYPE_MAX);
 	}
 
-	if (sc->data[SC_BERSERK])
+	if (SC_ENTRY(sc, SC_BERSERK))
 		return 0;
-	if(sc->data[SC_BARRIER])
+	if(SC_ENTRY(sc, SC_BARRIER))
 		return 100;
 
 #ifndef RENEWAL // no longer provides 90 MDEF in renewal mode
-	if(sc->data[SC_STEELBODY])
+	if(SC_ENTRY(sc, SC_STEELBODY))
 		return 90;
 #endif
 
-	if(sc->data[SC_STONESKIN]) // [Aegis] Technically this uses MDEFPercent/DEFPercent + sth else
-		mdef += sc->data[SC_STONESKIN]->val3;
-	if(sc->data[SC_EARTH_INSIGNIA] && sc->data[SC_EARTH_INSIGNIA]->val1 == 3)
+	if(SC_ENTRY(sc, SC_STONESKIN)) // [Aegis] Technically this uses MDEFPercent/DEFPercent + sth else
+		mdef += SC_ENTRY(sc, SC_STONESKIN)->val3;
+	if(SC_ENTRY(sc, SC_EARTH_INSIGNIA) && SC_ENTRY(sc, SC_EARTH_INSIGNIA)->val1 == 3)
 		mdef += 50;
-	if(sc->data[SC_ENDURE])// It has been confirmed that eddga card grants 1 MDEF, not 0, not 10, but 1.
-		mdef += (sc->data[SC_ENDURE]->val4 == 0) ? sc->data[SC_ENDURE]->val1 : 1;
-	if(sc->data[SC_STONEHARDSKIN])// Final MDEF increase divided by 10 since were using classic (pre-renewal) mechanics. [Rytech]
-		mdef += sc->data[SC_STONEHARDSKIN]->val1;
-	if(sc->data[SC_STONE] && sc->opt1 == OPT1_STONE)
+	if(SC_ENTRY(sc, SC_ENDURE))// It has been confirmed that eddga card grants 1 MDEF, not 0, not 10, but 1.
+		mdef += (SC_ENTRY(sc, SC_ENDURE)->val4 == 0) ? SC_ENTRY(sc, SC_ENDURE)->val1 : 1;
+	if(SC_ENTRY(sc, SC_STONEHARDSKIN))// Final MDEF increase divided by 10 since were using classic (pre-renewal) mechanics. [Rytech]
+		mdef += SC_ENTRY(sc, SC_STONEHARDSKIN)->val1;
+	if(SC_ENTRY(sc, SC_STONE) && sc->opt1 == OPT1_STONE)
 		mdef += 25*mdef/100;
-	if(sc->data[SC_FREEZE])
+	if(SC_ENTRY(sc, SC_FREEZE))
 		mdef += 25*mdef/100;
-	if(sc->data[SC_ANALYZE])
-		mdef -= mdef * ( 14 * sc->data[SC_ANALYZE]->val1 ) / 100;
-	if(sc->data[SC_SYMPHONY_LOVE])
-		mdef += mdef * sc->data[SC_SYMPHONY_LOVE]->val2 / 100;
-	if(sc->data[SC_GENTLETOUCH_CHANGE] && sc->data[SC_GENTLETOUCH_CHANGE]->val4)
-		mdef -= mdef * sc->data[SC_GENTLETOUCH_CHANGE]->val4 / 100;
-	if (sc->data[SC_ODINS_POWER])
-		mdef -= 20 * sc->data[SC_ODINS_POWER]->val1;
-	if(sc->data[SC_BURNING])
+	if(SC_ENTRY(sc, SC_ANALYZE))
+		mdef -= mdef * ( 14 * SC_ENTRY(sc, SC_ANALYZE)->val1 ) / 100;
+	if(SC_ENTRY(sc, SC_SYMPHONY_LOVE))
+		mdef += mdef * SC_ENTRY(sc, SC_SYMPHONY_LOVE)->val2 / 100;
+	if(SC_ENTRY(sc, SC_GENTLETOUCH_CHANGE) && SC_ENTRY(sc, SC_GENTLETOUCH_CHANGE)->val4)
+		mdef -= mdef * SC_ENTRY(sc, SC_GENTLETOUCH_CHANGE)->val4 / 100;
+	if (SC_ENTRY(sc, SC_ODINS_POWER))
+		mdef -= 20 * SC_ENTRY(sc, SC_ODINS_POWER)->val1;
+	if(SC_ENTRY(sc, SC_BURNING))
 		mdef -= mdef *25 / 100;
-	if (sc->data[SC_UNLIMIT])
+	if (SC_ENTRY(sc, SC_UNLIMIT))
 		return 1;
-	if (sc->data[SC_FREYJASCROLL])
-		mdef += sc->data[SC_FREYJASCROLL]->val1;
-	if (sc->data[SC_MVPCARD_TAOGUNKA])
-		mdef -= sc->data[SC_MVPCARD_TAOGUNKA]->val3;
-	if (sc->data[SC_SOULGOLEM] != NULL)
-		mdef += sc->data[SC_SOULGOLEM]->val3;
+	if (SC_ENTRY(sc, SC_FREYJASCROLL))
+		mdef += SC_ENTRY(sc, SC_FREYJASCROLL)->val1;
+	if (SC_ENTRY(sc, SC_MVPCARD_TAOGUNKA))
+		mdef -= SC_ENTRY(sc, SC_MVPCARD_TAOGUNKA)->val3;
+	if (SC_ENTRY(sc, SC_SOULGOLEM) != NULL)
+		mdef += SC_ENTRY(sc, SC_SOULGOLEM)->val3;
 
 	return (defType)cap_value(mdef,DEFTYPE_MIN,DEFTYPE_MAX);
 }
@@ -5364,10 +5368,10 @@ static signed short status_calc_mdef2(struct block_list *bl, struct status_chang
 
 	if( !viewable ){
 		/* some statuses that are hidden in the status window */
-		if(sc->data[SC_MDEFSET])
-			return sc->data[SC_MDEFSET]->val1;
+		if(SC_ENTRY(sc, SC_MDEFSET))
+			return SC_ENTRY(sc, SC_MDEFSET)->val1;
 #ifdef RENEWAL
-		if (sc->data[SC_ASSUMPTIO])
+		if (SC_ENTRY(sc, SC_ASSUMPTIO))
 			mdef2 <<= 1;
 		return (short)cap_value(mdef2,SHRT_MIN,SHRT_MAX);
 #else
@@ -5375,13 +5379,13 @@ static signed short status_calc_mdef2(struct block_list *bl, struct status_chang
 #endif
 	}
 
-	if (sc->data[SC_BERSERK])
+	if (SC_ENTRY(sc, SC_BERSERK))
 		return 0;
-	if(sc->data[SC_SKA])
+	if(SC_ENTRY(sc, SC_SKA))
 		return 90;
-	if(sc->data[SC_ANALYZE])
-		mdef2 -= mdef2 * ( 14 * sc->data[SC_ANALYZE]->val1 ) / 100;
-	if (sc->data[SC_UNLIMIT])
+	if(SC_ENTRY(sc, SC_ANALYZE))
+		mdef2 -= mdef2 * ( 14 * SC_ENTRY(sc, SC_ANALYZE)->val1 ) / 100;
+	if (SC_ENTRY(sc, SC_UNLIMIT))
 		return 1;
 
 	struct status_data *sstatus = status->get_status_data(bl);
@@ -5422,18 +5426,18 @@ static unsigned short status_calc_speed(struct block_list *bl, struct status_cha
 		{
 			int val = 0;
 
-			if(sc->data[SC_FUSION]) {
+			if(SC_ENTRY(sc, SC_FUSION)) {
 				val = 25;
 			} else if (sd) {
 				if (pc_isridingpeco(sd) || pc_isridingdragon(sd))
 					val = 25;//Same bonus
-				else if (sd->sc.data[SC_ALL_RIDING])
-					val = sd->sc.data[SC_ALL_RIDING]->val1;
+				else if (SC_ENTRY(&sd->sc, SC_ALL_RIDING))
+					val = SC_ENTRY(&sd->sc, SC_ALL_RIDING)->val1;
 				else if (pc_isridingwug(sd))
 					val = 15 + 5 * pc->checkskill(sd, RA_WUGRIDER);
 				else if (pc_ismadogear(sd)) {
 					val = (- 10 * (5 - pc->checkskill(sd,NC_MADOLICENCE)));
-					if (sc->data[SC_ACCELERATION])
+					if (SC_ENTRY(sc, SC_ACCELERATION))
 						val += 25;
 				}
 			}
@@ -5445,84 +5449,84 @@ static unsigned short status_calc_speed(struct block_list *bl, struct status_cha
 		{
 			int val = 0;
 
-			if ( sd && sc->data[SC_HIDING] && pc->checkskill(sd,RG_TUNNELDRIVE) > 0 ) {
+			if ( sd && SC_ENTRY(sc, SC_HIDING) && pc->checkskill(sd,RG_TUNNELDRIVE) > 0 ) {
 				val = 120 - 6 * pc->checkskill(sd,RG_TUNNELDRIVE);
 			} else {
-				if( sd && sc->data[SC_CHASEWALK] && sc->data[SC_CHASEWALK]->val3 < 0 )
-					val = sc->data[SC_CHASEWALK]->val3;
+				if( sd && SC_ENTRY(sc, SC_CHASEWALK) && SC_ENTRY(sc, SC_CHASEWALK)->val3 < 0 )
+					val = SC_ENTRY(sc, SC_CHASEWALK)->val3;
 				else
 				{
 					// Longing for Freedom cancels song/dance penalty
-					if( sc->data[SC_LONGING] )
-						val = max( val, 50 - 10 * sc->data[SC_LONGING]->val1 );
+					if( SC_ENTRY(sc, SC_LONGING) )
+						val = max( val, 50 - 10 * SC_ENTRY(sc, SC_LONGING)->val1 );
 					else
-						if( sd && sc->data[SC_DANCING] )
-							val = max( val, 500 - (40 + 10 * (sc->data[SC_SOULLINK] && sc->data[SC_SOULLINK]->val2 == SL_BARDDANCER)) * pc->checkskill(sd,(sd->status.sex?BA_MUSICALLESSON:DC_DANCINGLESSON)) );
+						if( sd && SC_ENTRY(sc, SC_DANCING) )
+							val = max( val, 500 - (40 + 10 * (SC_ENTRY(sc, SC_SOULLINK) && SC_ENTRY(sc, SC_SOULLINK)->val2 == SL_BARDDANCER)) * pc->checkskill(sd,(sd->status.sex?BA_MUSICALLESSON:DC_DANCINGLESSON)) );
 
-					if( sc->data[SC_DEC_AGI] )
+					if( SC_ENTRY(sc, SC_DEC_AGI) )
 						val = max( val, 25 );
-					if( sc->data[SC_QUAGMIRE] || sc->data[SC_HALLUCINATIONWALK_POSTDELAY] )
+					if( SC_ENTRY(sc, SC_QUAGMIRE) || SC_ENTRY(sc, SC_HALLUCINATIONWALK_POSTDELAY) )
 						val = max( val, 50 );
-					if( sc->data[SC_DONTFORGETME] )
-						val = max( val, sc->data[SC_DONTFORGETME]->val3 );
-					if( sc->data[SC_CURSE] )
+					if( SC_ENTRY(sc, SC_DONTFORGETME) )
+						val = max( val, SC_ENTRY(sc, SC_DONTFORGETME)->val3 );
+					if( SC_ENTRY(sc, SC_CURSE) )
 						val = max( val, 300 );
-					if( sc->data[SC_CHASEWALK] )
-						val = max( val, sc->data[SC_CHASEWALK]->val3 );
-					if( sc->data[SC_WEDDING] )
+					if( SC_ENTRY(sc, SC_CHASEWALK) )
+						val = max( val, SC_ENTRY(sc, SC_CHASEWALK)->val3 );
+					if( SC_ENTRY(sc, SC_WEDDING) )
 						val = max( val, 100 );
-					if( sc->data[SC_JOINTBEAT] && sc->data[SC_JOINTBEAT]->val2&(BREAK_ANKLE|BREAK_KNEE) )
-						val = max( val, ((sc->data[SC_JOINTBEAT]->val2&BREAK_ANKLE) ? 50 : 0) + ((sc->data[SC_JOINTBEAT]->val2&BREAK_KNEE) ? 30 : 0) );
-					if( sc->data[SC_CLOAKING] && (sc->data[SC_CLOAKING]->val4&1) == 0 )
-						val = max( val, sc->data[SC_CLOAKING]->val1 < 3 ? 300 : 30 - 3 * sc->data[SC_CLOAKING]->val1 );
-					if( sc->data[SC_GOSPEL] && sc->data[SC_GOSPEL]->val4 == BCT_ENEMY )
+					if( SC_ENTRY(sc, SC_JOINTBEAT) && SC_ENTRY(sc, SC_JOINTBEAT)->val2&(BREAK_ANKLE|BREAK_KNEE) )
+						val = max( val, ((SC_ENTRY(sc, SC_JOINTBEAT)->val2&BREAK_ANKLE) ? 50 : 0) + ((SC_ENTRY(sc, SC_JOINTBEAT)->val2&BREAK_KNEE) ? 30 : 0) );
+					if( SC_ENTRY(sc, SC_CLOAKING) && (SC_ENTRY(sc, SC_CLOAKING)->val4&1) == 0 )
+						val = max( val, SC_ENTRY(sc, SC_CLOAKING)->val1 < 3 ? 300 : 30 - 3 * SC_ENTRY(sc, SC_CLOAKING)->val1 );
+					if( SC_ENTRY(sc, SC_GOSPEL) && SC_ENTRY(sc, SC_GOSPEL)->val4 == BCT_ENEMY )
 						val = max( val, 75 );
-					if (sc->data[SC_SLOWDOWN])
+					if (SC_ENTRY(sc, SC_SLOWDOWN))
 						val = max(val, 100);
-					if (sc->data[SC_MOVESLOW_POTION]) // Used by Slow_Down_Potion [Frost]
-						val = max(val, sc->data[SC_MOVESLOW_POTION]->val1);
-					if( sc->data[SC_GS_GATLINGFEVER] )
+					if (SC_ENTRY(sc, SC_MOVESLOW_POTION)) // Used by Slow_Down_Potion [Frost]
+						val = max(val, SC_ENTRY(sc, SC_MOVESLOW_POTION)->val1);
+					if( SC_ENTRY(sc, SC_GS_GATLINGFEVER) )
 						val = max( val, 100 );
-					if( sc->data[SC_NJ_SUITON] )
-						val = max( val, sc->data[SC_NJ_SUITON]->val3 );
-					if( sc->data[SC_SWOO] )
+					if( SC_ENTRY(sc, SC_NJ_SUITON) )
+						val = max( val, SC_ENTRY(sc, SC_NJ_SUITON)->val3 );
+					if( SC_ENTRY(sc, SC_SWOO) )
 						val = max( val, 300 );
-					if( sc->data[SC_FROSTMISTY] )
+					if( SC_ENTRY(sc, SC_FROSTMISTY) )
 						val = max( val, 50 );
-					if( sc->data[SC_CAMOUFLAGE] && (sc->data[SC_CAMOUFLAGE]->val3&1) == 0 )
-						val = max( val, sc->data[SC_CAMOUFLAGE]->val1 < 3 ? 0 : 25 * (5 - sc->data[SC_CAMOUFLAGE]->val1) );
-					if( sc->data[SC__GROOMY] )
-						val = max( val, sc->data[SC__GROOMY]->val2);
-					if( sc->data[SC_GLOOMYDAY] )
-						val = max( val, sc->data[SC_GLOOMYDAY]->val3 ); // Should be 50 (-50% speed)
-					if( sc->data[SC_STEALTHFIELD_MASTER] )
+					if( SC_ENTRY(sc, SC_CAMOUFLAGE) && (SC_ENTRY(sc, SC_CAMOUFLAGE)->val3&1) == 0 )
+						val = max( val, SC_ENTRY(sc, SC_CAMOUFLAGE)->val1 < 3 ? 0 : 25 * (5 - SC_ENTRY(sc, SC_CAMOUFLAGE)->val1) );
+					if( SC_ENTRY(sc, SC__GROOMY) )
+						val = max( val, SC_ENTRY(sc, SC__GROOMY)->val2);
+					if( SC_ENTRY(sc, SC_GLOOMYDAY) )
+						val = max( val, SC_ENTRY(sc, SC_GLOOMYDAY)->val3 ); // Should be 50 (-50% speed)
+					if( SC_ENTRY(sc, SC_STEALTHFIELD_MASTER) )
 						val = max( val, 30 );
-					if( sc->data[SC_BANDING_DEFENCE] )
-						val = max( val, sc->data[SC_BANDING_DEFENCE]->val1 );//+90% walking speed.
-					if( sc->data[SC_ROCK_CRUSHER_ATK] )
-						val = max( val, sc->data[SC_ROCK_CRUSHER_ATK]->val2 );
-					if( sc->data[SC_POWER_OF_GAIA] )
-						val = max( val, sc->data[SC_POWER_OF_GAIA]->val2 );
-					if( sc->data[SC_MELON_BOMB] )
-						val = max( val, sc->data[SC_MELON_BOMB]->val1 );
-					if (sc->data[SC_STOMACHACHE])
-						val = max(val, sc->data[SC_STOMACHACHE]->val2);
-					if (sc->data[SC_MARSHOFABYSS]) // It stacks to other statuses so always put this at the end.
-						val = max(50, val + 10 * sc->data[SC_MARSHOFABYSS]->val1);
-					if (sc->data[SC_MOVHASTE_POTION]) { // Doesn't affect the movement speed by Quagmire, Decrease Agi, Slow Grace [Frost]
-						if (sc->data[SC_DEC_AGI] || sc->data[SC_QUAGMIRE] || sc->data[SC_DONTFORGETME] || sc->data[SC_CREATINGSTAR] != NULL)
+					if( SC_ENTRY(sc, SC_BANDING_DEFENCE) )
+						val = max( val, SC_ENTRY(sc, SC_BANDING_DEFENCE)->val1 );//+90% walking speed.
+					if( SC_ENTRY(sc, SC_ROCK_CRUSHER_ATK) )
+						val = max( val, SC_ENTRY(sc, SC_ROCK_CRUSHER_ATK)->val2 );
+					if( SC_ENTRY(sc, SC_POWER_OF_GAIA) )
+						val = max( val, SC_ENTRY(sc, SC_POWER_OF_GAIA)->val2 );
+					if( SC_ENTRY(sc, SC_MELON_BOMB) )
+						val = max( val, SC_ENTRY(sc, SC_MELON_BOMB)->val1 );
+					if (SC_ENTRY(sc, SC_STOMACHACHE))
+						val = max(val, SC_ENTRY(sc, SC_STOMACHACHE)->val2);
+					if (SC_ENTRY(sc, SC_MARSHOFABYSS)) // It stacks to other statuses so always put this at the end.
+						val = max(50, val + 10 * SC_ENTRY(sc, SC_MARSHOFABYSS)->val1);
+					if (SC_ENTRY(sc, SC_MOVHASTE_POTION)) { // Doesn't affect the movement speed by Quagmire, Decrease Agi, Slow Grace [Frost]
+						if (SC_ENTRY(sc, SC_DEC_AGI) || SC_ENTRY(sc, SC_QUAGMIRE) || SC_ENTRY(sc, SC_DONTFORGETME) || SC_ENTRY(sc, SC_CREATINGSTAR) != NULL)
 							return 0;
 					}
-					if (sc->data[SC_CATNIPPOWDER])
-						val = max(val, sc->data[SC_CATNIPPOWDER]->val3);
-					if (sc->data[SC_ENSEMBLEFATIGUE] != NULL)
+					if (SC_ENTRY(sc, SC_CATNIPPOWDER))
+						val = max(val, SC_ENTRY(sc, SC_CATNIPPOWDER)->val3);
+					if (SC_ENTRY(sc, SC_ENSEMBLEFATIGUE) != NULL)
 						val = max(val, 30); // 30% MoveSpeed reduction
-					if (sc->data[SC_BIND_TRAP])
-						val = max(val, sc->data[SC_BIND_TRAP]->val3);
-					if (sc->data[SC_CREATINGSTAR] != NULL)
+					if (SC_ENTRY(sc, SC_BIND_TRAP))
+						val = max(val, SC_ENTRY(sc, SC_BIND_TRAP)->val3);
+					if (SC_ENTRY(sc, SC_CREATINGSTAR) != NULL)
 						val = max(val, 90);
-					if (sc->data[SC_SP_SHA] != NULL)
-						val = max(val, sc->data[SC_SP_SHA]->val2);
+					if (SC_ENTRY(sc, SC_SP_SHA) != NULL)
+						val = max(val, SC_ENTRY(sc, SC_SP_SHA)->val2);
 
 					if( sd && sd->bonus.speed_rate + sd->bonus.speed_add_rate > 0 ) // permanent item-based speedup
 						val = max( val, sd->bonus.speed_rate + sd->bonus.speed_add_rate );
@@ -5535,46 +5539,46 @@ static unsigned short status_calc_speed(struct block_list *bl, struct status_cha
 		{
 			int val = 0;
 
-			if (sc->data[SC_MOVHASTE_INFINITY]) // Used by NPC_AGIUP [Frost]
-				val = max(val, sc->data[SC_MOVHASTE_INFINITY]->val1);
-			if (sc->data[SC_MOVHASTE_POTION]) // Used by Speed_Up_Potion and Guyak_Pudding [Frost]
-				val = max(val, sc->data[SC_MOVHASTE_POTION]->val1);
-			if( sc->data[SC_INC_AGI] )
+			if (SC_ENTRY(sc, SC_MOVHASTE_INFINITY)) // Used by NPC_AGIUP [Frost]
+				val = max(val, SC_ENTRY(sc, SC_MOVHASTE_INFINITY)->val1);
+			if (SC_ENTRY(sc, SC_MOVHASTE_POTION)) // Used by Speed_Up_Potion and Guyak_Pudding [Frost]
+				val = max(val, SC_ENTRY(sc, SC_MOVHASTE_POTION)->val1);
+			if( SC_ENTRY(sc, SC_INC_AGI) )
 				val = max( val, 25 );
-			if( sc->data[SC_WINDWALK] )
-				val = max( val, 2 * sc->data[SC_WINDWALK]->val1 );
-			if( sc->data[SC_CARTBOOST] )
+			if( SC_ENTRY(sc, SC_WINDWALK) )
+				val = max( val, 2 * SC_ENTRY(sc, SC_WINDWALK)->val1 );
+			if( SC_ENTRY(sc, SC_CARTBOOST) )
 				val = max( val, 20 );
 			if (sd != NULL && (sd->job & MAPID_UPPERMASK) == MAPID_ASSASSIN && pc->checkskill(sd,TF_MISS) > 0)
 				val = max( val, 1 * pc->checkskill(sd,TF_MISS) );
-			if( sc->data[SC_CLOAKING] && (sc->data[SC_CLOAKING]->val4&1) == 1 )
-				val = max( val, sc->data[SC_CLOAKING]->val1 >= 10 ? 25 : 3 * sc->data[SC_CLOAKING]->val1 - 3 );
-			if (sc->data[SC_BERSERK])
+			if( SC_ENTRY(sc, SC_CLOAKING) && (SC_ENTRY(sc, SC_CLOAKING)->val4&1) == 1 )
+				val = max( val, SC_ENTRY(sc, SC_CLOAKING)->val1 >= 10 ? 25 : 3 * SC_ENTRY(sc, SC_CLOAKING)->val1 - 3 );
+			if (SC_ENTRY(sc, SC_BERSERK))
 				val = max( val, 25 );
-			if( sc->data[SC_RUN] )
+			if( SC_ENTRY(sc, SC_RUN) )
 				val = max( val, 55 );
-			if( sc->data[SC_HLIF_AVOID] )
-				val = max( val, 10 * sc->data[SC_HLIF_AVOID]->val1 );
-			if( sc->data[SC_INVINCIBLE] && !sc->data[SC_INVINCIBLEOFF] )
+			if( SC_ENTRY(sc, SC_HLIF_AVOID) )
+				val = max( val, 10 * SC_ENTRY(sc, SC_HLIF_AVOID)->val1 );
+			if( SC_ENTRY(sc, SC_INVINCIBLE) && !SC_ENTRY(sc, SC_INVINCIBLEOFF) )
 				val = max( val, 75 );
-			if( sc->data[SC_CLOAKINGEXCEED] )
-				val = max( val, sc->data[SC_CLOAKINGEXCEED]->val3);
-			if( sc->data[SC_HOVERING] )
+			if( SC_ENTRY(sc, SC_CLOAKINGEXCEED) )
+				val = max( val, SC_ENTRY(sc, SC_CLOAKINGEXCEED)->val3);
+			if( SC_ENTRY(sc, SC_HOVERING) )
 				val = max( val, 10 );
-			if( sc->data[SC_GN_CARTBOOST] )
-				val = max( val, sc->data[SC_GN_CARTBOOST]->val2 );
-			if( sc->data[SC_SWING] )
-				val = max( val, sc->data[SC_SWING]->val3 );
-			if( sc->data[SC_WIND_STEP_OPTION] )
-				val = max( val, sc->data[SC_WIND_STEP_OPTION]->val2 );
-			if( sc->data[SC_FULL_THROTTLE] )
+			if( SC_ENTRY(sc, SC_GN_CARTBOOST) )
+				val = max( val, SC_ENTRY(sc, SC_GN_CARTBOOST)->val2 );
+			if( SC_ENTRY(sc, SC_SWING) )
+				val = max( val, SC_ENTRY(sc, SC_SWING)->val3 );
+			if( SC_ENTRY(sc, SC_WIND_STEP_OPTION) )
+				val = max( val, SC_ENTRY(sc, SC_WIND_STEP_OPTION)->val2 );
+			if( SC_ENTRY(sc, SC_FULL_THROTTLE) )
 				val = max( val, 25);
-			if (sc->data[SC_MOVHASTE_HORSE])
-				val = max(val, sc->data[SC_MOVHASTE_HORSE]->val1);
+			if (SC_ENTRY(sc, SC_MOVHASTE_HORSE))
+				val = max(val, SC_ENTRY(sc, SC_MOVHASTE_HORSE)->val1);
 			if( sd && sd->bonus.speed_rate + sd->bonus.speed_add_rate < 0 ) // permanent item-based speedup
 				val = max( val, -(sd->bonus.speed_rate + sd->bonus.speed_add_rate) );
-			if (sc->data[SC_ARCLOUSEDASH])
-				val = max(val, sc->data[SC_ARCLOUSEDASH]->val3);
+			if (SC_ENTRY(sc, SC_ARCLOUSEDASH))
+				val = max(val, SC_ENTRY(sc, SC_ARCLOUSEDASH)->val3);
 
 			speed_rate -= val;
 		}
@@ -5587,18 +5591,18 @@ static unsigned short status_calc_speed(struct block_list *bl, struct status_cha
 	{
 		if( sd && pc_iscarton(sd) )
 			speed += speed * (50 - 5 * pc->checkskill(sd,MC_PUSHCART)) / 100;
-		if( sc->data[SC_PARALYSE] )
+		if( SC_ENTRY(sc, SC_PARALYSE) )
 			speed += speed * 50 / 100;
-		if( sc->data[SC_REBOUND] )
+		if( SC_ENTRY(sc, SC_REBOUND) )
 			speed += max(speed, 100);
 		if( speed_rate != 100 )
 			speed = speed * speed_rate / 100;
-		if( sc->data[SC_STEELBODY] )
+		if( SC_ENTRY(sc, SC_STEELBODY) )
 			speed = 200;
-		if( sc->data[SC_DEFENDER] )
+		if( SC_ENTRY(sc, SC_DEFENDER) )
 			speed = max(speed, 200);
-		if( sc->data[SC_WALKSPEED] && sc->data[SC_WALKSPEED]->val1 > 0 ) // ChangeSpeed
-			speed = speed * 100 / sc->data[SC_WALKSPEED]->val1;
+		if( SC_ENTRY(sc, SC_WALKSPEED) && SC_ENTRY(sc, SC_WALKSPEED)->val1 > 0 ) // ChangeSpeed
+			speed = speed * 100 / SC_ENTRY(sc, SC_WALKSPEED)->val1;
 
 	}
 
@@ -5619,33 +5623,33 @@ static short status_calc_aspd(struct block_list *bl, struct status_change *sc, s
 	if (flag&1) {
 		int i;
 		// ASPD fixed values
-		if (sc->data[i=SC_ATTHASTE_INFINITY]
-		  || sc->data[i=SC_ATTHASTE_POTION3]
-		  || sc->data[i=SC_ATTHASTE_POTION2]
-		  || sc->data[i=SC_ATTHASTE_POTION1]
+		if (SC_ENTRY(sc, i=SC_ATTHASTE_INFINITY)
+		  || SC_ENTRY(sc, i=SC_ATTHASTE_POTION3)
+		  || SC_ENTRY(sc, i=SC_ATTHASTE_POTION2)
+		  || SC_ENTRY(sc, i=SC_ATTHASTE_POTION1)
 		)
-			pots += sc->data[i]->val1;
+			pots += SC_ENTRY(sc, i)->val1;
 
-		if (!sc->data[SC_QUAGMIRE]) {
-			if(sc->data[SC_TWOHANDQUICKEN] && bonus < 7)
+		if (!SC_ENTRY(sc, SC_QUAGMIRE)) {
+			if(SC_ENTRY(sc, SC_TWOHANDQUICKEN) && bonus < 7)
 				bonus = 7;
-			if(sc->data[SC_ONEHANDQUICKEN] && bonus < 7)
+			if(SC_ENTRY(sc, SC_ONEHANDQUICKEN) && bonus < 7)
 				bonus = 7;
-			if(sc->data[SC_MER_QUICKEN] && bonus < 7) // needs more info
+			if(SC_ENTRY(sc, SC_MER_QUICKEN) && bonus < 7) // needs more info
 				bonus = 7;
-			if(sc->data[SC_ADRENALINE2] && bonus < 6)
+			if(SC_ENTRY(sc, SC_ADRENALINE2) && bonus < 6)
 				bonus = 6;
-			if(sc->data[SC_ADRENALINE] && bonus < 7)
+			if(SC_ENTRY(sc, SC_ADRENALINE) && bonus < 7)
 				bonus = 7;
-			if(sc->data[SC_SPEARQUICKEN] && bonus < 7)
+			if(SC_ENTRY(sc, SC_SPEARQUICKEN) && bonus < 7)
 				bonus = 7;
-			if(sc->data[SC_HLIF_FLEET] && bonus < 5)
+			if(SC_ENTRY(sc, SC_HLIF_FLEET) && bonus < 5)
 				bonus = 5;
 		}
 
-		if (sc->data[SC_ASSNCROS] && bonus < sc->data[SC_ASSNCROS]->val2) {
+		if (SC_ENTRY(sc, SC_ASSNCROS) && bonus < SC_ENTRY(sc, SC_ASSNCROS)->val2) {
 			if (bl->type != BL_PC) {
-				bonus = sc->data[SC_ASSNCROS]->val2;
+				bonus = SC_ENTRY(sc, SC_ASSNCROS)->val2;
 			} else {
 				switch (BL_UCCAST(BL_PC, bl)->weapontype) {
 					case W_BOW:
@@ -5656,95 +5660,95 @@ static short status_calc_aspd(struct block_list *bl, struct status_change *sc, s
 					case W_GRENADE:
 						break;
 					default:
-						bonus = sc->data[SC_ASSNCROS]->val2;
+						bonus = SC_ENTRY(sc, SC_ASSNCROS)->val2;
 				}
 			}
 		}
 
-		if ((sc->data[SC_BERSERK]) && bonus < 15)
+		if ((SC_ENTRY(sc, SC_BERSERK)) && bonus < 15)
 			bonus = 15;
-		else if (sc->data[SC_GS_MADNESSCANCEL] && bonus < 20)
+		else if (SC_ENTRY(sc, SC_GS_MADNESSCANCEL) && bonus < 20)
 			bonus = 20;
 
 	} else {
 		// ASPD percentage values
-		if (sc->data[SC_DONTFORGETME])
-			bonus -= sc->data[SC_DONTFORGETME]->val2;
-		if (sc->data[SC_ENSEMBLEFATIGUE] != NULL)
+		if (SC_ENTRY(sc, SC_DONTFORGETME))
+			bonus -= SC_ENTRY(sc, SC_DONTFORGETME)->val2;
+		if (SC_ENTRY(sc, SC_ENSEMBLEFATIGUE) != NULL)
 			bonus -= 30; // 30% Attack Speed reduction
-		if (sc->data[SC_LONGING])
-			bonus -= sc->data[SC_LONGING]->val2;
-		if (sc->data[SC_STEELBODY])
+		if (SC_ENTRY(sc, SC_LONGING))
+			bonus -= SC_ENTRY(sc, SC_LONGING)->val2;
+		if (SC_ENTRY(sc, SC_STEELBODY))
 			bonus -= 25;
-		if (sc->data[SC_SKA])
+		if (SC_ENTRY(sc, SC_SKA))
 			bonus -= 25;
-		if (sc->data[SC_DEFENDER])
-			bonus -= sc->data[SC_DEFENDER]->val4 / 10;
-		if (sc->data[SC_GOSPEL] && sc->data[SC_GOSPEL]->val4 == BCT_ENEMY) // needs more info
+		if (SC_ENTRY(sc, SC_DEFENDER))
+			bonus -= SC_ENTRY(sc, SC_DEFENDER)->val4 / 10;
+		if (SC_ENTRY(sc, SC_GOSPEL) && SC_ENTRY(sc, SC_GOSPEL)->val4 == BCT_ENEMY) // needs more info
 			bonus -= 25;
-		if (sc->data[SC_GRAVITATION] && sc->data[SC_GRAVITATION]->val3 != BCT_SELF)
-			bonus -= sc->data[SC_GRAVITATION]->val2 / 10;
-		if (sc->data[SC_JOINTBEAT]) { // needs more info
-			if (sc->data[SC_JOINTBEAT]->val2&BREAK_WRIST)
+		if (SC_ENTRY(sc, SC_GRAVITATION) && SC_ENTRY(sc, SC_GRAVITATION)->val3 != BCT_SELF)
+			bonus -= SC_ENTRY(sc, SC_GRAVITATION)->val2 / 10;
+		if (SC_ENTRY(sc, SC_JOINTBEAT)) { // needs more info
+			if (SC_ENTRY(sc, SC_JOINTBEAT)->val2&BREAK_WRIST)
 				bonus -= 25;
-			if (sc->data[SC_JOINTBEAT]->val2&BREAK_KNEE)
+			if (SC_ENTRY(sc, SC_JOINTBEAT)->val2&BREAK_KNEE)
 				bonus -= 10;
 		}
-		if (sc->data[SC_FROSTMISTY])
+		if (SC_ENTRY(sc, SC_FROSTMISTY))
 			bonus -= 15;
-		if (sc->data[SC_HALLUCINATIONWALK_POSTDELAY])
+		if (SC_ENTRY(sc, SC_HALLUCINATIONWALK_POSTDELAY))
 			bonus -= 50;
-		if (sc->data[SC_PARALYSE])
+		if (SC_ENTRY(sc, SC_PARALYSE))
 			bonus -= 10;
-		if (sc->data[SC__BODYPAINT])
-			bonus -= sc->data[SC__BODYPAINT]->val1;
-		if (sc->data[SC__INVISIBILITY])
-			bonus -= sc->data[SC__INVISIBILITY]->val2 ;
-		if (sc->data[SC__GROOMY])
-			bonus -= sc->data[SC__GROOMY]->val2;
-		if (sc->data[SC_GLOOMYDAY])
-			bonus -= (15 + 5 * sc->data[SC_GLOOMYDAY]->val1);
-		if (sc->data[SC_EARTHDRIVE])
+		if (SC_ENTRY(sc, SC__BODYPAINT))
+			bonus -= SC_ENTRY(sc, SC__BODYPAINT)->val1;
+		if (SC_ENTRY(sc, SC__INVISIBILITY))
+			bonus -= SC_ENTRY(sc, SC__INVISIBILITY)->val2 ;
+		if (SC_ENTRY(sc, SC__GROOMY))
+			bonus -= SC_ENTRY(sc, SC__GROOMY)->val2;
+		if (SC_ENTRY(sc, SC_GLOOMYDAY))
+			bonus -= (15 + 5 * SC_ENTRY(sc, SC_GLOOMYDAY)->val1);
+		if (SC_ENTRY(sc, SC_EARTHDRIVE))
 			bonus -= 25;
-		if (sc->data[SC_MELON_BOMB])
-			bonus -= sc->data[SC_MELON_BOMB]->val1;
-		if (sc->data[SC_PAIN_KILLER])
-			bonus -= sc->data[SC_PAIN_KILLER]->val2;
-
-		if (sc->data[SC_SWING]) // TODO: SC_SWING shouldn't stack with skill1 modifiers
-			bonus += sc->data[SC_SWING]->val3;
-		if (sc->data[SC_DANCE_WITH_WUG])
-			bonus += sc->data[SC_DANCE_WITH_WUG]->val3;
-		if (sc->data[SC_GENTLETOUCH_CHANGE])
-			bonus += sc->data[SC_GENTLETOUCH_CHANGE]->val3;
-		if (sc->data[SC_BOOST500])
-			bonus += sc->data[SC_BOOST500]->val1;
-		if (sc->data[SC_EXTRACT_SALAMINE_JUICE])
-			bonus += sc->data[SC_EXTRACT_SALAMINE_JUICE]->val1;
-		if (sc->data[SC_INCASPDRATE])
-			bonus += sc->data[SC_INCASPDRATE]->val1;
-		if (sc->data[SC_GS_GATLINGFEVER])
-			bonus += sc->data[SC_GS_GATLINGFEVER]->val1;
-		if (sc->data[SC_STAR_COMFORT])
-			bonus += 3 * sc->data[SC_STAR_COMFORT]->val1;
-		if (sc->data[SC_ACARAJE])
-			bonus += sc->data[SC_ACARAJE]->val2;
-		if (sc->data[SC_BATTLESCROLL])
-			bonus += sc->data[SC_BATTLESCROLL]->val1;
-		if (sc->data[SC_STEAMPACK])
-			bonus += sc->data[SC_STEAMPACK]->val2;
-		if (sc->data[SC_SKF_ASPD] != NULL)
-			bonus += sc->data[SC_SKF_ASPD]->val1;
+		if (SC_ENTRY(sc, SC_MELON_BOMB))
+			bonus -= SC_ENTRY(sc, SC_MELON_BOMB)->val1;
+		if (SC_ENTRY(sc, SC_PAIN_KILLER))
+			bonus -= SC_ENTRY(sc, SC_PAIN_KILLER)->val2;
+
+		if (SC_ENTRY(sc, SC_SWING)) // TODO: SC_SWING shouldn't stack with skill1 modifiers
+			bonus += SC_ENTRY(sc, SC_SWING)->val3;
+		if (SC_ENTRY(sc, SC_DANCE_WITH_WUG))
+			bonus += SC_ENTRY(sc, SC_DANCE_WITH_WUG)->val3;
+		if (SC_ENTRY(sc, SC_GENTLETOUCH_CHANGE))
+			bonus += SC_ENTRY(sc, SC_GENTLETOUCH_CHANGE)->val3;
+		if (SC_ENTRY(sc, SC_BOOST500))
+			bonus += SC_ENTRY(sc, SC_BOOST500)->val1;
+		if (SC_ENTRY(sc, SC_EXTRACT_SALAMINE_JUICE))
+			bonus += SC_ENTRY(sc, SC_EXTRACT_SALAMINE_JUICE)->val1;
+		if (SC_ENTRY(sc, SC_INCASPDRATE))
+			bonus += SC_ENTRY(sc, SC_INCASPDRATE)->val1;
+		if (SC_ENTRY(sc, SC_GS_GATLINGFEVER))
+			bonus += SC_ENTRY(sc, SC_GS_GATLINGFEVER)->val1;
+		if (SC_ENTRY(sc, SC_STAR_COMFORT))
+			bonus += 3 * SC_ENTRY(sc, SC_STAR_COMFORT)->val1;
+		if (SC_ENTRY(sc, SC_ACARAJE))
+			bonus += SC_ENTRY(sc, SC_ACARAJE)->val2;
+		if (SC_ENTRY(sc, SC_BATTLESCROLL))
+			bonus += SC_ENTRY(sc, SC_BATTLESCROLL)->val1;
+		if (SC_ENTRY(sc, SC_STEAMPACK))
+			bonus += SC_ENTRY(sc, SC_STEAMPACK)->val2;
+		if (SC_ENTRY(sc, SC_SKF_ASPD) != NULL)
+			bonus += SC_ENTRY(sc, SC_SKF_ASPD)->val1;
 #ifdef RENEWAL
-		if (sc->data[SC_INC_AGI] != NULL)
-			bonus += sc->data[SC_INC_AGI]->val1; // + SkillLevel%
-		if (sc->data[SC_TWOHANDQUICKEN] != NULL)
+		if (SC_ENTRY(sc, SC_INC_AGI) != NULL)
+			bonus += SC_ENTRY(sc, SC_INC_AGI)->val1; // + SkillLevel%
+		if (SC_ENTRY(sc, SC_TWOHANDQUICKEN) != NULL)
 			bonus += 10;
-		if (sc->data[SC_ADRENALINE] != NULL)
+		if (SC_ENTRY(sc, SC_ADRENALINE) != NULL)
 			bonus += 10;
-		if (sc->data[SC_SPEARQUICKEN] != NULL)
+		if (SC_ENTRY(sc, SC_SPEARQUICKEN) != NULL)
 			bonus += 10;
-		if (sc->data[SC_NIBELUNGEN] != NULL && sc->data[SC_NIBELUNGEN]->val2 == RINGNBL_EFF_ASPD)
+		if (SC_ENTRY(sc, SC_NIBELUNGEN) != NULL && SC_ENTRY(sc, SC_NIBELUNGEN)->val2 == RINGNBL_EFF_ASPD)
 			bonus += 20;
 #endif
 	}
@@ -5761,19 +5765,19 @@ static short status_calc_fix_aspd(struct block_list *bl, struct status_change *s
 	if (!sc || !sc->count)
 		return cap_value(aspd, 0, 2000);
 
-	if (sc->data[SC_GUST_OPTION] != NULL || sc->data[SC_BLAST_OPTION] != NULL || sc->data[SC_WILD_STORM_OPTION] != NULL)
+	if (SC_ENTRY(sc, SC_GUST_OPTION) != NULL || SC_ENTRY(sc, SC_BLAST_OPTION) != NULL || SC_ENTRY(sc, SC_WILD_STORM_OPTION) != NULL)
 		aspd -= 50; // +5 ASPD
-	if (sc->data[SC_FIGHTINGSPIRIT] != NULL && sc->data[SC_FIGHTINGSPIRIT]->val2 != 0)
+	if (SC_ENTRY(sc, SC_FIGHTINGSPIRIT) != NULL && SC_ENTRY(sc, SC_FIGHTINGSPIRIT)->val2 != 0)
 		aspd -= (bl->type == BL_PC ? pc->checkskill(BL_UCAST(BL_PC, bl), RK_RUNEMASTERY) : 10) / 10 * 40;
-	if (sc->data[SC_MTF_ASPD])
-		aspd -= sc->data[SC_MTF_ASPD]->val1;
-	if (sc->data[SC_HEAT_BARREL])
-		aspd -= sc->data[SC_HEAT_BARREL]->val1 * 10;
-	if (sc->data[SC_SOULSHADOW] != NULL)
-		aspd -= 10 * sc->data[SC_SOULSHADOW]->val2;
-
-	if (sc->data[SC_OVERED_BOOST]) // should be final and unmodifiable by any means
-		aspd = (200 - sc->data[SC_OVERED_BOOST]->val3) * 10;
+	if (SC_ENTRY(sc, SC_MTF_ASPD))
+		aspd -= SC_ENTRY(sc, SC_MTF_ASPD)->val1;
+	if (SC_ENTRY(sc, SC_HEAT_BARREL))
+		aspd -= SC_ENTRY(sc, SC_HEAT_BARREL)->val1 * 10;
+	if (SC_ENTRY(sc, SC_SOULSHADOW) != NULL)
+		aspd -= 10 * SC_ENTRY(sc, SC_SOULSHADOW)->val2;
+
+	if (SC_ENTRY(sc, SC_OVERED_BOOST)) // should be final and unmodifiable by any means
+		aspd = (200 - SC_ENTRY(sc, SC_OVERED_BOOST)->val3) * 10;
 	return cap_value(aspd, 0, 2000); // will be recap for proper bl anyway
 }
 
@@ -5787,46 +5791,46 @@ static short status_calc_aspd_rate(struct block_list *bl, struct status_change *
 	if(!sc || !sc->count)
 		return cap_value(aspd_rate,0,SHRT_MAX);
 
-	if( !sc->data[SC_QUAGMIRE] ){
+	if( !SC_ENTRY(sc, SC_QUAGMIRE) ){
 		int max = 0;
-		if(sc->data[SC_STAR_COMFORT])
-			max = sc->data[SC_STAR_COMFORT]->val2;
+		if(SC_ENTRY(sc, SC_STAR_COMFORT))
+			max = SC_ENTRY(sc, SC_STAR_COMFORT)->val2;
 
-		if(sc->data[SC_TWOHANDQUICKEN] &&
-			max < sc->data[SC_TWOHANDQUICKEN]->val2)
-			max = sc->data[SC_TWOHANDQUICKEN]->val2;
+		if(SC_ENTRY(sc, SC_TWOHANDQUICKEN) &&
+			max < SC_ENTRY(sc, SC_TWOHANDQUICKEN)->val2)
+			max = SC_ENTRY(sc, SC_TWOHANDQUICKEN)->val2;
 
-		if(sc->data[SC_ONEHANDQUICKEN] &&
-			max < sc->data[SC_ONEHANDQUICKEN]->val2)
-			max = sc->data[SC_ONEHANDQUICKEN]->val2;
+		if(SC_ENTRY(sc, SC_ONEHANDQUICKEN) &&
+			max < SC_ENTRY(sc, SC_ONEHANDQUICKEN)->val2)
+			max = SC_ENTRY(sc, SC_ONEHANDQUICKEN)->val2;
 
-		if(sc->data[SC_MER_QUICKEN] &&
-			max < sc->data[SC_MER_QUICKEN]->val2)
-			max = sc->data[SC_MER_QUICKEN]->val2;
+		if(SC_ENTRY(sc, SC_MER_QUICKEN) &&
+			max < SC_ENTRY(sc, SC_MER_QUICKEN)->val2)
+			max = SC_ENTRY(sc, SC_MER_QUICKEN)->val2;
 
-		if(sc->data[SC_ADRENALINE2] &&
-			max < sc->data[SC_ADRENALINE2]->val3)
-			max = sc->data[SC_ADRENALINE2]->val3;
+		if(SC_ENTRY(sc, SC_ADRENALINE2) &&
+			max < SC_ENTRY(sc, SC_ADRENALINE2)->val3)
+			max = SC_ENTRY(sc, SC_ADRENALINE2)->val3;
 
-		if(sc->data[SC_ADRENALINE] &&
-			max < sc->data[SC_ADRENALINE]->val3)
-			max = sc->data[SC_ADRENALINE]->val3;
+		if(SC_ENTRY(sc, SC_ADRENALINE) &&
+			max < SC_ENTRY(sc, SC_ADRENALINE)->val3)
+			max = SC_ENTRY(sc, SC_ADRENALINE)->val3;
 
-		if(sc->data[SC_SPEARQUICKEN] &&
-			max < sc->data[SC_SPEARQUICKEN]->val2)
-			max = sc->data[SC_SPEARQUICKEN]->val2;
+		if(SC_ENTRY(sc, SC_SPEARQUICKEN) &&
+			max < SC_ENTRY(sc, SC_SPEARQUICKEN)->val2)
+			max = SC_ENTRY(sc, SC_SPEARQUICKEN)->val2;
 
-		if(sc->data[SC_GS_GATLINGFEVER] &&
-			max < sc->data[SC_GS_GATLINGFEVER]->val2)
-			max = sc->data[SC_GS_GATLINGFEVER]->val2;
+		if(SC_ENTRY(sc, SC_GS_GATLINGFEVER) &&
+			max < SC_ENTRY(sc, SC_GS_GATLINGFEVER)->val2)
+			max = SC_ENTRY(sc, SC_GS_GATLINGFEVER)->val2;
 
-		if(sc->data[SC_HLIF_FLEET] &&
-			max < sc->data[SC_HLIF_FLEET]->val2)
-			max = sc->data[SC_HLIF_FLEET]->val2;
+		if(SC_ENTRY(sc, SC_HLIF_FLEET) &&
+			max < SC_ENTRY(sc, SC_HLIF_FLEET)->val2)
+			max = SC_ENTRY(sc, SC_HLIF_FLEET)->val2;
 
-		if (sc->data[SC_ASSNCROS] && max < sc->data[SC_ASSNCROS]->val2) {
+		if (SC_ENTRY(sc, SC_ASSNCROS) && max < SC_ENTRY(sc, SC_ASSNCROS)->val2) {
 			if (bl->type != BL_PC) {
-				max = sc->data[SC_ASSNCROS]->val2;
+				max = SC_ENTRY(sc, SC_ASSNCROS)->val2;
 			} else {
 				switch (BL_UCCAST(BL_PC, bl)->weapontype) {
 				case W_BOW:
@@ -5837,91 +5841,91 @@ static short status_calc_aspd_rate(struct block_list *bl, struct status_change *
 				case W_GRENADE:
 					break;
 				default:
-					max = sc->data[SC_ASSNCROS]->val2;
+					max = SC_ENTRY(sc, SC_ASSNCROS)->val2;
 				}
 			}
 		}
 
 		aspd_rate -= max;
 
-		if(sc->data[SC_BERSERK])
+		if(SC_ENTRY(sc, SC_BERSERK))
 			aspd_rate -= 300;
-		else if(sc->data[SC_GS_MADNESSCANCEL])
+		else if(SC_ENTRY(sc, SC_GS_MADNESSCANCEL))
 			aspd_rate -= 200;
 	}
 
-	if( sc->data[i=SC_ATTHASTE_INFINITY] ||
-		sc->data[i=SC_ATTHASTE_POTION3] ||
-		sc->data[i=SC_ATTHASTE_POTION2] ||
-		sc->data[i=SC_ATTHASTE_POTION1] )
-		aspd_rate -= sc->data[i]->val2;
+	if( SC_ENTRY(sc, i=SC_ATTHASTE_INFINITY) ||
+		SC_ENTRY(sc, i=SC_ATTHASTE_POTION3) ||
+		SC_ENTRY(sc, i=SC_ATTHASTE_POTION2) ||
+		SC_ENTRY(sc, i=SC_ATTHASTE_POTION1) )
+		aspd_rate -= SC_ENTRY(sc, i)->val2;
 
-	if(sc->data[SC_DONTFORGETME])
-		aspd_rate += 10 * sc->data[SC_DONTFORGETME]->val2;
-	if(sc->data[SC_LONGING])
-		aspd_rate += sc->data[SC_LONGING]->val2;
-	if(sc->data[SC_STEELBODY])
+	if(SC_ENTRY(sc, SC_DONTFORGETME))
+		aspd_rate += 10 * SC_ENTRY(sc, SC_DONTFORGETME)->val2;
+	if(SC_ENTRY(sc, SC_LONGING))
+		aspd_rate += SC_ENTRY(sc, SC_LONGING)->val2;
+	if(SC_ENTRY(sc, SC_STEELBODY))
 		aspd_rate += 250;
-	if(sc->data[SC_SKA])
+	if(SC_ENTRY(sc, SC_SKA))
 		aspd_rate += 250;
-	if(sc->data[SC_DEFENDER])
-		aspd_rate += sc->data[SC_DEFENDER]->val4;
-	if(sc->data[SC_GOSPEL] && sc->data[SC_GOSPEL]->val4 == BCT_ENEMY)
+	if(SC_ENTRY(sc, SC_DEFENDER))
+		aspd_rate += SC_ENTRY(sc, SC_DEFENDER)->val4;
+	if(SC_ENTRY(sc, SC_GOSPEL) && SC_ENTRY(sc, SC_GOSPEL)->val4 == BCT_ENEMY)
 		aspd_rate += 250;
-	if(sc->data[SC_GRAVITATION] && sc->data[SC_GRAVITATION]->val3 != BCT_SELF)
-		aspd_rate += sc->data[SC_GRAVITATION]->val2;
-	if(sc->data[SC_JOINTBEAT]) {
-		if( sc->data[SC_JOINTBEAT]->val2&BREAK_WRIST )
+	if(SC_ENTRY(sc, SC_GRAVITATION) && SC_ENTRY(sc, SC_GRAVITATION)->val3 != BCT_SELF)
+		aspd_rate += SC_ENTRY(sc, SC_GRAVITATION)->val2;
+	if(SC_ENTRY(sc, SC_JOINTBEAT)) {
+		if( SC_ENTRY(sc, SC_JOINTBEAT)->val2&BREAK_WRIST )
 			aspd_rate += 250;
-		if( sc->data[SC_JOINTBEAT]->val2&BREAK_KNEE )
+		if( SC_ENTRY(sc, SC_JOINTBEAT)->val2&BREAK_KNEE )
 			aspd_rate += 100;
 	}
-	if( sc->data[SC_FROSTMISTY] )
+	if( SC_ENTRY(sc, SC_FROSTMISTY) )
 		aspd_rate += 150;
-	if( sc->data[SC_HALLUCINATIONWALK_POSTDELAY] )
+	if( SC_ENTRY(sc, SC_HALLUCINATIONWALK_POSTDELAY) )
 		aspd_rate += 500;
-	if( sc->data[SC_FIGHTINGSPIRIT] && sc->data[SC_FIGHTINGSPIRIT]->val2 )
-		aspd_rate -= sc->data[SC_FIGHTINGSPIRIT]->val2;
-	if( sc->data[SC_PARALYSE] )
+	if( SC_ENTRY(sc, SC_FIGHTINGSPIRIT) && SC_ENTRY(sc, SC_FIGHTINGSPIRIT)->val2 )
+		aspd_rate -= SC_ENTRY(sc, SC_FIGHTINGSPIRIT)->val2;
+	if( SC_ENTRY(sc, SC_PARALYSE) )
 		aspd_rate += 100;
-	if( sc->data[SC__BODYPAINT] )
-		aspd_rate += 10 * 5 * sc->data[SC__BODYPAINT]->val1;
-	if( sc->data[SC__INVISIBILITY] )
-		aspd_rate += sc->data[SC__INVISIBILITY]->val2 * 10 ;
-	if( sc->data[SC__GROOMY] )
-		aspd_rate += sc->data[SC__GROOMY]->val2 * 10;
-	if( sc->data[SC_SWING] )
-		aspd_rate -= sc->data[SC_SWING]->val3 * 10;
-	if( sc->data[SC_DANCE_WITH_WUG] )
-		aspd_rate -= sc->data[SC_DANCE_WITH_WUG]->val3 * 10;
-	if( sc->data[SC_GLOOMYDAY] )
-		aspd_rate += ( 15 + 5 * sc->data[SC_GLOOMYDAY]->val1 );
-	if( sc->data[SC_EARTHDRIVE] )
+	if( SC_ENTRY(sc, SC__BODYPAINT) )
+		aspd_rate += 10 * 5 * SC_ENTRY(sc, SC__BODYPAINT)->val1;
+	if( SC_ENTRY(sc, SC__INVISIBILITY) )
+		aspd_rate += SC_ENTRY(sc, SC__INVISIBILITY)->val2 * 10 ;
+	if( SC_ENTRY(sc, SC__GROOMY) )
+		aspd_rate += SC_ENTRY(sc, SC__GROOMY)->val2 * 10;
+	if( SC_ENTRY(sc, SC_SWING) )
+		aspd_rate -= SC_ENTRY(sc, SC_SWING)->val3 * 10;
+	if( SC_ENTRY(sc, SC_DANCE_WITH_WUG) )
+		aspd_rate -= SC_ENTRY(sc, SC_DANCE_WITH_WUG)->val3 * 10;
+	if( SC_ENTRY(sc, SC_GLOOMYDAY) )
+		aspd_rate += ( 15 + 5 * SC_ENTRY(sc, SC_GLOOMYDAY)->val1 );
+	if( SC_ENTRY(sc, SC_EARTHDRIVE) )
 		aspd_rate += 250;
-	if( sc->data[SC_GENTLETOUCH_CHANGE] )
-		aspd_rate -= sc->data[SC_GENTLETOUCH_CHANGE]->val3 * 10;
-	if( sc->data[SC_MELON_BOMB] )
-		aspd_rate += sc->data[SC_MELON_BOMB]->val1 * 10;
-	if( sc->data[SC_BOOST500] )
-		aspd_rate -= sc->data[SC_BOOST500]->val1 *10;
-	if( sc->data[SC_EXTRACT_SALAMINE_JUICE] )
-		aspd_rate -= sc->data[SC_EXTRACT_SALAMINE_JUICE]->val1 * 10;
-	if( sc->data[SC_INCASPDRATE] )
-		aspd_rate -= sc->data[SC_INCASPDRATE]->val1 * 10;
-	if( sc->data[SC_PAIN_KILLER])
-		aspd_rate += sc->data[SC_PAIN_KILLER]->val2 * 10;
-	if( sc->data[SC_GOLDENE_FERSE])
-		aspd_rate -= sc->data[SC_GOLDENE_FERSE]->val3 * 10;
-	if (sc->data[SC_ACARAJE])
-		aspd_rate += sc->data[SC_ACARAJE]->val2 * 10;
-	if (sc->data[SC_BATTLESCROLL])
-		aspd_rate += sc->data[SC_BATTLESCROLL]->val1 * 10;
-	if (sc->data[SC_STEAMPACK])
-		aspd_rate += sc->data[SC_STEAMPACK]->val2 * 10;
-	if (sc->data[SC_SKF_ASPD] != NULL)
-		aspd_rate -= sc->data[SC_SKF_ASPD]->val1 * 10;
-	if (sc->data[SC_STARSTANCE] != NULL)
-		aspd_rate -= 10 * sc->data[SC_STARSTANCE]->val2;
+	if( SC_ENTRY(sc, SC_GENTLETOUCH_CHANGE) )
+		aspd_rate -= SC_ENTRY(sc, SC_GENTLETOUCH_CHANGE)->val3 * 10;
+	if( SC_ENTRY(sc, SC_MELON_BOMB) )
+		aspd_rate += SC_ENTRY(sc, SC_MELON_BOMB)->val1 * 10;
+	if( SC_ENTRY(sc, SC_BOOST500) )
+		aspd_rate -= SC_ENTRY(sc, SC_BOOST500)->val1 *10;
+	if( SC_ENTRY(sc, SC_EXTRACT_SALAMINE_JUICE) )
+		aspd_rate -= SC_ENTRY(sc, SC_EXTRACT_SALAMINE_JUICE)->val1 * 10;
+	if( SC_ENTRY(sc, SC_INCASPDRATE) )
+		aspd_rate -= SC_ENTRY(sc, SC_INCASPDRATE)->val1 * 10;
+	if( SC_ENTRY(sc, SC_PAIN_KILLER))
+		aspd_rate += SC_ENTRY(sc, SC_PAIN_KILLER)->val2 * 10;
+	if( SC_ENTRY(sc, SC_GOLDENE_FERSE))
+		aspd_rate -= SC_ENTRY(sc, SC_GOLDENE_FERSE)->val3 * 10;
+	if (SC_ENTRY(sc, SC_ACARAJE))
+		aspd_rate += SC_ENTRY(sc, SC_ACARAJE)->val2 * 10;
+	if (SC_ENTRY(sc, SC_BATTLESCROLL))
+		aspd_rate += SC_ENTRY(sc, SC_BATTLESCROLL)->val1 * 10;
+	if (SC_ENTRY(sc, SC_STEAMPACK))
+		aspd_rate += SC_ENTRY(sc, SC_STEAMPACK)->val2 * 10;
+	if (SC_ENTRY(sc, SC_SKF_ASPD) != NULL)
+		aspd_rate -= SC_ENTRY(sc, SC_SKF_ASPD)->val1 * 10;
+	if (SC_ENTRY(sc, SC_STARSTANCE) != NULL)
+		aspd_rate -= 10 * SC_ENTRY(sc, SC_STARSTANCE)->val2;
 
 	return (short)cap_value(aspd_rate,0,SHRT_MAX);
 }
@@ -5936,9 +5940,9 @@ static unsigned short status_calc_dmotion(struct block_list *bl, struct status_c
 	if( !sc || !sc->count || map_flag_gvg2(bl->m) || map->list[bl->m].flag.battleground )
 		return cap_value(dmotion,0,USHRT_MAX);
 
-	if( sc->data[SC_ENDURE] )
+	if( SC_ENTRY(sc, SC_ENDURE) )
 		return 0;
-	if( sc->data[SC_RUN] || sc->data[SC_WUGDASH] )
+	if( SC_ENTRY(sc, SC_RUN) || SC_ENTRY(sc, SC_WUGDASH) )
 		return 0;
 
 	return (unsigned short)cap_value(dmotion,0,USHRT_MAX);
@@ -5950,82 +5954,82 @@ static unsigned int status_calc_maxhp(struct block_list *bl, struct status_chang
 	if (!sc || !sc->count)
 		return (unsigned int)cap_value(maxhp, 1, UINT_MAX);
 
-	if (sc->data[SC_INCMHPRATE])
-		maxhp += maxhp * sc->data[SC_INCMHPRATE]->val1 / 100;
-	if (sc->data[SC_INCMHP])
-		maxhp += (sc->data[SC_INCMHP]->val1);
-	if (sc->data[SC_MTF_MHP])
-		maxhp += (sc->data[SC_MTF_MHP]->val1);
-	if (sc->data[SC_APPLEIDUN])
-		maxhp += maxhp * sc->data[SC_APPLEIDUN]->val2 / 100;
-	if (sc->data[SC_DELUGE])
-		maxhp += maxhp * sc->data[SC_DELUGE]->val2 / 100;
-	if (sc->data[SC_BERSERK])
+	if (SC_ENTRY(sc, SC_INCMHPRATE))
+		maxhp += maxhp * SC_ENTRY(sc, SC_INCMHPRATE)->val1 / 100;
+	if (SC_ENTRY(sc, SC_INCMHP))
+		maxhp += (SC_ENTRY(sc, SC_INCMHP)->val1);
+	if (SC_ENTRY(sc, SC_MTF_MHP))
+		maxhp += (SC_ENTRY(sc, SC_MTF_MHP)->val1);
+	if (SC_ENTRY(sc, SC_APPLEIDUN))
+		maxhp += maxhp * SC_ENTRY(sc, SC_APPLEIDUN)->val2 / 100;
+	if (SC_ENTRY(sc, SC_DELUGE))
+		maxhp += maxhp * SC_ENTRY(sc, SC_DELUGE)->val2 / 100;
+	if (SC_ENTRY(sc, SC_BERSERK))
 		maxhp += maxhp * 2;
-	if (sc->data[SC_MARIONETTE_MASTER])
+	if (SC_ENTRY(sc, SC_MARIONETTE_MASTER))
 		maxhp -= 1000;
-	if (sc->data[SC_SOLID_SKIN_OPTION])
+	if (SC_ENTRY(sc, SC_SOLID_SKIN_OPTION))
 		maxhp += 2000; // Fix amount.
-	if (sc->data[SC_POWER_OF_GAIA])
-		maxhp += maxhp * sc->data[SC_POWER_OF_GAIA]->val3 / 100;
-	if (sc->data[SC_EARTH_INSIGNIA] && sc->data[SC_EARTH_INSIGNIA]->val1 == 2)
+	if (SC_ENTRY(sc, SC_POWER_OF_GAIA))
+		maxhp += maxhp * SC_ENTRY(sc, SC_POWER_OF_GAIA)->val3 / 100;
+	if (SC_ENTRY(sc, SC_EARTH_INSIGNIA) && SC_ENTRY(sc, SC_EARTH_INSIGNIA)->val1 == 2)
 		maxhp += 500;
-	if (sc->data[SC_MER_HP])
-		maxhp += maxhp * sc->data[SC_MER_HP]->val2 / 100;
-	if (sc->data[SC_EPICLESIS])
-		maxhp += maxhp * 5 * sc->data[SC_EPICLESIS]->val1 / 100;
-	if (sc->data[SC_VENOMBLEED])
+	if (SC_ENTRY(sc, SC_MER_HP))
+		maxhp += maxhp * SC_ENTRY(sc, SC_MER_HP)->val2 / 100;
+	if (SC_ENTRY(sc, SC_EPICLESIS))
+		maxhp += maxhp * 5 * SC_ENTRY(sc, SC_EPICLESIS)->val1 / 100;
+	if (SC_ENTRY(sc, SC_VENOMBLEED))
 		maxhp -= maxhp * 15 / 100;
-	if (sc->data[SC__WEAKNESS])
-		maxhp -= maxhp * sc->data[SC__WEAKNESS]->val2 / 100;
-	if (sc->data[SC_LERADS_DEW])
-		maxhp += sc->data[SC_LERADS_DEW]->val3;
-	if (sc->data[SC_BEYOND_OF_WARCRY])
-		maxhp -= maxhp * sc->data[SC_BEYOND_OF_WARCRY]->val4 / 100;
-	if (sc->data[SC_FORCEOFVANGUARD])
-		maxhp += maxhp * 3 * sc->data[SC_FORCEOFVANGUARD]->val1 / 100;
-	if (sc->data[SC_INSPIRATION])
-		maxhp += maxhp * 5 * sc->data[SC_INSPIRATION]->val1 / 100 + 600 * sc->data[SC_INSPIRATION]->val1;
-	if (sc->data[SC_RAISINGDRAGON])
-		maxhp += maxhp * (2 + sc->data[SC_RAISINGDRAGON]->val1) / 100;
-	if (sc->data[SC_GENTLETOUCH_CHANGE]) // Max HP decrease: [Skill Level x 1] %
-		maxhp -= maxhp * (1 * sc->data[SC_GENTLETOUCH_CHANGE]->val1) / 100;
-	if (sc->data[SC_GENTLETOUCH_REVITALIZE])// Max HP increase: [Skill Level x 2] %
-		maxhp += maxhp * (2 * sc->data[SC_GENTLETOUCH_REVITALIZE]->val1) / 100;
-	if (sc->data[SC_MUSTLE_M])
-		maxhp += maxhp * sc->data[SC_MUSTLE_M]->val1 / 100;
-	if (sc->data[SC_PROMOTE_HEALTH_RESERCH])
-		maxhp += sc->data[SC_PROMOTE_HEALTH_RESERCH]->val3;
-	if (sc->data[SC_MYSTERIOUS_POWDER])
-		maxhp -= maxhp * sc->data[SC_MYSTERIOUS_POWDER]->val1 / 100;
-	if (sc->data[SC_PETROLOGY_OPTION])
-		maxhp += maxhp * sc->data[SC_PETROLOGY_OPTION]->val2 / 100;
-	if (sc->data[SC_CURSED_SOIL_OPTION])
-		maxhp += maxhp * sc->data[SC_CURSED_SOIL_OPTION]->val2 / 100;
-	if (sc->data[SC_UPHEAVAL_OPTION])
-		maxhp += maxhp * sc->data[SC_UPHEAVAL_OPTION]->val3 / 100;
-	if (sc->data[SC_ANGRIFFS_MODUS])
-		maxhp += maxhp * 5 * sc->data[SC_ANGRIFFS_MODUS]->val1 /100;
-	if (sc->data[SC_GOLDENE_FERSE])
-		maxhp += maxhp * sc->data[SC_GOLDENE_FERSE]->val2 / 100;
-	if (sc->data[SC_FRIGG_SONG])
-		maxhp += maxhp * sc->data[SC_FRIGG_SONG]->val2 / 100;
-	if (sc->data[SC_SOULSCROLL])
-		maxhp += maxhp * sc->data[SC_SOULSCROLL]->val1 / 100;
-	if (sc->data[SC_ATKER_ASPD])
-		maxhp += maxhp * sc->data[SC_ATKER_ASPD]->val1 / 100;
-	if (sc->data[SC_MVPCARD_TAOGUNKA])
-		maxhp += maxhp * sc->data[SC_MVPCARD_TAOGUNKA]->val1 / 100;
-	if (sc->data[SC_GM_BATTLE])
-		maxhp -= maxhp * sc->data[SC_GM_BATTLE]->val1 / 100;
-	if (sc->data[SC_GM_BATTLE2])
-		maxhp -= maxhp * sc->data[SC_GM_BATTLE2]->val1 / 100;
-	if (sc->data[SC_LUNARSTANCE] != NULL)
-		maxhp += maxhp * sc->data[SC_LUNARSTANCE]->val2 / 100;
+	if (SC_ENTRY(sc, SC__WEAKNESS))
+		maxhp -= maxhp * SC_ENTRY(sc, SC__WEAKNESS)->val2 / 100;
+	if (SC_ENTRY(sc, SC_LERADS_DEW))
+		maxhp += SC_ENTRY(sc, SC_LERADS_DEW)->val3;
+	if (SC_ENTRY(sc, SC_BEYOND_OF_WARCRY))
+		maxhp -= maxhp * SC_ENTRY(sc, SC_BEYOND_OF_WARCRY)->val4 / 100;
+	if (SC_ENTRY(sc, SC_FORCEOFVANGUARD))
+		maxhp += maxhp * 3 * SC_ENTRY(sc, SC_FORCEOFVANGUARD)->val1 / 100;
+	if (SC_ENTRY(sc, SC_INSPIRATION))
+		maxhp += maxhp * 5 * SC_ENTRY(sc, SC_INSPIRATION)->val1 / 100 + 600 * SC_ENTRY(sc, SC_INSPIRATION)->val1;
+	if (SC_ENTRY(sc, SC_RAISINGDRAGON))
+		maxhp += maxhp * (2 + SC_ENTRY(sc, SC_RAISINGDRAGON)->val1) / 100;
+	if (SC_ENTRY(sc, SC_GENTLETOUCH_CHANGE)) // Max HP decrease: [Skill Level x 1] %
+		maxhp -= maxhp * (1 * SC_ENTRY(sc, SC_GENTLETOUCH_CHANGE)->val1) / 100;
+	if (SC_ENTRY(sc, SC_GENTLETOUCH_REVITALIZE))// Max HP increase: [Skill Level x 2] %
+		maxhp += maxhp * (2 * SC_ENTRY(sc, SC_GENTLETOUCH_REVITALIZE)->val1) / 100;
+	if (SC_ENTRY(sc, SC_MUSTLE_M))
+		maxhp += maxhp * SC_ENTRY(sc, SC_MUSTLE_M)->val1 / 100;
+	if (SC_ENTRY(sc, SC_PROMOTE_HEALTH_RESERCH))
+		maxhp += SC_ENTRY(sc, SC_PROMOTE_HEALTH_RESERCH)->val3;
+	if (SC_ENTRY(sc, SC_MYSTERIOUS_POWDER))
+		maxhp -= maxhp * SC_ENTRY(sc, SC_MYSTERIOUS_POWDER)->val1 / 100;
+	if (SC_ENTRY(sc, SC_PETROLOGY_OPTION))
+		maxhp += maxhp * SC_ENTRY(sc, SC_PETROLOGY_OPTION)->val2 / 100;
+	if (SC_ENTRY(sc, SC_CURSED_SOIL_OPTION))
+		maxhp += maxhp * SC_ENTRY(sc, SC_CURSED_SOIL_OPTION)->val2 / 100;
+	if (SC_ENTRY(sc, SC_UPHEAVAL_OPTION))
+		maxhp += maxhp * SC_ENTRY(sc, SC_UPHEAVAL_OPTION)->val3 / 100;
+	if (SC_ENTRY(sc, SC_ANGRIFFS_MODUS))
+		maxhp += maxhp * 5 * SC_ENTRY(sc, SC_ANGRIFFS_MODUS)->val1 /100;
+	if (SC_ENTRY(sc, SC_GOLDENE_FERSE))
+		maxhp += maxhp * SC_ENTRY(sc, SC_GOLDENE_FERSE)->val2 / 100;
+	if (SC_ENTRY(sc, SC_FRIGG_SONG))
+		maxhp += maxhp * SC_ENTRY(sc, SC_FRIGG_SONG)->val2 / 100;
+	if (SC_ENTRY(sc, SC_SOULSCROLL))
+		maxhp += maxhp * SC_ENTRY(sc, SC_SOULSCROLL)->val1 / 100;
+	if (SC_ENTRY(sc, SC_ATKER_ASPD))
+		maxhp += maxhp * SC_ENTRY(sc, SC_ATKER_ASPD)->val1 / 100;
+	if (SC_ENTRY(sc, SC_MVPCARD_TAOGUNKA))
+		maxhp += maxhp * SC_ENTRY(sc, SC_MVPCARD_TAOGUNKA)->val1 / 100;
+	if (SC_ENTRY(sc, SC_GM_BATTLE))
+		maxhp -= maxhp * SC_ENTRY(sc, SC_GM_BATTLE)->val1 / 100;
+	if (SC_ENTRY(sc, SC_GM_BATTLE2))
+		maxhp -= maxhp * SC_ENTRY(sc, SC_GM_BATTLE2)->val1 / 100;
+	if (SC_ENTRY(sc, SC_LUNARSTANCE) != NULL)
+		maxhp += maxhp * SC_ENTRY(sc, SC_LUNARSTANCE)->val2 / 100;
 #ifdef RENEWAL
-	if (sc->data[SC_ANGELUS] != NULL)
-		maxhp += sc->data[SC_ANGELUS]->val3;
-	if (sc->data[SC_NIBELUNGEN] != NULL && sc->data[SC_NIBELUNGEN]->val2 == RINGNBL_EFF_MAXHP)
+	if (SC_ENTRY(sc, SC_ANGELUS) != NULL)
+		maxhp += SC_ENTRY(sc, SC_ANGELUS)->val3;
+	if (SC_ENTRY(sc, SC_NIBELUNGEN) != NULL && SC_ENTRY(sc, SC_NIBELUNGEN)->val2 == RINGNBL_EFF_MAXHP)
 		maxhp += maxhp * 30 / 100;
 #endif
 
@@ -6037,39 +6041,39 @@ static unsigned int status_calc_maxsp(struct block_list *bl, struct status_chang
 	if (!sc || !sc->count)
 		return cap_value(maxsp, 1, UINT_MAX);
 
-	if (sc->data[SC_INCMSPRATE])
-		maxsp += maxsp * sc->data[SC_INCMSPRATE]->val1 / 100;
-	if (sc->data[SC_INCMSP])
-		maxsp += (sc->data[SC_INCMSP]->val1);
-	if (sc->data[SC_MTF_MSP])
-		maxsp += (sc->data[SC_MTF_MSP]->val1);
-	if (sc->data[SC_SERVICEFORYOU])
-		maxsp += maxsp * sc->data[SC_SERVICEFORYOU]->val2 / 100;
-	if (sc->data[SC_MER_SP])
-		maxsp += maxsp * sc->data[SC_MER_SP]->val2 / 100;
-	if (sc->data[SC_RAISINGDRAGON])
-		maxsp += maxsp * (2 + sc->data[SC_RAISINGDRAGON]->val1) / 100;
-	if (sc->data[SC_LIFE_FORCE_F])
-		maxsp += maxsp * sc->data[SC_LIFE_FORCE_F]->val1 / 100;
-	if (sc->data[SC_EARTH_INSIGNIA] && sc->data[SC_EARTH_INSIGNIA]->val1 == 3)
+	if (SC_ENTRY(sc, SC_INCMSPRATE))
+		maxsp += maxsp * SC_ENTRY(sc, SC_INCMSPRATE)->val1 / 100;
+	if (SC_ENTRY(sc, SC_INCMSP))
+		maxsp += (SC_ENTRY(sc, SC_INCMSP)->val1);
+	if (SC_ENTRY(sc, SC_MTF_MSP))
+		maxsp += (SC_ENTRY(sc, SC_MTF_MSP)->val1);
+	if (SC_ENTRY(sc, SC_SERVICEFORYOU))
+		maxsp += maxsp * SC_ENTRY(sc, SC_SERVICEFORYOU)->val2 / 100;
+	if (SC_ENTRY(sc, SC_MER_SP))
+		maxsp += maxsp * SC_ENTRY(sc, SC_MER_SP)->val2 / 100;
+	if (SC_ENTRY(sc, SC_RAISINGDRAGON))
+		maxsp += maxsp * (2 + SC_ENTRY(sc, SC_RAISINGDRAGON)->val1) / 100;
+	if (SC_ENTRY(sc, SC_LIFE_FORCE_F))
+		maxsp += maxsp * SC_ENTRY(sc, SC_LIFE_FORCE_F)->val1 / 100;
+	if (SC_ENTRY(sc, SC_EARTH_INSIGNIA) && SC_ENTRY(sc, SC_EARTH_INSIGNIA)->val1 == 3)
 		maxsp += 50;
-	if (sc->data[SC_VITATA_500])
-		maxsp += maxsp * sc->data[SC_VITATA_500]->val2 / 100;
-	if (sc->data[SC_ENERGY_DRINK_RESERCH])
-		maxsp += maxsp * sc->data[SC_ENERGY_DRINK_RESERCH]->val3 / 100;
-	if (sc->data[SC_TARGET_ASPD])
-		maxsp += maxsp * sc->data[SC_TARGET_ASPD]->val1 / 100;
-	if (sc->data[SC_SOULSCROLL])
-		maxsp += maxsp * sc->data[SC_SOULSCROLL]->val1 / 100;
-	if (sc->data[SC_ATKER_MOVESPEED])
-		maxsp += maxsp * sc->data[SC_ATKER_MOVESPEED]->val1 / 100;
-	if (sc->data[SC_GM_BATTLE])
-		maxsp -= maxsp * sc->data[SC_GM_BATTLE]->val1 / 100;
-	if (sc->data[SC_GM_BATTLE2])
-		maxsp -= maxsp * sc->data[SC_GM_BATTLE2]->val1 / 100;
+	if (SC_ENTRY(sc, SC_VITATA_500))
+		maxsp += maxsp * SC_ENTRY(sc, SC_VITATA_500)->val2 / 100;
+	if (SC_ENTRY(sc, SC_ENERGY_DRINK_RESERCH))
+		maxsp += maxsp * SC_ENTRY(sc, SC_ENERGY_DRINK_RESERCH)->val3 / 100;
+	if (SC_ENTRY(sc, SC_TARGET_ASPD))
+		maxsp += maxsp * SC_ENTRY(sc, SC_TARGET_ASPD)->val1 / 100;
+	if (SC_ENTRY(sc, SC_SOULSCROLL))
+		maxsp += maxsp * SC_ENTRY(sc, SC_SOULSCROLL)->val1 / 100;
+	if (SC_ENTRY(sc, SC_ATKER_MOVESPEED))
+		maxsp += maxsp * SC_ENTRY(sc, SC_ATKER_MOVESPEED)->val1 / 100;
+	if (SC_ENTRY(sc, SC_GM_BATTLE))
+		maxsp -= maxsp * SC_ENTRY(sc, SC_GM_BATTLE)->val1 / 100;
+	if (SC_ENTRY(sc, SC_GM_BATTLE2))
+		maxsp -= maxsp * SC_ENTRY(sc, SC_GM_BATTLE2)->val1 / 100;
 
 #ifdef RENEWAL
-	if (sc->data[SC_NIBELUNGEN] != NULL && sc->data[SC_NIBELUNGEN]->val2 == RINGNBL_EFF_MAXSP)
+	if (SC_ENTRY(sc, SC_NIBELUNGEN) != NULL && SC_ENTRY(sc, SC_NIBELUNGEN)->val2 == RINGNBL_EFF_MAXSP)
 		maxsp += maxsp * 30 / 100;
 #endif
 
@@ -6081,18 +6085,18 @@ static unsigned char status_calc_element(struct block_list *bl, struct status_ch
 	if(!sc || !sc->count)
 		return element;
 
-	if(sc->data[SC_FREEZE])
+	if(SC_ENTRY(sc, SC_FREEZE))
 		return ELE_WATER;
-	if(sc->data[SC_STONE] && sc->opt1 == OPT1_STONE)
+	if(SC_ENTRY(sc, SC_STONE) && sc->opt1 == OPT1_STONE)
 		return ELE_EARTH;
-	if(sc->data[SC_BENEDICTIO])
+	if(SC_ENTRY(sc, SC_BENEDICTIO))
 		return ELE_HOLY;
-	if(sc->data[SC_PROPERTYUNDEAD])
+	if(SC_ENTRY(sc, SC_PROPERTYUNDEAD))
 		return ELE_UNDEAD;
-	if(sc->data[SC_ARMOR_PROPERTY])
-		return sc->data[SC_ARMOR_PROPERTY]->val2;
-	if(sc->data[SC_SHAPESHIFT])
-		return sc->data[SC_SHAPESHIFT]->val2;
+	if(SC_ENTRY(sc, SC_ARMOR_PROPERTY))
+		return SC_ENTRY(sc, SC_ARMOR_PROPERTY)->val2;
+	if(SC_ENTRY(sc, SC_SHAPESHIFT))
+		return SC_ENTRY(sc, SC_SHAPESHIFT)->val2;
 
 	return (unsigned char)cap_value(element,0,UCHAR_MAX);
 }
@@ -6102,19 +6106,19 @@ static unsigned char status_calc_element_lv(struct block_list *bl, struct status
 	if(!sc || !sc->count)
 		return lv;
 
-	if(sc->data[SC_FREEZE])
+	if(SC_ENTRY(sc, SC_FREEZE))
 		return 1;
-	if(sc->data[SC_STONE] && sc->opt1 == OPT1_STONE)
+	if(SC_ENTRY(sc, SC_STONE) && sc->opt1 == OPT1_STONE)
 		return 1;
-	if(sc->data[SC_BENEDICTIO])
+	if(SC_ENTRY(sc, SC_BENEDICTIO))
 		return 1;
-	if(sc->data[SC_PROPERTYUNDEAD])
+	if(SC_ENTRY(sc, SC_PROPERTYUNDEAD))
 		return 1;
-	if(sc->data[SC_ARMOR_PROPERTY])
-		return sc->data[SC_ARMOR_PROPERTY]->val1;
-	if(sc->data[SC_SHAPESHIFT])
+	if(SC_ENTRY(sc, SC_ARMOR_PROPERTY))
+		return SC_ENTRY(sc, SC_ARMOR_PROPERTY)->val1;
+	if(SC_ENTRY(sc, SC_SHAPESHIFT))
 		return 1;
-	if(sc->data[SC__INVISIBILITY])
+	if(SC_ENTRY(sc, SC__INVISIBILITY))
 		return 1;
 
 	return (unsigned char)cap_value(lv,1,4);
@@ -6124,31 +6128,31 @@ static unsigned char status_calc_attack_element(struct block_list *bl, struct st
 {
 	if(!sc || !sc->count)
 		return element;
-	if(sc->data[SC_ENCHANTARMS])
-		return sc->data[SC_ENCHANTARMS]->val2;
-	if(sc->data[SC_PROPERTYWATER]
-	|| (sc->data[SC_WATER_INSIGNIA] && sc->data[SC_WATER_INSIGNIA]->val1 == 2) )
+	if(SC_ENTRY(sc, SC_ENCHANTARMS))
+		return SC_ENTRY(sc, SC_ENCHANTARMS)->val2;
+	if(SC_ENTRY(sc, SC_PROPERTYWATER)
+	|| (SC_ENTRY(sc, SC_WATER_INSIGNIA) && SC_ENTRY(sc, SC_WATER_INSIGNIA)->val1 == 2) )
 		return ELE_WATER;
-	if(sc->data[SC_PROPERTYGROUND]
-	|| (sc->data[SC_EARTH_INSIGNIA] && sc->data[SC_EARTH_INSIGNIA]->val1 == 2) )
+	if(SC_ENTRY(sc, SC_PROPERTYGROUND)
+	|| (SC_ENTRY(sc, SC_EARTH_INSIGNIA) && SC_ENTRY(sc, SC_EARTH_INSIGNIA)->val1 == 2) )
 		return ELE_EARTH;
-	if(sc->data[SC_PROPERTYFIRE]
-	|| (sc->data[SC_FIRE_INSIGNIA] && sc->data[SC_FIRE_INSIGNIA]->val1 == 2) )
+	if(SC_ENTRY(sc, SC_PROPERTYFIRE)
+	|| (SC_ENTRY(sc, SC_FIRE_INSIGNIA) && SC_ENTRY(sc, SC_FIRE_INSIGNIA)->val1 == 2) )
 		return ELE_FIRE;
-	if(sc->data[SC_PROPERTYWIND]
-	|| (sc->data[SC_WIND_INSIGNIA] && sc->data[SC_WIND_INSIGNIA]->val1 == 2) )
+	if(SC_ENTRY(sc, SC_PROPERTYWIND)
+	|| (SC_ENTRY(sc, SC_WIND_INSIGNIA) && SC_ENTRY(sc, SC_WIND_INSIGNIA)->val1 == 2) )
 		return ELE_WIND;
-	if(sc->data[SC_ENCHANTPOISON])
+	if(SC_ENTRY(sc, SC_ENCHANTPOISON))
 		return ELE_POISON;
-	if(sc->data[SC_ASPERSIO])
+	if(SC_ENTRY(sc, SC_ASPERSIO))
 		return ELE_HOLY;
-	if(sc->data[SC_PROPERTYDARK])
+	if(SC_ENTRY(sc, SC_PROPERTYDARK))
 		return ELE_DARK;
-	if(sc->data[SC_PROPERTYTELEKINESIS] || sc->data[SC__INVISIBILITY])
+	if(SC_ENTRY(sc, SC_PROPERTYTELEKINESIS) || SC_ENTRY(sc, SC__INVISIBILITY))
 		return ELE_GHOST;
-	if(sc->data[SC_TIDAL_WEAPON_OPTION] || sc->data[SC_TIDAL_WEAPON] )
+	if(SC_ENTRY(sc, SC_TIDAL_WEAPON_OPTION) || SC_ENTRY(sc, SC_TIDAL_WEAPON) )
 		return ELE_WATER;
-	if(sc->data[SC_PYROCLASTIC])
+	if(SC_ENTRY(sc, SC_PYROCLASTIC))
 		return ELE_FIRE;
 	return (unsigned char)cap_value(element,0,UCHAR_MAX);
 }
@@ -6165,13 +6169,13 @@ static uint32 status_calc_mode(const struct block_list *bl, const struct status_
 {
 	if (sc == NULL || sc->count == 0)
 		return mode & MD_MASK;
-	if (sc->data[SC_MODECHANGE] != NULL) {
-		if (sc->data[SC_MODECHANGE]->val2 != 0)
-			mode = sc->data[SC_MODECHANGE]->val2; //Set mode
-		if (sc->data[SC_MODECHANGE]->val3)
-			mode |= sc->data[SC_MODECHANGE]->val3; //Add mode
-		if (sc->data[SC_MODECHANGE]->val4)
-			mode &= ~sc->data[SC_MODECHANGE]->val4; //Del mode
+	if (SC_ENTRY(sc, SC_MODECHANGE) != NULL) {
+		if (SC_ENTRY(sc, SC_MODECHANGE)->val2 != 0)
+			mode = SC_ENTRY(sc, SC_MODECHANGE)->val2; //Set mode
+		if (SC_ENTRY(sc, SC_MODECHANGE)->val3)
+			mode |= SC_ENTRY(sc, SC_MODECHANGE)->val3; //Add mode
+		if (SC_ENTRY(sc, SC_MODECHANGE)->val4)
+			mode &= ~SC_ENTRY(sc, SC_MODECHANGE)->val4; //Del mode
 	}
 	return mode & MD_MASK;
 }
@@ -6629,7 +6633,7 @@ static int status_isimmune(struct block_list *bl)
 	nullpo_ret(bl);
 	sc = status->get_sc(bl);
 
-	if (sc != NULL && sc->data[SC_HERMODE] != NULL)
+	if (sc != NULL && SC_ENTRY(sc, SC_HERMODE) != NULL)
 		return 100;
 
 	if (bl->type == BL_PC) {
@@ -6855,6 +6859,157 @@ static void status_change_init(struct block_list *bl)
 	memset(sc, 0, sizeof (struct status_change));
 }
 
+/**
+ * Finds where a status change is, or would be, stored in the active slots
+ * of a unit.
+ *
+ * @param sc   The unit's status changes.
+ * @param type The status change type.
+ * @return Index of the first active slot whose type isn't lower than type
+ *         (sc->slot_count if none).
+ */
+static int status_change_slot_find(const struct status_change *sc, int type)
+{
+	const struct status_change_slot *slots;
+	int lo = 0, hi;
+
+	nullpo_ret(sc);
+
+	slots = sc->slots != NULL ? sc->slots : sc->inline_slots;
+	hi = sc->slot_count;
+	while (lo < hi) {
+		int mid = (lo + hi) / 2;
+		if (slots[mid].type < type)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return lo;
+}
+
+/**
+ * Stores a status change entry of a unit, moving the unit's slots to a heap
+ * block once they don't fit in its inline slots anymore.
+ *
+ * @param sc   The unit's status changes.
+ * @param type The status change type.
+ * @param sce  The new entry.
+ */
+static void status_change_slot_set(struct status_change *sc, enum sc_type type, struct status_change_entry *sce)
+{
+	struct status_change_slot *slots;
+	int i;
+
+	nullpo_retv(sc);
+	nullpo_retv(sce);
+	Assert_retv(type > SC_NONE && type < SC_MAX);
+
+	i = status->change_slot_find(sc, type);
+	slots = sc->slots != NULL ? sc->slots : sc->inline_slots;
+	if (i < sc->slot_count && slots[i].type == type) {
+		slots[i].entry = sce;
+		return;
+	}
+
+	if (sc->slots == NULL && sc->slot_count == STATUS_CHANGE_INLINE_SLOTS) {
+		sc->slot_max = 2 * STATUS_CHANGE_INLINE_SLOTS;
+		CREATE(sc->slots, struct status_change_slot, sc->slot_max);
+		memcpy(sc->slots, sc->inline_slots, sizeof(sc->inline_slots));
+		slots = sc->slots;
+	} else if (sc->slots != NULL && sc->slot_count == sc->slot_max) {
+		sc->slot_max *= 2;
+		RECREATE(sc->slots, struct status_change_slot, sc->slot_max);
+		slots = sc->slots;
+	}
+
+	if (i < sc->slot_count)
+		memmove(&slots[i + 1], &slots[i], (sc->slot_count - i) * sizeof(*slots));
+	slots[i].type = type;
+	slots[i].entry = sce;
+	sc->slot_count++;
+}
+
+/**
+ * Removes a status change entry of a unit (the entry itself isn't freed).
+ * The unit's heap block is given back with its last entry.
+ *
+ * @param sc   The unit's status changes.
+ * @param type The status change type.
+ */
+static void status_change_slot_clear(struct status_change *sc, enum sc_type type)
+{
+	struct status_change_slot *slots;
+	int i;
+
+	nullpo_retv(sc);
+	Assert_retv(type > SC_NONE && type < SC_MAX);
+
+	i = status->change_slot_find(sc, type);
+	slots = sc->slots != NULL ? sc->slots : sc->inline_slots;
+	if (i >= sc->slot_count || slots[i].type != type)
+		return;
+	sc->slot_count--;
+	if (i < sc->slot_count)
+		memmove(&slots[i], &slots[i + 1], (sc->slot_count - i) * sizeof(*slots));
+	status->bump_version(sc);
+	status->change_slots_release(sc);
+}
+
+/**
+ * Gives a new status version to a unit, so that the results computed from
+ * its previous status (see battle->cardfix_cache) aren't used anymore.
+ * Versions are never reused (0 is skipped when the counter wraps around).
+ *
+ * @param sc The unit's status changes.
+ */
+static void status_bump_version(struct status_change *sc)
+{
+	nullpo_retv(sc);
+
+	if (++status->last_version == 0)
+		++status->last_version;
+	sc->version = status->last_version;
+}
+
+/**
+ * Gives the heap block of a unit's slots back once none of its status
+ * changes is active anymore.
+ *
+ * @param sc The unit's status changes.
+ */
+static void status_change_slots_release(struct status_change *sc)
+{
+	nullpo_retv(sc);
+
+	if (sc->slots == NULL || sc->slot_count > 0)
+		return;
+	aFree(sc->slots);
+	sc->slots = NULL;
+	sc->slot_max = 0;
+}
+
+/**
+ * Finds the next status change active on a unit.
+ *
+ * @param sc   The unit's status changes.
+ * @param type The previous status change type (SC_NONE to start).
+ * @return The first active status change type after type, SC_MAX if none.
+ * @see STATUS_CHANGE_ITER
+ */
+static int status_change_next(const struct status_change *sc, int type)
+{
+	int i;
+
+	nullpo_retr(SC_MAX, sc);
+
+	if (sc->slot_count == 0 || type + 1 >= SC_MAX)
+		return SC_MAX;
+	i = status->change_slot_find(sc, type + 1);
+	if (i >= sc->slot_count)
+		return SC_MAX;
+	return sc->slots != NULL ? sc->slots[i].type : sc->inline_slots[i].type;
+}
+
 /**
  * Applies SC defense to a given status change.
  *
@@ -6898,7 +7053,7 @@ static int status_get_sc_def(struct block_list *src, struct block_list *bl, enum
 	if( sc && !sc->count )
 		sc = NULL;
 
-	if (sc && sc->data[SC_KINGS_GRACE]) {
+	if (sc && SC_ENTRY(sc, SC_KINGS_GRACE)) {
 		// Protects against status effects
 		PRAGMA_GCC46(GCC diagnostic push)
 		PRAGMA_GCC46(GCC diagnostic ignored "-Wswitch-enum")
@@ -7131,12 +7286,12 @@ static int status_get_sc_def(struct block_list *src, struct block_list *bl, enum
 	}
 
 	if (sc) {
-		if (sc->data[SC_SCRESIST])
-			sc_def += sc->data[SC_SCRESIST]->val1 * 100; //Status resist
-		else if (sc->data[SC_SIEGFRIED])
-			sc_def += sc->data[SC_SIEGFRIED]->val3 * 100; //Status resistance.
-		if (sc && sc->data[SC_MVPCARD_ORCHERO])
-			sc_def += sc->data[SC_MVPCARD_ORCHERO]->val1 * 100;
+		if (SC_ENTRY(sc, SC_SCRESIST))
+			sc_def += SC_ENTRY(sc, SC_SCRESIST)->val1 * 100; //Status resist
+		else if (SC_ENTRY(sc, SC_SIEGFRIED))
+			sc_def += SC_ENTRY(sc, SC_SIEGFRIED)->val3 * 100; //Status resistance.
+		if (sc && SC_ENTRY(sc, SC_MVPCARD_ORCHERO))
+			sc_def += SC_ENTRY(sc, SC_MVPCARD_ORCHERO)->val1 * 100;
 	}
 
 	//When tick def not set, reduction is the same for both.
@@ -7166,8 +7321,8 @@ static int status_get_sc_def(struct block_list *src, struct block_list *bl, enum
 		{
 			if (sd->reseff[type-SC_COMMON_MIN] > 0)
 				rate -= rate * sd->reseff[type-SC_COMMON_MIN] / 10000;
-			if (sd->sc.data[SC_TARGET_BLOOD])
-				rate -= rate * sd->sc.data[SC_TARGET_BLOOD]->val1 / 100;
+			if (SC_ENTRY(&sd->sc, SC_TARGET_BLOOD))
+				rate -= rate * SC_ENTRY(&sd->sc, SC_TARGET_BLOOD)->val1 / 100;
 		}
 
 		//Aegis accuracy
@@ -7328,7 +7483,7 @@ static int status_change_start_sub(struct block_list *src, struct block_list *bl
 	if (status->isdead(bl) && type != SC_NOCHAT) // SC_NOCHAT should work even on dead characters
 		return 0;
 
-	if (sc->data[SC_GRAVITYCONTROL] != NULL)
+	if (SC_ENTRY(sc, SC_GRAVITYCONTROL) != NULL)
 		return 0; // !TODO: Confirm what statuses/conditions (if not all) are blocked.
 
 	if (bl->type == BL_MOB) {
@@ -7366,18 +7521,18 @@ static int status_change_start_sub(struct block_list *src, struct block_list *bl
 			break;
 		case SC_ANGRIFFS_MODUS:
 		case SC_GOLDENE_FERSE:
-			if ((type==SC_GOLDENE_FERSE && sc->data[SC_ANGRIFFS_MODUS])
-				|| (type==SC_ANGRIFFS_MODUS && sc->data[SC_GOLDENE_FERSE])
+			if ((type==SC_GOLDENE_FERSE && SC_ENTRY(sc, SC_ANGRIFFS_MODUS))
+				|| (type==SC_ANGRIFFS_MODUS && SC_ENTRY(sc, SC_GOLDENE_FERSE))
 				) {
 				return 0;
 			}
 			FALLTHROUGH
 		case SC_VACUUM_EXTREME:
-			if(sc->data[SC_HALLUCINATIONWALK])
+			if(SC_ENTRY(sc, SC_HALLUCINATIONWALK))
 				return 0;
 			break;
 		case SC_STONE:
-			if(sc->data[SC_POWER_OF_GAIA])
+			if(SC_ENTRY(sc, SC_POWER_OF_GAIA))
 				return 0;
 			FALLTHROUGH
 		case SC_FREEZE:
@@ -7386,7 +7541,7 @@ static int status_change_start_sub(struct block_list *src, struct block_list *bl
 				return 0;
 			// SC_LEXAETERNA should be removed when applying SC_FREEZE on BL_PC types
 			// we remove SC_STONE later when we're done hardening the target.
-			if (type == SC_FREEZE && bl->type == BL_PC && sc->data[SC_LEXAETERNA] != NULL)
+			if (type == SC_FREEZE && bl->type == BL_PC && SC_ENTRY(sc, SC_LEXAETERNA) != NULL)
 				status_change_end(bl, SC_LEXAETERNA, INVALID_TIMER);
 			FALLTHROUGH
 		case SC_SLEEP:
@@ -7395,15 +7550,15 @@ static int status_change_start_sub(struct block_list *src, struct block_list *bl
 		case SC_COLD:
 			if (sc->opt1)
 				return 0; //Cannot override other opt1 status changes. [Skotlex]
-			if((type == SC_FREEZE || type == SC_FROSTMISTY || type == SC_COLD) && sc->data[SC_WARMER])
+			if((type == SC_FREEZE || type == SC_FROSTMISTY || type == SC_COLD) && SC_ENTRY(sc, SC_WARMER))
 				return 0; //Immune to Frozen and Freezing status if under Warmer status. [Jobbie]
 			break;
 		case SC_BERSERK: // There all like berserk, do not everlap each other
-			if (sc->data[SC__BLOODYLUST])
+			if (SC_ENTRY(sc, SC__BLOODYLUST))
 				return 0;
 			break;
 		case SC_BURNING:
-			if (sc->opt1 || sc->data[SC_FROSTMISTY])
+			if (sc->opt1 || SC_ENTRY(sc, SC_FROSTMISTY))
 				return 0;
 			break;
 		case SC_CRUCIS: // Only affects demons and undead element (but not players)
@@ -7411,7 +7566,7 @@ static int status_change_start_sub(struct block_list *src, struct block_list *bl
 				return 0;
 			break;
 		case SC_LEXAETERNA:
-			if ((sc->data[SC_STONE] && sc->opt1 == OPT1_STONE) || sc->data[SC_FREEZE])
+			if ((SC_ENTRY(sc, SC_STONE) && sc->opt1 == OPT1_STONE) || SC_ENTRY(sc, SC_FREEZE))
 				return 0;
 			break;
 		case SC_KYRIE:
@@ -7420,7 +7575,7 @@ static int status_change_start_sub(struct block_list *src, struct block_list *bl
 				return 0;
 			break;
 		case SC_OVERTHRUST:
-			if (sc->data[SC_OVERTHRUSTMAX])
+			if (SC_ENTRY(sc, SC_OVERTHRUSTMAX))
 				return 0; // Overthrust can't take effect if under Max Overthrust. [Skotlex]
 			FALLTHROUGH
 		case SC_OVERTHRUSTMAX:
@@ -7430,13 +7585,13 @@ static int status_change_start_sub(struct block_list *src, struct block_list *bl
 		case SC_ADRENALINE:
 			if (sd && !pc_check_weapontype(sd, skill->get_weapontype(BS_ADRENALINE)))
 				return 0;
-			if (sc->data[SC_QUAGMIRE] || sc->data[SC_DEC_AGI] || sc->option&OPTION_MADOGEAR) // Adrenaline doesn't affect Mado Gear [Ind]
+			if (SC_ENTRY(sc, SC_QUAGMIRE) || SC_ENTRY(sc, SC_DEC_AGI) || sc->option&OPTION_MADOGEAR) // Adrenaline doesn't affect Mado Gear [Ind]
 				return 0;
 			break;
 		case SC_ADRENALINE2:
 			if (sd && !pc_check_weapontype(sd,skill->get_weapontype(BS_ADRENALINE2)))
 				return 0;
-			if (sc->data[SC_QUAGMIRE] || sc->data[SC_DEC_AGI])
+			if (SC_ENTRY(sc, SC_QUAGMIRE) || SC_ENTRY(sc, SC_DEC_AGI))
 				return 0;
 			break;
 		case SC_MAGNIFICAT:
@@ -7446,7 +7601,7 @@ static int status_change_start_sub(struct block_list *src, struct block_list *bl
 		case SC_ONEHANDQUICKEN:
 		case SC_MER_QUICKEN:
 		case SC_TWOHANDQUICKEN:
-			if (sc->data[SC_DEC_AGI])
+			if (SC_ENTRY(sc, SC_DEC_AGI))
 				return 0;
 			FALLTHROUGH
 		case SC_CONCENTRATION:
@@ -7459,7 +7614,7 @@ static int status_change_start_sub(struct block_list *src, struct block_list *bl
 				return 0; // Mado is immune to wind walk, cart boost, etc (others above) [Ind]
 			FALLTHROUGH
 		case SC_INC_AGI:
-			if (sc->data[SC_QUAGMIRE])
+			if (SC_ENTRY(sc, SC_QUAGMIRE))
 				return 0;
 			break;
 		case SC_CLOAKING:
@@ -7472,12 +7627,12 @@ static int status_change_start_sub(struct block_list *src, struct block_list *bl
 			const struct status_data *bst = status->get_base_status(bl);
 			if (bst == NULL)
 				return 0;
-			if (sc->data[type] != NULL) {
+			if (SC_ENTRY(sc, type) != NULL) {
 				// Pile up with previous values.
 				if (val2 == 0)
-					val2 = sc->data[type]->val2;
-				val3 |= sc->data[type]->val3;
-				val4 |= sc->data[type]->val4;
+					val2 = SC_ENTRY(sc, type)->val2;
+				val3 |= SC_ENTRY(sc, type)->val3;
+				val4 |= SC_ENTRY(sc, type)->val4;
 			}
 			mode = (unsigned int)val2 != 0 ? (unsigned int)val2 : bst->mode; // Base mode
 			if (val4 != 0)
@@ -7485,7 +7640,7 @@ static int status_change_start_sub(struct block_list *src, struct block_list *bl
 			if (val3 != 0)
 				mode |= val3; //Add mode
 			if (mode == bst->mode) { //No change.
-				if (sc->data[type] != NULL) //Abort previous status
+				if (SC_ENTRY(sc, type) != NULL) //Abort previous status
 					return status_change_end(bl, type, INVALID_TIMER);
 				return 0;
 			}
@@ -7569,57 +7724,57 @@ static int status_change_start_sub(struct block_list *src, struct block_list *bl
 			break;
 		// Normal foods can't overwrite cash foods, and cash foods only overwrite those of equal or lower level
 		case SC_FOOD_STR:
-			if (sc->data[SC_FOOD_STR_CASH] != NULL)
+			if (SC_ENTRY(sc, SC_FOOD_STR_CASH) != NULL)
 				return 0;
 			FALLTHROUGH
 		case SC_FOOD_STR_CASH:
-			if ((sc->data[SC_FOOD_STR_CASH] != NULL && sc->data[SC_FOOD_STR_CASH]->val1 > val1)
-				|| (sc->data[SC_FOOD_STR] != NULL && sc->data[SC_FOOD_STR]->val1 > val1))
+			if ((SC_ENTRY(sc, SC_FOOD_STR_CASH) != NULL && SC_ENTRY(sc, SC_FOOD_STR_CASH)->val1 > val1)
+				|| (SC_ENTRY(sc, SC_FOOD_STR) != NULL && SC_ENTRY(sc, SC_FOOD_STR)->val1 > val1))
 				return 0;
 			break;
 		case SC_FOOD_AGI:
-			if (sc->data[SC_FOOD_AGI_CASH] != NULL)
+			if (SC_ENTRY(sc, SC_FOOD_AGI_CASH) != NULL)
 				return 0;
 			FALLTHROUGH
 		case SC_FOOD_AGI_CASH:
-			if ((sc->data[SC_FOOD_AGI_CASH] != NULL && sc->data[SC_FOOD_AGI_CASH]->val1 > val1)
-				|| (sc->data[SC_FOOD_AGI] != NULL && sc->data[SC_FOOD_AGI]->val1 > val1))
+			if ((SC_ENTRY(sc, SC_FOOD_AGI_CASH) != NULL && SC_ENTRY(sc, SC_FOOD_AGI_CASH)->val1 > val1)
+				|| (SC_ENTRY(sc, SC_FOOD_AGI) != NULL && SC_ENTRY(sc, SC_FOOD_AGI)->val1 > val1))
 				return 0;
 			break;
 		case SC_FOOD_VIT:
-			if (sc->data[SC_FOOD_VIT_CASH] != NULL)
+			if (SC_ENTRY(sc, SC_FOOD_VIT_CASH) != NULL)
 				return 0;
 			FALLTHROUGH
 		case SC_FOOD_VIT_CASH:
-			if ((sc->data[SC_FOOD_VIT_CASH] != NULL && sc->data[SC_FOOD_VIT_CASH]->val1 > val1)
-				|| (sc->data[SC_FOOD_VIT] != NULL && sc->data[SC_FOOD_VIT]->val1 > val1))
+			if ((SC_ENTRY(sc, SC_FOOD_VIT_CASH) != NULL && SC_ENTRY(sc, SC_FOOD_VIT_CASH)->val1 > val1)
+				|| (SC_ENTRY(sc, SC_FOOD_VIT) != NULL && SC_ENTRY(sc, SC_FOOD_VIT)->val1 > val1))
 				return 0;
 			break;
 		case SC_FOOD_INT:
-			if (sc->data[SC_FOOD_INT_CASH] != NULL)
+			if (SC_ENTRY(sc, SC_FOOD_INT_CASH) != NULL)
 				return 0;
 			FALLTHROUGH
 		case SC_FOOD_INT_CASH:
-			if ((sc->data[SC_FOOD_INT_CASH] != NULL && sc->data[SC_FOOD_INT_CASH]->val1 > val1)
-				|| (sc->data[SC_FOOD_INT] != NULL && sc->data[SC_FOOD_INT]->val1 > val1))
+			if ((SC_ENTRY(sc, SC_FOOD_INT_CASH) != NULL && SC_ENTRY(sc, SC_FOOD_INT_CASH)->val1 > val1)
+				|| (SC_ENTRY(sc, SC_FOOD_INT) != NULL && SC_ENTRY(sc, SC_FOOD_INT)->val1 > val1))
 				return 0;
 			break;
 		case SC_FOOD_DEX:
-			if (sc->data[SC_FOOD_DEX_CASH] != NULL)
+			if (SC_ENTRY(sc, SC_FOOD_DEX_CASH) != NULL)
 				return 0;
 			FALLTHROUGH
 		case SC_FOOD_DEX_CASH:
-			if ((sc->data[SC_FOOD_DEX_CASH] != NULL && sc->data[SC_FOOD_DEX_CASH]->val1 > val1)
-				|| (sc->data[SC_FOOD_DEX] != NULL && sc->data[SC_FOOD_DEX]->val1 > val1))
+			if ((SC_ENTRY(sc, SC_FOOD_DEX_CASH) != NULL && SC_ENTRY(sc, SC_FOOD_DEX_CASH)->val1 > val1)
+				|| (SC_ENTRY(sc, SC_FOOD_DEX) != NULL && SC_ENTRY(sc, SC_FOOD_DEX)->val1 > val1))
 				return 0;
 			break;
 		case SC_FOOD_LUK:
-			if (sc->data[SC_FOOD_LUK_CASH] != NULL)
+			if (SC_ENTRY(sc, SC_FOOD_LUK_CASH) != NULL)
 				return 0;
 			FALLTHROUGH
 		case SC_FOOD_LUK_CASH:
-			if ((sc->data[SC_FOOD_LUK_CASH] != NULL && sc->data[SC_FOOD_LUK_CASH]->val1 > val1)
-				|| (sc->data[SC_FOOD_LUK] != NULL && sc->data[SC_FOOD_LUK]->val1 > val1))
+			if ((SC_ENTRY(sc, SC_FOOD_LUK_CASH) != NULL && SC_ENTRY(sc, SC_FOOD_LUK_CASH)->val1 > val1)
+				|| (SC_ENTRY(sc, SC_FOOD_LUK) != NULL && SC_ENTRY(sc, SC_FOOD_LUK)->val1 > val1))
 				return 0;
 			break;
 		case SC_CAMOUFLAGE:
@@ -7655,27 +7810,27 @@ static int status_change_start_sub(struct block_list *src, struct block_list *bl
 			{ // it doesn't stack or even renewed
 				int i = SC_TOXIN;
 				for(; i<= SC_LEECHESEND; i++)
-					if(sc->data[i]) return 0;
+					if(SC_ENTRY(sc, i)) return 0;
 			}
 			break;
 		case SC_MAGNETICFIELD:
-			if(sc->data[SC_HOVERING])
+			if(SC_ENTRY(sc, SC_HOVERING))
 				return 0;
 			break;
 		case SC_HEAT_BARREL:
-			if (sc->data[SC_PLATINUM_ALTER] || sc->data[SC_GS_MADNESSCANCEL])
+			if (SC_ENTRY(sc, SC_PLATINUM_ALTER) || SC_ENTRY(sc, SC_GS_MADNESSCANCEL))
 				return 0;
 			break;
 		case SC_PLATINUM_ALTER:
-			if (sc->data[SC_HEAT_BARREL] || sc->data[SC_GS_MADNESSCANCEL])
+			if (SC_ENTRY(sc, SC_HEAT_BARREL) || SC_ENTRY(sc, SC_GS_MADNESSCANCEL))
 				return 0;
 			break;
 		case SC_GS_MADNESSCANCEL:
-			if (sc->data[SC_PLATINUM_ALTER] || sc->data[SC_HEAT_BARREL])
+			if (SC_ENTRY(sc, SC_PLATINUM_ALTER) || SC_ENTRY(sc, SC_HEAT_BARREL))
 				return 0;
 			break;
 		case SC_NEWMOON:
-			if (sc->data[SC_WUGBITE] != NULL)
+			if (SC_ENTRY(sc, SC_WUGBITE) != NULL)
 				return 0;
 			break;
 	}
@@ -7692,7 +7847,7 @@ static int status_change_start_sub(struct block_list *src, struct block_list *bl
 		return 0;
 
 	//Check for overlapping fails
-	if( (sce = sc->data[type]) ) {
+	if( (sce = SC_ENTRY(sc, type)) ) {
 		PRAGMA_GCC46(GCC diagnostic push)
 		PRAGMA_GCC46(GCC diagnostic ignored "-Wswitch-enum")
 		switch( type ) {
@@ -7798,7 +7953,7 @@ static int status_change_start_sub(struct block_list *src, struct block_list *bl
 				val4 = sce->val4;
 				break;
 			case SC_LERADS_DEW:
-				if (sc && sc->data[SC_BERSERK])
+				if (sc && SC_ENTRY(sc, SC_BERSERK))
 					return 0;
 				FALLTHROUGH
 			case SC_SHAPESHIFT:
@@ -7878,7 +8033,7 @@ static int status_change_start_sub(struct block_list *src, struct block_list *bl
 				break;
 			case SC_AUTOBERSERK:
 				if (st->hp < st->max_hp>>2 &&
-					(!sc->data[SC_PROVOKE] || sc->data[SC_PROVOKE]->val2==0))
+					(!SC_ENTRY(sc, SC_PROVOKE) || SC_ENTRY(sc, SC_PROVOKE)->val2==0))
 					sc_start4(src, bl, SC_PROVOKE, 100, 10, 1, 0, 0, 60000, skill_id);
 				total_tick = INFINITE_DURATION;
 				break;
@@ -8275,7 +8430,7 @@ static int status_change_start_sub(struct block_list *src, struct block_list *bl
 			case SC_CHASEWALK:
 				val2 = total_tick>0?total_tick:10000; //Interval at which SP is drained.
 				val3 = 35 - 5 * val1; //Speed adjustment.
-				if (sc->data[SC_SOULLINK] && sc->data[SC_SOULLINK]->val2 == SL_ROGUE)
+				if (SC_ENTRY(sc, SC_SOULLINK) && SC_ENTRY(sc, SC_SOULLINK)->val2 == SL_ROGUE)
 					val3 -= 40;
 				val4 = 10+val1*2; //SP cost.
 				if (map_flag_gvg(bl->m) || map->list[bl->m].flag.battleground) val4 *= 5;
@@ -8389,7 +8544,7 @@ static int status_change_start_sub(struct block_list *src, struct block_list *bl
 			case SC_BERSERK:
 				if( val3 == SC__BLOODYLUST )
 					sc_start(src, bl, (sc_type)val3, 100, val1, total_tick, skill_id);
-				if (!val3 && (!sc->data[SC_ENDURE] || !sc->data[SC_ENDURE]->val4))
+				if (!val3 && (!SC_ENTRY(sc, SC_ENDURE) || !SC_ENTRY(sc, SC_ENDURE)->val4))
 					sc_start4(src, bl, SC_ENDURE, 100, 10, 0, 0, 2, total_tick, skill_id);
 				//HP healing is performing after the calc_status call.
 				//Val2 holds HP penalty
@@ -8428,7 +8583,7 @@ static int status_change_start_sub(struct block_list *src, struct block_list *bl
 				// fetch caster information
 				struct block_list *pbl = map->id2bl(val1);
 				struct status_change *psc = pbl ? status->get_sc(pbl) : NULL;
-				struct status_change_entry *psce = psc ? psc->data[SC_MARIONETTE_MASTER] : NULL;
+				struct status_change_entry *psce = psc ? SC_ENTRY(psc, SC_MARIONETTE_MASTER) : NULL;
 				// fetch target's stats
 				struct status_data* tst = status->get_status_data(bl); // battle status
 
@@ -8498,9 +8653,9 @@ static int status_change_start_sub(struct block_list *src, struct block_list *bl
 					int i = (map_flag_gvg(bl->m) || map->list[bl->m].flag.battleground)?2:3;
 					while (i >= 0) {
 						enum sc_type type2 = types[i];
-						if (d_sc->data[type2]) {
-							status->change_start(bl, bl, type2, 10000, d_sc->data[type2]->val1, 0, 0, 0,
-								skill->get_time(status->sc2skill(type2), d_sc->data[type2]->val1),
+						if (SC_ENTRY(d_sc, type2)) {
+							status->change_start(bl, bl, type2, 10000, SC_ENTRY(d_sc, type2)->val1, 0, 0, 0,
+								skill->get_time(status->sc2skill(type2), SC_ENTRY(d_sc, type2)->val1),
 								(type2 != SC_DEFENDER) ? SCFLAG_NOICON : SCFLAG_NONE, skill_id);
 						}
 						i--;
@@ -8522,7 +8677,7 @@ static int status_change_start_sub(struct block_list *src, struct block_list *bl
 			{
 				struct block_list *src2 = val2 ? map->id2bl(val2) : NULL;
 				struct status_change *sc2 = src ? status->get_sc(src2) : NULL;
-				struct status_change_entry *sce2 = sc2 ? sc2->data[SC_RG_CCONFINE_M] : NULL;
+				struct status_change_entry *sce2 = sc2 ? SC_ENTRY(sc2, SC_RG_CCONFINE_M) : NULL;
 				if (src2 && sc2) {
 					if (!sce2) //Start lock on caster.
 						sc_start4(src, src2, SC_RG_CCONFINE_M, 100, val1, 1, 0, 0, total_tick + 1000, skill_id);
@@ -8766,7 +8921,7 @@ static int status_change_start_sub(struct block_list *src, struct block_list *bl
 						val4 = pos;
 					} else if (!val3
 						|| val3 == sd->mapindex
-						|| !sd->sc.data[SC_JAILED] // If player is being jailed and is already in jail (issue: 8206)
+						|| !SC_ENTRY(&sd->sc, SC_JAILED) // If player is being jailed and is already in jail (issue: 8206)
 					) { //Use save point.
 						val3 = sd->status.save_point.map;
 						val4 = (sd->status.save_point.x&0xFFFF)
@@ -8882,10 +9037,10 @@ static int status_change_start_sub(struct block_list *src, struct block_list *bl
 				//break;
 				}
 			case SC_ARMOR_RESIST: {
-				struct status_change_entry *sce_water = sc->data[SC_RESIST_PROPERTY_WATER];
-				struct status_change_entry *sce_ground = sc->data[SC_RESIST_PROPERTY_GROUND];
-				struct status_change_entry *sce_fire = sc->data[SC_RESIST_PROPERTY_FIRE];
-				struct status_change_entry *sce_wind = sc->data[SC_RESIST_PROPERTY_WIND];
+				struct status_change_entry *sce_water = SC_ENTRY(sc, SC_RESIST_PROPERTY_WATER);
+				struct status_change_entry *sce_ground = SC_ENTRY(sc, SC_RESIST_PROPERTY_GROUND);
+				struct status_change_entry *sce_fire = SC_ENTRY(sc, SC_RESIST_PROPERTY_FIRE);
+				struct status_change_entry *sce_wind = SC_ENTRY(sc, SC_RESIST_PROPERTY_WIND);
 
 				// Water
 				int sum_water = val1 + ((sce_fire != NULL) ? sce_fire->val2 : 0);
@@ -8970,9 +9125,9 @@ static int status_change_start_sub(struct block_list *src, struct block_list *bl
 				break;
 			}
 			case SC_RESIST_PROPERTY_WATER: {
-				struct status_change_entry *sce_all = sc->data[SC_ARMOR_RESIST];
-				struct status_change_entry *sce_fire = sc->data[SC_RESIST_PROPERTY_FIRE];
-				struct status_change_entry *sce_wind = sc->data[SC_RESIST_PROPERTY_WIND];
+				struct status_change_entry *sce_all = SC_ENTRY(sc, SC_ARMOR_RESIST);
+				struct status_change_entry *sce_fire = SC_ENTRY(sc, SC_RESIST_PROPERTY_FIRE);
+				struct status_change_entry *sce_wind = SC_ENTRY(sc, SC_RESIST_PROPERTY_WIND);
 
 				// Water
 				int sum_water = val1 + ((sce_fire != NULL) ? sce_fire->val2 : 0);
@@ -8999,9 +9154,9 @@ static int status_change_start_sub(struct block_list *src, struct block_list *bl
 				break;
 			}
 			case SC_RESIST_PROPERTY_GROUND: {
-				struct status_change_entry *sce_all = sc->data[SC_ARMOR_RESIST];
-				struct status_change_entry *sce_wind = sc->data[SC_RESIST_PROPERTY_WIND];
-				struct status_change_entry *sce_fire = sc->data[SC_RESIST_PROPERTY_FIRE];
+				struct status_change_entry *sce_all = SC_ENTRY(sc, SC_ARMOR_RESIST);
+				struct status_change_entry *sce_wind = SC_ENTRY(sc, SC_RESIST_PROPERTY_WIND);
+				struct status_change_entry *sce_fire = SC_ENTRY(sc, SC_RESIST_PROPERTY_FIRE);
 
 				// Ground
 				int sum_ground = val1 + ((sce_wind != NULL) ? sce_wind->val2 : 0);
@@ -9028,9 +9183,9 @@ static int status_change_start_sub(struct block_list *src, struct block_list *bl
 				break;
 			}
 			case SC_RESIST_PROPERTY_FIRE: {
-				struct status_change_entry *sce_all = sc->data[SC_ARMOR_RESIST];
-				struct status_change_entry *sce_ground = sc->data[SC_RESIST_PROPERTY_GROUND];
-				struct status_change_entry *sce_water = sc->data[SC_RESIST_PROPERTY_WATER];
+				struct status_change_entry *sce_all = SC_ENTRY(sc, SC_ARMOR_RESIST);
+				struct status_change_entry *sce_ground = SC_ENTRY(sc, SC_RESIST_PROPERTY_GROUND);
+				struct status_change_entry *sce_water = SC_ENTRY(sc, SC_RESIST_PROPERTY_WATER);
 
 				// Fire
 				int sum_fire = val1 + ((sce_ground != NULL) ? sce_ground->val2 : 0);
@@ -9057,9 +9212,9 @@ static int status_change_start_sub(struct block_list *src, struct block_list *bl
 				break;
 			}
 			case SC_RESIST_PROPERTY_WIND: {
-				struct status_change_entry *sce_all = sc->data[SC_ARMOR_RESIST];
-				struct status_change_entry *sce_water = sc->data[SC_RESIST_PROPERTY_WATER];
-				struct status_change_entry *sce_ground = sc->data[SC_RESIST_PROPERTY_GROUND];
+				struct status_change_entry *sce_all = SC_ENTRY(sc, SC_ARMOR_RESIST);
+				struct status_change_entry *sce_water = SC_ENTRY(sc, SC_RESIST_PROPERTY_WATER);
+				struct status_change_entry *sce_ground = SC_ENTRY(sc, SC_RESIST_PROPERTY_GROUND);
 
 				// Wind
 				int sum_wind = val1 + ((sce_water != NULL) ? sce_water->val2 : 0);
@@ -9755,7 +9910,7 @@ static int status_change_start_sub(struct block_list *src, struct block_list *bl
 			case SC_PAIN_KILLER: //[Lighta] need real info
 				val2 = 2*val1; //aspd reduction %
 				val3 = 2*val1; //dmg reduction %
-				if(sc->data[SC_NEEDLE_OF_PARALYZE])
+				if(SC_ENTRY(sc, SC_NEEDLE_OF_PARALYZE))
 					sc_start(src, bl, SC_ENDURE, 100, val1, total_tick, skill_id); //start endure for same duration
 				break;
 			case SC_STYLE_CHANGE: //[Lighta] need real info
@@ -10057,12 +10212,13 @@ static int status_change_start_sub(struct block_list *src, struct block_list *bl
 		tick = tick_time;
 
 	//Don't trust the previous sce assignment, in case the SC ended somewhere between there and here.
-	if((sce=sc->data[type])) {// reuse old sc
+	if((sce=SC_ENTRY(sc, type))) {// reuse old sc
 		if( sce->timer != INVALID_TIMER )
 			timer->delete_(sce->timer, status->change_timer);
 	} else {// new sc
 		++(sc->count);
-		sce = sc->data[type] = ers_alloc(status->data_ers, struct status_change_entry);
+		sce = ers_alloc(status->data_ers, struct status_change_entry);
+		status->change_slot_set(sc, type, sce);
 	}
 
 	sce->val1 = val1;
@@ -10070,6 +10226,7 @@ static int status_change_start_sub(struct block_list *src, struct block_list *bl
 	sce->val3 = val3;
 	sce->val4 = val4;
 	sce->total_tick = total_tick;
+	status->bump_version(sc);
 
 	if (tick >= 0) {
 		sce->timer = timer->add(timer->gettick() + tick, status->change_timer, bl->id, type);
@@ -10629,7 +10786,7 @@ static void status_change_start_stop_action(struct block_list *bl, enum sc_type
 		case SC_GRAVITYCONTROL:
 		{
 			struct status_change *sc = status->get_sc(bl);
-			if (sc != NULL && sc->data[SC_DANCING] != NULL)
+			if (sc != NULL && SC_ENTRY(sc, SC_DANCING) != NULL)
 				unit->stop_walking(bl, STOPWALKING_FLAG_FIXPOS);
 			FALLTHROUGH
 		}
@@ -10720,12 +10877,12 @@ static bool status_end_sc_before_start(struct block_list *bl, struct status_data
 		if ((undead_flag == 0 && st->race != RC_DEMON) || bl->type == BL_PC) {
 			bool prevent_start = false;
 
-			if (sc->data[SC_CURSE] != NULL) {
+			if (SC_ENTRY(sc, SC_CURSE) != NULL) {
 				prevent_start = true;
 				status_change_end(bl, SC_CURSE, INVALID_TIMER);
 			}
 
-			if (sc->data[SC_STONE] != NULL && sc->opt1 == OPT1_STONE) {
+			if (SC_ENTRY(sc, SC_STONE) != NULL && sc->opt1 == OPT1_STONE) {
 				prevent_start = true;
 				status_change_end(bl, SC_STONE, INVALID_TIMER);
 			}
@@ -10734,14 +10891,14 @@ static bool status_end_sc_before_start(struct block_list *bl, struct status_data
 				return true;
 		}
 
-		if (sc->data[SC_SOULLINK] != NULL && sc->data[SC_SOULLINK]->val2 == SL_HIGH)
+		if (SC_ENTRY(sc, SC_SOULLINK) != NULL && SC_ENTRY(sc, SC_SOULLINK)->val2 == SL_HIGH)
 			status_change_end(bl, SC_SOULLINK, INVALID_TIMER);
 
 		break;
 	case SC_INC_AGI:
 		status_change_end(bl, SC_DEC_AGI, INVALID_TIMER);
 
-		if (sc->data[SC_SOULLINK] != NULL && sc->data[SC_SOULLINK]->val2 == SL_HIGH)
+		if (SC_ENTRY(sc, SC_SOULLINK) != NULL && SC_ENTRY(sc, SC_SOULLINK)->val2 == SL_HIGH)
 			status_change_end(bl, SC_SOULLINK, INVALID_TIMER);
 
 		break;
@@ -10793,12 +10950,12 @@ static bool status_end_sc_before_start(struct block_list *bl, struct status_data
 		status_change_end(bl, SC_MAGNIFICAT, INVALID_TIMER);
 		break;
 	case SC_DELUGE:
-		if (sc->data[SC_FOGWALL] != NULL && sc->data[SC_BLIND] != NULL)
+		if (SC_ENTRY(sc, SC_FOGWALL) != NULL && SC_ENTRY(sc, SC_BLIND) != NULL)
 			status_change_end(bl, SC_BLIND, INVALID_TIMER);
 
 		break;
 	case SC_SILENCE:
-		if (sc->data[SC_GOSPEL] != NULL && sc->data[SC_GOSPEL]->val4 == BCT_SELF)
+		if (SC_ENTRY(sc, SC_GOSPEL) != NULL && SC_ENTRY(sc, SC_GOSPEL)->val4 == BCT_SELF)
 			status_change_end(bl, SC_GOSPEL, INVALID_TIMER);
 
 		break;
@@ -10834,7 +10991,7 @@ static bool status_end_sc_before_start(struct block_list *bl, struct status_data
 		// status_change_end(bl, SC_ASSUMPTIO_BUFF, INVALID_TIMER); // 2018.11 rebalance - New assumptio works together with Kaite/Kyrie
 		break;
 	case SC_CARTBOOST:
-		if (sc->data[SC_DEC_AGI] != NULL || sc->data[SC_ADORAMUS] != NULL) {
+		if (SC_ENTRY(sc, SC_DEC_AGI) != NULL || SC_ENTRY(sc, SC_ADORAMUS) != NULL) {
 			// Cancel Decrease Agi, but take no further effect [Skotlex]
 			status_change_end(bl, SC_DEC_AGI, INVALID_TIMER);
 			status_change_end(bl, SC_ADORAMUS, INVALID_TIMER);
@@ -11080,7 +11237,7 @@ static bool status_end_sc_before_start(struct block_list *bl, struct status_data
 #ifndef RENEWAL
 		status_change_end(bl, type, INVALID_TIMER);
 #else
-		if (sc->data[type] == NULL || val1 >= sc->data[type]->val1)
+		if (SC_ENTRY(sc, type) == NULL || val1 >= SC_ENTRY(sc, type)->val1)
 			status_change_end(bl, type, INVALID_TIMER);
 #endif
 		break;
@@ -11088,7 +11245,7 @@ static bool status_end_sc_before_start(struct block_list *bl, struct status_data
 	case SC_LUNARSTANCE:
 	case SC_STARSTANCE:
 	case SC_UNIVERSESTANCE:
-		if (sc->data[type] != NULL)
+		if (SC_ENTRY(sc, type) != NULL)
 			break;
 		status_change_end(bl, SC_SUNSTANCE, INVALID_TIMER);
 		status_change_end(bl, SC_LUNARSTANCE, INVALID_TIMER);
@@ -11100,7 +11257,7 @@ static bool status_end_sc_before_start(struct block_list *bl, struct status_data
 	case SC_SOULSHADOW:
 	case SC_SOULFALCON:
 	case SC_SOULFAIRY:
-		if (sc->data[type] != NULL)
+		if (SC_ENTRY(sc, type) != NULL)
 			break;
 		status_change_end(bl, SC_SOULLINK, INVALID_TIMER);
 		status_change_end(bl, SC_SOULGOLEM, INVALID_TIMER);
@@ -11145,7 +11302,7 @@ static bool status_is_boss_resist_sc(enum sc_type type)
 static bool status_is_immune_to_status(struct status_change *sc, enum sc_type type)
 {
 	nullpo_retr(true, sc);
-	if (sc->data[SC_REFRESH]) {
+	if (SC_ENTRY(sc, SC_REFRESH)) {
 		if (type >= SC_COMMON_MIN && type <= SC_COMMON_MAX) // Confirmed.
 			return true; // Immune to status ailements
 		PRAGMA_GCC46(GCC diagnostic push)
@@ -11166,7 +11323,7 @@ static bool status_is_immune_to_status(struct status_change *sc, enum sc_type ty
 				return true;
 		}
 		PRAGMA_GCC46(GCC diagnostic pop)
-	} else if (sc->data[SC_INSPIRATION]) {
+	} else if (SC_ENTRY(sc, SC_INSPIRATION)) {
 		if (type >= SC_COMMON_MIN && type <= SC_COMMON_MAX)
 			return true; // Immune to status ailements
 		PRAGMA_GCC46(GCC diagnostic push)
@@ -11226,18 +11383,17 @@ static int status_change_clear(struct block_list *bl, int type)
 	sc->sg_counter = 0;
 #endif
 
-	if (sc->count == 0)
+	if (sc->count == 0) {
+		status->change_slots_release(sc);
 		return 0;
+	}
 
-	for(i = 0; i < SC_MAX; i++) {
-		if(!sc->data[i])
-			continue;
-
+	STATUS_CHANGE_ITER(sc, i) {
 		if(type == 0){
 			if( status->get_sc_type(i)&SC_NO_REM_DEATH ) {
 				switch (i) {
 					case SC_ARMOR_PROPERTY://Only when its Holy or Dark that it doesn't dispell on death
-						if( sc->data[i]->val2 != ELE_HOLY && sc->data[i]->val2 != ELE_DARK )
+						if( SC_ENTRY(sc, i)->val2 != ELE_HOLY && SC_ENTRY(sc, i)->val2 != ELE_DARK )
 							break;
 						FALLTHROUGH
 					default:
@@ -11250,15 +11406,16 @@ static int status_change_clear(struct block_list *bl, int type)
 
 		status_change_end(bl, (sc_type)i, INVALID_TIMER);
 
-		if( type == 1 && sc->data[i] ) {
+		if( type == 1 && SC_ENTRY(sc, i) ) {
 			//If for some reason status_change_end decides to still keep the status when quitting. [Skotlex]
 			(sc->count)--;
-			if (sc->data[i]->timer != INVALID_TIMER)
-				timer->delete_(sc->data[i]->timer, status->change_timer);
-			ers_free(status->data_ers, sc->data[i]);
-			sc->data[i] = NULL;
+			if (SC_ENTRY(sc, i)->timer != INVALID_TIMER)
+				timer->delete_(SC_ENTRY(sc, i)->timer, status->change_timer);
+			ers_free(status->data_ers, SC_ENTRY(sc, i));
+			status->change_slot_clear(sc, (sc_type)i);
 		}
 	}
+	status->change_slots_release(sc);
 
 	if( type == 0 || type == 2 )
 		clif->changeoption(bl);
@@ -11286,7 +11443,7 @@ static int status_change_end_(struct block_list *bl, enum sc_type type, int tid)
 
 	sc = status->get_sc(bl);
 
-	if(type < 0 || type >= SC_MAX || !sc || !(sce = sc->data[type]))
+	if(type < 0 || type >= SC_MAX || !sc || !(sce = SC_ENTRY(sc, type)))
 		return 0;
 
 	sd = BL_CAST(BL_PC,bl);
@@ -11333,7 +11490,7 @@ static int status_change_end_(struct block_list *bl, enum sc_type type, int tid)
 
 	(sc->count)--;
 
-	sc->data[type] = NULL;
+	status->change_slot_clear(sc, type);
 
 	if( sd && status->dbs->DisplayType[type] ) {
 		status->display_remove(sd,type);
@@ -11387,7 +11544,7 @@ static int status_change_end_(struct block_list *bl, enum sc_type type, int tid)
 			}
 			break;
 		case SC_AUTOBERSERK:
-			if (sc->data[SC_PROVOKE] && sc->data[SC_PROVOKE]->val2 == 1)
+			if (SC_ENTRY(sc, SC_PROVOKE) && SC_ENTRY(sc, SC_PROVOKE)->val2 == 1)
 				status_change_end(bl, SC_PROVOKE, INVALID_TIMER);
 			break;
 
@@ -11402,7 +11559,7 @@ static int status_change_end_(struct block_list *bl, enum sc_type type, int tid)
 					if (sd != NULL ) {
 						int i;
 						for( i = 0; i < MAX_PC_DEVOTION; i++ ) {
-							if (sd->devotion[i] && (tsd = map->id2sd(sd->devotion[i])) != NULL && tsd->sc.data[type])
+							if (sd->devotion[i] && (tsd = map->id2sd(sd->devotion[i])) != NULL && SC_ENTRY(&tsd->sc, type))
 								status_change_end(&tsd->bl, type, INVALID_TIMER);
 						}
 					}
@@ -11411,7 +11568,7 @@ static int status_change_end_(struct block_list *bl, enum sc_type type, int tid)
 					if (mc->devotion_flag) {
 						// Clear Status from Master
 						tsd = mc->master;
-						if (tsd != NULL && tsd->sc.data[type] != NULL)
+						if (tsd != NULL && SC_ENTRY(&tsd->sc, type) != NULL)
 							status_change_end(&tsd->bl, type, INVALID_TIMER);
 					}
 				}
@@ -11441,8 +11598,8 @@ static int status_change_end_(struct block_list *bl, enum sc_type type, int tid)
 				struct block_list *tbl = map->id2bl(target_id);
 				struct status_change *tsc = status->get_sc(tbl);
 				sce->val4 = 0;
-				if(tbl && tsc && tsc->data[SC_BLADESTOP]) {
-					tsc->data[SC_BLADESTOP]->val4 = 0;
+				if(tbl && tsc && SC_ENTRY(tsc, SC_BLADESTOP)) {
+					SC_ENTRY(tsc, SC_BLADESTOP)->val4 = 0;
 					status_change_end(tbl, SC_BLADESTOP, INVALID_TIMER);
 				}
 				clif->bladestop(bl, target_id, 0);
@@ -11455,7 +11612,7 @@ static int status_change_end_(struct block_list *bl, enum sc_type type, int tid)
 
 				if (sce->val4 && sce->val4 != BCT_SELF && (dsd=map->id2sd(sce->val4)) != NULL) {
 					// end status on partner as well
-					dsc = dsd->sc.data[SC_DANCING];
+					dsc = SC_ENTRY(&dsd->sc, SC_DANCING);
 					if (dsc) {
 						//This will prevent recursive loops.
 						dsc->val2 = dsc->val4 = 0;
@@ -11500,10 +11657,10 @@ static int status_change_end_(struct block_list *bl, enum sc_type type, int tid)
 			{
 				struct block_list *src = sce->val2 ? map->id2bl(sce->val2) : NULL;
 				struct status_change *sc2 = src ? status->get_sc(src) : NULL;
-				if (src && sc2 && sc2->data[SC_RG_CCONFINE_M]) {
+				if (src && sc2 && SC_ENTRY(sc2, SC_RG_CCONFINE_M)) {
 					//If status was already ended, do nothing.
 					//Decrease count
-					if (--(sc2->data[SC_RG_CCONFINE_M]->val2) <= 0) //No more holds, free him up.
+					if (--(SC_ENTRY(sc2, SC_RG_CCONFINE_M)->val2) <= 0) //No more holds, free him up.
 						status_change_end(src, SC_RG_CCONFINE_M, INVALID_TIMER);
 				}
 			}
@@ -11548,22 +11705,22 @@ static int status_change_end_(struct block_list *bl, enum sc_type type, int tid)
 				struct block_list *pbl = map->id2bl(sce->val1);
 				struct status_change* sc2 = pbl ? status->get_sc(pbl) : NULL;
 
-				if (sc2 && sc2->data[type2])
+				if (sc2 && SC_ENTRY(sc2, type2))
 				{
-					sc2->data[type2]->val1 = 0;
+					SC_ENTRY(sc2, type2)->val1 = 0;
 					status_change_end(pbl, type2, INVALID_TIMER);
 				}
 			}
 			break;
 
 		case SC_BERSERK:
-			if(st->hp > 200 && sc && sc->data[SC__BLOODYLUST]) {
+			if(st->hp > 200 && sc && SC_ENTRY(sc, SC__BLOODYLUST)) {
 				status_percent_heal(bl, 100, 0);
 				status_change_end(bl, SC__BLOODYLUST, INVALID_TIMER);
 			} else if(st->hp > 100 && sce->val2) //If val2 is removed, no HP penalty (dispelled?) [Skotlex]
 				status->set_hp(bl, 100, STATUS_HEAL_DEFAULT);
-			if(sc->data[SC_ENDURE] && sc->data[SC_ENDURE]->val4 == 2) {
-				sc->data[SC_ENDURE]->val4 = 0;
+			if(SC_ENTRY(sc, SC_ENDURE) && SC_ENTRY(sc, SC_ENDURE)->val4 == 2) {
+				SC_ENTRY(sc, SC_ENDURE)->val4 = 0;
 				status_change_end(bl, SC_ENDURE, INVALID_TIMER);
 			}
 			sc_start4(bl, bl, SC_GDSKILL_REGENERATION, 100, 10, 0, 0, (RGN_HP | RGN_SP), skill->get_time(LK_BERSERK, sce->val1), LK_BERSERK);
@@ -11634,12 +11791,12 @@ static int status_change_end_(struct block_list *bl, enum sc_type type, int tid)
 				struct block_list *tbl = map->id2bl(sce->val2);
 				struct status_change *tsc = NULL;
 				sce->val2 = 0;
-				if (tbl && (tsc = status->get_sc(tbl)) != NULL && tsc->data[SC_STOP] && tsc->data[SC_STOP]->val2 == bl->id)
+				if (tbl && (tsc = status->get_sc(tbl)) != NULL && SC_ENTRY(tsc, SC_STOP) && SC_ENTRY(tsc, SC_STOP)->val2 == bl->id)
 					status_change_end(tbl, SC_STOP, INVALID_TIMER);
 			}
 			break;
 		case SC_LKCONCENTRATION:
-			if (sc->data[SC_ENDURE] && sc->data[SC_ENDURE]->val4 != 2)
+			if (SC_ENTRY(sc, SC_ENDURE) && SC_ENTRY(sc, SC_ENDURE)->val4 != 2)
 				status_change_end(bl, SC_ENDURE, INVALID_TIMER);
 			break;
 			/**
@@ -11720,7 +11877,7 @@ static int status_change_end_(struct block_list *bl, enum sc_type type, int tid)
 		{
 			struct block_list *src = map->id2bl(sce->val2);
 			struct status_change *ssc = status->get_sc(src);
-			if( ssc && ssc->data[SC_CURSEDCIRCLE_ATKER] && --(ssc->data[SC_CURSEDCIRCLE_ATKER]->val2) == 0 ){
+			if( ssc && SC_ENTRY(ssc, SC_CURSEDCIRCLE_ATKER) && --(SC_ENTRY(ssc, SC_CURSEDCIRCLE_ATKER)->val2) == 0 ){
 				status_change_end(src, SC_CURSEDCIRCLE_ATKER, INVALID_TIMER);
 				clif->bladestop(bl, sce->val2, 0);
 			}
@@ -11765,10 +11922,10 @@ static int status_change_end_(struct block_list *bl, enum sc_type type, int tid)
 			}
 			break;
 		case SC_ARMOR_RESIST: {
-			struct status_change_entry *sce_water = sc->data[SC_RESIST_PROPERTY_WATER];
-			struct status_change_entry *sce_ground = sc->data[SC_RESIST_PROPERTY_GROUND];
-			struct status_change_entry *sce_fire = sc->data[SC_RESIST_PROPERTY_FIRE];
-			struct status_change_entry *sce_wind = sc->data[SC_RESIST_PROPERTY_WIND];
+			struct status_change_entry *sce_water = SC_ENTRY(sc, SC_RESIST_PROPERTY_WATER);
+			struct status_change_entry *sce_ground = SC_ENTRY(sc, SC_RESIST_PROPERTY_GROUND);
+			struct status_change_entry *sce_fire = SC_ENTRY(sc, SC_RESIST_PROPERTY_FIRE);
+			struct status_change_entry *sce_wind = SC_ENTRY(sc, SC_RESIST_PROPERTY_WIND);
 
 			// Water
 			clif->sc_end(bl, bl->id, AREA, status->get_sc_icon(SC_RESIST_PROPERTY_WATER));
@@ -11829,132 +11986,132 @@ static int status_change_end_(struct block_list *bl, enum sc_type type, int tid)
 			break;
 		}
 		case SC_RESIST_PROPERTY_WATER:
-			if (sc->data[SC_ARMOR_RESIST] != NULL && sc->data[SC_ARMOR_RESIST]->timer != INVALID_TIMER) {
-				const struct TimerData *td = timer->get(sc->data[SC_ARMOR_RESIST]->timer);
+			if (SC_ENTRY(sc, SC_ARMOR_RESIST) != NULL && SC_ENTRY(sc, SC_ARMOR_RESIST)->timer != INVALID_TIMER) {
+				const struct TimerData *td = timer->get(SC_ENTRY(sc, SC_ARMOR_RESIST)->timer);
 				if (td == NULL)
 					break;
 
 				// Water
-				int sum_water = sc->data[SC_ARMOR_RESIST]->val1;
-				if (sc->data[SC_RESIST_PROPERTY_FIRE] != NULL)
-					sum_water += sc->data[SC_RESIST_PROPERTY_FIRE]->val2;
-				if (sc->data[SC_ARMOR_RESIST]->val1 > 0 && sum_water > 0) {
+				int sum_water = SC_ENTRY(sc, SC_ARMOR_RESIST)->val1;
+				if (SC_ENTRY(sc, SC_RESIST_PROPERTY_FIRE) != NULL)
+					sum_water += SC_ENTRY(sc, SC_RESIST_PROPERTY_FIRE)->val2;
+				if (SC_ENTRY(sc, SC_ARMOR_RESIST)->val1 > 0 && sum_water > 0) {
 					int sc_icn = status->get_sc_icon(SC_RESIST_PROPERTY_WATER);
 					int sc_typ = status->get_sc_relevant_bl_types(SC_RESIST_PROPERTY_WATER);
 					int sc_tck = (int)DIFF_TICK(td->tick, timer->gettick());
-					int sc_ttl = sc->data[SC_ARMOR_RESIST]->total_tick;
+					int sc_ttl = SC_ENTRY(sc, SC_ARMOR_RESIST)->total_tick;
 					clif->status_change_sub(bl, sc_icn, sc_typ, 1, sc_tck, sc_ttl, 0, 0, 0);
 					remove_icon = false;
 				}
 
 				// Wind
-				int sum_wind = sc->data[SC_ARMOR_RESIST]->val4;
-				if (sc->data[SC_RESIST_PROPERTY_WIND] != NULL)
-					sum_wind += sc->data[SC_RESIST_PROPERTY_WIND]->val1;
-				if (sc->data[SC_ARMOR_RESIST]->val4 > 0 && sum_wind > 0) {
+				int sum_wind = SC_ENTRY(sc, SC_ARMOR_RESIST)->val4;
+				if (SC_ENTRY(sc, SC_RESIST_PROPERTY_WIND) != NULL)
+					sum_wind += SC_ENTRY(sc, SC_RESIST_PROPERTY_WIND)->val1;
+				if (SC_ENTRY(sc, SC_ARMOR_RESIST)->val4 > 0 && sum_wind > 0) {
 					int sc_icn = status->get_sc_icon(SC_RESIST_PROPERTY_WIND);
 					int sc_typ = status->get_sc_relevant_bl_types(SC_RESIST_PROPERTY_WIND);
 					int sc_tck = (int)DIFF_TICK(td->tick, timer->gettick());
-					int sc_ttl = sc->data[SC_ARMOR_RESIST]->total_tick;
+					int sc_ttl = SC_ENTRY(sc, SC_ARMOR_RESIST)->total_tick;
 					clif->status_change_sub(bl, sc_icn, sc_typ, 1, sc_tck, sc_ttl, 0, 0, 0);
 				}
 			}
 
 			break;
 		case SC_RESIST_PROPERTY_GROUND:
-			if (sc->data[SC_ARMOR_RESIST] != NULL && sc->data[SC_ARMOR_RESIST]->timer != INVALID_TIMER) {
-				const struct TimerData *td = timer->get(sc->data[SC_ARMOR_RESIST]->timer);
+			if (SC_ENTRY(sc, SC_ARMOR_RESIST) != NULL && SC_ENTRY(sc, SC_ARMOR_RESIST)->timer != INVALID_TIMER) {
+				const struct TimerData *td = timer->get(SC_ENTRY(sc, SC_ARMOR_RESIST)->timer);
 				if (td == NULL)
 					break;
 
 				// Ground
-				int sum_ground = sc->data[SC_ARMOR_RESIST]->val2;
-				if (sc->data[SC_RESIST_PROPERTY_WIND] != NULL)
-					sum_ground += sc->data[SC_RESIST_PROPERTY_WIND]->val2;
-				if (sc->data[SC_ARMOR_RESIST]->val2 > 0 && sum_ground > 0) {
+				int sum_ground = SC_ENTRY(sc, SC_ARMOR_RESIST)->val2;
+				if (SC_ENTRY(sc, SC_RESIST_PROPERTY_WIND) != NULL)
+					sum_ground += SC_ENTRY(sc, SC_RESIST_PROPERTY_WIND)->val2;
+				if (SC_ENTRY(sc, SC_ARMOR_RESIST)->val2 > 0 && sum_ground > 0) {
 					int sc_icn = status->get_sc_icon(SC_RESIST_PROPERTY_GROUND);
 					int sc_typ = status->get_sc_relevant_bl_types(SC_RESIST_PROPERTY_GROUND);
 					int sc_tck = (int)DIFF_TICK(td->tick, timer->gettick());
-					int sc_ttl = sc->data[SC_ARMOR_RESIST]->total_tick;
+					int sc_ttl = SC_ENTRY(sc, SC_ARMOR_RESIST)->total_tick;
 					clif->status_change_sub(bl, sc_icn, sc_typ, 1, sc_tck, sc_ttl, 0, 0, 0);
 					remove_icon = false;
 				}
 
 				// Fire
-				int sum_fire = sc->data[SC_ARMOR_RESIST]->val3;
-				if (sc->data[SC_RESIST_PROPERTY_FIRE] != NULL)
-					sum_fire += sc->data[SC_RESIST_PROPERTY_FIRE]->val1;
-				if (sc->data[SC_ARMOR_RESIST]->val3 > 0 && sum_fire > 0) {
+				int sum_fire = SC_ENTRY(sc, SC_ARMOR_RESIST)->val3;
+				if (SC_ENTRY(sc, SC_RESIST_PROPERTY_FIRE) != NULL)
+					sum_fire += SC_ENTRY(sc, SC_RESIST_PROPERTY_FIRE)->val1;
+				if (SC_ENTRY(sc, SC_ARMOR_RESIST)->val3 > 0 && sum_fire > 0) {
 					int sc_icn = status->get_sc_icon(SC_RESIST_PROPERTY_FIRE);
 					int sc_typ = status->get_sc_relevant_bl_types(SC_RESIST_PROPERTY_FIRE);
 					int sc_tck = (int)DIFF_TICK(td->tick, timer->gettick());
-					int sc_ttl = sc->data[SC_ARMOR_RESIST]->total_tick;
+					int sc_ttl = SC_ENTRY(sc, SC_ARMOR_RESIST)->total_tick;
 					clif->status_change_sub(bl, sc_icn, sc_typ, 1, sc_tck, sc_ttl, 0, 0, 0);
 				}
 			}
 
 			break;
 		case SC_RESIST_PROPERTY_FIRE:
-			if (sc->data[SC_ARMOR_RESIST] != NULL && sc->data[SC_ARMOR_RESIST]->timer != INVALID_TIMER) {
-				const struct TimerData *td = timer->get(sc->data[SC_ARMOR_RESIST]->timer);
+			if (SC_ENTRY(sc, SC_ARMOR_RESIST) != NULL && SC_ENTRY(sc, SC_ARMOR_RESIST)->timer != INVALID_TIMER) {
+				const struct TimerData *td = timer->get(SC_ENTRY(sc, SC_ARMOR_RESIST)->timer);
 				if (td == NULL)
 					break;
 
 				// Fire
-				int sum_fire = sc->data[SC_ARMOR_RESIST]->val3;
-				if (sc->data[SC_RESIST_PROPERTY_GROUND] != NULL)
-					sum_fire += sc->data[SC_RESIST_PROPERTY_GROUND]->val2;
-				if (sc->data[SC_ARMOR_RESIST]->val3 > 0 && sum_fire > 0) {
+				int sum_fire = SC_ENTRY(sc, SC_ARMOR_RESIST)->val3;
+				if (SC_ENTRY(sc, SC_RESIST_PROPERTY_GROUND) != NULL)
+					sum_fire += SC_ENTRY(sc, SC_RESIST_PROPERTY_GROUND)->val2;
+				if (SC_ENTRY(sc, SC_ARMOR_RESIST)->val3 > 0 && sum_fire > 0) {
 					int sc_icn = status->get_sc_icon(SC_RESIST_PROPERTY_FIRE);
 					int sc_typ = status->get_sc_relevant_bl_types(SC_RESIST_PROPERTY_FIRE);
 					int sc_tck = (int)DIFF_TICK(td->tick, timer->gettick());
-					int sc_ttl = sc->data[SC_ARMOR_RESIST]->total_tick;
+					int sc_ttl = SC_ENTRY(sc, SC_ARMOR_RESIST)->total_tick;
 					clif->status_change_sub(bl, sc_icn, sc_typ, 1, sc_tck, sc_ttl, 0, 0, 0);
 					remove_icon = false;
 				}
 
 				// Water
-				int sum_water = sc->data[SC_ARMOR_RESIST]->val1;
-				if (sc->data[SC_RESIST_PROPERTY_WATER] != NULL)
-					sum_water += sc->data[SC_RESIST_PROPERTY_WATER]->val1;
-				if (sc->data[SC_ARMOR_RESIST]->val1 > 0 && sum_water > 0) {
+				int sum_water = SC_ENTRY(sc, SC_ARMOR_RESIST)->val1;
+				if (SC_ENTRY(sc, SC_RESIST_PROPERTY_WATER) != NULL)
+					sum_water += SC_ENTRY(sc, SC_RESIST_PROPERTY_WATER)->val1;
+				if (SC_ENTRY(sc, SC_ARMOR_RESIST)->val1 > 0 && sum_water > 0) {
 					int sc_icn = status->get_sc_icon(SC_RESIST_PROPERTY_WATER);
 					int sc_typ = status->get_sc_relevant_bl_types(SC_RESIST_PROPERTY_WATER);
 					int sc_tck = (int)DIFF_TICK(td->tick, timer->gettick());
-					int sc_ttl = sc->data[SC_ARMOR_RESIST]->total_tick;
+					int sc_ttl = SC_ENTRY(sc, SC_ARMOR_RESIST)->total_tick;
 					clif->status_change_sub(bl, sc_icn, sc_typ, 1, sc_tck, sc_ttl, 0, 0, 0);
 				}
 			}
 
 			break;
 		case SC_RESIST_PROPERTY_WIND:
-			if (sc->data[SC_ARMOR_RESIST] != NULL && sc->data[SC_ARMOR_RESIST]->timer != INVALID_TIMER) {
-				const struct TimerData *td = timer->get(sc->data[SC_ARMOR_RESIST]->timer);
+			if (SC_ENTRY(sc, SC_ARMOR_RESIST) != NULL && SC_ENTRY(sc, SC_ARMOR_RESIST)->timer != INVALID_TIMER) {
+				const struct TimerData *td = timer->get(SC_ENTRY(sc, SC_ARMOR_RESIST)->timer);
 				if (td == NULL)
 					break;
 
 				// Wind
-				int sum_wind = sc->data[SC_ARMOR_RESIST]->val4;
-				if (sc->data[SC_RESIST_PROPERTY_WATER] != NULL)
-					sum_wind += sc->data[SC_RESIST_PROPERTY_WATER]->val2;
-				if (sc->data[SC_ARMOR_RESIST]->val4 > 0 && sum_wind > 0) {
+				int sum_wind = SC_ENTRY(sc, SC_ARMOR_RESIST)->val4;
+				if (SC_ENTRY(sc, SC_RESIST_PROPERTY_WATER) != NULL)
+					sum_wind += SC_ENTRY(sc, SC_RESIST_PROPERTY_WATER)->val2;
+				if (SC_ENTRY(sc, SC_ARMOR_RESIST)->val4 > 0 && sum_wind > 0) {
 					int sc_icn = status->get_sc_icon(SC_RESIST_PROPERTY_WIND);
 					int sc_typ = status->get_sc_relevant_bl_types(SC_RESIST_PROPERTY_WIND);
 					int sc_tck = (int)DIFF_TICK(td->tick, timer->gettick());
-					int sc_ttl = sc->data[SC_ARMOR_RESIST]->total_tick;
+					int sc_ttl = SC_ENTRY(sc, SC_ARMOR_RESIST)->total_tick;
 					clif->status_change_sub(bl, sc_icn, sc_typ, 1, sc_tck, sc_ttl, 0, 0, 0);
 					remove_icon = false;
 				}
 
 				// Ground
-				int sum_ground = sc->data[SC_ARMOR_RESIST]->val2;
-				if (sc->data[SC_RESIST_PROPERTY_GROUND] != NULL)
-					sum_ground += sc->data[SC_RESIST_PROPERTY_GROUND]->val1;
-				if (sc->data[SC_ARMOR_RESIST]->val2 > 0 && sum_ground > 0) {
+				int sum_ground = SC_ENTRY(sc, SC_ARMOR_RESIST)->val2;
+				if (SC_ENTRY(sc, SC_RESIST_PROPERTY_GROUND) != NULL)
+					sum_ground += SC_ENTRY(sc, SC_RESIST_PROPERTY_GROUND)->val1;
+				if (SC_ENTRY(sc, SC_ARMOR_RESIST)->val2 > 0 && sum_ground > 0) {
 					int sc_icn = status->get_sc_icon(SC_RESIST_PROPERTY_GROUND);
 					int sc_typ = status->get_sc_relevant_bl_types(SC_RESIST_PROPERTY_GROUND);
 					int sc_tck = (int)DIFF_TICK(td->tick, timer->gettick());
-					int sc_ttl = sc->data[SC_ARMOR_RESIST]->total_tick;
+					int sc_ttl = SC_ENTRY(sc, SC_ARMOR_RESIST)->total_tick;
 					clif->status_change_sub(bl, sc_icn, sc_typ, 1, sc_tck, sc_ttl, 0, 0, 0);
 				}
 			}
@@ -12310,7 +12467,7 @@ static int kaahi_heal_timer(int tid, int64 tick, int id, intptr_t data)
 	struct status_data *st;
 	int hp;
 
-	if ((bl=map->id2bl(id)) == NULL || (sc=status->get_sc(bl)) == NULL || (sce=sc->data[SC_KAAHI]) == NULL)
+	if ((bl=map->id2bl(id)) == NULL || (sc=status->get_sc(bl)) == NULL || (sce=SC_ENTRY(sc, SC_KAAHI)) == NULL)
 		return 0;
 
 	if(sce->val4 != tid) {
@@ -12334,6 +12491,32 @@ static int kaahi_heal_timer(int tid, int64 tick, int id, intptr_t data)
 	return 1;
 }
 
+/**
+ * Shows the status change timer counters and resets them.
+ *
+ * The timers of status changes due at the same tick share one timer heap
+ * entry (see timer->add_batch_func), the report shows how well they batch.
+ */
+static void status_change_tick_report(int64 tick)
+{
+	struct status_change_tick_stats *stats = &status->tick_stats;
+	struct timer_batch_stats batch;
+	int64 elapsed = DIFF_TICK(tick, stats->report_tick);
+
+	timer->batch_stats(&batch);
+	if (stats->ticks != 0 && elapsed > 0) {
+		uint64 batches = batch.batches - stats->batch.batches;
+		uint64 timers = batch.timers - stats->batch.timers;
+
+		ShowInfo("Status changes: %"PRIu64" timer runs (%"PRIu64"/s), %"PRIu64" expired (%"PRIu64"/s), %"PRIu64" timer batches, %"PRIu64".%02"PRIu64" timers per batch.\n",
+			stats->ticks, stats->ticks * 1000 / (uint64)elapsed, stats->expired, stats->expired * 1000 / (uint64)elapsed,
+			batches, batches != 0 ? timers / batches : 0, batches != 0 ? timers * 100 / batches % 100 : 0);
+	}
+	memset(stats, 0, sizeof(*stats));
+	stats->batch = batch;
+	stats->report_tick = tick;
+}
+
 /*==========================================
  * For recusive status, like for each 5s we drop sp etc.
  * Reseting the end timer.
@@ -12349,6 +12532,10 @@ static int status_change_timer(int tid, int64 tick, int id, intptr_t data)
 	struct status_change *sc;
 	struct status_change_entry *sce;
 
+	status->tick_stats.ticks++;
+	if (DIFF_TICK(tick, status->tick_stats.report_tick) >= STATUS_TICK_REPORT_INTERVAL)
+		status->change_tick_report(tick);
+
 	bl = map->id2bl(id);
 	if (!bl) {
 		ShowDebug("status_change_timer: Null pointer id: %d data: %"PRIdPTR"\n", id, data);
@@ -12357,7 +12544,7 @@ static int status_change_timer(int tid, int64 tick, int id, intptr_t data)
 	sc = status->get_sc(bl);
 	st = status->get_status_data(bl);
 
-	if (!sc || (sce = sc->data[type]) == NULL) {
+	if (!sc || (sce = SC_ENTRY(sc, type)) == NULL) {
 		ShowDebug("status_change_timer: Null pointer id: %d data: %"PRIdPTR" bl-type: %u\n", id, data, bl->type);
 		return 0;
 	}
@@ -12373,7 +12560,7 @@ static int status_change_timer(int tid, int64 tick, int id, intptr_t data)
 
 	// set the next timer of the sce (don't assume the status still exists)
 #define sc_timer_next(t,f,i,d) do { \
-	if ((sce=sc->data[type])) \
+	if ((sce=SC_ENTRY(sc, type))) \
 		sce->timer = timer->add((t),(f),(i),(d)); \
 	else \
 		ShowError("status_change_timer: Unexpected NULL status change id: %d data: %"PRIdPTR"\n", id, data); \
@@ -12393,9 +12580,9 @@ static int status_change_timer(int tid, int64 tick, int id, intptr_t data)
 			if(!status->charge(bl, 0, sce->val4))
 				break; //Not enough SP to continue.
 
-			if (!sc->data[SC_CHASEWALK2]) {
+			if (!SC_ENTRY(sc, SC_CHASEWALK2)) {
 				sc_start(bl, bl, SC_CHASEWALK2, 100, 1 << (sce->val1 - 1),
-					(sc->data[SC_SOULLINK] && sc->data[SC_SOULLINK]->val2 == SL_ROGUE ? 10 : 1) //SL bonus -> x10 duration
+					(SC_ENTRY(sc, SC_SOULLINK) && SC_ENTRY(sc, SC_SOULLINK)->val2 == SL_ROGUE ? 10 : 1) //SL bonus -> x10 duration
 					* skill->get_time2(status->sc2skill(type), sce->val1), status->sc2skill(type));
 			}
 			sc_timer_next(sce->val2+tick, status->change_timer, bl->id, data);
@@ -12454,7 +12641,7 @@ static int status_change_timer(int tid, int64 tick, int id, intptr_t data)
 				sc_timer_next(1000+tick, status->change_timer, bl->id, data );
 				status_calc_bl(bl, status->dbs->ChangeFlagTable[type]);
 				// Remove Lex Aeterna from BL_PC types
-				if (bl->type == BL_PC && sc->data[SC_LEXAETERNA] != NULL)
+				if (bl->type == BL_PC && SC_ENTRY(sc, SC_LEXAETERNA) != NULL)
 					status_change_end(bl, SC_LEXAETERNA, INVALID_TIMER);
 				return 0;
 			}
@@ -12472,7 +12659,7 @@ static int status_change_timer(int tid, int64 tick, int id, intptr_t data)
 			FALLTHROUGH
 		case SC_DPOISON:
 			if (--(sce->val3) > 0) {
-				if (sc->data[SC_SLOWPOISON] != NULL) {
+				if (SC_ENTRY(sc, SC_SLOWPOISON) != NULL) {
 					sc_timer_next(1000 + tick, status->change_timer, bl->id, data);
 					return 0;
 				}
@@ -12483,7 +12670,7 @@ static int status_change_timer(int tid, int64 tick, int id, intptr_t data)
 				}
 				map->freeblock_lock();
 				status_zap(bl, sce->val4, 0);
-				if (sc->data[type] != NULL) { // Check if the status still last (can be dead since then).
+				if (SC_ENTRY(sc, type) != NULL) { // Check if the status still last (can be dead since then).
 					sc_timer_next(1000 + tick, status->change_timer, bl->id, data);
 				}
 				map->freeblock_unlock();
@@ -12521,7 +12708,7 @@ static int status_change_timer(int tid, int64 tick, int id, intptr_t data)
 				}
 				map->freeblock_lock();
 				status_fix_damage(src, bl, sd || hp < st->hp ? hp : st->hp - 1, 1);
-				if( sc->data[type] ) {
+				if( SC_ENTRY(sc, type) ) {
 					if( st->hp == 1 ) {
 						map->freeblock_unlock();
 						break;
@@ -12618,7 +12805,7 @@ static int status_change_timer(int tid, int64 tick, int id, intptr_t data)
 					break;
 				}
 				if( s != 0 && sce->val3 % s == 0 ) {
-					if (sc->data[SC_LONGING])
+					if (SC_ENTRY(sc, SC_LONGING))
 						sp*= 3;
 					if (!status->charge(bl, 0, sp))
 						break;
@@ -12693,7 +12880,7 @@ static int status_change_timer(int tid, int64 tick, int id, intptr_t data)
 			break;
 
 		case SC_BLIND:
-			if(sc->data[SC_FOGWALL]) {
+			if(SC_ENTRY(sc, SC_FOGWALL)) {
 				//Blind lasts forever while you are standing on the fog.
 				sc_timer_next(5000+tick, status->change_timer, bl->id, data);
 				return 0;
@@ -12711,7 +12898,7 @@ static int status_change_timer(int tid, int64 tick, int id, intptr_t data)
 				map->freeblock_lock();
 				clif->damage(bl,bl,status_get_amotion(bl),status_get_dmotion(bl)+500,100,0,BDT_NORMAL,0);
 				status_fix_damage(NULL,bl,100,0);
-				if( sc->data[type] ) {
+				if( SC_ENTRY(sc, type) ) {
 					sc_timer_next(3000+tick,status->change_timer,bl->id,data);
 				}
 				map->freeblock_unlock();
@@ -12726,7 +12913,7 @@ static int status_change_timer(int tid, int64 tick, int id, intptr_t data)
 				unit->skillcastcancel(bl,2);
 				map->freeblock_lock();
 				status->damage(bl, bl, damage, 0, clif->damage(bl,bl,status_get_amotion(bl),status_get_dmotion(bl)+500,damage,1,BDT_NORMAL,0), 1);
-				if( sc->data[type] ) {
+				if( SC_ENTRY(sc, type) ) {
 					sc_timer_next(1000 + tick, status->change_timer, bl->id, data );
 				}
 				map->freeblock_unlock();
@@ -12744,7 +12931,7 @@ static int status_change_timer(int tid, int64 tick, int id, intptr_t data)
 				if( damage > 0 ) { // 3% Damage each 4 seconds
 					map->freeblock_lock();
 					status_zap(bl,damage,0);
-					flag = !sc->data[type]; // Killed? Should not
+					flag = !SC_ENTRY(sc, type); // Killed? Should not
 					map->freeblock_unlock();
 				}
 
@@ -12764,7 +12951,7 @@ static int status_change_timer(int tid, int64 tick, int id, intptr_t data)
 					}
 
 					clif->emotion(bl,E_HEH);
-					if( sc->data[type] )
+					if( SC_ENTRY(sc, type) )
 						sc_timer_next(4000+tick,status->change_timer,bl->id,data);
 
 					map->freeblock_unlock();
@@ -12779,7 +12966,7 @@ static int status_change_timer(int tid, int64 tick, int id, intptr_t data)
 				map->freeblock_lock();
 				clif->damage(bl,bl,status_get_amotion(bl),1,1,0,BDT_NORMAL,0);
 				status->damage(NULL, bl, 1, st->max_sp * 3 / 100, 0, 0); //cancel dmg only if cancelable
-				if( sc->data[type] ) {
+				if( SC_ENTRY(sc, type) ) {
 					sc_timer_next(10000 + tick, status->change_timer, bl->id, data );
 				}
 				map->freeblock_unlock();
@@ -12813,12 +13000,12 @@ static int status_change_timer(int tid, int64 tick, int id, intptr_t data)
 		case SC_RENOVATIO:
 			if (--(sce->val4) > 0 ){
 				int heal = st->max_hp * 3 / 100;
-				if (sc->count && sc->data[SC_AKAITSUKI] && heal)
+				if (sc->count && SC_ENTRY(sc, SC_AKAITSUKI) && heal)
 					heal = ~heal + 1;
 
 				map->freeblock_lock();
 				status->heal(bl, heal, 0, STATUS_HEAL_SHOWEFFECT);
-				if( sc->data[type] ) {
+				if( SC_ENTRY(sc, type) ) {
 					sc_timer_next(5000 + tick, status->change_timer, bl->id, data);
 				}
 				map->freeblock_unlock();
@@ -12836,7 +13023,7 @@ static int status_change_timer(int tid, int64 tick, int id, intptr_t data)
 				clif->damage(bl,bl,0,0,damage,1,BDT_MULTIENDURE,0); //damage is like endure effect with no walk delay
 				status->damage(src, bl, damage, 0, 0, 1);
 
-				if( sc->data[type]){ // Target still lives. [LimitLine]
+				if( SC_ENTRY(sc, type)){ // Target still lives. [LimitLine]
 					sc_timer_next(3000 + tick, status->change_timer, bl->id, data);
 				}
 				map->freeblock_unlock();
@@ -12937,7 +13124,7 @@ static int status_change_timer(int tid, int64 tick, int id, intptr_t data)
 				damage =  sce->val3;
 				status->damage(src, bl, damage, 0, clif->damage(bl,bl,st->amotion,st->dmotion+200,damage,1,BDT_NORMAL,0), 1);
 				unit->skillcastcancel(bl,1);
-				if ( sc->data[type] ) {
+				if ( SC_ENTRY(sc, type) ) {
 					sc_timer_next(1000 + tick, status->change_timer, bl->id, data);
 				}
 				status->heal(src, damage*(5 + 5 * sce->val1)/100, 0, STATUS_HEAL_DEFAULT); // 5 + 5% per level
@@ -12954,7 +13141,7 @@ static int status_change_timer(int tid, int64 tick, int id, intptr_t data)
 				clif->damage(bl, bl, 0, 0, damage, 1, BDT_MULTIENDURE, 0);
 				status->damage(src, bl, damage, 0, 0, 1);
 
-				if( sc->data[type] ) {
+				if( SC_ENTRY(sc, type) ) {
 					sc_timer_next(2000 + tick, status->change_timer, bl->id, data);
 				}
 				map->freeblock_unlock();
@@ -13065,7 +13252,7 @@ static int status_change_timer(int tid, int64 tick, int id, intptr_t data)
 				if( damage >= st->hp ) damage = st->hp - 1; // Do not kill, just keep you with 1 hp minimum
 				map->freeblock_lock();
 				status_fix_damage(NULL,bl,damage,clif->damage(bl,bl,0,0,damage,0,BDT_NORMAL,0));
-				if( sc->data[type] ) {
+				if( SC_ENTRY(sc, type) ) {
 					sc_timer_next(1000 + tick, status->change_timer, bl->id, data);
 				}
 				map->freeblock_unlock();
@@ -13083,7 +13270,7 @@ static int status_change_timer(int tid, int64 tick, int id, intptr_t data)
 				} else {
 					struct block_list *src = map->id2bl(sce->val2);
 					struct status_change *ssc;
-					if( !src || (ssc = status->get_sc(src)) == NULL || !ssc->data[SC_MAGNETICFIELD] )
+					if( !src || (ssc = status->get_sc(src)) == NULL || !SC_ENTRY(ssc, SC_MAGNETICFIELD) )
 						break; // Source no more under Magnetic Field
 				}
 				sc_timer_next(1000 + tick, status->change_timer, bl->id, data);
@@ -13101,7 +13288,7 @@ static int status_change_timer(int tid, int64 tick, int id, intptr_t data)
 				if( !status->charge(bl,0,sp) )
 					break;
 
-				if( !sc->data[SC_STEALTHFIELD_MASTER] )
+				if( !SC_ENTRY(sc, SC_STEALTHFIELD_MASTER) )
 					break;
 
 				sc_timer_next((2000 + 1000 * sce->val1)+tick,status->change_timer,bl->id, data);
@@ -13124,7 +13311,7 @@ static int status_change_timer(int tid, int64 tick, int id, intptr_t data)
 		case SC_RAISINGDRAGON:
 			// 1% every 5 seconds [Jobbie]
 			if( --(sce->val3)>0 && status->charge(bl, sce->val2, 0) ) {
-				if( !sc->data[type] ) return 0;
+				if( !SC_ENTRY(sc, type) ) return 0;
 				sc_timer_next(5000 + tick, status->change_timer, bl->id, data);
 				return 0;
 			}
@@ -13305,6 +13492,7 @@ static int status_change_timer(int tid, int64 tick, int id, intptr_t data)
 	PRAGMA_GCC46(GCC diagnostic pop)
 
 	// default for all non-handled control paths is to end the status
+	status->tick_stats.expired++;
 	return status_change_end( bl,type,tid );
 #undef sc_timer_next
 }
@@ -13332,8 +13520,8 @@ static int status_change_timer_sub(struct block_list *bl, va_list ap)
 	PRAGMA_GCC46(GCC diagnostic ignored "-Wswitch-enum")
 	switch( type ) {
 		case SC_SIGHT: /* Reveal hidden ennemy on 3*3 range */
-			if( tsc && tsc->data[SC__SHADOWFORM] && (sce && sce->val4 >0 && sce->val4%2000 == 0) && // for every 2 seconds do the checking
-				rnd()%100 < 100-tsc->data[SC__SHADOWFORM]->val1*10 ) // [100 - (Skill Level x 10)] %
+			if( tsc && SC_ENTRY(tsc, SC__SHADOWFORM) && (sce && sce->val4 >0 && sce->val4%2000 == 0) && // for every 2 seconds do the checking
+				rnd()%100 < 100-SC_ENTRY(tsc, SC__SHADOWFORM)->val1*10 ) // [100 - (Skill Level x 10)] %
 				status_change_end(bl, SC__SHADOWFORM, INVALID_TIMER);
 			/* Fall through */
 		case SC_CONCENTRATION:
@@ -13344,8 +13532,8 @@ static int status_change_timer_sub(struct block_list *bl, va_list ap)
 			status_change_end(bl, SC_NEWMOON, INVALID_TIMER);
 			break;
 		case SC_RUWACH: /* Reveal hidden target and deal little dammages if ennemy */
-			if (tsc && (tsc->data[SC_HIDING] || tsc->data[SC_CLOAKING] ||
-				tsc->data[SC_CAMOUFLAGE] || tsc->data[SC_CLOAKINGEXCEED] || tsc->data[SC_NEWMOON])) {
+			if (tsc && (SC_ENTRY(tsc, SC_HIDING) || SC_ENTRY(tsc, SC_CLOAKING) ||
+				SC_ENTRY(tsc, SC_CAMOUFLAGE) || SC_ENTRY(tsc, SC_CLOAKINGEXCEED) || SC_ENTRY(tsc, SC_NEWMOON))) {
 					status_change_end(bl, SC_HIDING, INVALID_TIMER);
 					status_change_end(bl, SC_CLOAKING, INVALID_TIMER);
 					status_change_end(bl, SC_CAMOUFLAGE, INVALID_TIMER);
@@ -13354,8 +13542,8 @@ static int status_change_timer_sub(struct block_list *bl, va_list ap)
 					if(battle->check_target( src, bl, BCT_ENEMY ) > 0)
 						skill->attack(BF_MAGIC,src,src,bl,AL_RUWACH,1,tick,0);
 			}
-			if( tsc && tsc->data[SC__SHADOWFORM] && (sce && sce->val4 >0 && sce->val4%2000 == 0) && // for every 2 seconds do the checking
-				rnd()%100 < 100-tsc->data[SC__SHADOWFORM]->val1*10 ) // [100 - (Skill Level x 10)] %
+			if( tsc && SC_ENTRY(tsc, SC__SHADOWFORM) && (sce && sce->val4 >0 && sce->val4%2000 == 0) && // for every 2 seconds do the checking
+				rnd()%100 < 100-SC_ENTRY(tsc, SC__SHADOWFORM)->val1*10 ) // [100 - (Skill Level x 10)] %
 				status_change_end(bl, SC__SHADOWFORM, INVALID_TIMER);
 			break;
 		case SC_WZ_SIGHTBLASTER:
@@ -13377,14 +13565,14 @@ static int status_change_timer_sub(struct block_list *bl, va_list ap)
 			break;
 		case SC_RG_CCONFINE_M:
 			//Lock char has released the hold on everyone...
-			if (tsc != NULL && src != NULL && tsc->data[SC_RG_CCONFINE_S] && tsc->data[SC_RG_CCONFINE_S]->val2 == src->id) {
-				tsc->data[SC_RG_CCONFINE_S]->val2 = 0;
+			if (tsc != NULL && src != NULL && SC_ENTRY(tsc, SC_RG_CCONFINE_S) && SC_ENTRY(tsc, SC_RG_CCONFINE_S)->val2 == src->id) {
+				SC_ENTRY(tsc, SC_RG_CCONFINE_S)->val2 = 0;
 				status_change_end(bl, SC_RG_CCONFINE_S, INVALID_TIMER);
 			}
 			break;
 		case SC_CURSEDCIRCLE_TARGET:
-			if (tsc != NULL && src != NULL && tsc->data[SC_CURSEDCIRCLE_TARGET] && tsc->data[SC_CURSEDCIRCLE_TARGET]->val2 == src->id) {
-				clif->bladestop(bl, tsc->data[SC_CURSEDCIRCLE_TARGET]->val2, 0);
+			if (tsc != NULL && src != NULL && SC_ENTRY(tsc, SC_CURSEDCIRCLE_TARGET) && SC_ENTRY(tsc, SC_CURSEDCIRCLE_TARGET)->val2 == src->id) {
+				clif->bladestop(bl, SC_ENTRY(tsc, SC_CURSEDCIRCLE_TARGET)->val2, 0);
 				status_change_end(bl, type, INVALID_TIMER);
 			}
 			break;
@@ -13515,8 +13703,8 @@ static void status_get_matk_sub(struct block_list *bl, int flag, unsigned short
 			if ( (st->rhw.matk + st->lhw.matk) > 0 ) {
 				int wMatk = st->rhw.matk + st->lhw.matk; // Left and right matk stacks
 				int variance = wMatk * st->rhw.wlv / 10; // Only use right hand weapon level
-				if (sc != NULL && sc->data[SC_CATNIPPOWDER])
-					wMatk -= wMatk * sc->data[SC_CATNIPPOWDER]->val2 / 100;
+				if (sc != NULL && SC_ENTRY(sc, SC_CATNIPPOWDER))
+					wMatk -= wMatk * SC_ENTRY(sc, SC_CATNIPPOWDER)->val2 / 100;
 				*matk_min += wMatk - variance;
 				*matk_max += wMatk + variance;
 			}
@@ -13564,7 +13752,7 @@ static void status_get_matk_sub(struct block_list *bl, int flag, unsigned short
 	}
 
 	if ( (bl->type&BL_HOM && battle_config.hom_setting & 0x20)  //Hom Min Matk is always the same as Max Matk
-		|| (sc && sc->data[SC_RECOGNIZEDSPELL]) )
+		|| (sc && SC_ENTRY(sc, SC_RECOGNIZEDSPELL)) )
 		*matk_min = *matk_max;
 
 #ifdef RENEWAL
@@ -13688,8 +13876,8 @@ static int status_change_clear_buffs(struct block_list *bl, int type)
 		for (i = SC_COMMON_MIN; i <= SC_COMMON_MAX; i++)
 			status_change_end(bl, (sc_type)i, INVALID_TIMER);
 
-	for( i = SC_COMMON_MAX+1; i < SC_MAX; i++ ) {
-		if( !sc->data[i] || !status->get_sc_type(i) )
+	for (i = status->change_next(sc, SC_COMMON_MAX); i < SC_MAX; i = status->change_next(sc, i)) {
+		if( !status->get_sc_type(i) )
 			continue;
 
 		if( type&3 && !(status->get_sc_type(i)&SC_BUFF) && !(status->get_sc_type(i)&SC_DEBUFF) )
@@ -13723,7 +13911,7 @@ static int status_change_clear_buffs(struct block_list *bl, int type)
 		case SC_BERSERK:
 			if(type&4)
 				continue;
-			sc->data[i]->val2 = 0;
+			SC_ENTRY(sc, i)->val2 = 0;
 			break;
 		default:
 			if(type&4)
@@ -13751,8 +13939,8 @@ static int status_change_spread(struct block_list *src, struct block_list *bl, i
 
 	tick = timer->gettick();
 
-	for( i = SC_COMMON_MIN; i < SC_MAX; i++ ) {
-		if( !sc->data[i] || i == SC_COMMON_MAX )
+	STATUS_CHANGE_ITER(sc, i) {
+		if( i == SC_COMMON_MAX )
 			continue;
 
 		PRAGMA_GCC46(GCC diagnostic push)
@@ -13783,8 +13971,8 @@ static int status_change_spread(struct block_list *src, struct block_list *bl, i
 		case SC_VENOMBLEED:
 		case SC_DEATHHURT:
 		case SC_PARALYSE:
-			if( sc->data[i]->timer != INVALID_TIMER ) {
-				const struct TimerData *td = timer->get(sc->data[i]->timer);
+			if( SC_ENTRY(sc, i)->timer != INVALID_TIMER ) {
+				const struct TimerData *td = timer->get(SC_ENTRY(sc, i)->timer);
 				if (td == NULL || td->func != status->change_timer || DIFF_TICK(td->tick,tick) < 0)
 					continue;
 				data.tick = DIFF_TICK32(td->tick,tick);
@@ -13795,35 +13983,35 @@ static int status_change_spread(struct block_list *src, struct block_list *bl, i
 			// Special cases
 		case SC_POISON:
 		case SC_DPOISON:
-			data.tick = sc->data[i]->val3 * 1000;
+			data.tick = SC_ENTRY(sc, i)->val3 * 1000;
 			break;
 		case SC_FEAR:
 		case SC_LEECHESEND:
-			data.tick = sc->data[i]->val4 * 1000;
+			data.tick = SC_ENTRY(sc, i)->val4 * 1000;
 			break;
 		case SC_BURNING:
-			data.tick = sc->data[i]->val4 * 2000;
+			data.tick = SC_ENTRY(sc, i)->val4 * 2000;
 			break;
 		case SC_PYREXIA:
 		case SC_OBLIVIONCURSE:
-			data.tick = sc->data[i]->val4 * 3000;
+			data.tick = SC_ENTRY(sc, i)->val4 * 3000;
 			break;
 		case SC_MAGICMUSHROOM:
-			data.tick = sc->data[i]->val4 * 4000;
+			data.tick = SC_ENTRY(sc, i)->val4 * 4000;
 			break;
 		case SC_TOXIN:
 		case SC_BLOODING:
-			data.tick = sc->data[i]->val4 * 10000;
+			data.tick = SC_ENTRY(sc, i)->val4 * 10000;
 			break;
 		default:
 			continue;
 		}
 		PRAGMA_GCC46(GCC diagnostic pop)
 		if( i ) {
-			data.val1 = sc->data[i]->val1;
-			data.val2 = sc->data[i]->val2;
-			data.val3 = sc->data[i]->val3;
-			data.val4 = sc->data[i]->val4;
+			data.val1 = SC_ENTRY(sc, i)->val1;
+			data.val2 = SC_ENTRY(sc, i)->val2;
+			data.val3 = SC_ENTRY(sc, i)->val3;
+			data.val4 = SC_ENTRY(sc, i)->val4;
 			status->change_start(src, bl, (sc_type)i, 10000, data.val1, data.val2, data.val3, data.val4, data.tick, SCFLAG_NOAVOID | SCFLAG_FIXEDTICK | SCFLAG_FIXEDRATE, skill_id);
 			flag = 1;
 		}
@@ -13861,7 +14049,7 @@ static int status_natural_heal(struct block_list *bl, va_list args)
 
 	if (flag
 	  && (status->isdead(bl)
-	    || (sc && (sc->option&(OPTION_HIDE|OPTION_CLOAK|OPTION_CHASEWALK) || sc->data[SC__INVISIBILITY]))
+	    || (sc && (sc->option&(OPTION_HIDE|OPTION_CLOAK|OPTION_CHASEWALK) || SC_ENTRY(sc, SC__INVISIBILITY)))
 	     )
 	)
 		flag=0;
@@ -13937,7 +14125,7 @@ static int status_natural_heal(struct block_list *bl, va_list args)
 		flag = 0;
 
 		// SC_TENSIONRELAX allows HP to be recovered even when overweight. [csnv]
-		if (sc != NULL && sc->data[SC_TENSIONRELAX] != NULL)
+		if (sc != NULL && SC_ENTRY(sc, SC_TENSIONRELAX) != NULL)
 			flag |= RGN_HP | RGN_SHP;
 	}
 
@@ -14073,12 +14261,161 @@ static int status_natural_heal(struct block_list *bl, va_list args)
 	return flag;
 }
 
+/// Calls status->natural_heal, which takes a va_list.
+static int status_natural_heal_sub(struct block_list *bl, ...)
+{
+	va_list args;
+	int ret;
+
+	va_start(args, bl);
+	ret = status->natural_heal(bl, args);
+	va_end(args);
+	return ret;
+}
+
+/**
+ * Runs the natural regeneration of the units of status->regen_table.
+ *
+ * The units that can't regenerate this pass (full or blocked HP and SP, no
+ * HP/SP loss or regen bonus) are the large majority, and status->natural_heal
+ * does nothing on them: they are filtered out with a dense loop over copies of
+ * their HP/SP, and status->natural_heal only runs on the others, so that only
+ * the units which actually heal send client updates.
+ *
+ * @return The number of units status->natural_heal ran on.
+ */
+static int status_natural_heal_pass(void)
+{
+	struct status_regen_table *table = &status->regen_table;
+	int count = table->count;
+	int i;
+
+	// Gather the current HP/SP of the units
+	for (i = 0; i < count; i++) {
+		const struct status_data *st = table->st[i];
+		const struct regen_data *regen = table->regen[i];
+		const struct map_session_data *sd = table->sd[i];
+
+		table->hp[i] = st->hp;
+		table->max_hp[i] = st->max_hp;
+		table->sp[i] = st->sp;
+		table->max_sp[i] = st->max_sp;
+		table->flag[i] = (uint8)regen->flag;
+		table->block[i] = (uint8)regen->state.block;
+		table->extra[i] = (sd != NULL && (sd->hp_loss.value != 0 || sd->sp_loss.value != 0 || sd->hp_regen.value != 0 || sd->sp_regen.value != 0)) ? 1 : 0;
+	}
+
+	// Same masks as the beginning of status_natural_heal, branchless
+	for (i = 0; i < count; i++) {
+		uint8 flag = table->flag[i];
+		uint8 hp_off = (flag & RGN_HP) != 0 && (table->hp[i] >= table->max_hp[i] || (table->block[i] & 1) != 0);
+		uint8 sp_off = (flag & RGN_SP) != 0 && (table->sp[i] >= table->max_sp[i] || (table->block[i] & 2) != 0);
+
+		flag &= hp_off ? ~(RGN_HP | RGN_SHP) : 0xFF;
+		flag &= sp_off ? ~(RGN_SP | RGN_SSP) : 0xFF;
+		table->flag[i] = flag | table->extra[i];
+	}
+
+	table->candidate_count = 0;
+	for (i = 0; i < count; i++) {
+		if (table->flag[i] != 0) {
+			table->candidates[table->candidate_count] = i;
+			table->candidate_ids[table->candidate_count] = table->bl[i]->id;
+			table->candidate_count++;
+		}
+	}
+
+	for (i = 0; i < table->candidate_count; i++) {
+		int index = table->candidates[i];
+
+		// status->natural_heal may remove units from the table, the units
+		// swapped in their place skip this pass.
+		if (index >= table->count || table->bl[index]->id != table->candidate_ids[i])
+			continue;
+		status_natural_heal_sub(table->bl[index]);
+	}
+	return table->candidate_count;
+}
+
+/// Grows the arrays of status->regen_table.
+static void status_regen_table_grow(struct status_regen_table *table)
+{
+	nullpo_retv(table);
+
+	table->max += 256;
+	RECREATE(table->bl, struct block_list *, table->max);
+	RECREATE(table->st, struct status_data *, table->max);
+	RECREATE(table->regen, struct regen_data *, table->max);
+	RECREATE(table->sd, struct map_session_data *, table->max);
+	RECREATE(table->hp, unsigned int, table->max);
+	RECREATE(table->max_hp, unsigned int, table->max);
+	RECREATE(table->sp, unsigned int, table->max);
+	RECREATE(table->max_sp, unsigned int, table->max);
+	RECREATE(table->flag, uint8, table->max);
+	RECREATE(table->block, uint8, table->max);
+	RECREATE(table->extra, uint8, table->max);
+	RECREATE(table->candidates, int, table->max);
+	RECREATE(table->candidate_ids, int, table->max);
+}
+
+/// Adds a unit with natural regeneration to status->regen_table.
+static void status_regen_add(struct block_list *bl)
+{
+	struct status_regen_table *table = &status->regen_table;
+	struct regen_data *regen;
+	int index;
+
+	nullpo_retv(bl);
+	if ((regen = status->get_regen_data(bl)) == NULL)
+		return;
+
+	index = regen->table_index;
+	if (index >= 0 && index < table->count && table->bl[index] == bl)
+		return; // Already in the table
+
+	if (table->count == table->max)
+		status_regen_table_grow(table);
+	index = table->count++;
+	table->bl[index] = bl;
+	table->st[index] = status->get_status_data(bl);
+	table->regen[index] = regen;
+	table->sd[index] = BL_CAST(BL_PC, bl);
+	regen->table_index = index;
+}
+
+/// Removes a unit from status->regen_table, the last unit takes its place.
+static void status_regen_remove(struct block_list *bl)
+{
+	struct status_regen_table *table = &status->regen_table;
+	struct regen_data *regen;
+	int index, last;
+
+	nullpo_retv(bl);
+	if ((regen = status->get_regen_data(bl)) == NULL)
+		return;
+
+	index = regen->table_index;
+	if (index < 0 || index >= table->count || table->bl[index] != bl)
+		return; // Not in the table
+
+	last = --table->count;
+	if (index != last) {
+		table->bl[index] = table->bl[last];
+		table->st[index] = table->st[last];
+		table->regen[index] = table->regen[last];
+		table->sd[index] = table->sd[last];
+		table->regen[index]->table_index = index;
+	}
+	table->bl[last] = NULL;
+	regen->table_index = -1;
+}
+
 //Natural heal main timer.
 static int status_natural_heal_timer(int tid, int64 tick, int id, intptr_t data)
 {
 	// This difference is always positive and lower than UINT_MAX (~24 days)
 	status->natural_heal_diff_tick = (unsigned int)cap_value(DIFF_TICK(tick,status->natural_heal_prev_tick), 0, UINT_MAX);
-	map->foreachregen(status->natural_heal);
+	status->natural_heal_pass();
 	status->natural_heal_prev_tick = tick;
 	return 0;
 }
@@ -15017,12 +15354,14 @@ static int do_init_status(bool minimal)
 	VECTOR_INIT(status->unit_params_groups);
 
 	timer->add_func_list(status->change_timer,"status_change_timer");
+	timer->add_batch_func(status->change_timer);
 	timer->add_func_list(status->kaahi_heal_timer,"status_kaahi_heal_timer");
 	timer->add_func_list(status->natural_heal_timer,"status_natural_heal_timer");
 	status->initChangeTables();
 	status->initDummyData();
 	status->readdb();
 	status->natural_heal_prev_tick = timer->gettick();
+	status->change_tick_report(status->natural_heal_prev_tick);
 	status->data_ers = ers_new(sizeof(struct status_change_entry),"status.c::data_ers",ERS_OPT_NONE);
 	timer->add_interval(status->natural_heal_prev_tick + NATURAL_HEAL_INTERVAL, status->natural_heal_timer, 0, 0, NATURAL_HEAL_INTERVAL);
 	return 0;
@@ -15030,7 +15369,22 @@ static int do_init_status(bool minimal)
 
 static void do_final_status(void)
 {
+	status->change_tick_report(timer->gettick());
 	ers_destroy(status->data_ers);
+	aFree(status->regen_table.bl);
+	aFree(status->regen_table.st);
+	aFree(status->regen_table.regen);
+	aFree(status->regen_table.sd);
+	aFree(status->regen_table.hp);
+	aFree(status->regen_table.max_hp);
+	aFree(status->regen_table.sp);
+	aFree(status->regen_table.max_sp);
+	aFree(status->regen_table.flag);
+	aFree(status->regen_table.block);
+	aFree(status->regen_table.extra);
+	aFree(status->regen_table.candidates);
+	aFree(status->regen_table.candidate_ids);
+	memset(&status->regen_table, 0, sizeof(status->regen_table));
 
 	status->unit_params_destroy_entry(&status->dummy_unit_params);
 	status->unit_params_clear_db();
@@ -15060,6 +15414,9 @@ void status_defaults(void)
 	memset(&status->dummy_unit_params, 0, sizeof(status->dummy_unit_params));
 	status->natural_heal_prev_tick = 0;
 	status->natural_heal_diff_tick = 0;
+	memset(&status->tick_stats, 0, sizeof(status->tick_stats));
+	status->last_version = 0;
+	memset(&status->regen_table, 0, sizeof(status->regen_table));
 	/* funcs */
 	// for looking up associated data
 	status->sc2skill = status_sc2skill;
@@ -15097,6 +15454,12 @@ void status_defaults(void)
 	status->get_viewdata = status_get_viewdata;
 	status->set_viewdata = status_set_viewdata;
 	status->change_init = status_change_init;
+	status->change_slot_find = status_change_slot_find;
+	status->change_slot_set = status_change_slot_set;
+	status->change_slot_clear = status_change_slot_clear;
+	status->bump_version = status_bump_version;
+	status->change_slots_release = status_change_slots_release;
+	status->change_next = status_change_next;
 	status->get_sc = status_get_sc;
 
 	status->isdead = status_isdead;
@@ -15110,6 +15473,7 @@ void status_defaults(void)
 	status->kaahi_heal_timer = kaahi_heal_timer;
 	status->change_timer = status_change_timer;
 	status->change_timer_sub = status_change_timer_sub;
+	status->change_tick_report = status_change_tick_report;
 	status->change_clear = status_change_clear;
 	status->change_clear_buffs = status_change_clear_buffs;
 
@@ -15209,6 +15573,9 @@ void status_defaults(void)
 	status->natural_heal = status_natural_heal;
 	status->load_sc_type = status_load_sc_type;
 	status->natural_heal_timer = status_natural_heal_timer;
+	status->regen_add = status_regen_add;
+	status->regen_remove = status_regen_remove;
+	status->natural_heal_pass = status_natural_heal_pass;
 	status->readdb_job2 = status_readdb_job2;
 	status->readdb_sizefix = status_readdb_sizefix;
 	status->read_scdb_libconfig = status_read_scdb_libconfig;
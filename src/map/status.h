@@ -23,16 +23,20 @@
 
 #include "common/hercules.h"
 #include "common/mmo.h" // NEW_CARTS
+#include "common/timer.h" // struct timer_batch_stats
 
 struct block_list;
 struct config_setting_t;
 struct elemental_data;
 struct homun_data;
+struct map_session_data;
 struct mercenary_data;
 struct mob_data;
 struct npc_data;
 struct pet_data;
 
+#define STATUS_TICK_REPORT_INTERVAL 600000 ///< Interval of the status change timer statistics report, in ms
+
 //Change the equation when the values are high enough to discard the
 //imprecision in exchange of overflow protection [Skotlex]
 //Also add 100% checks since those are the most used cases where we don't
@@ -1251,6 +1255,36 @@ struct regen_data {
 	//skill-regen, sitting-skill-regen (since not all chars with regen need it)
 	struct regen_data_sub *skill;
 	struct regen_data_sub *sitting;
+
+	int table_index; ///< Index in status->regen_table, valid only if the table entry is this unit
+};
+
+/**
+ * Units with natural regeneration (BL_REGEN), in structure-of-arrays layout.
+ *
+ * The first arrays are kept in sync by status->regen_add / status->regen_remove,
+ * the others are working arrays of status->natural_heal_pass: each pass copies
+ * the HP/SP of every unit into them, finds the units that can regenerate with
+ * a dense loop and runs status->natural_heal only on those.
+ */
+struct status_regen_table {
+	int count;
+	int max;
+	struct block_list **bl;
+	struct status_data **st;
+	struct regen_data **regen;
+	struct map_session_data **sd;  ///< NULL for non-player units
+	/* working arrays */
+	unsigned int *hp;
+	unsigned int *max_hp;
+	unsigned int *sp;
+	unsigned int *max_sp;
+	uint8 *flag;                   ///< regen_data flag (RGN_*)
+	uint8 *block;                  ///< regen_data state.block
+	uint8 *extra;                  ///< Player with HP/SP loss or regen bonuses
+	int *candidates;               ///< Indexes of the units that can regenerate
+	int *candidate_ids;            ///< Block ids of the candidates
+	int candidate_count;
 };
 
 struct sc_display_entry {
@@ -1265,6 +1299,23 @@ struct status_change_entry {
 	bool infinite_duration;
 };
 
+/// Status change timer counters, reported every STATUS_TICK_REPORT_INTERVAL.
+struct status_change_tick_stats {
+	uint64 ticks;                   ///< status_change_timer runs
+	uint64 expired;                 ///< Status changes ended by their timer
+	struct timer_batch_stats batch; ///< timer->batch_stats at the last report
+	int64 report_tick;
+};
+
+/// Number of status changes a unit holds without allocating (see struct status_change).
+#define STATUS_CHANGE_INLINE_SLOTS 4
+
+/// Active status change of a unit.
+struct status_change_slot {
+	int type;                          ///< sc_type
+	struct status_change_entry *entry;
+};
+
 struct status_change {
 	unsigned int option;// effect state (bitfield)
 	unsigned int opt3;// skill state (bitfield)
@@ -1283,9 +1334,63 @@ struct status_change {
 #endif
 	unsigned char bs_counter; // Blood Sucker counter
 	unsigned char fv_counter; // Force of vanguard counter
-	struct status_change_entry *data[SC_MAX];
+	/**
+	 * Active status changes sorted by type, read through SC_ENTRY() and
+	 * written only by status->change_slot_set/change_slot_clear.
+	 * The first STATUS_CHANGE_INLINE_SLOTS are kept in inline_slots, a unit
+	 * with more moves them to a heap block (slots) given back with its last
+	 * status change.
+	 */
+	struct status_change_slot inline_slots[STATUS_CHANGE_INLINE_SLOTS];
+	struct status_change_slot *slots; ///< Heap block of slot_max slots, NULL when inline_slots is used
+	unsigned short slot_count;
+	unsigned short slot_max;
+	unsigned int version; ///< Changes whenever the unit's status is recalculated or a status change starts or ends, 0 = never (see status->bump_version)
 };
 
+/**
+ * Finds the active entry of a status change of a unit.
+ *
+ * @param sc   The unit's status changes.
+ * @param type The status change type.
+ * @return The entry, NULL if the status change isn't active.
+ * @see SC_ENTRY
+ */
+static inline struct status_change_entry *status_change_entry_(const struct status_change *sc, int type) __attribute__((pure, unused));
+static inline struct status_change_entry *status_change_entry_(const struct status_change *sc, int type)
+{
+	const struct status_change_slot *slots;
+	int lo = 0, hi = sc->slot_count;
+
+	if (hi == 0)
+		return NULL;
+	slots = sc->slots != NULL ? sc->slots : sc->inline_slots;
+	while (lo < hi) {
+		int mid = (lo + hi) / 2;
+		if (slots[mid].type < type)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	if (lo < sc->slot_count && slots[lo].type == type)
+		return slots[lo].entry;
+	return NULL;
+}
+
+/**
+ * Entry of a status change active on a unit (struct status_change_entry *),
+ * NULL if it isn't active. Not an lvalue, see status->change_slot_set.
+ */
+#define SC_ENTRY(sc, type) (status_change_entry_((sc), (type)))
+
+/**
+ * Iterates over the status changes active on a unit, in sc_type order.
+ *
+ * Status changes may be started or ended in the loop body.
+ */
+#define STATUS_CHANGE_ITER(sc, type) \
+	for ((type) = status->change_next((sc), SC_NONE); (type) < SC_MAX; (type) = status->change_next((sc), (type)))
+
 
 //Define for standard HP damage attacks.
 #define status_fix_damage(src, target, hp, walkdelay) (status->damage((src), (target), (hp), 0, (walkdelay), 0))
@@ -1416,6 +1521,9 @@ struct status_interface {
 	struct s_unit_params dummy_unit_params;
 	int64 natural_heal_prev_tick;
 	unsigned int natural_heal_diff_tick;
+	struct status_change_tick_stats tick_stats;
+	struct status_regen_table regen_table;
+	unsigned int last_version; ///< Last status version given to a unit
 	/* */
 	int (*init) (bool minimal);
 	void (*final) (void);
@@ -1455,6 +1563,12 @@ struct status_interface {
 	void (*set_viewdata) (struct block_list *bl, int class_);
 	void (*change_init) (struct block_list *bl);
 	struct status_change * (*get_sc) (struct block_list *bl);
+	int (*change_slot_find) (const struct status_change *sc, int type);
+	void (*change_slot_set) (struct status_change *sc, enum sc_type type, struct status_change_entry *sce);
+	void (*change_slot_clear) (struct status_change *sc, enum sc_type type);
+	void (*bump_version) (struct status_change *sc);
+	void (*change_slots_release) (struct status_change *sc);
+	int (*change_next) (const struct status_change *sc, int type);
 	int (*isdead) (struct block_list *bl);
 	int (*isimmune) (struct block_list *bl);
 	int (*get_sc_def) (struct block_list *src, struct block_list *bl, enum sc_type type, int rate, int tick, int flag, int skill_id);
@@ -1472,6 +1586,7 @@ struct status_interface {
 	int (*kaahi_heal_timer) (int tid, int64 tick, int id, intptr_t data);
 	int (*change_timer) (int tid, int64 tick, int id, intptr_t data);
 	int (*change_timer_sub) (struct block_list* bl, va_list ap);
+	void (*change_tick_report) (int64 tick);
 	int (*change_clear) (struct block_list* bl, int type);
 	int (*change_clear_buffs) (struct block_list* bl, int type);
 	void (*calc_bl_) (struct block_list *bl, e_scb_flag flag, enum e_status_calc_opt opt);
@@ -1553,6 +1668,9 @@ struct status_interface {
 	void (*display_remove) (struct map_session_data *sd, enum sc_type type);
 	int (*natural_heal) (struct block_list *bl, va_list args);
 	int (*natural_heal_timer) (int tid, int64 tick, int id, intptr_t data);
+	void (*regen_add) (struct block_list *bl);
+	void (*regen_remove) (struct block_list *bl);
+	int (*natural_heal_pass) (void);
 	void (*load_sc_type) (void);
 	bool (*readdb_job2) (char *fields[], int columns, int current);
 	bool (*readdb_sizefix) (char *fields[], int columns, int current);
@@ -23,6 +23,7 @@
 #include "config/core.h" // RENEWAL_CAST
 #include "unit.h"
 
+#include "map/achievement.h"
 #include "map/battle.h"
 #include "map/battleground.h"
 #include "map/chat.h"
@@ -43,6 +44,7 @@
 #include "map/path.h"
 #include "map/pc.h"
 #include "map/pet.h"
+#include "map/quest.h"
 #include "map/script.h"
 #include "map/skill.h"
 #include "map/status.h"
@@ -633,13 +635,13 @@ static int unit_walk_toxy(struct block_list *bl, short x, short y, int flag)
 
 	sc = status->get_sc(bl);
 	if (sc != NULL) {
-		if (sc->data[SC_CONFUSION] != NULL || sc->data[SC__CHAOS] != NULL) { // Randomize the target position
+		if (SC_ENTRY(sc, SC_CONFUSION) != NULL || SC_ENTRY(sc, SC__CHAOS) != NULL) { // Randomize the target position
 			// Aegis behavior, yes if it doesn't find a random walkable cell it will not move at all.
 			ud->to_x = bl->x;
 			ud->to_y = bl->y;
 			map->get_random_cell_in_range(bl, bl->m, &ud->to_x, &ud->to_y, AREA_SIZE / 2, AREA_SIZE / 2);
 		}
-		if (sc->data[SC_COMBOATTACK] != NULL)
+		if (SC_ENTRY(sc, SC_COMBOATTACK) != NULL)
 			status_change_end(bl, SC_COMBOATTACK, INVALID_TIMER);
 	}
 
@@ -743,7 +745,7 @@ static int unit_walk_tobl(struct block_list *bl, struct block_list *tbl, int ran
 	unit->stop_attack(bl); // Sets target to 0
 
 	struct status_change *sc = status->get_sc(bl);
-	if (sc != NULL && (sc->data[SC_CONFUSION] != NULL || sc->data[SC__CHAOS] != NULL)) { //Randomize the target position
+	if (sc != NULL && (SC_ENTRY(sc, SC_CONFUSION) != NULL || SC_ENTRY(sc, SC__CHAOS) != NULL)) { //Randomize the target position
 		ud->to_x = bl->x;
 		ud->to_y = bl->y;
 		map->get_random_cell_in_range(bl, bl->m, &ud->to_x, &ud->to_y, AREA_SIZE / 2, AREA_SIZE / 2);
@@ -786,7 +788,7 @@ static void unit_run_hit(struct block_list *bl, struct status_change *sc, struct
 {
 	Assert_retv(type >= 0 && type < SC_MAX);
 	nullpo_retv(sc);
-	nullpo_retv(sc->data[type]);
+	nullpo_retv(SC_ENTRY(sc, type));
 
 	//If you can't run forward, you must be next to a wall, so bounce back. [Skotlex]
 	if (type == SC_RUN)
@@ -796,7 +798,7 @@ static void unit_run_hit(struct block_list *bl, struct status_change *sc, struct
 	nullpo_retv(ud);
 	//Set running to 0 beforehand so status_change_end knows not to enable spurt [Kevin]
 	ud->state.running = 0;
-	int lv = sc->data[type]->val1;
+	int lv = SC_ENTRY(sc, type)->val1;
 	status_change_end(bl, type, INVALID_TIMER);
 
 	if (type == SC_RUN) {
@@ -827,7 +829,7 @@ static bool unit_run(struct block_list *bl, struct map_session_data *sd, enum sc
 	Assert_retr(false, type == SC_RUN || type == SC_WUGDASH);
 
 	struct status_change *sc = status->get_sc(bl);
-	if (sc == NULL || sc->data[type] == NULL)
+	if (sc == NULL || SC_ENTRY(sc, type) == NULL)
 		return false;
 
 	if (unit->can_move(bl) == 0) {
@@ -838,9 +840,9 @@ static bool unit_run(struct block_list *bl, struct map_session_data *sd, enum sc
 	// Determine destination cell
 	int to_x = bl->x;
 	int to_y = bl->y;
-	Assert_retr(false, sc->data[type]->val2 >= UNIT_DIR_FIRST && sc->data[type]->val2 < UNIT_DIR_MAX);
-	int dir_x = dirx[sc->data[type]->val2];
-	int dir_y = diry[sc->data[type]->val2];
+	Assert_retr(false, SC_ENTRY(sc, type)->val2 >= UNIT_DIR_FIRST && SC_ENTRY(sc, type)->val2 < UNIT_DIR_MAX);
+	int dir_x = dirx[SC_ENTRY(sc, type)->val2];
+	int dir_y = diry[SC_ENTRY(sc, type)->val2];
 
 	// Search for available path
 	int step_count;
@@ -1256,45 +1258,45 @@ static int unit_can_move(struct block_list *bl)
 	if (sc) {
 		if( sc->count
 		 && (
-		        sc->data[SC_ANKLESNARE]
-		    ||  sc->data[SC_AUTOCOUNTER]
-		    ||  sc->data[SC_TRICKDEAD]
-		    ||  sc->data[SC_BLADESTOP]
-		    ||  sc->data[SC_BLADESTOP_WAIT]
-		    || (sc->data[SC_GOSPEL] && sc->data[SC_GOSPEL]->val4 == BCT_SELF) // cannot move while gospel is in effect
-		    || (sc->data[SC_BASILICA] && sc->data[SC_BASILICA]->val4 == bl->id) // Basilica caster cannot move
-		    ||  sc->data[SC_STOP]
-			|| sc->data[SC_FALLENEMPIRE]
-		    ||  sc->data[SC_RG_CCONFINE_M]
-		    ||  sc->data[SC_RG_CCONFINE_S]
-		    ||  sc->data[SC_GS_MADNESSCANCEL]
-		    || (sc->data[SC_GRAVITATION] && sc->data[SC_GRAVITATION]->val3 == BCT_SELF)
-		    ||  sc->data[SC_WHITEIMPRISON]
-		    ||  sc->data[SC_ELECTRICSHOCKER]
-		    ||  sc->data[SC_WUGBITE]
-		    ||  sc->data[SC_THORNS_TRAP]
-		    ||  ( sc->data[SC_MAGNETICFIELD] && !sc->data[SC_HOVERING] )
-		    ||  sc->data[SC__MANHOLE]
-		    ||  sc->data[SC_CURSEDCIRCLE_ATKER]
-		    ||  sc->data[SC_CURSEDCIRCLE_TARGET]
-		    || (sc->data[SC_COLD] && bl->type != BL_MOB)
-		    ||  sc->data[SC_DEEP_SLEEP]
-		    || (sc->data[SC_CAMOUFLAGE] && sc->data[SC_CAMOUFLAGE]->val1 < 3 && !(sc->data[SC_CAMOUFLAGE]->val3&1))
-		    ||  sc->data[SC_MEIKYOUSISUI]
-		    ||  sc->data[SC_KG_KAGEHUMI]
-		    ||  sc->data[SC_NEEDLE_OF_PARALYZE]
-		    ||  sc->data[SC_VACUUM_EXTREME]
-		    || (sc->data[SC_FEAR] && sc->data[SC_FEAR]->val2 > 0)
-			|| sc->data[SC_NETHERWORLD]
-			|| sc->data[SC_SUHIDE]
-		    || (sc->data[SC_SPIDERWEB] && sc->data[SC_SPIDERWEB]->val1)
-		    || (sc->data[SC_CLOAKING] && sc->data[SC_CLOAKING]->val1 < 3 && !(sc->data[SC_CLOAKING]->val4&1)) //Need wall at level 1-2
+		        SC_ENTRY(sc, SC_ANKLESNARE)
+		    ||  SC_ENTRY(sc, SC_AUTOCOUNTER)
+		    ||  SC_ENTRY(sc, SC_TRICKDEAD)
+		    ||  SC_ENTRY(sc, SC_BLADESTOP)
+		    ||  SC_ENTRY(sc, SC_BLADESTOP_WAIT)
+		    || (SC_ENTRY(sc, SC_GOSPEL) && SC_ENTRY(sc, SC_GOSPEL)->val4 == BCT_SELF) // cannot move while gospel is in effect
+		    || (SC_ENTRY(sc, SC_BASILICA) && SC_ENTRY(sc, SC_BASILICA)->val4 == bl->id) // Basilica caster cannot move
+		    ||  SC_ENTRY(sc, SC_STOP)
+			|| SC_ENTRY(sc, SC_FALLENEMPIRE)
+		    ||  SC_ENTRY(sc, SC_RG_CCONFINE_M)
+		    ||  SC_ENTRY(sc, SC_RG_CCONFINE_S)
+		    ||  SC_ENTRY(sc, SC_GS_MADNESSCANCEL)
+		    || (SC_ENTRY(sc, SC_GRAVITATION) && SC_ENTRY(sc, SC_GRAVITATION)->val3 == BCT_SELF)
+		    ||  SC_ENTRY(sc, SC_WHITEIMPRISON)
+		    ||  SC_ENTRY(sc, SC_ELECTRICSHOCKER)
+		    ||  SC_ENTRY(sc, SC_WUGBITE)
+		    ||  SC_ENTRY(sc, SC_THORNS_TRAP)
+		    ||  ( SC_ENTRY(sc, SC_MAGNETICFIELD) && !SC_ENTRY(sc, SC_HOVERING) )
+		    ||  SC_ENTRY(sc, SC__MANHOLE)
+		    ||  SC_ENTRY(sc, SC_CURSEDCIRCLE_ATKER)
+		    ||  SC_ENTRY(sc, SC_CURSEDCIRCLE_TARGET)
+		    || (SC_ENTRY(sc, SC_COLD) && bl->type != BL_MOB)
+		    ||  SC_ENTRY(sc, SC_DEEP_SLEEP)
+		    || (SC_ENTRY(sc, SC_CAMOUFLAGE) && SC_ENTRY(sc, SC_CAMOUFLAGE)->val1 < 3 && !(SC_ENTRY(sc, SC_CAMOUFLAGE)->val3&1))
+		    ||  SC_ENTRY(sc, SC_MEIKYOUSISUI)
+		    ||  SC_ENTRY(sc, SC_KG_KAGEHUMI)
+		    ||  SC_ENTRY(sc, SC_NEEDLE_OF_PARALYZE)
+		    ||  SC_ENTRY(sc, SC_VACUUM_EXTREME)
+		    || (SC_ENTRY(sc, SC_FEAR) && SC_ENTRY(sc, SC_FEAR)->val2 > 0)
+			|| SC_ENTRY(sc, SC_NETHERWORLD)
+			|| SC_ENTRY(sc, SC_SUHIDE)
+		    || (SC_ENTRY(sc, SC_SPIDERWEB) && SC_ENTRY(sc, SC_SPIDERWEB)->val1)
+		    || (SC_ENTRY(sc, SC_CLOAKING) && SC_ENTRY(sc, SC_CLOAKING)->val1 < 3 && !(SC_ENTRY(sc, SC_CLOAKING)->val4&1)) //Need wall at level 1-2
 		    || (
-		         sc->data[SC_DANCING] && sc->data[SC_DANCING]->val4
+		         SC_ENTRY(sc, SC_DANCING) && SC_ENTRY(sc, SC_DANCING)->val4
 		         && (
-		               !sc->data[SC_LONGING]
-		            || (sc->data[SC_DANCING]->val1&0xFFFF) == CG_MOONLIT
-		            || (sc->data[SC_DANCING]->val1&0xFFFF) == CG_HERMODE
+		               !SC_ENTRY(sc, SC_LONGING)
+		            || (SC_ENTRY(sc, SC_DANCING)->val1&0xFFFF) == CG_MOONLIT
+		            || (SC_ENTRY(sc, SC_DANCING)->val1&0xFFFF) == CG_HERMODE
 		            )
 		       )
 		    )
@@ -1433,13 +1435,13 @@ static int unit_skilluse_id2(struct block_list *src, int target_id, uint16 skill
 	//temp: used to signal combo-skills right now.
 	if (sc != NULL
 	&& skill->is_combo(skill_id)
-	&& sc->data[SC_COMBOATTACK] != NULL
-	&& (sc->data[SC_COMBOATTACK]->val1 == skill_id
+	&& SC_ENTRY(sc, SC_COMBOATTACK) != NULL
+	&& (SC_ENTRY(sc, SC_COMBOATTACK)->val1 == skill_id
 		|| (sd != NULL && skill->check_condition_castbegin(sd, skill_id, skill_lv))
 		)
 	) {
-		if (sc->data[SC_COMBOATTACK]->val2)
-			target_id = sc->data[SC_COMBOATTACK]->val2;
+		if (SC_ENTRY(sc, SC_COMBOATTACK)->val2)
+			target_id = SC_ENTRY(sc, SC_COMBOATTACK)->val2;
 		else if (src->id == target_id || ud->target > 0)
 			target_id = ud->target;
 
@@ -1462,8 +1464,8 @@ static int unit_skilluse_id2(struct block_list *src, int target_id, uint16 skill
 		switch (skill_id) {
 			//Check for skills that auto-select target
 			case MO_CHAINCOMBO:
-				if (sc && sc->data[SC_BLADESTOP]) {
-					if ((target=map->id2bl(sc->data[SC_BLADESTOP]->val4)) == NULL)
+				if (sc && SC_ENTRY(sc, SC_BLADESTOP)) {
+					if ((target=map->id2bl(SC_ENTRY(sc, SC_BLADESTOP)->val4)) == NULL)
 						return 0;
 				}
 				break;
@@ -1482,8 +1484,8 @@ static int unit_skilluse_id2(struct block_list *src, int target_id, uint16 skill
 			}
 				break;
 			case GC_WEAPONCRUSH:
-				if( sc && sc->data[SC_COMBOATTACK] && sc->data[SC_COMBOATTACK]->val1 == GC_WEAPONBLOCKING ) {
-					if( (target=map->id2bl(sc->data[SC_COMBOATTACK]->val2)) == NULL ) {
+				if( sc && SC_ENTRY(sc, SC_COMBOATTACK) && SC_ENTRY(sc, SC_COMBOATTACK)->val1 == GC_WEAPONBLOCKING ) {
+					if( (target=map->id2bl(SC_ENTRY(sc, SC_COMBOATTACK)->val2)) == NULL ) {
 						clif->skill_fail(sd, skill_id, USESKILL_FAIL_GC_WEAPONBLOCKING, 0, 0);
 						return 0;
 					}
@@ -1493,8 +1495,8 @@ static int unit_skilluse_id2(struct block_list *src, int target_id, uint16 skill
 				}
 				break;
 			case RL_QD_SHOT:
-				if (sc != NULL && sc->data[SC_QD_SHOT_READY]) {
-					if ((target = map->id2bl(sc->data[SC_QD_SHOT_READY]->val1)) == NULL)
+				if (sc != NULL && SC_ENTRY(sc, SC_QD_SHOT_READY)) {
+					if ((target = map->id2bl(SC_ENTRY(sc, SC_QD_SHOT_READY)->val1)) == NULL)
 						return 0;
 					temp = 1;
 				}
@@ -1667,10 +1669,10 @@ static int unit_skilluse_id2(struct block_list *src, int target_id, uint16 skill
 	break;
 #endif
 	case MO_EXTREMITYFIST:
-		if (sc && sc->data[SC_COMBOATTACK] &&
-		   (sc->data[SC_COMBOATTACK]->val1 == MO_COMBOFINISH ||
-			sc->data[SC_COMBOATTACK]->val1 == CH_TIGERFIST ||
-			sc->data[SC_COMBOATTACK]->val1 == CH_CHAINCRUSH))
+		if (sc && SC_ENTRY(sc, SC_COMBOATTACK) &&
+		   (SC_ENTRY(sc, SC_COMBOATTACK)->val1 == MO_COMBOFINISH ||
+			SC_ENTRY(sc, SC_COMBOATTACK)->val1 == CH_TIGERFIST ||
+			SC_ENTRY(sc, SC_COMBOATTACK)->val1 == CH_CHAINCRUSH))
 			casttime = -1;
 		temp = 1;
 	break;
@@ -1695,8 +1697,8 @@ static int unit_skilluse_id2(struct block_list *src, int target_id, uint16 skill
 	break;
 	case SR_GATEOFHELL:
 	case SR_TIGERCANNON:
-		if (sc && sc->data[SC_COMBOATTACK] &&
-		   sc->data[SC_COMBOATTACK]->val1 == SR_FALLENEMPIRE)
+		if (sc && SC_ENTRY(sc, SC_COMBOATTACK) &&
+		   SC_ENTRY(sc, SC_COMBOATTACK)->val1 == SR_FALLENEMPIRE)
 			casttime = -1;
 		temp = 1;
 	break;
@@ -1704,17 +1706,17 @@ static int unit_skilluse_id2(struct block_list *src, int target_id, uint16 skill
 		temp = 1;
 	break;
 	case ST_CHASEWALK:
-		if (sc && sc->data[SC_CHASEWALK])
+		if (sc && SC_ENTRY(sc, SC_CHASEWALK))
 			casttime = -1;
 	break;
 	case TK_RUN:
-		if (sc && sc->data[SC_RUN])
+		if (sc && SC_ENTRY(sc, SC_RUN))
 			casttime = -1;
 	break;
 
 #ifndef RENEWAL // 2018.11 rebalance - Basilica changed to a self buff
 	case HP_BASILICA:
-		if( sc && sc->data[SC_BASILICA] )
+		if( sc && SC_ENTRY(sc, SC_BASILICA) )
 			casttime = -1; // No Casting time on basilica cancel
 	break;
 #endif
@@ -1731,7 +1733,7 @@ static int unit_skilluse_id2(struct block_list *src, int target_id, uint16 skill
 			casttime *= 2;
 		break;
 	case RA_WUGDASH:
-		if (sc && sc->data[SC_WUGDASH])
+		if (sc && SC_ENTRY(sc, SC_WUGDASH))
 			casttime = -1;
 		break;
 	case EL_WIND_SLASH:
@@ -1790,13 +1792,13 @@ static int unit_skilluse_id2(struct block_list *src, int target_id, uint16 skill
 		/**
 		 * why the if else chain: these 3 status do not stack, so its efficient that way.
 		 **/
-		if( sc->data[SC_CLOAKING] && !(sc->data[SC_CLOAKING]->val4&4) && skill_id != AS_CLOAKING ) {
+		if( SC_ENTRY(sc, SC_CLOAKING) && !(SC_ENTRY(sc, SC_CLOAKING)->val4&4) && skill_id != AS_CLOAKING ) {
 			status_change_end(src, SC_CLOAKING, INVALID_TIMER);
 			if (!src->prev) return 0; //Warped away!
-		} else if( sc->data[SC_CLOAKINGEXCEED] && !(sc->data[SC_CLOAKINGEXCEED]->val4&4) && skill_id != GC_CLOAKINGEXCEED ) {
+		} else if( SC_ENTRY(sc, SC_CLOAKINGEXCEED) && !(SC_ENTRY(sc, SC_CLOAKINGEXCEED)->val4&4) && skill_id != GC_CLOAKINGEXCEED ) {
 			status_change_end(src,SC_CLOAKINGEXCEED, INVALID_TIMER);
 			if (!src->prev) return 0;
-		} else if (sc->data[SC_NEWMOON] != NULL && skill_id != SJ_NEWMOONKICK) {
+		} else if (SC_ENTRY(sc, SC_NEWMOON) != NULL && skill_id != SJ_NEWMOONKICK) {
 			status_change_end(src, SC_NEWMOON, INVALID_TIMER);
 			if (!src->prev) return 0;
 		}
@@ -2012,13 +2014,13 @@ static int unit_skilluse_pos2(struct block_list *src, short skill_x, short skill
 		/**
 		 * why the if else chain: these 3 status do not stack, so its efficient that way.
 		 **/
-		if (sc->data[SC_CLOAKING] && !(sc->data[SC_CLOAKING]->val4&4)) {
+		if (SC_ENTRY(sc, SC_CLOAKING) && !(SC_ENTRY(sc, SC_CLOAKING)->val4&4)) {
 			status_change_end(src, SC_CLOAKING, INVALID_TIMER);
 			if (!src->prev) return 0; //Warped away!
-		} else if (sc->data[SC_CLOAKINGEXCEED] && !(sc->data[SC_CLOAKINGEXCEED]->val4&4)) {
+		} else if (SC_ENTRY(sc, SC_CLOAKINGEXCEED) && !(SC_ENTRY(sc, SC_CLOAKINGEXCEED)->val4&4)) {
 			status_change_end(src, SC_CLOAKINGEXCEED, INVALID_TIMER);
 			if (!src->prev) return 0;
-		} else if (sc->data[SC_NEWMOON] != NULL && skill_id != SJ_NEWMOONKICK) {
+		} else if (SC_ENTRY(sc, SC_NEWMOON) != NULL && skill_id != SJ_NEWMOONKICK) {
 			status_change_end(src, SC_NEWMOON, INVALID_TIMER);
 			if (!src->prev) return 0;
 		}
@@ -2699,7 +2701,7 @@ static int unit_remove_map(struct block_list *bl, enum clr_type clrtype, const c
 			status_change_end(bl, SC_CLOAKINGEXCEED, INVALID_TIMER);
 		}
 		status_change_end(bl, SC_CHASEWALK, INVALID_TIMER);
-		if (sc->data[SC_GOSPEL] && sc->data[SC_GOSPEL]->val4 == BCT_SELF)
+		if (SC_ENTRY(sc, SC_GOSPEL) && SC_ENTRY(sc, SC_GOSPEL)->val4 == BCT_SELF)
 			status_change_end(bl, SC_GOSPEL, INVALID_TIMER);
 		status_change_end(bl, SC_HLIF_CHANGE, INVALID_TIMER);
 		status_change_end(bl, SC_STOP, INVALID_TIMER);
@@ -3011,6 +3013,7 @@ static int unit_free(struct block_list *bl, enum clr_type clrtype)
 			VECTOR_CLEAR(sd->channels);
 			VECTOR_CLEAR(sd->script_queues);
 			VECTOR_CLEAR(sd->achievement); // Achievement [Smokexyz/Hercules]
+			achievement->progress_index_clear(sd);
 			VECTOR_CLEAR(sd->hatEffectId);
 			VECTOR_CLEAR(sd->title_ids); // Title [Dastgir/Hercules]
 			VECTOR_CLEAR(sd->agency_requests);
@@ -3024,6 +3027,7 @@ static int unit_free(struct block_list *bl, enum clr_type clrtype)
 				sd->quest_log = NULL;
 				sd->num_quests = sd->avail_quests = 0;
 			}
+			quest->index_clear(sd);
 			HPM->data_store_destroy(&sd->hdata);
 			break;
 		}
@@ -3084,11 +3088,7 @@ static int unit_free(struct block_list *bl, enum clr_type clrtype)
 
 			mob->free_dynamic_viewdata(md);
 
-			if( md->spawn_timer != INVALID_TIMER )
-			{
-				timer->delete_(md->spawn_timer,mob->delayspawn);
-				md->spawn_timer = INVALID_TIMER;
-			}
+			mob->dequeue_respawn(md);
 			if( md->deletetimer != INVALID_TIMER )
 			{
 				timer->delete_(md->deletetimer,mob->timer_delete);
@@ -0,0 +1,364 @@
+/**
+ * This file is part of Hercules.
+ * http://herc.ws - http://github.com/HerculesWS/Hercules
+ *
+ * Copyright (C) 2026 Hercules Dev Team
+ *
+ * Hercules is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Compares achievement progress updates through the criteria index
+ * (achievement->validate_type) and the hashed progress table
+ * (achievement->progress_find) with the category scan and linear search they
+ * replace, on a generated DB of BENCH_ACHIEVEMENTS achievements: both must
+ * give the same progress, and their kill rates are reported.
+ *
+ * Usage: ./map-server --load-plugin test_achievement
+ */
+
+#include "common/hercules.h"
+#include "common/core.h"
+#include "common/db.h"
+#include "common/memmgr.h"
+#include "common/showmsg.h"
+#include "common/timer.h"
+#include "map/achievement.h"
+#include "map/battle.h"
+#include "map/clif.h"
+#include "map/map.h"
+#include "map/pc.h"
+
+#include "common/HPMDataCheck.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+HPExport struct hplugin_info pinfo = {
+	"test_achievement", ///< Plugin name
+	SERVER_TYPE_MAP,    ///< Plugin type
+	"0.1",              ///< Plugin version
+	HPM_VERSION,        ///< HPM Version
+};
+
+#define TEST(name, function, ...) do { \
+	const char *message = NULL; \
+	ShowMessage("-------------------------------------------------------------------------------\n"); \
+	ShowNotice("Testing %s...\n", (name)); \
+	if ((message = (function)(__VA_ARGS__)) != NULL) { \
+		ShowError("Failed. %s\n", message); \
+		ShowMessage("===============================================================================\n"); \
+		ShowFatalError("Failure. Aborting further tests.\n"); \
+		exit(EXIT_FAILURE); \
+	} \
+	ShowInfo("Test passed.\n"); \
+} while (false)
+
+#define BENCH_ACHIEVEMENTS 1500 ///< Achievements of the generated DB
+#define BENCH_MOBS 400          ///< Distinct monster classes killed
+#define BENCH_KILLS 200000      ///< Monster kills per player
+#define BENCH_FIRST_ID 900000   ///< Id of the first generated achievement
+#define BENCH_FIRST_MOB 1002    ///< Class of the first killed monster
+
+static char out_message[256];
+static int update_count;
+
+/// Counts the client updates instead of sending them, the players aren't connected.
+static void test_send_update(int fd, struct map_session_data *sd, const struct achievement_data *ad)
+{
+	update_count++;
+}
+
+/// Linear search of the session's achievements, as done before the hashed progress table.
+static struct achievement *scan_ensure(struct map_session_data *sd, const struct achievement_data *ad)
+{
+	struct achievement *s_ad = NULL;
+	int i;
+
+	ARR_FIND(0, VECTOR_LENGTH(sd->achievement), i, (s_ad = &VECTOR_INDEX(sd->achievement, i)) && s_ad->id == ad->id);
+	if (i == VECTOR_LENGTH(sd->achievement)) {
+		struct achievement ta = { 0 };
+		ta.id = ad->id;
+		VECTOR_ENSURE(sd->achievement, 1, 1);
+		VECTOR_PUSH(sd->achievement, ta);
+		s_ad = &VECTOR_LAST(sd->achievement);
+	}
+	return s_ad;
+}
+
+/// Scan of every objective of the category, as done before the criteria index.
+static int scan_validate_type(struct map_session_data *sd, enum achievement_types type, const struct achievement_objective *criteria, bool additive)
+{
+	int total = 0;
+
+	for (int i = 0; i < VECTOR_LENGTH(achievement->category[type]); i++) {
+		const struct achievement_data *ad = achievement->get(VECTOR_INDEX(achievement->category[type], i));
+		bool updated = false;
+
+		if (ad == NULL)
+			continue;
+		for (int j = 0; j < VECTOR_LENGTH(ad->objective); j++) {
+			struct achievement *ach = NULL;
+
+			if (!achievement->check_criteria(&VECTOR_INDEX(ad->objective, j), criteria))
+				continue;
+			if ((ach = achievement->ensure(sd, ad)) == NULL)
+				return 0;
+			if (ach->completed_at == 0 && ach->objective[j] < VECTOR_INDEX(ad->objective, j).goal) {
+				if (additive)
+					achievement->progress_add(sd, ad, j, criteria->goal);
+				else
+					achievement->progress_set(sd, ad, j, criteria->goal);
+				updated = true;
+			}
+		}
+		if (updated)
+			total++;
+	}
+	return total;
+}
+
+static void add_objective(struct achievement_data *ad, int goal, int mobid, int job, enum unique_criteria_types unique_type, int unique)
+{
+	struct achievement_objective obj = { 0 };
+
+	obj.goal = goal;
+	obj.mobid = mobid;
+	VECTOR_INIT(obj.jobid);
+	if (job >= 0) {
+		VECTOR_ENSURE(obj.jobid, 1, 1);
+		VECTOR_PUSH(obj.jobid, job);
+	}
+	obj.unique_type = unique_type;
+	obj.unique.achieve_id = unique;
+	VECTOR_ENSURE(ad->objective, 1, 1);
+	VECTOR_PUSH(ad->objective, obj);
+}
+
+/// Generates the DB: mostly kill objectives, some zeny, stat and achievement ones.
+static void make_db(void)
+{
+	achievement->db = idb_alloc(DB_OPT_RELEASE_DATA);
+	for (int i = 0; i < ACH_TYPE_MAX; i++)
+		VECTOR_INIT(achievement->category[i]);
+	memset(achievement->criteria_index, 0, sizeof(achievement->criteria_index));
+
+	for (int i = 0; i < BENCH_ACHIEVEMENTS; i++) {
+		struct achievement_data *ad = NULL;
+
+		CREATE(ad, struct achievement_data, 1);
+		ad->id = BENCH_FIRST_ID + i;
+		snprintf(ad->name, sizeof ad->name, "Test %d", i);
+		VECTOR_INIT(ad->objective);
+		VECTOR_INIT(ad->rewards.item);
+
+		if (i % 20 == 0) {
+			ad->type = ACH_ZENY_GET_TOTAL;
+			add_objective(ad, 1000000 + i, 0, -1, CRITERIA_UNIQUE_NONE, 0);
+		} else if (i % 20 == 1) {
+			ad->type = ACH_STATUS_BY_JOB;
+			add_objective(ad, 10 + i % 90, 0, i % 3 == 0 ? JOB_KNIGHT : JOB_WIZARD, CRITERIA_UNIQUE_STATUS_TYPE, SP_STR + i % 6);
+		} else if (i % 20 == 2) {
+			ad->type = ACH_ACHIEVE;
+			add_objective(ad, 1, 0, -1, CRITERIA_UNIQUE_ACHIEVE_ID, BENCH_FIRST_ID + (i * 7) % BENCH_ACHIEVEMENTS);
+		} else {
+			int objectives = 1 + i % 3;
+
+			ad->type = ACH_KILL_MOB_CLASS;
+			for (int j = 0; j < objectives; j++)
+				add_objective(ad, 50 + (i * 13 + j) % 500, BENCH_FIRST_MOB + (i * 31 + j * 7) % BENCH_MOBS, -1, CRITERIA_UNIQUE_NONE, 0);
+		}
+		idb_put(achievement->db, ad->id, ad);
+		VECTOR_ENSURE(achievement->category[ad->type], 1, 1);
+		VECTOR_PUSH(achievement->category[ad->type], ad->id);
+	}
+	achievement->criteria_index_build();
+}
+
+static void free_db(void)
+{
+	achievement->criteria_index_clear();
+	achievement->db->destroy(achievement->db, achievement->db_finalize);
+	for (int i = 0; i < ACH_TYPE_MAX; i++)
+		VECTOR_CLEAR(achievement->category[i]);
+}
+
+static struct map_session_data *make_sd(void)
+{
+	struct map_session_data *sd = NULL;
+
+	CREATE(sd, struct map_session_data, 1);
+	sd->bl.type = BL_PC;
+	sd->status.class_ = JOB_KNIGHT;
+	sd->achievements_received = true;
+	VECTOR_INIT(sd->achievement);
+	return sd;
+}
+
+static void free_sd(struct map_session_data *sd)
+{
+	VECTOR_CLEAR(sd->achievement);
+	achievement->progress_index_clear(sd);
+	aFree(sd);
+}
+
+/// Runs the same event sequence on a player, returns the time it took.
+static int64 run_events(struct map_session_data *sd, uint32 seed)
+{
+	int64 tick = timer->gettick_nocache();
+
+	for (int i = 0; i < BENCH_KILLS; i++) {
+		seed = seed * 1103515245 + 12345;
+		achievement->validate_mob_kill(sd, BENCH_FIRST_MOB + (int)((seed >> 8) % BENCH_MOBS));
+		if (i % 50 == 0) {
+			sd->status.zeny += 100;
+			achievement->validate_zeny(sd, 100);
+		}
+		if (i % 2000 == 0)
+			achievement->validate_stats(sd, SP_STR + (int)((seed >> 4) % 6), 1 + i / 2000);
+	}
+	return timer->gettick_nocache() - tick;
+}
+
+static const char *compare(struct map_session_data *sd_scan, struct map_session_data *sd_index)
+{
+	int completed = 0;
+
+	for (int i = 0; i < BENCH_ACHIEVEMENTS; i++) {
+		const struct achievement *a = achievement->progress_find(sd_scan, BENCH_FIRST_ID + i);
+		const struct achievement *b = achievement->progress_find(sd_index, BENCH_FIRST_ID + i);
+
+		if ((a == NULL) != (b == NULL)) {
+			snprintf(out_message, sizeof out_message, "achievement %d has progress with only one of the methods", BENCH_FIRST_ID + i);
+			return out_message;
+		}
+		if (a == NULL)
+			continue;
+		if (memcmp(a->objective, b->objective, sizeof(a->objective)) != 0 || (a->completed_at == 0) != (b->completed_at == 0)) {
+			snprintf(out_message, sizeof out_message, "achievement %d has different progress", BENCH_FIRST_ID + i);
+			return out_message;
+		}
+		if (a->completed_at != 0)
+			completed++;
+	}
+	if (completed == 0)
+		return "no achievement was completed";
+	return NULL;
+}
+
+static const char *test_progress_index(void)
+{
+	struct map_session_data *sd = make_sd();
+	const char *result = NULL;
+
+	for (int i = 0; i < 3000 && result == NULL; i++) {
+		struct achievement_data ad = { 0 };
+		ad.id = (i * 7919) % 100000 + 1; // Spread, with colliding slots
+
+		struct achievement *a = achievement->ensure(sd, &ad);
+		if (a == NULL || a->id != ad.id)
+			result = "ensure returned a wrong entry";
+		else if (achievement->progress_find(sd, ad.id) != a)
+			result = "progress_find doesn't return the entry added by ensure";
+	}
+	if (result == NULL && VECTOR_LENGTH(sd->achievement) != 3000)
+		result = "an achievement entry was added twice";
+	if (result == NULL && achievement->progress_find(sd, 100001) != NULL)
+		result = "progress_find returned a missing achievement";
+
+	// Cleared list (e.g. reloaded from the char-server)
+	VECTOR_CLEAR(sd->achievement);
+	VECTOR_INIT(sd->achievement);
+	if (result == NULL && achievement->progress_find(sd, 1) != NULL)
+		result = "progress_find returned an entry of a cleared list";
+
+	free_sd(sd);
+	return result;
+}
+
+static const char *test_validate(void)
+{
+	struct DBMap *db = achievement->db;
+	VECTOR_DECL(int) category[ACH_TYPE_MAX];
+	struct achievement_criteria_index criteria_index[ACH_TYPE_MAX];
+	void (*send_update) (int fd, struct map_session_data *sd, const struct achievement_data *ad) = clif->achievement_send_update;
+	int (*validate_type) (struct map_session_data *sd, enum achievement_types type, const struct achievement_objective *criteria, bool additive) = achievement->validate_type;
+	struct achievement *(*ensure) (struct map_session_data *sd, const struct achievement_data *ad) = achievement->ensure;
+	struct map_session_data *sd_scan = make_sd(), *sd_index = make_sd();
+	int enabled = 0, scan_updates, index_updates;
+	int64 scan_ms, index_ms;
+	const char *result = NULL;
+
+	memcpy(category, achievement->category, sizeof(category));
+	memcpy(criteria_index, achievement->criteria_index, sizeof(criteria_index));
+	battle->config_get_value("features/enable_achievement_system", &enabled);
+	battle->config_set_value("features/enable_achievement_system", "1");
+	clif->achievement_send_update = test_send_update;
+	make_db();
+
+	achievement->validate_type = scan_validate_type;
+	achievement->ensure = scan_ensure;
+	update_count = 0;
+	scan_ms = run_events(sd_scan, 42);
+	scan_updates = update_count;
+	achievement->validate_type = validate_type;
+	achievement->ensure = ensure;
+
+	update_count = 0;
+	index_ms = run_events(sd_index, 42);
+	index_updates = update_count;
+
+	result = compare(sd_scan, sd_index);
+	if (result == NULL && scan_updates != index_updates) {
+		snprintf(out_message, sizeof out_message, "%d client updates with the category scan, %d with the criteria index", scan_updates, index_updates);
+		result = out_message;
+	}
+
+	ShowInfo("%d achievements, %d kills: category scan %"PRId64" ms, criteria index %"PRId64" ms (%d client updates).\n",
+			BENCH_ACHIEVEMENTS, BENCH_KILLS, scan_ms, index_ms, index_updates);
+	if (scan_ms > 0 && index_ms > 0)
+		ShowInfo("Kill rate: %"PRId64" kills/s with the category scan, %"PRId64" kills/s with the criteria index.\n",
+				(int64)BENCH_KILLS * 1000 / scan_ms, (int64)BENCH_KILLS * 1000 / index_ms);
+
+	free_db();
+	free_sd(sd_scan);
+	free_sd(sd_index);
+	achievement->db = db;
+	memcpy(achievement->category, category, sizeof(category));
+	memcpy(achievement->criteria_index, criteria_index, sizeof(criteria_index));
+	clif->achievement_send_update = send_update;
+	battle->config_set_value("features/enable_achievement_system", enabled != 0 ? "1" : "0");
+	return result;
+}
+
+HPExport void plugin_init(void)
+{
+}
+
+HPExport void server_online(void)
+{
+	ShowMessage("===============================================================================\n");
+	ShowStatus("Starting tests.\n");
+
+	TEST("Hashed progress table", test_progress_index);
+	TEST("Criteria index against category scan", test_validate);
+
+	ShowMessage("===============================================================================\n");
+	ShowStatus("All tests passed.\n");
+	map->do_shutdown();
+}
+
+HPExport void plugin_final(void)
+{
+}
@@ -0,0 +1,358 @@
+/**
+ * This file is part of Hercules.
+ * http://herc.ws - http://github.com/HerculesWS/Hercules
+ *
+ * Copyright (C) 2026 Hercules Dev Team
+ *
+ * Hercules is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Load generator benchmark for api-server http connection handling.
+ *
+ * Local clients send requests to a stand-in url, which replies from a timer
+ * in the same way a char-server round trip does. Requests per second and
+ * latency percentiles are measured for connections closed after every
+ * request, keep-alive connections and keep-alive connections with pipelining.
+ *
+ * Usage: ./api-server --load-plugin test_api_http
+ *
+ * NOTE: 127.0.0.1 should be in allow_list of conf/common/socket.conf,
+ *       or DDoS protection will reject most of the non keep-alive connections.
+ */
+
+#include "common/hercules.h"
+#include "common/core.h"
+#include "common/memmgr.h"
+#include "common/nullpo.h"
+#include "common/showmsg.h"
+#include "common/socket.h"
+#include "common/strlib.h"
+#include "common/timer.h"
+#include "api/aclif.h"
+#include "api/api.h"
+#include "api/apisessiondata.h"
+#include "api/httpsender.h"
+
+#include "common/HPMDataCheck.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+HPExport struct hplugin_info pinfo = {
+	"test_api_http", ///< Plugin name
+	SERVER_TYPE_API, ///< Plugin type
+	"0.1",           ///< Plugin version
+	HPM_VERSION,     ///< HPM Version
+};
+
+#define BENCH_CLIENTS 16         ///< Concurrent client connections
+#define BENCH_REQUESTS 20000     ///< Requests done by each benchmark run
+#define BENCH_MAX_PIPELINE 8     ///< Max requests in flight on one connection
+#define BENCH_PAYLOAD_SIZE 2048  ///< Response body size (about a gif emblem)
+
+struct bench_run {
+	const char *name;
+	bool keep_alive;
+	int pipeline;
+};
+
+static const struct bench_run bench_runs[] = {
+	{ "close after request",    false, 1 },
+	{ "keep-alive",             true,  1 },
+	{ "keep-alive, pipeline 8", true,  BENCH_MAX_PIPELINE },
+};
+
+struct bench_client {
+	int fd;
+	int in_flight;
+	int head;                            ///< oldest request in sent_us
+	int64 sent_us[BENCH_MAX_PIPELINE];   ///< send time of requests in flight
+};
+
+static struct {
+	int run;
+	int sent;
+	int completed;
+	int errors;
+	int64 start_us;
+	int64 *latency_us;
+	struct bench_client clients[BENCH_CLIENTS];
+	bool saved_keep_alive;
+	int saved_connections_limit;
+} bench;
+
+static char payload[BENCH_PAYLOAD_SIZE];
+
+static int bench_client_parse(int fd);
+static int bench_start_run(int tid, int64 tick, int id, intptr_t data);
+
+/// Monotonic time in microseconds.
+static int64 bench_now_us(void)
+{
+#ifdef WIN32
+	return timer->gettick_nocache() * 1000;
+#else
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#endif
+}
+
+/// Stand-in for char-server reply to proxied request.
+static int bench_char_reply(int tid, int64 tick, int id, intptr_t data)
+{
+	const int fd = id;
+	if (!sockt->session_is_active(fd))
+		return 0;
+	struct api_session_data *sd = sockt->session[fd]->session_data;
+	if (sd == NULL || sd->id != (int)data)
+		return 0;
+
+	httpsender->send_binary(fd, payload, sizeof(payload));
+	aclif->finish_request(fd);
+	return 0;
+}
+
+HTTP_URL(test_api_http_bench)
+{
+	timer->add(timer->gettick(), bench_char_reply, fd, (intptr_t)sd->id);
+	return true;
+}
+
+static struct bench_client *bench_get_client(int fd)
+{
+	for (int i = 0; i < BENCH_CLIENTS; i++) {
+		if (bench.clients[i].fd == fd)
+			return &bench.clients[i];
+	}
+	return NULL;
+}
+
+static bool bench_client_connect(struct bench_client *client)
+{
+	nullpo_retr(false, client);
+
+	client->fd = sockt->make_connection(sockt->str2ip("127.0.0.1"), aclif->api_port, NULL);
+	client->in_flight = 0;
+	client->head = 0;
+	if (client->fd == -1) {
+		ShowError("test_api_http: can't connect to api-server port %d\n", aclif->api_port);
+		return false;
+	}
+	sockt->session[client->fd]->func_parse = bench_client_parse;
+	return true;
+}
+
+static void bench_client_send(struct bench_client *client)
+{
+	nullpo_retv(client);
+
+	const struct bench_run *run = &bench_runs[bench.run];
+	const int fd = client->fd;
+	while (client->in_flight < run->pipeline && bench.sent < BENCH_REQUESTS) {
+		char buf[128];
+		const int len = snprintf(buf, sizeof(buf),
+			"GET /test_api_http/bench HTTP/1.1\r\n"
+			"Host: 127.0.0.1\r\n"
+			"Connection: %s\r\n"
+			"\r\n",
+			run->keep_alive ? "keep-alive" : "close");
+		WFIFOHEAD(fd, len);
+		memcpy(WFIFOP(fd, 0), buf, len);
+		WFIFOSET(fd, len);
+		client->sent_us[(client->head + client->in_flight) % BENCH_MAX_PIPELINE] = bench_now_us();
+		client->in_flight++;
+		bench.sent++;
+	}
+	sockt->flush(fd);
+}
+
+static int bench_compare_int64(const void *a, const void *b)
+{
+	const int64 x = *(const int64 *)a;
+	const int64 y = *(const int64 *)b;
+	return (x > y) - (x < y);
+}
+
+static void bench_finish_run(void)
+{
+	const int64 elapsed_us = max(bench_now_us() - bench.start_us, 1);
+	const int received = bench.completed - bench.errors;
+
+	for (int i = 0; i < BENCH_CLIENTS; i++) {
+		if (bench.clients[i].fd != -1 && sockt->session_is_valid(bench.clients[i].fd))
+			sockt->close(bench.clients[i].fd);
+		bench.clients[i].fd = -1;
+	}
+
+	qsort(bench.latency_us, received, sizeof(bench.latency_us[0]), bench_compare_int64);
+	ShowInfo("%-24s %d requests (%d errors), %d clients: %"PRId64" req/s, latency p50 %"PRId64" us, p99 %"PRId64" us, max %"PRId64" us\n",
+		bench_runs[bench.run].name, received, bench.errors, BENCH_CLIENTS,
+		(int64)received * 1000000 / elapsed_us,
+		received > 0 ? bench.latency_us[received / 2] : 0,
+		received > 0 ? bench.latency_us[received * 99 / 100] : 0,
+		received > 0 ? bench.latency_us[received - 1] : 0);
+
+	bench.run++;
+	timer->add(timer->gettick() + 100, bench_start_run, 0, 0);
+}
+
+/// Drops requests in flight on client connection and opens new connection if required.
+static void bench_client_reconnect(struct bench_client *client)
+{
+	nullpo_retv(client);
+
+	bench.errors += client->in_flight;
+	bench.completed += client->in_flight;
+	if (client->fd != -1 && sockt->session_is_valid(client->fd))
+		sockt->close(client->fd);
+	client->fd = -1;
+	client->in_flight = 0;
+
+	if (bench.completed >= BENCH_REQUESTS) {
+		bench_finish_run();
+		return;
+	}
+	if (bench.sent < BENCH_REQUESTS && bench_client_connect(client))
+		bench_client_send(client);
+}
+
+/// Handles one complete response, returns size of it or 0 if it is not received yet.
+static size_t bench_client_parse_response(int fd, struct bench_client *client, bool *closing)
+{
+	char header[512];
+	const size_t rest = RFIFOREST(fd);
+	const size_t copy_size = min(rest, sizeof(header) - 1);
+	memcpy(header, RFIFOP(fd, 0), copy_size);
+	header[copy_size] = '\0';
+
+	const char *header_end = strstr(header, "\n\n");
+	if (header_end == NULL)
+		return 0;
+	const size_t header_size = header_end - header + 2;
+
+	size_t content_length = 0;
+	const char *length_str = strstr(header, "Content-Length: ");
+	if (length_str != NULL && length_str < header_end)
+		content_length = (size_t)atoll(length_str + 16);
+	if (rest < header_size + content_length)
+		return 0;
+
+	const char *connection = strstr(header, "Connection: close");
+	*closing = (connection != NULL && connection < header_end);
+
+	if (strncmp(header, "HTTP/1.1 200", 12) != 0 || content_length != BENCH_PAYLOAD_SIZE
+	 || memcmp(RFIFOP(fd, header_size), payload, BENCH_PAYLOAD_SIZE) != 0) {
+		bench.errors++;
+	} else {
+		bench.latency_us[bench.completed - bench.errors] = bench_now_us() - client->sent_us[client->head];
+	}
+	bench.completed++;
+	client->head = (client->head + 1) % BENCH_MAX_PIPELINE;
+	client->in_flight--;
+	return header_size + content_length;
+}
+
+static int bench_client_parse(int fd)
+{
+	struct bench_client *client = bench_get_client(fd);
+	if (client == NULL) {
+		sockt->close(fd);
+		return 0;
+	}
+
+	bool closing = false;
+	while (RFIFOREST(fd) > 0) {
+		const size_t size = bench_client_parse_response(fd, client, &closing);
+		if (size == 0)
+			break;
+		RFIFOSKIP(fd, size);
+		if (bench.completed >= BENCH_REQUESTS) {
+			bench_finish_run();
+			return 0;
+		}
+		if (closing)
+			break;
+	}
+
+	if (closing || sockt->session[fd]->flag.eof != 0) {
+		bench_client_reconnect(client);
+		return 0;
+	}
+	bench_client_send(client);
+	return 0;
+}
+
+static int bench_start_run(int tid, int64 tick, int id, intptr_t data)
+{
+	if (bench.run >= ARRAYLENGTH(bench_runs)) {
+		aclif->keep_alive = bench.saved_keep_alive;
+		api->ip_connections_limit = bench.saved_connections_limit;
+		aFree(bench.latency_us);
+		bench.latency_us = NULL;
+		ShowMessage("===============================================================================\n");
+		ShowStatus("Benchmark finished.\n");
+		api->do_shutdown();
+		return 0;
+	}
+
+	bench.sent = 0;
+	bench.completed = 0;
+	bench.errors = 0;
+	bench.start_us = bench_now_us();
+	for (int i = 0; i < BENCH_CLIENTS; i++) {
+		if (!bench_client_connect(&bench.clients[i])) {
+			api->do_shutdown();
+			return 0;
+		}
+		bench_client_send(&bench.clients[i]);
+	}
+	return 0;
+}
+
+HPExport void plugin_init(void)
+{
+}
+
+HPExport void server_online(void)
+{
+	for (int i = 0; i < BENCH_PAYLOAD_SIZE; i++)
+		payload[i] = (char)(i * 31 + 7);
+
+	addHttpHandler(HTTP_GET, "/test_api_http/bench", test_api_http_bench, REQ_DEFAULT);
+	timer->add_func_list(bench_char_reply, "bench_char_reply");
+	timer->add_func_list(bench_start_run, "bench_start_run");
+
+	// both client and server sides of benchmark connections are counted per ip
+	bench.saved_keep_alive = aclif->keep_alive;
+	bench.saved_connections_limit = api->ip_connections_limit;
+	aclif->keep_alive = true;
+	api->ip_connections_limit = BENCH_CLIENTS * 4;
+
+	bench.run = 0;
+	bench.latency_us = aCalloc(BENCH_REQUESTS, sizeof(bench.latency_us[0]));
+	for (int i = 0; i < BENCH_CLIENTS; i++)
+		bench.clients[i].fd = -1;
+
+	ShowMessage("===============================================================================\n");
+	ShowStatus("Starting api-server http benchmark.\n");
+	timer->add(timer->gettick() + 1000, bench_start_run, 0, 0);
+}
+
+HPExport void plugin_final(void)
+{
+	aFree(bench.latency_us);
+}
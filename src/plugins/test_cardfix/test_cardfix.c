@@ -0,0 +1,297 @@
+/**
+ * This file is part of Hercules.
+ * http://herc.ws - http://github.com/HerculesWS/Hercules
+ *
+ * Copyright (C) 2026 Hercules Dev Team
+ *
+ * Hercules is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Compares the card fix of BENCH_ATTACKS simulated auto-attacks through
+ * battle->cardfix_cache (battle->calc_cardfix) with the rate computed for
+ * every hit (battle->calc_cardfix_rate), between players and monsters whose
+ * bonuses change during the test: both must give the same damage, and their
+ * running times are reported.
+ *
+ * Usage: ./map-server --load-plugin test_cardfix
+ */
+
+#include "common/hercules.h"
+#include "common/core.h"
+#include "common/memmgr.h"
+#include "common/random.h"
+#include "common/showmsg.h"
+#include "common/timer.h"
+#include "map/battle.h"
+#include "map/map.h"
+#include "map/mob.h"
+#include "map/pc.h"
+#include "map/status.h"
+#include "map/unit.h"
+
+#include "common/HPMDataCheck.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+HPExport struct hplugin_info pinfo = {
+	"test_cardfix",  ///< Plugin name
+	SERVER_TYPE_MAP, ///< Plugin type
+	"0.1",           ///< Plugin version
+	HPM_VERSION,     ///< HPM Version
+};
+
+#define TEST(name, function, ...) do { \
+	const char *message = NULL; \
+	ShowMessage("-------------------------------------------------------------------------------\n"); \
+	ShowNotice("Testing %s...\n", (name)); \
+	if ((message = (function)(__VA_ARGS__)) != NULL) { \
+		ShowError("Failed. %s\n", message); \
+		ShowMessage("===============================================================================\n"); \
+		ShowFatalError("Failure. Aborting further tests.\n"); \
+		exit(EXIT_FAILURE); \
+	} \
+	ShowInfo("Test passed.\n"); \
+} while (false)
+
+#define BENCH_PLAYERS 16           ///< Players attacking and attacked
+#define BENCH_MOBS 16              ///< Monsters attacking and attacked
+#define BENCH_ATTACKS 1000000      ///< Simulated auto-attacks
+#define BENCH_CHANGE_INTERVAL 1000 ///< Attacks between two status changes
+#define BENCH_FIRST_ID 2000000     ///< Id of the first unit
+
+static char out_message[256];
+static struct map_session_data *players[BENCH_PLAYERS];
+static struct mob_data *mobs[BENCH_MOBS];
+static struct mob_db *mob_dbs;
+static struct view_data *mob_vds;
+
+/// Card bonuses of a player, on both hands and against both sides.
+static void set_bonuses(struct map_session_data *sd, int i)
+{
+	sd->right_weapon.addrace[i % 10] = 10 + i;
+	sd->right_weapon.addrace[RC_BOSS] = i % 3 == 0 ? 25 : 0;
+	sd->right_weapon.addele[(i * 3) % ELE_MAX] = 20;
+	sd->right_weapon.addsize[i % 3] = 15;
+	sd->right_weapon.addele2[0].ele = (unsigned char)(i % ELE_MAX);
+	sd->right_weapon.addele2[0].rate = 5 + i % 4;
+	sd->right_weapon.addele2[0].flag = BF_WEAPON | BF_NORMAL | BF_SHORT | BF_LONG;
+	sd->right_weapon.add_dmg[0].class_ = 1002 + i % BENCH_MOBS;
+	sd->right_weapon.add_dmg[0].rate = 30;
+	sd->left_weapon.addrace[(i + 1) % 10] = 7;
+	sd->left_weapon.addsize[(i + 1) % 3] = 11;
+	sd->arrow_addrace[i % 10] = 5;
+	sd->arrow_addsize[(i + 2) % 3] = 8;
+	sd->subele[(i * 7) % ELE_MAX] = 15;
+	sd->subele2[0].ele = (unsigned char)((i + 3) % ELE_MAX);
+	sd->subele2[0].rate = 10;
+	sd->subele2[0].flag = BF_WEAPON | BF_NORMAL | BF_SHORT;
+	sd->subsize[i % 3] = 12;
+	sd->subrace[(i + 4) % 10] = 20;
+	sd->subrace[RC_NONBOSS] = 5;
+	sd->subrace2[i % 4] = 9;
+	sd->sub_def_ele[i % ELE_MAX].rate_mob = 6;
+	sd->sub_def_ele[(i + 5) % ELE_MAX].rate_pc = 4;
+	sd->add_def[0].class_ = 1002 + (i + 3) % BENCH_MOBS;
+	sd->add_def[0].rate = 18;
+	sd->bonus.near_attack_def_rate = i % 5;
+	sd->bonus.long_attack_def_rate = 10 + i % 5;
+	sd->bonus.long_attack_atk_rate = i % 6;
+}
+
+static void make_units(void)
+{
+	CREATE(mob_dbs, struct mob_db, BENCH_MOBS);
+	CREATE(mob_vds, struct view_data, BENCH_MOBS);
+	for (int i = 0; i < BENCH_PLAYERS; i++) {
+		struct map_session_data *sd = NULL;
+
+		CREATE(sd, struct map_session_data, 1);
+		sd->bl.type = BL_PC;
+		sd->bl.id = BENCH_FIRST_ID + i;
+		sd->status.class_ = i % 20;
+		status->change_init(&sd->bl);
+		sd->battle_status.race = (unsigned char)(i % 10);
+		sd->battle_status.size = (unsigned char)(i % 3);
+		sd->battle_status.def_ele = (unsigned char)(i % ELE_MAX);
+		set_bonuses(sd, i);
+		status->bump_version(&sd->sc); // As status_calc_pc on login
+		players[i] = sd;
+	}
+	for (int i = 0; i < BENCH_MOBS; i++) {
+		struct mob_data *md = NULL;
+
+		CREATE(md, struct mob_data, 1);
+		md->bl.type = BL_MOB;
+		md->bl.id = BENCH_FIRST_ID + BENCH_PLAYERS + i;
+		md->db = &mob_dbs[i];
+		md->db->race2 = (short)(i % 4);
+		md->vd = &mob_vds[i];
+		md->vd->class_ = 1002 + i;
+		status->change_init(&md->bl);
+		md->status.race = (unsigned char)((i * 3) % 10);
+		md->status.size = (unsigned char)(i % 3);
+		md->status.def_ele = (unsigned char)((i * 5) % ELE_MAX);
+		md->status.mode = i % 4 == 0 ? MD_BOSS : MD_NONE;
+		status->bump_version(&md->sc); // As status_calc_mob on spawn
+		mobs[i] = md;
+	}
+}
+
+static void free_units(void)
+{
+	for (int i = 0; i < BENCH_PLAYERS; i++)
+		aFree(players[i]);
+	for (int i = 0; i < BENCH_MOBS; i++)
+		aFree(mobs[i]);
+	aFree(mob_dbs);
+	aFree(mob_vds);
+}
+
+static struct block_list *random_unit(uint32 r)
+{
+	if (r % 2 == 0)
+		return &players[(r >> 1) % BENCH_PLAYERS]->bl;
+	return &mobs[(r >> 1) % BENCH_MOBS]->bl;
+}
+
+/// Changes the status of a unit, as an equipment change or a status change would, followed by its recalculation.
+static void change_status(uint32 r)
+{
+	struct block_list *bl = random_unit(r);
+
+	if (bl->type == BL_PC) {
+		struct map_session_data *sd = BL_UCAST(BL_PC, bl);
+
+		switch ((r >> 8) % 4) {
+		case 0: sd->right_weapon.addrace[(r >> 12) % 10] += 5; break;
+		case 1: sd->subele[(r >> 12) % ELE_MAX] -= 3; break;
+		case 2: sd->battle_status.def_ele = (unsigned char)((r >> 12) % ELE_MAX); break;
+		default: sd->bonus.long_attack_def_rate = (int)((r >> 12) % 20); break;
+		}
+		status->bump_version(&sd->sc);
+	} else {
+		struct mob_data *md = BL_UCAST(BL_MOB, bl);
+
+		md->status.def_ele = (unsigned char)((r >> 12) % ELE_MAX);
+		md->status.size = (unsigned char)((r >> 16) % 3);
+		status->bump_version(&md->sc);
+	}
+}
+
+/// Card fix without battle->cardfix_cache, as done before it.
+static int64 uncached_cardfix(int attack_type, struct block_list *src, struct block_list *target, int nk, int s_ele, int s_ele_, int64 damage, int cflag, int wflag)
+{
+	int rate;
+
+	if (damage == 0)
+		return 0;
+	rate = battle->calc_cardfix_rate(attack_type, src, target, nk, s_ele, s_ele_, cflag, wflag);
+	if (rate != 1000)
+		damage = damage * rate / 1000;
+	return damage;
+}
+
+/**
+ * Runs the card fix of BENCH_ATTACKS auto-attacks, with the attacker side and
+ * target side steps of battle_calc_weapon_attack for both hands.
+ *
+ * @param cardfix The card fix function to test.
+ * @param sum     The sum of the damage of both hands of every attack.
+ * @return The running time in milliseconds.
+ */
+static int64 run_attacks(int64 (*cardfix) (int attack_type, struct block_list *src, struct block_list *target, int nk, int s_ele, int s_ele_, int64 damage, int cflag, int wflag), int64 *sum)
+{
+	int64 tick;
+
+	rnd->seed(0x2545F491); // both runs replay the same attacks and status changes
+	*sum = 0;
+	tick = timer->gettick_nocache();
+	for (int i = 0; i < BENCH_ATTACKS; i++) {
+		uint32 r = (uint32)rnd();
+		struct block_list *src = random_unit(r);
+		struct block_list *target = random_unit(r >> 8);
+		int wflag = BF_WEAPON | BF_NORMAL | ((r >> 16) % 4 == 0 ? BF_LONG : BF_SHORT);
+		int s_ele = (src->id * 7) % ELE_MAX, s_ele_ = (src->id * 3) % ELE_MAX;
+		bool lh = src->type == BL_PC && src->id % 3 == 0; // Dual wielding
+		int64 damage = 1000 + (r >> 20), damage2 = lh ? 500 + (r >> 22) : 0;
+
+		if (src == target)
+			continue;
+		if (src->type == BL_PC)
+			BL_UCAST(BL_PC, src)->state.arrow_atk = (wflag & BF_LONG) != 0 ? 1 : 0;
+		damage = cardfix(BF_WEAPON, src, target, 0, s_ele, s_ele_, damage, 2, wflag);
+		if (lh)
+			damage2 = cardfix(BF_WEAPON, src, target, 0, s_ele, s_ele_, damage2, 3, wflag);
+		damage = cardfix(BF_WEAPON, src, target, 0, s_ele, s_ele_, damage, 0, wflag);
+		if (lh)
+			damage2 = cardfix(BF_WEAPON, src, target, 0, s_ele, s_ele_, damage2, 1, wflag);
+		*sum += damage + damage2;
+
+		if (i % BENCH_CHANGE_INTERVAL == BENCH_CHANGE_INTERVAL - 1)
+			change_status((uint32)rnd());
+	}
+	return timer->gettick_nocache() - tick;
+}
+
+static const char *test_cardfix(void)
+{
+	int64 uncached_sum, cached_sum, uncached_ms, cached_ms;
+	uint64 hits, misses;
+	const char *result = NULL;
+
+	battle->cardfix_cache_clear();
+	make_units();
+	uncached_ms = run_attacks(uncached_cardfix, &uncached_sum);
+	free_units();
+
+	make_units();
+	cached_ms = run_attacks(battle->calc_cardfix, &cached_sum);
+	hits = battle->cardfix_cache.hits;
+	misses = battle->cardfix_cache.misses;
+	free_units();
+	battle->cardfix_cache_clear();
+
+	if (uncached_sum != cached_sum) {
+		snprintf(out_message, sizeof out_message, "total damage %"PRId64" with the rate computed for every hit, %"PRId64" with the cached rate", uncached_sum, cached_sum);
+		result = out_message;
+	}
+	if (result == NULL && (hits == 0 || misses == 0))
+		result = "the cache was never used or never updated";
+
+	ShowInfo("%d auto-attacks: card fix computed for every hit %"PRId64" ms, cached %"PRId64" ms (%"PRIu64" hits, %"PRIu64" misses).\n",
+			BENCH_ATTACKS, uncached_ms, cached_ms, hits, misses);
+	return result;
+}
+
+HPExport void plugin_init(void)
+{
+}
+
+HPExport void server_online(void)
+{
+	ShowMessage("===============================================================================\n");
+	ShowStatus("Starting tests.\n");
+
+	TEST("Cached card fix against card fix computed for every hit", test_cardfix);
+
+	ShowMessage("===============================================================================\n");
+	ShowStatus("All tests passed.\n");
+	map->do_shutdown();
+}
+
+HPExport void plugin_final(void)
+{
+}
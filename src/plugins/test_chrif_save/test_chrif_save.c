@@ -0,0 +1,344 @@
+/**
+ * This file is part of Hercules.
+ * http://herc.ws - http://github.com/HerculesWS/Hercules
+ *
+ * Copyright (C) 2026 Hercules Dev Team
+ *
+ * Hercules is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Round-trip test of the delta encoding used by character saves
+ * (chrif->save_delta_encode on the map-server, chr->save_delta_apply on the
+ * char-server), and measure of the bytes it saves on typical changes between
+ * two autosaves, with and without zlib compression.
+ *
+ * The encoder and the decoder live in different servers, so the test runs in
+ * two steps from the same directory:
+ *   ./map-server --load-plugin test_chrif_save
+ *     encodes the test cases and writes them to log/test_chrif_save.dat
+ *   ./char-server --load-plugin test_chrif_save
+ *     decodes them with chr->save_delta_apply and compares with the originals
+ */
+
+#include "common/hercules.h"
+#include "char/char.h"
+#include "common/cbasetypes.h"
+#include "common/core.h"
+#include "common/grfio.h"
+#include "common/mmo.h"
+#include "common/nullpo.h"
+#include "common/random.h"
+#include "common/showmsg.h"
+#include "common/socket.h"
+#include "common/strlib.h"
+#include "map/chrif.h"
+#include "map/map.h"
+
+#include "common/HPMDataCheck.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+HPExport struct hplugin_info pinfo = {
+	"test_chrif_save",                 ///< Plugin name
+	SERVER_TYPE_MAP | SERVER_TYPE_CHAR, ///< Plugin type
+	"0.1",                             ///< Plugin version
+	HPM_VERSION,                       ///< HPM Version
+};
+
+#define TEST(name, function, ...) do { \
+	const char *message = NULL; \
+	ShowMessage("-------------------------------------------------------------------------------\n"); \
+	ShowNotice("Testing %s...\n", (name)); \
+	if ((message = (function)(__VA_ARGS__)) != NULL) { \
+		ShowError("Failed. %s\n", message); \
+		ShowMessage("===============================================================================\n"); \
+		ShowFatalError("Failure. Aborting further tests.\n"); \
+		exit(EXIT_FAILURE); \
+	} \
+	ShowInfo("Test passed.\n"); \
+} while (false)
+
+#define RANDOM_ROUNDS 2000 ///< Random mutations checked by the round-trip test
+#define MAX_CHANGES 64     ///< Maximum mutations of a test case
+#define CASES_FILE "log/test_chrif_save.dat" ///< Test cases written by the map-server, checked by the char-server
+
+/// A test case: mutations applied on the base character, and their encoding.
+struct test_case {
+	int changes;
+	int offset[MAX_CHANGES];
+	uint8 value[MAX_CHANGES];
+	int len;
+	uint8 delta[CHRIF_SAVE_DELTA_MAX];
+};
+
+static char out_message[256];
+static struct mmo_charstatus base_status, cur_status, decoded_status;
+static struct test_case tcase;
+static uint8 zip_buf[sizeof(struct mmo_charstatus) * 2];
+
+/// Fills a character the way an active player looks like.
+static void fill_status(struct mmo_charstatus *cs)
+{
+	memset(cs, 0, sizeof(*cs));
+	cs->char_id = 150000;
+	cs->account_id = 2000000;
+	cs->base_level = 99;
+	cs->job_level = 50;
+	cs->zeny = 1234567;
+	safestrncpy(cs->name, "test_chrif_save", sizeof(cs->name));
+	for (int i = 0; i < MAX_INVENTORY / 2; i++) {
+		cs->inventory[i].id = i + 1;
+		cs->inventory[i].nameid = 501 + i;
+		cs->inventory[i].amount = 1 + i % 30;
+		cs->inventory[i].identify = 1;
+	}
+	for (int i = 0; i < MAX_SKILL_DB / 4; i++) {
+		cs->skill[i].id = i + 1;
+		cs->skill[i].lv = 1 + i % 10;
+	}
+}
+
+/// Builds cur_status from base_status and the mutations of the test case.
+static void apply_changes(const struct test_case *tc)
+{
+	uint8 *raw = (uint8 *)&cur_status;
+
+	memcpy(&cur_status, &base_status, sizeof(cur_status));
+	for (int i = 0; i < tc->changes; i++)
+		raw[tc->offset[i]] ^= tc->value[i];
+}
+
+/*==========================================
+ * Map-server: encoding
+ *------------------------------------------*/
+
+static FILE *cases_fp = NULL;
+
+/// Encodes the test case and writes it for the char-server.
+static const char *encode_case(const char *what)
+{
+	apply_changes(&tcase);
+	tcase.len = chrif->save_delta_encode(&base_status, &cur_status, tcase.delta, sizeof(tcase.delta));
+	if (tcase.len < 0)
+		return NULL; // sent as a full snapshot
+	if (fwrite(&tcase, sizeof(tcase), 1, cases_fp) != 1) {
+		snprintf(out_message, sizeof(out_message), "%s: failed to write to %s", what, CASES_FILE);
+		return out_message;
+	}
+	return NULL;
+}
+
+static const char *test_unchanged(void)
+{
+	fill_status(&base_status);
+	memcpy(&cur_status, &base_status, sizeof(cur_status));
+	if (chrif->save_delta_encode(&base_status, &cur_status, tcase.delta, sizeof(tcase.delta)) != 0)
+		return "Delta of identical snapshots is not empty";
+	return NULL;
+}
+
+static const char *test_edges(void)
+{
+	const char *message;
+
+	fill_status(&base_status);
+	tcase.changes = 2;
+	tcase.offset[0] = 0;
+	tcase.value[0] = 0xff;
+	tcase.offset[1] = (int)sizeof(cur_status) - 1;
+	tcase.value[1] = 0xff;
+	if ((message = encode_case("first and last byte")) != NULL)
+		return message;
+	if (tcase.len <= 0)
+		return "First and last byte: no delta";
+
+	memset(&cur_status, 0x5a, sizeof(cur_status));
+	if (chrif->save_delta_encode(&base_status, &cur_status, tcase.delta, sizeof(tcase.delta)) != -1)
+		return "Delta of a fully changed snapshot fits in CHRIF_SAVE_DELTA_MAX";
+	return NULL;
+}
+
+static const char *test_random(void)
+{
+	const char *message;
+
+	fill_status(&base_status);
+	for (int round = 0; round < RANDOM_ROUNDS; round++) {
+		tcase.changes = 1 + rnd() % MAX_CHANGES;
+		for (int i = 0; i < tcase.changes; i++) {
+			tcase.offset[i] = rnd() % (int)sizeof(cur_status);
+			tcase.value[i] = (uint8)(1 + rnd() % 255);
+		}
+		if ((message = encode_case("random changes")) != NULL)
+			return message;
+	}
+	return NULL;
+}
+
+/// Bytes sent for a save with the given changes, in every mode.
+static void benchmark(const char *name, void (*change)(struct mmo_charstatus *cs))
+{
+	const int full_len = (int)sizeof(struct mmo_charstatus);
+	unsigned long zip_full = sizeof(zip_buf), zip_delta = sizeof(zip_buf);
+	int delta_len;
+
+	fill_status(&base_status);
+	memcpy(&cur_status, &base_status, sizeof(cur_status));
+	change(&cur_status);
+
+	delta_len = chrif->save_delta_encode(&base_status, &cur_status, tcase.delta, sizeof(tcase.delta));
+	grfio->encode_zip(zip_buf, &zip_full, &cur_status, full_len);
+	if (delta_len > 0)
+		grfio->encode_zip(zip_buf, &zip_delta, tcase.delta, delta_len);
+	else
+		zip_delta = 0;
+
+	ShowInfo("%-16s full %d bytes, full+zlib %lu, delta %d, delta+zlib %lu\n",
+		name, full_len, zip_full, delta_len, delta_len > CHRIF_SAVE_COMPRESS_MIN ? zip_delta : (unsigned long)delta_len);
+}
+
+static void change_walk(struct mmo_charstatus *cs)
+{
+	cs->last_point.x += 15;
+	cs->last_point.y -= 7;
+}
+
+static void change_hunt(struct mmo_charstatus *cs)
+{
+	change_walk(cs);
+	cs->base_exp += 123456;
+	cs->job_exp += 65432;
+	cs->zeny += 1500;
+	cs->inventory[3].amount -= 5;
+	cs->inventory[MAX_INVENTORY / 2].id = MAX_INVENTORY / 2 + 1;
+	cs->inventory[MAX_INVENTORY / 2].nameid = 7005;
+	cs->inventory[MAX_INVENTORY / 2].amount = 12;
+}
+
+static void change_unchanged(struct mmo_charstatus *cs)
+{
+}
+
+static void map_tests(void)
+{
+	if ((cases_fp = fopen(CASES_FILE, "wb")) == NULL) {
+		ShowFatalError("Failed to create %s.\n", CASES_FILE);
+		exit(EXIT_FAILURE);
+	}
+
+	TEST("Unchanged character", test_unchanged);
+	TEST("Changes at the edges", test_edges);
+	TEST("Random changes", test_random);
+	fclose(cases_fp);
+	cases_fp = NULL;
+	ShowInfo("Test cases written to %s, check them with ./char-server --load-plugin test_chrif_save\n", CASES_FILE);
+
+	ShowMessage("===============================================================================\n");
+	ShowStatus("Starting benchmark.\n");
+	benchmark("unchanged", change_unchanged);
+	benchmark("walking", change_walk);
+	benchmark("hunting", change_hunt);
+}
+
+/*==========================================
+ * Char-server: decoding
+ *------------------------------------------*/
+
+/// Decodes every test case written by the map-server.
+static const char *test_decode(void)
+{
+	FILE *fp = fopen(CASES_FILE, "rb");
+	const char *message = NULL;
+	int count = 0;
+
+	if (fp == NULL) {
+		snprintf(out_message, sizeof(out_message), "%s not found, run ./map-server --load-plugin test_chrif_save first", CASES_FILE);
+		return out_message;
+	}
+
+	fill_status(&base_status);
+	while (message == NULL && fread(&tcase, sizeof(tcase), 1, fp) == 1) {
+		count++;
+		apply_changes(&tcase);
+		memcpy(&decoded_status, &base_status, sizeof(decoded_status));
+		if (!chr->save_delta_apply(&decoded_status, tcase.delta, tcase.len)) {
+			snprintf(out_message, sizeof(out_message), "Case %d: invalid delta of %d bytes", count, tcase.len);
+			message = out_message;
+		} else if (memcmp(&decoded_status, &cur_status, sizeof(cur_status)) != 0) {
+			snprintf(out_message, sizeof(out_message), "Case %d: decoded data differs from the original", count);
+			message = out_message;
+		}
+	}
+	if (message == NULL && (ferror(fp) || count == 0)) {
+		snprintf(out_message, sizeof(out_message), "Failed to read the test cases from %s", CASES_FILE);
+		message = out_message;
+	}
+	fclose(fp);
+	if (message == NULL)
+		ShowInfo("%d cases decoded.\n", count);
+	return message;
+}
+
+/// Deltas that don't fit in the character are refused.
+static const char *test_invalid(void)
+{
+	uint8 data[8] = { 0 };
+
+	fill_status(&decoded_status);
+	WBUFW(data, 0) = 0;
+	WBUFW(data, 2) = 4;
+	if (chr->save_delta_apply(&decoded_status, data, 3))
+		return "Truncated run header accepted";
+	if (chr->save_delta_apply(&decoded_status, data, 6))
+		return "Run longer than the data accepted";
+	WBUFW(data, 0) = (uint16)(sizeof(decoded_status) - 2);
+	if (chr->save_delta_apply(&decoded_status, data, 8))
+		return "Run past the end of the character accepted";
+	return NULL;
+}
+
+static void char_tests(void)
+{
+	TEST("Decoding of the map-server deltas", test_decode);
+	TEST("Invalid deltas", test_invalid);
+}
+
+HPExport void plugin_init(void)
+{
+}
+
+HPExport void server_online(void)
+{
+	ShowMessage("===============================================================================\n");
+	ShowStatus("Starting tests.\n");
+
+	if (SERVER_TYPE == SERVER_TYPE_MAP)
+		map_tests();
+	else
+		char_tests();
+
+	ShowMessage("===============================================================================\n");
+	ShowStatus("All tests passed.\n");
+	if (SERVER_TYPE == SERVER_TYPE_MAP)
+		map->do_shutdown();
+	else
+		core->runflag = CORE_ST_STOP;
+}
+
+HPExport void plugin_final(void)
+{
+}
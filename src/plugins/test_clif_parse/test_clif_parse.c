@@ -0,0 +1,388 @@
+/**
+ * This file is part of Hercules.
+ * http://herc.ws - http://github.com/HerculesWS/Hercules
+ *
+ * Copyright (C) 2026 Hercules Dev Team
+ *
+ * Hercules is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Consistency test of the packet dispatch table (clif->packet_dispatch) and
+ * replay benchmark of clif->parse.
+ *
+ * A client packet stream is fed through clif->parse on a session without
+ * character, so that packets are decoded and dispatched but their handlers
+ * (which need a character on a map) are not run. The stream is either
+ * generated from the most frequent client packets or read from a capture:
+ * the raw bytes sent by a client to the map-server, without obfuscation
+ * (e.g. a TCP stream exported from wireshark). Packets which are only valid
+ * before authentication are dropped from captures.
+ *
+ * Usage: ./map-server --load-plugin test_clif_parse [--replay-file <capture>]
+ */
+
+#include "common/hercules.h"
+#include "common/core.h"
+#include "common/memmgr.h"
+#include "common/nullpo.h"
+#include "common/packets.h"
+#include "common/random.h"
+#include "common/showmsg.h"
+#include "common/socket.h"
+#include "common/timer.h"
+#include "map/clif.h"
+#include "map/map.h"
+
+#include "common/HPMDataCheck.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+HPExport struct hplugin_info pinfo = {
+	"test_clif_parse", ///< Plugin name
+	SERVER_TYPE_MAP,   ///< Plugin type
+	"0.1",             ///< Plugin version
+	HPM_VERSION,       ///< HPM Version
+};
+
+#define TEST(name, function, ...) do { \
+	const char *message = NULL; \
+	ShowMessage("-------------------------------------------------------------------------------\n"); \
+	ShowNotice("Testing %s...\n", (name)); \
+	if ((message = (function)(__VA_ARGS__)) != NULL) { \
+		ShowError("Failed. %s\n", message); \
+		ShowMessage("===============================================================================\n"); \
+		ShowFatalError("Failure. Aborting further tests.\n"); \
+		exit(EXIT_FAILURE); \
+	} \
+	ShowInfo("Test passed.\n"); \
+} while (false)
+
+#define SYNTHETIC_PACKETS 200000  ///< Packets in the generated stream
+#define REPLAY_MIN_PACKETS 2000000 ///< The stream is replayed until at least this many packets were parsed
+
+struct replay_stream {
+	uint8 *data;
+	size_t len;
+	int packets;
+};
+
+static char *replay_file = NULL;
+static char out_message[256];
+
+/// Monotonic time in microseconds.
+static int64 now_us(void)
+{
+#ifdef WIN32
+	return timer->gettick_nocache() * 1000;
+#else
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#endif
+}
+
+static const char *test_dispatch_table(void)
+{
+	for (int cmd = 0; cmd <= MAX_PACKET_DB; cmd++) {
+		const struct s_packet_dispatch *dispatch = clif->packet_dispatch(cmd);
+		const struct s_packet_db *entry = clif->packet(cmd);
+
+		if ((dispatch == NULL) != (entry == NULL)) {
+			snprintf(out_message, sizeof out_message, "packet 0x%04x: dispatch entry %s, packet_db entry %s",
+				(unsigned int)cmd, dispatch ? "found" : "missing", entry ? "found" : "missing");
+			return out_message;
+		}
+		if (dispatch == NULL)
+			continue;
+		if (dispatch->func != entry->func) {
+			snprintf(out_message, sizeof out_message, "packet 0x%04x: handler mismatch", (unsigned int)cmd);
+			return out_message;
+		}
+		if (dispatch->len != packets->db[cmd]) {
+			snprintf(out_message, sizeof out_message, "packet 0x%04x: length %d, expected %d", (unsigned int)cmd, dispatch->len, packets->db[cmd]);
+			return out_message;
+		}
+		if (dispatch->min_len != (dispatch->len == -1 ? 4 : dispatch->len)) {
+			snprintf(out_message, sizeof out_message, "packet 0x%04x: minimum length %u", (unsigned int)cmd, (unsigned int)dispatch->min_len);
+			return out_message;
+		}
+		if (((dispatch->flags & PACKET_DISPATCH_NO_SESSION) != 0) != (entry->func != NULL && entry->func == clif->pWantToConnection)
+		 || ((dispatch->flags & PACKET_DISPATCH_OFF_MAP) != 0) != (entry->func != NULL && entry->func == clif->pLoadEndAck)
+		 || ((dispatch->flags & PACKET_DISPATCH_ALWAYS) != 0) != (entry->func != NULL && entry->func == clif->pDebug)) {
+			snprintf(out_message, sizeof out_message, "packet 0x%04x: wrong flags 0x%x", (unsigned int)cmd, (unsigned int)dispatch->flags);
+			return out_message;
+		}
+	}
+	return NULL;
+}
+
+/// Finds the packet ID handled by func (packet IDs are shuffled by PACKETVER).
+static int find_packet(pFunc func)
+{
+	for (int cmd = MIN_PACKET_DB; cmd <= MAX_PACKET_DB; cmd++) {
+		const struct s_packet_dispatch *dispatch = clif->packet_dispatch(cmd);
+		if (dispatch != NULL && dispatch->func == func)
+			return cmd;
+	}
+	return 0;
+}
+
+static void stream_append(struct replay_stream *stream, size_t *allocated, const uint8 *packet, size_t len)
+{
+	nullpo_retv(stream);
+	nullpo_retv(allocated);
+	nullpo_retv(packet);
+
+	if (stream->len + len > *allocated) {
+		*allocated = max(*allocated * 2, stream->len + len);
+		RECREATE(stream->data, uint8, *allocated);
+	}
+	memcpy(stream->data + stream->len, packet, len);
+	stream->len += len;
+	stream->packets++;
+}
+
+/// Generates a stream of the packets a playing client sends most often.
+static bool stream_generate(struct replay_stream *stream)
+{
+	const struct {
+		pFunc func;
+		int weight;
+	} mix[] = {
+		{ clif->pWalkToXY,      40 },
+		{ clif->pTickSend,      15 },
+		{ clif->pActionRequest, 15 },
+		{ clif->pChangeDir,     10 },
+		{ clif->pUseSkillToId,  10 },
+		{ clif->pGlobalMessage, 10 },
+	};
+	int ids[ARRAYLENGTH(mix)];
+	int total_weight = 0;
+	size_t allocated = 0;
+	uint8 packet[128];
+
+	nullpo_retr(false, stream);
+
+	for (int i = 0; i < ARRAYLENGTH(mix); i++) {
+		if ((ids[i] = find_packet(mix[i].func)) == 0)
+			continue; // not supported by this PACKETVER
+		total_weight += mix[i].weight;
+	}
+	if (total_weight == 0) {
+		ShowError("test_clif_parse: none of the benchmark packets is supported by this PACKETVER.\n");
+		return false;
+	}
+
+	memset(stream, 0, sizeof(*stream));
+	for (int n = 0; n < SYNTHETIC_PACKETS; n++) {
+		int r = rnd->value(0, total_weight - 1);
+		int i;
+		for (i = 0; i < ARRAYLENGTH(mix); i++) {
+			if (ids[i] == 0)
+				continue;
+			if (r < mix[i].weight)
+				break;
+			r -= mix[i].weight;
+		}
+
+		int len = packets->db[ids[i]];
+		memset(packet, 0, sizeof(packet));
+		WBUFW(packet, 0) = ids[i];
+		if (len == -1) {
+			len = 4 + rnd->value(16, 64);
+			WBUFW(packet, 2) = len;
+		}
+		if (len > (int)sizeof(packet))
+			continue;
+		stream_append(stream, &allocated, packet, len);
+	}
+	return true;
+}
+
+/// Reads a captured client stream, keeping only the packets that can be replayed.
+static bool stream_load(struct replay_stream *stream, const char *filename)
+{
+	FILE *fp;
+	uint8 *capture;
+	long size;
+	size_t pos = 0, allocated = 0;
+	int dropped = 0;
+
+	nullpo_retr(false, stream);
+	nullpo_retr(false, filename);
+
+	if ((fp = fopen(filename, "rb")) == NULL) {
+		ShowError("test_clif_parse: can't open '%s'.\n", filename);
+		return false;
+	}
+	fseek(fp, 0, SEEK_END);
+	size = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+	if (size <= 0) {
+		ShowError("test_clif_parse: '%s' is empty.\n", filename);
+		fclose(fp);
+		return false;
+	}
+	capture = aMalloc(size);
+	if (fread(capture, 1, size, fp) != (size_t)size) {
+		ShowError("test_clif_parse: can't read '%s'.\n", filename);
+		aFree(capture);
+		fclose(fp);
+		return false;
+	}
+	fclose(fp);
+
+	memset(stream, 0, sizeof(*stream));
+	while (pos + 2 <= (size_t)size) {
+		int cmd = RBUFW(capture, pos);
+		const struct s_packet_dispatch *dispatch = clif->packet_dispatch(cmd);
+		int len;
+
+		if (dispatch == NULL) {
+			ShowWarning("test_clif_parse: unsupported packet 0x%04x at offset %"PRIuS" of '%s', ignoring the rest of the capture.\n", (unsigned int)cmd, pos, filename);
+			break;
+		}
+		if ((len = dispatch->len) == -1) {
+			if (pos + 4 > (size_t)size)
+				break;
+			len = RBUFW(capture, pos + 2);
+			if (len < 4) {
+				ShowWarning("test_clif_parse: invalid length of packet 0x%04x at offset %"PRIuS" of '%s', ignoring the rest of the capture.\n", (unsigned int)cmd, pos, filename);
+				break;
+			}
+		}
+		if (pos + len > (size_t)size)
+			break; // truncated
+		if ((dispatch->flags & PACKET_DISPATCH_NO_SESSION) != 0)
+			dropped++;
+		else
+			stream_append(stream, &allocated, capture + pos, len);
+		pos += len;
+	}
+	aFree(capture);
+
+	ShowInfo("Loaded %d packets (%"PRIuS" bytes) from '%s', %d dropped.\n", stream->packets, stream->len, filename, dropped);
+	return stream->packets > 0;
+}
+
+/// Feeds the whole stream through clif->parse, returns false if the session was disconnected.
+static bool replay(int fd, const struct replay_stream *stream)
+{
+	struct socket_data *session = sockt->session[fd];
+
+	nullpo_retr(false, stream);
+
+	memcpy(session->rdata, stream->data, stream->len);
+	session->rdata_pos = 0;
+	session->rdata_size = stream->len;
+
+	while (RFIFOREST(fd) > 0) {
+		size_t rest = RFIFOREST(fd);
+		clif->parse(fd);
+		if (session->flag.eof != 0 || RFIFOREST(fd) == rest)
+			return false;
+	}
+	return true;
+}
+
+static void benchmark(const char *name, const struct replay_stream *stream)
+{
+	int fd;
+	int64 parsed = 0;
+
+	nullpo_retv(stream);
+
+	// First slot past the sockets in use, it is not processed by the socket loop.
+	fd = sockt->fd_max;
+	if (fd <= 0 || sockt->session[fd] != NULL) {
+		ShowError("test_clif_parse: no free session.\n");
+		return;
+	}
+	sockt->create_session(fd, NULL, NULL, clif->parse, NULL, NULL);
+	sockt->realloc_fifo(fd, (unsigned int)stream->len, (unsigned int)sockt->session[fd]->max_wdata);
+
+	unsigned short (*parse_cmd)(int fd, struct map_session_data *sd) = clif->parse_cmd;
+	clif->parse_cmd = clif->parse_cmd_normal; // streams are not obfuscated
+
+	int64 start = now_us();
+	while (parsed < REPLAY_MIN_PACKETS) {
+		if (!replay(fd, stream)) {
+			ShowError("test_clif_parse: %s: session disconnected after %"PRId64" packets.\n", name, parsed);
+			break;
+		}
+		parsed += stream->packets;
+	}
+	int64 elapsed = max(now_us() - start, 1);
+
+	clif->parse_cmd = parse_cmd;
+	aFree(sockt->session[fd]->rdata);
+	aFree(sockt->session[fd]->wdata);
+	aFree(sockt->session[fd]);
+	sockt->session[fd] = NULL;
+
+	ShowInfo("%-10s %"PRId64" packets (%d per replay) in %"PRId64" ms: %"PRId64" packets/s\n",
+			name, parsed, stream->packets, elapsed / 1000, parsed * 1000000 / elapsed);
+}
+
+CMDLINEARG(replayfile)
+{
+	aFree(replay_file);
+	replay_file = aStrdup(params);
+	return true;
+}
+
+HPExport void server_preinit(void)
+{
+	addArg("--replay-file", true, replayfile,
+			"Client packet capture replayed by the test_clif_parse benchmark (usage: --replay-file <file>).");
+}
+
+HPExport void plugin_init(void)
+{
+}
+
+HPExport void server_online(void)
+{
+	struct replay_stream stream;
+
+	ShowMessage("===============================================================================\n");
+	ShowStatus("Starting tests.\n");
+
+	TEST("Packet dispatch table", test_dispatch_table);
+
+	ShowMessage("===============================================================================\n");
+	ShowStatus("Starting benchmark.\n");
+	if (stream_generate(&stream)) {
+		benchmark("synthetic", &stream);
+		aFree(stream.data);
+	}
+	if (replay_file != NULL && stream_load(&stream, replay_file)) {
+		benchmark("capture", &stream);
+		aFree(stream.data);
+	}
+
+	ShowMessage("===============================================================================\n");
+	ShowStatus("All tests passed.\n");
+	map->do_shutdown();
+}
+
+HPExport void plugin_final(void)
+{
+	aFree(replay_file);
+	replay_file = NULL;
+}
@@ -0,0 +1,393 @@
+/**
+ * This file is part of Hercules.
+ * http://herc.ws - http://github.com/HerculesWS/Hercules
+ *
+ * Copyright (C) 2026 Hercules Dev Team
+ *
+ * Hercules is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Tests and load benchmark of the DNS blacklist lookups (dnsbl->check),
+ * against a stand-in DNS server running on a local UDP port:
+ * - listed.test lists ips with an odd last octet,
+ * - clean.test lists nothing,
+ * - slow.test never answers.
+ *
+ * Usage: ./login-server --load-plugin test_dnsbl
+ */
+
+#include "common/hercules.h"
+#include "common/core.h"
+#include "common/memmgr.h"
+#include "common/mutex.h"
+#include "common/nullpo.h"
+#include "common/showmsg.h"
+#include "common/socket.h"
+#include "common/strlib.h"
+#include "common/thread.h"
+#include "common/timer.h"
+#include "login/dnsbl.h"
+#include "login/login.h"
+
+#include "common/HPMDataCheck.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef WIN32
+#	include "common/winapi.h"
+#else
+#	include <arpa/inet.h>
+#	include <netinet/in.h>
+#	include <sys/socket.h>
+#	include <sys/time.h>
+#	include <unistd.h>
+#endif
+
+HPExport struct hplugin_info pinfo = {
+	"test_dnsbl",      ///< Plugin name
+	SERVER_TYPE_LOGIN, ///< Plugin type
+	"0.1",             ///< Plugin version
+	HPM_VERSION,       ///< HPM Version
+};
+
+#define TEST(name, function, ...) do { \
+	const char *message = NULL; \
+	ShowMessage("-------------------------------------------------------------------------------\n"); \
+	ShowNotice("Testing %s...\n", (name)); \
+	if ((message = (function)(__VA_ARGS__)) != NULL) { \
+		ShowError("Failed. %s\n", message); \
+		ShowMessage("===============================================================================\n"); \
+		ShowFatalError("Failure. Aborting further tests.\n"); \
+		exit(EXIT_FAILURE); \
+	} \
+	ShowInfo("Test passed.\n"); \
+} while (false)
+
+#define BENCH_IPS 5000        ///< Distinct ips checked by the benchmark
+#define BENCH_IN_FLIGHT 200   ///< Lookups in progress at the same time
+
+static char out_message[256];
+
+static struct {
+#ifdef WIN32
+	SOCKET fd;
+#else
+	int fd;
+#endif
+	uint16 port;
+	struct thread_handle *thread;
+	struct mutex_data *mutex;
+	bool running;               ///< guarded by mutex
+} standin;
+
+static void test_sleep_ms(int ms)
+{
+#ifdef WIN32
+	Sleep(ms);
+#else
+	usleep(ms * 1000);
+#endif
+}
+
+static bool standin_is_running(void)
+{
+	bool running;
+	mutex->lock(standin.mutex);
+	running = standin.running;
+	mutex->unlock(standin.mutex);
+	return running;
+}
+
+/// Stand-in DNS server thread.
+static void *standin_main(void *param)
+{
+	while (standin_is_running()) {
+		uint8 buf[512];
+		struct sockaddr_in from;
+#ifdef WIN32
+		int from_len = sizeof(from);
+#else
+		socklen_t from_len = sizeof(from);
+#endif
+		const int len = (int)recvfrom(standin.fd, (char *)buf, sizeof(buf), 0, (struct sockaddr *)&from, &from_len);
+		char name[256];
+		int pos = 12, name_len = 0, octet = 0;
+		bool listed;
+
+		if (len < 12 + 5)
+			continue; // receive timeout, check the running flag again
+
+		// decode the question name
+		while (pos < len && buf[pos] != 0 && name_len < (int)sizeof(name) - 65) {
+			const int label_len = buf[pos++];
+			if (pos + label_len > len)
+				break;
+			if (name_len > 0)
+				name[name_len++] = '.';
+			memcpy(name + name_len, buf + pos, label_len);
+			name_len += label_len;
+			pos += label_len;
+		}
+		name[name_len] = '\0';
+		pos += 1 + 4; // end of name, type and class
+		if (pos > len)
+			continue;
+
+		// the first label is the last octet of the ip
+		octet = atoi(name);
+		if (strstr(name, ".slow.test") != NULL)
+			continue;
+		listed = (strstr(name, ".listed.test") != NULL && (octet % 2) == 1);
+
+		buf[2] = 0x81; // response, recursion desired
+		buf[3] = listed ? 0x80 : 0x83; // recursion available, NOERROR / NXDOMAIN
+		buf[6] = 0;
+		buf[7] = listed ? 1 : 0;
+		buf[8] = buf[9] = buf[10] = buf[11] = 0;
+		if (listed) {
+			const uint8 answer[] = {
+				0xC0, 0x0C,             // name: pointer to the question
+				0x00, 0x01, 0x00, 0x01, // type A, class IN
+				0x00, 0x00, 0x00, 0x3C, // ttl
+				0x00, 0x04, 127, 0, 0, 2,
+			};
+			memcpy(buf + pos, answer, sizeof(answer));
+			pos += sizeof(answer);
+		}
+		sendto(standin.fd, (const char *)buf, pos, 0, (struct sockaddr *)&from, from_len);
+	}
+	return NULL;
+}
+
+static bool standin_start(void)
+{
+	struct sockaddr_in addr;
+#ifdef WIN32
+	int addr_len = sizeof(addr);
+	DWORD timeout = 100;
+#else
+	socklen_t addr_len = sizeof(addr);
+	struct timeval timeout = { 0, 100 * 1000 };
+#endif
+
+	standin.fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	addr.sin_port = 0;
+	if (bind(standin.fd, (struct sockaddr *)&addr, sizeof(addr)) != 0
+	 || getsockname(standin.fd, (struct sockaddr *)&addr, &addr_len) != 0) {
+		ShowError("test_dnsbl: can't bind stand-in DNS server.\n");
+		return false;
+	}
+	setsockopt(standin.fd, SOL_SOCKET, SO_RCVTIMEO, (const char *)&timeout, sizeof(timeout));
+	standin.port = ntohs(addr.sin_port);
+
+	standin.mutex = mutex->create();
+	standin.running = true;
+	if ((standin.thread = thread->create(standin_main, NULL)) == NULL) {
+		ShowError("test_dnsbl: can't start stand-in DNS server thread.\n");
+		return false;
+	}
+	ShowStatus("Stand-in DNS server listening on 127.0.0.1:%u.\n", standin.port);
+	return true;
+}
+
+static void standin_stop(void)
+{
+	if (standin.thread == NULL)
+		return;
+	mutex->lock(standin.mutex);
+	standin.running = false;
+	mutex->unlock(standin.mutex);
+	thread->wait(standin.thread, NULL);
+	standin.thread = NULL;
+	mutex->destroy(standin.mutex);
+#ifdef WIN32
+	closesocket(standin.fd);
+#else
+	close(standin.fd);
+#endif
+}
+
+static void set_servers(const char *const *servers, int count)
+{
+	login->clear_dnsbl_servers();
+	VECTOR_ENSURE(login->config->dnsbl_servers, count, 1);
+	for (int i = 0; i < count; i++)
+		VECTOR_PUSH(login->config->dnsbl_servers, aStrdup(servers[i]));
+}
+
+/// Polls dnsbl->check until the lookup of ip is finished, the same as lclif->parse does.
+static enum dnsbl_status wait_check(uint32 ip, int64 *elapsed)
+{
+	const int64 start = timer->gettick_nocache();
+	enum dnsbl_status status;
+
+	while ((status = dnsbl->check(ip)) == DNSBL_PENDING && DIFF_TICK(timer->gettick_nocache(), start) < 10000)
+		test_sleep_ms(1);
+	if (elapsed != NULL)
+		*elapsed = DIFF_TICK(timer->gettick_nocache(), start);
+	return status;
+}
+
+static const char *expect_status(uint32 ip, enum dnsbl_status expected)
+{
+	enum dnsbl_status status = wait_check(ip, NULL);
+	if (status != expected) {
+		char ip_str[16];
+		snprintf(out_message, sizeof(out_message), "%s: status %u (expected %u)", sockt->ip2str(ip, ip_str), status, expected);
+		return out_message;
+	}
+	return NULL;
+}
+
+static const char *test_answers(void)
+{
+	const char *servers[] = { "listed.test", "clean.test" };
+	const char *result;
+
+	set_servers(servers, ARRAYLENGTH(servers));
+	if (dnsbl->check(0x0A000001) != DNSBL_PENDING)
+		return "First check of an ip didn't start a lookup.";
+	if ((result = expect_status(0x0A000001, DNSBL_LISTED)) != NULL)
+		return result;
+	if ((result = expect_status(0x0A000002, DNSBL_CLEAN)) != NULL)
+		return result;
+	return NULL;
+}
+
+static const char *test_cache(void)
+{
+	const int hits = dnsbl->stats.cache_hits;
+	const int checks = dnsbl->stats.checks;
+
+	if (dnsbl->check(0x0A000001) != DNSBL_LISTED || dnsbl->check(0x0A000002) != DNSBL_CLEAN)
+		return "Cached answers weren't returned immediately.";
+	if (dnsbl->stats.cache_hits != hits + 2 || dnsbl->stats.checks != checks)
+		return "Cached answers started new lookups.";
+
+	// expired entries are looked up again
+	dnsbl->cache_store(0x0A000001, false, 0);
+	if (dnsbl->check(0x0A000001) != DNSBL_PENDING)
+		return "Expired cache entry didn't start a new lookup.";
+	return expect_status(0x0A000001, DNSBL_LISTED);
+}
+
+static const char *test_timeout(void)
+{
+	const char *servers[] = { "listed.test", "clean.test", "slow.test" };
+	const int timeouts = dnsbl->stats.timeouts;
+	const int saved_timeout = dnsbl->timeout;
+	int64 elapsed = 0;
+	enum dnsbl_status status;
+
+	set_servers(servers, ARRAYLENGTH(servers));
+	dnsbl->timeout = 300;
+
+	status = wait_check(0x0A000004, &elapsed);
+	if (status != DNSBL_CLEAN || elapsed < 300 || elapsed > 1000) {
+		snprintf(out_message, sizeof(out_message), "Clean ip with a slow server: status %u after %"PRId64" ms (expected %u after 300 ms)", status, elapsed, (unsigned int)DNSBL_CLEAN);
+		dnsbl->timeout = saved_timeout;
+		return out_message;
+	}
+	// answers received before the timeout still count
+	status = wait_check(0x0A000005, &elapsed);
+	dnsbl->timeout = saved_timeout;
+	if (status != DNSBL_LISTED)
+		return "Listed ip with a slow server wasn't blacklisted after the timeout.";
+	if (dnsbl->stats.timeouts != timeouts + 2)
+		return "Timeouts weren't counted.";
+	return NULL;
+}
+
+static void benchmark(void)
+{
+	const char *servers[] = { "listed.test", "clean.test" };
+	int64 start, elapsed, check_max = 0;
+	int next = 0, done = 0, listed = 0;
+	uint32 *in_flight = NULL;
+	int in_flight_count = 0;
+
+	set_servers(servers, ARRAYLENGTH(servers));
+	CREATE(in_flight, uint32, BENCH_IN_FLIGHT);
+
+	start = timer->gettick_nocache();
+	while (done < BENCH_IPS) {
+		while (in_flight_count < BENCH_IN_FLIGHT && next < BENCH_IPS)
+			in_flight[in_flight_count++] = 0x0B000000 + (uint32)next++;
+
+		for (int i = 0; i < in_flight_count; ) {
+			const int64 call_start = timer->gettick_nocache();
+			enum dnsbl_status status = dnsbl->check(in_flight[i]);
+			check_max = max(check_max, DIFF_TICK(timer->gettick_nocache(), call_start));
+
+			if (status == DNSBL_PENDING) {
+				i++;
+				continue;
+			}
+			if (status == DNSBL_LISTED)
+				listed++;
+			done++;
+			in_flight[i] = in_flight[--in_flight_count];
+		}
+		test_sleep_ms(1);
+	}
+	elapsed = max(DIFF_TICK(timer->gettick_nocache(), start), 1);
+	aFree(in_flight);
+
+	ShowInfo("%d ips, %d in flight, %d dnsbl servers: %"PRId64" ms, %"PRId64" lookups/s, %d listed, slowest dnsbl->check call %"PRId64" ms\n",
+		BENCH_IPS, BENCH_IN_FLIGHT, ARRAYLENGTH(servers), elapsed, (int64)BENCH_IPS * 1000 / elapsed, listed, check_max);
+	dnsbl->report();
+}
+
+HPExport void plugin_init(void)
+{
+}
+
+HPExport void server_online(void)
+{
+	ShowMessage("===============================================================================\n");
+	if (!standin_start()) {
+		core->runflag = CORE_ST_STOP;
+		return;
+	}
+	login->config->use_dnsbl = true;
+	dnsbl->resolver_ip = 0x7F000001;
+	dnsbl->resolver_port = standin.port;
+	db_clear(dnsbl->cache);
+
+	ShowStatus("Starting tests.\n");
+	TEST("Answers of the dnsbl servers", test_answers);
+	TEST("Cached answers", test_cache);
+	TEST("Lookup timeout", test_timeout);
+
+	ShowMessage("===============================================================================\n");
+	ShowStatus("Starting benchmark.\n");
+	benchmark();
+
+	ShowMessage("===============================================================================\n");
+	ShowStatus("All tests passed.\n");
+	core->runflag = CORE_ST_STOP;
+}
+
+HPExport void plugin_final(void)
+{
+	// resolver threads may still be waiting on the stand-in server
+	dnsbl->stop_workers();
+	standin_stop();
+}
@@ -0,0 +1,236 @@
+/**
+ * This file is part of Hercules.
+ * http://herc.ws - http://github.com/HerculesWS/Hercules
+ *
+ * Copyright (C) 2026 Hercules Dev Team
+ *
+ * Hercules is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Consistency test and microbenchmark for the item ID to inventory slot index
+ * (pc->inventory_index_*), compared against a plain linear inventory scan.
+ *
+ * Usage: ./map-server --load-plugin test_inventory_index
+ */
+
+#include "common/hercules.h"
+#include "common/core.h"
+#include "common/memmgr.h"
+#include "common/nullpo.h"
+#include "common/random.h"
+#include "common/showmsg.h"
+#include "common/timer.h"
+#include "map/map.h"
+#include "map/pc.h"
+
+#include "common/HPMDataCheck.h"
+
+#include <stdlib.h>
+
+HPExport struct hplugin_info pinfo = {
+	"test_inventory_index", ///< Plugin name
+	SERVER_TYPE_MAP,        ///< Plugin type
+	"0.1",                  ///< Plugin version
+	HPM_VERSION,            ///< HPM Version
+};
+
+#define TEST(name, function, ...) do { \
+	const char *message = NULL; \
+	ShowMessage("-------------------------------------------------------------------------------\n"); \
+	ShowNotice("Testing %s...\n", (name)); \
+	if ((message = (function)(__VA_ARGS__)) != NULL) { \
+		ShowError("Failed. %s\n", message); \
+		ShowMessage("===============================================================================\n"); \
+		ShowFatalError("Failure. Aborting further tests.\n"); \
+		exit(EXIT_FAILURE); \
+	} \
+	ShowInfo("Test passed.\n"); \
+} while (false)
+
+#define DISTINCT_ITEMS 64          ///< Amount of distinct item IDs used to fill inventories
+#define MUTATIONS 100000           ///< Random slot changes done by the consistency test
+#define LOOKUPS 2000000            ///< Lookups done by each benchmark run
+
+static char out_message[256];
+
+/// Item ID used for the i-th distinct item (spread out, to exercise hash collisions).
+static int item_id(int i)
+{
+	return 500 + i * 97;
+}
+
+/// Reference implementation: the first slot holding nameid (pc->search_inventory semantics).
+static int linear_search(const struct map_session_data *sd, int nameid)
+{
+	int i;
+	ARR_FIND(0, sd->status.inventorySize, i, sd->status.inventory[i].nameid == nameid && (sd->status.inventory[i].amount > 0 || nameid == 0));
+	return (i < sd->status.inventorySize) ? i : INDEX_NOT_FOUND;
+}
+
+/// Reference implementation: total amount held of nameid (countitem semantics).
+static int linear_count(const struct map_session_data *sd, int nameid)
+{
+	int count = 0;
+	for (int i = 0; i < sd->status.inventorySize; i++) {
+		if (sd->status.inventory[i].nameid == nameid)
+			count += sd->status.inventory[i].amount;
+	}
+	return count;
+}
+
+static int indexed_count(struct map_session_data *sd, int nameid)
+{
+	int count = 0;
+	for (int i = pc->inventory_index_first(sd, nameid); i != INDEX_NOT_FOUND && i < sd->status.inventorySize; i = pc->inventory_index_next(sd, i))
+		count += sd->status.inventory[i].amount;
+	return count;
+}
+
+static void set_slot(struct map_session_data *sd, int n, int nameid)
+{
+	sd->status.inventory[n].nameid = nameid;
+	sd->status.inventory[n].amount = nameid != 0 ? 1 + rnd->value(0, 99) : 0;
+	pc->inventory_index_update(sd, n);
+}
+
+static struct map_session_data *make_sd(int fill_percent)
+{
+	struct map_session_data *sd = pc->get_dummy_sd();
+	sd->status.inventorySize = FIXED_INVENTORY_SIZE;
+	for (int n = 0; n < MAX_INVENTORY; n++) {
+		if (n < FIXED_INVENTORY_SIZE && rnd->value(0, 99) < fill_percent) {
+			sd->status.inventory[n].nameid = item_id(rnd->value(0, DISTINCT_ITEMS - 1));
+			sd->status.inventory[n].amount = 1 + rnd->value(0, 99);
+		}
+	}
+	return sd;
+}
+
+static const char *compare(struct map_session_data *sd)
+{
+	nullpo_retr("NULL pointer (sd)", sd);
+
+	if (!pc->inventory_index_check(sd))
+		return "pc->inventory_index_check reported an inconsistency";
+
+	for (int i = -1; i < DISTINCT_ITEMS + 1; i++) {
+		int nameid = i < 0 ? 0 : item_id(i);
+		int expected = linear_search(sd, nameid);
+		int found = pc->search_inventory(sd, nameid);
+		if (expected != found) {
+			snprintf(out_message, sizeof out_message, "search_inventory(%d): got slot %d, expected %d", nameid, found, expected);
+			return out_message;
+		}
+		if (linear_count(sd, nameid) != indexed_count(sd, nameid)) {
+			snprintf(out_message, sizeof out_message, "count(%d): got %d, expected %d", nameid, indexed_count(sd, nameid), linear_count(sd, nameid));
+			return out_message;
+		}
+	}
+	return NULL;
+}
+
+static const char *test_lazy_build(void)
+{
+	struct map_session_data *sd = make_sd(60);
+	const char *result = compare(sd); // Built on first lookup
+	aFree(sd);
+	return result;
+}
+
+static const char *test_mutations(void)
+{
+	struct map_session_data *sd = make_sd(60);
+	const char *result = NULL;
+
+	pc->inventory_index_build(sd);
+	for (int i = 0; i < MUTATIONS && result == NULL; i++) {
+		int n = rnd->value(0, MAX_INVENTORY - 1);
+		set_slot(sd, n, rnd->value(0, 2) == 0 ? 0 : item_id(rnd->value(0, DISTINCT_ITEMS - 1)));
+		if (i % 1000 == 0)
+			result = compare(sd);
+	}
+	if (result == NULL)
+		result = compare(sd);
+	aFree(sd);
+	return result;
+}
+
+static const char *test_inventory_expansion(void)
+{
+	struct map_session_data *sd = make_sd(100);
+	const char *result = compare(sd);
+
+	sd->status.inventorySize = MAX_INVENTORY;
+	if (result == NULL)
+		result = compare(sd);
+	aFree(sd);
+	return result;
+}
+
+static void benchmark(int fill_percent)
+{
+	struct map_session_data *sd = make_sd(fill_percent);
+	int *queries = NULL;
+	int64 sum_linear = 0, sum_indexed = 0;
+
+	CREATE(queries, int, LOOKUPS);
+	for (int i = 0; i < LOOKUPS; i++)
+		queries[i] = item_id(rnd->value(0, DISTINCT_ITEMS * 2 - 1)); // Half of them are misses
+	pc->inventory_index_build(sd);
+
+	int64 tick = timer->gettick_nocache();
+	for (int i = 0; i < LOOKUPS; i++)
+		sum_linear += linear_search(sd, queries[i]) + linear_count(sd, queries[i]);
+	int64 linear_ms = timer->gettick_nocache() - tick;
+
+	tick = timer->gettick_nocache();
+	for (int i = 0; i < LOOKUPS; i++)
+		sum_indexed += pc->search_inventory(sd, queries[i]) + indexed_count(sd, queries[i]);
+	int64 indexed_ms = timer->gettick_nocache() - tick;
+
+	ShowInfo("%3d%% full inventory, %d lookups: linear %"PRId64" ms, indexed %"PRId64" ms%s\n",
+			fill_percent, LOOKUPS, linear_ms, indexed_ms, sum_linear == sum_indexed ? "" : " (RESULT MISMATCH)");
+
+	aFree(queries);
+	aFree(sd);
+}
+
+HPExport void plugin_init(void)
+{
+}
+
+HPExport void server_online(void)
+{
+	ShowMessage("===============================================================================\n");
+	ShowStatus("Starting tests.\n");
+
+	TEST("Lazy index build", test_lazy_build);
+	TEST("Random slot mutations", test_mutations);
+	TEST("Inventory expansion", test_inventory_expansion);
+
+	ShowMessage("===============================================================================\n");
+	ShowStatus("Starting benchmark.\n");
+	benchmark(10);
+	benchmark(50);
+	benchmark(100);
+
+	ShowMessage("===============================================================================\n");
+	ShowStatus("All tests passed.\n");
+	map->do_shutdown();
+}
+
+HPExport void plugin_final(void)
+{
+}
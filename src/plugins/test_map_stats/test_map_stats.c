@@ -0,0 +1,238 @@
+/**
+ * This file is part of Hercules.
+ * http://herc.ws - http://github.com/HerculesWS/Hercules
+ *
+ * Copyright (C) 2026 Hercules Dev Team
+ *
+ * Hercules is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Tests of the per map statistics: the object counters follow
+ * map->addblock / map->delblock and match the objects found on the map,
+ * the activity counters are increased by the searches, and the samples
+ * and the dump give the expected rates.
+ *
+ * Usage: ./map-server --load-plugin test_map_stats
+ */
+
+#include "common/hercules.h"
+#include "common/core.h"
+#include "common/memmgr.h"
+#include "common/random.h"
+#include "common/showmsg.h"
+#include "map/map.h"
+#include "map/path.h"
+
+#include "common/HPMDataCheck.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+HPExport struct hplugin_info pinfo = {
+	"test_map_stats", ///< Plugin name
+	SERVER_TYPE_MAP,  ///< Plugin type
+	"0.1",            ///< Plugin version
+	HPM_VERSION,      ///< HPM Version
+};
+
+#define TEST(name, function, ...) do { \
+	const char *message = NULL; \
+	ShowMessage("-------------------------------------------------------------------------------\n"); \
+	ShowNotice("Testing %s...\n", (name)); \
+	if ((message = (function)(__VA_ARGS__)) != NULL) { \
+		ShowError("Failed. %s\n", message); \
+		ShowMessage("===============================================================================\n"); \
+		ShowFatalError("Failure. Aborting further tests.\n"); \
+		exit(EXIT_FAILURE); \
+	} \
+	ShowInfo("Test passed.\n"); \
+} while (false)
+
+#define TEST_OBJECTS 3000 ///< Objects added to the map by the tests
+#define TEST_MOVES 20000  ///< Moves of those objects
+#define TEST_DUMP_FILE "test_map_stats.tsv"
+
+static char out_message[256];
+static struct block_list objects[TEST_OBJECTS];
+static const enum bl_type object_types[] = { BL_ITEM, BL_SKILL, BL_MOB, BL_CHAT };
+
+/// First map of the server with blocks.
+static int16 test_map(void)
+{
+	int16 m;
+
+	ARR_FIND(0, map->count, m, map->list[m].block != NULL && map->list[m].block_mob != NULL && !map->list[m].standby);
+	return m < map->count ? m : -1;
+}
+
+/// Checks the object counters of a map against the objects found in its blocks.
+static const char *check_objects(int16 m)
+{
+	for (int i = 0; i < MAP_STATS_BL_TYPES; i++) {
+		int found = map->foreachinmap(map->count_sub, m, 1 << i);
+
+		if (found != map->list[m].stats.objects[i]) {
+			snprintf(out_message, sizeof(out_message), "%d objects of type %s counted, %d on the map.",
+				map->list[m].stats.objects[i], map->stats_type_name(i), found);
+			return out_message;
+		}
+	}
+	return NULL;
+}
+
+static const char *test_objects(int16 m)
+{
+	struct map_stats before = map->list[m].stats;
+	const char *message;
+
+	for (int i = 0; i < TEST_OBJECTS; i++) {
+		struct block_list *bl = &objects[i];
+
+		memset(bl, 0, sizeof(*bl));
+		bl->type = object_types[i % ARRAYLENGTH(object_types)];
+		bl->m = m;
+		bl->x = (int16)((uint32)rnd() % map->list[m].xs);
+		bl->y = (int16)((uint32)rnd() % map->list[m].ys);
+		if (map->addblock(bl) != 0)
+			return "map->addblock failed.";
+	}
+	for (int i = 0; i < ARRAYLENGTH(object_types); i++) {
+		int index = map->stats_type_index(object_types[i]);
+		int added = TEST_OBJECTS / ARRAYLENGTH(object_types) + (i < TEST_OBJECTS % ARRAYLENGTH(object_types) ? 1 : 0);
+
+		if (map->list[m].stats.objects[index] - before.objects[index] != added) {
+			snprintf(out_message, sizeof(out_message), "%d objects of type %s added, %d counted.",
+				added, map->stats_type_name(index), map->list[m].stats.objects[index] - before.objects[index]);
+			return out_message;
+		}
+	}
+	if ((message = check_objects(m)) != NULL)
+		return message;
+
+	// Moves between blocks, as map->moveblock does
+	for (int i = 0; i < TEST_MOVES; i++) {
+		struct block_list *bl = &objects[(uint32)rnd() % TEST_OBJECTS];
+
+		map->delblock(bl);
+		bl->x = (int16)((uint32)rnd() % map->list[m].xs);
+		bl->y = (int16)((uint32)rnd() % map->list[m].ys);
+		map->addblock(bl);
+	}
+	if ((message = check_objects(m)) != NULL)
+		return message;
+
+	for (int i = 0; i < TEST_OBJECTS; i++)
+		map->delblock(&objects[i]);
+	if (memcmp(before.objects, map->list[m].stats.objects, sizeof(before.objects)) != 0)
+		return "The counters don't go back to their value once the objects are removed.";
+	return check_objects(m);
+}
+
+static const char *test_counters(int16 m)
+{
+	struct map_stats *stats = &map->list[m].stats;
+	uint64 scans = stats->count[MAP_STATS_AREA_SCANS], blocks = stats->count[MAP_STATS_AREA_BLOCKS];
+	uint64 paths = stats->count[MAP_STATS_PATH_SEARCHES];
+
+	// A search of every type visits both block lists of every block
+	map->foreachinmap(map->count_sub, m, BL_ALL);
+	if (stats->count[MAP_STATS_AREA_SCANS] - scans != 1)
+		return "The area search wasn't counted.";
+	if (stats->count[MAP_STATS_AREA_BLOCKS] - blocks != (uint64)map->list[m].bxs * map->list[m].bys * 2) {
+		snprintf(out_message, sizeof(out_message), "%"PRIu64" blocks visited, %d expected.",
+			stats->count[MAP_STATS_AREA_BLOCKS] - blocks, map->list[m].bxs * map->list[m].bys * 2);
+		return out_message;
+	}
+
+	for (int i = 0; i < 100; i++)
+		path->search(NULL, NULL, m, 0, 0, (int16)((uint32)rnd() % map->list[m].xs), (int16)((uint32)rnd() % map->list[m].ys), 0, CELL_CHKNOPASS);
+	if (stats->count[MAP_STATS_PATH_SEARCHES] - paths != 100)
+		return "The path searches weren't counted.";
+	return NULL;
+}
+
+static const char *test_sample(int16 m)
+{
+	struct map_stats *stats = &map->list[m].stats;
+	int64 tick = map->stats_tick + 4000;
+	char line[1024];
+	char expected[64];
+	int headers = 0, lines = 0;
+	FILE *fp;
+
+	map->stats_sample(map->stats_tick + 1);
+	stats->count[MAP_STATS_AI_THINKS] += 8000;
+	stats->count[MAP_STATS_BYTES_SENT] += 400000;
+	map->stats_sample(tick);
+	if (stats->rate[MAP_STATS_AI_THINKS] != 2000 || stats->rate[MAP_STATS_BYTES_SENT] != 100000 || stats->rate[MAP_STATS_PATH_SEARCHES] != 0) {
+		snprintf(out_message, sizeof(out_message), "Rates of %u AI runs/s and %u bytes/s, expected 2000 and 100000.",
+			stats->rate[MAP_STATS_AI_THINKS], stats->rate[MAP_STATS_BYTES_SENT]);
+		return out_message;
+	}
+	if (map->stats_load(&map->list[m]) < 2000)
+		return "The map has no load.";
+
+	remove(TEST_DUMP_FILE);
+	snprintf(map->stats_file, sizeof(map->stats_file), "%s", TEST_DUMP_FILE);
+	map->stats_dump(tick);
+	map->stats_dump(tick);
+	map->stats_file[0] = '\0';
+	if ((fp = fopen(TEST_DUMP_FILE, "r")) == NULL)
+		return "The dump wasn't written.";
+	snprintf(expected, sizeof(expected), "\t%s\t", map->list[m].name);
+	while (fgets(line, sizeof(line), fp) != NULL) {
+		if (strncmp(line, "time\tmap\tusers\tpc\t", 18) == 0)
+			headers++;
+		else if (strstr(line, expected) != NULL && strstr(line, "\t2000\t0\t0\t100000\t") != NULL)
+			lines++;
+	}
+	fclose(fp);
+	remove(TEST_DUMP_FILE);
+	if (headers != 1 || lines != 2) {
+		snprintf(out_message, sizeof(out_message), "%d headers and %d lines of the map in the dump, expected 1 and 2.", headers, lines);
+		return out_message;
+	}
+	return NULL;
+}
+
+HPExport void plugin_init(void)
+{
+}
+
+HPExport void server_online(void)
+{
+	int16 m = test_map();
+
+	ShowMessage("===============================================================================\n");
+	ShowStatus("Starting tests.\n");
+
+	if (m < 0) {
+		ShowFatalError("No map with blocks is loaded.\n");
+		exit(EXIT_FAILURE);
+	}
+	rnd->seed(0x2545F491); // same objects and paths on every run
+	TEST("Objects by type", test_objects, m);
+	TEST("Activity counters", test_counters, m);
+	TEST("Samples and dump", test_sample, m);
+
+	ShowMessage("===============================================================================\n");
+	ShowStatus("All tests passed.\n");
+	map->do_shutdown();
+}
+
+HPExport void plugin_final(void)
+{
+}
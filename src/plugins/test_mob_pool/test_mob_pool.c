@@ -0,0 +1,278 @@
+/**
+ * This file is part of Hercules.
+ * http://herc.ws - http://github.com/HerculesWS/Hercules
+ *
+ * Copyright (C) 2026 Hercules Dev Team
+ *
+ * Hercules is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Tests of the mob_data pool (mob->data_alloc / mob->data_free) and of the
+ * respawns batched by spawn group (mob->queue_respawn / mob->spawn_batch):
+ * every queued mob must be respawned once and not before its tick, by fewer
+ * timers than respawns.
+ * The allocations and timers avoided over BENCH_DEATHS deaths are reported.
+ *
+ * Usage: ./map-server --load-plugin test_mob_pool
+ */
+
+#include "common/hercules.h"
+#include "common/core.h"
+#include "common/db.h"
+#include "common/memmgr.h"
+#include "common/random.h"
+#include "common/showmsg.h"
+#include "common/timer.h"
+#include "map/map.h"
+#include "map/mob.h"
+#include "map/npc.h"
+
+#include "common/HPMDataCheck.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+HPExport struct hplugin_info pinfo = {
+	"test_mob_pool", ///< Plugin name
+	SERVER_TYPE_MAP, ///< Plugin type
+	"0.1",           ///< Plugin version
+	HPM_VERSION,     ///< HPM Version
+};
+
+#define TEST(name, function, ...) do { \
+	const char *message = NULL; \
+	ShowMessage("-------------------------------------------------------------------------------\n"); \
+	ShowNotice("Testing %s...\n", (name)); \
+	if ((message = (function)(__VA_ARGS__)) != NULL) { \
+		ShowError("Failed. %s\n", message); \
+		ShowMessage("===============================================================================\n"); \
+		ShowFatalError("Failure. Aborting further tests.\n"); \
+		exit(EXIT_FAILURE); \
+	} \
+	ShowInfo("Test passed.\n"); \
+} while (false)
+
+#define BENCH_GROUP_SIZE 200   ///< Mobs of the spawn group
+#define BENCH_DEATHS 100000    ///< Deaths (and respawns) of the benchmark
+#define BENCH_KILL_INTERVAL 20 ///< Milliseconds between two deaths
+#define BENCH_DELAY 5000       ///< Respawn delay of the spawn group
+#define BENCH_DELAY_VARIANCE 3000 ///< Random respawn delay variance
+
+static char out_message[256];
+static struct mob_data *mobs[BENCH_GROUP_SIZE];
+static int64 spawn_count[BENCH_GROUP_SIZE];
+static int64 batch_tick;
+static const char *spawn_error;
+
+/// Checks and counts the respawns instead of placing the mobs on a map.
+static int test_mob_spawn(struct mob_data *md)
+{
+	int i;
+
+	ARR_FIND(0, BENCH_GROUP_SIZE, i, mobs[i] == md);
+	if (i == BENCH_GROUP_SIZE) {
+		spawn_error = "a mob of another group was respawned";
+		return 0;
+	}
+
+	if (DIFF_TICK(md->respawn_tick, batch_tick) > MOB_RESPAWN_BATCH_WINDOW)
+		spawn_error = "a mob was respawned too long before its tick";
+	if (DIFF_TICK(md->respawn_tick, batch_tick) < 0)
+		spawn_error = "a mob was respawned after its tick";
+	if (md->spawn_timer != INVALID_TIMER || md->respawn_next != NULL)
+		spawn_error = "a respawned mob is still queued";
+	spawn_count[i]++;
+	return 0;
+}
+
+static struct spawn_data *make_group(void)
+{
+	struct spawn_data *spawn = NULL;
+
+	CREATE(spawn, struct spawn_data, 1);
+	spawn->num = BENCH_GROUP_SIZE;
+	spawn->respawn_timer = INVALID_TIMER;
+	for (int i = 0; i < BENCH_GROUP_SIZE; i++) {
+		struct mob_data *md = mob->data_alloc();
+
+		md->bl.type = BL_MOB;
+		md->bl.id = npc->get_new_npc_id();
+		md->spawn = spawn;
+		md->spawn_timer = INVALID_TIMER;
+		map->addiddb(&md->bl);
+		mobs[i] = md;
+	}
+	return spawn;
+}
+
+static void free_group(struct spawn_data *spawn)
+{
+	for (int i = 0; i < BENCH_GROUP_SIZE; i++) {
+		mob->dequeue_respawn(mobs[i]);
+		map->deliddb(&mobs[i]->bl);
+		mob->data_free(mobs[i]);
+		mobs[i] = NULL;
+	}
+	aFree(spawn);
+}
+
+/// Runs the respawn timer of the group as the timer system would, at its tick.
+static void run_batch(struct spawn_data *spawn)
+{
+	int tid = spawn->respawn_timer;
+
+	batch_tick = spawn->respawn_tick;
+	timer->delete_(tid, mob->spawn_batch);
+	mob->spawn_batch(tid, batch_tick, 0, (intptr_t)spawn);
+}
+
+static const char *test_pool(void)
+{
+	struct mob_data *md[16];
+	uint64 reused = mob->pool.reused;
+
+	for (int i = 0; i < 16; i++) {
+		md[i] = mob->data_alloc();
+		memset(md[i], 0xAB, sizeof(*md[i]));
+	}
+	for (int i = 0; i < 16; i++)
+		mob->data_free(md[i]);
+	for (int i = 0; i < 16; i++) {
+		const unsigned char *p;
+
+		md[i] = mob->data_alloc();
+		p = (const unsigned char *)md[i];
+		if (p[0] != 0 || p[sizeof(*md[i]) / 2] != 0 || p[sizeof(*md[i]) - 1] != 0)
+			return "a reused mob_data wasn't cleared";
+	}
+	for (int i = 0; i < 16; i++)
+		mob->data_free(md[i]);
+	if (mob->pool.reused - reused < 16)
+		return "the released mob_data weren't reused";
+	return NULL;
+}
+
+static const char *test_respawn_batch(void)
+{
+	int (*spawn_func) (struct mob_data *md) = mob->spawn;
+	struct spawn_data *spawn = make_group();
+	int64 now = timer->gettick();
+	uint64 timers = mob->pool.respawn_timers;
+	const char *result = NULL;
+
+	mob->spawn = test_mob_spawn;
+	memset(spawn_count, 0, sizeof(spawn_count));
+	spawn_error = NULL;
+
+	// Deaths spread over 10 seconds, one mob removed while waiting
+	for (int i = 0; i < BENCH_GROUP_SIZE; i++)
+		mob->queue_respawn(mobs[i], now + BENCH_DELAY + (i * 10000) / BENCH_GROUP_SIZE);
+	mob->dequeue_respawn(mobs[BENCH_GROUP_SIZE / 2]);
+	while (spawn->respawn_timer != INVALID_TIMER && spawn_error == NULL) {
+		for (const struct mob_data *md = spawn->respawn_queue; md != NULL; md = md->respawn_next) {
+			if (md->spawn_timer != spawn->respawn_timer) {
+				spawn_error = "a queued mob doesn't hold the timer of its group";
+				break;
+			}
+		}
+		run_batch(spawn);
+	}
+
+	for (int i = 0; i < BENCH_GROUP_SIZE && result == NULL; i++) {
+		int64 expected = i == BENCH_GROUP_SIZE / 2 ? 0 : 1;
+		if (spawn_count[i] != expected) {
+			snprintf(out_message, sizeof out_message, "mob %d was respawned %"PRId64" times, expected %"PRId64, i, spawn_count[i], expected);
+			result = out_message;
+		}
+	}
+	if (result == NULL && spawn_error != NULL)
+		result = spawn_error;
+	if (result == NULL && spawn->respawn_queue != NULL)
+		result = "mobs are left in the respawn queue";
+	if (result == NULL && mob->pool.respawn_timers - timers > BENCH_GROUP_SIZE / 8)
+		result = "the respawns due within the batch window weren't batched";
+
+	mob->spawn = spawn_func;
+	free_group(spawn);
+	return result;
+}
+
+/// Deaths of a farmed spawn group: the mobs die one after the other, and respawn after a random delay.
+static const char *test_benchmark(void)
+{
+	int (*spawn_func) (struct mob_data *md) = mob->spawn;
+	struct spawn_data *spawn = make_group();
+	uint64 respawns = mob->pool.respawns, timers = mob->pool.respawn_timers, batches = mob->pool.respawn_batches;
+	uint64 allocs = mob->pool.allocs, reused = mob->pool.reused;
+	int64 now = timer->gettick(), tick;
+	int deaths = 0;
+
+	mob->spawn = test_mob_spawn;
+	spawn_error = NULL;
+	tick = timer->gettick_nocache();
+	for (int64 t = now; deaths < BENCH_DEATHS; t += BENCH_KILL_INTERVAL) {
+		struct mob_data *md = mobs[(uint32)rnd() % BENCH_GROUP_SIZE];
+
+		while (spawn->respawn_timer != INVALID_TIMER && DIFF_TICK(spawn->respawn_tick, t) <= 0)
+			run_batch(spawn);
+		if (md->spawn_timer != INVALID_TIMER)
+			continue; // Already dead
+		mob->queue_respawn(md, t + BENCH_DELAY + (uint32)rnd() % BENCH_DELAY_VARIANCE);
+		deaths++;
+		// A summon or a clone dies on the map every 10 deaths
+		if (deaths % 10 == 0)
+			mob->data_free(mob->data_alloc());
+	}
+	while (spawn->respawn_timer != INVALID_TIMER)
+		run_batch(spawn);
+	tick = timer->gettick_nocache() - tick;
+
+	mob->spawn = spawn_func;
+	free_group(spawn);
+	if (spawn_error != NULL)
+		return spawn_error;
+
+	ShowInfo("%d deaths in %"PRId64" ms: %"PRIu64" respawns, %"PRIu64" timers added (%"PRIu64" avoided), %"PRIu64" batches.\n",
+			BENCH_DEATHS, tick, mob->pool.respawns - respawns, mob->pool.respawn_timers - timers,
+			(mob->pool.respawns - respawns) - (mob->pool.respawn_timers - timers), mob->pool.respawn_batches - batches);
+	ShowInfo("%"PRIu64" mob_data given, %"PRIu64" reused from the pool (allocations avoided).\n",
+			mob->pool.allocs - allocs, mob->pool.reused - reused);
+	if (mob->pool.respawn_timers - timers >= mob->pool.respawns - respawns)
+		return "no respawn timer was avoided";
+	return NULL;
+}
+
+HPExport void plugin_init(void)
+{
+}
+
+HPExport void server_online(void)
+{
+	ShowMessage("===============================================================================\n");
+	ShowStatus("Starting tests.\n");
+
+	rnd->seed(0x2545F491); // same deaths on every run
+	TEST("mob_data pool", test_pool);
+	TEST("Respawns batched by spawn group", test_respawn_batch);
+	TEST("Farmed spawn group", test_benchmark);
+
+	ShowMessage("===============================================================================\n");
+	ShowStatus("All tests passed.\n");
+	map->do_shutdown();
+}
+
+HPExport void plugin_final(void)
+{
+}
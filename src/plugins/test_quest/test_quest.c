@@ -0,0 +1,395 @@
+/**
+ * This file is part of Hercules.
+ * http://herc.ws - http://github.com/HerculesWS/Hercules
+ *
+ * Copyright (C) 2026 Hercules Dev Team
+ *
+ * Hercules is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Compares quest objective updates through the per-player mob class index
+ * (quest->update_objective) with the full quest log scan it replaces, for
+ * players holding BENCH_ACTIVE active quests of a generated DB, while quests
+ * are added, deleted and paused: both must give the same kill counters and
+ * the same drop rolls, and their kill rates are reported.
+ *
+ * Usage: ./map-server --load-plugin test_quest
+ */
+
+#include "common/hercules.h"
+#include "common/core.h"
+#include "common/memmgr.h"
+#include "common/random.h"
+#include "common/showmsg.h"
+#include "common/timer.h"
+#include "map/clif.h"
+#include "map/itemdb.h"
+#include "map/map.h"
+#include "map/mob.h"
+#include "map/pc.h"
+#include "map/quest.h"
+
+#include "common/HPMDataCheck.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+HPExport struct hplugin_info pinfo = {
+	"test_quest",    ///< Plugin name
+	SERVER_TYPE_MAP, ///< Plugin type
+	"0.1",           ///< Plugin version
+	HPM_VERSION,     ///< HPM Version
+};
+
+#define TEST(name, function, ...) do { \
+	const char *message = NULL; \
+	ShowMessage("-------------------------------------------------------------------------------\n"); \
+	ShowNotice("Testing %s...\n", (name)); \
+	if ((message = (function)(__VA_ARGS__)) != NULL) { \
+		ShowError("Failed. %s\n", message); \
+		ShowMessage("===============================================================================\n"); \
+		ShowFatalError("Failure. Aborting further tests.\n"); \
+		exit(EXIT_FAILURE); \
+	} \
+	ShowInfo("Test passed.\n"); \
+} while (false)
+
+#define BENCH_QUESTS 400         ///< Quests of the generated DB
+#define BENCH_ACTIVE 150         ///< Active quests of each player
+#define BENCH_COMPLETE 30        ///< Completed quests of each player
+#define BENCH_MOBS 300           ///< Distinct monster classes killed
+#define BENCH_KILLS 200000       ///< Monster kills per player
+#define BENCH_CHANGE_INTERVAL 2000 ///< Kills between two quest log changes
+#define BENCH_FIRST_ID 50000     ///< Id of the first generated quest
+#define BENCH_FIRST_MOB 1002     ///< Class of the first killed monster
+
+static char out_message[256];
+static int update_count;
+static int drop_count;
+static uint32 update_hash;
+static uint32 drop_hash;
+static struct quest_db *saved_db[BENCH_QUESTS];
+static struct item_data test_item;
+
+/// Records the client updates instead of sending them, the players aren't connected.
+static void test_quest_update_objective(struct map_session_data *sd, struct quest *qd)
+{
+	update_count++;
+	update_hash = update_hash * 31 + (uint32)qd->quest_id;
+}
+
+static void test_quest_noop(struct map_session_data *sd, struct quest *qd)
+{
+}
+
+static void test_quest_delete(struct map_session_data *sd, int quest_id)
+{
+}
+
+static void test_quest_update_status(struct map_session_data *sd, int quest_id, bool active)
+{
+}
+
+static void test_questinfo_refresh(struct map_session_data *sd)
+{
+}
+
+static struct item_data *test_itemdb_exists(int nameid)
+{
+	return &test_item;
+}
+
+/// Records the drops, so that both methods can be checked to roll them in the same order.
+static int test_additem(struct map_session_data *sd, const struct item *item_data, int amount, e_log_pick_type log_type)
+{
+	drop_count++;
+	drop_hash = drop_hash * 31 + (uint32)item_data->nameid;
+	return 0;
+}
+
+/// Scan of the whole quest log, as done before the mob class index.
+static void scan_update_objective(struct map_session_data *sd, const struct mob_data *md)
+{
+	int i, j;
+
+	for (i = 0; i < sd->avail_quests; i++) {
+		struct quest_db *qi = NULL;
+
+		if (sd->quest_log[i].state != Q_ACTIVE)
+			continue;
+
+		qi = quest->db(sd->quest_log[i].quest_id);
+
+		for (j = 0; j < qi->objectives_count; j++) {
+			if ((qi->objectives[j].mob == 0 || qi->objectives[j].mob == md->class_) &&
+				sd->quest_log[i].count[j] < qi->objectives[j].count &&
+				(qi->objectives[j].level.min == 0 || qi->objectives[j].level.min <= md->level) &&
+				(qi->objectives[j].level.max == 0 || qi->objectives[j].level.max >= md->level) &&
+				(qi->objectives[j].mapid < 0 || qi->objectives[j].mapid == md->bl.m) &&
+				(qi->objectives[j].mobtype.size_enabled == false  || qi->objectives[j].mobtype.size == md->status.size) &&
+				(qi->objectives[j].mobtype.race_enabled == false || qi->objectives[j].mobtype.race == md->status.race) &&
+				(qi->objectives[j].mobtype.ele_enabled == false || qi->objectives[j].mobtype.ele == md->status.def_ele)) {
+					sd->quest_log[i].count[j]++;
+					sd->save_quest = true;
+					clif->quest_update_objective(sd, &sd->quest_log[i]);
+			}
+		}
+
+		for (j = 0; j < qi->dropitem_count; j++) {
+			struct quest_dropitem *dropitem = &qi->dropitem[j];
+			struct item item;
+
+			if (dropitem->mob_id != 0 && dropitem->mob_id != md->class_)
+				continue;
+			if (rnd()%10000 >= dropitem->rate)
+				continue;
+			if (itemdb->exists(dropitem->nameid) == NULL)
+				continue;
+			memset(&item, 0, sizeof(item));
+			item.nameid = dropitem->nameid;
+			item.amount = 1;
+			pc->additem(sd, &item, 1, LOG_TYPE_QUEST);
+		}
+	}
+}
+
+/// Generates the DB: mostly single class objectives, some race/size/element ones and drop bonuses.
+static void make_db(void)
+{
+	for (int i = 0; i < BENCH_QUESTS; i++) {
+		struct quest_db *qi = NULL;
+		int id = BENCH_FIRST_ID + i;
+
+		saved_db[i] = quest->db_data[id];
+		CREATE(qi, struct quest_db, 1);
+		qi->id = id;
+		qi->objectives_count = 1 + i % MAX_QUEST_OBJECTIVES;
+		CREATE(qi->objectives, struct quest_objective, qi->objectives_count);
+		for (int j = 0; j < qi->objectives_count; j++) {
+			struct quest_objective *obj = &qi->objectives[j];
+
+			obj->count = 100 + (i * 37 + j * 11) % 900;
+			obj->mapid = (i % 10 == 3) ? 1 : -1;
+			if (i % 8 == 0) {
+				// Any class of a given race or element
+				obj->mobtype.race = i % RC_MAX;
+				obj->mobtype.race_enabled = true;
+				obj->mobtype.ele = j % ELE_MAX;
+				obj->mobtype.ele_enabled = (j % 2) != 0;
+			} else {
+				obj->mob = BENCH_FIRST_MOB + (i * 31 + j * 7) % BENCH_MOBS;
+			}
+			if (i % 5 == 0)
+				obj->level.min = 20 + i % 40;
+		}
+		if (i % 3 == 0) {
+			qi->dropitem_count = 1 + i % 2;
+			CREATE(qi->dropitem, struct quest_dropitem, qi->dropitem_count);
+			for (int j = 0; j < qi->dropitem_count; j++) {
+				qi->dropitem[j].mob_id = (j == 1) ? 0 : BENCH_FIRST_MOB + (i * 17) % BENCH_MOBS;
+				qi->dropitem[j].nameid = 501 + i * 2 + j;
+				qi->dropitem[j].rate = 100 + (i * 53) % 3000;
+			}
+		}
+		quest->db_data[id] = qi;
+	}
+}
+
+static void free_db(void)
+{
+	for (int i = 0; i < BENCH_QUESTS; i++) {
+		struct quest_db *qi = quest->db_data[BENCH_FIRST_ID + i];
+
+		aFree(qi->objectives);
+		aFree(qi->dropitem);
+		aFree(qi);
+		quest->db_data[BENCH_FIRST_ID + i] = saved_db[i];
+	}
+}
+
+static struct map_session_data *make_sd(void)
+{
+	struct map_session_data *sd = NULL;
+
+	CREATE(sd, struct map_session_data, 1);
+	sd->bl.type = BL_PC;
+	sd->num_quests = BENCH_ACTIVE + BENCH_COMPLETE;
+	sd->avail_quests = BENCH_ACTIVE;
+	CREATE(sd->quest_log, struct quest, sd->num_quests);
+	for (int i = 0; i < sd->num_quests; i++) {
+		sd->quest_log[i].quest_id = BENCH_FIRST_ID + (i * 7) % BENCH_QUESTS;
+		sd->quest_log[i].state = i < BENCH_ACTIVE ? Q_ACTIVE : Q_COMPLETE;
+	}
+	quest->index_invalidate(sd);
+	return sd;
+}
+
+static void free_sd(struct map_session_data *sd)
+{
+	aFree(sd->quest_log);
+	quest->index_clear(sd);
+	aFree(sd);
+}
+
+/// Adds, deletes, pauses or resumes one of the player's quests.
+static void change_quests(struct map_session_data *sd, uint32 seed)
+{
+	int quest_id = BENCH_FIRST_ID + (int)((seed >> 8) % BENCH_QUESTS);
+	int state = quest->check(sd, quest_id, HAVEQUEST);
+
+	if (state < 0)
+		quest->add(sd, quest_id, 0);
+	else if (state == Q_COMPLETE || (seed & 3) == 0)
+		quest->delete_(sd, quest_id);
+	else
+		quest->update_status(sd, quest_id, state == Q_ACTIVE ? Q_INACTIVE : Q_ACTIVE);
+}
+
+/// Runs the same kill sequence on a player, returns the time it took.
+static int64 run_kills(struct map_session_data *sd, void (*update_objective) (struct map_session_data *sd, const struct mob_data *md), uint32 seed)
+{
+	struct mob_data md;
+	int64 tick;
+
+	memset(&md, 0, sizeof(md));
+	md.bl.type = BL_MOB;
+	rnd->seed(seed);
+	tick = timer->gettick_nocache();
+	for (int i = 0; i < BENCH_KILLS; i++) {
+		seed = seed * 1103515245 + 12345;
+		if (i % BENCH_CHANGE_INTERVAL == 0)
+			change_quests(sd, seed);
+		md.class_ = BENCH_FIRST_MOB + (int)((seed >> 8) % BENCH_MOBS);
+		md.level = 1 + (int)((seed >> 4) % 99);
+		md.bl.m = (int16)((seed >> 20) % 2);
+		md.status.race = (seed >> 12) % RC_MAX;
+		md.status.def_ele = (seed >> 16) % ELE_MAX;
+		md.status.size = (seed >> 24) % (SZ_BIG + 1);
+		update_objective(sd, &md);
+	}
+	return timer->gettick_nocache() - tick;
+}
+
+static const char *compare(struct map_session_data *sd_scan, struct map_session_data *sd_index)
+{
+	if (sd_scan->num_quests != sd_index->num_quests || sd_scan->avail_quests != sd_index->avail_quests)
+		return "the quest logs have a different size";
+	for (int i = 0; i < sd_scan->num_quests; i++) {
+		if (memcmp(&sd_scan->quest_log[i], &sd_index->quest_log[i], sizeof(struct quest)) != 0) {
+			snprintf(out_message, sizeof out_message, "quest %d has different progress", sd_scan->quest_log[i].quest_id);
+			return out_message;
+		}
+	}
+	return NULL;
+}
+
+static const char *test_update_objective(void)
+{
+	void (*update_objective) (struct map_session_data *sd, struct quest *qd) = clif->quest_update_objective;
+	void (*notify_objective) (struct map_session_data *sd, struct quest *qd) = clif->quest_notify_objective;
+	void (*quest_add) (struct map_session_data *sd, struct quest *qd) = clif->quest_add;
+	void (*quest_delete) (struct map_session_data *sd, int quest_id) = clif->quest_delete;
+	void (*update_status) (struct map_session_data *sd, int quest_id, bool active) = clif->quest_update_status;
+	void (*questinfo_refresh) (struct map_session_data *sd) = quest->questinfo_refresh;
+	struct item_data *(*exists) (int nameid) = itemdb->exists;
+	int (*additem) (struct map_session_data *sd, const struct item *item_data, int amount, e_log_pick_type log_type) = pc->additem;
+	int save_settings = map->save_settings;
+	struct map_session_data *sd_scan = NULL, *sd_index = NULL;
+	int scan_updates, scan_drops, index_updates, index_drops;
+	uint32 scan_update_hash, scan_drop_hash, index_update_hash, index_drop_hash;
+	int64 scan_ms, index_ms;
+	const char *result = NULL;
+
+	clif->quest_update_objective = test_quest_update_objective;
+	clif->quest_notify_objective = test_quest_noop;
+	clif->quest_add = test_quest_noop;
+	clif->quest_delete = test_quest_delete;
+	clif->quest_update_status = test_quest_update_status;
+	quest->questinfo_refresh = test_questinfo_refresh;
+	itemdb->exists = test_itemdb_exists;
+	pc->additem = test_additem;
+	map->save_settings = 0;
+	make_db();
+	sd_scan = make_sd();
+	sd_index = make_sd();
+
+	update_count = drop_count = 0;
+	update_hash = drop_hash = 0;
+	scan_ms = run_kills(sd_scan, scan_update_objective, 42);
+	scan_updates = update_count;
+	scan_drops = drop_count;
+	scan_update_hash = update_hash;
+	scan_drop_hash = drop_hash;
+
+	update_count = drop_count = 0;
+	update_hash = drop_hash = 0;
+	index_ms = run_kills(sd_index, quest->update_objective, 42);
+	index_updates = update_count;
+	index_drops = drop_count;
+	index_update_hash = update_hash;
+	index_drop_hash = drop_hash;
+
+	result = compare(sd_scan, sd_index);
+	if (result == NULL && (scan_updates != index_updates || scan_update_hash != index_update_hash)) {
+		snprintf(out_message, sizeof out_message, "%d objective updates with the quest log scan, %d with the mob class index, or sent in a different order", scan_updates, index_updates);
+		result = out_message;
+	}
+	if (result == NULL && (scan_drops != index_drops || scan_drop_hash != index_drop_hash)) {
+		snprintf(out_message, sizeof out_message, "%d drops with the quest log scan, %d with the mob class index, or rolled in a different order", scan_drops, index_drops);
+		result = out_message;
+	}
+	if (result == NULL && (index_updates == 0 || index_drops == 0))
+		result = "no objective was updated or no item was dropped";
+
+	ShowInfo("%d active quests, %d kills: quest log scan %"PRId64" ms, mob class index %"PRId64" ms (%d objective updates, %d drops).\n",
+			BENCH_ACTIVE, BENCH_KILLS, scan_ms, index_ms, index_updates, index_drops);
+	if (scan_ms > 0 && index_ms > 0)
+		ShowInfo("Kill rate: %"PRId64" kills/s with the quest log scan, %"PRId64" kills/s with the mob class index.\n",
+				(int64)BENCH_KILLS * 1000 / scan_ms, (int64)BENCH_KILLS * 1000 / index_ms);
+
+	free_sd(sd_scan);
+	free_sd(sd_index);
+	free_db();
+	clif->quest_update_objective = update_objective;
+	clif->quest_notify_objective = notify_objective;
+	clif->quest_add = quest_add;
+	clif->quest_delete = quest_delete;
+	clif->quest_update_status = update_status;
+	quest->questinfo_refresh = questinfo_refresh;
+	itemdb->exists = exists;
+	pc->additem = additem;
+	map->save_settings = save_settings;
+	return result;
+}
+
+HPExport void plugin_init(void)
+{
+}
+
+HPExport void server_online(void)
+{
+	ShowMessage("===============================================================================\n");
+	ShowStatus("Starting tests.\n");
+
+	TEST("Mob class index against quest log scan", test_update_objective);
+
+	ShowMessage("===============================================================================\n");
+	ShowStatus("All tests passed.\n");
+	map->do_shutdown();
+}
+
+HPExport void plugin_final(void)
+{
+}
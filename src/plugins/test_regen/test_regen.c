@@ -0,0 +1,256 @@
+/**
+ * This file is part of Hercules.
+ * http://herc.ws - http://github.com/HerculesWS/Hercules
+ *
+ * Copyright (C) 2026 Hercules Dev Team
+ *
+ * Hercules is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Compares the natural regeneration pass over status->regen_table
+ * (status->natural_heal_pass) with the map->foreachregen pass it replaces, on
+ * BENCH_UNITS elementals: both must leave the units in the same state, and
+ * their running times are reported.
+ *
+ * Usage: ./map-server --load-plugin test_regen
+ */
+
+#include "common/hercules.h"
+#include "common/core.h"
+#include "common/db.h"
+#include "common/memmgr.h"
+#include "common/nullpo.h"
+#include "common/showmsg.h"
+#include "common/timer.h"
+#include "map/elemental.h"
+#include "map/map.h"
+#include "map/status.h"
+#include "map/unit.h"
+
+#include "common/HPMDataCheck.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+HPExport struct hplugin_info pinfo = {
+	"test_regen",     ///< Plugin name
+	SERVER_TYPE_MAP,  ///< Plugin type
+	"0.1",            ///< Plugin version
+	HPM_VERSION,      ///< HPM Version
+};
+
+#define TEST(name, function, ...) do { \
+	const char *message = NULL; \
+	ShowMessage("-------------------------------------------------------------------------------\n"); \
+	ShowNotice("Testing %s...\n", (name)); \
+	if ((message = (function)(__VA_ARGS__)) != NULL) { \
+		ShowError("Failed. %s\n", message); \
+		ShowMessage("===============================================================================\n"); \
+		ShowFatalError("Failure. Aborting further tests.\n"); \
+		exit(EXIT_FAILURE); \
+	} \
+	ShowInfo("Test passed.\n"); \
+} while (false)
+
+#define BENCH_UNITS 100000  ///< Regenerating units of each pass
+#define BENCH_PASSES 100    ///< Natural heal passes (NATURAL_HEAL_INTERVAL apart)
+
+static char out_message[256];
+static struct elemental_data *old_units;
+static struct elemental_data *new_units;
+static int heal_count;
+
+/// Counts the client updates instead of sending them, the units have no master.
+static void test_elemental_heal(struct elemental_data *ed, int hp, int sp)
+{
+	heal_count++;
+}
+
+/// Builds the units: most at full HP/SP, some damaged, blocked or walking.
+static struct elemental_data *make_units(void)
+{
+	struct elemental_data *units = NULL;
+
+	CREATE(units, struct elemental_data, BENCH_UNITS);
+	for (int i = 0; i < BENCH_UNITS; i++) {
+		struct elemental_data *ed = &units[i];
+
+		ed->bl.type = BL_ELEM;
+		ed->bl.id = i + 1;
+		ed->ud.walktimer = INVALID_TIMER;
+		status->change_init(&ed->bl);
+		ed->battle_status.hp = ed->battle_status.max_hp = 10000;
+		ed->battle_status.sp = ed->battle_status.max_sp = 500;
+		ed->regen.flag = RGN_HP | RGN_SP;
+		ed->regen.hp = 5 + i % 7;
+		ed->regen.sp = 1 + i % 3;
+		ed->regen.rate.hp = ed->regen.rate.sp = 100 + i % 50;
+
+		if (i % 10 == 0)
+			ed->battle_status.hp = 2000 + i % 1000;
+		if (i % 15 == 1)
+			ed->battle_status.sp = i % 100;
+		if (i % 40 == 2) {
+			ed->battle_status.hp = 5000;
+			ed->regen.state.block = 1 + i % 3;
+		}
+		if (i % 60 == 3) {
+			ed->battle_status.hp = 3000;
+			ed->regen.state.walk = i % 2;
+			ed->ud.walktimer = 1; // Never run, only compared to INVALID_TIMER
+		}
+		if (i % 70 == 4)
+			ed->regen.flag = RGN_SHP; // No natural HP regen, but a sub regen flag
+		if (i % 90 == 5)
+			ed->battle_status.hp = 0; // Dead
+	}
+	return units;
+}
+
+static int64 run_old_passes(void)
+{
+	struct DBMap *regen_db = map->regen_db;
+	struct DBMap *test_db = idb_alloc(DB_OPT_BASE);
+	int64 tick;
+
+	for (int i = 0; i < BENCH_UNITS; i++)
+		idb_put(test_db, old_units[i].bl.id, &old_units[i].bl);
+
+	map->regen_db = test_db;
+	tick = timer->gettick_nocache();
+	for (int pass = 0; pass < BENCH_PASSES; pass++)
+		map->foreachregen(status->natural_heal);
+	tick = timer->gettick_nocache() - tick;
+	map->regen_db = regen_db;
+
+	db_destroy(test_db);
+	return tick;
+}
+
+static int64 run_new_passes(int *candidates)
+{
+	int64 tick;
+
+	for (int i = 0; i < BENCH_UNITS; i++)
+		status->regen_add(&new_units[i].bl);
+
+	*candidates = 0;
+	tick = timer->gettick_nocache();
+	for (int pass = 0; pass < BENCH_PASSES; pass++)
+		*candidates += status->natural_heal_pass();
+	tick = timer->gettick_nocache() - tick;
+
+	for (int i = 0; i < BENCH_UNITS; i++)
+		status->regen_remove(&new_units[i].bl);
+	return tick;
+}
+
+static const char *test_regen_table(void)
+{
+	struct elemental_data ed[3];
+
+	memset(ed, 0, sizeof(ed));
+	for (int i = 0; i < 3; i++) {
+		ed[i].bl.type = BL_ELEM;
+		ed[i].bl.id = i + 1;
+	}
+	int count = status->regen_table.count;
+	status->regen_add(&ed[0].bl);
+	status->regen_add(&ed[1].bl);
+	status->regen_add(&ed[0].bl);
+	status->regen_add(&ed[2].bl);
+	if (status->regen_table.count != count + 3)
+		return "a unit was added twice";
+	status->regen_remove(&ed[0].bl);
+	status->regen_remove(&ed[0].bl);
+	if (status->regen_table.count != count + 2)
+		return "a unit was removed twice";
+	for (int i = 1; i < 3; i++) {
+		int index = ed[i].regen.table_index;
+		if (index < 0 || index >= status->regen_table.count || status->regen_table.bl[index] != &ed[i].bl
+		 || status->regen_table.regen[index] != &ed[i].regen || status->regen_table.st[index] != &ed[i].battle_status)
+			return "the unit swapped in place of a removed unit has a wrong index";
+	}
+	status->regen_remove(&ed[1].bl);
+	status->regen_remove(&ed[2].bl);
+	if (status->regen_table.count != count)
+		return "the table isn't empty";
+	return NULL;
+}
+
+static const char *test_passes(void)
+{
+	void (*heal) (struct elemental_data *ed, int hp, int sp) = elemental->heal;
+	int old_heals, new_heals, candidates;
+	int64 old_ms, new_ms;
+	const char *result = NULL;
+
+	old_units = make_units();
+	new_units = make_units();
+	elemental->heal = test_elemental_heal;
+	status->natural_heal_diff_tick = NATURAL_HEAL_INTERVAL;
+
+	heal_count = 0;
+	old_ms = run_old_passes();
+	old_heals = heal_count;
+	heal_count = 0;
+	new_ms = run_new_passes(&candidates);
+	new_heals = heal_count;
+
+	elemental->heal = heal;
+
+	for (int i = 0; i < BENCH_UNITS && result == NULL; i++) {
+		const struct elemental_data *o = &old_units[i], *n = &new_units[i];
+		if (o->battle_status.hp != n->battle_status.hp || o->battle_status.sp != n->battle_status.sp
+		 || o->regen.tick.hp != n->regen.tick.hp || o->regen.tick.sp != n->regen.tick.sp) {
+			snprintf(out_message, sizeof out_message, "unit %d: HP %u/%u SP %u/%u ticks %u/%u %u/%u (foreachregen/regen table)", i,
+					o->battle_status.hp, n->battle_status.hp, o->battle_status.sp, n->battle_status.sp,
+					o->regen.tick.hp, n->regen.tick.hp, o->regen.tick.sp, n->regen.tick.sp);
+			result = out_message;
+		}
+	}
+	if (result == NULL && old_heals != new_heals) {
+		snprintf(out_message, sizeof out_message, "%d client updates with foreachregen, %d with the regen table", old_heals, new_heals);
+		result = out_message;
+	}
+
+	ShowInfo("%d units, %d passes: foreachregen %"PRId64" ms, regen table %"PRId64" ms (%d units/pass processed, %d client updates).\n",
+			BENCH_UNITS, BENCH_PASSES, old_ms, new_ms, candidates / BENCH_PASSES, new_heals);
+
+	aFree(old_units);
+	aFree(new_units);
+	return result;
+}
+
+HPExport void plugin_init(void)
+{
+}
+
+HPExport void server_online(void)
+{
+	ShowMessage("===============================================================================\n");
+	ShowStatus("Starting tests.\n");
+
+	TEST("Regen table add/remove", test_regen_table);
+	TEST("Natural heal passes", test_passes);
+
+	ShowMessage("===============================================================================\n");
+	ShowStatus("All tests passed.\n");
+	map->do_shutdown();
+}
+
+HPExport void plugin_final(void)
+{
+}
@@ -0,0 +1,410 @@
+/**
+ * This file is part of Hercules.
+ * http://herc.ws - http://github.com/HerculesWS/Hercules
+ *
+ * Copyright (C) 2026 Hercules Dev Team
+ *
+ * Hercules is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Consistency test for the variable classification done when names are added
+ * to str_data (script->classify_variable) and for the slots the parser gives
+ * to scope and npc variables (script->var_slots_build), and benchmark of a
+ * corpus of script loops over scope, npc and array variables. Each loop runs
+ * with the slots of its script code and again with them dropped, so that every
+ * variable goes through the reg_db vars DB as before. The getd/setd loop goes
+ * through the by-name lookup and is included as reference for the dynamic path.
+ * The resolution of a variable from its name, as done before the
+ * classification, is timed against the classified one.
+ *
+ * Usage: ./map-server --load-plugin test_script_vars
+ */
+
+#include "common/hercules.h"
+#include "common/core.h"
+#include "common/memmgr.h"
+#include "common/nullpo.h"
+#include "common/showmsg.h"
+#include "common/strlib.h"
+#include "common/timer.h"
+#include "map/map.h"
+#include "map/mapreg.h"
+#include "map/npc.h"
+#include "map/script.h"
+
+#include "common/HPMDataCheck.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+HPExport struct hplugin_info pinfo = {
+	"test_script_vars", ///< Plugin name
+	SERVER_TYPE_MAP,    ///< Plugin type
+	"0.1",              ///< Plugin version
+	HPM_VERSION,        ///< HPM Version
+};
+
+#define TEST(name, function, ...) do { \
+	const char *message = NULL; \
+	ShowMessage("-------------------------------------------------------------------------------\n"); \
+	ShowNotice("Testing %s...\n", (name)); \
+	if ((message = (function)(__VA_ARGS__)) != NULL) { \
+		ShowError("Failed. %s\n", message); \
+		ShowMessage("===============================================================================\n"); \
+		ShowFatalError("Failure. Aborting further tests.\n"); \
+		exit(EXIT_FAILURE); \
+	} \
+	ShowInfo("Test passed.\n"); \
+} while (false)
+
+#define LOOP_ITERATIONS 1000000 ///< Iterations done by each benchmark script
+#define RESOLVE_ITERATIONS 20000000 ///< Variable resolutions done by the resolution benchmark
+
+static char out_message[256];
+
+struct classify_case {
+	const char *name;
+	enum script_var_scope scope;
+	bool string;
+	bool toolong;
+};
+
+static const struct classify_case classify_cases[] = {
+	{ "test_script_vars_c",         SCRIPT_VAR_CHAR,           false, false },
+	{ "test_script_vars_c$",        SCRIPT_VAR_CHAR,           true,  false },
+	{ "@test_script_vars",          SCRIPT_VAR_CHAR_TEMP,      false, false },
+	{ "$test_script_vars",          SCRIPT_VAR_SERVER,         false, false },
+	{ "$@test_script_vars$",        SCRIPT_VAR_SERVER,         true,  false },
+	{ "#test_script_vars",          SCRIPT_VAR_ACCOUNT,        false, false },
+	{ "##test_script_vars$",        SCRIPT_VAR_ACCOUNT_GLOBAL, true,  false },
+	{ ".test_script_vars",          SCRIPT_VAR_NPC,            false, false },
+	{ ".@test_script_vars$",        SCRIPT_VAR_SCOPE,          true,  false },
+	{ "'test_script_vars",          SCRIPT_VAR_INSTANCE,       false, false },
+	{ ".@test_script_vars_name_too_long_x", SCRIPT_VAR_SCOPE, false, true  },
+};
+
+struct loop_case {
+	const char *name;
+	const char *source;
+	int expected;
+};
+
+/// Every script stores its result in $@test_script_vars_result.
+static const struct loop_case loop_cases[] = {
+	{
+		"scope int",
+		"freeloop(1);"
+		"for (.@i = 0; .@i < "EXPAND_AND_QUOTE(LOOP_ITERATIONS)"; ++.@i)"
+		"	.@sum += .@i % 100;"
+		"$@test_script_vars_result = .@sum;"
+		"end;",
+		LOOP_ITERATIONS / 100 * 4950,
+	},
+	{
+		"npc int",
+		"freeloop(1);"
+		".sum = 0;"
+		"for (.i = 0; .i < "EXPAND_AND_QUOTE(LOOP_ITERATIONS)"; ++.i)"
+		"	.sum += .i % 100;"
+		"$@test_script_vars_result = .sum;"
+		"end;",
+		LOOP_ITERATIONS / 100 * 4950,
+	},
+	{
+		"scope string",
+		"freeloop(1);"
+		"for (.@i = 0; .@i < "EXPAND_AND_QUOTE(LOOP_ITERATIONS)"; ++.@i) {"
+		"	.@s$ = (.@i % 2) ? \"odd\" : \"even\";"
+		"	if (.@s$ == \"odd\")"
+		"		++.@odd;"
+		"}"
+		"$@test_script_vars_result = .@odd;"
+		"end;",
+		LOOP_ITERATIONS / 2,
+	},
+	{
+		"scope array",
+		"freeloop(1);"
+		"for (.@i = 0; .@i < "EXPAND_AND_QUOTE(LOOP_ITERATIONS)"; ++.@i)"
+		"	.@a[.@i % 128] += .@i % 10;"
+		"for (.@i = 0; .@i < 128; ++.@i)"
+		"	.@sum += .@a[.@i];"
+		"$@test_script_vars_result = .@sum;"
+		"end;",
+		LOOP_ITERATIONS / 10 * 45,
+	},
+	{
+		"getd/setd",
+		"freeloop(1);"
+		"for (.@i = 0; .@i < "EXPAND_AND_QUOTE(LOOP_ITERATIONS)"; ++.@i)"
+		"	setd(\".@d\", getd(\".@d\") + .@i % 100);"
+		"$@test_script_vars_result = getd(\".@d\");"
+		"end;",
+		LOOP_ITERATIONS / 100 * 4950,
+	},
+};
+
+/// Scripts checking that variables read the same through their slot and every other path.
+static const struct loop_case semantic_cases[] = {
+	{
+		"getd/setd of a slot variable",
+		".@x = 5;"
+		"setd(\".@x\", getd(\".@x\") + 1);"
+		".@s$ = \"a\";"
+		"setd(\".@s$\", getd(\".@s$\") + \"b\");"
+		"$@test_script_vars_result = .@x * 10 + (.@s$ == \"ab\");"
+		"end;",
+		61,
+	},
+	{
+		"array element 0",
+		".@a = 3;"
+		".@a[1] = 4;"
+		".@a[0] += 1;"
+		"$@test_script_vars_result = .@a * 10 + getarraysize(.@a);"
+		"end;",
+		42,
+	},
+	{
+		"callsub frames and references",
+		".@x = 5;"
+		".@y = 10;"
+		".@r = callsub(S_Add, .@x);"
+		"$@test_script_vars_result = .@x * 100 + .@y + .@r;"
+		"end;"
+		"S_Add:"
+		"	.@y = 1;"
+		"	set getarg(0), getarg(0) + .@y;"
+		"	return .@y + 1;",
+		612,
+	},
+	{
+		"npc variable in a subroutine",
+		".v = 7;"
+		"callsub(S_Inc, .v);"
+		"$@test_script_vars_result = .v;"
+		"end;"
+		"S_Inc:"
+		"	.v += getarg(0);"
+		"	return;",
+		14,
+	},
+};
+
+static const char *test_classify(void)
+{
+	for (int i = 0; i < ARRAYLENGTH(classify_cases); i++) {
+		const struct classify_case *c = &classify_cases[i];
+		const struct str_data_struct *data = &script->str_data[script->add_variable(c->name)];
+
+		if (data->var_scope != c->scope || (data->var_string != 0) != c->string || (data->var_toolong != 0) != c->toolong) {
+			snprintf(out_message, sizeof(out_message), "'%s' classified as scope %d, string %d, too long %d (expected %d, %d, %d)",
+					c->name, (int)data->var_scope, (int)data->var_string, (int)data->var_toolong, (int)c->scope, (int)c->string, (int)c->toolong);
+			return out_message;
+		}
+	}
+	return NULL;
+}
+
+/**
+ * Runs one loop script, returns the value it left in $@test_script_vars_result.
+ *
+ * @param slots false to drop the slots of the script code, so that its
+ *              variables are stored in the vars DB of their reg_db.
+ */
+static int run_loop(const struct loop_case *c, bool slots, int64 *elapsed_ms)
+{
+	const int64 result_uid = reference_uid(script->add_variable("$@test_script_vars_result"), 0);
+	struct script_code *code;
+
+	nullpo_ret(c);
+	mapreg->setreg(result_uid, 0);
+	code = script->parse(c->source, "test_script_vars", 0, SCRIPT_IGNORE_EXTERNAL_BRACKETS, NULL);
+	if (code == NULL)
+		return -1;
+	if (!slots) {
+		script->reg_slots_free(code->local.slots);
+		code->local.slots = NULL;
+		script->var_slots_clear(&code->scope_slots);
+		script->var_slots_clear(&code->npc_slots);
+	}
+
+	int64 tick = timer->gettick_nocache();
+	script->run(code, 0, 0, npc->fake_nd->bl.id);
+	*elapsed_ms = timer->gettick_nocache() - tick;
+
+	script->free_code(code);
+	return mapreg->readreg(result_uid);
+}
+
+/// Checks that the variables named in a script get a slot, unlike the ones only named at run time.
+static const char *test_slots(void)
+{
+	struct script_code *code = script->parse(
+			".@i = 1; .@s$ = \"a\"; .n = .@i; .@a[2] = 3; $@test_script_vars_result = getd(\".@test_script_vars_dyn\");",
+			"test_script_vars", 0, SCRIPT_IGNORE_EXTERNAL_BRACKETS, NULL);
+	static const char *const with_slot[] = { ".@i", ".@s$", ".n", ".@a" };
+	const char *result = NULL;
+
+	if (code == NULL)
+		return "script not parsed";
+	for (int i = 0; i < ARRAYLENGTH(with_slot) && result == NULL; i++) {
+		struct reg_db db = { 0 };
+		const struct script_var_slots *vars = (with_slot[i][1] == '@') ? &code->scope_slots : &code->npc_slots;
+		int id = script->add_variable(with_slot[i]);
+
+		db.slots = script->reg_slots_alloc(vars);
+		if (script->reg_slot(&db, reference_uid(id, 0)) == NULL) {
+			snprintf(out_message, sizeof(out_message), "'%s' has no slot", with_slot[i]);
+			result = out_message;
+		} else if (script->reg_slot(&db, reference_uid(id, 2)) != NULL) {
+			snprintf(out_message, sizeof(out_message), "array element '%s[2]' has a slot", with_slot[i]);
+			result = out_message;
+		}
+		script->reg_slots_free(db.slots);
+	}
+	if (result == NULL && (code->scope_slots.count != 3 || code->npc_slots.count != 1)) {
+		snprintf(out_message, sizeof(out_message), "%d scope and %d npc slots (expected 3 and 1)", code->scope_slots.count, code->npc_slots.count);
+		result = out_message;
+	}
+	script->free_code(code);
+	return result;
+}
+
+static const char *test_cases(const struct loop_case *cases, int count)
+{
+	for (int i = 0; i < count; i++) {
+		const struct loop_case *c = &cases[i];
+		int64 elapsed_ms = 0;
+		int result = run_loop(c, true, &elapsed_ms);
+
+		if (result != c->expected) {
+			snprintf(out_message, sizeof(out_message), "'%s' returned %d (expected %d)", c->name, result, c->expected);
+			return out_message;
+		}
+		result = run_loop(c, false, &elapsed_ms);
+		if (result != c->expected) {
+			snprintf(out_message, sizeof(out_message), "'%s' returned %d without slots (expected %d)", c->name, result, c->expected);
+			return out_message;
+		}
+	}
+	return NULL;
+}
+
+/**
+ * Resolution of a variable as get_val and set_reg did before the names were
+ * classified by script->classify_variable: prefix, postfix and length read
+ * from the name on every access.
+ */
+static int resolve_by_name(int id)
+{
+	const char *name = script->get_str(id);
+	char prefix = name[0];
+	char postfix = name[strlen(name) - 1];
+	int scope;
+
+	if (strlen(name) > SCRIPT_VARNAME_LENGTH)
+		return -1;
+	switch (prefix) {
+	case '@': scope = SCRIPT_VAR_CHAR_TEMP; break;
+	case '$': scope = SCRIPT_VAR_SERVER; break;
+	case '#': scope = name[1] == '#' ? SCRIPT_VAR_ACCOUNT_GLOBAL : SCRIPT_VAR_ACCOUNT; break;
+	case '.': scope = name[1] == '@' ? SCRIPT_VAR_SCOPE : SCRIPT_VAR_NPC; break;
+	case '\'': scope = SCRIPT_VAR_INSTANCE; break;
+	default: scope = SCRIPT_VAR_CHAR; break;
+	}
+	return scope * 2 + (postfix == '$' ? 1 : 0);
+}
+
+/// Resolution of a variable from the fields set by script->classify_variable.
+static int resolve_classified(int id)
+{
+	const struct str_data_struct *data = &script->str_data[id];
+
+	if (data->var_toolong)
+		return -1;
+	return data->var_scope * 2 + data->var_string;
+}
+
+/**
+ * Compares the cost of the resolution of a variable before and after the
+ * classification of the names, over the names of the classification test.
+ */
+static const char *benchmark_resolve(void)
+{
+	int ids[ARRAYLENGTH(classify_cases)];
+	int64 sum_name = 0, sum_classified = 0;
+	int64 tick, name_ms, classified_ms;
+
+	for (int i = 0; i < ARRAYLENGTH(classify_cases); i++)
+		ids[i] = script->add_variable(classify_cases[i].name);
+
+	tick = timer->gettick_nocache();
+	for (int i = 0; i < RESOLVE_ITERATIONS; i++)
+		sum_name += resolve_by_name(ids[i % ARRAYLENGTH(ids)]);
+	name_ms = timer->gettick_nocache() - tick;
+
+	tick = timer->gettick_nocache();
+	for (int i = 0; i < RESOLVE_ITERATIONS; i++)
+		sum_classified += resolve_classified(ids[i % ARRAYLENGTH(ids)]);
+	classified_ms = timer->gettick_nocache() - tick;
+
+	if (sum_name != sum_classified)
+		return "The classified variables don't resolve like their names.";
+	ShowInfo("%d resolutions: %"PRId64" ms from the name (before), %"PRId64" ms classified (after).\n",
+			RESOLVE_ITERATIONS, name_ms, classified_ms);
+	return NULL;
+}
+
+static void benchmark(const struct loop_case *c)
+{
+	int64 slots_ms = 0, db_ms = 0;
+
+	nullpo_retv(c);
+	run_loop(c, true, &slots_ms);
+	run_loop(c, false, &db_ms);
+	ShowInfo("%-14s %d iterations: %"PRId64" ms with slots (%"PRId64" iterations/s), %"PRId64" ms with the vars DB (%"PRId64" iterations/s)\n",
+			c->name, LOOP_ITERATIONS, slots_ms, (int64)LOOP_ITERATIONS * 1000 / max(slots_ms, 1),
+			db_ms, (int64)LOOP_ITERATIONS * 1000 / max(db_ms, 1));
+}
+
+HPExport void plugin_init(void)
+{
+}
+
+HPExport void server_online(void)
+{
+	ShowMessage("===============================================================================\n");
+	ShowStatus("Starting tests.\n");
+
+	TEST("Variable classification", test_classify);
+	TEST("Variable slots", test_slots);
+	TEST("Variable access paths", test_cases, semantic_cases, ARRAYLENGTH(semantic_cases));
+	TEST("Loop results", test_cases, loop_cases, ARRAYLENGTH(loop_cases));
+
+	ShowMessage("===============================================================================\n");
+	ShowStatus("Starting benchmark.\n");
+	TEST("Resolution of the variables", benchmark_resolve);
+	for (int i = 0; i < ARRAYLENGTH(loop_cases); i++)
+		benchmark(&loop_cases[i]);
+
+	ShowMessage("===============================================================================\n");
+	ShowStatus("All tests passed.\n");
+	map->do_shutdown();
+}
+
+HPExport void plugin_final(void)
+{
+}
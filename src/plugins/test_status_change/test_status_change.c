@@ -0,0 +1,326 @@
+/**
+ * This file is part of Hercules.
+ * http://herc.ws - http://github.com/HerculesWS/Hercules
+ *
+ * Copyright (C) 2026 Hercules Dev Team
+ *
+ * Hercules is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Consistency test of the status change slots (status->change_slot_*,
+ * SC_ENTRY, STATUS_CHANGE_ITER) and benchmark of their memory use, of
+ * SC_ENTRY lookups and of a dispel-like loop, compared against a full SC_MAX
+ * scan.
+ *
+ * Usage: ./map-server --load-plugin test_status_change
+ */
+
+#include "common/hercules.h"
+#include "common/core.h"
+#include "common/memmgr.h"
+#include "common/nullpo.h"
+#include "common/random.h"
+#include "common/showmsg.h"
+#include "common/timer.h"
+#include "map/map.h"
+#include "map/mob.h"
+#include "map/status.h"
+
+#include "common/HPMDataCheck.h"
+
+#include <stdlib.h>
+
+HPExport struct hplugin_info pinfo = {
+	"test_status_change", ///< Plugin name
+	SERVER_TYPE_MAP,      ///< Plugin type
+	"0.1",                ///< Plugin version
+	HPM_VERSION,          ///< HPM Version
+};
+
+#define TEST(name, function, ...) do { \
+	const char *message = NULL; \
+	ShowMessage("-------------------------------------------------------------------------------\n"); \
+	ShowNotice("Testing %s...\n", (name)); \
+	if ((message = (function)(__VA_ARGS__)) != NULL) { \
+		ShowError("Failed. %s\n", message); \
+		ShowMessage("===============================================================================\n"); \
+		ShowFatalError("Failure. Aborting further tests.\n"); \
+		exit(EXIT_FAILURE); \
+	} \
+	ShowInfo("Test passed.\n"); \
+} while (false)
+
+#define MUTATIONS 200000      ///< Random status change starts/ends done by the consistency test
+#define BENCH_UNITS 200000    ///< Spawned monsters of the benchmark
+#define BENCH_AFFECTED 5      ///< One in BENCH_AFFECTED monsters has status changes
+#define BENCH_ACTIVE 8        ///< Most status changes active on an affected monster
+#define BENCH_PASSES 5        ///< Passes over all monsters of each benchmark loop
+
+static char out_message[256];
+static struct status_change_entry entries[SC_MAX];
+
+static struct mob_data *make_md(void)
+{
+	struct mob_data *md = NULL;
+	CREATE(md, struct mob_data, 1);
+	md->bl.type = BL_MOB;
+	status->change_init(&md->bl);
+	return md;
+}
+
+static void set_sc(struct status_change *sc, int type, bool active)
+{
+	if (active && SC_ENTRY(sc, type) == NULL) {
+		sc->count++;
+		status->change_slot_set(sc, (sc_type)type, &entries[type]);
+	} else if (!active && SC_ENTRY(sc, type) != NULL) {
+		sc->count--;
+		status->change_slot_clear(sc, (sc_type)type);
+	}
+}
+
+static const char *compare(const struct status_change *sc, const bool *expected)
+{
+	int type, last = SC_NONE, count = 0;
+
+	STATUS_CHANGE_ITER(sc, type) {
+		if (type <= last) {
+			snprintf(out_message, sizeof out_message, "iteration went from %d back to %d", last, type);
+			return out_message;
+		}
+		for (int i = last + 1; i < type; i++) {
+			if (expected[i]) {
+				snprintf(out_message, sizeof out_message, "iteration skipped active status change %d", i);
+				return out_message;
+			}
+		}
+		if (!expected[type] || SC_ENTRY(sc, type) != &entries[type]) {
+			snprintf(out_message, sizeof out_message, "iteration returned inactive status change %d", type);
+			return out_message;
+		}
+		last = type;
+		count++;
+	}
+	for (int i = last + 1; i < SC_MAX; i++) {
+		if (expected[i]) {
+			snprintf(out_message, sizeof out_message, "iteration stopped before active status change %d", i);
+			return out_message;
+		}
+	}
+	if (count != sc->count) {
+		snprintf(out_message, sizeof out_message, "%d status changes iterated, count is %d", count, sc->count);
+		return out_message;
+	}
+	return NULL;
+}
+
+static const char *test_empty(void)
+{
+	struct mob_data *md = make_md();
+	const char *result = NULL;
+
+	if (md->sc.slots != NULL || md->sc.slot_count != 0)
+		result = "new unit has active slots";
+	else if (status->change_next(&md->sc, SC_NONE) != SC_MAX)
+		result = "new unit has an active status change";
+	for (int i = 0; i < SC_MAX && result == NULL; i++) {
+		if (SC_ENTRY(&md->sc, i) != NULL)
+			result = "new unit has a non-NULL entry";
+	}
+	aFree(md);
+	return result;
+}
+
+static const char *test_mutations(void)
+{
+	struct mob_data *md = make_md();
+	bool expected[SC_MAX] = { false };
+	const char *result = NULL;
+
+	for (int i = 0; i < MUTATIONS && result == NULL; i++) {
+		// Mostly low and high types, to exercise the first and last slots
+		int type = rnd->value(0, 2) == 0 ? rnd->value(0, SC_MAX - 1) : (rnd->value(0, 1) == 0 ? rnd->value(0, 40) : rnd->value(SC_MAX - 40, SC_MAX - 1));
+		bool active = rnd->value(0, 1) == 0;
+
+		set_sc(&md->sc, type, active);
+		expected[type] = active;
+		if (i % 500 == 0)
+			result = compare(&md->sc, expected);
+	}
+	if (result == NULL)
+		result = compare(&md->sc, expected);
+
+	// Ending status changes while iterating
+	if (result == NULL) {
+		int type;
+		STATUS_CHANGE_ITER(&md->sc, type) {
+			set_sc(&md->sc, type, false);
+			expected[type] = false;
+			if (type + 1 < SC_MAX) {
+				set_sc(&md->sc, type + 1, false);
+				expected[type + 1] = false;
+			}
+		}
+		result = compare(&md->sc, expected);
+	}
+
+	for (int i = 0; i < SC_MAX; i++)
+		set_sc(&md->sc, i, false);
+	if (result == NULL && (md->sc.slots != NULL || md->sc.slot_count != 0))
+		result = "heap slots weren't released once empty";
+	aFree(md);
+	return result;
+}
+
+static const char *test_inline(void)
+{
+	struct mob_data *md = make_md();
+	const char *result = NULL;
+
+	// Filled backwards, every type is inserted before the previous ones
+	for (int i = STATUS_CHANGE_INLINE_SLOTS; i > 0; i--)
+		set_sc(&md->sc, SC_STUN + i, true);
+	if (md->sc.slots != NULL)
+		result = "heap slots allocated before the inline slots were full";
+	set_sc(&md->sc, SC_STUN, true);
+	for (int i = 0; i <= STATUS_CHANGE_INLINE_SLOTS && result == NULL; i++) {
+		if (SC_ENTRY(&md->sc, SC_STUN + i) != &entries[SC_STUN + i])
+			result = "entry lost when moving to heap slots";
+	}
+	if (result == NULL && md->sc.slots == NULL)
+		result = "more status changes than inline slots without heap slots";
+	for (int i = 0; i < STATUS_CHANGE_INLINE_SLOTS; i++)
+		set_sc(&md->sc, SC_STUN + i, false);
+	if (result == NULL && (md->sc.slots == NULL || SC_ENTRY(&md->sc, SC_STUN + STATUS_CHANGE_INLINE_SLOTS) == NULL))
+		result = "heap slots released with an active status change";
+	status->change_slots_release(&md->sc);
+	if (result == NULL && md->sc.slots == NULL)
+		result = "heap slots released with an active status change";
+	set_sc(&md->sc, SC_STUN + STATUS_CHANGE_INLINE_SLOTS, false);
+	if (result == NULL && md->sc.slots != NULL)
+		result = "heap slots weren't released with the last status change";
+	aFree(md);
+	return result;
+}
+
+static void benchmark(void)
+{
+	static const int lookups[] = { SC_STUN, SC_FREEZE, SC_STONE, SC_SLEEP, SC_BLIND, SC_CURSE, SC_POISON, SC_SILENCE, SC_BLESSING, SC_INC_AGI, SC_DEC_AGI, SC_ANGELUS, SC_PROVOKE, SC_KYRIE, SC_ASSUMPTIO, SC_SAFETYWALL };
+	struct mob_data **units = NULL;
+	int64 sum_scan = 0, sum_iter = 0, sum_lookup = 0;
+	size_t heap = 0;
+	int affected = 0, spilled = 0;
+
+	CREATE(units, struct mob_data *, BENCH_UNITS);
+	for (int i = 0; i < BENCH_UNITS; i++) {
+		units[i] = make_md();
+		if (i % BENCH_AFFECTED == 0) {
+			int active = rnd->value(1, BENCH_ACTIVE);
+			for (int j = 0; j < active; j++)
+				set_sc(&units[i]->sc, rnd->value(SC_COMMON_MIN, SC_MAX - 1), true);
+			affected++;
+		}
+		if (units[i]->sc.slots != NULL) {
+			heap += units[i]->sc.slot_max * sizeof(struct status_change_slot);
+			spilled++;
+		}
+	}
+
+	ShowInfo("%d monsters, %d with 1 to %d status changes (%d beyond the %d inline slots).\n",
+			BENCH_UNITS, affected, BENCH_ACTIVE, spilled, STATUS_CHANGE_INLINE_SLOTS);
+	ShowInfo("Slots: %"PRIuS" KB inline + %"PRIuS" KB on the heap, %"PRIuS" KB with SC_MAX entry pointers per monster.\n",
+			(size_t)BENCH_UNITS * (sizeof(((struct status_change *)NULL)->inline_slots) + sizeof(void *)) / 1024, heap / 1024,
+			(size_t)BENCH_UNITS * SC_MAX * sizeof(struct status_change_entry *) / 1024);
+
+	int64 tick = timer->gettick_nocache();
+	for (int pass = 0; pass < BENCH_PASSES; pass++) {
+		for (int i = 0; i < BENCH_UNITS; i++) {
+			const struct status_change *sc = &units[i]->sc;
+			for (int j = 0; j < ARRAYLENGTH(lookups); j++) {
+				if (SC_ENTRY(sc, lookups[j]) != NULL)
+					sum_lookup += lookups[j];
+			}
+		}
+	}
+	int64 lookup_ms = timer->gettick_nocache() - tick;
+
+	tick = timer->gettick_nocache();
+	for (int pass = 0; pass < BENCH_PASSES; pass++) {
+		for (int i = 0; i < BENCH_UNITS; i++) {
+			const struct status_change *sc = &units[i]->sc;
+			if (sc->count == 0)
+				continue;
+			for (int type = 0; type < SC_MAX; type++) {
+				if (SC_ENTRY(sc, type) != NULL && (status->get_sc_type(type) & SC_NO_DISPELL) == 0)
+					sum_scan += type;
+			}
+		}
+	}
+	int64 scan_ms = timer->gettick_nocache() - tick;
+
+	tick = timer->gettick_nocache();
+	for (int pass = 0; pass < BENCH_PASSES; pass++) {
+		for (int i = 0; i < BENCH_UNITS; i++) {
+			const struct status_change *sc = &units[i]->sc;
+			int type;
+			if (sc->count == 0)
+				continue;
+			STATUS_CHANGE_ITER(sc, type) {
+				if ((status->get_sc_type(type) & SC_NO_DISPELL) == 0)
+					sum_iter += type;
+			}
+		}
+	}
+	int64 iter_ms = timer->gettick_nocache() - tick;
+
+	ShowInfo("%d passes: %d SC_ENTRY lookups per monster %"PRId64" ms (%"PRId64" found).\n",
+			BENCH_PASSES, (int)ARRAYLENGTH(lookups), lookup_ms, sum_lookup);
+	ShowInfo("%d dispel passes: SC_MAX scan %"PRId64" ms, active iteration %"PRId64" ms%s\n",
+			BENCH_PASSES, scan_ms, iter_ms, sum_scan == sum_iter ? "" : " (RESULT MISMATCH)");
+
+	for (int i = 0; i < BENCH_UNITS; i++) {
+		int type;
+		STATUS_CHANGE_ITER(&units[i]->sc, type)
+			set_sc(&units[i]->sc, type, false);
+		aFree(units[i]);
+	}
+	aFree(units);
+}
+
+HPExport void plugin_init(void)
+{
+}
+
+HPExport void server_online(void)
+{
+	ShowMessage("===============================================================================\n");
+	ShowStatus("Starting tests.\n");
+
+	TEST("Units without status changes", test_empty);
+	TEST("Random status change starts and ends", test_mutations);
+	TEST("Inline and heap slots", test_inline);
+
+	ShowMessage("===============================================================================\n");
+	ShowStatus("Starting benchmark.\n");
+	benchmark();
+
+	ShowMessage("===============================================================================\n");
+	ShowStatus("All tests passed.\n");
+	map->do_shutdown();
+}
+
+HPExport void plugin_final(void)
+{
+}
@@ -0,0 +1,282 @@
+/**
+ * This file is part of Hercules.
+ * http://herc.ws - http://github.com/HerculesWS/Hercules
+ *
+ * Copyright (C) 2026 Hercules Dev Team
+ *
+ * Hercules is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Tests of the ip_rules access lists against a linear SUBNET_MATCH scan and
+ * of the bounded connection history, and benchmark of connect_check with a
+ * large deny list under a connection flood.
+ */
+
+#define HERCULES_CORE
+
+#include "common/cbasetypes.h"
+#include "common/core.h"
+#include "common/db.h"
+#include "common/memmgr.h"
+#include "common/showmsg.h"
+#include "common/socket.h"
+#include "common/timer.h"
+
+#include <stdlib.h>
+
+#define TEST(name, function) do { \
+	ShowMessage("-------------------------------------------------------------------------------\n"); \
+	ShowNotice("Testing %s...\n", (name)); \
+	if (!(function)()) { \
+		ShowError("Failed.\n"); \
+		ShowMessage("===============================================================================\n"); \
+		ShowFatalError("Failure. Aborting further tests.\n"); \
+		exit(EXIT_FAILURE); \
+	} \
+	ShowInfo("Test passed.\n"); \
+} while (false)
+
+#define MATCH_RULES 2000        ///< Rules of the consistency test
+#define MATCH_LOOKUPS 200000    ///< Lookups of the consistency test
+#define BENCH_RULES 100000      ///< Deny rules of the benchmark
+#define BENCH_SOURCES 100000    ///< Distinct ips of the connection flood
+#define BENCH_CONNECTIONS 1000000
+#define BENCH_LINEAR_LOOKUPS 10000 ///< Lookups timed with the linear scan, for reference
+
+static uint32 rnd_state = 0x12345678;
+
+/// xorshift32, the tests must not depend on the seed of the server rng.
+static uint32 test_rnd(void)
+{
+	rnd_state ^= rnd_state << 13;
+	rnd_state ^= rnd_state >> 17;
+	rnd_state ^= rnd_state << 5;
+	return rnd_state;
+}
+
+static uint32 prefix_mask(int len)
+{
+	return len == 0 ? 0 : 0xFFFFFFFFU << (32 - len);
+}
+
+static bool linear_match(const struct s_subnet *rules, int count, uint32 ip)
+{
+	for (int i = 0; i < count; i++) {
+		if (SUBNET_MATCH(ip, rules[i].ip, rules[i].mask))
+			return true;
+	}
+	return false;
+}
+
+/// Random ip, inside one of the rules half of the time.
+static uint32 random_ip(const struct s_subnet *rules, int count)
+{
+	uint32 ip = test_rnd();
+
+	if (count > 0 && (test_rnd() & 1) != 0) {
+		const struct s_subnet *rule = &rules[test_rnd() % count];
+		ip = (rule->ip & rule->mask) | (ip & ~rule->mask);
+	}
+	return ip;
+}
+
+static bool test_access_match(void)
+{
+	struct access_list list = { 0 };
+	struct s_subnet *rules;
+	int mismatches = 0;
+
+	VECTOR_INIT(list.nodes);
+	VECTOR_INIT(list.others);
+	CREATE(rules, struct s_subnet, MATCH_RULES);
+
+	for (int i = 0; i < MATCH_RULES; i++) {
+		if (i % 50 == 0) {
+			rules[i].mask = MAKEIP(255U, 0, 255, 0); // non-contiguous
+		} else {
+			rules[i].mask = prefix_mask(8 + (int)(test_rnd() % 25));
+		}
+		rules[i].ip = test_rnd() & rules[i].mask;
+		sockt->access_list_insert(&list, rules[i].ip, rules[i].mask);
+	}
+	if (sockt->access_list_insert(&list, rules[1].ip, rules[1].mask)) {
+		ShowError("Duplicated rule was added again.\n");
+		mismatches++;
+	}
+
+	for (int i = 0; i < MATCH_LOOKUPS; i++) {
+		uint32 ip = random_ip(rules, MATCH_RULES);
+		struct s_subnet match;
+		bool found = sockt->access_list_match(&list, ip, &match);
+
+		if (found != linear_match(rules, MATCH_RULES, ip)) {
+			ShowError("Lookup of %u.%u.%u.%u: trie %d, linear scan %d.\n", CONVIP(ip), found, !found);
+			mismatches++;
+		} else if (found && !SUBNET_MATCH(ip, match.ip, match.mask)) {
+			ShowError("Lookup of %u.%u.%u.%u returned a range that doesn't contain it.\n", CONVIP(ip));
+			mismatches++;
+		}
+		if (mismatches > 10)
+			break;
+	}
+
+	sockt->access_list_insert(&list, 0, 0); // "all"
+	if (!sockt->access_list_match(&list, test_rnd(), NULL)) {
+		ShowError("'all' rule didn't match.\n");
+		mismatches++;
+	}
+
+	sockt->access_list_clear(&list);
+	aFree(rules);
+	return mismatches == 0;
+}
+
+static bool test_connect_history(void)
+{
+	struct connect_history_table table = { 0 };
+	uint32 ips[256];
+	int missing = 0;
+	bool passed = true;
+
+	sockt->connect_history_init(&table, 64);
+	for (int i = 0; i < ARRAYLENGTH(ips); i++) {
+		ips[i] = test_rnd();
+		sockt->connect_history_add(&table, ips[i], i);
+		if (sockt->connect_history_find(&table, ips[i]) == NULL)
+			missing++;
+	}
+	if (missing != 0 || table.count != table.max || table.evicted != ARRAYLENGTH(ips) - table.max) {
+		ShowError("History of %u ips: %d missing after add, %u entries, %u evicted.\n", table.max, missing, table.count, table.evicted);
+		passed = false;
+	}
+	// Old ips are replaced first
+	{
+		int recent = 0;
+		for (int i = ARRAYLENGTH(ips) - 16; i < ARRAYLENGTH(ips); i++) {
+			if (sockt->connect_history_find(&table, ips[i]) != NULL)
+				recent++;
+		}
+		if (recent < 12) {
+			ShowError("Only %d of the 16 most recent ips are left.\n", recent);
+			passed = false;
+		}
+	}
+
+	// Removing entries must not hide the others
+	for (uint32 slot = 0; slot < table.size; slot++) {
+		if (table.slots[slot].used && (table.slots[slot].ip & 1) != 0)
+			sockt->connect_history_remove(&table, slot--);
+	}
+	for (uint32 slot = 0; slot < table.size; slot++) {
+		if (table.slots[slot].used && sockt->connect_history_find(&table, table.slots[slot].ip) != &table.slots[slot]) {
+			ShowError("Entry of %u.%u.%u.%u can't be found after removals.\n", CONVIP(table.slots[slot].ip));
+			passed = false;
+		}
+	}
+	aFree(table.slots);
+
+	// A flood from one ip gets it flagged
+	{
+		uint32 ip = MAKEIP(198U, 51, 100, 7);
+		int i;
+
+		for (i = 0; i < 100 && sockt->connect_check(ip) != 0; i++)
+			;
+		if (i == 100) {
+			ShowError("Flood from %u.%u.%u.%u was not detected.\n", CONVIP(ip));
+			passed = false;
+		}
+	}
+	return passed;
+}
+
+static void benchmark(void)
+{
+	struct s_subnet *rules;
+	uint32 *sources;
+	int64 tick, elapsed;
+	int denied = 0;
+
+	CREATE(rules, struct s_subnet, BENCH_RULES);
+	CREATE(sources, uint32, BENCH_SOURCES);
+
+	tick = timer->gettick_nocache();
+	for (int i = 0; i < BENCH_RULES; i++) {
+		rules[i].mask = prefix_mask(16 + (int)(test_rnd() % 17));
+		rules[i].ip = test_rnd() & rules[i].mask;
+		sockt->access_list_insert(&sockt->access_deny, rules[i].ip, rules[i].mask);
+	}
+	elapsed = timer->gettick_nocache() - tick;
+	ShowInfo("Loaded %d deny rules in %"PRId64" ms (%d trie nodes).\n",
+		sockt->access_deny.count, elapsed, VECTOR_LENGTH(sockt->access_deny.nodes));
+
+	for (int i = 0; i < BENCH_SOURCES; i++)
+		sources[i] = random_ip(rules, BENCH_RULES);
+
+	tick = timer->gettick_nocache();
+	for (int i = 0; i < BENCH_CONNECTIONS; i++) {
+		if (sockt->connect_check(sources[test_rnd() % BENCH_SOURCES]) == 0)
+			denied++;
+	}
+	elapsed = timer->gettick_nocache() - tick;
+	ShowInfo("connect_check: %d connections from %d ips in %"PRId64" ms, %"PRId64" connections/s (%d denied, history %u/%u, %u evicted).\n",
+		BENCH_CONNECTIONS, BENCH_SOURCES, elapsed, (int64)BENCH_CONNECTIONS * 1000 / max(elapsed, 1), denied,
+		sockt->connect_history.count, sockt->connect_history.max, sockt->connect_history.evicted);
+
+	tick = timer->gettick_nocache();
+	denied = 0;
+	for (int i = 0; i < BENCH_LINEAR_LOOKUPS; i++) {
+		if (linear_match(rules, BENCH_RULES, sources[i]))
+			denied++;
+	}
+	elapsed = timer->gettick_nocache() - tick;
+	ShowInfo("Linear scan reference: %d lookups in %"PRId64" ms, %"PRId64" lookups/s.\n",
+		BENCH_LINEAR_LOOKUPS, elapsed, (int64)BENCH_LINEAR_LOOKUPS * 1000 / max(elapsed, 1));
+
+	sockt->access_list_clear(&sockt->access_deny);
+	aFree(sources);
+	aFree(rules);
+}
+
+int do_init(int argc, char **argv)
+{
+	ShowMessage("===============================================================================\n");
+	ShowStatus("Starting tests.\n");
+
+	TEST("Access list lookups", test_access_match);
+	TEST("Connection history", test_connect_history);
+
+	ShowMessage("===============================================================================\n");
+	ShowStatus("Starting benchmark.\n");
+	benchmark();
+
+	core->runflag = CORE_ST_STOP;
+	return EXIT_SUCCESS;
+}
+
+int do_final(void) {
+	ShowMessage("===============================================================================\n");
+	ShowStatus("All tests passed.\n");
+	return EXIT_SUCCESS;
+}
+
+void do_abort(void) { }
+
+void set_server_type(void)
+{
+	SERVER_TYPE = SERVER_TYPE_UNKNOWN;
+}
+
+void cmdline_args_init_local(void) { }
@@ -0,0 +1,243 @@
+/**
+ * This file is part of Hercules.
+ * http://herc.ws - http://github.com/HerculesWS/Hercules
+ *
+ * Copyright (C) 2026 Hercules Dev Team
+ *
+ * Hercules is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Tests of the slabs of the Entry Reusage System: entries stay intact
+ * through random allocations and releases, the statistics match, and the
+ * slabs left unused after a usage peak are released.
+ */
+
+#define HERCULES_CORE
+
+#include "common/cbasetypes.h"
+#include "common/core.h"
+#include "common/ers.h"
+#include "common/showmsg.h"
+#include "common/timer.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST(name, function) do { \
+	ShowMessage("-------------------------------------------------------------------------------\n"); \
+	ShowNotice("Testing %s...\n", (name)); \
+	if (!(function)()) { \
+		ShowError("Failed.\n"); \
+		ShowMessage("===============================================================================\n"); \
+		ShowFatalError("Failure. Aborting further tests.\n"); \
+		exit(EXIT_FAILURE); \
+	} \
+	ShowInfo("Test passed.\n"); \
+} while (false)
+
+#define TEST_ENTRIES 100000    ///< Entries of the usage peak
+#define TEST_OPERATIONS 2000000 ///< Random allocations and releases
+
+/// Entry size that no other manager of the test uses, to have a cache of its own.
+struct test_entry {
+	uint32 id;
+	uint32 check;
+	char data[84];
+};
+
+#ifndef DISABLE_ERS
+static struct test_entry *entries[TEST_ENTRIES];
+static uint32 ids[TEST_ENTRIES];
+
+static uint32 rnd_state = 0x12345678;
+
+/// xorshift32, the tests must not depend on the seed of the server rng.
+static uint32 test_rnd(void)
+{
+	rnd_state ^= rnd_state << 13;
+	rnd_state ^= rnd_state >> 17;
+	rnd_state ^= rnd_state << 5;
+	return rnd_state;
+}
+
+static bool find_stats(ERS *ers, struct ers_cache_stats *out)
+{
+	struct ers_cache_stats stats[256];
+	int count = ers_stats(stats, ARRAYLENGTH(stats));
+
+	for (int i = 0; i < count; i++) {
+		if (stats[i].object_size == ers_entry_size(ers)) {
+			*out = stats[i];
+			return true;
+		}
+	}
+	return false;
+}
+
+static struct test_entry *new_entry(ERS *ers, uint32 id)
+{
+	struct test_entry *e = ers_alloc(ers, struct test_entry);
+
+	e->id = id;
+	e->check = id * 2654435761U;
+	memset(e->data, (int)(id & 0xff), sizeof(e->data));
+	return e;
+}
+
+static bool check_entry(const struct test_entry *e, uint32 id)
+{
+	return e->id == id && e->check == id * 2654435761U && e->data[0] == (char)(id & 0xff) && e->data[sizeof(e->data) - 1] == (char)(id & 0xff);
+}
+
+static bool test_slabs(void)
+{
+	ERS *ers = ers_new(sizeof(struct test_entry), "test_ers::test_slabs", ERS_OPT_NONE);
+	struct ers_cache_stats stats;
+	int live = 0;
+	size_t released;
+	bool passed = true;
+
+	// Random churn around half of the peak
+	for (int i = 0; i < TEST_OPERATIONS && passed; i++) {
+		uint32 r = test_rnd();
+		int n = (int)(r % TEST_ENTRIES);
+
+		if (entries[n] != NULL) {
+			if (!check_entry(entries[n], ids[n])) {
+				ShowError("Entry %d was overwritten.\n", n);
+				passed = false;
+			}
+			ers_free(ers, entries[n]);
+			entries[n] = NULL;
+			live--;
+		} else if ((r >> 24) < 128 + 64) {
+			ids[n] = (uint32)i;
+			entries[n] = new_entry(ers, ids[n]);
+			live++;
+		}
+	}
+	if (!find_stats(ers, &stats)) {
+		ShowError("The cache of the test wasn't found.\n");
+		passed = false;
+	} else if (stats.used != (unsigned int)live || stats.slabs != stats.full_slabs + stats.partial_slabs + stats.empty_slabs) {
+		ShowError("Statistics: %u entries in use (expected %d), %u slabs (%u full, %u partial, %u unused).\n",
+			stats.used, live, stats.slabs, stats.full_slabs, stats.partial_slabs, stats.empty_slabs);
+		passed = false;
+	}
+
+	// Usage peak, then back to a few entries at the start of the allocation order
+	for (int n = 0; n < TEST_ENTRIES; n++) {
+		if (entries[n] == NULL) {
+			ids[n] = (uint32)n;
+			entries[n] = new_entry(ers, ids[n]);
+		}
+	}
+	for (int n = 0; n < TEST_ENTRIES; n++) {
+		if (!check_entry(entries[n], ids[n])) {
+			ShowError("Entry %d was overwritten.\n", n);
+			passed = false;
+			break;
+		}
+	}
+	for (int n = 0; n < TEST_ENTRIES; n++) {
+		if (n % 5000 != 0) {
+			ers_free(ers, entries[n]);
+			entries[n] = NULL;
+		}
+	}
+	released = ers_trim(true);
+	if (!find_stats(ers, &stats) || stats.empty_slabs != 0 || stats.used != TEST_ENTRIES / 5000 || released == 0 || stats.released_slabs == 0) {
+		ShowError("Unused slabs were not released (%"PRIuS" bytes released, %u slabs left).\n", released, stats.slabs);
+		passed = false;
+	}
+	for (int n = 0; n < TEST_ENTRIES; n += 5000) {
+		if (!check_entry(entries[n], ids[n])) {
+			ShowError("Entry %d was overwritten by the release of the slabs.\n", n);
+			passed = false;
+		}
+		ers_free(ers, entries[n]);
+		entries[n] = NULL;
+	}
+	ShowInfo("Released %.2f MB of %u slabs.\n", (double)released / 1024 / 1024, stats.released_slabs);
+
+	ers_destroy(ers);
+	return passed;
+}
+
+/// Entries of new slabs are zeroed, also when the memory of released slabs is reused.
+static bool test_fresh_entries(void)
+{
+	static const struct test_entry zero = { 0 };
+	ERS *ers = ers_new(sizeof(struct test_entry), "test_ers::test_fresh_entries", ERS_OPT_NONE);
+	struct ers_cache_stats stats;
+	bool passed = true;
+
+	for (int n = 0; n < TEST_ENTRIES; n++)
+		entries[n] = new_entry(ers, (uint32)n | 0x80000000U);
+	for (int n = 0; n < TEST_ENTRIES; n++) {
+		ers_free(ers, entries[n]);
+		entries[n] = NULL;
+	}
+	ers_trim(true);
+	if (!find_stats(ers, &stats) || stats.slabs != 0) {
+		ShowError("Unused slabs were not released (%u slabs left).\n", stats.slabs);
+		passed = false;
+	}
+
+	for (int n = 0; n < TEST_ENTRIES; n++) {
+		entries[n] = ers_alloc(ers, struct test_entry);
+		if (passed && memcmp(entries[n], &zero, sizeof(zero)) != 0) {
+			ShowError("Entry %d of a new slab is not zeroed.\n", n);
+			passed = false;
+		}
+	}
+	for (int n = 0; n < TEST_ENTRIES; n++) {
+		ers_free(ers, entries[n]);
+		entries[n] = NULL;
+	}
+
+	ers_destroy(ers);
+	return passed;
+}
+#endif // DISABLE_ERS
+
+int do_init(int argc, char **argv)
+{
+	ShowMessage("===============================================================================\n");
+	ShowStatus("Starting tests.\n");
+
+#ifndef DISABLE_ERS
+	TEST("Slabs of entries", test_slabs);
+	TEST("Zeroed new entries", test_fresh_entries);
+#endif
+
+	core->runflag = CORE_ST_STOP;
+	return EXIT_SUCCESS;
+}
+
+int do_final(void) {
+	ShowMessage("===============================================================================\n");
+	ShowStatus("All tests passed.\n");
+	return EXIT_SUCCESS;
+}
+
+void do_abort(void) { }
+
+void set_server_type(void)
+{
+	SERVER_TYPE = SERVER_TYPE_UNKNOWN;
+}
+
+void cmdline_args_init_local(void) { }
@@ -0,0 +1,233 @@
+/**
+ * This file is part of Hercules.
+ * http://herc.ws - http://github.com/HerculesWS/Hercules
+ *
+ * Copyright (C) 2026 Hercules Dev Team
+ *
+ * Hercules is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Tests of the call site statistics and the trimming of the memory manager,
+ * and benchmark of the allocation cost (to compare builds with and without
+ * NO_MEMMGR_STATS).
+ */
+
+#define HERCULES_CORE
+
+#include "common/cbasetypes.h"
+#include "common/core.h"
+#include "common/memmgr.h"
+#include "common/showmsg.h"
+#include "common/timer.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST(name, function) do { \
+	ShowMessage("-------------------------------------------------------------------------------\n"); \
+	ShowNotice("Testing %s...\n", (name)); \
+	if (!(function)()) { \
+		ShowError("Failed.\n"); \
+		ShowMessage("===============================================================================\n"); \
+		ShowFatalError("Failure. Aborting further tests.\n"); \
+		exit(EXIT_FAILURE); \
+	} \
+	ShowInfo("Test passed.\n"); \
+} while (false)
+
+#define TEST_BLOCKS 200000     ///< Blocks allocated by the tests
+#define BENCH_LIVE 4096        ///< Blocks kept allocated by the benchmark
+#define BENCH_OPERATIONS 20000000 ///< Allocations (and releases) of the benchmark
+
+static void *blocks[TEST_BLOCKS];
+static int site_line;
+
+static uint32 rnd_state = 0x12345678;
+
+/// xorshift32, the tests must not depend on the seed of the server rng.
+static uint32 test_rnd(void)
+{
+	rnd_state ^= rnd_state << 13;
+	rnd_state ^= rnd_state >> 17;
+	rnd_state ^= rnd_state << 5;
+	return rnd_state;
+}
+
+/// The call site of the tests, sizes above BLOCK_DATA_SIZE use the large block path.
+static void *test_alloc(size_t size)
+{
+	site_line = __LINE__ + 1;
+	return aMalloc(size);
+}
+
+#ifdef MEMMGR_STATS
+static bool find_site(struct memmgr_site_stats *out)
+{
+	static struct memmgr_site_stats stats[16384];
+	int count = iMalloc->site_stats(stats, ARRAYLENGTH(stats));
+
+	for (int i = 0; i < count; i++) {
+		if (stats[i].line == site_line && strcmp(stats[i].file, __FILE__) == 0) {
+			*out = stats[i];
+			return true;
+		}
+	}
+	return false;
+}
+
+static bool test_site_stats(void)
+{
+	struct memmgr_site_stats site;
+	size_t bytes = 0;
+	bool passed = true;
+
+	for (int i = 0; i < 1000; i++) {
+		size_t size = (i % 10 == 0) ? 100000 + i : 1 + i;
+		blocks[i] = test_alloc(size);
+		bytes += size;
+	}
+	if (!find_site(&site)) {
+		ShowError("The call site of the test wasn't found.\n");
+		return false;
+	}
+	if (site.live_count != 1000 || site.live_bytes != bytes || site.peak_bytes != bytes || site.allocs - site.frees != 1000) {
+		ShowError("Live statistics: %"PRIuS" blocks, %"PRIuS" bytes (peak %"PRIuS"), expected 1000 blocks, %"PRIuS" bytes.\n",
+			site.live_count, site.live_bytes, site.peak_bytes, bytes);
+		passed = false;
+	}
+	if (strcmp(site.func, "test_alloc") != 0) {
+		ShowError("Call site function is '%s', expected 'test_alloc'.\n", site.func);
+		passed = false;
+	}
+
+	for (int i = 0; i < 1000; i++)
+		aFree(blocks[i]);
+	if (!find_site(&site) || site.live_count != 0 || site.live_bytes != 0 || site.peak_bytes != bytes) {
+		ShowError("Blocks still counted as live after being freed.\n");
+		passed = false;
+	}
+	return passed;
+}
+#endif // MEMMGR_STATS
+
+#ifdef USE_MEMMGR
+/// Blocks kept by test_trim, all among the first allocations so that the later groups of blocks become unused.
+static bool trim_kept(int i)
+{
+	return i < TEST_BLOCKS / 10 && i % 100 == 0;
+}
+
+static bool test_trim(void)
+{
+	size_t released;
+	bool passed = true;
+
+	iMalloc->trim_memory();
+	for (int i = 0; i < TEST_BLOCKS; i++) {
+		blocks[i] = test_alloc(64 + (i % 8) * 16);
+		memset(blocks[i], i & 0xff, 64);
+	}
+	for (int i = 0; i < TEST_BLOCKS; i++) {
+		if (!trim_kept(i))
+			aFree(blocks[i]);
+	}
+	released = iMalloc->trim_memory();
+	if (released == 0) {
+		ShowError("No memory was released.\n");
+		passed = false;
+	}
+	for (int i = 0; i < TEST_BLOCKS; i++) {
+		const unsigned char *p = blocks[i];
+		if (!trim_kept(i))
+			continue;
+		if (!iMalloc->verify_ptr(blocks[i]) || p[0] != (i & 0xff) || p[63] != (i & 0xff)) {
+			ShowError("Block %d was damaged by the trimming.\n", i);
+			passed = false;
+			break;
+		}
+	}
+	// The memory manager must still work after releasing blocks
+	for (int i = 0; i < TEST_BLOCKS; i++) {
+		if (!trim_kept(i))
+			blocks[i] = test_alloc(64 + (i % 8) * 16);
+	}
+	for (int i = 0; i < TEST_BLOCKS; i++)
+		aFree(blocks[i]);
+	ShowInfo("Released %.2f MB.\n", (double)released / 1024 / 1024);
+	return passed;
+}
+#endif // USE_MEMMGR
+
+/// Random allocations and releases of small blocks, as done by most of the servers.
+static void benchmark(void)
+{
+	int64 tick;
+
+	for (int i = 0; i < BENCH_LIVE; i++)
+		blocks[i] = aMalloc(16 + test_rnd() % 512);
+
+	tick = timer->gettick_nocache();
+	for (int i = 0; i < BENCH_OPERATIONS; i++) {
+		uint32 r = test_rnd();
+		int n = r % BENCH_LIVE;
+		aFree(blocks[n]);
+		blocks[n] = aMalloc(16 + (r >> 16) % 512);
+	}
+	tick = timer->gettick_nocache() - tick;
+
+	for (int i = 0; i < BENCH_LIVE; i++)
+		aFree(blocks[i]);
+
+#ifdef MEMMGR_STATS
+	ShowInfo("%d allocations and releases with call site statistics: %"PRId64" ms.\n", BENCH_OPERATIONS, tick);
+#else
+	ShowInfo("%d allocations and releases without call site statistics: %"PRId64" ms.\n", BENCH_OPERATIONS, tick);
+#endif
+}
+
+int do_init(int argc, char **argv)
+{
+	ShowMessage("===============================================================================\n");
+	ShowStatus("Starting tests.\n");
+
+#ifdef MEMMGR_STATS
+	TEST("Call site statistics", test_site_stats);
+#endif
+#ifdef USE_MEMMGR
+	TEST("Trimming of unused blocks", test_trim);
+#endif
+
+	ShowMessage("===============================================================================\n");
+	ShowStatus("Starting benchmark.\n");
+	benchmark();
+
+	core->runflag = CORE_ST_STOP;
+	return EXIT_SUCCESS;
+}
+
+int do_final(void) {
+	ShowMessage("===============================================================================\n");
+	ShowStatus("All tests passed.\n");
+	return EXIT_SUCCESS;
+}
+
+void do_abort(void) { }
+
+void set_server_type(void)
+{
+	SERVER_TYPE = SERVER_TYPE_UNKNOWN;
+}
+
+void cmdline_args_init_local(void) { }
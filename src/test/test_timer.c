@@ -0,0 +1,256 @@
+/**
+ * This file is part of Hercules.
+ * http://herc.ws - http://github.com/HerculesWS/Hercules
+ *
+ * Copyright (C) 2026 Hercules Dev Team
+ *
+ * Hercules is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Tests of the batched timers (timer->add_batch_func) against plain timers,
+ * and benchmark of periodic timers shaped like status change ticks.
+ */
+
+#define HERCULES_CORE
+
+#include "common/cbasetypes.h"
+#include "common/core.h"
+#include "common/memmgr.h"
+#include "common/showmsg.h"
+#include "common/timer.h"
+
+#include <stdlib.h>
+
+#define TEST(name, function) do { \
+	ShowMessage("-------------------------------------------------------------------------------\n"); \
+	ShowNotice("Testing %s...\n", (name)); \
+	if (!(function)()) { \
+		ShowError("Failed.\n"); \
+		ShowMessage("===============================================================================\n"); \
+		ShowFatalError("Failure. Aborting further tests.\n"); \
+		exit(EXIT_FAILURE); \
+	} \
+	ShowInfo("Test passed.\n"); \
+} while (false)
+
+#define TEST_TIMERS 5000
+#define BENCH_TIMERS 50000     ///< Concurrent periodic timers of the benchmark
+#define BENCH_SECONDS 60       ///< Simulated time of the benchmark
+#define BENCH_STEP 10          ///< Simulated main loop period, in ms
+
+struct test_timer {
+	int tid;
+	int64 due;
+	int64 ran_tick;
+	int64 ran_now;
+	int runs;
+	bool deleted;
+};
+
+static struct test_timer timers[TEST_TIMERS];
+static int64 now;
+static int64 last_batched_tick;
+static int64 last_plain_tick;
+static bool out_of_order;
+static uint64 bench_runs;
+static int64 bench_end;
+
+static uint32 rnd_state = 0x12345678;
+
+/// xorshift32, the tests must not depend on the seed of the server rng.
+static uint32 test_rnd(void)
+{
+	rnd_state ^= rnd_state << 13;
+	rnd_state ^= rnd_state >> 17;
+	rnd_state ^= rnd_state << 5;
+	return rnd_state;
+}
+
+static int test_timer_ran(int tid, int64 tick, int id, int64 *last_tick)
+{
+	struct test_timer *t = &timers[id];
+
+	if (t->tid != tid || tick < *last_tick)
+		out_of_order = true;
+	*last_tick = tick;
+	t->ran_tick = tick;
+	t->ran_now = now;
+	t->runs++;
+	t->tid = INVALID_TIMER;
+	return 0;
+}
+
+static int test_timer_func(int tid, int64 tick, int id, intptr_t data)
+{
+	return test_timer_ran(tid, tick, id, &last_batched_tick);
+}
+
+static int test_plain_func(int tid, int64 tick, int id, intptr_t data)
+{
+	return test_timer_ran(tid, tick, id, &last_plain_tick);
+}
+
+/// Periodic timer, re-added on every run like a status change tick.
+static int bench_func(int tid, int64 tick, int id, intptr_t data)
+{
+	bench_runs++;
+	if (tick + 1000 <= bench_end)
+		timer->add(tick + 1000, (TimerFunc)data, id, data);
+	return 0;
+}
+
+static int bench_plain_func(int tid, int64 tick, int id, intptr_t data)
+{
+	return bench_func(tid, tick, id, data);
+}
+
+static bool run_until(int64 start, int64 end)
+{
+	for (now = start; now <= end; now += BENCH_STEP)
+		timer->perform(now);
+	return true;
+}
+
+static bool test_batched_timers(void)
+{
+	const int64 start = 1000000;
+	struct timer_batch_stats before, after;
+	bool passed = true;
+
+	timer->batch_stats(&before);
+	last_batched_tick = last_plain_tick = 0;
+	out_of_order = false;
+
+	for (int i = 0; i < TEST_TIMERS; i++) {
+		// Unaligned ticks, batches hold timers of several ticks
+		timers[i].due = start + test_rnd() % 1000;
+		timers[i].tid = timer->add(timers[i].due, (i % 4) == 0 ? test_plain_func : test_timer_func, i, 0);
+	}
+	for (int i = 0; i < TEST_TIMERS; i += 7) {
+		timer->delete_(timers[i].tid, (i % 4) == 0 ? test_plain_func : test_timer_func);
+		timers[i].deleted = true;
+	}
+	for (int i = 3; i < TEST_TIMERS; i += 11) {
+		if (timers[i].deleted)
+			continue;
+		timers[i].due = start + test_rnd() % 1200;
+		if (timer->settick(timers[i].tid, timers[i].due) != timers[i].due) {
+			ShowError("settick of timer %d failed.\n", i);
+			passed = false;
+		}
+	}
+	for (int i = 0; i < TEST_TIMERS; i++) {
+		const struct TimerData *td = timers[i].deleted ? NULL : timer->get(timers[i].tid);
+		if (td != NULL && td->tick != timers[i].due) {
+			ShowError("Timer %d: get returned tick %"PRId64", expected %"PRId64".\n", i, td->tick, timers[i].due);
+			passed = false;
+		}
+	}
+
+	run_until(start - 100, start + 2000);
+
+	for (int i = 0; i < TEST_TIMERS; i++) {
+		int expected = timers[i].deleted ? 0 : 1;
+		if (timers[i].runs != expected || (expected == 1 && timers[i].ran_tick != timers[i].due)) {
+			ShowError("Timer %d ran %d times at %"PRId64", expected %d at %"PRId64".\n", i, timers[i].runs, timers[i].ran_tick, expected, timers[i].due);
+			passed = false;
+			break;
+		}
+		// Never early, late by the batch granularity and the main loop period at most
+		if (expected == 1 && (timers[i].ran_now < timers[i].due || timers[i].ran_now - timers[i].due >= TIMER_BATCH_GRANULARITY + BENCH_STEP)) {
+			ShowError("Timer %d due at %"PRId64" ran at %"PRId64".\n", i, timers[i].due, timers[i].ran_now);
+			passed = false;
+			break;
+		}
+	}
+	if (out_of_order) {
+		ShowError("Timers ran out of tick order.\n");
+		passed = false;
+	}
+	timer->batch_stats(&after);
+	if (after.timers == before.timers || after.batches == before.batches || after.batches - before.batches >= after.timers - before.timers) {
+		ShowError("Timers were not batched (%"PRIu64" timers in %"PRIu64" batches).\n", after.timers - before.timers, after.batches - before.batches);
+		passed = false;
+	}
+	return passed;
+}
+
+static int64 bench(TimerFunc func, int64 start)
+{
+	int64 tick;
+
+	bench_runs = 0;
+	bench_end = start + BENCH_SECONDS * 1000;
+	// Unaligned start ticks, as status changes started by unrelated units
+	for (int i = 0; i < BENCH_TIMERS; i++)
+		timer->add(start + test_rnd() % 1000, func, i, (intptr_t)func);
+
+	tick = timer->gettick_nocache();
+	run_until(start, bench_end);
+	return timer->gettick_nocache() - tick;
+}
+
+static void benchmark(void)
+{
+	struct timer_batch_stats before, after;
+	int64 plain_ms, batched_ms;
+	uint64 plain_runs;
+
+	plain_ms = bench(bench_plain_func, 10000000);
+	plain_runs = bench_runs;
+	timer->batch_stats(&before);
+	batched_ms = bench(bench_func, 20000000);
+	timer->batch_stats(&after);
+
+	ShowInfo("%d periodic timers, %d s: plain %"PRIu64" runs in %"PRId64" ms, batched %"PRIu64" runs in %"PRId64" ms (%"PRIu64" heap entries).\n",
+		BENCH_TIMERS, BENCH_SECONDS, plain_runs, plain_ms, bench_runs, batched_ms, after.batches - before.batches);
+}
+
+int do_init(int argc, char **argv)
+{
+	timer->add_func_list(test_timer_func, "test_timer_func");
+	timer->add_func_list(test_plain_func, "test_plain_func");
+	timer->add_func_list(bench_func, "bench_func");
+	timer->add_func_list(bench_plain_func, "bench_plain_func");
+	timer->add_batch_func(test_timer_func);
+	timer->add_batch_func(bench_func);
+
+	ShowMessage("===============================================================================\n");
+	ShowStatus("Starting tests.\n");
+
+	TEST("Batched timers", test_batched_timers);
+
+	ShowMessage("===============================================================================\n");
+	ShowStatus("Starting benchmark.\n");
+	benchmark();
+
+	core->runflag = CORE_ST_STOP;
+	return EXIT_SUCCESS;
+}
+
+int do_final(void) {
+	ShowMessage("===============================================================================\n");
+	ShowStatus("All tests passed.\n");
+	return EXIT_SUCCESS;
+}
+
+void do_abort(void) { }
+
+void set_server_type(void)
+{
+	SERVER_TYPE = SERVER_TYPE_UNKNOWN;
+}
+
+void cmdline_args_init_local(void) { }
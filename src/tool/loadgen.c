@@ -0,0 +1,1348 @@
+/**
+ * This file is part of Hercules.
+ * http://herc.ws - http://github.com/HerculesWS/Hercules
+ *
+ * Copyright (C) 2026 Hercules Dev Team
+ *
+ * Hercules is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Headless load generator.
+ *
+ * Logs simulated players in through the login, char and map servers with the
+ * client protocol of the PACKETVER the tool was built with, and keeps them
+ * walking, chatting, attacking the monsters they see and using a skill.
+ * Reports the round trip of CZ_REQUEST_TIME (which includes the map-server
+ * tick latency), packets/s in both directions and the RSS of the servers.
+ *
+ * The map-server packet ids and field offsets are taken from map/packets.h
+ * and the packets_shuffle file of the build, like clif does, and the packet
+ * lengths from common/packets_len.h.
+ *
+ * Requirements on the servers:
+ * - the accounts exist: `loadgen --print-sql --bots <n>` prints them.
+ * - the loadgen ip is in the ddos allow_list of conf/common/socket.conf.
+ * - pincode is disabled, and char creation enabled for the first run.
+ *
+ * Usage: ./loadgen --login 127.0.0.1:6900 --bots 2000 --rate 50 --pids <map pid>,<char pid>,<login pid>
+ */
+
+#define HERCULES_CORE
+
+#include "common/cbasetypes.h"
+#include "common/core.h"
+#include "common/db.h"
+#include "common/memmgr.h"
+#include "common/mmo.h"
+#include "common/packets.h"
+#include "common/random.h"
+#include "common/showmsg.h"
+#include "common/socket.h"
+#include "common/strlib.h"
+#include "common/timer.h"
+#include "common/utils.h"
+#include "char/packets_hc_struct.h"
+#include "login/packets_ac_struct.h"
+#include "login/packets_ca_struct.h"
+#include "map/mapdefines.h"
+#include "map/packets_struct.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LOADGEN_RFIFO_SIZE (64 * 1024)  ///< Largest packet a client can receive
+#define LOADGEN_WFIFO_SIZE (16 * 1024)
+#define LOADGEN_PACKET_POS 8            ///< Field offsets kept per map-server packet
+#define LOADGEN_ACTION_INTERVAL 50      ///< Interval of the action timer, in milliseconds
+#define LOADGEN_SPAWN_INTERVAL 100      ///< Interval of the spawn timer, in milliseconds
+#define LOADGEN_PING_INTERVAL 10000     ///< Interval of the CZ_REQUEST_TIME of each bot
+#define LOADGEN_STATE_TIMEOUT 30000     ///< Time a bot may spend in one handshake step
+#define LOADGEN_SELECT_RETRY 1000       ///< Delay before retrying a char select refused with 0x840
+#define LOADGEN_HISTOGRAM_SIZE 20       ///< log2 buckets of the latency histograms, in milliseconds
+#define LOADGEN_FAILURE_LOGS 20         ///< Failures logged individually per step
+#define LOADGEN_MAX_PIDS 8
+#define LOADGEN_OBJECT_MOB 0x5          ///< CLUT_MOB of map/clif.h
+
+/// Handshake step of a bot.
+enum loadgen_state {
+	LG_STATE_IDLE = 0, ///< Not started yet
+	LG_STATE_LOGIN,    ///< Waiting for the login-server answer
+	LG_STATE_CHAR,     ///< Waiting for the character list
+	LG_STATE_SELECT,   ///< Waiting for the map-server address
+	LG_STATE_MAKECHAR, ///< Waiting for the character creation answer
+	LG_STATE_MAP,      ///< Waiting for the map-server authentication
+	LG_STATE_INGAME,
+	LG_STATE_FAILED,
+	LG_STATE_MAX
+};
+
+static const char *loadgen_state_names[LG_STATE_MAX] = {
+	"idle", "login", "char", "select", "makechar", "map", "ingame", "failed",
+};
+
+/// Map-server packets sent by the bots, by clif handler.
+enum loadgen_map_packet_type {
+	LG_CZ_ENTER = 0,
+	LG_CZ_NOTIFY_ACTORINIT,
+	LG_CZ_REQUEST_TIME,
+	LG_CZ_REQUEST_MOVE,
+	LG_CZ_REQUEST_CHAT,
+	LG_CZ_REQUEST_ACT,
+	LG_CZ_USE_SKILL,
+	LG_CZ_MAX
+};
+
+static const char *loadgen_handler_names[LG_CZ_MAX] = {
+	"pWantToConnection", "pLoadEndAck", "pTickSend", "pWalkToXY", "pGlobalMessage", "pActionRequest", "pUseSkillToId",
+};
+
+enum loadgen_action {
+	LG_ACTION_WALK = 0,
+	LG_ACTION_CHAT,
+	LG_ACTION_ATTACK,
+	LG_ACTION_SKILL,
+	LG_ACTION_MAX
+};
+
+static const char *loadgen_chat_lines[] = {
+	"hello", "anyone selling red potions?", "lf party", "brb", "where is the kafra?", "lol", "gg",
+};
+
+/// Id and field offsets of a map-server packet.
+struct loadgen_map_packet {
+	int id;  ///< 0 if the handler isn't registered in this PACKETVER
+	int len; ///< packets->db length, -1 for variable length
+	int pos[LOADGEN_PACKET_POS];
+};
+
+/// packet() entry of map/packets.h for one of the loadgen_map_packet_type handlers.
+struct loadgen_packet_entry {
+	int id;
+	enum loadgen_map_packet_type type;
+	int pos[LOADGEN_PACKET_POS];
+};
+
+struct loadgen_bot {
+	int index;
+	enum loadgen_state state;
+	int fd;
+	char name[NAME_LENGTH]; ///< account and character name
+	int account_id;
+	int char_id;
+	int login_id1;
+	int login_id2;
+	uint8 sex;
+	uint32 map_ip;
+	uint16 map_port;
+	uint32 crypt_key;      ///< key of the next obfuscated packet id
+	int raw_pending;       ///< bytes of raw account id to skip before the next packet
+	bool selected;         ///< char select sent
+	bool created;          ///< character creation already tried
+	int16 x, y;            ///< spawn position, walks are around it
+	int target_id;         ///< last monster seen
+	int64 start_tick;
+	int64 state_tick;
+	int64 next_action;
+	int64 next_ping;
+	int64 ping_tick;       ///< time the pending CZ_REQUEST_TIME was sent, 0 if none
+	int64 retry_tick;      ///< time to send the char select again, 0 if none
+};
+
+/// session_data of the bot connections, freed by delete_session.
+struct loadgen_link {
+	int bot;
+};
+
+struct loadgen_stats {
+	int64 packets_sent;
+	int64 packets_received;
+	int64 bytes_sent;
+	int64 bytes_received;
+	int64 actions[LG_ACTION_MAX];
+	int pings;
+	int64 rtt_total;
+	int64 rtt_max;
+	int rtt_histogram[LOADGEN_HISTOGRAM_SIZE];
+	int entered;           ///< bots that reached LG_STATE_INGAME
+	int64 enter_total;     ///< time from the login request to the map-server authentication
+	int64 enter_max;
+	int failures[LG_STATE_MAX];
+};
+
+static struct {
+	/* config */
+	uint32 login_ip;
+	uint16 login_port;
+	char prefix[NAME_LENGTH];
+	char password[NAME_LENGTH];
+	int bot_count;
+	int first;
+	int rate;             ///< logins started per second
+	int duration;         ///< seconds, 0 to run until interrupted
+	int action_interval;  ///< average milliseconds between the actions of a bot
+	int report_interval;  ///< seconds
+	int slot;
+	int skill_id;
+	int skill_lv;
+	int walk_range;
+	bool obfuscate;
+	bool print_sql;
+	int pids[LOADGEN_MAX_PIDS];
+	int pid_count;
+
+	/* map-server protocol */
+	struct loadgen_map_packet map_packets[LG_CZ_MAX];
+	uint32 keys[3];
+
+	/* state */
+	struct loadgen_bot *bots;
+	int spawned;
+	int state_count[LG_STATE_MAX];
+	int64 start_tick;
+	int64 report_tick;
+	struct loadgen_stats window; ///< since the last report
+	struct loadgen_stats total;
+} lg;
+
+/*==========================================
+ * Map-server packet table
+ *------------------------------------------*/
+
+static int8 packet_owner[MAX_PACKET_DB + 1]; ///< loadgen_map_packet_type + 1 of the last packet() of each id, 0 for other handlers
+static VECTOR_DECL(struct loadgen_packet_entry) packet_entries;
+
+/// packet() of map/packets.h, args is the stringified handler and offsets.
+static void loadgen_packet_add(int id, const char *args)
+{
+	struct loadgen_packet_entry entry = { 0 };
+	const char *p = strstr(args, "->");
+	size_t len;
+	int type;
+
+	if (id < 0 || id > MAX_PACKET_DB)
+		return;
+
+	p = (p != NULL) ? p + 2 : args;
+	len = strcspn(p, ", ");
+	for (type = 0; type < LG_CZ_MAX; type++) {
+		if (strlen(loadgen_handler_names[type]) == len && strncmp(p, loadgen_handler_names[type], len) == 0)
+			break;
+	}
+	if (type == LG_CZ_MAX) {
+		packet_owner[id] = 0;
+		return;
+	}
+	packet_owner[id] = (int8)(type + 1);
+
+	entry.id = id;
+	entry.type = type;
+	p = strchr(p, ',');
+	for (int i = 0; p != NULL && i < LOADGEN_PACKET_POS; i++) {
+		entry.pos[i] = (int)strtol(p + 1, NULL, 0);
+		p = strchr(p + 1, ',');
+	}
+	VECTOR_ENSURE(packet_entries, 1, 64);
+	VECTOR_PUSH(packet_entries, entry);
+}
+
+/**
+ * Loads the map-server packet ids the way clif->packetdb_loaddb does, and
+ * keeps for each handler the last id still bound to it once the shuffle
+ * file overrode the base ids.
+ */
+static bool loadgen_packetdb_load(void)
+{
+	bool ok = true;
+
+	VECTOR_INIT(packet_entries);
+	memset(packet_owner, 0, sizeof(packet_owner));
+
+#define packet(id, ...) loadgen_packet_add((id), #__VA_ARGS__)
+#include "map/packets.h"
+#ifdef PACKETVER_ZERO
+#include "map/packets_shuffle_zero.h"
+#elif defined(PACKETVER_RE)
+#include "map/packets_shuffle_re.h"
+#else  // PACKETVER_ZERO
+#include "map/packets_shuffle_main.h"
+#endif  // PACKETVER_ZERO
+#undef packet
+#define packetKeys(a,b,c) do { lg.keys[0] = (a); lg.keys[1] = (b); lg.keys[2] = (c); } while(0)
+#if defined(OBFUSCATIONKEY1) && defined(OBFUSCATIONKEY2) && defined(OBFUSCATIONKEY3)
+	packetKeys(OBFUSCATIONKEY1,OBFUSCATIONKEY2,OBFUSCATIONKEY3);
+#else  // defined(OBFUSCATIONKEY1) && defined(OBFUSCATIONKEY2) && defined(OBFUSCATIONKEY3)
+#ifdef PACKETVER_ZERO
+#include "map/packets_keys_zero.h"
+#else  // PACKETVER_ZERO
+#include "map/packets_keys_main.h"
+#endif  // PACKETVER_ZERO
+#endif  // defined(OBFUSCATIONKEY1) && defined(OBFUSCATIONKEY2) && defined(OBFUSCATIONKEY3)
+#undef packetKeys
+
+	for (int i = VECTOR_LENGTH(packet_entries) - 1; i >= 0; i--) {
+		const struct loadgen_packet_entry *entry = &VECTOR_INDEX(packet_entries, i);
+		struct loadgen_map_packet *packet = &lg.map_packets[entry->type];
+
+		if (packet->id != 0 || packet_owner[entry->id] != (int)entry->type + 1)
+			continue;
+		packet->id = entry->id;
+		packet->len = packets->db[entry->id];
+		memcpy(packet->pos, entry->pos, sizeof(packet->pos));
+	}
+	VECTOR_CLEAR(packet_entries);
+
+	for (int type = 0; type < LG_CZ_MAX; type++) {
+		if (lg.map_packets[type].id == 0 || lg.map_packets[type].len == 0) {
+			ShowError("loadgen_packetdb_load: no packet for clif->%s in PACKETVER %d.\n", loadgen_handler_names[type], PACKETVER);
+			ok = false;
+		}
+	}
+	if (lg.obfuscate && lg.keys[1] == 0) {
+		ShowWarning("loadgen_packetdb_load: no obfuscation keys for PACKETVER %d, sending plain packet ids.\n", PACKETVER);
+		lg.obfuscate = false;
+	}
+	return ok;
+}
+
+/*==========================================
+ * Statistics
+ *------------------------------------------*/
+
+static int loadgen_histogram_bucket(int64 ms)
+{
+	int bucket = 0;
+
+	while (bucket < LOADGEN_HISTOGRAM_SIZE - 1 && ms >= ((int64)1 << bucket))
+		bucket++;
+	return bucket;
+}
+
+/// Upper bound in milliseconds of the bucket holding the given percentile.
+static int64 loadgen_histogram_percentile(const int *histogram, int count, int percent)
+{
+	int64 wanted = ((int64)count * percent + 99) / 100;
+	int64 seen = 0;
+
+	for (int i = 0; i < LOADGEN_HISTOGRAM_SIZE; i++) {
+		seen += histogram[i];
+		if (seen >= wanted)
+			return (int64)1 << i;
+	}
+	return (int64)1 << (LOADGEN_HISTOGRAM_SIZE - 1);
+}
+
+static void loadgen_count_sent(int len)
+{
+	lg.window.packets_sent++;
+	lg.window.bytes_sent += len;
+	lg.total.packets_sent++;
+	lg.total.bytes_sent += len;
+}
+
+static void loadgen_count_received(int len)
+{
+	lg.window.packets_received++;
+	lg.window.bytes_received += len;
+	lg.total.packets_received++;
+	lg.total.bytes_received += len;
+}
+
+static void loadgen_count_rtt(struct loadgen_stats *stats, int64 rtt)
+{
+	stats->pings++;
+	stats->rtt_total += rtt;
+	stats->rtt_max = max(stats->rtt_max, rtt);
+	stats->rtt_histogram[loadgen_histogram_bucket(rtt)]++;
+}
+
+static void loadgen_count_enter(struct loadgen_stats *stats, int64 elapsed)
+{
+	stats->entered++;
+	stats->enter_total += elapsed;
+	stats->enter_max = max(stats->enter_max, elapsed);
+}
+
+/// Resident set size of a process in KiB, -1 if it can't be read.
+static int64 loadgen_rss(int pid)
+{
+	char path[64], line[256];
+	int64 rss = -1;
+	FILE *fp;
+
+	if (pid == 0)
+		safestrncpy(path, "/proc/self/status", sizeof(path));
+	else
+		snprintf(path, sizeof(path), "/proc/%d/status", pid);
+	if ((fp = fopen(path, "r")) == NULL)
+		return -1;
+	while (fgets(line, sizeof(line), fp) != NULL) {
+		if (strncmp(line, "VmRSS:", 6) == 0) {
+			rss = strtoll(line + 6, NULL, 10);
+			break;
+		}
+	}
+	fclose(fp);
+	return rss;
+}
+
+static void loadgen_process_name(int pid, char *name, size_t size)
+{
+	char path[64];
+	FILE *fp;
+
+	snprintf(path, sizeof(path), "/proc/%d/comm", pid);
+	if ((fp = fopen(path, "r")) == NULL || fgets(name, (int)size, fp) == NULL) {
+		snprintf(name, size, "%d", pid);
+	} else {
+		name[strcspn(name, "\r\n")] = '\0';
+	}
+	if (fp != NULL)
+		fclose(fp);
+}
+
+static void loadgen_report_stats(const struct loadgen_stats *stats, int64 elapsed)
+{
+	const int64 ms = max(elapsed, 1);
+	StringBuf buf;
+
+	ShowInfo("  bots: %d in game, %d connecting, %d failed (login %d, char %d, select %d, makechar %d, map %d, dropped %d)\n",
+		lg.state_count[LG_STATE_INGAME],
+		lg.state_count[LG_STATE_LOGIN] + lg.state_count[LG_STATE_CHAR] + lg.state_count[LG_STATE_SELECT]
+			+ lg.state_count[LG_STATE_MAKECHAR] + lg.state_count[LG_STATE_MAP],
+		lg.state_count[LG_STATE_FAILED],
+		stats->failures[LG_STATE_LOGIN], stats->failures[LG_STATE_CHAR], stats->failures[LG_STATE_SELECT],
+		stats->failures[LG_STATE_MAKECHAR], stats->failures[LG_STATE_MAP], stats->failures[LG_STATE_INGAME]);
+	ShowInfo("  sent %"PRId64" packets/s (%"PRId64" KiB/s), received %"PRId64" packets/s (%"PRId64" KiB/s)\n",
+		stats->packets_sent * 1000 / ms, stats->bytes_sent * 1000 / ms / 1024,
+		stats->packets_received * 1000 / ms, stats->bytes_received * 1000 / ms / 1024);
+	ShowInfo("  actions: %"PRId64" walk, %"PRId64" chat, %"PRId64" attack, %"PRId64" skill\n",
+		stats->actions[LG_ACTION_WALK], stats->actions[LG_ACTION_CHAT], stats->actions[LG_ACTION_ATTACK], stats->actions[LG_ACTION_SKILL]);
+	if (stats->pings > 0) {
+		ShowInfo("  tick rtt: %d samples, avg %"PRId64" ms, p50 < %"PRId64" ms, p99 < %"PRId64" ms, max %"PRId64" ms\n",
+			stats->pings, stats->rtt_total / stats->pings,
+			loadgen_histogram_percentile(stats->rtt_histogram, stats->pings, 50),
+			loadgen_histogram_percentile(stats->rtt_histogram, stats->pings, 99), stats->rtt_max);
+	}
+	if (stats->entered > 0) {
+		ShowInfo("  login to map: %d bots, avg %"PRId64" ms, max %"PRId64" ms\n",
+			stats->entered, stats->enter_total / stats->entered, stats->enter_max);
+	}
+
+	StrBuf->Init(&buf);
+	StrBuf->Printf(&buf, "  rss: loadgen %"PRId64" MiB", loadgen_rss(0) / 1024);
+	for (int i = 0; i < lg.pid_count; i++) {
+		char name[32];
+		int64 rss = loadgen_rss(lg.pids[i]);
+
+		loadgen_process_name(lg.pids[i], name, sizeof(name));
+		if (rss < 0)
+			StrBuf->Printf(&buf, ", %s n/a", name);
+		else
+			StrBuf->Printf(&buf, ", %s %"PRId64" MiB", name, rss / 1024);
+	}
+	ShowInfo("%s\n", StrBuf->Value(&buf));
+	StrBuf->Destroy(&buf);
+}
+
+static int loadgen_report(int tid, int64 tick, int id, intptr_t data)
+{
+	ShowStatus("Last %"PRId64" s (%"PRId64" s elapsed):\n", DIFF_TICK(tick, lg.report_tick) / 1000, DIFF_TICK(tick, lg.start_tick) / 1000);
+	loadgen_report_stats(&lg.window, DIFF_TICK(tick, lg.report_tick));
+	memset(&lg.window, 0, sizeof(lg.window));
+	lg.report_tick = tick;
+
+	if (lg.duration > 0 && DIFF_TICK(tick, lg.start_tick) >= (int64)lg.duration * 1000)
+		core->runflag = CORE_ST_STOP;
+	return 0;
+}
+
+/*==========================================
+ * Bots
+ *------------------------------------------*/
+
+static void loadgen_set_state(struct loadgen_bot *bot, enum loadgen_state state)
+{
+	lg.state_count[bot->state]--;
+	lg.state_count[state]++;
+	bot->state = state;
+	bot->state_tick = timer->gettick();
+}
+
+static void loadgen_fail(struct loadgen_bot *bot, const char *reason)
+{
+	if (bot->state == LG_STATE_FAILED)
+		return;
+
+	lg.window.failures[bot->state]++;
+	lg.total.failures[bot->state]++;
+	if (lg.total.failures[bot->state] <= LOADGEN_FAILURE_LOGS)
+		ShowWarning("Bot '%s' failed in state %s: %s\n", bot->name, loadgen_state_names[bot->state], reason);
+
+	if (bot->fd > 0 && sockt->session_is_valid(bot->fd))
+		sockt->eof(bot->fd);
+	bot->fd = -1;
+	loadgen_set_state(bot, LG_STATE_FAILED);
+}
+
+/// Opens a connection of the bot, closing the previous one.
+static bool loadgen_connect(struct loadgen_bot *bot, uint32 ip, uint16 port)
+{
+	struct hSockOpt opt = { .silent = 1, .setTimeo = 1 };
+	struct loadgen_link *link;
+	int fd;
+
+	if (bot->fd > 0 && sockt->session_is_valid(bot->fd))
+		sockt->eof(bot->fd);
+	bot->fd = -1;
+
+	if ((fd = sockt->make_connection(ip, port, &opt)) <= 0)
+		return false;
+	sockt->realloc_fifo(fd, LOADGEN_RFIFO_SIZE, LOADGEN_WFIFO_SIZE);
+	CREATE(link, struct loadgen_link, 1);
+	link->bot = bot->index;
+	sockt->session[fd]->session_data = link;
+	bot->fd = fd;
+	return true;
+}
+
+static void loadgen_send_login(struct loadgen_bot *bot)
+{
+	struct PACKET_CA_LOGIN *p;
+	const int len = (int)sizeof(*p);
+
+	WFIFOHEAD(bot->fd, len);
+	p = WFIFOP(bot->fd, 0);
+	memset(p, 0, len);
+	p->packet_id = HEADER_CA_LOGIN;
+	safestrncpy(p->id, bot->name, sizeof(p->id));
+	safestrncpy(p->password, lg.password, sizeof(p->password));
+	WFIFOSET(bot->fd, len);
+	loadgen_count_sent(len);
+}
+
+static void loadgen_start(struct loadgen_bot *bot)
+{
+	bot->start_tick = timer->gettick();
+	loadgen_set_state(bot, LG_STATE_LOGIN);
+	if (!loadgen_connect(bot, lg.login_ip, lg.login_port)) {
+		loadgen_fail(bot, "can't connect to the login-server");
+		return;
+	}
+	loadgen_send_login(bot);
+}
+
+/*==========================================
+ * Login and char-server
+ *------------------------------------------*/
+
+/// CH_ENTER: 0065 <account id>.L <login id1>.L <login id2>.L <unknown>.W <sex>.B
+static void loadgen_send_char_enter(struct loadgen_bot *bot)
+{
+	const int fd = bot->fd;
+
+	WFIFOHEAD(fd, 17);
+	WFIFOW(fd, 0) = 0x65;
+	WFIFOL(fd, 2) = bot->account_id;
+	WFIFOL(fd, 6) = bot->login_id1;
+	WFIFOL(fd, 10) = bot->login_id2;
+	WFIFOW(fd, 14) = 0;
+	WFIFOB(fd, 16) = bot->sex;
+	WFIFOSET(fd, 17);
+	loadgen_count_sent(17);
+}
+
+/// CH_SELECT_CHAR: 0066 <slot>.B
+static void loadgen_send_char_select(struct loadgen_bot *bot)
+{
+	const int fd = bot->fd;
+
+	WFIFOHEAD(fd, 3);
+	WFIFOW(fd, 0) = 0x66;
+	WFIFOB(fd, 2) = lg.slot;
+	WFIFOSET(fd, 3);
+	loadgen_count_sent(3);
+	bot->selected = true;
+	bot->retry_tick = 0;
+	loadgen_set_state(bot, LG_STATE_SELECT);
+}
+
+/// CH_MAKE_CHAR with the layout char_parse_char_create_new_char expects.
+static void loadgen_send_make_char(struct loadgen_bot *bot)
+{
+	const int fd = bot->fd;
+#if PACKETVER >= 20151001
+	const int len = 36;
+#elif PACKETVER >= 20120307
+	const int len = 31;
+#else
+	const int len = 37;
+#endif
+
+	WFIFOHEAD(fd, len);
+	memset(WFIFOP(fd, 0), 0, len);
+	safestrncpy(WFIFOP(fd, 2), bot->name, NAME_LENGTH);
+#if PACKETVER >= 20151001
+	WFIFOW(fd, 0) = 0xa39;
+	WFIFOB(fd, 26) = lg.slot;
+	WFIFOW(fd, 27) = 1; // hair color
+	WFIFOW(fd, 29) = 1; // hair style
+	WFIFOL(fd, 31) = 0; // JOB_NOVICE
+	WFIFOB(fd, 35) = bot->sex;
+#elif PACKETVER >= 20120307
+	WFIFOW(fd, 0) = 0x970;
+	WFIFOB(fd, 26) = lg.slot;
+	WFIFOW(fd, 27) = 1;
+	WFIFOW(fd, 29) = 1;
+#else
+	WFIFOW(fd, 0) = 0x67;
+	memset(WFIFOP(fd, 26), 5, 6); // str, agi, vit, int, dex, luk
+	WFIFOB(fd, 32) = lg.slot;
+	WFIFOW(fd, 33) = 1;
+	WFIFOW(fd, 35) = 1;
+#endif
+	WFIFOSET(fd, len);
+	loadgen_count_sent(len);
+	bot->created = true;
+	loadgen_set_state(bot, LG_STATE_MAKECHAR);
+}
+
+static void loadgen_send_map_enter(struct loadgen_bot *bot);
+
+/// Packets received from the login-server, returns false when the connection is done.
+static bool loadgen_parse_login(struct loadgen_bot *bot, int fd, int cmd, int len)
+{
+	switch (cmd) {
+	case HEADER_AC_ACCEPT_LOGIN:
+	case HEADER_AC_ACCEPT_LOGIN2:
+	{
+		const struct PACKET_AC_ACCEPT_LOGIN *p = RFIFOP(fd, 0);
+		uint32 ip;
+		uint16 port;
+
+		if (len < (int)(sizeof(*p) + sizeof(p->server_list[0]))) {
+			loadgen_fail(bot, "no char-server online");
+			return false;
+		}
+		bot->login_id1 = p->auth_code;
+		bot->account_id = p->aid;
+		bot->login_id2 = p->user_level;
+		bot->sex = p->sex;
+		ip = ntohl(p->server_list[0].ip);
+		port = (uint16)p->server_list[0].port; // [!] LE byte order here [!]
+
+		loadgen_set_state(bot, LG_STATE_CHAR);
+		if (!loadgen_connect(bot, ip, port)) {
+			loadgen_fail(bot, "can't connect to the char-server");
+			return false;
+		}
+		bot->raw_pending = 4; // account id
+		loadgen_send_char_enter(bot);
+		return false;
+	}
+	case HEADER_AC_REFUSE_LOGIN:
+	case HEADER_AC_REFUSE_LOGIN_R2:
+	case HEADER_AC_REFUSE_LOGIN_R3:
+	case HEADER_SC_NOTIFY_BAN:
+		loadgen_fail(bot, "refused by the login-server, check the account and the password");
+		return false;
+	}
+	return true;
+}
+
+/// Packets received from the char-server, returns false when the connection is done.
+static bool loadgen_parse_char(struct loadgen_bot *bot, int fd, int cmd, int len)
+{
+	switch (cmd) {
+#if PACKETVER < 20110309
+	case 0x6b: // HC_ACCEPT_ENTER, the character list
+		if (!bot->selected)
+			loadgen_send_char_select(bot);
+		break;
+#else
+	case 0x8b9: // HC_SECOND_PASSWD_LOGIN, last packet after the character list
+		if (RFIFOW(fd, 10) != 0) {
+			loadgen_fail(bot, "pincode requested, disable it in conf/char/char-server.conf");
+			return false;
+		}
+		if (!bot->selected)
+			loadgen_send_char_select(bot);
+		break;
+#endif
+	case 0x6c: // HC_REFUSE_ENTER
+		if (bot->state == LG_STATE_SELECT && !bot->created) {
+			loadgen_send_make_char(bot);
+			break;
+		}
+		loadgen_fail(bot, "refused by the char-server");
+		return false;
+	case HEADER_HC_ACCEPT_MAKECHAR:
+		loadgen_send_char_select(bot);
+		break;
+	case 0x6e: // HC_REFUSE_MAKECHAR
+		loadgen_fail(bot, "character creation refused, check char_new and the name rules");
+		return false;
+	case 0x81: // SC_NOTIFY_BAN
+		loadgen_fail(bot, "disconnected by the char-server (already online?)");
+		return false;
+	case 0x840: // HC_NOTIFY_ACCESSIBLE_MAPNAME, map-server not ready
+		bot->retry_tick = timer->gettick() + LOADGEN_SELECT_RETRY;
+		break;
+	case 0x71:  // HC_NOTIFY_ZONESVR
+	case 0xac5: // HC_NOTIFY_ZONESVR2
+		bot->char_id = RFIFOL(fd, 2);
+		bot->map_ip = ntohl(RFIFOL(fd, 22));
+		bot->map_port = RFIFOW(fd, 26); // [!] LE byte order here [!]
+		loadgen_set_state(bot, LG_STATE_MAP);
+		if (!loadgen_connect(bot, bot->map_ip, bot->map_port)) {
+			loadgen_fail(bot, "can't connect to the map-server");
+			return false;
+		}
+#if PACKETVER < 20070521
+		bot->raw_pending = 4; // account id
+#endif
+		loadgen_send_map_enter(bot);
+		return false;
+	}
+	return true;
+}
+
+/*==========================================
+ * Map-server
+ *------------------------------------------*/
+
+/**
+ * Starts a map-server packet of the given type, with the (obfuscated) id
+ * written and the rest zeroed.
+ * @param len length of a variable length packet, ignored for fixed ones
+ * @return length of the packet, 0 if it can't be sent
+ */
+static int loadgen_map_begin(struct loadgen_bot *bot, enum loadgen_map_packet_type type, int len)
+{
+	const struct loadgen_map_packet *packet = &lg.map_packets[type];
+	int id = packet->id;
+
+	if (id == 0 || bot->fd <= 0)
+		return 0;
+	if (packet->len > 0)
+		len = packet->len;
+
+	if (lg.obfuscate) {
+		id ^= (bot->crypt_key >> 16) & 0x7FFF;
+		bot->crypt_key = bot->crypt_key * lg.keys[1] + lg.keys[2];
+	}
+	WFIFOHEAD(bot->fd, len);
+	memset(WFIFOP(bot->fd, 0), 0, len);
+	WFIFOW(bot->fd, 0) = id;
+	return len;
+}
+
+static void loadgen_map_end(struct loadgen_bot *bot, int len)
+{
+	WFIFOSET(bot->fd, len);
+	loadgen_count_sent(len);
+}
+
+/// CZ_ENTER
+static void loadgen_send_map_enter(struct loadgen_bot *bot)
+{
+	const int *pos = lg.map_packets[LG_CZ_ENTER].pos;
+	int len;
+
+	bot->crypt_key = lg.keys[0] * lg.keys[1] + lg.keys[2];
+	if ((len = loadgen_map_begin(bot, LG_CZ_ENTER, 0)) == 0)
+		return;
+	WFIFOL(bot->fd, pos[0]) = bot->account_id;
+	WFIFOL(bot->fd, pos[1]) = bot->char_id;
+	WFIFOL(bot->fd, pos[2]) = bot->login_id1;
+	WFIFOL(bot->fd, pos[3]) = (uint32)timer->gettick();
+	WFIFOB(bot->fd, pos[4]) = bot->sex;
+	loadgen_map_end(bot, len);
+}
+
+/// CZ_NOTIFY_ACTORINIT
+static void loadgen_send_map_loaded(struct loadgen_bot *bot)
+{
+	int len;
+
+	if ((len = loadgen_map_begin(bot, LG_CZ_NOTIFY_ACTORINIT, 0)) == 0)
+		return;
+	loadgen_map_end(bot, len);
+}
+
+/// CZ_REQUEST_TIME
+static void loadgen_send_ping(struct loadgen_bot *bot, int64 tick)
+{
+	int len;
+
+	if ((len = loadgen_map_begin(bot, LG_CZ_REQUEST_TIME, 0)) == 0)
+		return;
+	WFIFOL(bot->fd, lg.map_packets[LG_CZ_REQUEST_TIME].pos[0]) = (uint32)tick;
+	loadgen_map_end(bot, len);
+	bot->ping_tick = tick;
+	bot->next_ping = tick + LOADGEN_PING_INTERVAL;
+}
+
+/// CZ_REQUEST_MOVE to a random cell around the spawn point.
+static void loadgen_send_walk(struct loadgen_bot *bot)
+{
+	int16 x = (int16)cap_value(bot->x + rnd->value(-lg.walk_range, lg.walk_range), 0, 1023);
+	int16 y = (int16)cap_value(bot->y + rnd->value(-lg.walk_range, lg.walk_range), 0, 1023);
+	uint8 *p;
+	int len;
+
+	if ((len = loadgen_map_begin(bot, LG_CZ_REQUEST_MOVE, 0)) == 0)
+		return;
+	p = WFIFOP(bot->fd, lg.map_packets[LG_CZ_REQUEST_MOVE].pos[0]);
+	p[0] = (uint8)(x >> 2);
+	p[1] = (uint8)((x << 6) | ((y >> 4) & 0x3f));
+	p[2] = (uint8)(y << 4);
+	loadgen_map_end(bot, len);
+}
+
+/// CZ_REQUEST_CHAT: <packet id>.W <packet len>.W <name> : <text>
+static void loadgen_send_chat(struct loadgen_bot *bot)
+{
+	char message[CHAT_SIZE_MAX];
+	int textlen, len;
+
+	textlen = snprintf(message, sizeof(message), "%s : %s", bot->name, loadgen_chat_lines[rnd->value(0, ARRAYLENGTH(loadgen_chat_lines) - 1)]);
+#if PACKETVER < 20151001
+	textlen++; // NUL terminator
+#endif
+	if ((len = loadgen_map_begin(bot, LG_CZ_REQUEST_CHAT, 4 + textlen)) == 0)
+		return;
+	WFIFOW(bot->fd, 2) = len;
+	memcpy(WFIFOP(bot->fd, 4), message, textlen);
+	loadgen_map_end(bot, len);
+}
+
+/// CZ_REQUEST_ACT, continuous attack on the last monster seen.
+static void loadgen_send_attack(struct loadgen_bot *bot)
+{
+	const int *pos = lg.map_packets[LG_CZ_REQUEST_ACT].pos;
+	int len;
+
+	if ((len = loadgen_map_begin(bot, LG_CZ_REQUEST_ACT, 0)) == 0)
+		return;
+	WFIFOL(bot->fd, pos[0]) = bot->target_id;
+	WFIFOB(bot->fd, pos[1]) = 7;
+	loadgen_map_end(bot, len);
+}
+
+/// CZ_USE_SKILL on self.
+static void loadgen_send_skill(struct loadgen_bot *bot)
+{
+	const int *pos = lg.map_packets[LG_CZ_USE_SKILL].pos;
+	int len;
+
+	if ((len = loadgen_map_begin(bot, LG_CZ_USE_SKILL, 0)) == 0)
+		return;
+	WFIFOW(bot->fd, pos[0]) = lg.skill_lv;
+	WFIFOW(bot->fd, pos[1]) = lg.skill_id;
+	WFIFOL(bot->fd, pos[2]) = bot->account_id;
+	loadgen_map_end(bot, len);
+}
+
+/// Remembers the monsters entering the view of the bot, as attack targets.
+static void loadgen_parse_unit(struct loadgen_bot *bot, int fd, int cmd)
+{
+	int id = 0, job = 0, type = -1;
+
+	if (cmd == idle_unitType) {
+		const struct packet_idle_unit *p = RFIFOP(fd, 0);
+		id = p->GID;
+		job = p->job;
+#if PACKETVER >= 20091103
+		type = p->objecttype;
+#endif
+	} else if (cmd == spawn_unitType) {
+		const struct packet_spawn_unit *p = RFIFOP(fd, 0);
+		id = p->GID;
+		job = p->job;
+#if PACKETVER >= 20091103
+		type = p->objecttype;
+#endif
+	} else {
+		const struct packet_unit_walking *p = RFIFOP(fd, 0);
+		id = p->GID;
+		job = p->job;
+#if PACKETVER >= 20071106
+		type = p->objecttype;
+#endif
+	}
+
+	if (type == LOADGEN_OBJECT_MOB || (type == -1 && job >= 1001 && job < 4000))
+		bot->target_id = id;
+}
+
+/// Packets received from the map-server, returns false when the connection is done.
+static bool loadgen_parse_map(struct loadgen_bot *bot, int fd, int cmd, int len)
+{
+	const int64 tick = timer->gettick();
+
+	if (cmd == authokType && bot->state == LG_STATE_MAP) {
+		const struct packet_authok *p = RFIFOP(fd, 0);
+
+		bot->x = (int16)((p->PosDir[0] << 2) | (p->PosDir[1] >> 6));
+		bot->y = (int16)(((p->PosDir[1] & 0x3f) << 4) | (p->PosDir[2] >> 4));
+		loadgen_send_map_loaded(bot);
+		loadgen_set_state(bot, LG_STATE_INGAME);
+		loadgen_count_enter(&lg.window, DIFF_TICK(tick, bot->start_tick));
+		loadgen_count_enter(&lg.total, DIFF_TICK(tick, bot->start_tick));
+		bot->next_action = tick + rnd->value(0, lg.action_interval);
+		bot->next_ping = tick + rnd->value(0, LOADGEN_PING_INTERVAL);
+		return true;
+	}
+	if (cmd == idle_unitType || cmd == spawn_unitType || cmd == unit_walkingType) {
+		loadgen_parse_unit(bot, fd, cmd);
+		return true;
+	}
+
+	switch (cmd) {
+	case 0x74: // ZC_REFUSE_ENTER
+	case 0x81: // SC_NOTIFY_BAN
+		loadgen_fail(bot, "refused by the map-server");
+		return false;
+	case 0x7f: // ZC_NOTIFY_TIME
+		if (bot->ping_tick != 0) {
+			loadgen_count_rtt(&lg.window, DIFF_TICK(tick, bot->ping_tick));
+			loadgen_count_rtt(&lg.total, DIFF_TICK(tick, bot->ping_tick));
+			bot->ping_tick = 0;
+		}
+		break;
+	case 0x80: // ZC_NOTIFY_VANISH
+		if (RFIFOL(fd, 2) == (uint32)bot->target_id)
+			bot->target_id = 0;
+		break;
+	}
+	return true;
+}
+
+/*==========================================
+ * Connections
+ *------------------------------------------*/
+
+/**
+ * Length of the packet at the head of the fifo.
+ * @return the length, -1 if the packet is incomplete, 0 if it is unknown
+ */
+static int loadgen_packet_length(int fd, int cmd)
+{
+	int len;
+
+	if (cmd > MAX_PACKET_DB || (len = packets->db[cmd]) == 0)
+		return 0;
+	if (len == -1) {
+		if (RFIFOREST(fd) < 4)
+			return -1;
+		if ((len = RFIFOW(fd, 2)) < 4)
+			return 0;
+	}
+	if (RFIFOREST(fd) < (size_t)len)
+		return -1;
+	return len;
+}
+
+static int loadgen_parse(int fd)
+{
+	struct loadgen_link *link = sockt->session[fd]->session_data;
+	struct loadgen_bot *bot = (link != NULL) ? &lg.bots[link->bot] : NULL;
+
+	if (sockt->session[fd]->flag.eof) {
+		if (bot != NULL && bot->fd == fd)
+			loadgen_fail(bot, "disconnected");
+		sockt->close(fd);
+		return 0;
+	}
+	if (bot == NULL || bot->fd != fd) {
+		sockt->eof(fd);
+		return 0;
+	}
+
+	while (RFIFOREST(fd) >= 2) {
+		int cmd, len;
+		bool keep = true;
+
+		if (bot->raw_pending > 0) {
+			if (RFIFOREST(fd) < (size_t)bot->raw_pending)
+				return 0;
+			loadgen_count_received(bot->raw_pending);
+			RFIFOSKIP(fd, bot->raw_pending);
+			bot->raw_pending = 0;
+			continue;
+		}
+
+		cmd = RFIFOW(fd, 0);
+		if ((len = loadgen_packet_length(fd, cmd)) == -1)
+			return 0;
+		if (len == 0) {
+			char reason[64];
+			snprintf(reason, sizeof(reason), "unknown packet 0x%04x, PACKETVER mismatch?", (unsigned int)cmd);
+			loadgen_fail(bot, reason);
+			return 0;
+		}
+		loadgen_count_received(len);
+
+		switch (bot->state) {
+		case LG_STATE_LOGIN:
+			keep = loadgen_parse_login(bot, fd, cmd, len);
+			break;
+		case LG_STATE_CHAR:
+		case LG_STATE_SELECT:
+		case LG_STATE_MAKECHAR:
+			keep = loadgen_parse_char(bot, fd, cmd, len);
+			break;
+		case LG_STATE_MAP:
+		case LG_STATE_INGAME:
+			keep = loadgen_parse_map(bot, fd, cmd, len);
+			break;
+		case LG_STATE_IDLE:
+		case LG_STATE_FAILED:
+		case LG_STATE_MAX:
+			keep = false;
+			break;
+		}
+
+		RFIFOSKIP(fd, len);
+		if (!keep) {
+			// the bot moved on to another server or failed
+			if (sockt->session_is_valid(fd))
+				sockt->eof(fd);
+			return 0;
+		}
+	}
+	return 0;
+}
+
+/*==========================================
+ * Timers
+ *------------------------------------------*/
+
+static int loadgen_spawn(int tid, int64 tick, int id, intptr_t data)
+{
+	int due = (int)min((int64)lg.bot_count, DIFF_TICK(tick, lg.start_tick) * lg.rate / 1000 + 1);
+
+	while (lg.spawned < due)
+		loadgen_start(&lg.bots[lg.spawned++]);
+	return 0;
+}
+
+static void loadgen_act(struct loadgen_bot *bot, int64 tick)
+{
+	int roll = rnd->value(0, 99);
+	enum loadgen_action action;
+
+	if (roll < 40)
+		action = LG_ACTION_WALK;
+	else if (roll < 60)
+		action = LG_ACTION_CHAT;
+	else if (roll < 80)
+		action = LG_ACTION_ATTACK;
+	else
+		action = LG_ACTION_SKILL;
+
+	if (action == LG_ACTION_ATTACK && bot->target_id == 0)
+		action = LG_ACTION_WALK;
+	if (action == LG_ACTION_SKILL && lg.skill_id == 0)
+		action = LG_ACTION_WALK;
+
+	switch (action) {
+	case LG_ACTION_WALK:
+		loadgen_send_walk(bot);
+		break;
+	case LG_ACTION_CHAT:
+		loadgen_send_chat(bot);
+		break;
+	case LG_ACTION_ATTACK:
+		loadgen_send_attack(bot);
+		break;
+	case LG_ACTION_SKILL:
+		loadgen_send_skill(bot);
+		break;
+	case LG_ACTION_MAX:
+		break;
+	}
+	lg.window.actions[action]++;
+	lg.total.actions[action]++;
+	bot->next_action = tick + lg.action_interval / 2 + rnd->value(0, lg.action_interval);
+}
+
+static int loadgen_action_timer(int tid, int64 tick, int id, intptr_t data)
+{
+	for (int i = 0; i < lg.spawned; i++) {
+		struct loadgen_bot *bot = &lg.bots[i];
+
+		switch (bot->state) {
+		case LG_STATE_INGAME:
+			if (DIFF_TICK(tick, bot->next_ping) >= 0)
+				loadgen_send_ping(bot, tick);
+			if (DIFF_TICK(tick, bot->next_action) >= 0)
+				loadgen_act(bot, tick);
+			break;
+		case LG_STATE_LOGIN:
+		case LG_STATE_CHAR:
+		case LG_STATE_SELECT:
+		case LG_STATE_MAKECHAR:
+		case LG_STATE_MAP:
+			if (bot->state == LG_STATE_SELECT && bot->retry_tick != 0 && DIFF_TICK(tick, bot->retry_tick) >= 0)
+				loadgen_send_char_select(bot);
+			else if (DIFF_TICK(tick, bot->state_tick) >= LOADGEN_STATE_TIMEOUT)
+				loadgen_fail(bot, "timed out");
+			break;
+		case LG_STATE_IDLE:
+		case LG_STATE_FAILED:
+		case LG_STATE_MAX:
+			break;
+		}
+	}
+	return 0;
+}
+
+/*==========================================
+ * Command line
+ *------------------------------------------*/
+
+static void loadgen_print_sql(void)
+{
+	ShowMessage("-- %d loadgen accounts\n", lg.bot_count);
+	for (int i = 0; i < lg.bot_count; i++) {
+		ShowMessage("INSERT IGNORE INTO `login` (`userid`, `user_pass`, `sex`, `email`) VALUES ('%s%d', '%s', '%c', 'loadgen@localhost');\n",
+			lg.prefix, lg.first + i, lg.password, (i % 2) ? 'F' : 'M');
+	}
+}
+
+/**
+ * --login handler
+ *
+ * Address of the login-server, as <host>[:<port>].
+ * @see cmdline->exec
+ */
+static CMDLINEARG(login)
+{
+	char host[256];
+	const char *port = strchr(params, ':');
+
+	safestrncpy(host, params, (port != NULL) ? min((size_t)(port - params + 1), sizeof(host)) : sizeof(host));
+	if ((lg.login_ip = sockt->host2ip(host)) == 0) {
+		ShowError("Can't resolve the login-server address '%s'.\n", host);
+		return false;
+	}
+	if (port != NULL)
+		lg.login_port = (uint16)atoi(port + 1);
+	return true;
+}
+
+static CMDLINEARG(bots)
+{
+	lg.bot_count = max(atoi(params), 1);
+	return true;
+}
+
+static CMDLINEARG(first)
+{
+	lg.first = max(atoi(params), 0);
+	return true;
+}
+
+static CMDLINEARG(prefix)
+{
+	safestrncpy(lg.prefix, params, NAME_LENGTH - 8);
+	return true;
+}
+
+static CMDLINEARG(password)
+{
+	safestrncpy(lg.password, params, sizeof(lg.password));
+	return true;
+}
+
+static CMDLINEARG(rate)
+{
+	lg.rate = max(atoi(params), 1);
+	return true;
+}
+
+static CMDLINEARG(duration)
+{
+	lg.duration = max(atoi(params), 0);
+	return true;
+}
+
+static CMDLINEARG(interval)
+{
+	lg.action_interval = max(atoi(params), LOADGEN_ACTION_INTERVAL);
+	return true;
+}
+
+static CMDLINEARG(report)
+{
+	lg.report_interval = max(atoi(params), 1);
+	return true;
+}
+
+static CMDLINEARG(slot)
+{
+	lg.slot = cap_value(atoi(params), 0, MAX_CHARS - 1);
+	return true;
+}
+
+/**
+ * --skill handler
+ *
+ * Skill used on self, as <skill id>[:<level>], 0 to disable.
+ * @see cmdline->exec
+ */
+static CMDLINEARG(skill)
+{
+	const char *level = strchr(params, ':');
+
+	lg.skill_id = max(atoi(params), 0);
+	lg.skill_lv = (level != NULL) ? max(atoi(level + 1), 1) : 1;
+	return true;
+}
+
+static CMDLINEARG(walkrange)
+{
+	lg.walk_range = cap_value(atoi(params), 1, 30);
+	return true;
+}
+
+static CMDLINEARG(obfuscate)
+{
+	lg.obfuscate = true;
+	return true;
+}
+
+static CMDLINEARG(printsql)
+{
+	lg.print_sql = true;
+	return true;
+}
+
+/**
+ * --pids handler
+ *
+ * Comma separated pids of the server processes whose RSS is reported.
+ * @see cmdline->exec
+ */
+static CMDLINEARG(pids)
+{
+	const char *p = params;
+
+	lg.pid_count = 0;
+	while (p != NULL && *p != '\0' && lg.pid_count < LOADGEN_MAX_PIDS) {
+		int pid = atoi(p);
+		if (pid > 0)
+			lg.pids[lg.pid_count++] = pid;
+		if ((p = strchr(p, ',')) != NULL)
+			p++;
+	}
+	return true;
+}
+
+/**
+ * Defines the local command line arguments
+ */
+void cmdline_args_init_local(void)
+{
+	CMDLINEARG_DEF2(login, login, "Login-server address, <host>[:<port>] (default 127.0.0.1:6900).", CMDLINE_OPT_PARAM);
+	CMDLINEARG_DEF2(bots, bots, "Amount of simulated players (default 100).", CMDLINE_OPT_PARAM);
+	CMDLINEARG_DEF2(first, first, "Number of the first account (default 0).", CMDLINE_OPT_PARAM);
+	CMDLINEARG_DEF2(prefix, prefix, "Account and character name prefix (default 'loadgen').", CMDLINE_OPT_PARAM);
+	CMDLINEARG_DEF2(password, password, "Password of the accounts (default 'loadgen').", CMDLINE_OPT_PARAM);
+	CMDLINEARG_DEF2(rate, rate, "Logins started per second (default 20).", CMDLINE_OPT_PARAM);
+	CMDLINEARG_DEF2(duration, duration, "Seconds to run, 0 until interrupted (default 0).", CMDLINE_OPT_PARAM);
+	CMDLINEARG_DEF2(interval, interval, "Average milliseconds between the actions of a player (default 1000).", CMDLINE_OPT_PARAM);
+	CMDLINEARG_DEF2(report, report, "Seconds between reports (default 10).", CMDLINE_OPT_PARAM);
+	CMDLINEARG_DEF2(slot, slot, "Character slot, created if empty (default 0).", CMDLINE_OPT_PARAM);
+	CMDLINEARG_DEF2(skill, skill, "Skill used on self, <id>[:<level>], 0 to disable (default 142:1).", CMDLINE_OPT_PARAM);
+	CMDLINEARG_DEF2(walk-range, walkrange, "Cells walked around the spawn point (default 8).", CMDLINE_OPT_PARAM);
+	CMDLINEARG_DEF2(obfuscate, obfuscate, "Obfuscates the map-server packet ids.", CMDLINE_OPT_NORMAL);
+	CMDLINEARG_DEF2(print-sql, printsql, "Prints the SQL creating the accounts and exits.", CMDLINE_OPT_NORMAL);
+	CMDLINEARG_DEF2(pids, pids, "Comma separated pids of the servers to report the RSS of.", CMDLINE_OPT_PARAM);
+}
+
+/*==========================================
+ * Core
+ *------------------------------------------*/
+
+int do_init(int argc, char **argv)
+{
+	lg.login_ip = MAKEIP(127, 0, 0, 1);
+	lg.login_port = 6900;
+	safestrncpy(lg.prefix, "loadgen", sizeof(lg.prefix));
+	safestrncpy(lg.password, "loadgen", sizeof(lg.password));
+	lg.bot_count = 100;
+	lg.rate = 20;
+	lg.action_interval = 1000;
+	lg.report_interval = 10;
+	lg.skill_id = 142; // NV_FIRSTAID
+	lg.skill_lv = 1;
+	lg.walk_range = 8;
+
+	cmdline->exec(argc, argv, CMDLINE_OPT_NORMAL);
+
+	if (lg.print_sql) {
+		loadgen_print_sql();
+		core->runflag = CORE_ST_STOP;
+		return EXIT_SUCCESS;
+	}
+	if (!loadgen_packetdb_load()) {
+		core->runflag = CORE_ST_STOP;
+		return EXIT_FAILURE;
+	}
+
+	CREATE(lg.bots, struct loadgen_bot, lg.bot_count);
+	for (int i = 0; i < lg.bot_count; i++) {
+		lg.bots[i].index = i;
+		lg.bots[i].fd = -1;
+		snprintf(lg.bots[i].name, sizeof(lg.bots[i].name), "%s%d", lg.prefix, lg.first + i);
+	}
+	lg.state_count[LG_STATE_IDLE] = lg.bot_count;
+
+	sockt->set_defaultparse(loadgen_parse);
+
+	lg.start_tick = lg.report_tick = timer->gettick();
+	timer->add_func_list(loadgen_spawn, "loadgen_spawn");
+	timer->add_func_list(loadgen_action_timer, "loadgen_action_timer");
+	timer->add_func_list(loadgen_report, "loadgen_report");
+	timer->add_interval(lg.start_tick, loadgen_spawn, 0, 0, LOADGEN_SPAWN_INTERVAL);
+	timer->add_interval(lg.start_tick + LOADGEN_ACTION_INTERVAL, loadgen_action_timer, 0, 0, LOADGEN_ACTION_INTERVAL);
+	timer->add_interval(lg.start_tick + lg.report_interval * 1000, loadgen_report, 0, 0, lg.report_interval * 1000);
+
+	ShowStatus("Starting %d bots on %u.%u.%u.%u:%u at %d logins/s (PACKETVER %d%s).\n",
+		lg.bot_count, CONVIP(lg.login_ip), lg.login_port, lg.rate, PACKETVER, lg.obfuscate ? ", obfuscated" : "");
+	return EXIT_SUCCESS;
+}
+
+int do_final(void)
+{
+	if (lg.bots != NULL) {
+		ShowMessage("===============================================================================\n");
+		ShowStatus("Total over %"PRId64" s:\n", DIFF_TICK(timer->gettick(), lg.start_tick) / 1000);
+		loadgen_report_stats(&lg.total, DIFF_TICK(timer->gettick(), lg.start_tick));
+		aFree(lg.bots);
+		lg.bots = NULL;
+	}
+	return EXIT_SUCCESS;
+}
+
+void do_abort(void) { }
+
+void set_server_type(void)
+{
+	SERVER_TYPE = SERVER_TYPE_UNKNOWN;
+}